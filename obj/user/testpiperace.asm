@@ -0,0 +1,7864 @@
+
+obj/user/testpiperace.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 bd 01 00 00       	call   8001ee <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 1c             	sub    $0x1c,%esp
+  int p[2], r, pid, i, max;
+  void *va;
+  struct Fd *fd;
+  const volatile struct Env *kid;
+
+  cprintf("testing for dup race...\n");
+  80003b:	68 c0 3a 80 00       	push   $0x803ac0
+  800040:	e8 f1 02 00 00       	call   800336 <cprintf>
+  if ((r = pipe(p)) < 0)
+  800045:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800048:	89 04 24             	mov    %eax,(%esp)
+  80004b:	e8 2a 2e 00 00       	call   802e7a <pipe>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	78 59                	js     8000b0 <umain+0x7d>
+    panic("pipe: %e", r);
+  max = 200;
+  if ((r = fork()) < 0)
+  800057:	e8 64 13 00 00       	call   8013c0 <fork>
+  80005c:	89 c6                	mov    %eax,%esi
+  80005e:	85 c0                	test   %eax,%eax
+  800060:	78 60                	js     8000c2 <umain+0x8f>
+    panic("fork: %e", r);
+  if (r == 0) {
+  800062:	74 70                	je     8000d4 <umain+0xa1>
+    }
+    // do something to be not runnable besides exiting
+    ipc_recv(0, 0, 0);
+  }
+  pid = r;
+  cprintf("pid is %d\n", pid);
+  800064:	83 ec 08             	sub    $0x8,%esp
+  800067:	56                   	push   %esi
+  800068:	68 11 3b 80 00       	push   $0x803b11
+  80006d:	e8 c4 02 00 00       	call   800336 <cprintf>
+  va = 0;
+  kid = &envs[ENVX(pid)];
+  800072:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  cprintf("kid is %d\n", kid-envs);
+  800078:	83 c4 08             	add    $0x8,%esp
+  80007b:	8d 04 f6             	lea    (%esi,%esi,8),%eax
+  80007e:	69 c0 39 8e e3 38    	imul   $0x38e38e39,%eax,%eax
+  800084:	50                   	push   %eax
+  800085:	68 1c 3b 80 00       	push   $0x803b1c
+  80008a:	e8 a7 02 00 00       	call   800336 <cprintf>
+  dup(p[0], 10);
+  80008f:	83 c4 08             	add    $0x8,%esp
+  800092:	6a 0a                	push   $0xa
+  800094:	ff 75 f0             	push   -0x10(%ebp)
+  800097:	e8 ec 18 00 00       	call   801988 <dup>
+  while (kid->env_status == ENV_RUNNABLE)
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	8d 1c f6             	lea    (%esi,%esi,8),%ebx
+  8000a2:	c1 e3 04             	shl    $0x4,%ebx
+  8000a5:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8000ab:	e9 92 00 00 00       	jmp    800142 <umain+0x10f>
+    panic("pipe: %e", r);
+  8000b0:	50                   	push   %eax
+  8000b1:	68 d9 3a 80 00       	push   $0x803ad9
+  8000b6:	6a 0d                	push   $0xd
+  8000b8:	68 e2 3a 80 00       	push   $0x803ae2
+  8000bd:	e8 99 01 00 00       	call   80025b <_panic>
+    panic("fork: %e", r);
+  8000c2:	50                   	push   %eax
+  8000c3:	68 83 3f 80 00       	push   $0x803f83
+  8000c8:	6a 10                	push   $0x10
+  8000ca:	68 e2 3a 80 00       	push   $0x803ae2
+  8000cf:	e8 87 01 00 00       	call   80025b <_panic>
+    close(p[1]);
+  8000d4:	83 ec 0c             	sub    $0xc,%esp
+  8000d7:	ff 75 f4             	push   -0xc(%ebp)
+  8000da:	e8 57 18 00 00       	call   801936 <close>
+    for (i = 0; i < max; i++) {
+  8000df:	83 c4 10             	add    $0x10,%esp
+  8000e2:	bb c9 00 00 00       	mov    $0xc9,%ebx
+  8000e7:	eb 05                	jmp    8000ee <umain+0xbb>
+      sys_yield();
+  8000e9:	e8 03 0c 00 00       	call   800cf1 <sys_yield>
+    for (i = 0; i < max; i++) {
+  8000ee:	83 eb 01             	sub    $0x1,%ebx
+  8000f1:	74 29                	je     80011c <umain+0xe9>
+      if (pipeisclosed(p[0])) {
+  8000f3:	83 ec 0c             	sub    $0xc,%esp
+  8000f6:	ff 75 f0             	push   -0x10(%ebp)
+  8000f9:	e8 8e 2d 00 00       	call   802e8c <pipeisclosed>
+  8000fe:	83 c4 10             	add    $0x10,%esp
+  800101:	85 c0                	test   %eax,%eax
+  800103:	74 e4                	je     8000e9 <umain+0xb6>
+        cprintf("RACE: pipe appears closed\n");
+  800105:	83 ec 0c             	sub    $0xc,%esp
+  800108:	68 f6 3a 80 00       	push   $0x803af6
+  80010d:	e8 24 02 00 00       	call   800336 <cprintf>
+        exit();
+  800112:	e8 2a 01 00 00       	call   800241 <exit>
+  800117:	83 c4 10             	add    $0x10,%esp
+  80011a:	eb cd                	jmp    8000e9 <umain+0xb6>
+    ipc_recv(0, 0, 0);
+  80011c:	83 ec 04             	sub    $0x4,%esp
+  80011f:	6a 00                	push   $0x0
+  800121:	6a 00                	push   $0x0
+  800123:	6a 00                	push   $0x0
+  800125:	e8 8f 15 00 00       	call   8016b9 <ipc_recv>
+  80012a:	83 c4 10             	add    $0x10,%esp
+  80012d:	e9 32 ff ff ff       	jmp    800064 <umain+0x31>
+    dup(p[0], 10);
+  800132:	83 ec 08             	sub    $0x8,%esp
+  800135:	6a 0a                	push   $0xa
+  800137:	ff 75 f0             	push   -0x10(%ebp)
+  80013a:	e8 49 18 00 00       	call   801988 <dup>
+  80013f:	83 c4 10             	add    $0x10,%esp
+  while (kid->env_status == ENV_RUNNABLE)
+  800142:	8b 43 54             	mov    0x54(%ebx),%eax
+  800145:	83 f8 02             	cmp    $0x2,%eax
+  800148:	74 e8                	je     800132 <umain+0xff>
+
+  cprintf("child done with loop\n");
+  80014a:	83 ec 0c             	sub    $0xc,%esp
+  80014d:	68 27 3b 80 00       	push   $0x803b27
+  800152:	e8 df 01 00 00       	call   800336 <cprintf>
+  if (pipeisclosed(p[0]))
+  800157:	83 c4 04             	add    $0x4,%esp
+  80015a:	ff 75 f0             	push   -0x10(%ebp)
+  80015d:	e8 2a 2d 00 00       	call   802e8c <pipeisclosed>
+  800162:	83 c4 10             	add    $0x10,%esp
+  800165:	85 c0                	test   %eax,%eax
+  800167:	75 48                	jne    8001b1 <umain+0x17e>
+    panic("somehow the other end of p[0] got closed!");
+  if ((r = fd_lookup(p[0], &fd)) < 0)
+  800169:	83 ec 08             	sub    $0x8,%esp
+  80016c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80016f:	50                   	push   %eax
+  800170:	ff 75 f0             	push   -0x10(%ebp)
+  800173:	e8 9b 16 00 00       	call   801813 <fd_lookup>
+  800178:	83 c4 10             	add    $0x10,%esp
+  80017b:	85 c0                	test   %eax,%eax
+  80017d:	78 46                	js     8001c5 <umain+0x192>
+    panic("cannot look up p[0]: %e", r);
+  va = fd2data(fd);
+  80017f:	83 ec 0c             	sub    $0xc,%esp
+  800182:	ff 75 ec             	push   -0x14(%ebp)
+  800185:	e8 1f 16 00 00       	call   8017a9 <fd2data>
+  if (pageref(va) != 3+1)
+  80018a:	89 04 24             	mov    %eax,(%esp)
+  80018d:	e8 38 26 00 00       	call   8027ca <pageref>
+  800192:	83 c4 10             	add    $0x10,%esp
+  800195:	83 f8 04             	cmp    $0x4,%eax
+  800198:	74 3d                	je     8001d7 <umain+0x1a4>
+    cprintf("\nchild detected race\n");
+  80019a:	83 ec 0c             	sub    $0xc,%esp
+  80019d:	68 55 3b 80 00       	push   $0x803b55
+  8001a2:	e8 8f 01 00 00       	call   800336 <cprintf>
+  8001a7:	83 c4 10             	add    $0x10,%esp
+  else
+    cprintf("\nrace didn't happen\n", max);
+}
+  8001aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001ad:	5b                   	pop    %ebx
+  8001ae:	5e                   	pop    %esi
+  8001af:	5d                   	pop    %ebp
+  8001b0:	c3                   	ret
+    panic("somehow the other end of p[0] got closed!");
+  8001b1:	83 ec 04             	sub    $0x4,%esp
+  8001b4:	68 80 3b 80 00       	push   $0x803b80
+  8001b9:	6a 3a                	push   $0x3a
+  8001bb:	68 e2 3a 80 00       	push   $0x803ae2
+  8001c0:	e8 96 00 00 00       	call   80025b <_panic>
+    panic("cannot look up p[0]: %e", r);
+  8001c5:	50                   	push   %eax
+  8001c6:	68 3d 3b 80 00       	push   $0x803b3d
+  8001cb:	6a 3c                	push   $0x3c
+  8001cd:	68 e2 3a 80 00       	push   $0x803ae2
+  8001d2:	e8 84 00 00 00       	call   80025b <_panic>
+    cprintf("\nrace didn't happen\n", max);
+  8001d7:	83 ec 08             	sub    $0x8,%esp
+  8001da:	68 c8 00 00 00       	push   $0xc8
+  8001df:	68 6b 3b 80 00       	push   $0x803b6b
+  8001e4:	e8 4d 01 00 00       	call   800336 <cprintf>
+  8001e9:	83 c4 10             	add    $0x10,%esp
+}
+  8001ec:	eb bc                	jmp    8001aa <umain+0x177>
+
+008001ee <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ee:	55                   	push   %ebp
+  8001ef:	89 e5                	mov    %esp,%ebp
+  8001f1:	56                   	push   %esi
+  8001f2:	53                   	push   %ebx
+  8001f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001f6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8001f9:	c7 05 a0 68 80 00 00 	movl   $0x0,0x8068a0
+  800200:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800203:	e8 ca 0a 00 00       	call   800cd2 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800208:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80020d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800210:	c1 e0 04             	shl    $0x4,%eax
+  800213:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800218:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80021d:	85 db                	test   %ebx,%ebx
+  80021f:	7e 07                	jle    800228 <libmain+0x3a>
+    binaryname = argv[0];
+  800221:	8b 06                	mov    (%esi),%eax
+  800223:	a3 00 50 80 00       	mov    %eax,0x805000
+
+  // call user main routine
+  umain(argc, argv);
+  800228:	83 ec 08             	sub    $0x8,%esp
+  80022b:	56                   	push   %esi
+  80022c:	53                   	push   %ebx
+  80022d:	e8 01 fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800232:	e8 0a 00 00 00       	call   800241 <exit>
+}
+  800237:	83 c4 10             	add    $0x10,%esp
+  80023a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80023d:	5b                   	pop    %ebx
+  80023e:	5e                   	pop    %esi
+  80023f:	5d                   	pop    %ebp
+  800240:	c3                   	ret
+
+00800241 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800241:	55                   	push   %ebp
+  800242:	89 e5                	mov    %esp,%ebp
+  800244:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800247:	e8 17 17 00 00       	call   801963 <close_all>
+  sys_env_destroy(0);
+  80024c:	83 ec 0c             	sub    $0xc,%esp
+  80024f:	6a 00                	push   $0x0
+  800251:	e8 3b 0a 00 00       	call   800c91 <sys_env_destroy>
+}
+  800256:	83 c4 10             	add    $0x10,%esp
+  800259:	c9                   	leave
+  80025a:	c3                   	ret
+
+0080025b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80025b:	55                   	push   %ebp
+  80025c:	89 e5                	mov    %esp,%ebp
+  80025e:	56                   	push   %esi
+  80025f:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  800260:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800263:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800269:	e8 64 0a 00 00       	call   800cd2 <sys_getenvid>
+  80026e:	83 ec 0c             	sub    $0xc,%esp
+  800271:	ff 75 0c             	push   0xc(%ebp)
+  800274:	ff 75 08             	push   0x8(%ebp)
+  800277:	56                   	push   %esi
+  800278:	50                   	push   %eax
+  800279:	68 b4 3b 80 00       	push   $0x803bb4
+  80027e:	e8 b3 00 00 00       	call   800336 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800283:	83 c4 18             	add    $0x18,%esp
+  800286:	53                   	push   %ebx
+  800287:	ff 75 10             	push   0x10(%ebp)
+  80028a:	e8 56 00 00 00       	call   8002e5 <vcprintf>
+  cprintf("\n");
+  80028f:	c7 04 24 d7 3a 80 00 	movl   $0x803ad7,(%esp)
+  800296:	e8 9b 00 00 00       	call   800336 <cprintf>
+  80029b:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80029e:	cc                   	int3
+  while (1)
+  80029f:	eb fd                	jmp    80029e <_panic+0x43>
+
+008002a1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002a1:	55                   	push   %ebp
+  8002a2:	89 e5                	mov    %esp,%ebp
+  8002a4:	53                   	push   %ebx
+  8002a5:	83 ec 04             	sub    $0x4,%esp
+  8002a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8002ab:	8b 13                	mov    (%ebx),%edx
+  8002ad:	8d 42 01             	lea    0x1(%edx),%eax
+  8002b0:	89 03                	mov    %eax,(%ebx)
+  8002b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002b5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8002b9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002be:	74 09                	je     8002c9 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8002c0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002c7:	c9                   	leave
+  8002c8:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8002c9:	83 ec 08             	sub    $0x8,%esp
+  8002cc:	68 ff 00 00 00       	push   $0xff
+  8002d1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002d4:	50                   	push   %eax
+  8002d5:	e8 7a 09 00 00       	call   800c54 <sys_cputs>
+    b->idx = 0;
+  8002da:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002e0:	83 c4 10             	add    $0x10,%esp
+  8002e3:	eb db                	jmp    8002c0 <putch+0x1f>
+
+008002e5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002e5:	55                   	push   %ebp
+  8002e6:	89 e5                	mov    %esp,%ebp
+  8002e8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8002ee:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002f5:	00 00 00 
+  b.cnt = 0;
+  8002f8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002ff:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800302:	ff 75 0c             	push   0xc(%ebp)
+  800305:	ff 75 08             	push   0x8(%ebp)
+  800308:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80030e:	50                   	push   %eax
+  80030f:	68 a1 02 80 00       	push   $0x8002a1
+  800314:	e8 14 01 00 00       	call   80042d <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800319:	83 c4 08             	add    $0x8,%esp
+  80031c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800322:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800328:	50                   	push   %eax
+  800329:	e8 26 09 00 00       	call   800c54 <sys_cputs>
+
+  return b.cnt;
+}
+  80032e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800334:	c9                   	leave
+  800335:	c3                   	ret
+
+00800336 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800336:	55                   	push   %ebp
+  800337:	89 e5                	mov    %esp,%ebp
+  800339:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80033c:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80033f:	50                   	push   %eax
+  800340:	ff 75 08             	push   0x8(%ebp)
+  800343:	e8 9d ff ff ff       	call   8002e5 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800348:	c9                   	leave
+  800349:	c3                   	ret
+
+0080034a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  80034a:	55                   	push   %ebp
+  80034b:	89 e5                	mov    %esp,%ebp
+  80034d:	57                   	push   %edi
+  80034e:	56                   	push   %esi
+  80034f:	53                   	push   %ebx
+  800350:	83 ec 1c             	sub    $0x1c,%esp
+  800353:	89 c7                	mov    %eax,%edi
+  800355:	89 d6                	mov    %edx,%esi
+  800357:	8b 45 08             	mov    0x8(%ebp),%eax
+  80035a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80035d:	89 d1                	mov    %edx,%ecx
+  80035f:	89 c2                	mov    %eax,%edx
+  800361:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800364:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800367:	8b 45 10             	mov    0x10(%ebp),%eax
+  80036a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80036d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800370:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800377:	39 c2                	cmp    %eax,%edx
+  800379:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80037c:	72 3e                	jb     8003bc <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80037e:	83 ec 0c             	sub    $0xc,%esp
+  800381:	ff 75 18             	push   0x18(%ebp)
+  800384:	83 eb 01             	sub    $0x1,%ebx
+  800387:	53                   	push   %ebx
+  800388:	50                   	push   %eax
+  800389:	83 ec 08             	sub    $0x8,%esp
+  80038c:	ff 75 e4             	push   -0x1c(%ebp)
+  80038f:	ff 75 e0             	push   -0x20(%ebp)
+  800392:	ff 75 dc             	push   -0x24(%ebp)
+  800395:	ff 75 d8             	push   -0x28(%ebp)
+  800398:	e8 90 35 00 00       	call   80392d <__udivdi3>
+  80039d:	83 c4 18             	add    $0x18,%esp
+  8003a0:	52                   	push   %edx
+  8003a1:	50                   	push   %eax
+  8003a2:	89 f2                	mov    %esi,%edx
+  8003a4:	89 f8                	mov    %edi,%eax
+  8003a6:	e8 9f ff ff ff       	call   80034a <printnum>
+  8003ab:	83 c4 20             	add    $0x20,%esp
+  8003ae:	eb 13                	jmp    8003c3 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8003b0:	83 ec 08             	sub    $0x8,%esp
+  8003b3:	56                   	push   %esi
+  8003b4:	ff 75 18             	push   0x18(%ebp)
+  8003b7:	ff d7                	call   *%edi
+  8003b9:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8003bc:	83 eb 01             	sub    $0x1,%ebx
+  8003bf:	85 db                	test   %ebx,%ebx
+  8003c1:	7f ed                	jg     8003b0 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8003c3:	83 ec 08             	sub    $0x8,%esp
+  8003c6:	56                   	push   %esi
+  8003c7:	83 ec 04             	sub    $0x4,%esp
+  8003ca:	ff 75 e4             	push   -0x1c(%ebp)
+  8003cd:	ff 75 e0             	push   -0x20(%ebp)
+  8003d0:	ff 75 dc             	push   -0x24(%ebp)
+  8003d3:	ff 75 d8             	push   -0x28(%ebp)
+  8003d6:	e8 73 35 00 00       	call   80394e <__umoddi3>
+  8003db:	83 c4 14             	add    $0x14,%esp
+  8003de:	0f be 80 d7 3b 80 00 	movsbl 0x803bd7(%eax),%eax
+  8003e5:	50                   	push   %eax
+  8003e6:	ff d7                	call   *%edi
+}
+  8003e8:	83 c4 10             	add    $0x10,%esp
+  8003eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ee:	5b                   	pop    %ebx
+  8003ef:	5e                   	pop    %esi
+  8003f0:	5f                   	pop    %edi
+  8003f1:	5d                   	pop    %ebp
+  8003f2:	c3                   	ret
+
+008003f3 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003f3:	55                   	push   %ebp
+  8003f4:	89 e5                	mov    %esp,%ebp
+  8003f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8003f9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8003fd:	8b 10                	mov    (%eax),%edx
+  8003ff:	3b 50 04             	cmp    0x4(%eax),%edx
+  800402:	73 0a                	jae    80040e <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800404:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800407:	89 08                	mov    %ecx,(%eax)
+  800409:	8b 45 08             	mov    0x8(%ebp),%eax
+  80040c:	88 02                	mov    %al,(%edx)
+}
+  80040e:	5d                   	pop    %ebp
+  80040f:	c3                   	ret
+
+00800410 <printfmt>:
+{
+  800410:	55                   	push   %ebp
+  800411:	89 e5                	mov    %esp,%ebp
+  800413:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800416:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800419:	50                   	push   %eax
+  80041a:	ff 75 10             	push   0x10(%ebp)
+  80041d:	ff 75 0c             	push   0xc(%ebp)
+  800420:	ff 75 08             	push   0x8(%ebp)
+  800423:	e8 05 00 00 00       	call   80042d <vprintfmt>
+}
+  800428:	83 c4 10             	add    $0x10,%esp
+  80042b:	c9                   	leave
+  80042c:	c3                   	ret
+
+0080042d <vprintfmt>:
+{
+  80042d:	55                   	push   %ebp
+  80042e:	89 e5                	mov    %esp,%ebp
+  800430:	57                   	push   %edi
+  800431:	56                   	push   %esi
+  800432:	53                   	push   %ebx
+  800433:	83 ec 2c             	sub    $0x2c,%esp
+  800436:	8b 75 08             	mov    0x8(%ebp),%esi
+  800439:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80043c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80043f:	eb 0a                	jmp    80044b <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800441:	83 ec 08             	sub    $0x8,%esp
+  800444:	53                   	push   %ebx
+  800445:	50                   	push   %eax
+  800446:	ff d6                	call   *%esi
+  800448:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80044b:	83 c7 01             	add    $0x1,%edi
+  80044e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800452:	83 f8 25             	cmp    $0x25,%eax
+  800455:	74 0c                	je     800463 <vprintfmt+0x36>
+      if (ch == '\0')
+  800457:	85 c0                	test   %eax,%eax
+  800459:	75 e6                	jne    800441 <vprintfmt+0x14>
+}
+  80045b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80045e:	5b                   	pop    %ebx
+  80045f:	5e                   	pop    %esi
+  800460:	5f                   	pop    %edi
+  800461:	5d                   	pop    %ebp
+  800462:	c3                   	ret
+    padc = ' ';
+  800463:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800467:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80046e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800475:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80047c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800481:	8d 47 01             	lea    0x1(%edi),%eax
+  800484:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800487:	0f b6 17             	movzbl (%edi),%edx
+  80048a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80048d:	3c 55                	cmp    $0x55,%al
+  80048f:	0f 87 cf 03 00 00    	ja     800864 <vprintfmt+0x437>
+  800495:	0f b6 c0             	movzbl %al,%eax
+  800498:	ff 24 85 20 3d 80 00 	jmp    *0x803d20(,%eax,4)
+  80049f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8004a2:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004a6:	eb d9                	jmp    800481 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8004a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004ab:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004af:	eb d0                	jmp    800481 <vprintfmt+0x54>
+  8004b1:	0f b6 d2             	movzbl %dl,%edx
+  8004b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8004b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004bc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8004bf:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004c2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8004c6:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8004c9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004cc:	83 f9 09             	cmp    $0x9,%ecx
+  8004cf:	77 55                	ja     800526 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8004d1:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8004d4:	eb e9                	jmp    8004bf <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8004d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d9:	8b 00                	mov    (%eax),%eax
+  8004db:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e1:	8d 40 04             	lea    0x4(%eax),%eax
+  8004e4:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8004e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8004ea:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004ee:	79 91                	jns    800481 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8004f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004fd:	eb 82                	jmp    800481 <vprintfmt+0x54>
+      if (width < 0)
+  8004ff:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800502:	85 d2                	test   %edx,%edx
+  800504:	b8 00 00 00 00       	mov    $0x0,%eax
+  800509:	0f 49 c2             	cmovns %edx,%eax
+  80050c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80050f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800512:	e9 6a ff ff ff       	jmp    800481 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800517:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  80051a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800521:	e9 5b ff ff ff       	jmp    800481 <vprintfmt+0x54>
+  800526:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800529:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80052c:	eb bc                	jmp    8004ea <vprintfmt+0xbd>
+      lflag++;
+  80052e:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800531:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800534:	e9 48 ff ff ff       	jmp    800481 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800539:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053c:	8d 78 04             	lea    0x4(%eax),%edi
+  80053f:	83 ec 08             	sub    $0x8,%esp
+  800542:	53                   	push   %ebx
+  800543:	ff 30                	push   (%eax)
+  800545:	ff d6                	call   *%esi
+      break;
+  800547:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  80054a:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80054d:	e9 b1 02 00 00       	jmp    800803 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800552:	8b 45 14             	mov    0x14(%ebp),%eax
+  800555:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800558:	8b 10                	mov    (%eax),%edx
+  80055a:	89 d0                	mov    %edx,%eax
+  80055c:	f7 d8                	neg    %eax
+  80055e:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800561:	83 f8 10             	cmp    $0x10,%eax
+  800564:	7f 23                	jg     800589 <vprintfmt+0x15c>
+  800566:	8b 14 85 80 3e 80 00 	mov    0x803e80(,%eax,4),%edx
+  80056d:	85 d2                	test   %edx,%edx
+  80056f:	74 18                	je     800589 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800571:	52                   	push   %edx
+  800572:	68 ae 40 80 00       	push   $0x8040ae
+  800577:	53                   	push   %ebx
+  800578:	56                   	push   %esi
+  800579:	e8 92 fe ff ff       	call   800410 <printfmt>
+  80057e:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800581:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800584:	e9 7a 02 00 00       	jmp    800803 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800589:	50                   	push   %eax
+  80058a:	68 ef 3b 80 00       	push   $0x803bef
+  80058f:	53                   	push   %ebx
+  800590:	56                   	push   %esi
+  800591:	e8 7a fe ff ff       	call   800410 <printfmt>
+  800596:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800599:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  80059c:	e9 62 02 00 00       	jmp    800803 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8005a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a4:	83 c0 04             	add    $0x4,%eax
+  8005a7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ad:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8005af:	85 c9                	test   %ecx,%ecx
+  8005b1:	b8 e8 3b 80 00       	mov    $0x803be8,%eax
+  8005b6:	0f 45 c1             	cmovne %ecx,%eax
+  8005b9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8005bc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c0:	7e 06                	jle    8005c8 <vprintfmt+0x19b>
+  8005c2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005c6:	75 0b                	jne    8005d3 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005c8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005cb:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005ce:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005d1:	eb 5c                	jmp    80062f <vprintfmt+0x202>
+  8005d3:	83 ec 08             	sub    $0x8,%esp
+  8005d6:	ff 75 d0             	push   -0x30(%ebp)
+  8005d9:	ff 75 cc             	push   -0x34(%ebp)
+  8005dc:	e8 20 03 00 00       	call   800901 <strnlen>
+  8005e1:	89 c2                	mov    %eax,%edx
+  8005e3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e6:	29 d0                	sub    %edx,%eax
+  8005e8:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8005eb:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005f2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005f5:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005f7:	eb 0e                	jmp    800607 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8005f9:	83 ec 08             	sub    $0x8,%esp
+  8005fc:	53                   	push   %ebx
+  8005fd:	57                   	push   %edi
+  8005fe:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800601:	83 ee 01             	sub    $0x1,%esi
+  800604:	83 c4 10             	add    $0x10,%esp
+  800607:	85 f6                	test   %esi,%esi
+  800609:	7f ee                	jg     8005f9 <vprintfmt+0x1cc>
+  80060b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80060e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800611:	85 c0                	test   %eax,%eax
+  800613:	ba 00 00 00 00       	mov    $0x0,%edx
+  800618:	0f 49 d0             	cmovns %eax,%edx
+  80061b:	29 d0                	sub    %edx,%eax
+  80061d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800620:	eb a6                	jmp    8005c8 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800622:	83 ec 08             	sub    $0x8,%esp
+  800625:	53                   	push   %ebx
+  800626:	52                   	push   %edx
+  800627:	ff 55 08             	call   *0x8(%ebp)
+  80062a:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80062d:	89 f1                	mov    %esi,%ecx
+  80062f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800632:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800636:	0f be d0             	movsbl %al,%edx
+  800639:	85 d2                	test   %edx,%edx
+  80063b:	74 28                	je     800665 <vprintfmt+0x238>
+  80063d:	85 ff                	test   %edi,%edi
+  80063f:	78 05                	js     800646 <vprintfmt+0x219>
+  800641:	83 ef 01             	sub    $0x1,%edi
+  800644:	78 30                	js     800676 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800646:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80064a:	74 d6                	je     800622 <vprintfmt+0x1f5>
+  80064c:	0f be c0             	movsbl %al,%eax
+  80064f:	83 e8 20             	sub    $0x20,%eax
+  800652:	83 f8 5e             	cmp    $0x5e,%eax
+  800655:	76 cb                	jbe    800622 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800657:	83 ec 08             	sub    $0x8,%esp
+  80065a:	53                   	push   %ebx
+  80065b:	6a 3f                	push   $0x3f
+  80065d:	ff 55 08             	call   *0x8(%ebp)
+  800660:	83 c4 10             	add    $0x10,%esp
+  800663:	eb c8                	jmp    80062d <vprintfmt+0x200>
+  800665:	8b 75 08             	mov    0x8(%ebp),%esi
+  800668:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80066b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80066e:	01 d0                	add    %edx,%eax
+  800670:	29 c8                	sub    %ecx,%eax
+  800672:	89 c7                	mov    %eax,%edi
+  800674:	eb 13                	jmp    800689 <vprintfmt+0x25c>
+  800676:	8b 75 08             	mov    0x8(%ebp),%esi
+  800679:	eb ed                	jmp    800668 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  80067b:	83 ec 08             	sub    $0x8,%esp
+  80067e:	53                   	push   %ebx
+  80067f:	6a 20                	push   $0x20
+  800681:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800683:	83 ef 01             	sub    $0x1,%edi
+  800686:	83 c4 10             	add    $0x10,%esp
+  800689:	85 ff                	test   %edi,%edi
+  80068b:	7f ee                	jg     80067b <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80068d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800690:	89 45 14             	mov    %eax,0x14(%ebp)
+  800693:	e9 6b 01 00 00       	jmp    800803 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800698:	83 f9 01             	cmp    $0x1,%ecx
+  80069b:	7f 1f                	jg     8006bc <vprintfmt+0x28f>
+  else if (lflag)
+  80069d:	85 c9                	test   %ecx,%ecx
+  80069f:	74 67                	je     800708 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8006a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a4:	8b 00                	mov    (%eax),%eax
+  8006a6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a9:	89 c1                	mov    %eax,%ecx
+  8006ab:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006ae:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ba:	eb 17                	jmp    8006d3 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8006bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bf:	8b 50 04             	mov    0x4(%eax),%edx
+  8006c2:	8b 00                	mov    (%eax),%eax
+  8006c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006c7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cd:	8d 40 08             	lea    0x8(%eax),%eax
+  8006d0:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8006d3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006d6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8006d9:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8006de:	85 c9                	test   %ecx,%ecx
+  8006e0:	0f 89 03 01 00 00    	jns    8007e9 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8006e6:	83 ec 08             	sub    $0x8,%esp
+  8006e9:	53                   	push   %ebx
+  8006ea:	6a 2d                	push   $0x2d
+  8006ec:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8006ee:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006f1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006f4:	f7 da                	neg    %edx
+  8006f6:	83 d1 00             	adc    $0x0,%ecx
+  8006f9:	f7 d9                	neg    %ecx
+  8006fb:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8006fe:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800703:	e9 e1 00 00 00       	jmp    8007e9 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800708:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070b:	8b 00                	mov    (%eax),%eax
+  80070d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800710:	89 c1                	mov    %eax,%ecx
+  800712:	c1 f9 1f             	sar    $0x1f,%ecx
+  800715:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800718:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071b:	8d 40 04             	lea    0x4(%eax),%eax
+  80071e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800721:	eb b0                	jmp    8006d3 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800723:	83 f9 01             	cmp    $0x1,%ecx
+  800726:	7f 1e                	jg     800746 <vprintfmt+0x319>
+  else if (lflag)
+  800728:	85 c9                	test   %ecx,%ecx
+  80072a:	74 32                	je     80075e <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80072c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072f:	8b 10                	mov    (%eax),%edx
+  800731:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800736:	8d 40 04             	lea    0x4(%eax),%eax
+  800739:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80073c:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800741:	e9 a3 00 00 00       	jmp    8007e9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800746:	8b 45 14             	mov    0x14(%ebp),%eax
+  800749:	8b 10                	mov    (%eax),%edx
+  80074b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80074e:	8d 40 08             	lea    0x8(%eax),%eax
+  800751:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800754:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800759:	e9 8b 00 00 00       	jmp    8007e9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80075e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800761:	8b 10                	mov    (%eax),%edx
+  800763:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800768:	8d 40 04             	lea    0x4(%eax),%eax
+  80076b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80076e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800773:	eb 74                	jmp    8007e9 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800775:	83 f9 01             	cmp    $0x1,%ecx
+  800778:	7f 1b                	jg     800795 <vprintfmt+0x368>
+  else if (lflag)
+  80077a:	85 c9                	test   %ecx,%ecx
+  80077c:	74 2c                	je     8007aa <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80077e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800781:	8b 10                	mov    (%eax),%edx
+  800783:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800788:	8d 40 04             	lea    0x4(%eax),%eax
+  80078b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80078e:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800793:	eb 54                	jmp    8007e9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800795:	8b 45 14             	mov    0x14(%ebp),%eax
+  800798:	8b 10                	mov    (%eax),%edx
+  80079a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80079d:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a0:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8007a3:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8007a8:	eb 3f                	jmp    8007e9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8007aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ad:	8b 10                	mov    (%eax),%edx
+  8007af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8007ba:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8007bf:	eb 28                	jmp    8007e9 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8007c1:	83 ec 08             	sub    $0x8,%esp
+  8007c4:	53                   	push   %ebx
+  8007c5:	6a 30                	push   $0x30
+  8007c7:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8007c9:	83 c4 08             	add    $0x8,%esp
+  8007cc:	53                   	push   %ebx
+  8007cd:	6a 78                	push   $0x78
+  8007cf:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8007d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d4:	8b 10                	mov    (%eax),%edx
+  8007d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8007db:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8007de:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007e4:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8007e9:	83 ec 0c             	sub    $0xc,%esp
+  8007ec:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007f0:	50                   	push   %eax
+  8007f1:	ff 75 e0             	push   -0x20(%ebp)
+  8007f4:	57                   	push   %edi
+  8007f5:	51                   	push   %ecx
+  8007f6:	52                   	push   %edx
+  8007f7:	89 da                	mov    %ebx,%edx
+  8007f9:	89 f0                	mov    %esi,%eax
+  8007fb:	e8 4a fb ff ff       	call   80034a <printnum>
+      break;
+  800800:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800803:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800806:	e9 40 fc ff ff       	jmp    80044b <vprintfmt+0x1e>
+  if (lflag >= 2)
+  80080b:	83 f9 01             	cmp    $0x1,%ecx
+  80080e:	7f 1b                	jg     80082b <vprintfmt+0x3fe>
+  else if (lflag)
+  800810:	85 c9                	test   %ecx,%ecx
+  800812:	74 2c                	je     800840 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800814:	8b 45 14             	mov    0x14(%ebp),%eax
+  800817:	8b 10                	mov    (%eax),%edx
+  800819:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80081e:	8d 40 04             	lea    0x4(%eax),%eax
+  800821:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800824:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800829:	eb be                	jmp    8007e9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80082b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082e:	8b 10                	mov    (%eax),%edx
+  800830:	8b 48 04             	mov    0x4(%eax),%ecx
+  800833:	8d 40 08             	lea    0x8(%eax),%eax
+  800836:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800839:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80083e:	eb a9                	jmp    8007e9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800840:	8b 45 14             	mov    0x14(%ebp),%eax
+  800843:	8b 10                	mov    (%eax),%edx
+  800845:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80084a:	8d 40 04             	lea    0x4(%eax),%eax
+  80084d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800850:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800855:	eb 92                	jmp    8007e9 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800857:	83 ec 08             	sub    $0x8,%esp
+  80085a:	53                   	push   %ebx
+  80085b:	6a 25                	push   $0x25
+  80085d:	ff d6                	call   *%esi
+      break;
+  80085f:	83 c4 10             	add    $0x10,%esp
+  800862:	eb 9f                	jmp    800803 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800864:	83 ec 08             	sub    $0x8,%esp
+  800867:	53                   	push   %ebx
+  800868:	6a 25                	push   $0x25
+  80086a:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  80086c:	83 c4 10             	add    $0x10,%esp
+  80086f:	89 f8                	mov    %edi,%eax
+  800871:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800875:	74 05                	je     80087c <vprintfmt+0x44f>
+  800877:	83 e8 01             	sub    $0x1,%eax
+  80087a:	eb f5                	jmp    800871 <vprintfmt+0x444>
+  80087c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80087f:	eb 82                	jmp    800803 <vprintfmt+0x3d6>
+
+00800881 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800881:	55                   	push   %ebp
+  800882:	89 e5                	mov    %esp,%ebp
+  800884:	83 ec 18             	sub    $0x18,%esp
+  800887:	8b 45 08             	mov    0x8(%ebp),%eax
+  80088a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80088d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800890:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800894:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800897:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80089e:	85 c0                	test   %eax,%eax
+  8008a0:	74 26                	je     8008c8 <vsnprintf+0x47>
+  8008a2:	85 d2                	test   %edx,%edx
+  8008a4:	7e 22                	jle    8008c8 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008a6:	ff 75 14             	push   0x14(%ebp)
+  8008a9:	ff 75 10             	push   0x10(%ebp)
+  8008ac:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008af:	50                   	push   %eax
+  8008b0:	68 f3 03 80 00       	push   $0x8003f3
+  8008b5:	e8 73 fb ff ff       	call   80042d <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8008ba:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008bd:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8008c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008c3:	83 c4 10             	add    $0x10,%esp
+}
+  8008c6:	c9                   	leave
+  8008c7:	c3                   	ret
+    return -E_INVAL;
+  8008c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008cd:	eb f7                	jmp    8008c6 <vsnprintf+0x45>
+
+008008cf <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008cf:	55                   	push   %ebp
+  8008d0:	89 e5                	mov    %esp,%ebp
+  8008d2:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8008d5:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8008d8:	50                   	push   %eax
+  8008d9:	ff 75 10             	push   0x10(%ebp)
+  8008dc:	ff 75 0c             	push   0xc(%ebp)
+  8008df:	ff 75 08             	push   0x8(%ebp)
+  8008e2:	e8 9a ff ff ff       	call   800881 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8008e7:	c9                   	leave
+  8008e8:	c3                   	ret
+
+008008e9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008e9:	55                   	push   %ebp
+  8008ea:	89 e5                	mov    %esp,%ebp
+  8008ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8008ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f4:	eb 03                	jmp    8008f9 <strlen+0x10>
+    n++;
+  8008f6:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8008f9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008fd:	75 f7                	jne    8008f6 <strlen+0xd>
+  return n;
+}
+  8008ff:	5d                   	pop    %ebp
+  800900:	c3                   	ret
+
+00800901 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800901:	55                   	push   %ebp
+  800902:	89 e5                	mov    %esp,%ebp
+  800904:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800907:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80090a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090f:	eb 03                	jmp    800914 <strnlen+0x13>
+    n++;
+  800911:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800914:	39 d0                	cmp    %edx,%eax
+  800916:	74 08                	je     800920 <strnlen+0x1f>
+  800918:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80091c:	75 f3                	jne    800911 <strnlen+0x10>
+  80091e:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800920:	89 d0                	mov    %edx,%eax
+  800922:	5d                   	pop    %ebp
+  800923:	c3                   	ret
+
+00800924 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	53                   	push   %ebx
+  800928:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80092b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80092e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800933:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800937:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80093a:	83 c0 01             	add    $0x1,%eax
+  80093d:	84 d2                	test   %dl,%dl
+  80093f:	75 f2                	jne    800933 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800941:	89 c8                	mov    %ecx,%eax
+  800943:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800946:	c9                   	leave
+  800947:	c3                   	ret
+
+00800948 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800948:	55                   	push   %ebp
+  800949:	89 e5                	mov    %esp,%ebp
+  80094b:	53                   	push   %ebx
+  80094c:	83 ec 10             	sub    $0x10,%esp
+  80094f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800952:	53                   	push   %ebx
+  800953:	e8 91 ff ff ff       	call   8008e9 <strlen>
+  800958:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  80095b:	ff 75 0c             	push   0xc(%ebp)
+  80095e:	01 d8                	add    %ebx,%eax
+  800960:	50                   	push   %eax
+  800961:	e8 be ff ff ff       	call   800924 <strcpy>
+  return dst;
+}
+  800966:	89 d8                	mov    %ebx,%eax
+  800968:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80096b:	c9                   	leave
+  80096c:	c3                   	ret
+
+0080096d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80096d:	55                   	push   %ebp
+  80096e:	89 e5                	mov    %esp,%ebp
+  800970:	56                   	push   %esi
+  800971:	53                   	push   %ebx
+  800972:	8b 75 08             	mov    0x8(%ebp),%esi
+  800975:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800978:	89 f3                	mov    %esi,%ebx
+  80097a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80097d:	89 f0                	mov    %esi,%eax
+  80097f:	eb 0f                	jmp    800990 <strncpy+0x23>
+    *dst++ = *src;
+  800981:	83 c0 01             	add    $0x1,%eax
+  800984:	0f b6 0a             	movzbl (%edx),%ecx
+  800987:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  80098a:	80 f9 01             	cmp    $0x1,%cl
+  80098d:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800990:	39 d8                	cmp    %ebx,%eax
+  800992:	75 ed                	jne    800981 <strncpy+0x14>
+  }
+  return ret;
+}
+  800994:	89 f0                	mov    %esi,%eax
+  800996:	5b                   	pop    %ebx
+  800997:	5e                   	pop    %esi
+  800998:	5d                   	pop    %ebp
+  800999:	c3                   	ret
+
+0080099a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80099a:	55                   	push   %ebp
+  80099b:	89 e5                	mov    %esp,%ebp
+  80099d:	56                   	push   %esi
+  80099e:	53                   	push   %ebx
+  80099f:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a5:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8009a8:	89 f0                	mov    %esi,%eax
+  8009aa:	85 d2                	test   %edx,%edx
+  8009ac:	74 21                	je     8009cf <strlcpy+0x35>
+  8009ae:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009b2:	89 f2                	mov    %esi,%edx
+  8009b4:	eb 09                	jmp    8009bf <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8009b6:	83 c1 01             	add    $0x1,%ecx
+  8009b9:	83 c2 01             	add    $0x1,%edx
+  8009bc:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8009bf:	39 c2                	cmp    %eax,%edx
+  8009c1:	74 09                	je     8009cc <strlcpy+0x32>
+  8009c3:	0f b6 19             	movzbl (%ecx),%ebx
+  8009c6:	84 db                	test   %bl,%bl
+  8009c8:	75 ec                	jne    8009b6 <strlcpy+0x1c>
+  8009ca:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8009cc:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8009cf:	29 f0                	sub    %esi,%eax
+}
+  8009d1:	5b                   	pop    %ebx
+  8009d2:	5e                   	pop    %esi
+  8009d3:	5d                   	pop    %ebp
+  8009d4:	c3                   	ret
+
+008009d5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009d5:	55                   	push   %ebp
+  8009d6:	89 e5                	mov    %esp,%ebp
+  8009d8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8009de:	eb 06                	jmp    8009e6 <strcmp+0x11>
+    p++, q++;
+  8009e0:	83 c1 01             	add    $0x1,%ecx
+  8009e3:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8009e6:	0f b6 01             	movzbl (%ecx),%eax
+  8009e9:	84 c0                	test   %al,%al
+  8009eb:	74 04                	je     8009f1 <strcmp+0x1c>
+  8009ed:	3a 02                	cmp    (%edx),%al
+  8009ef:	74 ef                	je     8009e0 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8009f1:	0f b6 c0             	movzbl %al,%eax
+  8009f4:	0f b6 12             	movzbl (%edx),%edx
+  8009f7:	29 d0                	sub    %edx,%eax
+}
+  8009f9:	5d                   	pop    %ebp
+  8009fa:	c3                   	ret
+
+008009fb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009fb:	55                   	push   %ebp
+  8009fc:	89 e5                	mov    %esp,%ebp
+  8009fe:	53                   	push   %ebx
+  8009ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a05:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800a08:	eb 09                	jmp    800a13 <strncmp+0x18>
+    n--, p++, q++;
+  800a0a:	83 ea 01             	sub    $0x1,%edx
+  800a0d:	83 c0 01             	add    $0x1,%eax
+  800a10:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800a13:	85 d2                	test   %edx,%edx
+  800a15:	74 18                	je     800a2f <strncmp+0x34>
+  800a17:	0f b6 18             	movzbl (%eax),%ebx
+  800a1a:	84 db                	test   %bl,%bl
+  800a1c:	74 04                	je     800a22 <strncmp+0x27>
+  800a1e:	3a 19                	cmp    (%ecx),%bl
+  800a20:	74 e8                	je     800a0a <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800a22:	0f b6 00             	movzbl (%eax),%eax
+  800a25:	0f b6 11             	movzbl (%ecx),%edx
+  800a28:	29 d0                	sub    %edx,%eax
+}
+  800a2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a2d:	c9                   	leave
+  800a2e:	c3                   	ret
+    return 0;
+  800a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a34:	eb f4                	jmp    800a2a <strncmp+0x2f>
+
+00800a36 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a36:	55                   	push   %ebp
+  800a37:	89 e5                	mov    %esp,%ebp
+  800a39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800a40:	eb 03                	jmp    800a45 <strchr+0xf>
+  800a42:	83 c0 01             	add    $0x1,%eax
+  800a45:	0f b6 10             	movzbl (%eax),%edx
+  800a48:	84 d2                	test   %dl,%dl
+  800a4a:	74 06                	je     800a52 <strchr+0x1c>
+    if (*s == c)
+  800a4c:	38 ca                	cmp    %cl,%dl
+  800a4e:	75 f2                	jne    800a42 <strchr+0xc>
+  800a50:	eb 05                	jmp    800a57 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800a52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a57:	5d                   	pop    %ebp
+  800a58:	c3                   	ret
+
+00800a59 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a59:	55                   	push   %ebp
+  800a5a:	89 e5                	mov    %esp,%ebp
+  800a5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800a63:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800a66:	38 ca                	cmp    %cl,%dl
+  800a68:	74 09                	je     800a73 <strfind+0x1a>
+  800a6a:	84 d2                	test   %dl,%dl
+  800a6c:	74 05                	je     800a73 <strfind+0x1a>
+  for (; *s; s++)
+  800a6e:	83 c0 01             	add    $0x1,%eax
+  800a71:	eb f0                	jmp    800a63 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800a73:	5d                   	pop    %ebp
+  800a74:	c3                   	ret
+
+00800a75 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a75:	55                   	push   %ebp
+  800a76:	89 e5                	mov    %esp,%ebp
+  800a78:	57                   	push   %edi
+  800a79:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a7c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800a7f:	85 c9                	test   %ecx,%ecx
+  800a81:	74 20                	je     800aa3 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800a83:	89 f8                	mov    %edi,%eax
+  800a85:	09 c8                	or     %ecx,%eax
+  800a87:	a8 03                	test   $0x3,%al
+  800a89:	75 12                	jne    800a9d <memset+0x28>
+    c &= 0xFF;
+  800a8b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a8f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800a95:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800a98:	fc                   	cld
+  800a99:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a9b:	eb 06                	jmp    800aa3 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800a9d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aa0:	fc                   	cld
+  800aa1:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800aa3:	89 f8                	mov    %edi,%eax
+  800aa5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800aa8:	c9                   	leave
+  800aa9:	c3                   	ret
+
+00800aaa <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800aaa:	55                   	push   %ebp
+  800aab:	89 e5                	mov    %esp,%ebp
+  800aad:	57                   	push   %edi
+  800aae:	56                   	push   %esi
+  800aaf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ab5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800ab8:	39 c6                	cmp    %eax,%esi
+  800aba:	73 32                	jae    800aee <memmove+0x44>
+  800abc:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800abf:	39 d0                	cmp    %edx,%eax
+  800ac1:	73 2b                	jae    800aee <memmove+0x44>
+    s += n;
+    d += n;
+  800ac3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ac6:	89 d6                	mov    %edx,%esi
+  800ac8:	09 fe                	or     %edi,%esi
+  800aca:	09 ce                	or     %ecx,%esi
+  800acc:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ad2:	75 0e                	jne    800ae2 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ad4:	83 ef 04             	sub    $0x4,%edi
+  800ad7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ada:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800add:	fd                   	std
+  800ade:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ae0:	eb 09                	jmp    800aeb <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ae2:	83 ef 01             	sub    $0x1,%edi
+  800ae5:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800ae8:	fd                   	std
+  800ae9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800aeb:	fc                   	cld
+  800aec:	eb 1a                	jmp    800b08 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aee:	89 f2                	mov    %esi,%edx
+  800af0:	09 c2                	or     %eax,%edx
+  800af2:	09 ca                	or     %ecx,%edx
+  800af4:	f6 c2 03             	test   $0x3,%dl
+  800af7:	75 0a                	jne    800b03 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800af9:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800afc:	89 c7                	mov    %eax,%edi
+  800afe:	fc                   	cld
+  800aff:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b01:	eb 05                	jmp    800b08 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800b03:	89 c7                	mov    %eax,%edi
+  800b05:	fc                   	cld
+  800b06:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800b08:	5e                   	pop    %esi
+  800b09:	5f                   	pop    %edi
+  800b0a:	5d                   	pop    %ebp
+  800b0b:	c3                   	ret
+
+00800b0c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b0c:	55                   	push   %ebp
+  800b0d:	89 e5                	mov    %esp,%ebp
+  800b0f:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800b12:	ff 75 10             	push   0x10(%ebp)
+  800b15:	ff 75 0c             	push   0xc(%ebp)
+  800b18:	ff 75 08             	push   0x8(%ebp)
+  800b1b:	e8 8a ff ff ff       	call   800aaa <memmove>
+}
+  800b20:	c9                   	leave
+  800b21:	c3                   	ret
+
+00800b22 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b22:	55                   	push   %ebp
+  800b23:	89 e5                	mov    %esp,%ebp
+  800b25:	56                   	push   %esi
+  800b26:	53                   	push   %ebx
+  800b27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800b2d:	89 c6                	mov    %eax,%esi
+  800b2f:	03 75 10             	add    0x10(%ebp),%esi
+  800b32:	eb 06                	jmp    800b3a <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800b34:	83 c0 01             	add    $0x1,%eax
+  800b37:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800b3a:	39 f0                	cmp    %esi,%eax
+  800b3c:	74 14                	je     800b52 <memcmp+0x30>
+    if (*s1 != *s2)
+  800b3e:	0f b6 08             	movzbl (%eax),%ecx
+  800b41:	0f b6 1a             	movzbl (%edx),%ebx
+  800b44:	38 d9                	cmp    %bl,%cl
+  800b46:	74 ec                	je     800b34 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800b48:	0f b6 c1             	movzbl %cl,%eax
+  800b4b:	0f b6 db             	movzbl %bl,%ebx
+  800b4e:	29 d8                	sub    %ebx,%eax
+  800b50:	eb 05                	jmp    800b57 <memcmp+0x35>
+  }
+
+  return 0;
+  800b52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b57:	5b                   	pop    %ebx
+  800b58:	5e                   	pop    %esi
+  800b59:	5d                   	pop    %ebp
+  800b5a:	c3                   	ret
+
+00800b5b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b5b:	55                   	push   %ebp
+  800b5c:	89 e5                	mov    %esp,%ebp
+  800b5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800b64:	89 c2                	mov    %eax,%edx
+  800b66:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800b69:	eb 03                	jmp    800b6e <memfind+0x13>
+  800b6b:	83 c0 01             	add    $0x1,%eax
+  800b6e:	39 d0                	cmp    %edx,%eax
+  800b70:	73 04                	jae    800b76 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800b72:	38 08                	cmp    %cl,(%eax)
+  800b74:	75 f5                	jne    800b6b <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800b76:	5d                   	pop    %ebp
+  800b77:	c3                   	ret
+
+00800b78 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b78:	55                   	push   %ebp
+  800b79:	89 e5                	mov    %esp,%ebp
+  800b7b:	57                   	push   %edi
+  800b7c:	56                   	push   %esi
+  800b7d:	53                   	push   %ebx
+  800b7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800b84:	eb 03                	jmp    800b89 <strtol+0x11>
+    s++;
+  800b86:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800b89:	0f b6 02             	movzbl (%edx),%eax
+  800b8c:	3c 20                	cmp    $0x20,%al
+  800b8e:	74 f6                	je     800b86 <strtol+0xe>
+  800b90:	3c 09                	cmp    $0x9,%al
+  800b92:	74 f2                	je     800b86 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800b94:	3c 2b                	cmp    $0x2b,%al
+  800b96:	74 2a                	je     800bc2 <strtol+0x4a>
+  int neg = 0;
+  800b98:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800b9d:	3c 2d                	cmp    $0x2d,%al
+  800b9f:	74 2b                	je     800bcc <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba1:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ba7:	75 0f                	jne    800bb8 <strtol+0x40>
+  800ba9:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bac:	74 28                	je     800bd6 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800bae:	85 db                	test   %ebx,%ebx
+  800bb0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bb5:	0f 44 d8             	cmove  %eax,%ebx
+  800bb8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bbd:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bc0:	eb 46                	jmp    800c08 <strtol+0x90>
+    s++;
+  800bc2:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800bc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bca:	eb d5                	jmp    800ba1 <strtol+0x29>
+    s++, neg = 1;
+  800bcc:	83 c2 01             	add    $0x1,%edx
+  800bcf:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bd4:	eb cb                	jmp    800ba1 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bd6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bda:	74 0e                	je     800bea <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800bdc:	85 db                	test   %ebx,%ebx
+  800bde:	75 d8                	jne    800bb8 <strtol+0x40>
+    s++, base = 8;
+  800be0:	83 c2 01             	add    $0x1,%edx
+  800be3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800be8:	eb ce                	jmp    800bb8 <strtol+0x40>
+    s += 2, base = 16;
+  800bea:	83 c2 02             	add    $0x2,%edx
+  800bed:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bf2:	eb c4                	jmp    800bb8 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800bf4:	0f be c0             	movsbl %al,%eax
+  800bf7:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800bfa:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bfd:	7d 3a                	jge    800c39 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800bff:	83 c2 01             	add    $0x1,%edx
+  800c02:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c06:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800c08:	0f b6 02             	movzbl (%edx),%eax
+  800c0b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c0e:	89 f3                	mov    %esi,%ebx
+  800c10:	80 fb 09             	cmp    $0x9,%bl
+  800c13:	76 df                	jbe    800bf4 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800c15:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c18:	89 f3                	mov    %esi,%ebx
+  800c1a:	80 fb 19             	cmp    $0x19,%bl
+  800c1d:	77 08                	ja     800c27 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800c1f:	0f be c0             	movsbl %al,%eax
+  800c22:	83 e8 57             	sub    $0x57,%eax
+  800c25:	eb d3                	jmp    800bfa <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800c27:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c2a:	89 f3                	mov    %esi,%ebx
+  800c2c:	80 fb 19             	cmp    $0x19,%bl
+  800c2f:	77 08                	ja     800c39 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800c31:	0f be c0             	movsbl %al,%eax
+  800c34:	83 e8 37             	sub    $0x37,%eax
+  800c37:	eb c1                	jmp    800bfa <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800c39:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c3d:	74 05                	je     800c44 <strtol+0xcc>
+    *endptr = (char*)s;
+  800c3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c42:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800c44:	89 c8                	mov    %ecx,%eax
+  800c46:	f7 d8                	neg    %eax
+  800c48:	85 ff                	test   %edi,%edi
+  800c4a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c4d:	89 c8                	mov    %ecx,%eax
+  800c4f:	5b                   	pop    %ebx
+  800c50:	5e                   	pop    %esi
+  800c51:	5f                   	pop    %edi
+  800c52:	5d                   	pop    %ebp
+  800c53:	c3                   	ret
+
+00800c54 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c54:	55                   	push   %ebp
+  800c55:	89 e5                	mov    %esp,%ebp
+  800c57:	57                   	push   %edi
+  800c58:	56                   	push   %esi
+  800c59:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c65:	89 c3                	mov    %eax,%ebx
+  800c67:	89 c7                	mov    %eax,%edi
+  800c69:	89 c6                	mov    %eax,%esi
+  800c6b:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c6d:	5b                   	pop    %ebx
+  800c6e:	5e                   	pop    %esi
+  800c6f:	5f                   	pop    %edi
+  800c70:	5d                   	pop    %ebp
+  800c71:	c3                   	ret
+
+00800c72 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c72:	55                   	push   %ebp
+  800c73:	89 e5                	mov    %esp,%ebp
+  800c75:	57                   	push   %edi
+  800c76:	56                   	push   %esi
+  800c77:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c82:	89 d1                	mov    %edx,%ecx
+  800c84:	89 d3                	mov    %edx,%ebx
+  800c86:	89 d7                	mov    %edx,%edi
+  800c88:	89 d6                	mov    %edx,%esi
+  800c8a:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c8c:	5b                   	pop    %ebx
+  800c8d:	5e                   	pop    %esi
+  800c8e:	5f                   	pop    %edi
+  800c8f:	5d                   	pop    %ebp
+  800c90:	c3                   	ret
+
+00800c91 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c91:	55                   	push   %ebp
+  800c92:	89 e5                	mov    %esp,%ebp
+  800c94:	57                   	push   %edi
+  800c95:	56                   	push   %esi
+  800c96:	53                   	push   %ebx
+  800c97:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c9a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ca7:	89 cb                	mov    %ecx,%ebx
+  800ca9:	89 cf                	mov    %ecx,%edi
+  800cab:	89 ce                	mov    %ecx,%esi
+  800cad:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800caf:	85 c0                	test   %eax,%eax
+  800cb1:	7f 08                	jg     800cbb <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb6:	5b                   	pop    %ebx
+  800cb7:	5e                   	pop    %esi
+  800cb8:	5f                   	pop    %edi
+  800cb9:	5d                   	pop    %ebp
+  800cba:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cbb:	83 ec 0c             	sub    $0xc,%esp
+  800cbe:	50                   	push   %eax
+  800cbf:	6a 03                	push   $0x3
+  800cc1:	68 e3 3e 80 00       	push   $0x803ee3
+  800cc6:	6a 23                	push   $0x23
+  800cc8:	68 00 3f 80 00       	push   $0x803f00
+  800ccd:	e8 89 f5 ff ff       	call   80025b <_panic>
+
+00800cd2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cd2:	55                   	push   %ebp
+  800cd3:	89 e5                	mov    %esp,%ebp
+  800cd5:	57                   	push   %edi
+  800cd6:	56                   	push   %esi
+  800cd7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cdd:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ce2:	89 d1                	mov    %edx,%ecx
+  800ce4:	89 d3                	mov    %edx,%ebx
+  800ce6:	89 d7                	mov    %edx,%edi
+  800ce8:	89 d6                	mov    %edx,%esi
+  800cea:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cec:	5b                   	pop    %ebx
+  800ced:	5e                   	pop    %esi
+  800cee:	5f                   	pop    %edi
+  800cef:	5d                   	pop    %ebp
+  800cf0:	c3                   	ret
+
+00800cf1 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cf1:	55                   	push   %ebp
+  800cf2:	89 e5                	mov    %esp,%ebp
+  800cf4:	57                   	push   %edi
+  800cf5:	56                   	push   %esi
+  800cf6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cf7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cfc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d01:	89 d1                	mov    %edx,%ecx
+  800d03:	89 d3                	mov    %edx,%ebx
+  800d05:	89 d7                	mov    %edx,%edi
+  800d07:	89 d6                	mov    %edx,%esi
+  800d09:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d0b:	5b                   	pop    %ebx
+  800d0c:	5e                   	pop    %esi
+  800d0d:	5f                   	pop    %edi
+  800d0e:	5d                   	pop    %ebp
+  800d0f:	c3                   	ret
+
+00800d10 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800d10:	55                   	push   %ebp
+  800d11:	89 e5                	mov    %esp,%ebp
+  800d13:	57                   	push   %edi
+  800d14:	56                   	push   %esi
+  800d15:	53                   	push   %ebx
+  800d16:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800d19:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800d1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d25:	b8 14 00 00 00       	mov    $0x14,%eax
+  800d2a:	89 df                	mov    %ebx,%edi
+  800d2c:	89 de                	mov    %ebx,%esi
+  800d2e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d30:	85 c0                	test   %eax,%eax
+  800d32:	7f 08                	jg     800d3c <sys_env_set_cow+0x2c>
+}
+  800d34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d37:	5b                   	pop    %ebx
+  800d38:	5e                   	pop    %esi
+  800d39:	5f                   	pop    %edi
+  800d3a:	5d                   	pop    %ebp
+  800d3b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d3c:	83 ec 0c             	sub    $0xc,%esp
+  800d3f:	50                   	push   %eax
+  800d40:	6a 14                	push   $0x14
+  800d42:	68 e3 3e 80 00       	push   $0x803ee3
+  800d47:	6a 23                	push   $0x23
+  800d49:	68 00 3f 80 00       	push   $0x803f00
+  800d4e:	e8 08 f5 ff ff       	call   80025b <_panic>
+
+00800d53 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d53:	55                   	push   %ebp
+  800d54:	89 e5                	mov    %esp,%ebp
+  800d56:	57                   	push   %edi
+  800d57:	56                   	push   %esi
+  800d58:	53                   	push   %ebx
+  800d59:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d5c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d67:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d6c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d6f:	89 f7                	mov    %esi,%edi
+  800d71:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d73:	85 c0                	test   %eax,%eax
+  800d75:	7f 08                	jg     800d7f <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800d77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d7a:	5b                   	pop    %ebx
+  800d7b:	5e                   	pop    %esi
+  800d7c:	5f                   	pop    %edi
+  800d7d:	5d                   	pop    %ebp
+  800d7e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d7f:	83 ec 0c             	sub    $0xc,%esp
+  800d82:	50                   	push   %eax
+  800d83:	6a 04                	push   $0x4
+  800d85:	68 e3 3e 80 00       	push   $0x803ee3
+  800d8a:	6a 23                	push   $0x23
+  800d8c:	68 00 3f 80 00       	push   $0x803f00
+  800d91:	e8 c5 f4 ff ff       	call   80025b <_panic>
+
+00800d96 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d96:	55                   	push   %ebp
+  800d97:	89 e5                	mov    %esp,%ebp
+  800d99:	57                   	push   %edi
+  800d9a:	56                   	push   %esi
+  800d9b:	53                   	push   %ebx
+  800d9c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da5:	b8 05 00 00 00       	mov    $0x5,%eax
+  800daa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800db3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800db5:	85 c0                	test   %eax,%eax
+  800db7:	7f 08                	jg     800dc1 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800db9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dbc:	5b                   	pop    %ebx
+  800dbd:	5e                   	pop    %esi
+  800dbe:	5f                   	pop    %edi
+  800dbf:	5d                   	pop    %ebp
+  800dc0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dc1:	83 ec 0c             	sub    $0xc,%esp
+  800dc4:	50                   	push   %eax
+  800dc5:	6a 05                	push   $0x5
+  800dc7:	68 e3 3e 80 00       	push   $0x803ee3
+  800dcc:	6a 23                	push   $0x23
+  800dce:	68 00 3f 80 00       	push   $0x803f00
+  800dd3:	e8 83 f4 ff ff       	call   80025b <_panic>
+
+00800dd8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dd8:	55                   	push   %ebp
+  800dd9:	89 e5                	mov    %esp,%ebp
+  800ddb:	57                   	push   %edi
+  800ddc:	56                   	push   %esi
+  800ddd:	53                   	push   %ebx
+  800dde:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800de1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800de6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dec:	b8 06 00 00 00       	mov    $0x6,%eax
+  800df1:	89 df                	mov    %ebx,%edi
+  800df3:	89 de                	mov    %ebx,%esi
+  800df5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800df7:	85 c0                	test   %eax,%eax
+  800df9:	7f 08                	jg     800e03 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800dfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dfe:	5b                   	pop    %ebx
+  800dff:	5e                   	pop    %esi
+  800e00:	5f                   	pop    %edi
+  800e01:	5d                   	pop    %ebp
+  800e02:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e03:	83 ec 0c             	sub    $0xc,%esp
+  800e06:	50                   	push   %eax
+  800e07:	6a 06                	push   $0x6
+  800e09:	68 e3 3e 80 00       	push   $0x803ee3
+  800e0e:	6a 23                	push   $0x23
+  800e10:	68 00 3f 80 00       	push   $0x803f00
+  800e15:	e8 41 f4 ff ff       	call   80025b <_panic>
+
+00800e1a <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800e1a:	55                   	push   %ebp
+  800e1b:	89 e5                	mov    %esp,%ebp
+  800e1d:	57                   	push   %edi
+  800e1e:	56                   	push   %esi
+  800e1f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e26:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e2e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e31:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e34:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800e36:	5b                   	pop    %ebx
+  800e37:	5e                   	pop    %esi
+  800e38:	5f                   	pop    %edi
+  800e39:	5d                   	pop    %ebp
+  800e3a:	c3                   	ret
+
+00800e3b <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800e3b:	55                   	push   %ebp
+  800e3c:	89 e5                	mov    %esp,%ebp
+  800e3e:	57                   	push   %edi
+  800e3f:	56                   	push   %esi
+  800e40:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e47:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e4c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e54:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e57:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800e59:	5b                   	pop    %ebx
+  800e5a:	5e                   	pop    %esi
+  800e5b:	5f                   	pop    %edi
+  800e5c:	5d                   	pop    %ebp
+  800e5d:	c3                   	ret
+
+00800e5e <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800e5e:	55                   	push   %ebp
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	57                   	push   %edi
+  800e62:	56                   	push   %esi
+  800e63:	53                   	push   %ebx
+  800e64:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e72:	b8 16 00 00 00       	mov    $0x16,%eax
+  800e77:	89 df                	mov    %ebx,%edi
+  800e79:	89 de                	mov    %ebx,%esi
+  800e7b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e7d:	85 c0                	test   %eax,%eax
+  800e7f:	7f 08                	jg     800e89 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800e81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e84:	5b                   	pop    %ebx
+  800e85:	5e                   	pop    %esi
+  800e86:	5f                   	pop    %edi
+  800e87:	5d                   	pop    %ebp
+  800e88:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e89:	83 ec 0c             	sub    $0xc,%esp
+  800e8c:	50                   	push   %eax
+  800e8d:	6a 16                	push   $0x16
+  800e8f:	68 e3 3e 80 00       	push   $0x803ee3
+  800e94:	6a 23                	push   $0x23
+  800e96:	68 00 3f 80 00       	push   $0x803f00
+  800e9b:	e8 bb f3 ff ff       	call   80025b <_panic>
+
+00800ea0 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800ea0:	55                   	push   %ebp
+  800ea1:	89 e5                	mov    %esp,%ebp
+  800ea3:	57                   	push   %edi
+  800ea4:	56                   	push   %esi
+  800ea5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ea6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eae:	b8 17 00 00 00       	mov    $0x17,%eax
+  800eb3:	89 cb                	mov    %ecx,%ebx
+  800eb5:	89 cf                	mov    %ecx,%edi
+  800eb7:	89 ce                	mov    %ecx,%esi
+  800eb9:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800ebb:	5b                   	pop    %ebx
+  800ebc:	5e                   	pop    %esi
+  800ebd:	5f                   	pop    %edi
+  800ebe:	5d                   	pop    %ebp
+  800ebf:	c3                   	ret
+
+00800ec0 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	57                   	push   %edi
+  800ec4:	56                   	push   %esi
+  800ec5:	53                   	push   %ebx
+  800ec6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ec9:	be 00 00 00 00       	mov    $0x0,%esi
+  800ece:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed4:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ed9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800edc:	89 f7                	mov    %esi,%edi
+  800ede:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ee0:	85 c0                	test   %eax,%eax
+  800ee2:	7f 08                	jg     800eec <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800ee4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee7:	5b                   	pop    %ebx
+  800ee8:	5e                   	pop    %esi
+  800ee9:	5f                   	pop    %edi
+  800eea:	5d                   	pop    %ebp
+  800eeb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800eec:	83 ec 0c             	sub    $0xc,%esp
+  800eef:	50                   	push   %eax
+  800ef0:	6a 18                	push   $0x18
+  800ef2:	68 e3 3e 80 00       	push   $0x803ee3
+  800ef7:	6a 23                	push   $0x23
+  800ef9:	68 00 3f 80 00       	push   $0x803f00
+  800efe:	e8 58 f3 ff ff       	call   80025b <_panic>
+
+00800f03 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800f03:	55                   	push   %ebp
+  800f04:	89 e5                	mov    %esp,%ebp
+  800f06:	57                   	push   %edi
+  800f07:	56                   	push   %esi
+  800f08:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f09:	be 00 00 00 00       	mov    $0x0,%esi
+  800f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f14:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f19:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f1c:	89 f7                	mov    %esi,%edi
+  800f1e:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800f20:	5b                   	pop    %ebx
+  800f21:	5e                   	pop    %esi
+  800f22:	5f                   	pop    %edi
+  800f23:	5d                   	pop    %ebp
+  800f24:	c3                   	ret
+
+00800f25 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800f25:	55                   	push   %ebp
+  800f26:	89 e5                	mov    %esp,%ebp
+  800f28:	57                   	push   %edi
+  800f29:	56                   	push   %esi
+  800f2a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f30:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f35:	89 d1                	mov    %edx,%ecx
+  800f37:	89 d3                	mov    %edx,%ebx
+  800f39:	89 d7                	mov    %edx,%edi
+  800f3b:	89 d6                	mov    %edx,%esi
+  800f3d:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f3f:	5b                   	pop    %ebx
+  800f40:	5e                   	pop    %esi
+  800f41:	5f                   	pop    %edi
+  800f42:	5d                   	pop    %ebp
+  800f43:	c3                   	ret
+
+00800f44 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	57                   	push   %edi
+  800f48:	56                   	push   %esi
+  800f49:	53                   	push   %ebx
+  800f4a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f52:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f58:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f5d:	89 df                	mov    %ebx,%edi
+  800f5f:	89 de                	mov    %ebx,%esi
+  800f61:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f63:	85 c0                	test   %eax,%eax
+  800f65:	7f 08                	jg     800f6f <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f6a:	5b                   	pop    %ebx
+  800f6b:	5e                   	pop    %esi
+  800f6c:	5f                   	pop    %edi
+  800f6d:	5d                   	pop    %ebp
+  800f6e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f6f:	83 ec 0c             	sub    $0xc,%esp
+  800f72:	50                   	push   %eax
+  800f73:	6a 08                	push   $0x8
+  800f75:	68 e3 3e 80 00       	push   $0x803ee3
+  800f7a:	6a 23                	push   $0x23
+  800f7c:	68 00 3f 80 00       	push   $0x803f00
+  800f81:	e8 d5 f2 ff ff       	call   80025b <_panic>
+
+00800f86 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f86:	55                   	push   %ebp
+  800f87:	89 e5                	mov    %esp,%ebp
+  800f89:	57                   	push   %edi
+  800f8a:	56                   	push   %esi
+  800f8b:	53                   	push   %ebx
+  800f8c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f9f:	89 df                	mov    %ebx,%edi
+  800fa1:	89 de                	mov    %ebx,%esi
+  800fa3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fa5:	85 c0                	test   %eax,%eax
+  800fa7:	7f 08                	jg     800fb1 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800fa9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fac:	5b                   	pop    %ebx
+  800fad:	5e                   	pop    %esi
+  800fae:	5f                   	pop    %edi
+  800faf:	5d                   	pop    %ebp
+  800fb0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fb1:	83 ec 0c             	sub    $0xc,%esp
+  800fb4:	50                   	push   %eax
+  800fb5:	6a 09                	push   $0x9
+  800fb7:	68 e3 3e 80 00       	push   $0x803ee3
+  800fbc:	6a 23                	push   $0x23
+  800fbe:	68 00 3f 80 00       	push   $0x803f00
+  800fc3:	e8 93 f2 ff ff       	call   80025b <_panic>
+
+00800fc8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fc8:	55                   	push   %ebp
+  800fc9:	89 e5                	mov    %esp,%ebp
+  800fcb:	57                   	push   %edi
+  800fcc:	56                   	push   %esi
+  800fcd:	53                   	push   %ebx
+  800fce:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fe1:	89 df                	mov    %ebx,%edi
+  800fe3:	89 de                	mov    %ebx,%esi
+  800fe5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fe7:	85 c0                	test   %eax,%eax
+  800fe9:	7f 08                	jg     800ff3 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800feb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fee:	5b                   	pop    %ebx
+  800fef:	5e                   	pop    %esi
+  800ff0:	5f                   	pop    %edi
+  800ff1:	5d                   	pop    %ebp
+  800ff2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ff3:	83 ec 0c             	sub    $0xc,%esp
+  800ff6:	50                   	push   %eax
+  800ff7:	6a 0a                	push   $0xa
+  800ff9:	68 e3 3e 80 00       	push   $0x803ee3
+  800ffe:	6a 23                	push   $0x23
+  801000:	68 00 3f 80 00       	push   $0x803f00
+  801005:	e8 51 f2 ff ff       	call   80025b <_panic>
+
+0080100a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  80100a:	55                   	push   %ebp
+  80100b:	89 e5                	mov    %esp,%ebp
+  80100d:	57                   	push   %edi
+  80100e:	56                   	push   %esi
+  80100f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801010:	8b 55 08             	mov    0x8(%ebp),%edx
+  801013:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801016:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80101b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80101e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801021:	8b 75 18             	mov    0x18(%ebp),%esi
+  801024:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801026:	5b                   	pop    %ebx
+  801027:	5e                   	pop    %esi
+  801028:	5f                   	pop    %edi
+  801029:	5d                   	pop    %ebp
+  80102a:	c3                   	ret
+
+0080102b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80102b:	55                   	push   %ebp
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	57                   	push   %edi
+  80102f:	56                   	push   %esi
+  801030:	53                   	push   %ebx
+  801031:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801034:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801039:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801044:	89 df                	mov    %ebx,%edi
+  801046:	89 de                	mov    %ebx,%esi
+  801048:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80104a:	85 c0                	test   %eax,%eax
+  80104c:	7f 08                	jg     801056 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80104e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801051:	5b                   	pop    %ebx
+  801052:	5e                   	pop    %esi
+  801053:	5f                   	pop    %edi
+  801054:	5d                   	pop    %ebp
+  801055:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801056:	83 ec 0c             	sub    $0xc,%esp
+  801059:	50                   	push   %eax
+  80105a:	6a 0d                	push   $0xd
+  80105c:	68 e3 3e 80 00       	push   $0x803ee3
+  801061:	6a 23                	push   $0x23
+  801063:	68 00 3f 80 00       	push   $0x803f00
+  801068:	e8 ee f1 ff ff       	call   80025b <_panic>
+
+0080106d <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  80106d:	55                   	push   %ebp
+  80106e:	89 e5                	mov    %esp,%ebp
+  801070:	57                   	push   %edi
+  801071:	56                   	push   %esi
+  801072:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801073:	ba 00 00 00 00       	mov    $0x0,%edx
+  801078:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80107d:	89 d1                	mov    %edx,%ecx
+  80107f:	89 d3                	mov    %edx,%ebx
+  801081:	89 d7                	mov    %edx,%edi
+  801083:	89 d6                	mov    %edx,%esi
+  801085:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801087:	5b                   	pop    %ebx
+  801088:	5e                   	pop    %esi
+  801089:	5f                   	pop    %edi
+  80108a:	5d                   	pop    %ebp
+  80108b:	c3                   	ret
+
+0080108c <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  80108c:	55                   	push   %ebp
+  80108d:	89 e5                	mov    %esp,%ebp
+  80108f:	57                   	push   %edi
+  801090:	56                   	push   %esi
+  801091:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801092:	8b 55 08             	mov    0x8(%ebp),%edx
+  801095:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801098:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80109d:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010a8:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  8010aa:	5b                   	pop    %ebx
+  8010ab:	5e                   	pop    %esi
+  8010ac:	5f                   	pop    %edi
+  8010ad:	5d                   	pop    %ebp
+  8010ae:	c3                   	ret
+
+008010af <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  8010af:	55                   	push   %ebp
+  8010b0:	89 e5                	mov    %esp,%ebp
+  8010b2:	57                   	push   %edi
+  8010b3:	56                   	push   %esi
+  8010b4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c0:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c8:	89 f7                	mov    %esi,%edi
+  8010ca:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8010cc:	5b                   	pop    %ebx
+  8010cd:	5e                   	pop    %esi
+  8010ce:	5f                   	pop    %edi
+  8010cf:	5d                   	pop    %ebp
+  8010d0:	c3                   	ret
+
+008010d1 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8010d1:	55                   	push   %ebp
+  8010d2:	89 e5                	mov    %esp,%ebp
+  8010d4:	57                   	push   %edi
+  8010d5:	56                   	push   %esi
+  8010d6:	53                   	push   %ebx
+  8010d7:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8010da:	80 3d a4 68 80 00 00 	cmpb   $0x0,0x8068a4
+  8010e1:	74 41                	je     801124 <sys_batch+0x53>
+  8010e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010e6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8010e9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8010f0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010f3:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8010f6:	7d 45                	jge    80113d <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8010f8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8010fb:	8b 06                	mov    (%esi),%eax
+  8010fd:	8b 56 04             	mov    0x4(%esi),%edx
+  801100:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801103:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801106:	8b 7e 10             	mov    0x10(%esi),%edi
+  801109:	8b 76 14             	mov    0x14(%esi),%esi
+  80110c:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80110e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801111:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801114:	83 c6 1c             	add    $0x1c,%esi
+  801117:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80111a:	85 c0                	test   %eax,%eax
+  80111c:	78 1f                	js     80113d <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80111e:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801122:	eb cc                	jmp    8010f0 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801124:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801129:	b8 13 00 00 00       	mov    $0x13,%eax
+  80112e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801131:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801134:	89 df                	mov    %ebx,%edi
+  801136:	89 de                	mov    %ebx,%esi
+  801138:	cd 30                	int    $0x30
+  80113a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80113d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801140:	83 c4 08             	add    $0x8,%esp
+  801143:	5b                   	pop    %ebx
+  801144:	5e                   	pop    %esi
+  801145:	5f                   	pop    %edi
+  801146:	5d                   	pop    %ebp
+  801147:	c3                   	ret
+
+00801148 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80114b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80114e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801154:	5d                   	pop    %ebp
+  801155:	c3                   	ret
+
+00801156 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801156:	55                   	push   %ebp
+  801157:	89 e5                	mov    %esp,%ebp
+  801159:	56                   	push   %esi
+  80115a:	53                   	push   %ebx
+  80115b:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80115e:	8b 1e                	mov    (%esi),%ebx
+  801160:	85 db                	test   %ebx,%ebx
+  801162:	75 09                	jne    80116d <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801164:	89 d8                	mov    %ebx,%eax
+  801166:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801169:	5b                   	pop    %ebx
+  80116a:	5e                   	pop    %esi
+  80116b:	5d                   	pop    %ebp
+  80116c:	c3                   	ret
+  b->sb_n = 0;
+  80116d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801173:	53                   	push   %ebx
+  801174:	8d 46 04             	lea    0x4(%esi),%eax
+  801177:	50                   	push   %eax
+  801178:	e8 54 ff ff ff       	call   8010d1 <sys_batch>
+  80117d:	83 c4 08             	add    $0x8,%esp
+  801180:	85 c0                	test   %eax,%eax
+  801182:	78 1e                	js     8011a2 <sysbatch_flush+0x4c>
+  if (r < n)
+  801184:	39 c3                	cmp    %eax,%ebx
+  801186:	7f 07                	jg     80118f <sysbatch_flush+0x39>
+  return 0;
+  801188:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118d:	eb d5                	jmp    801164 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80118f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801192:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801196:	85 db                	test   %ebx,%ebx
+  801198:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80119d:	0f 49 d8             	cmovns %eax,%ebx
+  8011a0:	eb c2                	jmp    801164 <sysbatch_flush+0xe>
+    return r;
+  8011a2:	89 c3                	mov    %eax,%ebx
+  8011a4:	eb be                	jmp    801164 <sysbatch_flush+0xe>
+
+008011a6 <sysbatch_add>:
+{
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	53                   	push   %ebx
+  8011aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8011ad:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8011b0:	74 41                	je     8011f3 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  8011b2:	8b 03                	mov    (%ebx),%eax
+  8011b4:	8d 50 01             	lea    0x1(%eax),%edx
+  8011b7:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  8011b9:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8011bc:	01 d8                	add    %ebx,%eax
+  8011be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011c1:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8011c4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8011c7:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8011ca:	8b 55 14             	mov    0x14(%ebp),%edx
+  8011cd:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8011d0:	8b 55 18             	mov    0x18(%ebp),%edx
+  8011d3:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8011d6:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8011d9:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8011dc:	8b 55 20             	mov    0x20(%ebp),%edx
+  8011df:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8011e2:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8011e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011f1:	c9                   	leave
+  8011f2:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8011f3:	53                   	push   %ebx
+  8011f4:	e8 5d ff ff ff       	call   801156 <sysbatch_flush>
+  8011f9:	83 c4 04             	add    $0x4,%esp
+  8011fc:	85 c0                	test   %eax,%eax
+  8011fe:	79 b2                	jns    8011b2 <sysbatch_add+0xc>
+  801200:	eb ec                	jmp    8011ee <sysbatch_add+0x48>
+
+00801202 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801202:	55                   	push   %ebp
+  801203:	89 e5                	mov    %esp,%ebp
+  801205:	56                   	push   %esi
+  801206:	53                   	push   %ebx
+  801207:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  80120a:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  80120c:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  80120f:	83 ec 0c             	sub    $0xc,%esp
+  801212:	50                   	push   %eax
+  801213:	e8 53 1f 00 00       	call   80316b <mmap_fault>
+  801218:	83 c4 10             	add    $0x10,%esp
+  80121b:	84 c0                	test   %al,%al
+  80121d:	75 7d                	jne    80129c <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  80121f:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801225:	74 7c                	je     8012a3 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  801227:	89 d8                	mov    %ebx,%eax
+  801229:	c1 e8 0c             	shr    $0xc,%eax
+  80122c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801233:	f6 c4 08             	test   $0x8,%ah
+  801236:	74 7d                	je     8012b5 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801238:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80123e:	83 ec 04             	sub    $0x4,%esp
+  801241:	6a 07                	push   $0x7
+  801243:	68 00 f0 7f 00       	push   $0x7ff000
+  801248:	6a 00                	push   $0x0
+  80124a:	e8 04 fb ff ff       	call   800d53 <sys_page_alloc>
+  80124f:	83 c4 10             	add    $0x10,%esp
+  801252:	85 c0                	test   %eax,%eax
+  801254:	78 73                	js     8012c9 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  801256:	83 ec 04             	sub    $0x4,%esp
+  801259:	68 00 10 00 00       	push   $0x1000
+  80125e:	53                   	push   %ebx
+  80125f:	68 00 f0 7f 00       	push   $0x7ff000
+  801264:	e8 41 f8 ff ff       	call   800aaa <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801269:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801270:	53                   	push   %ebx
+  801271:	6a 00                	push   $0x0
+  801273:	68 00 f0 7f 00       	push   $0x7ff000
+  801278:	6a 00                	push   $0x0
+  80127a:	e8 17 fb ff ff       	call   800d96 <sys_page_map>
+  80127f:	83 c4 20             	add    $0x20,%esp
+  801282:	85 c0                	test   %eax,%eax
+  801284:	78 55                	js     8012db <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801286:	83 ec 08             	sub    $0x8,%esp
+  801289:	68 00 f0 7f 00       	push   $0x7ff000
+  80128e:	6a 00                	push   $0x0
+  801290:	e8 43 fb ff ff       	call   800dd8 <sys_page_unmap>
+  801295:	83 c4 10             	add    $0x10,%esp
+  801298:	85 c0                	test   %eax,%eax
+  80129a:	78 51                	js     8012ed <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  80129c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80129f:	5b                   	pop    %ebx
+  8012a0:	5e                   	pop    %esi
+  8012a1:	5d                   	pop    %ebp
+  8012a2:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  8012a3:	56                   	push   %esi
+  8012a4:	68 0e 3f 80 00       	push   $0x803f0e
+  8012a9:	6a 1d                	push   $0x1d
+  8012ab:	68 1f 3f 80 00       	push   $0x803f1f
+  8012b0:	e8 a6 ef ff ff       	call   80025b <_panic>
+    panic("user_pgfault: page not COW");
+  8012b5:	83 ec 04             	sub    $0x4,%esp
+  8012b8:	68 2a 3f 80 00       	push   $0x803f2a
+  8012bd:	6a 21                	push   $0x21
+  8012bf:	68 1f 3f 80 00       	push   $0x803f1f
+  8012c4:	e8 92 ef ff ff       	call   80025b <_panic>
+    panic("sys_page_alloc: %e", r);
+  8012c9:	50                   	push   %eax
+  8012ca:	68 45 3f 80 00       	push   $0x803f45
+  8012cf:	6a 2f                	push   $0x2f
+  8012d1:	68 1f 3f 80 00       	push   $0x803f1f
+  8012d6:	e8 80 ef ff ff       	call   80025b <_panic>
+    panic("sys_page_map: %e", r);
+  8012db:	50                   	push   %eax
+  8012dc:	68 58 3f 80 00       	push   $0x803f58
+  8012e1:	6a 37                	push   $0x37
+  8012e3:	68 1f 3f 80 00       	push   $0x803f1f
+  8012e8:	e8 6e ef ff ff       	call   80025b <_panic>
+    panic("sys_page_unmap: %e", r);
+  8012ed:	50                   	push   %eax
+  8012ee:	68 69 3f 80 00       	push   $0x803f69
+  8012f3:	6a 3b                	push   $0x3b
+  8012f5:	68 1f 3f 80 00       	push   $0x803f1f
+  8012fa:	e8 5c ef ff ff       	call   80025b <_panic>
+
+008012ff <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  8012ff:	55                   	push   %ebp
+  801300:	89 e5                	mov    %esp,%ebp
+  801302:	53                   	push   %ebx
+  801303:	83 ec 10             	sub    $0x10,%esp
+  801306:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  801309:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  80130b:	50                   	push   %eax
+  80130c:	e8 5a 1e 00 00       	call   80316b <mmap_fault>
+  801311:	83 c4 10             	add    $0x10,%esp
+  801314:	84 c0                	test   %al,%al
+  801316:	74 05                	je     80131d <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801318:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80131b:	c9                   	leave
+  80131c:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  80131d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801323:	83 ec 04             	sub    $0x4,%esp
+  801326:	6a 07                	push   $0x7
+  801328:	68 00 f0 7f 00       	push   $0x7ff000
+  80132d:	6a 00                	push   $0x0
+  80132f:	e8 1f fa ff ff       	call   800d53 <sys_page_alloc>
+  801334:	83 c4 10             	add    $0x10,%esp
+  801337:	85 c0                	test   %eax,%eax
+  801339:	78 5b                	js     801396 <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  80133b:	83 ec 04             	sub    $0x4,%esp
+  80133e:	68 00 10 00 00       	push   $0x1000
+  801343:	53                   	push   %ebx
+  801344:	68 00 f0 7f 00       	push   $0x7ff000
+  801349:	e8 5c f7 ff ff       	call   800aaa <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80134e:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801355:	53                   	push   %ebx
+  801356:	6a 00                	push   $0x0
+  801358:	68 00 f0 7f 00       	push   $0x7ff000
+  80135d:	6a 00                	push   $0x0
+  80135f:	e8 32 fa ff ff       	call   800d96 <sys_page_map>
+  801364:	83 c4 20             	add    $0x20,%esp
+  801367:	85 c0                	test   %eax,%eax
+  801369:	78 40                	js     8013ab <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  80136b:	83 ec 08             	sub    $0x8,%esp
+  80136e:	68 00 f0 7f 00       	push   $0x7ff000
+  801373:	6a 00                	push   $0x0
+  801375:	e8 5e fa ff ff       	call   800dd8 <sys_page_unmap>
+  80137a:	83 c4 10             	add    $0x10,%esp
+  80137d:	85 c0                	test   %eax,%eax
+  80137f:	79 97                	jns    801318 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  801381:	50                   	push   %eax
+  801382:	68 69 3f 80 00       	push   $0x803f69
+  801387:	68 b0 00 00 00       	push   $0xb0
+  80138c:	68 1f 3f 80 00       	push   $0x803f1f
+  801391:	e8 c5 ee ff ff       	call   80025b <_panic>
+    panic("sys_page_alloc: %e", r);
+  801396:	50                   	push   %eax
+  801397:	68 45 3f 80 00       	push   $0x803f45
+  80139c:	68 a4 00 00 00       	push   $0xa4
+  8013a1:	68 1f 3f 80 00       	push   $0x803f1f
+  8013a6:	e8 b0 ee ff ff       	call   80025b <_panic>
+    panic("sys_page_map: %e", r);
+  8013ab:	50                   	push   %eax
+  8013ac:	68 58 3f 80 00       	push   $0x803f58
+  8013b1:	68 ac 00 00 00       	push   $0xac
+  8013b6:	68 1f 3f 80 00       	push   $0x803f1f
+  8013bb:	e8 9b ee ff ff       	call   80025b <_panic>
+
+008013c0 <fork>:
+{
+  8013c0:	55                   	push   %ebp
+  8013c1:	89 e5                	mov    %esp,%ebp
+  8013c3:	53                   	push   %ebx
+  8013c4:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  8013c7:	e8 06 f9 ff ff       	call   800cd2 <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  8013cc:	83 ec 0c             	sub    $0xc,%esp
+  8013cf:	68 02 12 80 00       	push   $0x801202
+  8013d4:	e8 21 24 00 00       	call   8037fa <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8013d9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013de:	cd 30                	int    $0x30
+  8013e0:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  8013e2:	83 c4 10             	add    $0x10,%esp
+  8013e5:	85 c0                	test   %eax,%eax
+  8013e7:	78 66                	js     80144f <fork+0x8f>
+  } else if (envid == 0) {
+  8013e9:	74 76                	je     801461 <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  8013eb:	83 ec 0c             	sub    $0xc,%esp
+  8013ee:	6a 01                	push   $0x1
+  8013f0:	50                   	push   %eax
+  8013f1:	68 00 f0 bf ee       	push   $0xeebff000
+  8013f6:	6a 00                	push   $0x0
+  8013f8:	6a 00                	push   $0x0
+  8013fa:	e8 1b fa ff ff       	call   800e1a <sys_page_map_range>
+  8013ff:	83 c4 20             	add    $0x20,%esp
+  801402:	85 c0                	test   %eax,%eax
+  801404:	78 77                	js     80147d <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  801406:	83 ec 04             	sub    $0x4,%esp
+  801409:	6a 07                	push   $0x7
+  80140b:	68 00 f0 bf ee       	push   $0xeebff000
+  801410:	53                   	push   %ebx
+  801411:	e8 3d f9 ff ff       	call   800d53 <sys_page_alloc>
+  801416:	83 c4 10             	add    $0x10,%esp
+  801419:	85 c0                	test   %eax,%eax
+  80141b:	78 72                	js     80148f <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80141d:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801422:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801425:	83 ec 08             	sub    $0x8,%esp
+  801428:	50                   	push   %eax
+  801429:	53                   	push   %ebx
+  80142a:	e8 99 fb ff ff       	call   800fc8 <sys_env_set_pgfault_upcall>
+  80142f:	83 c4 10             	add    $0x10,%esp
+  801432:	85 c0                	test   %eax,%eax
+  801434:	78 6b                	js     8014a1 <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801436:	83 ec 08             	sub    $0x8,%esp
+  801439:	6a 02                	push   $0x2
+  80143b:	53                   	push   %ebx
+  80143c:	e8 03 fb ff ff       	call   800f44 <sys_env_set_status>
+  801441:	83 c4 10             	add    $0x10,%esp
+  801444:	85 c0                	test   %eax,%eax
+  801446:	78 6b                	js     8014b3 <fork+0xf3>
+}
+  801448:	89 d8                	mov    %ebx,%eax
+  80144a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80144d:	c9                   	leave
+  80144e:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  80144f:	50                   	push   %eax
+  801450:	68 7c 3f 80 00       	push   $0x803f7c
+  801455:	6a 5e                	push   $0x5e
+  801457:	68 1f 3f 80 00       	push   $0x803f1f
+  80145c:	e8 fa ed ff ff       	call   80025b <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801461:	e8 6c f8 ff ff       	call   800cd2 <sys_getenvid>
+  801466:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80146b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80146e:	c1 e0 04             	shl    $0x4,%eax
+  801471:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801476:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+    return 0;
+  80147b:	eb cb                	jmp    801448 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  80147d:	50                   	push   %eax
+  80147e:	68 8c 3f 80 00       	push   $0x803f8c
+  801483:	6a 69                	push   $0x69
+  801485:	68 1f 3f 80 00       	push   $0x803f1f
+  80148a:	e8 cc ed ff ff       	call   80025b <_panic>
+    panic("sys_page_alloc: %e", error);
+  80148f:	50                   	push   %eax
+  801490:	68 45 3f 80 00       	push   $0x803f45
+  801495:	6a 70                	push   $0x70
+  801497:	68 1f 3f 80 00       	push   $0x803f1f
+  80149c:	e8 ba ed ff ff       	call   80025b <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  8014a1:	50                   	push   %eax
+  8014a2:	68 bc 3f 80 00       	push   $0x803fbc
+  8014a7:	6a 76                	push   $0x76
+  8014a9:	68 1f 3f 80 00       	push   $0x803f1f
+  8014ae:	e8 a8 ed ff ff       	call   80025b <_panic>
+    panic("sys_env_set_status: %e", error);
+  8014b3:	50                   	push   %eax
+  8014b4:	68 a3 3f 80 00       	push   $0x803fa3
+  8014b9:	6a 7a                	push   $0x7a
+  8014bb:	68 1f 3f 80 00       	push   $0x803f1f
+  8014c0:	e8 96 ed ff ff       	call   80025b <_panic>
+
+008014c5 <kfork>:
+{
+  8014c5:	55                   	push   %ebp
+  8014c6:	89 e5                	mov    %esp,%ebp
+  8014c8:	53                   	push   %ebx
+  8014c9:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  8014cc:	68 02 12 80 00       	push   $0x801202
+  8014d1:	e8 24 23 00 00       	call   8037fa <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  8014d6:	e8 4a fa ff ff       	call   800f25 <sys_fork>
+  8014db:	89 c3                	mov    %eax,%ebx
+  8014dd:	83 c4 10             	add    $0x10,%esp
+  8014e0:	85 c0                	test   %eax,%eax
+  8014e2:	74 07                	je     8014eb <kfork+0x26>
+}
+  8014e4:	89 d8                	mov    %ebx,%eax
+  8014e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014e9:	c9                   	leave
+  8014ea:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8014eb:	e8 e2 f7 ff ff       	call   800cd2 <sys_getenvid>
+  8014f0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014f5:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8014f8:	c1 e0 04             	shl    $0x4,%eax
+  8014fb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801500:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+  return envid;
+  801505:	eb dd                	jmp    8014e4 <kfork+0x1f>
+
+00801507 <sfork>:
+
+int
+sfork(void)
+{
+  801507:	55                   	push   %ebp
+  801508:	89 e5                	mov    %esp,%ebp
+  80150a:	53                   	push   %ebx
+  80150b:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  80150e:	e8 bf f7 ff ff       	call   800cd2 <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  801513:	83 ec 0c             	sub    $0xc,%esp
+  801516:	68 ff 12 80 00       	push   $0x8012ff
+  80151b:	e8 da 22 00 00       	call   8037fa <set_pgfault_handler>
+  801520:	b8 07 00 00 00       	mov    $0x7,%eax
+  801525:	cd 30                	int    $0x30
+  801527:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  801529:	83 c4 10             	add    $0x10,%esp
+  80152c:	85 c0                	test   %eax,%eax
+  80152e:	78 09                	js     801539 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  801530:	75 1c                	jne    80154e <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  801532:	89 d8                	mov    %ebx,%eax
+  801534:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801537:	c9                   	leave
+  801538:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801539:	50                   	push   %eax
+  80153a:	68 7c 3f 80 00       	push   $0x803f7c
+  80153f:	68 c3 00 00 00       	push   $0xc3
+  801544:	68 1f 3f 80 00       	push   $0x803f1f
+  801549:	e8 0d ed ff ff       	call   80025b <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  80154e:	83 ec 0c             	sub    $0xc,%esp
+  801551:	6a 00                	push   $0x0
+  801553:	50                   	push   %eax
+  801554:	68 00 d0 bf ee       	push   $0xeebfd000
+  801559:	6a 00                	push   $0x0
+  80155b:	6a 00                	push   $0x0
+  80155d:	e8 b8 f8 ff ff       	call   800e1a <sys_page_map_range>
+  801562:	83 c4 20             	add    $0x20,%esp
+  801565:	85 c0                	test   %eax,%eax
+  801567:	78 79                	js     8015e2 <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  801569:	83 ec 0c             	sub    $0xc,%esp
+  80156c:	6a 01                	push   $0x1
+  80156e:	53                   	push   %ebx
+  80156f:	68 00 10 00 00       	push   $0x1000
+  801574:	68 00 d0 bf ee       	push   $0xeebfd000
+  801579:	6a 00                	push   $0x0
+  80157b:	e8 9a f8 ff ff       	call   800e1a <sys_page_map_range>
+  801580:	83 c4 20             	add    $0x20,%esp
+  801583:	85 c0                	test   %eax,%eax
+  801585:	78 70                	js     8015f7 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  801587:	83 ec 04             	sub    $0x4,%esp
+  80158a:	6a 07                	push   $0x7
+  80158c:	68 00 f0 bf ee       	push   $0xeebff000
+  801591:	53                   	push   %ebx
+  801592:	e8 bc f7 ff ff       	call   800d53 <sys_page_alloc>
+  801597:	83 c4 10             	add    $0x10,%esp
+  80159a:	85 c0                	test   %eax,%eax
+  80159c:	78 6e                	js     80160c <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80159e:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8015a3:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  8015a6:	83 ec 08             	sub    $0x8,%esp
+  8015a9:	50                   	push   %eax
+  8015aa:	53                   	push   %ebx
+  8015ab:	e8 18 fa ff ff       	call   800fc8 <sys_env_set_pgfault_upcall>
+  8015b0:	83 c4 10             	add    $0x10,%esp
+  8015b3:	85 c0                	test   %eax,%eax
+  8015b5:	78 6a                	js     801621 <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8015b7:	83 ec 08             	sub    $0x8,%esp
+  8015ba:	6a 02                	push   $0x2
+  8015bc:	53                   	push   %ebx
+  8015bd:	e8 82 f9 ff ff       	call   800f44 <sys_env_set_status>
+  8015c2:	83 c4 10             	add    $0x10,%esp
+  8015c5:	85 c0                	test   %eax,%eax
+  8015c7:	0f 89 65 ff ff ff    	jns    801532 <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  8015cd:	50                   	push   %eax
+  8015ce:	68 a3 3f 80 00       	push   $0x803fa3
+  8015d3:	68 e4 00 00 00       	push   $0xe4
+  8015d8:	68 1f 3f 80 00       	push   $0x803f1f
+  8015dd:	e8 79 ec ff ff       	call   80025b <_panic>
+    panic("sys_page_map_range: %e", error);
+  8015e2:	50                   	push   %eax
+  8015e3:	68 8c 3f 80 00       	push   $0x803f8c
+  8015e8:	68 ce 00 00 00       	push   $0xce
+  8015ed:	68 1f 3f 80 00       	push   $0x803f1f
+  8015f2:	e8 64 ec ff ff       	call   80025b <_panic>
+    panic("sys_page_map_range: %e", error);
+  8015f7:	50                   	push   %eax
+  8015f8:	68 8c 3f 80 00       	push   $0x803f8c
+  8015fd:	68 d3 00 00 00       	push   $0xd3
+  801602:	68 1f 3f 80 00       	push   $0x803f1f
+  801607:	e8 4f ec ff ff       	call   80025b <_panic>
+    panic("sys_page_alloc: %e", error);
+  80160c:	50                   	push   %eax
+  80160d:	68 45 3f 80 00       	push   $0x803f45
+  801612:	68 da 00 00 00       	push   $0xda
+  801617:	68 1f 3f 80 00       	push   $0x803f1f
+  80161c:	e8 3a ec ff ff       	call   80025b <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801621:	50                   	push   %eax
+  801622:	68 bc 3f 80 00       	push   $0x803fbc
+  801627:	68 e0 00 00 00       	push   $0xe0
+  80162c:	68 1f 3f 80 00       	push   $0x803f1f
+  801631:	e8 25 ec ff ff       	call   80025b <_panic>
+
+00801636 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  801636:	55                   	push   %ebp
+  801637:	89 e5                	mov    %esp,%ebp
+  801639:	57                   	push   %edi
+  80163a:	56                   	push   %esi
+  80163b:	53                   	push   %ebx
+  80163c:	83 ec 14             	sub    $0x14,%esp
+  80163f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801642:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801645:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801648:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  80164b:	85 c0                	test   %eax,%eax
+  80164d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801652:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  801655:	ff 33                	push   (%ebx)
+  801657:	50                   	push   %eax
+  801658:	e8 ce f9 ff ff       	call   80102b <sys_ipc_recv>
+  80165d:	83 c4 10             	add    $0x10,%esp
+  801660:	85 c0                	test   %eax,%eax
+  801662:	78 39                	js     80169d <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  801664:	85 ff                	test   %edi,%edi
+  801666:	74 0a                	je     801672 <ipc_recv_pages+0x3c>
+  801668:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80166d:	8b 40 7c             	mov    0x7c(%eax),%eax
+  801670:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  801672:	85 f6                	test   %esi,%esi
+  801674:	74 0d                	je     801683 <ipc_recv_pages+0x4d>
+  801676:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80167b:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  801681:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  801683:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801688:	8b 40 74             	mov    0x74(%eax),%eax
+  80168b:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  80168d:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801692:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  801695:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801698:	5b                   	pop    %ebx
+  801699:	5e                   	pop    %esi
+  80169a:	5f                   	pop    %edi
+  80169b:	5d                   	pop    %ebp
+  80169c:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  80169d:	85 ff                	test   %edi,%edi
+  80169f:	74 06                	je     8016a7 <ipc_recv_pages+0x71>
+  8016a1:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  8016a7:	85 f6                	test   %esi,%esi
+  8016a9:	74 06                	je     8016b1 <ipc_recv_pages+0x7b>
+  8016ab:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  8016b1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  8016b7:	eb dc                	jmp    801695 <ipc_recv_pages+0x5f>
+
+008016b9 <ipc_recv>:
+{
+  8016b9:	55                   	push   %ebp
+  8016ba:	89 e5                	mov    %esp,%ebp
+  8016bc:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  8016bf:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  8016c6:	ff 75 10             	push   0x10(%ebp)
+  8016c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016cc:	50                   	push   %eax
+  8016cd:	ff 75 0c             	push   0xc(%ebp)
+  8016d0:	ff 75 08             	push   0x8(%ebp)
+  8016d3:	e8 5e ff ff ff       	call   801636 <ipc_recv_pages>
+}
+  8016d8:	c9                   	leave
+  8016d9:	c3                   	ret
+
+008016da <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  8016da:	55                   	push   %ebp
+  8016db:	89 e5                	mov    %esp,%ebp
+  8016dd:	57                   	push   %edi
+  8016de:	56                   	push   %esi
+  8016df:	53                   	push   %ebx
+  8016e0:	83 ec 0c             	sub    $0xc,%esp
+  8016e3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016e6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8016e9:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8016ec:	89 c3                	mov    %eax,%ebx
+  8016ee:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8016f4:	85 c0                	test   %eax,%eax
+  8016f6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8016fb:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  8016fe:	83 ec 0c             	sub    $0xc,%esp
+  801701:	ff 75 14             	push   0x14(%ebp)
+  801704:	ff 75 18             	push   0x18(%ebp)
+  801707:	53                   	push   %ebx
+  801708:	56                   	push   %esi
+  801709:	57                   	push   %edi
+  80170a:	e8 fb f8 ff ff       	call   80100a <sys_ipc_try_send>
+  80170f:	83 c4 20             	add    $0x20,%esp
+  801712:	85 c0                	test   %eax,%eax
+  801714:	79 1e                	jns    801734 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  801716:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801719:	75 07                	jne    801722 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  80171b:	e8 d1 f5 ff ff       	call   800cf1 <sys_yield>
+  801720:	eb dc                	jmp    8016fe <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  801722:	50                   	push   %eax
+  801723:	68 db 3f 80 00       	push   $0x803fdb
+  801728:	6a 5c                	push   $0x5c
+  80172a:	68 e8 3f 80 00       	push   $0x803fe8
+  80172f:	e8 27 eb ff ff       	call   80025b <_panic>
+  }
+}
+  801734:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801737:	5b                   	pop    %ebx
+  801738:	5e                   	pop    %esi
+  801739:	5f                   	pop    %edi
+  80173a:	5d                   	pop    %ebp
+  80173b:	c3                   	ret
+
+0080173c <ipc_send>:
+{
+  80173c:	55                   	push   %ebp
+  80173d:	89 e5                	mov    %esp,%ebp
+  80173f:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  801742:	ff 75 14             	push   0x14(%ebp)
+  801745:	6a 01                	push   $0x1
+  801747:	ff 75 10             	push   0x10(%ebp)
+  80174a:	ff 75 0c             	push   0xc(%ebp)
+  80174d:	ff 75 08             	push   0x8(%ebp)
+  801750:	e8 85 ff ff ff       	call   8016da <ipc_send_pages>
+}
+  801755:	83 c4 20             	add    $0x20,%esp
+  801758:	c9                   	leave
+  801759:	c3                   	ret
+
+0080175a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80175a:	55                   	push   %ebp
+  80175b:	89 e5                	mov    %esp,%ebp
+  80175d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  801760:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801765:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801768:	c1 e0 04             	shl    $0x4,%eax
+  80176b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801770:	8b 40 50             	mov    0x50(%eax),%eax
+  801773:	39 c8                	cmp    %ecx,%eax
+  801775:	74 12                	je     801789 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801777:	83 c2 01             	add    $0x1,%edx
+  80177a:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801780:	75 e3                	jne    801765 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  801782:	b8 00 00 00 00       	mov    $0x0,%eax
+  801787:	eb 0e                	jmp    801797 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  801789:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80178c:	c1 e0 04             	shl    $0x4,%eax
+  80178f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801794:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801797:	5d                   	pop    %ebp
+  801798:	c3                   	ret
+
+00801799 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801799:	55                   	push   %ebp
+  80179a:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80179c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80179f:	05 00 00 00 30       	add    $0x30000000,%eax
+  8017a4:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8017a7:	5d                   	pop    %ebp
+  8017a8:	c3                   	ret
+
+008017a9 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017a9:	55                   	push   %ebp
+  8017aa:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8017ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017af:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8017b2:	66 b8 00 00          	mov    $0x0,%ax
+  8017b6:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8017bb:	5d                   	pop    %ebp
+  8017bc:	c3                   	ret
+
+008017bd <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8017bd:	55                   	push   %ebp
+  8017be:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8017c0:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8017c5:	eb 02                	jmp    8017c9 <fd_alloc+0xc>
+  8017c7:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8017c9:	89 c2                	mov    %eax,%edx
+  8017cb:	c1 ea 16             	shr    $0x16,%edx
+  8017ce:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017d5:	f6 c2 01             	test   $0x1,%dl
+  8017d8:	74 2b                	je     801805 <fd_alloc+0x48>
+  8017da:	89 c2                	mov    %eax,%edx
+  8017dc:	c1 ea 0c             	shr    $0xc,%edx
+  8017df:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8017e6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8017ec:	f6 c1 01             	test   $0x1,%cl
+  8017ef:	74 14                	je     801805 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8017f1:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8017f7:	75 ce                	jne    8017c7 <fd_alloc+0xa>
+  8017f9:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8017fe:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801803:	eb 05                	jmp    80180a <fd_alloc+0x4d>
+      return 0;
+  801805:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  80180a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80180d:	89 02                	mov    %eax,(%edx)
+}
+  80180f:	89 c8                	mov    %ecx,%eax
+  801811:	5d                   	pop    %ebp
+  801812:	c3                   	ret
+
+00801813 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801813:	55                   	push   %ebp
+  801814:	89 e5                	mov    %esp,%ebp
+  801816:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801819:	83 f8 1f             	cmp    $0x1f,%eax
+  80181c:	77 30                	ja     80184e <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  80181e:	c1 e0 0c             	shl    $0xc,%eax
+  801821:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801826:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80182c:	f6 c2 01             	test   $0x1,%dl
+  80182f:	74 24                	je     801855 <fd_lookup+0x42>
+  801831:	89 c2                	mov    %eax,%edx
+  801833:	c1 ea 0c             	shr    $0xc,%edx
+  801836:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80183d:	f6 c2 01             	test   $0x1,%dl
+  801840:	74 1a                	je     80185c <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801842:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801845:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801847:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80184c:	5d                   	pop    %ebp
+  80184d:	c3                   	ret
+    return -E_INVAL;
+  80184e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801853:	eb f7                	jmp    80184c <fd_lookup+0x39>
+    return -E_INVAL;
+  801855:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80185a:	eb f0                	jmp    80184c <fd_lookup+0x39>
+  80185c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801861:	eb e9                	jmp    80184c <fd_lookup+0x39>
+
+00801863 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801863:	55                   	push   %ebp
+  801864:	89 e5                	mov    %esp,%ebp
+  801866:	53                   	push   %ebx
+  801867:	83 ec 04             	sub    $0x4,%esp
+  80186a:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80186d:	b8 70 40 80 00       	mov    $0x804070,%eax
+  801872:	8b 18                	mov    (%eax),%ebx
+  801874:	85 db                	test   %ebx,%ebx
+  801876:	74 0e                	je     801886 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801878:	83 c0 04             	add    $0x4,%eax
+  80187b:	39 13                	cmp    %edx,(%ebx)
+  80187d:	75 f3                	jne    801872 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80187f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801884:	eb 1f                	jmp    8018a5 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801886:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80188b:	8b 40 48             	mov    0x48(%eax),%eax
+  80188e:	83 ec 04             	sub    $0x4,%esp
+  801891:	52                   	push   %edx
+  801892:	50                   	push   %eax
+  801893:	68 f4 3f 80 00       	push   $0x803ff4
+  801898:	e8 99 ea ff ff       	call   800336 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80189d:	83 c4 10             	add    $0x10,%esp
+  8018a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8018a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018a8:	89 1a                	mov    %ebx,(%edx)
+}
+  8018aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ad:	c9                   	leave
+  8018ae:	c3                   	ret
+
+008018af <fd_close>:
+{
+  8018af:	55                   	push   %ebp
+  8018b0:	89 e5                	mov    %esp,%ebp
+  8018b2:	57                   	push   %edi
+  8018b3:	56                   	push   %esi
+  8018b4:	53                   	push   %ebx
+  8018b5:	83 ec 24             	sub    $0x24,%esp
+  8018b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8018bb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018be:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018c1:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8018c2:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8018c8:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8018cb:	50                   	push   %eax
+  8018cc:	e8 42 ff ff ff       	call   801813 <fd_lookup>
+  8018d1:	89 c3                	mov    %eax,%ebx
+  8018d3:	83 c4 10             	add    $0x10,%esp
+  8018d6:	85 c0                	test   %eax,%eax
+  8018d8:	78 05                	js     8018df <fd_close+0x30>
+      || fd != fd2)
+  8018da:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8018dd:	74 16                	je     8018f5 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8018df:	89 f8                	mov    %edi,%eax
+  8018e1:	84 c0                	test   %al,%al
+  8018e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8018eb:	89 d8                	mov    %ebx,%eax
+  8018ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018f0:	5b                   	pop    %ebx
+  8018f1:	5e                   	pop    %esi
+  8018f2:	5f                   	pop    %edi
+  8018f3:	5d                   	pop    %ebp
+  8018f4:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018f5:	83 ec 08             	sub    $0x8,%esp
+  8018f8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8018fb:	50                   	push   %eax
+  8018fc:	ff 36                	push   (%esi)
+  8018fe:	e8 60 ff ff ff       	call   801863 <dev_lookup>
+  801903:	89 c3                	mov    %eax,%ebx
+  801905:	83 c4 10             	add    $0x10,%esp
+  801908:	85 c0                	test   %eax,%eax
+  80190a:	78 1a                	js     801926 <fd_close+0x77>
+    if (dev->dev_close)
+  80190c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80190f:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801912:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801917:	85 c0                	test   %eax,%eax
+  801919:	74 0b                	je     801926 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  80191b:	83 ec 0c             	sub    $0xc,%esp
+  80191e:	56                   	push   %esi
+  80191f:	ff d0                	call   *%eax
+  801921:	89 c3                	mov    %eax,%ebx
+  801923:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801926:	83 ec 08             	sub    $0x8,%esp
+  801929:	56                   	push   %esi
+  80192a:	6a 00                	push   $0x0
+  80192c:	e8 a7 f4 ff ff       	call   800dd8 <sys_page_unmap>
+  return r;
+  801931:	83 c4 10             	add    $0x10,%esp
+  801934:	eb b5                	jmp    8018eb <fd_close+0x3c>
+
+00801936 <close>:
+
+int
+close(int fdnum)
+{
+  801936:	55                   	push   %ebp
+  801937:	89 e5                	mov    %esp,%ebp
+  801939:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80193c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80193f:	50                   	push   %eax
+  801940:	ff 75 08             	push   0x8(%ebp)
+  801943:	e8 cb fe ff ff       	call   801813 <fd_lookup>
+  801948:	83 c4 10             	add    $0x10,%esp
+  80194b:	85 c0                	test   %eax,%eax
+  80194d:	79 02                	jns    801951 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80194f:	c9                   	leave
+  801950:	c3                   	ret
+    return fd_close(fd, 1);
+  801951:	83 ec 08             	sub    $0x8,%esp
+  801954:	6a 01                	push   $0x1
+  801956:	ff 75 f4             	push   -0xc(%ebp)
+  801959:	e8 51 ff ff ff       	call   8018af <fd_close>
+  80195e:	83 c4 10             	add    $0x10,%esp
+  801961:	eb ec                	jmp    80194f <close+0x19>
+
+00801963 <close_all>:
+
+void
+close_all(void)
+{
+  801963:	55                   	push   %ebp
+  801964:	89 e5                	mov    %esp,%ebp
+  801966:	53                   	push   %ebx
+  801967:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  80196a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80196f:	83 ec 0c             	sub    $0xc,%esp
+  801972:	53                   	push   %ebx
+  801973:	e8 be ff ff ff       	call   801936 <close>
+  for (i = 0; i < MAXFD; i++)
+  801978:	83 c3 01             	add    $0x1,%ebx
+  80197b:	83 c4 10             	add    $0x10,%esp
+  80197e:	83 fb 20             	cmp    $0x20,%ebx
+  801981:	75 ec                	jne    80196f <close_all+0xc>
+}
+  801983:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801986:	c9                   	leave
+  801987:	c3                   	ret
+
+00801988 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801988:	55                   	push   %ebp
+  801989:	89 e5                	mov    %esp,%ebp
+  80198b:	57                   	push   %edi
+  80198c:	56                   	push   %esi
+  80198d:	53                   	push   %ebx
+  80198e:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801991:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801994:	50                   	push   %eax
+  801995:	ff 75 08             	push   0x8(%ebp)
+  801998:	e8 76 fe ff ff       	call   801813 <fd_lookup>
+  80199d:	89 c6                	mov    %eax,%esi
+  80199f:	83 c4 10             	add    $0x10,%esp
+  8019a2:	85 c0                	test   %eax,%eax
+  8019a4:	0f 88 0a 01 00 00    	js     801ab4 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8019aa:	83 ec 0c             	sub    $0xc,%esp
+  8019ad:	ff 75 0c             	push   0xc(%ebp)
+  8019b0:	e8 81 ff ff ff       	call   801936 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8019b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019b8:	c1 e0 0c             	shl    $0xc,%eax
+  8019bb:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8019c1:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8019c4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019c7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8019ca:	89 04 24             	mov    %eax,(%esp)
+  8019cd:	e8 d7 fd ff ff       	call   8017a9 <fd2data>
+  8019d2:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8019d4:	89 3c 24             	mov    %edi,(%esp)
+  8019d7:	e8 cd fd ff ff       	call   8017a9 <fd2data>
+  8019dc:	83 c4 10             	add    $0x10,%esp
+  8019df:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8019e2:	89 f3                	mov    %esi,%ebx
+  8019e4:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8019ea:	89 c6                	mov    %eax,%esi
+  8019ec:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8019ef:	89 cf                	mov    %ecx,%edi
+  8019f1:	eb 0c                	jmp    8019ff <dup+0x77>
+  8019f3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8019f9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8019ff:	39 fb                	cmp    %edi,%ebx
+  801a01:	74 7b                	je     801a7e <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801a03:	89 d8                	mov    %ebx,%eax
+  801a05:	c1 e8 16             	shr    $0x16,%eax
+  801a08:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a0f:	a8 01                	test   $0x1,%al
+  801a11:	74 e0                	je     8019f3 <dup+0x6b>
+  801a13:	89 d8                	mov    %ebx,%eax
+  801a15:	c1 e8 0c             	shr    $0xc,%eax
+  801a18:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a1f:	f6 c2 01             	test   $0x1,%dl
+  801a22:	74 cf                	je     8019f3 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801a24:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801a2b:	83 ec 0c             	sub    $0xc,%esp
+  801a2e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a33:	50                   	push   %eax
+  801a34:	56                   	push   %esi
+  801a35:	6a 00                	push   $0x0
+  801a37:	53                   	push   %ebx
+  801a38:	6a 00                	push   $0x0
+  801a3a:	e8 57 f3 ff ff       	call   800d96 <sys_page_map>
+  801a3f:	83 c4 20             	add    $0x20,%esp
+  801a42:	85 c0                	test   %eax,%eax
+  801a44:	79 ad                	jns    8019f3 <dup+0x6b>
+  801a46:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a49:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801a4b:	83 ec 08             	sub    $0x8,%esp
+  801a4e:	ff 75 d4             	push   -0x2c(%ebp)
+  801a51:	6a 00                	push   $0x0
+  801a53:	e8 80 f3 ff ff       	call   800dd8 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801a58:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801a5b:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801a61:	83 c4 10             	add    $0x10,%esp
+  801a64:	39 df                	cmp    %ebx,%edi
+  801a66:	74 4c                	je     801ab4 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801a68:	83 ec 08             	sub    $0x8,%esp
+  801a6b:	57                   	push   %edi
+  801a6c:	6a 00                	push   $0x0
+  801a6e:	e8 65 f3 ff ff       	call   800dd8 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801a73:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801a79:	83 c4 10             	add    $0x10,%esp
+  801a7c:	eb e6                	jmp    801a64 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801a7e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a81:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a84:	89 c8                	mov    %ecx,%eax
+  801a86:	c1 e8 0c             	shr    $0xc,%eax
+  801a89:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a90:	83 ec 0c             	sub    $0xc,%esp
+  801a93:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a98:	50                   	push   %eax
+  801a99:	ff 75 d4             	push   -0x2c(%ebp)
+  801a9c:	6a 00                	push   $0x0
+  801a9e:	51                   	push   %ecx
+  801a9f:	6a 00                	push   $0x0
+  801aa1:	e8 f0 f2 ff ff       	call   800d96 <sys_page_map>
+  801aa6:	89 c6                	mov    %eax,%esi
+  801aa8:	83 c4 20             	add    $0x20,%esp
+  801aab:	85 c0                	test   %eax,%eax
+  801aad:	78 9c                	js     801a4b <dup+0xc3>
+  return newfdnum;
+  801aaf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ab2:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801ab4:	89 f0                	mov    %esi,%eax
+  801ab6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ab9:	5b                   	pop    %ebx
+  801aba:	5e                   	pop    %esi
+  801abb:	5f                   	pop    %edi
+  801abc:	5d                   	pop    %ebp
+  801abd:	c3                   	ret
+
+00801abe <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801abe:	55                   	push   %ebp
+  801abf:	89 e5                	mov    %esp,%ebp
+  801ac1:	56                   	push   %esi
+  801ac2:	53                   	push   %ebx
+  801ac3:	83 ec 18             	sub    $0x18,%esp
+  801ac6:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ac9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801acc:	50                   	push   %eax
+  801acd:	56                   	push   %esi
+  801ace:	e8 40 fd ff ff       	call   801813 <fd_lookup>
+  801ad3:	83 c4 10             	add    $0x10,%esp
+  801ad6:	85 c0                	test   %eax,%eax
+  801ad8:	78 3c                	js     801b16 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ada:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801add:	83 ec 08             	sub    $0x8,%esp
+  801ae0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ae3:	50                   	push   %eax
+  801ae4:	ff 33                	push   (%ebx)
+  801ae6:	e8 78 fd ff ff       	call   801863 <dev_lookup>
+  801aeb:	83 c4 10             	add    $0x10,%esp
+  801aee:	85 c0                	test   %eax,%eax
+  801af0:	78 24                	js     801b16 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801af2:	8b 43 08             	mov    0x8(%ebx),%eax
+  801af5:	83 e0 03             	and    $0x3,%eax
+  801af8:	83 f8 01             	cmp    $0x1,%eax
+  801afb:	74 20                	je     801b1d <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801afd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b00:	8b 40 08             	mov    0x8(%eax),%eax
+  801b03:	85 c0                	test   %eax,%eax
+  801b05:	74 37                	je     801b3e <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801b07:	83 ec 04             	sub    $0x4,%esp
+  801b0a:	ff 75 10             	push   0x10(%ebp)
+  801b0d:	ff 75 0c             	push   0xc(%ebp)
+  801b10:	53                   	push   %ebx
+  801b11:	ff d0                	call   *%eax
+  801b13:	83 c4 10             	add    $0x10,%esp
+}
+  801b16:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b19:	5b                   	pop    %ebx
+  801b1a:	5e                   	pop    %esi
+  801b1b:	5d                   	pop    %ebp
+  801b1c:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b1d:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801b22:	8b 40 48             	mov    0x48(%eax),%eax
+  801b25:	83 ec 04             	sub    $0x4,%esp
+  801b28:	56                   	push   %esi
+  801b29:	50                   	push   %eax
+  801b2a:	68 35 40 80 00       	push   $0x804035
+  801b2f:	e8 02 e8 ff ff       	call   800336 <cprintf>
+    return -E_INVAL;
+  801b34:	83 c4 10             	add    $0x10,%esp
+  801b37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b3c:	eb d8                	jmp    801b16 <read+0x58>
+    return -E_NOT_SUPP;
+  801b3e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b43:	eb d1                	jmp    801b16 <read+0x58>
+
+00801b45 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801b45:	55                   	push   %ebp
+  801b46:	89 e5                	mov    %esp,%ebp
+  801b48:	57                   	push   %edi
+  801b49:	56                   	push   %esi
+  801b4a:	53                   	push   %ebx
+  801b4b:	83 ec 0c             	sub    $0xc,%esp
+  801b4e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b51:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801b54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b59:	eb 02                	jmp    801b5d <readn+0x18>
+  801b5b:	01 c3                	add    %eax,%ebx
+  801b5d:	39 f3                	cmp    %esi,%ebx
+  801b5f:	73 21                	jae    801b82 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801b61:	83 ec 04             	sub    $0x4,%esp
+  801b64:	89 f0                	mov    %esi,%eax
+  801b66:	29 d8                	sub    %ebx,%eax
+  801b68:	50                   	push   %eax
+  801b69:	89 d8                	mov    %ebx,%eax
+  801b6b:	03 45 0c             	add    0xc(%ebp),%eax
+  801b6e:	50                   	push   %eax
+  801b6f:	57                   	push   %edi
+  801b70:	e8 49 ff ff ff       	call   801abe <read>
+    if (m < 0)
+  801b75:	83 c4 10             	add    $0x10,%esp
+  801b78:	85 c0                	test   %eax,%eax
+  801b7a:	78 04                	js     801b80 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801b7c:	75 dd                	jne    801b5b <readn+0x16>
+  801b7e:	eb 02                	jmp    801b82 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801b80:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801b82:	89 d8                	mov    %ebx,%eax
+  801b84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b87:	5b                   	pop    %ebx
+  801b88:	5e                   	pop    %esi
+  801b89:	5f                   	pop    %edi
+  801b8a:	5d                   	pop    %ebp
+  801b8b:	c3                   	ret
+
+00801b8c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b8c:	55                   	push   %ebp
+  801b8d:	89 e5                	mov    %esp,%ebp
+  801b8f:	56                   	push   %esi
+  801b90:	53                   	push   %ebx
+  801b91:	83 ec 18             	sub    $0x18,%esp
+  801b94:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b97:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b9a:	50                   	push   %eax
+  801b9b:	53                   	push   %ebx
+  801b9c:	e8 72 fc ff ff       	call   801813 <fd_lookup>
+  801ba1:	83 c4 10             	add    $0x10,%esp
+  801ba4:	85 c0                	test   %eax,%eax
+  801ba6:	78 37                	js     801bdf <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ba8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bab:	83 ec 08             	sub    $0x8,%esp
+  801bae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bb1:	50                   	push   %eax
+  801bb2:	ff 36                	push   (%esi)
+  801bb4:	e8 aa fc ff ff       	call   801863 <dev_lookup>
+  801bb9:	83 c4 10             	add    $0x10,%esp
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	78 1f                	js     801bdf <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bc0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bc4:	74 20                	je     801be6 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801bc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bc9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bcc:	85 c0                	test   %eax,%eax
+  801bce:	74 37                	je     801c07 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801bd0:	83 ec 04             	sub    $0x4,%esp
+  801bd3:	ff 75 10             	push   0x10(%ebp)
+  801bd6:	ff 75 0c             	push   0xc(%ebp)
+  801bd9:	56                   	push   %esi
+  801bda:	ff d0                	call   *%eax
+  801bdc:	83 c4 10             	add    $0x10,%esp
+}
+  801bdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be2:	5b                   	pop    %ebx
+  801be3:	5e                   	pop    %esi
+  801be4:	5d                   	pop    %ebp
+  801be5:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801be6:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801beb:	8b 40 48             	mov    0x48(%eax),%eax
+  801bee:	83 ec 04             	sub    $0x4,%esp
+  801bf1:	53                   	push   %ebx
+  801bf2:	50                   	push   %eax
+  801bf3:	68 51 40 80 00       	push   $0x804051
+  801bf8:	e8 39 e7 ff ff       	call   800336 <cprintf>
+    return -E_INVAL;
+  801bfd:	83 c4 10             	add    $0x10,%esp
+  801c00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c05:	eb d8                	jmp    801bdf <write+0x53>
+    return -E_NOT_SUPP;
+  801c07:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c0c:	eb d1                	jmp    801bdf <write+0x53>
+
+00801c0e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c0e:	55                   	push   %ebp
+  801c0f:	89 e5                	mov    %esp,%ebp
+  801c11:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c17:	50                   	push   %eax
+  801c18:	ff 75 08             	push   0x8(%ebp)
+  801c1b:	e8 f3 fb ff ff       	call   801813 <fd_lookup>
+  801c20:	83 c4 10             	add    $0x10,%esp
+  801c23:	85 c0                	test   %eax,%eax
+  801c25:	78 0e                	js     801c35 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801c27:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c2d:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801c30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c35:	c9                   	leave
+  801c36:	c3                   	ret
+
+00801c37 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c37:	55                   	push   %ebp
+  801c38:	89 e5                	mov    %esp,%ebp
+  801c3a:	56                   	push   %esi
+  801c3b:	53                   	push   %ebx
+  801c3c:	83 ec 18             	sub    $0x18,%esp
+  801c3f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c42:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c45:	50                   	push   %eax
+  801c46:	53                   	push   %ebx
+  801c47:	e8 c7 fb ff ff       	call   801813 <fd_lookup>
+  801c4c:	83 c4 10             	add    $0x10,%esp
+  801c4f:	85 c0                	test   %eax,%eax
+  801c51:	78 34                	js     801c87 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c53:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c56:	83 ec 08             	sub    $0x8,%esp
+  801c59:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c5c:	50                   	push   %eax
+  801c5d:	ff 36                	push   (%esi)
+  801c5f:	e8 ff fb ff ff       	call   801863 <dev_lookup>
+  801c64:	83 c4 10             	add    $0x10,%esp
+  801c67:	85 c0                	test   %eax,%eax
+  801c69:	78 1c                	js     801c87 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c6b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c6f:	74 1d                	je     801c8e <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801c71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c74:	8b 40 18             	mov    0x18(%eax),%eax
+  801c77:	85 c0                	test   %eax,%eax
+  801c79:	74 34                	je     801caf <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801c7b:	83 ec 08             	sub    $0x8,%esp
+  801c7e:	ff 75 0c             	push   0xc(%ebp)
+  801c81:	56                   	push   %esi
+  801c82:	ff d0                	call   *%eax
+  801c84:	83 c4 10             	add    $0x10,%esp
+}
+  801c87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c8a:	5b                   	pop    %ebx
+  801c8b:	5e                   	pop    %esi
+  801c8c:	5d                   	pop    %ebp
+  801c8d:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801c8e:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801c93:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c96:	83 ec 04             	sub    $0x4,%esp
+  801c99:	53                   	push   %ebx
+  801c9a:	50                   	push   %eax
+  801c9b:	68 14 40 80 00       	push   $0x804014
+  801ca0:	e8 91 e6 ff ff       	call   800336 <cprintf>
+    return -E_INVAL;
+  801ca5:	83 c4 10             	add    $0x10,%esp
+  801ca8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cad:	eb d8                	jmp    801c87 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801caf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801cb4:	eb d1                	jmp    801c87 <ftruncate+0x50>
+
+00801cb6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801cb6:	55                   	push   %ebp
+  801cb7:	89 e5                	mov    %esp,%ebp
+  801cb9:	56                   	push   %esi
+  801cba:	53                   	push   %ebx
+  801cbb:	83 ec 18             	sub    $0x18,%esp
+  801cbe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cc1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cc4:	50                   	push   %eax
+  801cc5:	ff 75 08             	push   0x8(%ebp)
+  801cc8:	e8 46 fb ff ff       	call   801813 <fd_lookup>
+  801ccd:	83 c4 10             	add    $0x10,%esp
+  801cd0:	85 c0                	test   %eax,%eax
+  801cd2:	78 49                	js     801d1d <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cd4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cd7:	83 ec 08             	sub    $0x8,%esp
+  801cda:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cdd:	50                   	push   %eax
+  801cde:	ff 36                	push   (%esi)
+  801ce0:	e8 7e fb ff ff       	call   801863 <dev_lookup>
+  801ce5:	83 c4 10             	add    $0x10,%esp
+  801ce8:	85 c0                	test   %eax,%eax
+  801cea:	78 31                	js     801d1d <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801cec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cef:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801cf3:	74 2f                	je     801d24 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801cf5:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801cf8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801cff:	00 00 00 
+  stat->st_isdir = 0;
+  801d02:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d09:	00 00 00 
+  stat->st_dev = dev;
+  801d0c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801d12:	83 ec 08             	sub    $0x8,%esp
+  801d15:	53                   	push   %ebx
+  801d16:	56                   	push   %esi
+  801d17:	ff 50 14             	call   *0x14(%eax)
+  801d1a:	83 c4 10             	add    $0x10,%esp
+}
+  801d1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d20:	5b                   	pop    %ebx
+  801d21:	5e                   	pop    %esi
+  801d22:	5d                   	pop    %ebp
+  801d23:	c3                   	ret
+    return -E_NOT_SUPP;
+  801d24:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d29:	eb f2                	jmp    801d1d <fstat+0x67>
+
+00801d2b <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d2b:	55                   	push   %ebp
+  801d2c:	89 e5                	mov    %esp,%ebp
+  801d2e:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801d31:	ff 75 0c             	push   0xc(%ebp)
+  801d34:	ff 75 08             	push   0x8(%ebp)
+  801d37:	e8 58 07 00 00       	call   802494 <file_stat>
+}
+  801d3c:	c9                   	leave
+  801d3d:	c3                   	ret
+
+00801d3e <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801d3e:	55                   	push   %ebp
+  801d3f:	89 e5                	mov    %esp,%ebp
+  801d41:	57                   	push   %edi
+  801d42:	56                   	push   %esi
+  801d43:	53                   	push   %ebx
+  801d44:	83 ec 1c             	sub    $0x1c,%esp
+  801d47:	89 c7                	mov    %eax,%edi
+  801d49:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801d4c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801d4f:	e9 a2 00 00 00       	jmp    801df6 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801d54:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801d5b:	00 00 00 
+  801d5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d63:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801d68:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801d6d:	be 01 00 00 00       	mov    $0x1,%esi
+  801d72:	eb 0f                	jmp    801d83 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801d74:	83 c0 01             	add    $0x1,%eax
+  801d77:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801d7c:	74 49                	je     801dc7 <fsipc_send+0x89>
+  801d7e:	83 f9 07             	cmp    $0x7,%ecx
+  801d81:	7f 50                	jg     801dd3 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801d83:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801d86:	c1 e2 04             	shl    $0x4,%edx
+  801d89:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801d8f:	8b 52 50             	mov    0x50(%edx),%edx
+  801d92:	83 fa 01             	cmp    $0x1,%edx
+  801d95:	75 dd                	jne    801d74 <fsipc_send+0x36>
+  801d97:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801d9a:	c1 e2 04             	shl    $0x4,%edx
+  801d9d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801da3:	8b 52 54             	mov    0x54(%edx),%edx
+  801da6:	85 d2                	test   %edx,%edx
+  801da8:	74 ca                	je     801d74 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801daa:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801dad:	c1 e2 04             	shl    $0x4,%edx
+  801db0:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801db6:	8b 52 48             	mov    0x48(%edx),%edx
+  801db9:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801dc0:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801dc3:	89 f3                	mov    %esi,%ebx
+  801dc5:	eb ad                	jmp    801d74 <fsipc_send+0x36>
+  801dc7:	84 db                	test   %bl,%bl
+  801dc9:	74 38                	je     801e03 <fsipc_send+0xc5>
+  801dcb:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801dd1:	eb 30                	jmp    801e03 <fsipc_send+0xc5>
+  801dd3:	84 db                	test   %bl,%bl
+  801dd5:	74 2c                	je     801e03 <fsipc_send+0xc5>
+  801dd7:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801ddd:	eb 24                	jmp    801e03 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801ddf:	50                   	push   %eax
+  801de0:	68 80 40 80 00       	push   $0x804080
+  801de5:	6a 34                	push   $0x34
+  801de7:	68 8a 40 80 00       	push   $0x80408a
+  801dec:	e8 6a e4 ff ff       	call   80025b <_panic>
+    }
+    sys_yield();
+  801df1:	e8 fb ee ff ff       	call   800cf1 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801df6:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801dfd:	0f 8e 51 ff ff ff    	jle    801d54 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801e03:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801e08:	8b 70 48             	mov    0x48(%eax),%esi
+  801e0b:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801e11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e16:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801e1c:	39 d9                	cmp    %ebx,%ecx
+  801e1e:	7e d1                	jle    801df1 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801e20:	83 ec 0c             	sub    $0xc,%esp
+  801e23:	ff 75 e0             	push   -0x20(%ebp)
+  801e26:	6a 07                	push   $0x7
+  801e28:	ff 75 e4             	push   -0x1c(%ebp)
+  801e2b:	57                   	push   %edi
+  801e2c:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801e2f:	99                   	cltd
+  801e30:	f7 f9                	idiv   %ecx
+  801e32:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801e39:	e8 cc f1 ff ff       	call   80100a <sys_ipc_try_send>
+      if (r == 0)
+  801e3e:	83 c4 20             	add    $0x20,%esp
+  801e41:	85 c0                	test   %eax,%eax
+  801e43:	74 0a                	je     801e4f <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801e45:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801e48:	75 95                	jne    801ddf <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801e4a:	83 c3 01             	add    $0x1,%ebx
+  801e4d:	eb c7                	jmp    801e16 <fsipc_send+0xd8>
+  }
+}
+  801e4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e52:	5b                   	pop    %ebx
+  801e53:	5e                   	pop    %esi
+  801e54:	5f                   	pop    %edi
+  801e55:	5d                   	pop    %ebp
+  801e56:	c3                   	ret
+
+00801e57 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801e57:	55                   	push   %ebp
+  801e58:	89 e5                	mov    %esp,%ebp
+  801e5a:	53                   	push   %ebx
+  801e5b:	83 ec 14             	sub    $0x14,%esp
+  801e5e:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801e60:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801e67:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e6c:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801e71:	e8 c8 fe ff ff       	call   801d3e <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801e76:	6a 00                	push   $0x0
+  801e78:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e7b:	50                   	push   %eax
+  801e7c:	53                   	push   %ebx
+  801e7d:	6a 00                	push   $0x0
+  801e7f:	e8 b2 f7 ff ff       	call   801636 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801e84:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e87:	c9                   	leave
+  801e88:	c3                   	ret
+
+00801e89 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e89:	55                   	push   %ebp
+  801e8a:	89 e5                	mov    %esp,%ebp
+  801e8c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e92:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e95:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801e9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e9d:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801ea2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea7:	b8 02 00 00 00       	mov    $0x2,%eax
+  801eac:	e8 a6 ff ff ff       	call   801e57 <fsipc>
+}
+  801eb1:	c9                   	leave
+  801eb2:	c3                   	ret
+
+00801eb3 <devfile_flush>:
+{
+  801eb3:	55                   	push   %ebp
+  801eb4:	89 e5                	mov    %esp,%ebp
+  801eb6:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801eb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ebc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ebf:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801ec4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec9:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ece:	e8 84 ff ff ff       	call   801e57 <fsipc>
+}
+  801ed3:	c9                   	leave
+  801ed4:	c3                   	ret
+
+00801ed5 <devfile_stat>:
+{
+  801ed5:	55                   	push   %ebp
+  801ed6:	89 e5                	mov    %esp,%ebp
+  801ed8:	53                   	push   %ebx
+  801ed9:	83 ec 04             	sub    $0x4,%esp
+  801edc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801edf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ee5:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801eea:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eef:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ef4:	e8 5e ff ff ff       	call   801e57 <fsipc>
+  801ef9:	85 c0                	test   %eax,%eax
+  801efb:	78 2c                	js     801f29 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801efd:	83 ec 08             	sub    $0x8,%esp
+  801f00:	68 00 70 80 00       	push   $0x807000
+  801f05:	53                   	push   %ebx
+  801f06:	e8 19 ea ff ff       	call   800924 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801f0b:	a1 80 70 80 00       	mov    0x807080,%eax
+  801f10:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f16:	a1 84 70 80 00       	mov    0x807084,%eax
+  801f1b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801f21:	83 c4 10             	add    $0x10,%esp
+  801f24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f2c:	c9                   	leave
+  801f2d:	c3                   	ret
+
+00801f2e <fsv_alloc>:
+{
+  801f2e:	55                   	push   %ebp
+  801f2f:	89 e5                	mov    %esp,%ebp
+  801f31:	56                   	push   %esi
+  801f32:	53                   	push   %ebx
+  801f33:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801f35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f3a:	eb 22                	jmp    801f5e <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801f3c:	83 ec 04             	sub    $0x4,%esp
+  801f3f:	6a 00                	push   $0x0
+  801f41:	6a 00                	push   $0x0
+  801f43:	6a 07                	push   $0x7
+  801f45:	50                   	push   %eax
+  801f46:	6a 00                	push   $0x0
+  801f48:	6a 04                	push   $0x4
+  801f4a:	68 40 60 80 00       	push   $0x806040
+  801f4f:	e8 52 f2 ff ff       	call   8011a6 <sysbatch_add>
+  801f54:	83 c4 20             	add    $0x20,%esp
+  801f57:	85 c0                	test   %eax,%eax
+  801f59:	78 48                	js     801fa3 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801f5b:	83 c3 01             	add    $0x1,%ebx
+  801f5e:	39 f3                	cmp    %esi,%ebx
+  801f60:	74 31                	je     801f93 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801f62:	89 d8                	mov    %ebx,%eax
+  801f64:	c1 e0 0c             	shl    $0xc,%eax
+  801f67:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801f6c:	89 c2                	mov    %eax,%edx
+  801f6e:	c1 ea 16             	shr    $0x16,%edx
+  801f71:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801f78:	f6 c2 01             	test   $0x1,%dl
+  801f7b:	74 bf                	je     801f3c <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801f7d:	89 c2                	mov    %eax,%edx
+  801f7f:	c1 ea 0c             	shr    $0xc,%edx
+  801f82:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801f89:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801f8c:	83 fa 03             	cmp    $0x3,%edx
+  801f8f:	75 ab                	jne    801f3c <fsv_alloc+0xe>
+  801f91:	eb c8                	jmp    801f5b <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801f93:	83 ec 0c             	sub    $0xc,%esp
+  801f96:	68 40 60 80 00       	push   $0x806040
+  801f9b:	e8 b6 f1 ff ff       	call   801156 <sysbatch_flush>
+  801fa0:	83 c4 10             	add    $0x10,%esp
+}
+  801fa3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fa6:	5b                   	pop    %ebx
+  801fa7:	5e                   	pop    %esi
+  801fa8:	5d                   	pop    %ebp
+  801fa9:	c3                   	ret
+
+00801faa <devfile_read>:
+{
+  801faa:	55                   	push   %ebp
+  801fab:	89 e5                	mov    %esp,%ebp
+  801fad:	57                   	push   %edi
+  801fae:	56                   	push   %esi
+  801faf:	53                   	push   %ebx
+  801fb0:	83 ec 3c             	sub    $0x3c,%esp
+  801fb3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801fb6:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801fbc:	77 57                	ja     802015 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fc1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fc4:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801fc9:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801fcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd4:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fd9:	e8 79 fe ff ff       	call   801e57 <fsipc>
+  801fde:	89 c6                	mov    %eax,%esi
+  801fe0:	85 c0                	test   %eax,%eax
+  801fe2:	78 27                	js     80200b <devfile_read+0x61>
+  assert(r <= n);
+  801fe4:	39 c3                	cmp    %eax,%ebx
+  801fe6:	0f 82 0e 02 00 00    	jb     8021fa <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801fec:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ff1:	0f 8f 1c 02 00 00    	jg     802213 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ff7:	83 ec 04             	sub    $0x4,%esp
+  801ffa:	50                   	push   %eax
+  801ffb:	68 00 70 80 00       	push   $0x807000
+  802000:	ff 75 0c             	push   0xc(%ebp)
+  802003:	e8 a2 ea ff ff       	call   800aaa <memmove>
+  return r;
+  802008:	83 c4 10             	add    $0x10,%esp
+}
+  80200b:	89 f0                	mov    %esi,%eax
+  80200d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802010:	5b                   	pop    %ebx
+  802011:	5e                   	pop    %esi
+  802012:	5f                   	pop    %edi
+  802013:	5d                   	pop    %ebp
+  802014:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  802015:	b8 01 00 00 00       	mov    $0x1,%eax
+  80201a:	e8 0f ff ff ff       	call   801f2e <fsv_alloc>
+  80201f:	89 c6                	mov    %eax,%esi
+  802021:	85 c0                	test   %eax,%eax
+  802023:	78 e6                	js     80200b <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  802025:	8b 45 08             	mov    0x8(%ebp),%eax
+  802028:	8b 40 0c             	mov    0xc(%eax),%eax
+  80202b:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  802030:	8b 45 08             	mov    0x8(%ebp),%eax
+  802033:	8b 40 04             	mov    0x4(%eax),%eax
+  802036:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  80203b:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  802041:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802048:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80204d:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  802052:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802057:	e8 e2 fc ff ff       	call   801d3e <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80205c:	6a 00                	push   $0x0
+  80205e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802061:	50                   	push   %eax
+  802062:	68 00 10 c0 9f       	push   $0x9fc01000
+  802067:	6a 00                	push   $0x0
+  802069:	e8 c8 f5 ff ff       	call   801636 <ipc_recv_pages>
+  80206e:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  802070:	83 c4 10             	add    $0x10,%esp
+  802073:	85 c0                	test   %eax,%eax
+  802075:	7e 94                	jle    80200b <devfile_read+0x61>
+  assert(r <= n);
+  802077:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80207a:	39 c3                	cmp    %eax,%ebx
+  80207c:	72 2e                	jb     8020ac <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  80207e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802081:	8b 40 04             	mov    0x4(%eax),%eax
+  802084:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802089:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  80208c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80208f:	c1 e2 0c             	shl    $0xc,%edx
+  802092:	39 ca                	cmp    %ecx,%edx
+  802094:	72 2f                	jb     8020c5 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  802096:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  80209b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  80209e:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  8020a2:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  8020a7:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  8020aa:	eb 52                	jmp    8020fe <devfile_read+0x154>
+  assert(r <= n);
+  8020ac:	68 95 40 80 00       	push   $0x804095
+  8020b1:	68 9c 40 80 00       	push   $0x80409c
+  8020b6:	68 49 01 00 00       	push   $0x149
+  8020bb:	68 8a 40 80 00       	push   $0x80408a
+  8020c0:	e8 96 e1 ff ff       	call   80025b <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  8020c5:	68 c0 40 80 00       	push   $0x8040c0
+  8020ca:	68 9c 40 80 00       	push   $0x80409c
+  8020cf:	68 4a 01 00 00       	push   $0x14a
+  8020d4:	68 8a 40 80 00       	push   $0x80408a
+  8020d9:	e8 7d e1 ff ff       	call   80025b <_panic>
+      memmove(dst + done, src + done, m);
+  8020de:	83 ec 04             	sub    $0x4,%esp
+  8020e1:	53                   	push   %ebx
+  8020e2:	56                   	push   %esi
+  8020e3:	89 f8                	mov    %edi,%eax
+  8020e5:	03 45 0c             	add    0xc(%ebp),%eax
+  8020e8:	50                   	push   %eax
+  8020e9:	e8 bc e9 ff ff       	call   800aaa <memmove>
+  8020ee:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  8020f1:	01 df                	add    %ebx,%edi
+  8020f3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8020f6:	39 c7                	cmp    %eax,%edi
+  8020f8:	0f 83 c0 00 00 00    	jae    8021be <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  8020fe:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802101:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  802104:	89 f0                	mov    %esi,%eax
+  802106:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80210b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802110:	29 c3                	sub    %eax,%ebx
+  802112:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802115:	29 f8                	sub    %edi,%eax
+  802117:	39 c3                	cmp    %eax,%ebx
+  802119:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  80211c:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802122:	75 ba                	jne    8020de <devfile_read+0x134>
+  802124:	89 f9                	mov    %edi,%ecx
+  802126:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802129:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  80212c:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  802132:	75 aa                	jne    8020de <devfile_read+0x134>
+  802134:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  80213a:	77 a2                	ja     8020de <devfile_read+0x134>
+  80213c:	89 c8                	mov    %ecx,%eax
+  80213e:	c1 e8 16             	shr    $0x16,%eax
+  802141:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802148:	a8 01                	test   $0x1,%al
+  80214a:	74 92                	je     8020de <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  80214c:	89 c8                	mov    %ecx,%eax
+  80214e:	c1 e8 0c             	shr    $0xc,%eax
+  802151:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  802158:	a8 01                	test   $0x1,%al
+  80215a:	74 82                	je     8020de <devfile_read+0x134>
+  80215c:	a9 02 08 00 00       	test   $0x802,%eax
+  802161:	0f 84 77 ff ff ff    	je     8020de <devfile_read+0x134>
+  802167:	f6 c4 04             	test   $0x4,%ah
+  80216a:	0f 85 6e ff ff ff    	jne    8020de <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  802170:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  802175:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  802179:	84 c0                	test   %al,%al
+  80217b:	75 17                	jne    802194 <devfile_read+0x1ea>
+  80217d:	83 ec 08             	sub    $0x8,%esp
+  802180:	6a 01                	push   $0x1
+  802182:	6a 00                	push   $0x0
+  802184:	e8 87 eb ff ff       	call   800d10 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  802189:	83 c4 10             	add    $0x10,%esp
+  80218c:	85 c0                	test   %eax,%eax
+  80218e:	0f 85 4a ff ff ff    	jne    8020de <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  802194:	83 ec 04             	sub    $0x4,%esp
+  802197:	68 05 08 00 00       	push   $0x805
+  80219c:	ff 75 cc             	push   -0x34(%ebp)
+  80219f:	6a 00                	push   $0x0
+  8021a1:	56                   	push   %esi
+  8021a2:	6a 00                	push   $0x0
+  8021a4:	6a 05                	push   $0x5
+  8021a6:	68 40 60 80 00       	push   $0x806040
+  8021ab:	e8 f6 ef ff ff       	call   8011a6 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  8021b0:	c1 e8 1f             	shr    $0x1f,%eax
+  8021b3:	08 45 cb             	or     %al,-0x35(%ebp)
+  8021b6:	83 c4 20             	add    $0x20,%esp
+  8021b9:	e9 33 ff ff ff       	jmp    8020f1 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  8021be:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8021c1:	83 ec 0c             	sub    $0xc,%esp
+  8021c4:	68 40 60 80 00       	push   $0x806040
+  8021c9:	e8 88 ef ff ff       	call   801156 <sysbatch_flush>
+  8021ce:	83 c4 10             	add    $0x10,%esp
+  8021d1:	85 c0                	test   %eax,%eax
+  8021d3:	78 06                	js     8021db <devfile_read+0x231>
+  8021d5:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  8021d9:	74 14                	je     8021ef <devfile_read+0x245>
+    memmove(dst, src, r);
+  8021db:	83 ec 04             	sub    $0x4,%esp
+  8021de:	ff 75 d4             	push   -0x2c(%ebp)
+  8021e1:	ff 75 d0             	push   -0x30(%ebp)
+  8021e4:	ff 75 0c             	push   0xc(%ebp)
+  8021e7:	e8 be e8 ff ff       	call   800aaa <memmove>
+  8021ec:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8021ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f2:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8021f5:	e9 11 fe ff ff       	jmp    80200b <devfile_read+0x61>
+  assert(r <= n);
+  8021fa:	68 95 40 80 00       	push   $0x804095
+  8021ff:	68 9c 40 80 00       	push   $0x80409c
+  802204:	68 1c 01 00 00       	push   $0x11c
+  802209:	68 8a 40 80 00       	push   $0x80408a
+  80220e:	e8 48 e0 ff ff       	call   80025b <_panic>
+  assert(r <= PGSIZE);
+  802213:	68 b1 40 80 00       	push   $0x8040b1
+  802218:	68 9c 40 80 00       	push   $0x80409c
+  80221d:	68 1d 01 00 00       	push   $0x11d
+  802222:	68 8a 40 80 00       	push   $0x80408a
+  802227:	e8 2f e0 ff ff       	call   80025b <_panic>
+
+0080222c <devfile_write>:
+{
+  80222c:	55                   	push   %ebp
+  80222d:	89 e5                	mov    %esp,%ebp
+  80222f:	57                   	push   %edi
+  802230:	56                   	push   %esi
+  802231:	53                   	push   %ebx
+  802232:	83 ec 1c             	sub    $0x1c,%esp
+  802235:	8b 75 08             	mov    0x8(%ebp),%esi
+  802238:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  80223b:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  802240:	77 39                	ja     80227b <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802242:	8b 56 0c             	mov    0xc(%esi),%edx
+  802245:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  80224b:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  802250:	83 ec 04             	sub    $0x4,%esp
+  802253:	50                   	push   %eax
+  802254:	ff 75 0c             	push   0xc(%ebp)
+  802257:	68 08 70 80 00       	push   $0x807008
+  80225c:	e8 49 e8 ff ff       	call   800aaa <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  802261:	ba 00 00 00 00       	mov    $0x0,%edx
+  802266:	b8 04 00 00 00       	mov    $0x4,%eax
+  80226b:	e8 e7 fb ff ff       	call   801e57 <fsipc>
+  802270:	83 c4 10             	add    $0x10,%esp
+}
+  802273:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802276:	5b                   	pop    %ebx
+  802277:	5e                   	pop    %esi
+  802278:	5f                   	pop    %edi
+  802279:	5d                   	pop    %ebp
+  80227a:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  80227b:	ba 00 00 10 00       	mov    $0x100000,%edx
+  802280:	39 d0                	cmp    %edx,%eax
+  802282:	89 d3                	mov    %edx,%ebx
+  802284:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  802287:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  80228d:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  802290:	83 c7 01             	add    $0x1,%edi
+  802293:	89 f8                	mov    %edi,%eax
+  802295:	e8 94 fc ff ff       	call   801f2e <fsv_alloc>
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	78 d5                	js     802273 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80229e:	83 ec 04             	sub    $0x4,%esp
+  8022a1:	53                   	push   %ebx
+  8022a2:	ff 75 0c             	push   0xc(%ebp)
+  8022a5:	68 00 10 c0 9f       	push   $0x9fc01000
+  8022aa:	e8 fb e7 ff ff       	call   800aaa <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  8022af:	8b 46 0c             	mov    0xc(%esi),%eax
+  8022b2:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  8022b7:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  8022bd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8022c4:	89 f9                	mov    %edi,%ecx
+  8022c6:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8022cb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8022d0:	e8 69 fa ff ff       	call   801d3e <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8022d5:	6a 00                	push   $0x0
+  8022d7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022da:	50                   	push   %eax
+  8022db:	6a 00                	push   $0x0
+  8022dd:	6a 00                	push   $0x0
+  8022df:	e8 52 f3 ff ff       	call   801636 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8022e4:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8022e7:	eb 8a                	jmp    802273 <devfile_write+0x47>
+
+008022e9 <open>:
+{
+  8022e9:	55                   	push   %ebp
+  8022ea:	89 e5                	mov    %esp,%ebp
+  8022ec:	56                   	push   %esi
+  8022ed:	53                   	push   %ebx
+  8022ee:	83 ec 1c             	sub    $0x1c,%esp
+  8022f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8022f4:	56                   	push   %esi
+  8022f5:	e8 ef e5 ff ff       	call   8008e9 <strlen>
+  8022fa:	83 c4 10             	add    $0x10,%esp
+  8022fd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802302:	7f 6c                	jg     802370 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802304:	83 ec 0c             	sub    $0xc,%esp
+  802307:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80230a:	50                   	push   %eax
+  80230b:	e8 ad f4 ff ff       	call   8017bd <fd_alloc>
+  802310:	89 c3                	mov    %eax,%ebx
+  802312:	83 c4 10             	add    $0x10,%esp
+  802315:	85 c0                	test   %eax,%eax
+  802317:	78 3c                	js     802355 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  802319:	83 ec 08             	sub    $0x8,%esp
+  80231c:	56                   	push   %esi
+  80231d:	68 00 70 80 00       	push   $0x807000
+  802322:	e8 fd e5 ff ff       	call   800924 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  802327:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80232a:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80232f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802332:	b8 01 00 00 00       	mov    $0x1,%eax
+  802337:	e8 1b fb ff ff       	call   801e57 <fsipc>
+  80233c:	89 c3                	mov    %eax,%ebx
+  80233e:	83 c4 10             	add    $0x10,%esp
+  802341:	85 c0                	test   %eax,%eax
+  802343:	78 19                	js     80235e <open+0x75>
+  return fd2num(fd);
+  802345:	83 ec 0c             	sub    $0xc,%esp
+  802348:	ff 75 f4             	push   -0xc(%ebp)
+  80234b:	e8 49 f4 ff ff       	call   801799 <fd2num>
+  802350:	89 c3                	mov    %eax,%ebx
+  802352:	83 c4 10             	add    $0x10,%esp
+}
+  802355:	89 d8                	mov    %ebx,%eax
+  802357:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80235a:	5b                   	pop    %ebx
+  80235b:	5e                   	pop    %esi
+  80235c:	5d                   	pop    %ebp
+  80235d:	c3                   	ret
+    fd_close(fd, 0);
+  80235e:	83 ec 08             	sub    $0x8,%esp
+  802361:	6a 00                	push   $0x0
+  802363:	ff 75 f4             	push   -0xc(%ebp)
+  802366:	e8 44 f5 ff ff       	call   8018af <fd_close>
+    return r;
+  80236b:	83 c4 10             	add    $0x10,%esp
+  80236e:	eb e5                	jmp    802355 <open+0x6c>
+    return -E_BAD_PATH;
+  802370:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802375:	eb de                	jmp    802355 <open+0x6c>
+
+00802377 <open_read>:
+{
+  802377:	55                   	push   %ebp
+  802378:	89 e5                	mov    %esp,%ebp
+  80237a:	57                   	push   %edi
+  80237b:	56                   	push   %esi
+  80237c:	53                   	push   %ebx
+  80237d:	83 ec 28             	sub    $0x28,%esp
+  802380:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  802383:	57                   	push   %edi
+  802384:	e8 60 e5 ff ff       	call   8008e9 <strlen>
+  802389:	83 c4 10             	add    $0x10,%esp
+  80238c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802391:	0f 87 f6 00 00 00    	ja     80248d <open_read+0x116>
+  802397:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  802399:	83 ec 0c             	sub    $0xc,%esp
+  80239c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80239f:	50                   	push   %eax
+  8023a0:	e8 18 f4 ff ff       	call   8017bd <fd_alloc>
+  8023a5:	89 c3                	mov    %eax,%ebx
+  8023a7:	83 c4 10             	add    $0x10,%esp
+  8023aa:	85 c0                	test   %eax,%eax
+  8023ac:	0f 88 b2 00 00 00    	js     802464 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  8023b2:	83 ec 08             	sub    $0x8,%esp
+  8023b5:	57                   	push   %edi
+  8023b6:	68 e4 70 80 00       	push   $0x8070e4
+  8023bb:	e8 64 e5 ff ff       	call   800924 <strcpy>
+  req->req_nops = 2;
+  8023c0:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  8023c7:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  8023ca:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  8023d1:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8023d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023d7:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  8023dc:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  8023e3:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8023e6:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  8023ed:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8023f0:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  8023f7:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8023fa:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8023ff:	29 f0                	sub    %esi,%eax
+  802401:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802404:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802408:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  80240d:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  802414:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802417:	83 c6 01             	add    $0x1,%esi
+  80241a:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  802420:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802423:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802428:	e8 2a fa ff ff       	call   801e57 <fsipc>
+  80242d:	89 c3                	mov    %eax,%ebx
+  80242f:	83 c4 10             	add    $0x10,%esp
+  802432:	83 f8 01             	cmp    $0x1,%eax
+  802435:	7e 37                	jle    80246e <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  802437:	a1 38 70 80 00       	mov    0x807038,%eax
+  80243c:	8b 55 18             	mov    0x18(%ebp),%edx
+  80243f:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  802441:	83 ec 04             	sub    $0x4,%esp
+  802444:	50                   	push   %eax
+  802445:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  80244b:	56                   	push   %esi
+  80244c:	ff 75 10             	push   0x10(%ebp)
+  80244f:	e8 56 e6 ff ff       	call   800aaa <memmove>
+  return fd2num(fd);
+  802454:	83 c4 04             	add    $0x4,%esp
+  802457:	ff 75 e4             	push   -0x1c(%ebp)
+  80245a:	e8 3a f3 ff ff       	call   801799 <fd2num>
+  80245f:	89 c3                	mov    %eax,%ebx
+  802461:	83 c4 10             	add    $0x10,%esp
+}
+  802464:	89 d8                	mov    %ebx,%eax
+  802466:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802469:	5b                   	pop    %ebx
+  80246a:	5e                   	pop    %esi
+  80246b:	5f                   	pop    %edi
+  80246c:	5d                   	pop    %ebp
+  80246d:	c3                   	ret
+    fd_close(fd, 0);
+  80246e:	83 ec 08             	sub    $0x8,%esp
+  802471:	6a 00                	push   $0x0
+  802473:	ff 75 e4             	push   -0x1c(%ebp)
+  802476:	e8 34 f4 ff ff       	call   8018af <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80247b:	83 c4 10             	add    $0x10,%esp
+  80247e:	85 db                	test   %ebx,%ebx
+  802480:	78 e2                	js     802464 <open_read+0xed>
+  802482:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802485:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  80248b:	eb d7                	jmp    802464 <open_read+0xed>
+    return -E_BAD_PATH;
+  80248d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802492:	eb d0                	jmp    802464 <open_read+0xed>
+
+00802494 <file_stat>:
+{
+  802494:	55                   	push   %ebp
+  802495:	89 e5                	mov    %esp,%ebp
+  802497:	57                   	push   %edi
+  802498:	56                   	push   %esi
+  802499:	53                   	push   %ebx
+  80249a:	83 ec 18             	sub    $0x18,%esp
+  80249d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8024a0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8024a3:	57                   	push   %edi
+  8024a4:	e8 40 e4 ff ff       	call   8008e9 <strlen>
+  8024a9:	83 c4 10             	add    $0x10,%esp
+  8024ac:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024b1:	0f 8f c7 00 00 00    	jg     80257e <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  8024b7:	83 ec 0c             	sub    $0xc,%esp
+  8024ba:	57                   	push   %edi
+  8024bb:	e8 29 e4 ff ff       	call   8008e9 <strlen>
+  8024c0:	8d 58 04             	lea    0x4(%eax),%ebx
+  8024c3:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8024c6:	83 c4 08             	add    $0x8,%esp
+  8024c9:	57                   	push   %edi
+  8024ca:	68 e4 70 80 00       	push   $0x8070e4
+  8024cf:	e8 50 e4 ff ff       	call   800924 <strcpy>
+  req->req_nops = 2;
+  8024d4:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  8024db:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8024de:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  8024e5:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8024e8:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  8024ef:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8024f2:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  8024f9:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8024fc:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  802503:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802506:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  80250d:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802510:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802516:	ba 00 00 00 00       	mov    $0x0,%edx
+  80251b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802520:	e8 32 f9 ff ff       	call   801e57 <fsipc>
+  802525:	83 c4 10             	add    $0x10,%esp
+  802528:	83 f8 01             	cmp    $0x1,%eax
+  80252b:	7e 42                	jle    80256f <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  80252d:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802533:	83 ec 08             	sub    $0x8,%esp
+  802536:	53                   	push   %ebx
+  802537:	56                   	push   %esi
+  802538:	e8 e7 e3 ff ff       	call   800924 <strcpy>
+  st->st_size = ret->ret_size;
+  80253d:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802543:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802549:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80254f:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802555:	c7 86 88 00 00 00 04 	movl   $0x805004,0x88(%esi)
+  80255c:	50 80 00 
+  return 0;
+  80255f:	83 c4 10             	add    $0x10,%esp
+  802562:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802567:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80256a:	5b                   	pop    %ebx
+  80256b:	5e                   	pop    %esi
+  80256c:	5f                   	pop    %edi
+  80256d:	5d                   	pop    %ebp
+  80256e:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80256f:	85 c0                	test   %eax,%eax
+  802571:	78 f4                	js     802567 <file_stat+0xd3>
+  802573:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802576:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  80257c:	eb e9                	jmp    802567 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80257e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802583:	eb e2                	jmp    802567 <file_stat+0xd3>
+
+00802585 <read_map>:
+{
+  802585:	55                   	push   %ebp
+  802586:	89 e5                	mov    %esp,%ebp
+  802588:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80258b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80258e:	50                   	push   %eax
+  80258f:	ff 75 08             	push   0x8(%ebp)
+  802592:	e8 7c f2 ff ff       	call   801813 <fd_lookup>
+  802597:	83 c4 10             	add    $0x10,%esp
+  80259a:	85 c0                	test   %eax,%eax
+  80259c:	78 2a                	js     8025c8 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80259e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025a1:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8025a7:	39 08                	cmp    %ecx,(%eax)
+  8025a9:	75 1f                	jne    8025ca <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8025ab:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025ae:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  8025b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025b6:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8025bb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8025be:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8025c3:	e8 8f f8 ff ff       	call   801e57 <fsipc>
+}
+  8025c8:	c9                   	leave
+  8025c9:	c3                   	ret
+    return -E_INVAL;
+  8025ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025cf:	eb f7                	jmp    8025c8 <read_map+0x43>
+
+008025d1 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8025d1:	55                   	push   %ebp
+  8025d2:	89 e5                	mov    %esp,%ebp
+  8025d4:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8025d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025dc:	b8 08 00 00 00       	mov    $0x8,%eax
+  8025e1:	e8 71 f8 ff ff       	call   801e57 <fsipc>
+}
+  8025e6:	c9                   	leave
+  8025e7:	c3                   	ret
+
+008025e8 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8025e8:	55                   	push   %ebp
+  8025e9:	89 e5                	mov    %esp,%ebp
+  8025eb:	57                   	push   %edi
+  8025ec:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8025ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f0:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8025f5:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8025fc:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8025ff:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802606:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802609:	ba 00 00 00 00       	mov    $0x0,%edx
+  80260e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802613:	e8 3f f8 ff ff       	call   801e57 <fsipc>
+  802618:	85 c0                	test   %eax,%eax
+  80261a:	78 14                	js     802630 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  80261c:	be 00 70 80 00       	mov    $0x807000,%esi
+  802621:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802626:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802629:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  80262b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802630:	5e                   	pop    %esi
+  802631:	5f                   	pop    %edi
+  802632:	5d                   	pop    %ebp
+  802633:	c3                   	ret
+
+00802634 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802634:	55                   	push   %ebp
+  802635:	89 e5                	mov    %esp,%ebp
+  802637:	53                   	push   %ebx
+  802638:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  80263b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80263e:	50                   	push   %eax
+  80263f:	6a 00                	push   $0x0
+  802641:	e8 a2 ff ff ff       	call   8025e8 <fs_stats>
+  802646:	83 c4 10             	add    $0x10,%esp
+  802649:	85 c0                	test   %eax,%eax
+  80264b:	78 28                	js     802675 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  80264d:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802650:	83 ec 08             	sub    $0x8,%esp
+  802653:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802656:	50                   	push   %eax
+  802657:	6a 20                	push   $0x20
+  802659:	e8 8a ff ff ff       	call   8025e8 <fs_stats>
+  80265e:	83 c4 10             	add    $0x10,%esp
+  802661:	85 c0                	test   %eax,%eax
+  802663:	78 10                	js     802675 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802665:	83 ec 08             	sub    $0x8,%esp
+  802668:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80266b:	50                   	push   %eax
+  80266c:	53                   	push   %ebx
+  80266d:	e8 76 ff ff ff       	call   8025e8 <fs_stats>
+  802672:	83 c4 10             	add    $0x10,%esp
+}
+  802675:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802678:	c9                   	leave
+  802679:	c3                   	ret
+
+0080267a <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  80267a:	55                   	push   %ebp
+  80267b:	89 e5                	mov    %esp,%ebp
+  80267d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802680:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802687:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  80268a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80268d:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  802692:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802699:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80269c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8026a6:	e8 ac f7 ff ff       	call   801e57 <fsipc>
+}
+  8026ab:	c9                   	leave
+  8026ac:	c3                   	ret
+
+008026ad <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8026ad:	55                   	push   %ebp
+  8026ae:	89 e5                	mov    %esp,%ebp
+  8026b0:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8026b3:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8026ba:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8026bd:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8026c4:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8026c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ca:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  8026cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026d4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8026d9:	e8 79 f7 ff ff       	call   801e57 <fsipc>
+}
+  8026de:	c9                   	leave
+  8026df:	c3                   	ret
+
+008026e0 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8026e0:	55                   	push   %ebp
+  8026e1:	89 e5                	mov    %esp,%ebp
+  8026e3:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026e9:	50                   	push   %eax
+  8026ea:	ff 75 08             	push   0x8(%ebp)
+  8026ed:	e8 21 f1 ff ff       	call   801813 <fd_lookup>
+  8026f2:	83 c4 10             	add    $0x10,%esp
+  8026f5:	85 c0                	test   %eax,%eax
+  8026f7:	78 34                	js     80272d <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8026f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026fc:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802702:	39 08                	cmp    %ecx,(%eax)
+  802704:	75 29                	jne    80272f <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802706:	8b 40 0c             	mov    0xc(%eax),%eax
+  802709:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  80270e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802711:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  802716:	8b 45 10             	mov    0x10(%ebp),%eax
+  802719:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  80271e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802723:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802728:	e8 2a f7 ff ff       	call   801e57 <fsipc>
+}
+  80272d:	c9                   	leave
+  80272e:	c3                   	ret
+    return -E_INVAL;
+  80272f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802734:	eb f7                	jmp    80272d <fallocate+0x4d>
+
+00802736 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802736:	55                   	push   %ebp
+  802737:	89 e5                	mov    %esp,%ebp
+  802739:	57                   	push   %edi
+  80273a:	56                   	push   %esi
+  80273b:	53                   	push   %ebx
+  80273c:	83 ec 24             	sub    $0x24,%esp
+  80273f:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802742:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802745:	50                   	push   %eax
+  802746:	ff 75 08             	push   0x8(%ebp)
+  802749:	e8 c5 f0 ff ff       	call   801813 <fd_lookup>
+  80274e:	83 c4 10             	add    $0x10,%esp
+  802751:	85 c0                	test   %eax,%eax
+  802753:	78 66                	js     8027bb <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802755:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802758:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80275e:	39 08                	cmp    %ecx,(%eax)
+  802760:	75 61                	jne    8027c3 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802762:	85 f6                	test   %esi,%esi
+  802764:	7e 50                	jle    8027b6 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802766:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80276b:	39 de                	cmp    %ebx,%esi
+  80276d:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802770:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802773:	8b 40 0c             	mov    0xc(%eax),%eax
+  802776:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  80277b:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802781:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802788:	83 ec 04             	sub    $0x4,%esp
+  80278b:	57                   	push   %edi
+  80278c:	ff 75 0c             	push   0xc(%ebp)
+  80278f:	68 08 70 80 00       	push   $0x807008
+  802794:	e8 11 e3 ff ff       	call   800aaa <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802799:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8027a3:	e8 af f6 ff ff       	call   801e57 <fsipc>
+  8027a8:	83 c4 10             	add    $0x10,%esp
+  8027ab:	85 c0                	test   %eax,%eax
+  8027ad:	78 0c                	js     8027bb <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8027af:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8027b2:	29 de                	sub    %ebx,%esi
+  8027b4:	eb ac                	jmp    802762 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8027b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027be:	5b                   	pop    %ebx
+  8027bf:	5e                   	pop    %esi
+  8027c0:	5f                   	pop    %edi
+  8027c1:	5d                   	pop    %ebp
+  8027c2:	c3                   	ret
+    return -E_INVAL;
+  8027c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027c8:	eb f1                	jmp    8027bb <prefetch+0x85>
+
+008027ca <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8027ca:	55                   	push   %ebp
+  8027cb:	89 e5                	mov    %esp,%ebp
+  8027cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8027d0:	89 c2                	mov    %eax,%edx
+  8027d2:	c1 ea 16             	shr    $0x16,%edx
+  8027d5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  8027dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8027e1:	f6 c1 01             	test   $0x1,%cl
+  8027e4:	74 1c                	je     802802 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  8027e6:	c1 e8 0c             	shr    $0xc,%eax
+  8027e9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  8027f0:	a8 01                	test   $0x1,%al
+  8027f2:	74 0e                	je     802802 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  8027f4:	c1 e8 0c             	shr    $0xc,%eax
+  8027f7:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8027fe:	ef 
+  8027ff:	0f b7 d2             	movzwl %dx,%edx
+}
+  802802:	89 d0                	mov    %edx,%eax
+  802804:	5d                   	pop    %ebp
+  802805:	c3                   	ret
+
+00802806 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802806:	55                   	push   %ebp
+  802807:	89 e5                	mov    %esp,%ebp
+  802809:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80280c:	50                   	push   %eax
+  80280d:	e8 97 ef ff ff       	call   8017a9 <fd2data>
+  802812:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802817:	c9                   	leave
+  802818:	c3                   	ret
+
+00802819 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802819:	55                   	push   %ebp
+  80281a:	89 e5                	mov    %esp,%ebp
+  80281c:	56                   	push   %esi
+  80281d:	53                   	push   %ebx
+  80281e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802821:	83 ec 0c             	sub    $0xc,%esp
+  802824:	ff 75 08             	push   0x8(%ebp)
+  802827:	e8 7d ef ff ff       	call   8017a9 <fd2data>
+  80282c:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80282e:	83 c4 08             	add    $0x8,%esp
+  802831:	68 ec 40 80 00       	push   $0x8040ec
+  802836:	53                   	push   %ebx
+  802837:	e8 e8 e0 ff ff       	call   800924 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  80283c:	8b 46 04             	mov    0x4(%esi),%eax
+  80283f:	2b 06                	sub    (%esi),%eax
+  802841:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802847:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80284e:	00 00 00 
+  stat->st_dev = &devpipe;
+  802851:	c7 83 88 00 00 00 20 	movl   $0x805020,0x88(%ebx)
+  802858:	50 80 00 
+  return 0;
+}
+  80285b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802860:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802863:	5b                   	pop    %ebx
+  802864:	5e                   	pop    %esi
+  802865:	5d                   	pop    %ebp
+  802866:	c3                   	ret
+
+00802867 <pipe_wakeup>:
+{
+  802867:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286e:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802871:	85 c0                	test   %eax,%eax
+  802873:	75 01                	jne    802876 <pipe_wakeup+0xf>
+  802875:	c3                   	ret
+{
+  802876:	55                   	push   %ebp
+  802877:	89 e5                	mov    %esp,%ebp
+  802879:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  80287c:	6a 00                	push   $0x0
+  80287e:	68 00 00 c0 ee       	push   $0xeec00000
+  802883:	52                   	push   %edx
+  802884:	e8 26 e8 ff ff       	call   8010af <sys_chan_wakeup>
+  802889:	83 c4 10             	add    $0x10,%esp
+}
+  80288c:	c9                   	leave
+  80288d:	c3                   	ret
+
+0080288e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80288e:	55                   	push   %ebp
+  80288f:	89 e5                	mov    %esp,%ebp
+  802891:	57                   	push   %edi
+  802892:	56                   	push   %esi
+  802893:	53                   	push   %ebx
+  802894:	83 ec 18             	sub    $0x18,%esp
+  802897:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80289a:	57                   	push   %edi
+  80289b:	e8 09 ef ff ff       	call   8017a9 <fd2data>
+  8028a0:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8028a2:	83 c4 10             	add    $0x10,%esp
+  8028a5:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8028a9:	74 2a                	je     8028d5 <devpipe_close+0x47>
+  8028ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8028b0:	89 f8                	mov    %edi,%eax
+  8028b2:	e8 4f ff ff ff       	call   802806 <pipe_ring>
+  8028b7:	83 ec 08             	sub    $0x8,%esp
+  8028ba:	01 d8                	add    %ebx,%eax
+  8028bc:	50                   	push   %eax
+  8028bd:	6a 00                	push   $0x0
+  8028bf:	e8 14 e5 ff ff       	call   800dd8 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8028c4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8028ca:	83 c4 10             	add    $0x10,%esp
+  8028cd:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8028d3:	75 db                	jne    8028b0 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8028d5:	83 ec 08             	sub    $0x8,%esp
+  8028d8:	57                   	push   %edi
+  8028d9:	6a 00                	push   $0x0
+  8028db:	e8 f8 e4 ff ff       	call   800dd8 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8028e0:	83 c4 10             	add    $0x10,%esp
+  8028e3:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8028e7:	75 13                	jne    8028fc <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8028e9:	83 ec 08             	sub    $0x8,%esp
+  8028ec:	56                   	push   %esi
+  8028ed:	6a 00                	push   $0x0
+  8028ef:	e8 e4 e4 ff ff       	call   800dd8 <sys_page_unmap>
+}
+  8028f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028f7:	5b                   	pop    %ebx
+  8028f8:	5e                   	pop    %esi
+  8028f9:	5f                   	pop    %edi
+  8028fa:	5d                   	pop    %ebp
+  8028fb:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8028fc:	8d 56 04             	lea    0x4(%esi),%edx
+  8028ff:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802902:	e8 60 ff ff ff       	call   802867 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802907:	8d 46 30             	lea    0x30(%esi),%eax
+  80290a:	89 f2                	mov    %esi,%edx
+  80290c:	e8 56 ff ff ff       	call   802867 <pipe_wakeup>
+  802911:	eb d6                	jmp    8028e9 <devpipe_close+0x5b>
+
+00802913 <_pipeisclosed>:
+{
+  802913:	55                   	push   %ebp
+  802914:	89 e5                	mov    %esp,%ebp
+  802916:	57                   	push   %edi
+  802917:	56                   	push   %esi
+  802918:	53                   	push   %ebx
+  802919:	83 ec 1c             	sub    $0x1c,%esp
+  80291c:	89 c7                	mov    %eax,%edi
+  80291e:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802920:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  802925:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802928:	83 ec 0c             	sub    $0xc,%esp
+  80292b:	57                   	push   %edi
+  80292c:	e8 99 fe ff ff       	call   8027ca <pageref>
+  802931:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802934:	89 34 24             	mov    %esi,(%esp)
+  802937:	e8 8e fe ff ff       	call   8027ca <pageref>
+    nn = thisenv->env_runs;
+  80293c:	8b 15 a0 68 80 00    	mov    0x8068a0,%edx
+  802942:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802945:	83 c4 10             	add    $0x10,%esp
+  802948:	39 cb                	cmp    %ecx,%ebx
+  80294a:	74 1b                	je     802967 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  80294c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80294f:	75 cf                	jne    802920 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802951:	8b 42 58             	mov    0x58(%edx),%eax
+  802954:	6a 01                	push   $0x1
+  802956:	50                   	push   %eax
+  802957:	53                   	push   %ebx
+  802958:	68 f3 40 80 00       	push   $0x8040f3
+  80295d:	e8 d4 d9 ff ff       	call   800336 <cprintf>
+  802962:	83 c4 10             	add    $0x10,%esp
+  802965:	eb b9                	jmp    802920 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802967:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80296a:	0f 94 c0             	sete   %al
+  80296d:	0f b6 c0             	movzbl %al,%eax
+}
+  802970:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802973:	5b                   	pop    %ebx
+  802974:	5e                   	pop    %esi
+  802975:	5f                   	pop    %edi
+  802976:	5d                   	pop    %ebp
+  802977:	c3                   	ret
+
+00802978 <devpipe_write_bulk>:
+{
+  802978:	55                   	push   %ebp
+  802979:	89 e5                	mov    %esp,%ebp
+  80297b:	57                   	push   %edi
+  80297c:	56                   	push   %esi
+  80297d:	53                   	push   %ebx
+  80297e:	83 ec 1c             	sub    $0x1c,%esp
+  802981:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802984:	89 d6                	mov    %edx,%esi
+  802986:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802989:	e8 78 fe ff ff       	call   802806 <pipe_ring>
+  80298e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802991:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802996:	8d 46 04             	lea    0x4(%esi),%eax
+  802999:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80299c:	eb 75                	jmp    802a13 <devpipe_write_bulk+0x9b>
+  80299e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029a3:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8029a7:	6a 64                	push   $0x64
+  8029a9:	68 00 00 c0 ee       	push   $0xeec00000
+  8029ae:	53                   	push   %ebx
+  8029af:	56                   	push   %esi
+  8029b0:	e8 d7 e6 ff ff       	call   80108c <sys_chan_sleep>
+      continue;
+  8029b5:	83 c4 10             	add    $0x10,%esp
+  8029b8:	eb 59                	jmp    802a13 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8029ba:	89 d1                	mov    %edx,%ecx
+  8029bc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029bf:	c1 e9 11             	shr    $0x11,%ecx
+  8029c2:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8029c5:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8029ca:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  8029cc:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8029d2:	29 d3                	sub    %edx,%ebx
+  8029d4:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8029d9:	29 c2                	sub    %eax,%edx
+  8029db:	39 d3                	cmp    %edx,%ebx
+  8029dd:	0f 47 da             	cmova  %edx,%ebx
+  8029e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029e3:	29 fa                	sub    %edi,%edx
+  8029e5:	39 d3                	cmp    %edx,%ebx
+  8029e7:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8029ea:	83 ec 04             	sub    $0x4,%esp
+  8029ed:	53                   	push   %ebx
+  8029ee:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8029f1:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  8029f4:	52                   	push   %edx
+  8029f5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8029f8:	01 c8                	add    %ecx,%eax
+  8029fa:	50                   	push   %eax
+  8029fb:	e8 0c e1 ff ff       	call   800b0c <memcpy>
+    i += m;
+  802a00:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802a02:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802a05:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802a08:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802a0b:	e8 57 fe ff ff       	call   802867 <pipe_wakeup>
+  802a10:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802a13:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802a16:	73 2b                	jae    802a43 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802a18:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802a1a:	8b 56 04             	mov    0x4(%esi),%edx
+  802a1d:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802a23:	39 d0                	cmp    %edx,%eax
+  802a25:	7d 93                	jge    8029ba <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802a27:	89 f2                	mov    %esi,%edx
+  802a29:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802a2c:	e8 e2 fe ff ff       	call   802913 <_pipeisclosed>
+  802a31:	85 c0                	test   %eax,%eax
+  802a33:	0f 84 65 ff ff ff    	je     80299e <devpipe_write_bulk+0x26>
+        return i;
+  802a39:	89 f8                	mov    %edi,%eax
+}
+  802a3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a3e:	5b                   	pop    %ebx
+  802a3f:	5e                   	pop    %esi
+  802a40:	5f                   	pop    %edi
+  802a41:	5d                   	pop    %ebp
+  802a42:	c3                   	ret
+  return i;
+  802a43:	89 f8                	mov    %edi,%eax
+  802a45:	eb f4                	jmp    802a3b <devpipe_write_bulk+0xc3>
+
+00802a47 <devpipe_write>:
+{
+  802a47:	55                   	push   %ebp
+  802a48:	89 e5                	mov    %esp,%ebp
+  802a4a:	57                   	push   %edi
+  802a4b:	56                   	push   %esi
+  802a4c:	53                   	push   %ebx
+  802a4d:	83 ec 28             	sub    $0x28,%esp
+  802a50:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802a53:	56                   	push   %esi
+  802a54:	e8 50 ed ff ff       	call   8017a9 <fd2data>
+  802a59:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802a5b:	8b 78 28             	mov    0x28(%eax),%edi
+  802a5e:	83 c4 10             	add    $0x10,%esp
+  802a61:	85 ff                	test   %edi,%edi
+  802a63:	75 25                	jne    802a8a <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802a65:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802a68:	74 66                	je     802ad0 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802a6a:	8b 43 04             	mov    0x4(%ebx),%eax
+  802a6d:	8b 0b                	mov    (%ebx),%ecx
+  802a6f:	8d 51 20             	lea    0x20(%ecx),%edx
+  802a72:	39 d0                	cmp    %edx,%eax
+  802a74:	72 2b                	jb     802aa1 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802a76:	89 da                	mov    %ebx,%edx
+  802a78:	89 f0                	mov    %esi,%eax
+  802a7a:	e8 94 fe ff ff       	call   802913 <_pipeisclosed>
+  802a7f:	85 c0                	test   %eax,%eax
+  802a81:	75 51                	jne    802ad4 <devpipe_write+0x8d>
+      sys_yield();
+  802a83:	e8 69 e2 ff ff       	call   800cf1 <sys_yield>
+  802a88:	eb e0                	jmp    802a6a <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802a8a:	83 ec 0c             	sub    $0xc,%esp
+  802a8d:	ff 75 10             	push   0x10(%ebp)
+  802a90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a93:	89 c2                	mov    %eax,%edx
+  802a95:	89 f0                	mov    %esi,%eax
+  802a97:	e8 dc fe ff ff       	call   802978 <devpipe_write_bulk>
+  802a9c:	83 c4 10             	add    $0x10,%esp
+  802a9f:	eb 38                	jmp    802ad9 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802aa1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802aa4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802aa8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802aab:	89 c2                	mov    %eax,%edx
+  802aad:	c1 fa 1f             	sar    $0x1f,%edx
+  802ab0:	89 d1                	mov    %edx,%ecx
+  802ab2:	c1 e9 1b             	shr    $0x1b,%ecx
+  802ab5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802ab8:	83 e2 1f             	and    $0x1f,%edx
+  802abb:	29 ca                	sub    %ecx,%edx
+  802abd:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802ac1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802ac5:	83 c0 01             	add    $0x1,%eax
+  802ac8:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802acb:	83 c7 01             	add    $0x1,%edi
+  802ace:	eb 95                	jmp    802a65 <devpipe_write+0x1e>
+  return i;
+  802ad0:	89 f8                	mov    %edi,%eax
+  802ad2:	eb 05                	jmp    802ad9 <devpipe_write+0x92>
+        return 0;
+  802ad4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ad9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802adc:	5b                   	pop    %ebx
+  802add:	5e                   	pop    %esi
+  802ade:	5f                   	pop    %edi
+  802adf:	5d                   	pop    %ebp
+  802ae0:	c3                   	ret
+
+00802ae1 <devpipe_read_bulk>:
+{
+  802ae1:	55                   	push   %ebp
+  802ae2:	89 e5                	mov    %esp,%ebp
+  802ae4:	57                   	push   %edi
+  802ae5:	56                   	push   %esi
+  802ae6:	53                   	push   %ebx
+  802ae7:	83 ec 2c             	sub    $0x2c,%esp
+  802aea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802aed:	89 d6                	mov    %edx,%esi
+  802aef:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802af2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802af5:	e8 0c fd ff ff       	call   802806 <pipe_ring>
+  802afa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802afd:	85 db                	test   %ebx,%ebx
+  802aff:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b04:	0f 45 c3             	cmovne %ebx,%eax
+  802b07:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802b0a:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802b0f:	8d 46 30             	lea    0x30(%esi),%eax
+  802b12:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802b15:	eb 50                	jmp    802b67 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802b17:	89 d1                	mov    %edx,%ecx
+  802b19:	c1 f9 1f             	sar    $0x1f,%ecx
+  802b1c:	c1 e9 11             	shr    $0x11,%ecx
+  802b1f:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802b22:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802b27:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802b29:	29 d3                	sub    %edx,%ebx
+  802b2b:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802b30:	29 c2                	sub    %eax,%edx
+  802b32:	39 d3                	cmp    %edx,%ebx
+  802b34:	0f 47 da             	cmova  %edx,%ebx
+  802b37:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b3a:	29 fa                	sub    %edi,%edx
+  802b3c:	39 d3                	cmp    %edx,%ebx
+  802b3e:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802b41:	83 ec 04             	sub    $0x4,%esp
+  802b44:	53                   	push   %ebx
+  802b45:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b48:	01 c8                	add    %ecx,%eax
+  802b4a:	50                   	push   %eax
+  802b4b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802b4e:	01 f8                	add    %edi,%eax
+  802b50:	50                   	push   %eax
+  802b51:	e8 b6 df ff ff       	call   800b0c <memcpy>
+    i += m;
+  802b56:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802b58:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802b5a:	89 f2                	mov    %esi,%edx
+  802b5c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802b5f:	e8 03 fd ff ff       	call   802867 <pipe_wakeup>
+  802b64:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802b67:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802b6a:	73 51                	jae    802bbd <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802b6c:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802b6f:	8b 16                	mov    (%esi),%edx
+  802b71:	39 da                	cmp    %ebx,%edx
+  802b73:	75 a2                	jne    802b17 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802b75:	85 ff                	test   %edi,%edi
+  802b77:	75 44                	jne    802bbd <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802b79:	89 f2                	mov    %esi,%edx
+  802b7b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b7e:	e8 90 fd ff ff       	call   802913 <_pipeisclosed>
+  802b83:	85 c0                	test   %eax,%eax
+  802b85:	75 3a                	jne    802bc1 <devpipe_read_bulk+0xe0>
+  802b87:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b8c:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802b90:	6a 64                	push   $0x64
+  802b92:	ff 75 d4             	push   -0x2c(%ebp)
+  802b95:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802b96:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802b99:	50                   	push   %eax
+  802b9a:	e8 ed e4 ff ff       	call   80108c <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802b9f:	85 c0                	test   %eax,%eax
+  802ba1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ba6:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802ba9:	83 c4 10             	add    $0x10,%esp
+  802bac:	a8 01                	test   $0x1,%al
+  802bae:	74 b7                	je     802b67 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802bb0:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802bb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bb8:	5b                   	pop    %ebx
+  802bb9:	5e                   	pop    %esi
+  802bba:	5f                   	pop    %edi
+  802bbb:	5d                   	pop    %ebp
+  802bbc:	c3                   	ret
+  return i;
+  802bbd:	89 f8                	mov    %edi,%eax
+  802bbf:	eb f4                	jmp    802bb5 <devpipe_read_bulk+0xd4>
+        return 0;
+  802bc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc6:	eb ed                	jmp    802bb5 <devpipe_read_bulk+0xd4>
+
+00802bc8 <devpipe_read>:
+{
+  802bc8:	55                   	push   %ebp
+  802bc9:	89 e5                	mov    %esp,%ebp
+  802bcb:	57                   	push   %edi
+  802bcc:	56                   	push   %esi
+  802bcd:	53                   	push   %ebx
+  802bce:	83 ec 18             	sub    $0x18,%esp
+  802bd1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802bd4:	57                   	push   %edi
+  802bd5:	e8 cf eb ff ff       	call   8017a9 <fd2data>
+  802bda:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802bdc:	8b 70 28             	mov    0x28(%eax),%esi
+  802bdf:	83 c4 10             	add    $0x10,%esp
+  802be2:	85 f6                	test   %esi,%esi
+  802be4:	75 24                	jne    802c0a <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802be6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802be9:	74 60                	je     802c4b <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802beb:	8b 03                	mov    (%ebx),%eax
+  802bed:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802bf0:	75 3b                	jne    802c2d <devpipe_read+0x65>
+      if (i > 0)
+  802bf2:	85 f6                	test   %esi,%esi
+  802bf4:	75 2d                	jne    802c23 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802bf6:	89 da                	mov    %ebx,%edx
+  802bf8:	89 f8                	mov    %edi,%eax
+  802bfa:	e8 14 fd ff ff       	call   802913 <_pipeisclosed>
+  802bff:	85 c0                	test   %eax,%eax
+  802c01:	75 4c                	jne    802c4f <devpipe_read+0x87>
+      sys_yield();
+  802c03:	e8 e9 e0 ff ff       	call   800cf1 <sys_yield>
+  802c08:	eb e1                	jmp    802beb <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802c0a:	83 ec 08             	sub    $0x8,%esp
+  802c0d:	6a 00                	push   $0x0
+  802c0f:	ff 75 10             	push   0x10(%ebp)
+  802c12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c15:	89 c2                	mov    %eax,%edx
+  802c17:	89 f8                	mov    %edi,%eax
+  802c19:	e8 c3 fe ff ff       	call   802ae1 <devpipe_read_bulk>
+  802c1e:	83 c4 10             	add    $0x10,%esp
+  802c21:	eb 02                	jmp    802c25 <devpipe_read+0x5d>
+        return i;
+  802c23:	89 f0                	mov    %esi,%eax
+}
+  802c25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c28:	5b                   	pop    %ebx
+  802c29:	5e                   	pop    %esi
+  802c2a:	5f                   	pop    %edi
+  802c2b:	5d                   	pop    %ebp
+  802c2c:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802c2d:	99                   	cltd
+  802c2e:	c1 ea 1b             	shr    $0x1b,%edx
+  802c31:	01 d0                	add    %edx,%eax
+  802c33:	83 e0 1f             	and    $0x1f,%eax
+  802c36:	29 d0                	sub    %edx,%eax
+  802c38:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802c3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c40:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802c43:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802c46:	83 c6 01             	add    $0x1,%esi
+  802c49:	eb 9b                	jmp    802be6 <devpipe_read+0x1e>
+  return i;
+  802c4b:	89 f0                	mov    %esi,%eax
+  802c4d:	eb d6                	jmp    802c25 <devpipe_read+0x5d>
+        return 0;
+  802c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c54:	eb cf                	jmp    802c25 <devpipe_read+0x5d>
+
+00802c56 <pipe2>:
+{
+  802c56:	55                   	push   %ebp
+  802c57:	89 e5                	mov    %esp,%ebp
+  802c59:	57                   	push   %edi
+  802c5a:	56                   	push   %esi
+  802c5b:	53                   	push   %ebx
+  802c5c:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802c5f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802c62:	50                   	push   %eax
+  802c63:	e8 55 eb ff ff       	call   8017bd <fd_alloc>
+  802c68:	89 c3                	mov    %eax,%ebx
+  802c6a:	83 c4 10             	add    $0x10,%esp
+  802c6d:	85 c0                	test   %eax,%eax
+  802c6f:	0f 88 fb 01 00 00    	js     802e70 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c75:	83 ec 04             	sub    $0x4,%esp
+  802c78:	68 07 04 00 00       	push   $0x407
+  802c7d:	ff 75 e4             	push   -0x1c(%ebp)
+  802c80:	6a 00                	push   $0x0
+  802c82:	e8 cc e0 ff ff       	call   800d53 <sys_page_alloc>
+  802c87:	89 c3                	mov    %eax,%ebx
+  802c89:	83 c4 10             	add    $0x10,%esp
+  802c8c:	85 c0                	test   %eax,%eax
+  802c8e:	0f 88 dc 01 00 00    	js     802e70 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802c94:	83 ec 0c             	sub    $0xc,%esp
+  802c97:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802c9a:	50                   	push   %eax
+  802c9b:	e8 1d eb ff ff       	call   8017bd <fd_alloc>
+  802ca0:	89 c3                	mov    %eax,%ebx
+  802ca2:	83 c4 10             	add    $0x10,%esp
+  802ca5:	85 c0                	test   %eax,%eax
+  802ca7:	0f 88 b3 01 00 00    	js     802e60 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cad:	83 ec 04             	sub    $0x4,%esp
+  802cb0:	68 07 04 00 00       	push   $0x407
+  802cb5:	ff 75 e0             	push   -0x20(%ebp)
+  802cb8:	6a 00                	push   $0x0
+  802cba:	e8 94 e0 ff ff       	call   800d53 <sys_page_alloc>
+  802cbf:	89 c3                	mov    %eax,%ebx
+  802cc1:	83 c4 10             	add    $0x10,%esp
+  802cc4:	85 c0                	test   %eax,%eax
+  802cc6:	0f 88 94 01 00 00    	js     802e60 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802ccc:	83 ec 0c             	sub    $0xc,%esp
+  802ccf:	ff 75 e4             	push   -0x1c(%ebp)
+  802cd2:	e8 d2 ea ff ff       	call   8017a9 <fd2data>
+  802cd7:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cd9:	83 c4 0c             	add    $0xc,%esp
+  802cdc:	68 07 04 00 00       	push   $0x407
+  802ce1:	50                   	push   %eax
+  802ce2:	6a 00                	push   $0x0
+  802ce4:	e8 6a e0 ff ff       	call   800d53 <sys_page_alloc>
+  802ce9:	89 c3                	mov    %eax,%ebx
+  802ceb:	83 c4 10             	add    $0x10,%esp
+  802cee:	85 c0                	test   %eax,%eax
+  802cf0:	0f 88 5a 01 00 00    	js     802e50 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cf6:	83 ec 0c             	sub    $0xc,%esp
+  802cf9:	ff 75 e0             	push   -0x20(%ebp)
+  802cfc:	e8 a8 ea ff ff       	call   8017a9 <fd2data>
+  802d01:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802d08:	50                   	push   %eax
+  802d09:	6a 00                	push   $0x0
+  802d0b:	57                   	push   %edi
+  802d0c:	6a 00                	push   $0x0
+  802d0e:	e8 83 e0 ff ff       	call   800d96 <sys_page_map>
+  802d13:	89 c3                	mov    %eax,%ebx
+  802d15:	83 c4 20             	add    $0x20,%esp
+  802d18:	85 c0                	test   %eax,%eax
+  802d1a:	0f 88 22 01 00 00    	js     802e42 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802d20:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802d24:	74 72                	je     802d98 <pipe2+0x142>
+  802d26:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802d2b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d2e:	e8 d3 fa ff ff       	call   802806 <pipe_ring>
+  802d33:	83 ec 04             	sub    $0x4,%esp
+  802d36:	68 07 04 00 00       	push   $0x407
+  802d3b:	01 f0                	add    %esi,%eax
+  802d3d:	50                   	push   %eax
+  802d3e:	6a 00                	push   $0x0
+  802d40:	e8 0e e0 ff ff       	call   800d53 <sys_page_alloc>
+  802d45:	89 c3                	mov    %eax,%ebx
+  802d47:	83 c4 10             	add    $0x10,%esp
+  802d4a:	85 c0                	test   %eax,%eax
+  802d4c:	0f 88 97 00 00 00    	js     802de9 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802d52:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802d55:	e8 ac fa ff ff       	call   802806 <pipe_ring>
+  802d5a:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802d5d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d60:	e8 a1 fa ff ff       	call   802806 <pipe_ring>
+  802d65:	83 ec 0c             	sub    $0xc,%esp
+  802d68:	68 07 04 00 00       	push   $0x407
+  802d6d:	53                   	push   %ebx
+  802d6e:	6a 00                	push   $0x0
+  802d70:	01 f0                	add    %esi,%eax
+  802d72:	50                   	push   %eax
+  802d73:	6a 00                	push   $0x0
+  802d75:	e8 1c e0 ff ff       	call   800d96 <sys_page_map>
+  802d7a:	89 c3                	mov    %eax,%ebx
+  802d7c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802d82:	83 c4 20             	add    $0x20,%esp
+  802d85:	85 c0                	test   %eax,%eax
+  802d87:	78 60                	js     802de9 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802d89:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802d8f:	75 9a                	jne    802d2b <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802d91:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802d98:	a1 20 50 80 00       	mov    0x805020,%eax
+  802d9d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802da0:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802da2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802da5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802dac:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802daf:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802db1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802db4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802dbb:	83 ec 0c             	sub    $0xc,%esp
+  802dbe:	ff 75 e4             	push   -0x1c(%ebp)
+  802dc1:	e8 d3 e9 ff ff       	call   801799 <fd2num>
+  802dc6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802dc9:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802dcb:	83 c4 04             	add    $0x4,%esp
+  802dce:	ff 75 e0             	push   -0x20(%ebp)
+  802dd1:	e8 c3 e9 ff ff       	call   801799 <fd2num>
+  802dd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802dd9:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802ddc:	83 c4 10             	add    $0x10,%esp
+  802ddf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802de4:	e9 87 00 00 00       	jmp    802e70 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802de9:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802dee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802df1:	e8 10 fa ff ff       	call   802806 <pipe_ring>
+  802df6:	83 ec 08             	sub    $0x8,%esp
+  802df9:	01 f0                	add    %esi,%eax
+  802dfb:	50                   	push   %eax
+  802dfc:	6a 00                	push   $0x0
+  802dfe:	e8 d5 df ff ff       	call   800dd8 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802e03:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e06:	e8 fb f9 ff ff       	call   802806 <pipe_ring>
+  802e0b:	83 c4 08             	add    $0x8,%esp
+  802e0e:	01 f0                	add    %esi,%eax
+  802e10:	50                   	push   %eax
+  802e11:	6a 00                	push   $0x0
+  802e13:	e8 c0 df ff ff       	call   800dd8 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802e18:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802e1e:	83 c4 10             	add    $0x10,%esp
+  802e21:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802e27:	75 c5                	jne    802dee <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802e29:	83 ec 0c             	sub    $0xc,%esp
+  802e2c:	ff 75 e0             	push   -0x20(%ebp)
+  802e2f:	e8 75 e9 ff ff       	call   8017a9 <fd2data>
+  802e34:	83 c4 08             	add    $0x8,%esp
+  802e37:	50                   	push   %eax
+  802e38:	6a 00                	push   $0x0
+  802e3a:	e8 99 df ff ff       	call   800dd8 <sys_page_unmap>
+  802e3f:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802e42:	83 ec 08             	sub    $0x8,%esp
+  802e45:	57                   	push   %edi
+  802e46:	6a 00                	push   $0x0
+  802e48:	e8 8b df ff ff       	call   800dd8 <sys_page_unmap>
+  802e4d:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802e50:	83 ec 08             	sub    $0x8,%esp
+  802e53:	ff 75 e0             	push   -0x20(%ebp)
+  802e56:	6a 00                	push   $0x0
+  802e58:	e8 7b df ff ff       	call   800dd8 <sys_page_unmap>
+  802e5d:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802e60:	83 ec 08             	sub    $0x8,%esp
+  802e63:	ff 75 e4             	push   -0x1c(%ebp)
+  802e66:	6a 00                	push   $0x0
+  802e68:	e8 6b df ff ff       	call   800dd8 <sys_page_unmap>
+  802e6d:	83 c4 10             	add    $0x10,%esp
+}
+  802e70:	89 d8                	mov    %ebx,%eax
+  802e72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e75:	5b                   	pop    %ebx
+  802e76:	5e                   	pop    %esi
+  802e77:	5f                   	pop    %edi
+  802e78:	5d                   	pop    %ebp
+  802e79:	c3                   	ret
+
+00802e7a <pipe>:
+{
+  802e7a:	55                   	push   %ebp
+  802e7b:	89 e5                	mov    %esp,%ebp
+  802e7d:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802e80:	6a 00                	push   $0x0
+  802e82:	ff 75 08             	push   0x8(%ebp)
+  802e85:	e8 cc fd ff ff       	call   802c56 <pipe2>
+}
+  802e8a:	c9                   	leave
+  802e8b:	c3                   	ret
+
+00802e8c <pipeisclosed>:
+{
+  802e8c:	55                   	push   %ebp
+  802e8d:	89 e5                	mov    %esp,%ebp
+  802e8f:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e92:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e95:	50                   	push   %eax
+  802e96:	ff 75 08             	push   0x8(%ebp)
+  802e99:	e8 75 e9 ff ff       	call   801813 <fd_lookup>
+  802e9e:	83 c4 10             	add    $0x10,%esp
+  802ea1:	85 c0                	test   %eax,%eax
+  802ea3:	78 18                	js     802ebd <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802ea5:	83 ec 0c             	sub    $0xc,%esp
+  802ea8:	ff 75 f4             	push   -0xc(%ebp)
+  802eab:	e8 f9 e8 ff ff       	call   8017a9 <fd2data>
+  802eb0:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802eb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802eb5:	e8 59 fa ff ff       	call   802913 <_pipeisclosed>
+  802eba:	83 c4 10             	add    $0x10,%esp
+}
+  802ebd:	c9                   	leave
+  802ebe:	c3                   	ret
+
+00802ebf <pipe_splice>:
+{
+  802ebf:	55                   	push   %ebp
+  802ec0:	89 e5                	mov    %esp,%ebp
+  802ec2:	57                   	push   %edi
+  802ec3:	56                   	push   %esi
+  802ec4:	53                   	push   %ebx
+  802ec5:	83 ec 34             	sub    $0x34,%esp
+  802ec8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ecb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802ece:	50                   	push   %eax
+  802ecf:	ff 75 08             	push   0x8(%ebp)
+  802ed2:	e8 3c e9 ff ff       	call   801813 <fd_lookup>
+  802ed7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802eda:	83 c4 10             	add    $0x10,%esp
+  802edd:	85 c0                	test   %eax,%eax
+  802edf:	0f 88 d7 00 00 00    	js     802fbc <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802ee5:	83 ec 0c             	sub    $0xc,%esp
+  802ee8:	ff 75 e4             	push   -0x1c(%ebp)
+  802eeb:	e8 b9 e8 ff ff       	call   8017a9 <fd2data>
+  802ef0:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802ef2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ef5:	83 c4 10             	add    $0x10,%esp
+  802ef8:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802efe:	39 10                	cmp    %edx,(%eax)
+  802f00:	0f 85 c1 00 00 00    	jne    802fc7 <pipe_splice+0x108>
+  802f06:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802f0a:	0f 84 c0 00 00 00    	je     802fd0 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802f10:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802f14:	0f 84 bf 00 00 00    	je     802fd9 <pipe_splice+0x11a>
+  802f1a:	89 f7                	mov    %esi,%edi
+  802f1c:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802f22:	0f 85 ba 00 00 00    	jne    802fe2 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802f28:	8d 43 04             	lea    0x4(%ebx),%eax
+  802f2b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802f2e:	eb 38                	jmp    802f68 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802f30:	83 ec 0c             	sub    $0xc,%esp
+  802f33:	68 00 10 00 00       	push   $0x1000
+  802f38:	89 f1                	mov    %esi,%ecx
+  802f3a:	89 da                	mov    %ebx,%edx
+  802f3c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f3f:	e8 34 fa ff ff       	call   802978 <devpipe_write_bulk>
+  802f44:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802f47:	83 c4 10             	add    $0x10,%esp
+  802f4a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802f4f:	75 53                	jne    802fa4 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802f51:	83 ec 08             	sub    $0x8,%esp
+  802f54:	56                   	push   %esi
+  802f55:	6a 00                	push   $0x0
+  802f57:	e8 7c de ff ff       	call   800dd8 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802f5c:	83 c7 01             	add    $0x1,%edi
+  802f5f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802f65:	83 c4 10             	add    $0x10,%esp
+  802f68:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802f6b:	74 3a                	je     802fa7 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802f6d:	8b 03                	mov    (%ebx),%eax
+  802f6f:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802f72:	75 bc                	jne    802f30 <pipe_splice+0x71>
+  802f74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f79:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802f7d:	85 c0                	test   %eax,%eax
+  802f7f:	74 af                	je     802f30 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802f81:	83 ec 04             	sub    $0x4,%esp
+  802f84:	6a 07                	push   $0x7
+  802f86:	56                   	push   %esi
+  802f87:	ff 75 d0             	push   -0x30(%ebp)
+  802f8a:	e8 20 e1 ff ff       	call   8010af <sys_chan_wakeup>
+  802f8f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802f92:	83 c4 10             	add    $0x10,%esp
+  802f95:	85 c0                	test   %eax,%eax
+  802f97:	79 b8                	jns    802f51 <pipe_splice+0x92>
+  802f99:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f9e:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802fa2:	eb 8c                	jmp    802f30 <pipe_splice+0x71>
+  802fa4:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802fa7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fab:	75 06                	jne    802fb3 <pipe_splice+0xf4>
+  802fad:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802fb1:	78 09                	js     802fbc <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802fb3:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fb6:	c1 e0 0c             	shl    $0xc,%eax
+  802fb9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802fbc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802fbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fc2:	5b                   	pop    %ebx
+  802fc3:	5e                   	pop    %esi
+  802fc4:	5f                   	pop    %edi
+  802fc5:	5d                   	pop    %ebp
+  802fc6:	c3                   	ret
+    return -E_INVAL;
+  802fc7:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802fce:	eb ec                	jmp    802fbc <pipe_splice+0xfd>
+  802fd0:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802fd7:	eb e3                	jmp    802fbc <pipe_splice+0xfd>
+  802fd9:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802fe0:	eb da                	jmp    802fbc <pipe_splice+0xfd>
+  802fe2:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802fe9:	eb d1                	jmp    802fbc <pipe_splice+0xfd>
+
+00802feb <pipe_splice_read>:
+{
+  802feb:	55                   	push   %ebp
+  802fec:	89 e5                	mov    %esp,%ebp
+  802fee:	53                   	push   %ebx
+  802fef:	83 ec 1c             	sub    $0x1c,%esp
+  802ff2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ff5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ff8:	50                   	push   %eax
+  802ff9:	ff 75 08             	push   0x8(%ebp)
+  802ffc:	e8 12 e8 ff ff       	call   801813 <fd_lookup>
+  803001:	83 c4 10             	add    $0x10,%esp
+  803004:	85 c0                	test   %eax,%eax
+  803006:	78 49                	js     803051 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  803008:	83 ec 0c             	sub    $0xc,%esp
+  80300b:	ff 75 f4             	push   -0xc(%ebp)
+  80300e:	e8 96 e7 ff ff       	call   8017a9 <fd2data>
+  803013:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  803015:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803018:	83 c4 10             	add    $0x10,%esp
+  80301b:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  803021:	39 08                	cmp    %ecx,(%eax)
+  803023:	75 31                	jne    803056 <pipe_splice_read+0x6b>
+  803025:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  803029:	74 32                	je     80305d <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  80302b:	8b 48 08             	mov    0x8(%eax),%ecx
+  80302e:	83 e1 03             	and    $0x3,%ecx
+  803031:	83 f9 01             	cmp    $0x1,%ecx
+  803034:	74 2e                	je     803064 <pipe_splice_read+0x79>
+  803036:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80303c:	75 2d                	jne    80306b <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  80303e:	83 ec 08             	sub    $0x8,%esp
+  803041:	53                   	push   %ebx
+  803042:	68 00 10 00 00       	push   $0x1000
+  803047:	89 d9                	mov    %ebx,%ecx
+  803049:	e8 93 fa ff ff       	call   802ae1 <devpipe_read_bulk>
+  80304e:	83 c4 10             	add    $0x10,%esp
+}
+  803051:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803054:	c9                   	leave
+  803055:	c3                   	ret
+    return -E_INVAL;
+  803056:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80305b:	eb f4                	jmp    803051 <pipe_splice_read+0x66>
+  80305d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803062:	eb ed                	jmp    803051 <pipe_splice_read+0x66>
+  803064:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803069:	eb e6                	jmp    803051 <pipe_splice_read+0x66>
+  80306b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803070:	eb df                	jmp    803051 <pipe_splice_read+0x66>
+
+00803072 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  803072:	55                   	push   %ebp
+  803073:	89 e5                	mov    %esp,%ebp
+  803075:	56                   	push   %esi
+  803076:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  803077:	ba 60 67 80 00       	mov    $0x806760,%edx
+  80307c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803081:	eb 0b                	jmp    80308e <mmap_find+0x1c>
+  803083:	83 c3 01             	add    $0x1,%ebx
+  803086:	83 c2 14             	add    $0x14,%edx
+  803089:	83 fb 10             	cmp    $0x10,%ebx
+  80308c:	74 1d                	je     8030ab <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  80308e:	8b 0a                	mov    (%edx),%ecx
+  803090:	39 c8                	cmp    %ecx,%eax
+  803092:	72 ef                	jb     803083 <mmap_find+0x11>
+  803094:	85 c9                	test   %ecx,%ecx
+  803096:	74 eb                	je     803083 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  803098:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  80309b:	39 c8                	cmp    %ecx,%eax
+  80309d:	73 e4                	jae    803083 <mmap_find+0x11>
+      return &mmaps[i];
+  80309f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8030a2:	8d 04 85 60 67 80 00 	lea    0x806760(,%eax,4),%eax
+  8030a9:	eb 05                	jmp    8030b0 <mmap_find+0x3e>
+  return NULL;
+  8030ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030b0:	5b                   	pop    %ebx
+  8030b1:	5e                   	pop    %esi
+  8030b2:	5d                   	pop    %ebp
+  8030b3:	c3                   	ret
+
+008030b4 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8030b4:	89 c2                	mov    %eax,%edx
+  8030b6:	c1 ea 16             	shr    $0x16,%edx
+  8030b9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8030c0:	f6 c2 01             	test   $0x1,%dl
+  8030c3:	74 11                	je     8030d6 <va_mapped+0x22>
+  8030c5:	c1 e8 0c             	shr    $0xc,%eax
+  8030c8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8030cf:	83 e0 01             	and    $0x1,%eax
+  8030d2:	83 e0 01             	and    $0x1,%eax
+}
+  8030d5:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8030d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030db:	eb f5                	jmp    8030d2 <va_mapped+0x1e>
+
+008030dd <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  8030dd:	55                   	push   %ebp
+  8030de:	89 e5                	mov    %esp,%ebp
+  8030e0:	57                   	push   %edi
+  8030e1:	56                   	push   %esi
+  8030e2:	53                   	push   %ebx
+  8030e3:	83 ec 10             	sub    $0x10,%esp
+  8030e6:	89 c3                	mov    %eax,%ebx
+  8030e8:	89 d7                	mov    %edx,%edi
+  8030ea:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8030ec:	6a 07                	push   $0x7
+  8030ee:	68 00 f0 7f 00       	push   $0x7ff000
+  8030f3:	6a 00                	push   $0x0
+  8030f5:	e8 59 dc ff ff       	call   800d53 <sys_page_alloc>
+  8030fa:	83 c4 10             	add    $0x10,%esp
+  8030fd:	85 c0                	test   %eax,%eax
+  8030ff:	78 46                	js     803147 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  803101:	83 ec 04             	sub    $0x4,%esp
+  803104:	57                   	push   %edi
+  803105:	53                   	push   %ebx
+  803106:	68 00 f0 7f 00       	push   $0x7ff000
+  80310b:	e8 9a d9 ff ff       	call   800aaa <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  803110:	89 34 24             	mov    %esi,(%esp)
+  803113:	53                   	push   %ebx
+  803114:	6a 00                	push   $0x0
+  803116:	68 00 f0 7f 00       	push   $0x7ff000
+  80311b:	6a 00                	push   $0x0
+  80311d:	e8 74 dc ff ff       	call   800d96 <sys_page_map>
+  803122:	83 c4 20             	add    $0x20,%esp
+  803125:	85 c0                	test   %eax,%eax
+  803127:	78 30                	js     803159 <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  803129:	83 ec 08             	sub    $0x8,%esp
+  80312c:	68 00 f0 7f 00       	push   $0x7ff000
+  803131:	6a 00                	push   $0x0
+  803133:	e8 a0 dc ff ff       	call   800dd8 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  803138:	83 c4 10             	add    $0x10,%esp
+  80313b:	85 c0                	test   %eax,%eax
+  80313d:	78 1a                	js     803159 <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  80313f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803142:	5b                   	pop    %ebx
+  803143:	5e                   	pop    %esi
+  803144:	5f                   	pop    %edi
+  803145:	5d                   	pop    %ebp
+  803146:	c3                   	ret
+    panic("mmap: %e", r);
+  803147:	50                   	push   %eax
+  803148:	68 0b 41 80 00       	push   $0x80410b
+  80314d:	6a 3e                	push   $0x3e
+  80314f:	68 14 41 80 00       	push   $0x804114
+  803154:	e8 02 d1 ff ff       	call   80025b <_panic>
+    panic("mmap: %e", r);
+  803159:	50                   	push   %eax
+  80315a:	68 0b 41 80 00       	push   $0x80410b
+  80315f:	6a 42                	push   $0x42
+  803161:	68 14 41 80 00       	push   $0x804114
+  803166:	e8 f0 d0 ff ff       	call   80025b <_panic>
+
+0080316b <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  80316b:	55                   	push   %ebp
+  80316c:	89 e5                	mov    %esp,%ebp
+  80316e:	57                   	push   %edi
+  80316f:	56                   	push   %esi
+  803170:	53                   	push   %ebx
+  803171:	83 ec 1c             	sub    $0x1c,%esp
+  803174:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  803177:	8b 1f                	mov    (%edi),%ebx
+  803179:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  80317f:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  803185:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  80318a:	0f 87 24 01 00 00    	ja     8032b4 <mmap_fault+0x149>
+  803190:	89 d8                	mov    %ebx,%eax
+  803192:	e8 db fe ff ff       	call   803072 <mmap_find>
+  803197:	89 c6                	mov    %eax,%esi
+  803199:	85 c0                	test   %eax,%eax
+  80319b:	0f 84 20 01 00 00    	je     8032c1 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  8031a1:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  8031a5:	74 13                	je     8031ba <mmap_fault+0x4f>
+  8031a7:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  8031ab:	0f 84 17 01 00 00    	je     8032c8 <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  8031b1:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  8031b8:	eb 0f                	jmp    8031c9 <mmap_fault+0x5e>
+  8031ba:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  8031be:	19 c0                	sbb    %eax,%eax
+  8031c0:	83 e0 fe             	and    $0xfffffffe,%eax
+  8031c3:	83 c0 07             	add    $0x7,%eax
+  8031c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  8031c9:	89 d8                	mov    %ebx,%eax
+  8031cb:	e8 e4 fe ff ff       	call   8030b4 <va_mapped>
+  8031d0:	84 c0                	test   %al,%al
+  8031d2:	74 42                	je     803216 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  8031d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  8031d9:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  8031dd:	0f 84 d6 00 00 00    	je     8032b9 <mmap_fault+0x14e>
+  8031e3:	89 d8                	mov    %ebx,%eax
+  8031e5:	c1 e8 0c             	shr    $0xc,%eax
+  8031e8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  8031ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  8031f4:	f6 c2 02             	test   $0x2,%dl
+  8031f7:	0f 85 bc 00 00 00    	jne    8032b9 <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  8031fd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803200:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803205:	89 d8                	mov    %ebx,%eax
+  803207:	e8 d1 fe ff ff       	call   8030dd <mmap_copy>
+  return 1;
+  80320c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803211:	e9 a3 00 00 00       	jmp    8032b9 <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  803216:	a1 00 70 80 00       	mov    0x807000,%eax
+  80321b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80321e:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  803224:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  803227:	83 ec 04             	sub    $0x4,%esp
+  80322a:	53                   	push   %ebx
+  80322b:	89 d8                	mov    %ebx,%eax
+  80322d:	03 46 0c             	add    0xc(%esi),%eax
+  803230:	2b 06                	sub    (%esi),%eax
+  803232:	50                   	push   %eax
+  803233:	ff 76 08             	push   0x8(%esi)
+  803236:	e8 4a f3 ff ff       	call   802585 <read_map>
+    fsipcbuf.read_map = saved;
+  80323b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80323e:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+  803244:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  803247:	89 15 04 70 80 00    	mov    %edx,0x807004
+    if (r < 0)
+  80324d:	83 c4 10             	add    $0x10,%esp
+  803250:	85 c0                	test   %eax,%eax
+  803252:	78 20                	js     803274 <mmap_fault+0x109>
+    if (r == 0) {
+  803254:	74 30                	je     803286 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  803256:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80325b:	0f 8f 73 ff ff ff    	jg     8031d4 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  803261:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803264:	89 c2                	mov    %eax,%edx
+  803266:	89 d8                	mov    %ebx,%eax
+  803268:	e8 70 fe ff ff       	call   8030dd <mmap_copy>
+      return 1;
+  80326d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803272:	eb 45                	jmp    8032b9 <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  803274:	50                   	push   %eax
+  803275:	68 1f 41 80 00       	push   $0x80411f
+  80327a:	6a 5f                	push   $0x5f
+  80327c:	68 14 41 80 00       	push   $0x804114
+  803281:	e8 d5 cf ff ff       	call   80025b <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  803286:	83 ec 04             	sub    $0x4,%esp
+  803289:	ff 75 e4             	push   -0x1c(%ebp)
+  80328c:	53                   	push   %ebx
+  80328d:	6a 00                	push   $0x0
+  80328f:	e8 bf da ff ff       	call   800d53 <sys_page_alloc>
+  803294:	83 c4 10             	add    $0x10,%esp
+  803297:	85 c0                	test   %eax,%eax
+  803299:	78 07                	js     8032a2 <mmap_fault+0x137>
+      return 1;
+  80329b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032a0:	eb 17                	jmp    8032b9 <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  8032a2:	50                   	push   %eax
+  8032a3:	68 0b 41 80 00       	push   $0x80410b
+  8032a8:	6a 64                	push   $0x64
+  8032aa:	68 14 41 80 00       	push   $0x804114
+  8032af:	e8 a7 cf ff ff       	call   80025b <_panic>
+    return 0;
+  8032b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032bc:	5b                   	pop    %ebx
+  8032bd:	5e                   	pop    %esi
+  8032be:	5f                   	pop    %edi
+  8032bf:	5d                   	pop    %ebp
+  8032c0:	c3                   	ret
+    return 0;
+  8032c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c6:	eb f1                	jmp    8032b9 <mmap_fault+0x14e>
+    return 0;
+  8032c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032cd:	eb ea                	jmp    8032b9 <mmap_fault+0x14e>
+
+008032cf <mmap_pgfault>:
+{
+  8032cf:	55                   	push   %ebp
+  8032d0:	89 e5                	mov    %esp,%ebp
+  8032d2:	53                   	push   %ebx
+  8032d3:	83 ec 10             	sub    $0x10,%esp
+  8032d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  8032d9:	53                   	push   %ebx
+  8032da:	e8 8c fe ff ff       	call   80316b <mmap_fault>
+  8032df:	83 c4 10             	add    $0x10,%esp
+  8032e2:	84 c0                	test   %al,%al
+  8032e4:	74 05                	je     8032eb <mmap_pgfault+0x1c>
+}
+  8032e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032e9:	c9                   	leave
+  8032ea:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  8032eb:	83 ec 08             	sub    $0x8,%esp
+  8032ee:	ff 73 04             	push   0x4(%ebx)
+  8032f1:	ff 73 28             	push   0x28(%ebx)
+  8032f4:	ff 33                	push   (%ebx)
+  8032f6:	68 34 41 80 00       	push   $0x804134
+  8032fb:	6a 20                	push   $0x20
+  8032fd:	68 14 41 80 00       	push   $0x804114
+  803302:	e8 54 cf ff ff       	call   80025b <_panic>
+
+00803307 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  803307:	55                   	push   %ebp
+  803308:	89 e5                	mov    %esp,%ebp
+  80330a:	57                   	push   %edi
+  80330b:	56                   	push   %esi
+  80330c:	53                   	push   %ebx
+  80330d:	83 ec 44             	sub    $0x44,%esp
+  803310:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803313:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803316:	50                   	push   %eax
+  803317:	ff 75 08             	push   0x8(%ebp)
+  80331a:	e8 f4 e4 ff ff       	call   801813 <fd_lookup>
+  80331f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803322:	83 c4 10             	add    $0x10,%esp
+  803325:	85 c0                	test   %eax,%eax
+  803327:	0f 88 3e 01 00 00    	js     80346b <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  80332d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803331:	0f 88 d1 00 00 00    	js     803408 <mmap+0x101>
+  803337:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80333a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80333f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803342:	0f 85 c9 00 00 00    	jne    803411 <mmap+0x10a>
+  803348:	85 db                	test   %ebx,%ebx
+  80334a:	0f 84 ca 00 00 00    	je     80341a <mmap+0x113>
+  803350:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  803354:	0f 87 c0 00 00 00    	ja     80341a <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  80335a:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  803360:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803366:	89 d9                	mov    %ebx,%ecx
+  803368:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  80336b:	bb 4c 67 80 00       	mov    $0x80674c,%ebx
+  803370:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803375:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  80337a:	eb 53                	jmp    8033cf <mmap+0xc8>
+  80337c:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803381:	eb 4c                	jmp    8033cf <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  803383:	83 c0 01             	add    $0x1,%eax
+  803386:	83 f8 10             	cmp    $0x10,%eax
+  803389:	0f 84 e7 00 00 00    	je     803476 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  80338f:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  803392:	8b 14 b5 60 67 80 00 	mov    0x806760(,%esi,4),%edx
+  803399:	85 d2                	test   %edx,%edx
+  80339b:	74 e6                	je     803383 <mmap+0x7c>
+  80339d:	89 d1                	mov    %edx,%ecx
+  80339f:	03 0c b5 64 67 80 00 	add    0x806764(,%esi,4),%ecx
+  8033a6:	39 cf                	cmp    %ecx,%edi
+  8033a8:	73 d9                	jae    803383 <mmap+0x7c>
+  8033aa:	39 da                	cmp    %ebx,%edx
+  8033ac:	73 d5                	jae    803383 <mmap+0x7c>
+  8033ae:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8033b1:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  8033b4:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  8033b7:	83 c2 01             	add    $0x1,%edx
+  8033ba:	83 c3 14             	add    $0x14,%ebx
+  8033bd:	83 fa 10             	cmp    $0x10,%edx
+  8033c0:	74 2b                	je     8033ed <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  8033c2:	85 d2                	test   %edx,%edx
+  8033c4:	78 b6                	js     80337c <mmap+0x75>
+  8033c6:	8b 3b                	mov    (%ebx),%edi
+  8033c8:	85 ff                	test   %edi,%edi
+  8033ca:	74 eb                	je     8033b7 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  8033cc:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  8033cf:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8033d4:	29 f8                	sub    %edi,%eax
+  8033d6:	39 c8                	cmp    %ecx,%eax
+  8033d8:	72 dd                	jb     8033b7 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  8033da:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  8033dd:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  8033e0:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8033e3:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8033e6:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  8033e9:	89 f3                	mov    %esi,%ebx
+  8033eb:	eb a2                	jmp    80338f <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  8033ed:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  8033f4:	eb 75                	jmp    80346b <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  8033f6:	83 ec 0c             	sub    $0xc,%esp
+  8033f9:	68 cf 32 80 00       	push   $0x8032cf
+  8033fe:	e8 f7 03 00 00       	call   8037fa <set_pgfault_handler>
+  803403:	83 c4 10             	add    $0x10,%esp
+  803406:	eb 24                	jmp    80342c <mmap+0x125>
+    return -E_INVAL;
+  803408:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80340f:	eb 5a                	jmp    80346b <mmap+0x164>
+  803411:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803418:	eb 51                	jmp    80346b <mmap+0x164>
+  80341a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803421:	eb 48                	jmp    80346b <mmap+0x164>
+  if (_pgfault_handler == 0)
+  803423:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80342a:	74 ca                	je     8033f6 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  80342c:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803433:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803436:	c1 e2 02             	shl    $0x2,%edx
+  803439:	89 ba 60 67 80 00    	mov    %edi,0x806760(%edx)
+  mmaps[j].mm_len = len;
+  80343f:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  803442:	89 b2 64 67 80 00    	mov    %esi,0x806764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  803448:	8b 75 08             	mov    0x8(%ebp),%esi
+  80344b:	89 b2 68 67 80 00    	mov    %esi,0x806768(%edx)
+  mmaps[j].mm_offset = offset;
+  803451:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803454:	89 b2 6c 67 80 00    	mov    %esi,0x80676c(%edx)
+  mmaps[j].mm_perm = perm;
+  80345a:	01 d8                	add    %ebx,%eax
+  80345c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80345f:	89 1c 85 70 67 80 00 	mov    %ebx,0x806770(,%eax,4)
+  *addr = (void *) va;
+  803466:	8b 45 18             	mov    0x18(%ebp),%eax
+  803469:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  80346b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80346e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803471:	5b                   	pop    %ebx
+  803472:	5e                   	pop    %esi
+  803473:	5f                   	pop    %edi
+  803474:	5d                   	pop    %ebp
+  803475:	c3                   	ret
+  if (i == NMMAP)
+  803476:	b8 60 67 80 00       	mov    $0x806760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  80347b:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  80347e:	83 c0 14             	add    $0x14,%eax
+  803481:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  803485:	74 9c                	je     803423 <mmap+0x11c>
+  803487:	83 c3 01             	add    $0x1,%ebx
+  80348a:	83 fb 10             	cmp    $0x10,%ebx
+  80348d:	75 ef                	jne    80347e <mmap+0x177>
+    return -E_NO_MEM;
+  80348f:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803496:	eb d3                	jmp    80346b <mmap+0x164>
+
+00803498 <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  803498:	55                   	push   %ebp
+  803499:	89 e5                	mov    %esp,%ebp
+  80349b:	57                   	push   %edi
+  80349c:	56                   	push   %esi
+  80349d:	53                   	push   %ebx
+  80349e:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8034a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034a7:	e8 c6 fb ff ff       	call   803072 <mmap_find>
+  8034ac:	85 c0                	test   %eax,%eax
+  8034ae:	0f 84 58 01 00 00    	je     80360c <msync+0x174>
+  8034b4:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  8034b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  8034bb:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  8034bf:	74 0a                	je     8034cb <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  8034c1:	89 d8                	mov    %ebx,%eax
+  8034c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034c6:	5b                   	pop    %ebx
+  8034c7:	5e                   	pop    %esi
+  8034c8:	5f                   	pop    %edi
+  8034c9:	5d                   	pop    %ebp
+  8034ca:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  8034cb:	83 ec 08             	sub    $0x8,%esp
+  8034ce:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8034d1:	50                   	push   %eax
+  8034d2:	ff 77 08             	push   0x8(%edi)
+  8034d5:	e8 39 e3 ff ff       	call   801813 <fd_lookup>
+  8034da:	89 c3                	mov    %eax,%ebx
+  8034dc:	83 c4 10             	add    $0x10,%esp
+  8034df:	85 c0                	test   %eax,%eax
+  8034e1:	78 de                	js     8034c1 <msync+0x29>
+  8034e3:	83 ec 08             	sub    $0x8,%esp
+  8034e6:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  8034ec:	50                   	push   %eax
+  8034ed:	ff 77 08             	push   0x8(%edi)
+  8034f0:	e8 c1 e7 ff ff       	call   801cb6 <fstat>
+  8034f5:	89 c3                	mov    %eax,%ebx
+  8034f7:	83 c4 10             	add    $0x10,%esp
+  8034fa:	85 c0                	test   %eax,%eax
+  8034fc:	78 c3                	js     8034c1 <msync+0x29>
+  saved = fd->fd_offset;
+  8034fe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803501:	8b 40 04             	mov    0x4(%eax),%eax
+  803504:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  80350a:	8b 37                	mov    (%edi),%esi
+  80350c:	eb 29                	jmp    803537 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  80350e:	83 ec 0c             	sub    $0xc,%esp
+  803511:	6a 07                	push   $0x7
+  803513:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  803519:	50                   	push   %eax
+  80351a:	6a 00                	push   $0x0
+  80351c:	50                   	push   %eax
+  80351d:	6a 00                	push   $0x0
+  80351f:	e8 72 d8 ff ff       	call   800d96 <sys_page_map>
+  803524:	89 c3                	mov    %eax,%ebx
+  803526:	83 c4 20             	add    $0x20,%esp
+  803529:	85 c0                	test   %eax,%eax
+  80352b:	0f 88 c0 00 00 00    	js     8035f1 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803531:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803537:	8b 07                	mov    (%edi),%eax
+  803539:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  80353f:	03 47 04             	add    0x4(%edi),%eax
+  803542:	39 c6                	cmp    %eax,%esi
+  803544:	0f 83 a7 00 00 00    	jae    8035f1 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  80354a:	89 f0                	mov    %esi,%eax
+  80354c:	e8 63 fb ff ff       	call   8030b4 <va_mapped>
+  803551:	84 c0                	test   %al,%al
+  803553:	74 dc                	je     803531 <msync+0x99>
+  803555:	89 f0                	mov    %esi,%eax
+  803557:	c1 e8 0c             	shr    $0xc,%eax
+  80355a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803561:	a8 40                	test   $0x40,%al
+  803563:	74 cc                	je     803531 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  803565:	8b 47 0c             	mov    0xc(%edi),%eax
+  803568:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  80356e:	29 c8                	sub    %ecx,%eax
+  803570:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  803572:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803575:	39 c2                	cmp    %eax,%edx
+  803577:	7e 78                	jle    8035f1 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  803579:	29 c2                	sub    %eax,%edx
+  80357b:	89 d1                	mov    %edx,%ecx
+  80357d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803582:	39 d1                	cmp    %edx,%ecx
+  803584:	0f 4e d1             	cmovle %ecx,%edx
+  803587:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80358d:	83 ec 08             	sub    $0x8,%esp
+  803590:	50                   	push   %eax
+  803591:	ff 77 08             	push   0x8(%edi)
+  803594:	e8 75 e6 ff ff       	call   801c0e <seek>
+  803599:	89 c3                	mov    %eax,%ebx
+  80359b:	83 c4 10             	add    $0x10,%esp
+  80359e:	85 c0                	test   %eax,%eax
+  8035a0:	78 4f                	js     8035f1 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  8035a2:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  8035a8:	83 ec 04             	sub    $0x4,%esp
+  8035ab:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  8035b1:	56                   	push   %esi
+  8035b2:	ff 77 08             	push   0x8(%edi)
+  8035b5:	e8 d2 e5 ff ff       	call   801b8c <write>
+  8035ba:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  8035bc:	83 c4 10             	add    $0x10,%esp
+  8035bf:	85 c0                	test   %eax,%eax
+  8035c1:	78 2e                	js     8035f1 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  8035c3:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  8035c9:	39 c2                	cmp    %eax,%edx
+  8035cb:	0f 8e 3d ff ff ff    	jle    80350e <msync+0x76>
+  8035d1:	89 d0                	mov    %edx,%eax
+  8035d3:	29 d8                	sub    %ebx,%eax
+  8035d5:	01 f3                	add    %esi,%ebx
+  8035d7:	83 ec 04             	sub    $0x4,%esp
+  8035da:	50                   	push   %eax
+  8035db:	53                   	push   %ebx
+  8035dc:	ff 77 08             	push   0x8(%edi)
+  8035df:	e8 a8 e5 ff ff       	call   801b8c <write>
+  8035e4:	89 c3                	mov    %eax,%ebx
+  8035e6:	83 c4 10             	add    $0x10,%esp
+  8035e9:	85 c0                	test   %eax,%eax
+  8035eb:	0f 89 1d ff ff ff    	jns    80350e <msync+0x76>
+  fd->fd_offset = saved;
+  8035f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035f4:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  8035fa:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  8035fd:	85 db                	test   %ebx,%ebx
+  8035ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803604:	0f 4f d8             	cmovg  %eax,%ebx
+  803607:	e9 b5 fe ff ff       	jmp    8034c1 <msync+0x29>
+    return -E_INVAL;
+  80360c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  803611:	e9 ab fe ff ff       	jmp    8034c1 <msync+0x29>
+
+00803616 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  803616:	55                   	push   %ebp
+  803617:	89 e5                	mov    %esp,%ebp
+  803619:	56                   	push   %esi
+  80361a:	53                   	push   %ebx
+  80361b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  80361e:	89 d8                	mov    %ebx,%eax
+  803620:	e8 4d fa ff ff       	call   803072 <mmap_find>
+  803625:	85 c0                	test   %eax,%eax
+  803627:	74 56                	je     80367f <munmap+0x69>
+  803629:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  80362b:	83 ec 0c             	sub    $0xc,%esp
+  80362e:	53                   	push   %ebx
+  80362f:	e8 64 fe ff ff       	call   803498 <msync>
+  803634:	83 c4 10             	add    $0x10,%esp
+  803637:	85 c0                	test   %eax,%eax
+  803639:	78 3d                	js     803678 <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  80363b:	8b 1e                	mov    (%esi),%ebx
+  80363d:	eb 06                	jmp    803645 <munmap+0x2f>
+  80363f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803645:	8b 46 04             	mov    0x4(%esi),%eax
+  803648:	03 06                	add    (%esi),%eax
+  80364a:	39 c3                	cmp    %eax,%ebx
+  80364c:	73 1f                	jae    80366d <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  80364e:	89 d8                	mov    %ebx,%eax
+  803650:	e8 5f fa ff ff       	call   8030b4 <va_mapped>
+  803655:	84 c0                	test   %al,%al
+  803657:	74 e6                	je     80363f <munmap+0x29>
+  803659:	83 ec 08             	sub    $0x8,%esp
+  80365c:	53                   	push   %ebx
+  80365d:	6a 00                	push   $0x0
+  80365f:	e8 74 d7 ff ff       	call   800dd8 <sys_page_unmap>
+  803664:	83 c4 10             	add    $0x10,%esp
+  803667:	85 c0                	test   %eax,%eax
+  803669:	79 d4                	jns    80363f <munmap+0x29>
+  80366b:	eb 0b                	jmp    803678 <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  80366d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  803673:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803678:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80367b:	5b                   	pop    %ebx
+  80367c:	5e                   	pop    %esi
+  80367d:	5d                   	pop    %ebp
+  80367e:	c3                   	ret
+    return -E_INVAL;
+  80367f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803684:	eb f2                	jmp    803678 <munmap+0x62>
+
+00803686 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803686:	b8 00 00 00 00       	mov    $0x0,%eax
+  80368b:	c3                   	ret
+
+0080368c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80368c:	55                   	push   %ebp
+  80368d:	89 e5                	mov    %esp,%ebp
+  80368f:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  803692:	68 5b 41 80 00       	push   $0x80415b
+  803697:	ff 75 0c             	push   0xc(%ebp)
+  80369a:	e8 85 d2 ff ff       	call   800924 <strcpy>
+  return 0;
+}
+  80369f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a4:	c9                   	leave
+  8036a5:	c3                   	ret
+
+008036a6 <devcons_write>:
+{
+  8036a6:	55                   	push   %ebp
+  8036a7:	89 e5                	mov    %esp,%ebp
+  8036a9:	57                   	push   %edi
+  8036aa:	56                   	push   %esi
+  8036ab:	53                   	push   %ebx
+  8036ac:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8036b2:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8036b7:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  8036bd:	eb 2e                	jmp    8036ed <devcons_write+0x47>
+    m = n - tot;
+  8036bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8036c2:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8036c4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8036c9:	39 c3                	cmp    %eax,%ebx
+  8036cb:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  8036ce:	83 ec 04             	sub    $0x4,%esp
+  8036d1:	53                   	push   %ebx
+  8036d2:	89 f0                	mov    %esi,%eax
+  8036d4:	03 45 0c             	add    0xc(%ebp),%eax
+  8036d7:	50                   	push   %eax
+  8036d8:	57                   	push   %edi
+  8036d9:	e8 cc d3 ff ff       	call   800aaa <memmove>
+    sys_cputs(buf, m);
+  8036de:	83 c4 08             	add    $0x8,%esp
+  8036e1:	53                   	push   %ebx
+  8036e2:	57                   	push   %edi
+  8036e3:	e8 6c d5 ff ff       	call   800c54 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  8036e8:	01 de                	add    %ebx,%esi
+  8036ea:	83 c4 10             	add    $0x10,%esp
+  8036ed:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8036f0:	72 cd                	jb     8036bf <devcons_write+0x19>
+}
+  8036f2:	89 f0                	mov    %esi,%eax
+  8036f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036f7:	5b                   	pop    %ebx
+  8036f8:	5e                   	pop    %esi
+  8036f9:	5f                   	pop    %edi
+  8036fa:	5d                   	pop    %ebp
+  8036fb:	c3                   	ret
+
+008036fc <devcons_read>:
+{
+  8036fc:	55                   	push   %ebp
+  8036fd:	89 e5                	mov    %esp,%ebp
+  8036ff:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  803702:	b8 00 00 00 00       	mov    $0x0,%eax
+  803707:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80370b:	75 07                	jne    803714 <devcons_read+0x18>
+  80370d:	eb 1f                	jmp    80372e <devcons_read+0x32>
+    sys_yield();
+  80370f:	e8 dd d5 ff ff       	call   800cf1 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  803714:	e8 59 d5 ff ff       	call   800c72 <sys_cgetc>
+  803719:	85 c0                	test   %eax,%eax
+  80371b:	74 f2                	je     80370f <devcons_read+0x13>
+  if (c < 0)
+  80371d:	78 0f                	js     80372e <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  80371f:	83 f8 04             	cmp    $0x4,%eax
+  803722:	74 0c                	je     803730 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803724:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803727:	88 02                	mov    %al,(%edx)
+  return 1;
+  803729:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80372e:	c9                   	leave
+  80372f:	c3                   	ret
+    return 0;
+  803730:	b8 00 00 00 00       	mov    $0x0,%eax
+  803735:	eb f7                	jmp    80372e <devcons_read+0x32>
+
+00803737 <cputchar>:
+{
+  803737:	55                   	push   %ebp
+  803738:	89 e5                	mov    %esp,%ebp
+  80373a:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  80373d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803740:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803743:	6a 01                	push   $0x1
+  803745:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803748:	50                   	push   %eax
+  803749:	e8 06 d5 ff ff       	call   800c54 <sys_cputs>
+}
+  80374e:	83 c4 10             	add    $0x10,%esp
+  803751:	c9                   	leave
+  803752:	c3                   	ret
+
+00803753 <getchar>:
+{
+  803753:	55                   	push   %ebp
+  803754:	89 e5                	mov    %esp,%ebp
+  803756:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  803759:	6a 01                	push   $0x1
+  80375b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80375e:	50                   	push   %eax
+  80375f:	6a 00                	push   $0x0
+  803761:	e8 58 e3 ff ff       	call   801abe <read>
+  if (r < 0)
+  803766:	83 c4 10             	add    $0x10,%esp
+  803769:	85 c0                	test   %eax,%eax
+  80376b:	78 06                	js     803773 <getchar+0x20>
+  if (r < 1)
+  80376d:	74 06                	je     803775 <getchar+0x22>
+  return c;
+  80376f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803773:	c9                   	leave
+  803774:	c3                   	ret
+    return -E_EOF;
+  803775:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80377a:	eb f7                	jmp    803773 <getchar+0x20>
+
+0080377c <iscons>:
+{
+  80377c:	55                   	push   %ebp
+  80377d:	89 e5                	mov    %esp,%ebp
+  80377f:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803782:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803785:	50                   	push   %eax
+  803786:	ff 75 08             	push   0x8(%ebp)
+  803789:	e8 85 e0 ff ff       	call   801813 <fd_lookup>
+  80378e:	83 c4 10             	add    $0x10,%esp
+  803791:	85 c0                	test   %eax,%eax
+  803793:	78 11                	js     8037a6 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  803795:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803798:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  80379e:	39 10                	cmp    %edx,(%eax)
+  8037a0:	0f 94 c0             	sete   %al
+  8037a3:	0f b6 c0             	movzbl %al,%eax
+}
+  8037a6:	c9                   	leave
+  8037a7:	c3                   	ret
+
+008037a8 <opencons>:
+{
+  8037a8:	55                   	push   %ebp
+  8037a9:	89 e5                	mov    %esp,%ebp
+  8037ab:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  8037ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8037b1:	50                   	push   %eax
+  8037b2:	e8 06 e0 ff ff       	call   8017bd <fd_alloc>
+  8037b7:	83 c4 10             	add    $0x10,%esp
+  8037ba:	85 c0                	test   %eax,%eax
+  8037bc:	78 3a                	js     8037f8 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8037be:	83 ec 04             	sub    $0x4,%esp
+  8037c1:	68 07 04 00 00       	push   $0x407
+  8037c6:	ff 75 f4             	push   -0xc(%ebp)
+  8037c9:	6a 00                	push   $0x0
+  8037cb:	e8 83 d5 ff ff       	call   800d53 <sys_page_alloc>
+  8037d0:	83 c4 10             	add    $0x10,%esp
+  8037d3:	85 c0                	test   %eax,%eax
+  8037d5:	78 21                	js     8037f8 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  8037d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037da:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  8037e0:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  8037e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037e5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  8037ec:	83 ec 0c             	sub    $0xc,%esp
+  8037ef:	50                   	push   %eax
+  8037f0:	e8 a4 df ff ff       	call   801799 <fd2num>
+  8037f5:	83 c4 10             	add    $0x10,%esp
+}
+  8037f8:	c9                   	leave
+  8037f9:	c3                   	ret
+
+008037fa <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8037fa:	55                   	push   %ebp
+  8037fb:	89 e5                	mov    %esp,%ebp
+  8037fd:	53                   	push   %ebx
+  8037fe:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  803801:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803808:	74 0d                	je     803817 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  80380a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80380d:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803812:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803815:	c9                   	leave
+  803816:	c3                   	ret
+    envid_t id = sys_getenvid();
+  803817:	e8 b6 d4 ff ff       	call   800cd2 <sys_getenvid>
+  80381c:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  80381e:	83 ec 04             	sub    $0x4,%esp
+  803821:	6a 07                	push   $0x7
+  803823:	68 00 f0 bf ee       	push   $0xeebff000
+  803828:	50                   	push   %eax
+  803829:	e8 25 d5 ff ff       	call   800d53 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  80382e:	83 c4 08             	add    $0x8,%esp
+  803831:	68 41 38 80 00       	push   $0x803841
+  803836:	53                   	push   %ebx
+  803837:	e8 8c d7 ff ff       	call   800fc8 <sys_env_set_pgfault_upcall>
+  80383c:	83 c4 10             	add    $0x10,%esp
+  80383f:	eb c9                	jmp    80380a <set_pgfault_handler+0x10>
+
+00803841 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803841:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803842:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  803847:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803849:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  80384c:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  803850:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  803853:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  803857:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  80385b:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  80385d:	83 c4 08             	add    $0x8,%esp
+  popal
+  803860:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  803861:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  803864:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  803865:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  803866:	c3                   	ret
+
+00803867 <udivmod>:
+  803867:	55                   	push   %ebp
+  803868:	57                   	push   %edi
+  803869:	56                   	push   %esi
+  80386a:	53                   	push   %ebx
+  80386b:	83 ec 14             	sub    $0x14,%esp
+  80386e:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803872:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  803876:	89 fb                	mov    %edi,%ebx
+  803878:	09 f3                	or     %esi,%ebx
+  80387a:	0f 84 88 00 00 00    	je     803908 <udivmod+0xa1>
+  803880:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803885:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  80388c:	00 
+  80388d:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803894:	00 
+  803895:	89 cd                	mov    %ecx,%ebp
+  803897:	89 34 24             	mov    %esi,(%esp)
+  80389a:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  80389e:	eb 08                	jmp    8038a8 <udivmod+0x41>
+  8038a0:	83 ed 01             	sub    $0x1,%ebp
+  8038a3:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8038a6:	74 6c                	je     803914 <udivmod+0xad>
+  8038a8:	89 c3                	mov    %eax,%ebx
+  8038aa:	89 d6                	mov    %edx,%esi
+  8038ac:	89 e9                	mov    %ebp,%ecx
+  8038ae:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8038b1:	d3 ee                	shr    %cl,%esi
+  8038b3:	f6 c1 20             	test   $0x20,%cl
+  8038b6:	74 04                	je     8038bc <udivmod+0x55>
+  8038b8:	89 f3                	mov    %esi,%ebx
+  8038ba:	31 f6                	xor    %esi,%esi
+  8038bc:	8b 3c 24             	mov    (%esp),%edi
+  8038bf:	39 fb                	cmp    %edi,%ebx
+  8038c1:	89 f7                	mov    %esi,%edi
+  8038c3:	8b 1c 24             	mov    (%esp),%ebx
+  8038c6:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8038ca:	19 f7                	sbb    %esi,%edi
+  8038cc:	72 d2                	jb     8038a0 <udivmod+0x39>
+  8038ce:	89 f7                	mov    %esi,%edi
+  8038d0:	89 de                	mov    %ebx,%esi
+  8038d2:	89 e9                	mov    %ebp,%ecx
+  8038d4:	0f a5 f7             	shld   %cl,%esi,%edi
+  8038d7:	d3 e6                	shl    %cl,%esi
+  8038d9:	f6 c1 20             	test   $0x20,%cl
+  8038dc:	74 04                	je     8038e2 <udivmod+0x7b>
+  8038de:	89 f7                	mov    %esi,%edi
+  8038e0:	31 f6                	xor    %esi,%esi
+  8038e2:	29 f0                	sub    %esi,%eax
+  8038e4:	19 fa                	sbb    %edi,%edx
+  8038e6:	be 01 00 00 00       	mov    $0x1,%esi
+  8038eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038f0:	0f a5 f7             	shld   %cl,%esi,%edi
+  8038f3:	d3 e6                	shl    %cl,%esi
+  8038f5:	f6 c1 20             	test   $0x20,%cl
+  8038f8:	74 04                	je     8038fe <udivmod+0x97>
+  8038fa:	89 f7                	mov    %esi,%edi
+  8038fc:	31 f6                	xor    %esi,%esi
+  8038fe:	09 74 24 08          	or     %esi,0x8(%esp)
+  803902:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803906:	eb 98                	jmp    8038a0 <udivmod+0x39>
+  803908:	89 f0                	mov    %esi,%eax
+  80390a:	89 fa                	mov    %edi,%edx
+  80390c:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803910:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803914:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803918:	89 01                	mov    %eax,(%ecx)
+  80391a:	89 51 04             	mov    %edx,0x4(%ecx)
+  80391d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803921:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803925:	83 c4 14             	add    $0x14,%esp
+  803928:	5b                   	pop    %ebx
+  803929:	5e                   	pop    %esi
+  80392a:	5f                   	pop    %edi
+  80392b:	5d                   	pop    %ebp
+  80392c:	c3                   	ret
+
+0080392d <__udivdi3>:
+  80392d:	83 ec 18             	sub    $0x18,%esp
+  803930:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803934:	50                   	push   %eax
+  803935:	ff 74 24 2c          	push   0x2c(%esp)
+  803939:	ff 74 24 2c          	push   0x2c(%esp)
+  80393d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803941:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803945:	e8 1d ff ff ff       	call   803867 <udivmod>
+  80394a:	83 c4 24             	add    $0x24,%esp
+  80394d:	c3                   	ret
+
+0080394e <__umoddi3>:
+  80394e:	83 ec 18             	sub    $0x18,%esp
+  803951:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803955:	50                   	push   %eax
+  803956:	ff 74 24 2c          	push   0x2c(%esp)
+  80395a:	ff 74 24 2c          	push   0x2c(%esp)
+  80395e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803962:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803966:	e8 fc fe ff ff       	call   803867 <udivmod>
+  80396b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80396f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803973:	83 c4 24             	add    $0x24,%esp
+  803976:	c3                   	ret
+
+00803977 <__divdi3>:
+  803977:	56                   	push   %esi
+  803978:	53                   	push   %ebx
+  803979:	83 ec 14             	sub    $0x14,%esp
+  80397c:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803980:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803984:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803988:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80398c:	85 d2                	test   %edx,%edx
+  80398e:	78 18                	js     8039a8 <__divdi3+0x31>
+  803990:	85 db                	test   %ebx,%ebx
+  803992:	78 3e                	js     8039d2 <__divdi3+0x5b>
+  803994:	83 ec 04             	sub    $0x4,%esp
+  803997:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80399b:	56                   	push   %esi
+  80399c:	53                   	push   %ebx
+  80399d:	51                   	push   %ecx
+  80399e:	e8 c4 fe ff ff       	call   803867 <udivmod>
+  8039a3:	83 c4 10             	add    $0x10,%esp
+  8039a6:	eb 24                	jmp    8039cc <__divdi3+0x55>
+  8039a8:	f7 d8                	neg    %eax
+  8039aa:	83 d2 00             	adc    $0x0,%edx
+  8039ad:	f7 da                	neg    %edx
+  8039af:	85 db                	test   %ebx,%ebx
+  8039b1:	78 3a                	js     8039ed <__divdi3+0x76>
+  8039b3:	83 ec 04             	sub    $0x4,%esp
+  8039b6:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8039ba:	56                   	push   %esi
+  8039bb:	53                   	push   %ebx
+  8039bc:	51                   	push   %ecx
+  8039bd:	e8 a5 fe ff ff       	call   803867 <udivmod>
+  8039c2:	83 c4 10             	add    $0x10,%esp
+  8039c5:	f7 d8                	neg    %eax
+  8039c7:	83 d2 00             	adc    $0x0,%edx
+  8039ca:	f7 da                	neg    %edx
+  8039cc:	83 c4 14             	add    $0x14,%esp
+  8039cf:	5b                   	pop    %ebx
+  8039d0:	5e                   	pop    %esi
+  8039d1:	c3                   	ret
+  8039d2:	83 ec 04             	sub    $0x4,%esp
+  8039d5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8039d9:	56                   	push   %esi
+  8039da:	f7 d9                	neg    %ecx
+  8039dc:	83 d3 00             	adc    $0x0,%ebx
+  8039df:	f7 db                	neg    %ebx
+  8039e1:	53                   	push   %ebx
+  8039e2:	51                   	push   %ecx
+  8039e3:	e8 7f fe ff ff       	call   803867 <udivmod>
+  8039e8:	83 c4 10             	add    $0x10,%esp
+  8039eb:	eb d8                	jmp    8039c5 <__divdi3+0x4e>
+  8039ed:	83 ec 04             	sub    $0x4,%esp
+  8039f0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8039f4:	56                   	push   %esi
+  8039f5:	f7 d9                	neg    %ecx
+  8039f7:	83 d3 00             	adc    $0x0,%ebx
+  8039fa:	f7 db                	neg    %ebx
+  8039fc:	53                   	push   %ebx
+  8039fd:	51                   	push   %ecx
+  8039fe:	e8 64 fe ff ff       	call   803867 <udivmod>
+  803a03:	83 c4 10             	add    $0x10,%esp
+  803a06:	eb c4                	jmp    8039cc <__divdi3+0x55>
+
+00803a08 <__moddi3>:
+  803a08:	55                   	push   %ebp
+  803a09:	57                   	push   %edi
+  803a0a:	56                   	push   %esi
+  803a0b:	53                   	push   %ebx
+  803a0c:	83 ec 24             	sub    $0x24,%esp
+  803a0f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803a13:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803a17:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803a1b:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803a1f:	85 d2                	test   %edx,%edx
+  803a21:	78 3b                	js     803a5e <__moddi3+0x56>
+  803a23:	83 ec 04             	sub    $0x4,%esp
+  803a26:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a2a:	56                   	push   %esi
+  803a2b:	89 ce                	mov    %ecx,%esi
+  803a2d:	f7 de                	neg    %esi
+  803a2f:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803a33:	89 de                	mov    %ebx,%esi
+  803a35:	83 d6 00             	adc    $0x0,%esi
+  803a38:	f7 de                	neg    %esi
+  803a3a:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803a3e:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803a42:	0f 48 f1             	cmovs  %ecx,%esi
+  803a45:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803a4a:	53                   	push   %ebx
+  803a4b:	56                   	push   %esi
+  803a4c:	e8 16 fe ff ff       	call   803867 <udivmod>
+  803a51:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a55:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a59:	83 c4 10             	add    $0x10,%esp
+  803a5c:	eb 47                	jmp    803aa5 <__moddi3+0x9d>
+  803a5e:	f7 d8                	neg    %eax
+  803a60:	83 d2 00             	adc    $0x0,%edx
+  803a63:	f7 da                	neg    %edx
+  803a65:	83 ec 04             	sub    $0x4,%esp
+  803a68:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a6c:	56                   	push   %esi
+  803a6d:	89 cf                	mov    %ecx,%edi
+  803a6f:	f7 df                	neg    %edi
+  803a71:	89 de                	mov    %ebx,%esi
+  803a73:	83 d6 00             	adc    $0x0,%esi
+  803a76:	f7 de                	neg    %esi
+  803a78:	0f 49 cf             	cmovns %edi,%ecx
+  803a7b:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803a7f:	0f 49 de             	cmovns %esi,%ebx
+  803a82:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803a86:	ff 74 24 0c          	push   0xc(%esp)
+  803a8a:	ff 74 24 0c          	push   0xc(%esp)
+  803a8e:	e8 d4 fd ff ff       	call   803867 <udivmod>
+  803a93:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a97:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a9b:	f7 d8                	neg    %eax
+  803a9d:	83 d2 00             	adc    $0x0,%edx
+  803aa0:	f7 da                	neg    %edx
+  803aa2:	83 c4 10             	add    $0x10,%esp
+  803aa5:	83 c4 24             	add    $0x24,%esp
+  803aa8:	5b                   	pop    %ebx
+  803aa9:	5e                   	pop    %esi
+  803aaa:	5f                   	pop    %edi
+  803aab:	5d                   	pop    %ebp
+  803aac:	c3                   	ret
@@ -0,0 +1,7852 @@
+
+obj/user/testpiperace2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a1 01 00 00       	call   8001d2 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 28             	sub    $0x28,%esp
+  int p[2], r, i;
+  struct Fd *fd;
+  const volatile struct Env *kid;
+
+  cprintf("testing for pipeisclosed race...\n");
+  80003c:	68 a0 3a 80 00       	push   $0x803aa0
+  800041:	e8 d4 02 00 00       	call   80031a <cprintf>
+  if ((r = pipe(p)) < 0)
+  800046:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800049:	89 04 24             	mov    %eax,(%esp)
+  80004c:	e8 6e 2c 00 00       	call   802cbf <pipe>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	85 c0                	test   %eax,%eax
+  800056:	78 5d                	js     8000b5 <umain+0x82>
+    panic("pipe: %e", r);
+  if ((r = fork()) < 0)
+  800058:	e8 47 13 00 00       	call   8013a4 <fork>
+  80005d:	89 c7                	mov    %eax,%edi
+  80005f:	85 c0                	test   %eax,%eax
+  800061:	78 64                	js     8000c7 <umain+0x94>
+    panic("fork: %e", r);
+  if (r == 0) {
+  800063:	74 74                	je     8000d9 <umain+0xa6>
+  // pageref(p[0]) and gets 3, then it will return true when
+  // it shouldn't.
+  //
+  // So either way, pipeisclosed is going give a wrong answer.
+  //
+  kid = &envs[ENVX(r)];
+  800065:	89 f8                	mov    %edi,%eax
+  800067:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (kid->env_status == ENV_RUNNABLE)
+  80006c:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  80006f:	c1 e3 04             	shl    $0x4,%ebx
+  800072:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  800078:	8b 43 54             	mov    0x54(%ebx),%eax
+  80007b:	83 f8 02             	cmp    $0x2,%eax
+  80007e:	0f 85 d1 00 00 00    	jne    800155 <umain+0x122>
+    if (pipeisclosed(p[0]) != 0) {
+  800084:	83 ec 0c             	sub    $0xc,%esp
+  800087:	ff 75 e0             	push   -0x20(%ebp)
+  80008a:	e8 42 2c 00 00       	call   802cd1 <pipeisclosed>
+  80008f:	83 c4 10             	add    $0x10,%esp
+  800092:	85 c0                	test   %eax,%eax
+  800094:	74 e2                	je     800078 <umain+0x45>
+      cprintf("\nRACE: pipe appears closed\n");
+  800096:	83 ec 0c             	sub    $0xc,%esp
+  800099:	68 10 3b 80 00       	push   $0x803b10
+  80009e:	e8 77 02 00 00       	call   80031a <cprintf>
+      sys_env_destroy(r);
+  8000a3:	89 3c 24             	mov    %edi,(%esp)
+  8000a6:	e8 ca 0b 00 00       	call   800c75 <sys_env_destroy>
+      exit();
+  8000ab:	e8 75 01 00 00       	call   800225 <exit>
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	eb c3                	jmp    800078 <umain+0x45>
+    panic("pipe: %e", r);
+  8000b5:	50                   	push   %eax
+  8000b6:	68 ee 3a 80 00       	push   $0x803aee
+  8000bb:	6a 0d                	push   $0xd
+  8000bd:	68 f7 3a 80 00       	push   $0x803af7
+  8000c2:	e8 78 01 00 00       	call   80023f <_panic>
+    panic("fork: %e", r);
+  8000c7:	50                   	push   %eax
+  8000c8:	68 43 3f 80 00       	push   $0x803f43
+  8000cd:	6a 0f                	push   $0xf
+  8000cf:	68 f7 3a 80 00       	push   $0x803af7
+  8000d4:	e8 66 01 00 00       	call   80023f <_panic>
+    close(p[1]);
+  8000d9:	83 ec 0c             	sub    $0xc,%esp
+  8000dc:	ff 75 e4             	push   -0x1c(%ebp)
+  8000df:	e8 d3 16 00 00       	call   8017b7 <close>
+  8000e4:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < 200; i++) {
+  8000e7:	89 fb                	mov    %edi,%ebx
+      if (i % 10 == 0)
+  8000e9:	be 67 66 66 66       	mov    $0x66666667,%esi
+  8000ee:	eb 31                	jmp    800121 <umain+0xee>
+      dup(p[0], 10);
+  8000f0:	83 ec 08             	sub    $0x8,%esp
+  8000f3:	6a 0a                	push   $0xa
+  8000f5:	ff 75 e0             	push   -0x20(%ebp)
+  8000f8:	e8 0c 17 00 00       	call   801809 <dup>
+      sys_yield();
+  8000fd:	e8 d3 0b 00 00       	call   800cd5 <sys_yield>
+      close(10);
+  800102:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+  800109:	e8 a9 16 00 00       	call   8017b7 <close>
+      sys_yield();
+  80010e:	e8 c2 0b 00 00       	call   800cd5 <sys_yield>
+    for (i = 0; i < 200; i++) {
+  800113:	83 c3 01             	add    $0x1,%ebx
+  800116:	83 c4 10             	add    $0x10,%esp
+  800119:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  80011f:	74 2a                	je     80014b <umain+0x118>
+      if (i % 10 == 0)
+  800121:	89 d8                	mov    %ebx,%eax
+  800123:	f7 ee                	imul   %esi
+  800125:	c1 fa 02             	sar    $0x2,%edx
+  800128:	89 d8                	mov    %ebx,%eax
+  80012a:	c1 f8 1f             	sar    $0x1f,%eax
+  80012d:	29 c2                	sub    %eax,%edx
+  80012f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  800132:	01 c0                	add    %eax,%eax
+  800134:	39 c3                	cmp    %eax,%ebx
+  800136:	75 b8                	jne    8000f0 <umain+0xbd>
+        cprintf("%d.", i);
+  800138:	83 ec 08             	sub    $0x8,%esp
+  80013b:	53                   	push   %ebx
+  80013c:	68 0c 3b 80 00       	push   $0x803b0c
+  800141:	e8 d4 01 00 00       	call   80031a <cprintf>
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	eb a5                	jmp    8000f0 <umain+0xbd>
+    exit();
+  80014b:	e8 d5 00 00 00       	call   800225 <exit>
+  800150:	e9 10 ff ff ff       	jmp    800065 <umain+0x32>
+    }
+  cprintf("child done with loop\n");
+  800155:	83 ec 0c             	sub    $0xc,%esp
+  800158:	68 2c 3b 80 00       	push   $0x803b2c
+  80015d:	e8 b8 01 00 00       	call   80031a <cprintf>
+  if (pipeisclosed(p[0]))
+  800162:	83 c4 04             	add    $0x4,%esp
+  800165:	ff 75 e0             	push   -0x20(%ebp)
+  800168:	e8 64 2b 00 00       	call   802cd1 <pipeisclosed>
+  80016d:	83 c4 10             	add    $0x10,%esp
+  800170:	85 c0                	test   %eax,%eax
+  800172:	75 38                	jne    8001ac <umain+0x179>
+    panic("somehow the other end of p[0] got closed!");
+  if ((r = fd_lookup(p[0], &fd)) < 0)
+  800174:	83 ec 08             	sub    $0x8,%esp
+  800177:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80017a:	50                   	push   %eax
+  80017b:	ff 75 e0             	push   -0x20(%ebp)
+  80017e:	e8 11 15 00 00       	call   801694 <fd_lookup>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	85 c0                	test   %eax,%eax
+  800188:	78 36                	js     8001c0 <umain+0x18d>
+    panic("cannot look up p[0]: %e", r);
+  (void)fd2data(fd);
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	ff 75 dc             	push   -0x24(%ebp)
+  800190:	e8 95 14 00 00       	call   80162a <fd2data>
+  cprintf("race didn't happen\n");
+  800195:	c7 04 24 5a 3b 80 00 	movl   $0x803b5a,(%esp)
+  80019c:	e8 79 01 00 00       	call   80031a <cprintf>
+}
+  8001a1:	83 c4 10             	add    $0x10,%esp
+  8001a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a7:	5b                   	pop    %ebx
+  8001a8:	5e                   	pop    %esi
+  8001a9:	5f                   	pop    %edi
+  8001aa:	5d                   	pop    %ebp
+  8001ab:	c3                   	ret
+    panic("somehow the other end of p[0] got closed!");
+  8001ac:	83 ec 04             	sub    $0x4,%esp
+  8001af:	68 c4 3a 80 00       	push   $0x803ac4
+  8001b4:	6a 40                	push   $0x40
+  8001b6:	68 f7 3a 80 00       	push   $0x803af7
+  8001bb:	e8 7f 00 00 00       	call   80023f <_panic>
+    panic("cannot look up p[0]: %e", r);
+  8001c0:	50                   	push   %eax
+  8001c1:	68 42 3b 80 00       	push   $0x803b42
+  8001c6:	6a 42                	push   $0x42
+  8001c8:	68 f7 3a 80 00       	push   $0x803af7
+  8001cd:	e8 6d 00 00 00       	call   80023f <_panic>
+
+008001d2 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001d2:	55                   	push   %ebp
+  8001d3:	89 e5                	mov    %esp,%ebp
+  8001d5:	56                   	push   %esi
+  8001d6:	53                   	push   %ebx
+  8001d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001da:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8001dd:	c7 05 a0 68 80 00 00 	movl   $0x0,0x8068a0
+  8001e4:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8001e7:	e8 ca 0a 00 00       	call   800cb6 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8001ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001f1:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8001f4:	c1 e0 04             	shl    $0x4,%eax
+  8001f7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001fc:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800201:	85 db                	test   %ebx,%ebx
+  800203:	7e 07                	jle    80020c <libmain+0x3a>
+    binaryname = argv[0];
+  800205:	8b 06                	mov    (%esi),%eax
+  800207:	a3 00 50 80 00       	mov    %eax,0x805000
+
+  // call user main routine
+  umain(argc, argv);
+  80020c:	83 ec 08             	sub    $0x8,%esp
+  80020f:	56                   	push   %esi
+  800210:	53                   	push   %ebx
+  800211:	e8 1d fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800216:	e8 0a 00 00 00       	call   800225 <exit>
+}
+  80021b:	83 c4 10             	add    $0x10,%esp
+  80021e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800221:	5b                   	pop    %ebx
+  800222:	5e                   	pop    %esi
+  800223:	5d                   	pop    %ebp
+  800224:	c3                   	ret
+
+00800225 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800225:	55                   	push   %ebp
+  800226:	89 e5                	mov    %esp,%ebp
+  800228:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80022b:	e8 b4 15 00 00       	call   8017e4 <close_all>
+  sys_env_destroy(0);
+  800230:	83 ec 0c             	sub    $0xc,%esp
+  800233:	6a 00                	push   $0x0
+  800235:	e8 3b 0a 00 00       	call   800c75 <sys_env_destroy>
+}
+  80023a:	83 c4 10             	add    $0x10,%esp
+  80023d:	c9                   	leave
+  80023e:	c3                   	ret
+
+0080023f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80023f:	55                   	push   %ebp
+  800240:	89 e5                	mov    %esp,%ebp
+  800242:	56                   	push   %esi
+  800243:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  800244:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800247:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80024d:	e8 64 0a 00 00       	call   800cb6 <sys_getenvid>
+  800252:	83 ec 0c             	sub    $0xc,%esp
+  800255:	ff 75 0c             	push   0xc(%ebp)
+  800258:	ff 75 08             	push   0x8(%ebp)
+  80025b:	56                   	push   %esi
+  80025c:	50                   	push   %eax
+  80025d:	68 78 3b 80 00       	push   $0x803b78
+  800262:	e8 b3 00 00 00       	call   80031a <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800267:	83 c4 18             	add    $0x18,%esp
+  80026a:	53                   	push   %ebx
+  80026b:	ff 75 10             	push   0x10(%ebp)
+  80026e:	e8 56 00 00 00       	call   8002c9 <vcprintf>
+  cprintf("\n");
+  800273:	c7 04 24 ac 40 80 00 	movl   $0x8040ac,(%esp)
+  80027a:	e8 9b 00 00 00       	call   80031a <cprintf>
+  80027f:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800282:	cc                   	int3
+  while (1)
+  800283:	eb fd                	jmp    800282 <_panic+0x43>
+
+00800285 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800285:	55                   	push   %ebp
+  800286:	89 e5                	mov    %esp,%ebp
+  800288:	53                   	push   %ebx
+  800289:	83 ec 04             	sub    $0x4,%esp
+  80028c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  80028f:	8b 13                	mov    (%ebx),%edx
+  800291:	8d 42 01             	lea    0x1(%edx),%eax
+  800294:	89 03                	mov    %eax,(%ebx)
+  800296:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800299:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  80029d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002a2:	74 09                	je     8002ad <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8002a4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002ab:	c9                   	leave
+  8002ac:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8002ad:	83 ec 08             	sub    $0x8,%esp
+  8002b0:	68 ff 00 00 00       	push   $0xff
+  8002b5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002b8:	50                   	push   %eax
+  8002b9:	e8 7a 09 00 00       	call   800c38 <sys_cputs>
+    b->idx = 0;
+  8002be:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002c4:	83 c4 10             	add    $0x10,%esp
+  8002c7:	eb db                	jmp    8002a4 <putch+0x1f>
+
+008002c9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002c9:	55                   	push   %ebp
+  8002ca:	89 e5                	mov    %esp,%ebp
+  8002cc:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8002d2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002d9:	00 00 00 
+  b.cnt = 0;
+  8002dc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002e3:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8002e6:	ff 75 0c             	push   0xc(%ebp)
+  8002e9:	ff 75 08             	push   0x8(%ebp)
+  8002ec:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002f2:	50                   	push   %eax
+  8002f3:	68 85 02 80 00       	push   $0x800285
+  8002f8:	e8 14 01 00 00       	call   800411 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8002fd:	83 c4 08             	add    $0x8,%esp
+  800300:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800306:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80030c:	50                   	push   %eax
+  80030d:	e8 26 09 00 00       	call   800c38 <sys_cputs>
+
+  return b.cnt;
+}
+  800312:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800318:	c9                   	leave
+  800319:	c3                   	ret
+
+0080031a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80031a:	55                   	push   %ebp
+  80031b:	89 e5                	mov    %esp,%ebp
+  80031d:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800320:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800323:	50                   	push   %eax
+  800324:	ff 75 08             	push   0x8(%ebp)
+  800327:	e8 9d ff ff ff       	call   8002c9 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80032c:	c9                   	leave
+  80032d:	c3                   	ret
+
+0080032e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  80032e:	55                   	push   %ebp
+  80032f:	89 e5                	mov    %esp,%ebp
+  800331:	57                   	push   %edi
+  800332:	56                   	push   %esi
+  800333:	53                   	push   %ebx
+  800334:	83 ec 1c             	sub    $0x1c,%esp
+  800337:	89 c7                	mov    %eax,%edi
+  800339:	89 d6                	mov    %edx,%esi
+  80033b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80033e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800341:	89 d1                	mov    %edx,%ecx
+  800343:	89 c2                	mov    %eax,%edx
+  800345:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800348:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80034b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80034e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800351:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800354:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80035b:	39 c2                	cmp    %eax,%edx
+  80035d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800360:	72 3e                	jb     8003a0 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800362:	83 ec 0c             	sub    $0xc,%esp
+  800365:	ff 75 18             	push   0x18(%ebp)
+  800368:	83 eb 01             	sub    $0x1,%ebx
+  80036b:	53                   	push   %ebx
+  80036c:	50                   	push   %eax
+  80036d:	83 ec 08             	sub    $0x8,%esp
+  800370:	ff 75 e4             	push   -0x1c(%ebp)
+  800373:	ff 75 e0             	push   -0x20(%ebp)
+  800376:	ff 75 dc             	push   -0x24(%ebp)
+  800379:	ff 75 d8             	push   -0x28(%ebp)
+  80037c:	e8 90 35 00 00       	call   803911 <__udivdi3>
+  800381:	83 c4 18             	add    $0x18,%esp
+  800384:	52                   	push   %edx
+  800385:	50                   	push   %eax
+  800386:	89 f2                	mov    %esi,%edx
+  800388:	89 f8                	mov    %edi,%eax
+  80038a:	e8 9f ff ff ff       	call   80032e <printnum>
+  80038f:	83 c4 20             	add    $0x20,%esp
+  800392:	eb 13                	jmp    8003a7 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800394:	83 ec 08             	sub    $0x8,%esp
+  800397:	56                   	push   %esi
+  800398:	ff 75 18             	push   0x18(%ebp)
+  80039b:	ff d7                	call   *%edi
+  80039d:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8003a0:	83 eb 01             	sub    $0x1,%ebx
+  8003a3:	85 db                	test   %ebx,%ebx
+  8003a5:	7f ed                	jg     800394 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8003a7:	83 ec 08             	sub    $0x8,%esp
+  8003aa:	56                   	push   %esi
+  8003ab:	83 ec 04             	sub    $0x4,%esp
+  8003ae:	ff 75 e4             	push   -0x1c(%ebp)
+  8003b1:	ff 75 e0             	push   -0x20(%ebp)
+  8003b4:	ff 75 dc             	push   -0x24(%ebp)
+  8003b7:	ff 75 d8             	push   -0x28(%ebp)
+  8003ba:	e8 73 35 00 00       	call   803932 <__umoddi3>
+  8003bf:	83 c4 14             	add    $0x14,%esp
+  8003c2:	0f be 80 9b 3b 80 00 	movsbl 0x803b9b(%eax),%eax
+  8003c9:	50                   	push   %eax
+  8003ca:	ff d7                	call   *%edi
+}
+  8003cc:	83 c4 10             	add    $0x10,%esp
+  8003cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d2:	5b                   	pop    %ebx
+  8003d3:	5e                   	pop    %esi
+  8003d4:	5f                   	pop    %edi
+  8003d5:	5d                   	pop    %ebp
+  8003d6:	c3                   	ret
+
+008003d7 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003d7:	55                   	push   %ebp
+  8003d8:	89 e5                	mov    %esp,%ebp
+  8003da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8003dd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8003e1:	8b 10                	mov    (%eax),%edx
+  8003e3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003e6:	73 0a                	jae    8003f2 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8003e8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003eb:	89 08                	mov    %ecx,(%eax)
+  8003ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003f0:	88 02                	mov    %al,(%edx)
+}
+  8003f2:	5d                   	pop    %ebp
+  8003f3:	c3                   	ret
+
+008003f4 <printfmt>:
+{
+  8003f4:	55                   	push   %ebp
+  8003f5:	89 e5                	mov    %esp,%ebp
+  8003f7:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8003fa:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8003fd:	50                   	push   %eax
+  8003fe:	ff 75 10             	push   0x10(%ebp)
+  800401:	ff 75 0c             	push   0xc(%ebp)
+  800404:	ff 75 08             	push   0x8(%ebp)
+  800407:	e8 05 00 00 00       	call   800411 <vprintfmt>
+}
+  80040c:	83 c4 10             	add    $0x10,%esp
+  80040f:	c9                   	leave
+  800410:	c3                   	ret
+
+00800411 <vprintfmt>:
+{
+  800411:	55                   	push   %ebp
+  800412:	89 e5                	mov    %esp,%ebp
+  800414:	57                   	push   %edi
+  800415:	56                   	push   %esi
+  800416:	53                   	push   %ebx
+  800417:	83 ec 2c             	sub    $0x2c,%esp
+  80041a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80041d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800420:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800423:	eb 0a                	jmp    80042f <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800425:	83 ec 08             	sub    $0x8,%esp
+  800428:	53                   	push   %ebx
+  800429:	50                   	push   %eax
+  80042a:	ff d6                	call   *%esi
+  80042c:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80042f:	83 c7 01             	add    $0x1,%edi
+  800432:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800436:	83 f8 25             	cmp    $0x25,%eax
+  800439:	74 0c                	je     800447 <vprintfmt+0x36>
+      if (ch == '\0')
+  80043b:	85 c0                	test   %eax,%eax
+  80043d:	75 e6                	jne    800425 <vprintfmt+0x14>
+}
+  80043f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800442:	5b                   	pop    %ebx
+  800443:	5e                   	pop    %esi
+  800444:	5f                   	pop    %edi
+  800445:	5d                   	pop    %ebp
+  800446:	c3                   	ret
+    padc = ' ';
+  800447:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  80044b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800452:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800459:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800460:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800465:	8d 47 01             	lea    0x1(%edi),%eax
+  800468:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80046b:	0f b6 17             	movzbl (%edi),%edx
+  80046e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800471:	3c 55                	cmp    $0x55,%al
+  800473:	0f 87 cf 03 00 00    	ja     800848 <vprintfmt+0x437>
+  800479:	0f b6 c0             	movzbl %al,%eax
+  80047c:	ff 24 85 e0 3c 80 00 	jmp    *0x803ce0(,%eax,4)
+  800483:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800486:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80048a:	eb d9                	jmp    800465 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80048c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80048f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800493:	eb d0                	jmp    800465 <vprintfmt+0x54>
+  800495:	0f b6 d2             	movzbl %dl,%edx
+  800498:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  80049b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8004a3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004a6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8004aa:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8004ad:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004b0:	83 f9 09             	cmp    $0x9,%ecx
+  8004b3:	77 55                	ja     80050a <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8004b5:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8004b8:	eb e9                	jmp    8004a3 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8004ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bd:	8b 00                	mov    (%eax),%eax
+  8004bf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8004c8:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8004cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8004ce:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004d2:	79 91                	jns    800465 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8004d4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004da:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004e1:	eb 82                	jmp    800465 <vprintfmt+0x54>
+      if (width < 0)
+  8004e3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004e6:	85 d2                	test   %edx,%edx
+  8004e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ed:	0f 49 c2             	cmovns %edx,%eax
+  8004f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8004f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8004f6:	e9 6a ff ff ff       	jmp    800465 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8004fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8004fe:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800505:	e9 5b ff ff ff       	jmp    800465 <vprintfmt+0x54>
+  80050a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80050d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800510:	eb bc                	jmp    8004ce <vprintfmt+0xbd>
+      lflag++;
+  800512:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800515:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800518:	e9 48 ff ff ff       	jmp    800465 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  80051d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800520:	8d 78 04             	lea    0x4(%eax),%edi
+  800523:	83 ec 08             	sub    $0x8,%esp
+  800526:	53                   	push   %ebx
+  800527:	ff 30                	push   (%eax)
+  800529:	ff d6                	call   *%esi
+      break;
+  80052b:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  80052e:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800531:	e9 b1 02 00 00       	jmp    8007e7 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800536:	8b 45 14             	mov    0x14(%ebp),%eax
+  800539:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  80053c:	8b 10                	mov    (%eax),%edx
+  80053e:	89 d0                	mov    %edx,%eax
+  800540:	f7 d8                	neg    %eax
+  800542:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800545:	83 f8 10             	cmp    $0x10,%eax
+  800548:	7f 23                	jg     80056d <vprintfmt+0x15c>
+  80054a:	8b 14 85 40 3e 80 00 	mov    0x803e40(,%eax,4),%edx
+  800551:	85 d2                	test   %edx,%edx
+  800553:	74 18                	je     80056d <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800555:	52                   	push   %edx
+  800556:	68 56 40 80 00       	push   $0x804056
+  80055b:	53                   	push   %ebx
+  80055c:	56                   	push   %esi
+  80055d:	e8 92 fe ff ff       	call   8003f4 <printfmt>
+  800562:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800565:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800568:	e9 7a 02 00 00       	jmp    8007e7 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  80056d:	50                   	push   %eax
+  80056e:	68 b3 3b 80 00       	push   $0x803bb3
+  800573:	53                   	push   %ebx
+  800574:	56                   	push   %esi
+  800575:	e8 7a fe ff ff       	call   8003f4 <printfmt>
+  80057a:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80057d:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800580:	e9 62 02 00 00       	jmp    8007e7 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800585:	8b 45 14             	mov    0x14(%ebp),%eax
+  800588:	83 c0 04             	add    $0x4,%eax
+  80058b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80058e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800591:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800593:	85 c9                	test   %ecx,%ecx
+  800595:	b8 ac 3b 80 00       	mov    $0x803bac,%eax
+  80059a:	0f 45 c1             	cmovne %ecx,%eax
+  80059d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8005a0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005a4:	7e 06                	jle    8005ac <vprintfmt+0x19b>
+  8005a6:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005aa:	75 0b                	jne    8005b7 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005ac:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005af:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005b2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005b5:	eb 5c                	jmp    800613 <vprintfmt+0x202>
+  8005b7:	83 ec 08             	sub    $0x8,%esp
+  8005ba:	ff 75 d0             	push   -0x30(%ebp)
+  8005bd:	ff 75 cc             	push   -0x34(%ebp)
+  8005c0:	e8 20 03 00 00       	call   8008e5 <strnlen>
+  8005c5:	89 c2                	mov    %eax,%edx
+  8005c7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ca:	29 d0                	sub    %edx,%eax
+  8005cc:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8005cf:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005d9:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005db:	eb 0e                	jmp    8005eb <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8005dd:	83 ec 08             	sub    $0x8,%esp
+  8005e0:	53                   	push   %ebx
+  8005e1:	57                   	push   %edi
+  8005e2:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005e5:	83 ee 01             	sub    $0x1,%esi
+  8005e8:	83 c4 10             	add    $0x10,%esp
+  8005eb:	85 f6                	test   %esi,%esi
+  8005ed:	7f ee                	jg     8005dd <vprintfmt+0x1cc>
+  8005ef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005f5:	85 c0                	test   %eax,%eax
+  8005f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005fc:	0f 49 d0             	cmovns %eax,%edx
+  8005ff:	29 d0                	sub    %edx,%eax
+  800601:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800604:	eb a6                	jmp    8005ac <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800606:	83 ec 08             	sub    $0x8,%esp
+  800609:	53                   	push   %ebx
+  80060a:	52                   	push   %edx
+  80060b:	ff 55 08             	call   *0x8(%ebp)
+  80060e:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800611:	89 f1                	mov    %esi,%ecx
+  800613:	8d 71 01             	lea    0x1(%ecx),%esi
+  800616:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80061a:	0f be d0             	movsbl %al,%edx
+  80061d:	85 d2                	test   %edx,%edx
+  80061f:	74 28                	je     800649 <vprintfmt+0x238>
+  800621:	85 ff                	test   %edi,%edi
+  800623:	78 05                	js     80062a <vprintfmt+0x219>
+  800625:	83 ef 01             	sub    $0x1,%edi
+  800628:	78 30                	js     80065a <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  80062a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80062e:	74 d6                	je     800606 <vprintfmt+0x1f5>
+  800630:	0f be c0             	movsbl %al,%eax
+  800633:	83 e8 20             	sub    $0x20,%eax
+  800636:	83 f8 5e             	cmp    $0x5e,%eax
+  800639:	76 cb                	jbe    800606 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  80063b:	83 ec 08             	sub    $0x8,%esp
+  80063e:	53                   	push   %ebx
+  80063f:	6a 3f                	push   $0x3f
+  800641:	ff 55 08             	call   *0x8(%ebp)
+  800644:	83 c4 10             	add    $0x10,%esp
+  800647:	eb c8                	jmp    800611 <vprintfmt+0x200>
+  800649:	8b 75 08             	mov    0x8(%ebp),%esi
+  80064c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80064f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800652:	01 d0                	add    %edx,%eax
+  800654:	29 c8                	sub    %ecx,%eax
+  800656:	89 c7                	mov    %eax,%edi
+  800658:	eb 13                	jmp    80066d <vprintfmt+0x25c>
+  80065a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80065d:	eb ed                	jmp    80064c <vprintfmt+0x23b>
+        putch(' ', putdat);
+  80065f:	83 ec 08             	sub    $0x8,%esp
+  800662:	53                   	push   %ebx
+  800663:	6a 20                	push   $0x20
+  800665:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800667:	83 ef 01             	sub    $0x1,%edi
+  80066a:	83 c4 10             	add    $0x10,%esp
+  80066d:	85 ff                	test   %edi,%edi
+  80066f:	7f ee                	jg     80065f <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800671:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800674:	89 45 14             	mov    %eax,0x14(%ebp)
+  800677:	e9 6b 01 00 00       	jmp    8007e7 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  80067c:	83 f9 01             	cmp    $0x1,%ecx
+  80067f:	7f 1f                	jg     8006a0 <vprintfmt+0x28f>
+  else if (lflag)
+  800681:	85 c9                	test   %ecx,%ecx
+  800683:	74 67                	je     8006ec <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800685:	8b 45 14             	mov    0x14(%ebp),%eax
+  800688:	8b 00                	mov    (%eax),%eax
+  80068a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80068d:	89 c1                	mov    %eax,%ecx
+  80068f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800692:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800695:	8b 45 14             	mov    0x14(%ebp),%eax
+  800698:	8d 40 04             	lea    0x4(%eax),%eax
+  80069b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069e:	eb 17                	jmp    8006b7 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8006a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a3:	8b 50 04             	mov    0x4(%eax),%edx
+  8006a6:	8b 00                	mov    (%eax),%eax
+  8006a8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ab:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b4:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8006b7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006ba:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8006bd:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8006c2:	85 c9                	test   %ecx,%ecx
+  8006c4:	0f 89 03 01 00 00    	jns    8007cd <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8006ca:	83 ec 08             	sub    $0x8,%esp
+  8006cd:	53                   	push   %ebx
+  8006ce:	6a 2d                	push   $0x2d
+  8006d0:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8006d2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006d5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006d8:	f7 da                	neg    %edx
+  8006da:	83 d1 00             	adc    $0x0,%ecx
+  8006dd:	f7 d9                	neg    %ecx
+  8006df:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8006e2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006e7:	e9 e1 00 00 00       	jmp    8007cd <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8006ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ef:	8b 00                	mov    (%eax),%eax
+  8006f1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006f4:	89 c1                	mov    %eax,%ecx
+  8006f6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006f9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800702:	89 45 14             	mov    %eax,0x14(%ebp)
+  800705:	eb b0                	jmp    8006b7 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800707:	83 f9 01             	cmp    $0x1,%ecx
+  80070a:	7f 1e                	jg     80072a <vprintfmt+0x319>
+  else if (lflag)
+  80070c:	85 c9                	test   %ecx,%ecx
+  80070e:	74 32                	je     800742 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800710:	8b 45 14             	mov    0x14(%ebp),%eax
+  800713:	8b 10                	mov    (%eax),%edx
+  800715:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071a:	8d 40 04             	lea    0x4(%eax),%eax
+  80071d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800720:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800725:	e9 a3 00 00 00       	jmp    8007cd <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80072a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072d:	8b 10                	mov    (%eax),%edx
+  80072f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800732:	8d 40 08             	lea    0x8(%eax),%eax
+  800735:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800738:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  80073d:	e9 8b 00 00 00       	jmp    8007cd <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800742:	8b 45 14             	mov    0x14(%ebp),%eax
+  800745:	8b 10                	mov    (%eax),%edx
+  800747:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074c:	8d 40 04             	lea    0x4(%eax),%eax
+  80074f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800752:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800757:	eb 74                	jmp    8007cd <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800759:	83 f9 01             	cmp    $0x1,%ecx
+  80075c:	7f 1b                	jg     800779 <vprintfmt+0x368>
+  else if (lflag)
+  80075e:	85 c9                	test   %ecx,%ecx
+  800760:	74 2c                	je     80078e <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800762:	8b 45 14             	mov    0x14(%ebp),%eax
+  800765:	8b 10                	mov    (%eax),%edx
+  800767:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80076c:	8d 40 04             	lea    0x4(%eax),%eax
+  80076f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800772:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800777:	eb 54                	jmp    8007cd <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800779:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077c:	8b 10                	mov    (%eax),%edx
+  80077e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800781:	8d 40 08             	lea    0x8(%eax),%eax
+  800784:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800787:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  80078c:	eb 3f                	jmp    8007cd <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80078e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800791:	8b 10                	mov    (%eax),%edx
+  800793:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800798:	8d 40 04             	lea    0x4(%eax),%eax
+  80079b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80079e:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8007a3:	eb 28                	jmp    8007cd <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8007a5:	83 ec 08             	sub    $0x8,%esp
+  8007a8:	53                   	push   %ebx
+  8007a9:	6a 30                	push   $0x30
+  8007ab:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8007ad:	83 c4 08             	add    $0x8,%esp
+  8007b0:	53                   	push   %ebx
+  8007b1:	6a 78                	push   $0x78
+  8007b3:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8007b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b8:	8b 10                	mov    (%eax),%edx
+  8007ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8007bf:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8007c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c5:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007c8:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8007cd:	83 ec 0c             	sub    $0xc,%esp
+  8007d0:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007d4:	50                   	push   %eax
+  8007d5:	ff 75 e0             	push   -0x20(%ebp)
+  8007d8:	57                   	push   %edi
+  8007d9:	51                   	push   %ecx
+  8007da:	52                   	push   %edx
+  8007db:	89 da                	mov    %ebx,%edx
+  8007dd:	89 f0                	mov    %esi,%eax
+  8007df:	e8 4a fb ff ff       	call   80032e <printnum>
+      break;
+  8007e4:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8007e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8007ea:	e9 40 fc ff ff       	jmp    80042f <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8007ef:	83 f9 01             	cmp    $0x1,%ecx
+  8007f2:	7f 1b                	jg     80080f <vprintfmt+0x3fe>
+  else if (lflag)
+  8007f4:	85 c9                	test   %ecx,%ecx
+  8007f6:	74 2c                	je     800824 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8007f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fb:	8b 10                	mov    (%eax),%edx
+  8007fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800802:	8d 40 04             	lea    0x4(%eax),%eax
+  800805:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800808:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  80080d:	eb be                	jmp    8007cd <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80080f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800812:	8b 10                	mov    (%eax),%edx
+  800814:	8b 48 04             	mov    0x4(%eax),%ecx
+  800817:	8d 40 08             	lea    0x8(%eax),%eax
+  80081a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80081d:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800822:	eb a9                	jmp    8007cd <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800824:	8b 45 14             	mov    0x14(%ebp),%eax
+  800827:	8b 10                	mov    (%eax),%edx
+  800829:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80082e:	8d 40 04             	lea    0x4(%eax),%eax
+  800831:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800834:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800839:	eb 92                	jmp    8007cd <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  80083b:	83 ec 08             	sub    $0x8,%esp
+  80083e:	53                   	push   %ebx
+  80083f:	6a 25                	push   $0x25
+  800841:	ff d6                	call   *%esi
+      break;
+  800843:	83 c4 10             	add    $0x10,%esp
+  800846:	eb 9f                	jmp    8007e7 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800848:	83 ec 08             	sub    $0x8,%esp
+  80084b:	53                   	push   %ebx
+  80084c:	6a 25                	push   $0x25
+  80084e:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800850:	83 c4 10             	add    $0x10,%esp
+  800853:	89 f8                	mov    %edi,%eax
+  800855:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800859:	74 05                	je     800860 <vprintfmt+0x44f>
+  80085b:	83 e8 01             	sub    $0x1,%eax
+  80085e:	eb f5                	jmp    800855 <vprintfmt+0x444>
+  800860:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800863:	eb 82                	jmp    8007e7 <vprintfmt+0x3d6>
+
+00800865 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800865:	55                   	push   %ebp
+  800866:	89 e5                	mov    %esp,%ebp
+  800868:	83 ec 18             	sub    $0x18,%esp
+  80086b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80086e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800871:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800874:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800878:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80087b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800882:	85 c0                	test   %eax,%eax
+  800884:	74 26                	je     8008ac <vsnprintf+0x47>
+  800886:	85 d2                	test   %edx,%edx
+  800888:	7e 22                	jle    8008ac <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80088a:	ff 75 14             	push   0x14(%ebp)
+  80088d:	ff 75 10             	push   0x10(%ebp)
+  800890:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800893:	50                   	push   %eax
+  800894:	68 d7 03 80 00       	push   $0x8003d7
+  800899:	e8 73 fb ff ff       	call   800411 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  80089e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008a1:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8008a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008a7:	83 c4 10             	add    $0x10,%esp
+}
+  8008aa:	c9                   	leave
+  8008ab:	c3                   	ret
+    return -E_INVAL;
+  8008ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008b1:	eb f7                	jmp    8008aa <vsnprintf+0x45>
+
+008008b3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008b3:	55                   	push   %ebp
+  8008b4:	89 e5                	mov    %esp,%ebp
+  8008b6:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8008b9:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8008bc:	50                   	push   %eax
+  8008bd:	ff 75 10             	push   0x10(%ebp)
+  8008c0:	ff 75 0c             	push   0xc(%ebp)
+  8008c3:	ff 75 08             	push   0x8(%ebp)
+  8008c6:	e8 9a ff ff ff       	call   800865 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8008cb:	c9                   	leave
+  8008cc:	c3                   	ret
+
+008008cd <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008cd:	55                   	push   %ebp
+  8008ce:	89 e5                	mov    %esp,%ebp
+  8008d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8008d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d8:	eb 03                	jmp    8008dd <strlen+0x10>
+    n++;
+  8008da:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8008dd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008e1:	75 f7                	jne    8008da <strlen+0xd>
+  return n;
+}
+  8008e3:	5d                   	pop    %ebp
+  8008e4:	c3                   	ret
+
+008008e5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008e5:	55                   	push   %ebp
+  8008e6:	89 e5                	mov    %esp,%ebp
+  8008e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f3:	eb 03                	jmp    8008f8 <strnlen+0x13>
+    n++;
+  8008f5:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008f8:	39 d0                	cmp    %edx,%eax
+  8008fa:	74 08                	je     800904 <strnlen+0x1f>
+  8008fc:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800900:	75 f3                	jne    8008f5 <strnlen+0x10>
+  800902:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800904:	89 d0                	mov    %edx,%eax
+  800906:	5d                   	pop    %ebp
+  800907:	c3                   	ret
+
+00800908 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800908:	55                   	push   %ebp
+  800909:	89 e5                	mov    %esp,%ebp
+  80090b:	53                   	push   %ebx
+  80090c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80090f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800912:	b8 00 00 00 00       	mov    $0x0,%eax
+  800917:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80091b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80091e:	83 c0 01             	add    $0x1,%eax
+  800921:	84 d2                	test   %dl,%dl
+  800923:	75 f2                	jne    800917 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800925:	89 c8                	mov    %ecx,%eax
+  800927:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092a:	c9                   	leave
+  80092b:	c3                   	ret
+
+0080092c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80092c:	55                   	push   %ebp
+  80092d:	89 e5                	mov    %esp,%ebp
+  80092f:	53                   	push   %ebx
+  800930:	83 ec 10             	sub    $0x10,%esp
+  800933:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800936:	53                   	push   %ebx
+  800937:	e8 91 ff ff ff       	call   8008cd <strlen>
+  80093c:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  80093f:	ff 75 0c             	push   0xc(%ebp)
+  800942:	01 d8                	add    %ebx,%eax
+  800944:	50                   	push   %eax
+  800945:	e8 be ff ff ff       	call   800908 <strcpy>
+  return dst;
+}
+  80094a:	89 d8                	mov    %ebx,%eax
+  80094c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80094f:	c9                   	leave
+  800950:	c3                   	ret
+
+00800951 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800951:	55                   	push   %ebp
+  800952:	89 e5                	mov    %esp,%ebp
+  800954:	56                   	push   %esi
+  800955:	53                   	push   %ebx
+  800956:	8b 75 08             	mov    0x8(%ebp),%esi
+  800959:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  80095c:	89 f3                	mov    %esi,%ebx
+  80095e:	03 5d 10             	add    0x10(%ebp),%ebx
+  800961:	89 f0                	mov    %esi,%eax
+  800963:	eb 0f                	jmp    800974 <strncpy+0x23>
+    *dst++ = *src;
+  800965:	83 c0 01             	add    $0x1,%eax
+  800968:	0f b6 0a             	movzbl (%edx),%ecx
+  80096b:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  80096e:	80 f9 01             	cmp    $0x1,%cl
+  800971:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800974:	39 d8                	cmp    %ebx,%eax
+  800976:	75 ed                	jne    800965 <strncpy+0x14>
+  }
+  return ret;
+}
+  800978:	89 f0                	mov    %esi,%eax
+  80097a:	5b                   	pop    %ebx
+  80097b:	5e                   	pop    %esi
+  80097c:	5d                   	pop    %ebp
+  80097d:	c3                   	ret
+
+0080097e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80097e:	55                   	push   %ebp
+  80097f:	89 e5                	mov    %esp,%ebp
+  800981:	56                   	push   %esi
+  800982:	53                   	push   %ebx
+  800983:	8b 75 08             	mov    0x8(%ebp),%esi
+  800986:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800989:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  80098c:	89 f0                	mov    %esi,%eax
+  80098e:	85 d2                	test   %edx,%edx
+  800990:	74 21                	je     8009b3 <strlcpy+0x35>
+  800992:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800996:	89 f2                	mov    %esi,%edx
+  800998:	eb 09                	jmp    8009a3 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  80099a:	83 c1 01             	add    $0x1,%ecx
+  80099d:	83 c2 01             	add    $0x1,%edx
+  8009a0:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8009a3:	39 c2                	cmp    %eax,%edx
+  8009a5:	74 09                	je     8009b0 <strlcpy+0x32>
+  8009a7:	0f b6 19             	movzbl (%ecx),%ebx
+  8009aa:	84 db                	test   %bl,%bl
+  8009ac:	75 ec                	jne    80099a <strlcpy+0x1c>
+  8009ae:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8009b0:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8009b3:	29 f0                	sub    %esi,%eax
+}
+  8009b5:	5b                   	pop    %ebx
+  8009b6:	5e                   	pop    %esi
+  8009b7:	5d                   	pop    %ebp
+  8009b8:	c3                   	ret
+
+008009b9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009b9:	55                   	push   %ebp
+  8009ba:	89 e5                	mov    %esp,%ebp
+  8009bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8009c2:	eb 06                	jmp    8009ca <strcmp+0x11>
+    p++, q++;
+  8009c4:	83 c1 01             	add    $0x1,%ecx
+  8009c7:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8009ca:	0f b6 01             	movzbl (%ecx),%eax
+  8009cd:	84 c0                	test   %al,%al
+  8009cf:	74 04                	je     8009d5 <strcmp+0x1c>
+  8009d1:	3a 02                	cmp    (%edx),%al
+  8009d3:	74 ef                	je     8009c4 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8009d5:	0f b6 c0             	movzbl %al,%eax
+  8009d8:	0f b6 12             	movzbl (%edx),%edx
+  8009db:	29 d0                	sub    %edx,%eax
+}
+  8009dd:	5d                   	pop    %ebp
+  8009de:	c3                   	ret
+
+008009df <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009df:	55                   	push   %ebp
+  8009e0:	89 e5                	mov    %esp,%ebp
+  8009e2:	53                   	push   %ebx
+  8009e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e9:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  8009ec:	eb 09                	jmp    8009f7 <strncmp+0x18>
+    n--, p++, q++;
+  8009ee:	83 ea 01             	sub    $0x1,%edx
+  8009f1:	83 c0 01             	add    $0x1,%eax
+  8009f4:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  8009f7:	85 d2                	test   %edx,%edx
+  8009f9:	74 18                	je     800a13 <strncmp+0x34>
+  8009fb:	0f b6 18             	movzbl (%eax),%ebx
+  8009fe:	84 db                	test   %bl,%bl
+  800a00:	74 04                	je     800a06 <strncmp+0x27>
+  800a02:	3a 19                	cmp    (%ecx),%bl
+  800a04:	74 e8                	je     8009ee <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800a06:	0f b6 00             	movzbl (%eax),%eax
+  800a09:	0f b6 11             	movzbl (%ecx),%edx
+  800a0c:	29 d0                	sub    %edx,%eax
+}
+  800a0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a11:	c9                   	leave
+  800a12:	c3                   	ret
+    return 0;
+  800a13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a18:	eb f4                	jmp    800a0e <strncmp+0x2f>
+
+00800a1a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a1a:	55                   	push   %ebp
+  800a1b:	89 e5                	mov    %esp,%ebp
+  800a1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a20:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800a24:	eb 03                	jmp    800a29 <strchr+0xf>
+  800a26:	83 c0 01             	add    $0x1,%eax
+  800a29:	0f b6 10             	movzbl (%eax),%edx
+  800a2c:	84 d2                	test   %dl,%dl
+  800a2e:	74 06                	je     800a36 <strchr+0x1c>
+    if (*s == c)
+  800a30:	38 ca                	cmp    %cl,%dl
+  800a32:	75 f2                	jne    800a26 <strchr+0xc>
+  800a34:	eb 05                	jmp    800a3b <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800a36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a3b:	5d                   	pop    %ebp
+  800a3c:	c3                   	ret
+
+00800a3d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a3d:	55                   	push   %ebp
+  800a3e:	89 e5                	mov    %esp,%ebp
+  800a40:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a43:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800a47:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800a4a:	38 ca                	cmp    %cl,%dl
+  800a4c:	74 09                	je     800a57 <strfind+0x1a>
+  800a4e:	84 d2                	test   %dl,%dl
+  800a50:	74 05                	je     800a57 <strfind+0x1a>
+  for (; *s; s++)
+  800a52:	83 c0 01             	add    $0x1,%eax
+  800a55:	eb f0                	jmp    800a47 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800a57:	5d                   	pop    %ebp
+  800a58:	c3                   	ret
+
+00800a59 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a59:	55                   	push   %ebp
+  800a5a:	89 e5                	mov    %esp,%ebp
+  800a5c:	57                   	push   %edi
+  800a5d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a60:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800a63:	85 c9                	test   %ecx,%ecx
+  800a65:	74 20                	je     800a87 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800a67:	89 f8                	mov    %edi,%eax
+  800a69:	09 c8                	or     %ecx,%eax
+  800a6b:	a8 03                	test   $0x3,%al
+  800a6d:	75 12                	jne    800a81 <memset+0x28>
+    c &= 0xFF;
+  800a6f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a73:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800a79:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800a7c:	fc                   	cld
+  800a7d:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a7f:	eb 06                	jmp    800a87 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800a81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a84:	fc                   	cld
+  800a85:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800a87:	89 f8                	mov    %edi,%eax
+  800a89:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a8c:	c9                   	leave
+  800a8d:	c3                   	ret
+
+00800a8e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a8e:	55                   	push   %ebp
+  800a8f:	89 e5                	mov    %esp,%ebp
+  800a91:	57                   	push   %edi
+  800a92:	56                   	push   %esi
+  800a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a96:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a99:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800a9c:	39 c6                	cmp    %eax,%esi
+  800a9e:	73 32                	jae    800ad2 <memmove+0x44>
+  800aa0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800aa3:	39 d0                	cmp    %edx,%eax
+  800aa5:	73 2b                	jae    800ad2 <memmove+0x44>
+    s += n;
+    d += n;
+  800aa7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aaa:	89 d6                	mov    %edx,%esi
+  800aac:	09 fe                	or     %edi,%esi
+  800aae:	09 ce                	or     %ecx,%esi
+  800ab0:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ab6:	75 0e                	jne    800ac6 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ab8:	83 ef 04             	sub    $0x4,%edi
+  800abb:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800abe:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800ac1:	fd                   	std
+  800ac2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ac4:	eb 09                	jmp    800acf <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ac6:	83 ef 01             	sub    $0x1,%edi
+  800ac9:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800acc:	fd                   	std
+  800acd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800acf:	fc                   	cld
+  800ad0:	eb 1a                	jmp    800aec <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ad2:	89 f2                	mov    %esi,%edx
+  800ad4:	09 c2                	or     %eax,%edx
+  800ad6:	09 ca                	or     %ecx,%edx
+  800ad8:	f6 c2 03             	test   $0x3,%dl
+  800adb:	75 0a                	jne    800ae7 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800add:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800ae0:	89 c7                	mov    %eax,%edi
+  800ae2:	fc                   	cld
+  800ae3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ae5:	eb 05                	jmp    800aec <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800ae7:	89 c7                	mov    %eax,%edi
+  800ae9:	fc                   	cld
+  800aea:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800aec:	5e                   	pop    %esi
+  800aed:	5f                   	pop    %edi
+  800aee:	5d                   	pop    %ebp
+  800aef:	c3                   	ret
+
+00800af0 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800af0:	55                   	push   %ebp
+  800af1:	89 e5                	mov    %esp,%ebp
+  800af3:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800af6:	ff 75 10             	push   0x10(%ebp)
+  800af9:	ff 75 0c             	push   0xc(%ebp)
+  800afc:	ff 75 08             	push   0x8(%ebp)
+  800aff:	e8 8a ff ff ff       	call   800a8e <memmove>
+}
+  800b04:	c9                   	leave
+  800b05:	c3                   	ret
+
+00800b06 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b06:	55                   	push   %ebp
+  800b07:	89 e5                	mov    %esp,%ebp
+  800b09:	56                   	push   %esi
+  800b0a:	53                   	push   %ebx
+  800b0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800b11:	89 c6                	mov    %eax,%esi
+  800b13:	03 75 10             	add    0x10(%ebp),%esi
+  800b16:	eb 06                	jmp    800b1e <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800b18:	83 c0 01             	add    $0x1,%eax
+  800b1b:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800b1e:	39 f0                	cmp    %esi,%eax
+  800b20:	74 14                	je     800b36 <memcmp+0x30>
+    if (*s1 != *s2)
+  800b22:	0f b6 08             	movzbl (%eax),%ecx
+  800b25:	0f b6 1a             	movzbl (%edx),%ebx
+  800b28:	38 d9                	cmp    %bl,%cl
+  800b2a:	74 ec                	je     800b18 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800b2c:	0f b6 c1             	movzbl %cl,%eax
+  800b2f:	0f b6 db             	movzbl %bl,%ebx
+  800b32:	29 d8                	sub    %ebx,%eax
+  800b34:	eb 05                	jmp    800b3b <memcmp+0x35>
+  }
+
+  return 0;
+  800b36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b3b:	5b                   	pop    %ebx
+  800b3c:	5e                   	pop    %esi
+  800b3d:	5d                   	pop    %ebp
+  800b3e:	c3                   	ret
+
+00800b3f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b3f:	55                   	push   %ebp
+  800b40:	89 e5                	mov    %esp,%ebp
+  800b42:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800b48:	89 c2                	mov    %eax,%edx
+  800b4a:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800b4d:	eb 03                	jmp    800b52 <memfind+0x13>
+  800b4f:	83 c0 01             	add    $0x1,%eax
+  800b52:	39 d0                	cmp    %edx,%eax
+  800b54:	73 04                	jae    800b5a <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800b56:	38 08                	cmp    %cl,(%eax)
+  800b58:	75 f5                	jne    800b4f <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800b5a:	5d                   	pop    %ebp
+  800b5b:	c3                   	ret
+
+00800b5c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b5c:	55                   	push   %ebp
+  800b5d:	89 e5                	mov    %esp,%ebp
+  800b5f:	57                   	push   %edi
+  800b60:	56                   	push   %esi
+  800b61:	53                   	push   %ebx
+  800b62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800b68:	eb 03                	jmp    800b6d <strtol+0x11>
+    s++;
+  800b6a:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800b6d:	0f b6 02             	movzbl (%edx),%eax
+  800b70:	3c 20                	cmp    $0x20,%al
+  800b72:	74 f6                	je     800b6a <strtol+0xe>
+  800b74:	3c 09                	cmp    $0x9,%al
+  800b76:	74 f2                	je     800b6a <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800b78:	3c 2b                	cmp    $0x2b,%al
+  800b7a:	74 2a                	je     800ba6 <strtol+0x4a>
+  int neg = 0;
+  800b7c:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800b81:	3c 2d                	cmp    $0x2d,%al
+  800b83:	74 2b                	je     800bb0 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b85:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b8b:	75 0f                	jne    800b9c <strtol+0x40>
+  800b8d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b90:	74 28                	je     800bba <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800b92:	85 db                	test   %ebx,%ebx
+  800b94:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b99:	0f 44 d8             	cmove  %eax,%ebx
+  800b9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba1:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ba4:	eb 46                	jmp    800bec <strtol+0x90>
+    s++;
+  800ba6:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800ba9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bae:	eb d5                	jmp    800b85 <strtol+0x29>
+    s++, neg = 1;
+  800bb0:	83 c2 01             	add    $0x1,%edx
+  800bb3:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bb8:	eb cb                	jmp    800b85 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bba:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bbe:	74 0e                	je     800bce <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800bc0:	85 db                	test   %ebx,%ebx
+  800bc2:	75 d8                	jne    800b9c <strtol+0x40>
+    s++, base = 8;
+  800bc4:	83 c2 01             	add    $0x1,%edx
+  800bc7:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bcc:	eb ce                	jmp    800b9c <strtol+0x40>
+    s += 2, base = 16;
+  800bce:	83 c2 02             	add    $0x2,%edx
+  800bd1:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bd6:	eb c4                	jmp    800b9c <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800bd8:	0f be c0             	movsbl %al,%eax
+  800bdb:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800bde:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800be1:	7d 3a                	jge    800c1d <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800be3:	83 c2 01             	add    $0x1,%edx
+  800be6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bea:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800bec:	0f b6 02             	movzbl (%edx),%eax
+  800bef:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bf2:	89 f3                	mov    %esi,%ebx
+  800bf4:	80 fb 09             	cmp    $0x9,%bl
+  800bf7:	76 df                	jbe    800bd8 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800bf9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bfc:	89 f3                	mov    %esi,%ebx
+  800bfe:	80 fb 19             	cmp    $0x19,%bl
+  800c01:	77 08                	ja     800c0b <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800c03:	0f be c0             	movsbl %al,%eax
+  800c06:	83 e8 57             	sub    $0x57,%eax
+  800c09:	eb d3                	jmp    800bde <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800c0b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c0e:	89 f3                	mov    %esi,%ebx
+  800c10:	80 fb 19             	cmp    $0x19,%bl
+  800c13:	77 08                	ja     800c1d <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800c15:	0f be c0             	movsbl %al,%eax
+  800c18:	83 e8 37             	sub    $0x37,%eax
+  800c1b:	eb c1                	jmp    800bde <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800c1d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c21:	74 05                	je     800c28 <strtol+0xcc>
+    *endptr = (char*)s;
+  800c23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c26:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800c28:	89 c8                	mov    %ecx,%eax
+  800c2a:	f7 d8                	neg    %eax
+  800c2c:	85 ff                	test   %edi,%edi
+  800c2e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c31:	89 c8                	mov    %ecx,%eax
+  800c33:	5b                   	pop    %ebx
+  800c34:	5e                   	pop    %esi
+  800c35:	5f                   	pop    %edi
+  800c36:	5d                   	pop    %ebp
+  800c37:	c3                   	ret
+
+00800c38 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c38:	55                   	push   %ebp
+  800c39:	89 e5                	mov    %esp,%ebp
+  800c3b:	57                   	push   %edi
+  800c3c:	56                   	push   %esi
+  800c3d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c49:	89 c3                	mov    %eax,%ebx
+  800c4b:	89 c7                	mov    %eax,%edi
+  800c4d:	89 c6                	mov    %eax,%esi
+  800c4f:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c51:	5b                   	pop    %ebx
+  800c52:	5e                   	pop    %esi
+  800c53:	5f                   	pop    %edi
+  800c54:	5d                   	pop    %ebp
+  800c55:	c3                   	ret
+
+00800c56 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c56:	55                   	push   %ebp
+  800c57:	89 e5                	mov    %esp,%ebp
+  800c59:	57                   	push   %edi
+  800c5a:	56                   	push   %esi
+  800c5b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c61:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c66:	89 d1                	mov    %edx,%ecx
+  800c68:	89 d3                	mov    %edx,%ebx
+  800c6a:	89 d7                	mov    %edx,%edi
+  800c6c:	89 d6                	mov    %edx,%esi
+  800c6e:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c70:	5b                   	pop    %ebx
+  800c71:	5e                   	pop    %esi
+  800c72:	5f                   	pop    %edi
+  800c73:	5d                   	pop    %ebp
+  800c74:	c3                   	ret
+
+00800c75 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c75:	55                   	push   %ebp
+  800c76:	89 e5                	mov    %esp,%ebp
+  800c78:	57                   	push   %edi
+  800c79:	56                   	push   %esi
+  800c7a:	53                   	push   %ebx
+  800c7b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c86:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c8b:	89 cb                	mov    %ecx,%ebx
+  800c8d:	89 cf                	mov    %ecx,%edi
+  800c8f:	89 ce                	mov    %ecx,%esi
+  800c91:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c93:	85 c0                	test   %eax,%eax
+  800c95:	7f 08                	jg     800c9f <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9a:	5b                   	pop    %ebx
+  800c9b:	5e                   	pop    %esi
+  800c9c:	5f                   	pop    %edi
+  800c9d:	5d                   	pop    %ebp
+  800c9e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c9f:	83 ec 0c             	sub    $0xc,%esp
+  800ca2:	50                   	push   %eax
+  800ca3:	6a 03                	push   $0x3
+  800ca5:	68 a3 3e 80 00       	push   $0x803ea3
+  800caa:	6a 23                	push   $0x23
+  800cac:	68 c0 3e 80 00       	push   $0x803ec0
+  800cb1:	e8 89 f5 ff ff       	call   80023f <_panic>
+
+00800cb6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cb6:	55                   	push   %ebp
+  800cb7:	89 e5                	mov    %esp,%ebp
+  800cb9:	57                   	push   %edi
+  800cba:	56                   	push   %esi
+  800cbb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc1:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cc6:	89 d1                	mov    %edx,%ecx
+  800cc8:	89 d3                	mov    %edx,%ebx
+  800cca:	89 d7                	mov    %edx,%edi
+  800ccc:	89 d6                	mov    %edx,%esi
+  800cce:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cd0:	5b                   	pop    %ebx
+  800cd1:	5e                   	pop    %esi
+  800cd2:	5f                   	pop    %edi
+  800cd3:	5d                   	pop    %ebp
+  800cd4:	c3                   	ret
+
+00800cd5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	57                   	push   %edi
+  800cd9:	56                   	push   %esi
+  800cda:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ce5:	89 d1                	mov    %edx,%ecx
+  800ce7:	89 d3                	mov    %edx,%ebx
+  800ce9:	89 d7                	mov    %edx,%edi
+  800ceb:	89 d6                	mov    %edx,%esi
+  800ced:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cef:	5b                   	pop    %ebx
+  800cf0:	5e                   	pop    %esi
+  800cf1:	5f                   	pop    %edi
+  800cf2:	5d                   	pop    %ebp
+  800cf3:	c3                   	ret
+
+00800cf4 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800cf4:	55                   	push   %ebp
+  800cf5:	89 e5                	mov    %esp,%ebp
+  800cf7:	57                   	push   %edi
+  800cf8:	56                   	push   %esi
+  800cf9:	53                   	push   %ebx
+  800cfa:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800cfd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800d01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d09:	b8 14 00 00 00       	mov    $0x14,%eax
+  800d0e:	89 df                	mov    %ebx,%edi
+  800d10:	89 de                	mov    %ebx,%esi
+  800d12:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d14:	85 c0                	test   %eax,%eax
+  800d16:	7f 08                	jg     800d20 <sys_env_set_cow+0x2c>
+}
+  800d18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1b:	5b                   	pop    %ebx
+  800d1c:	5e                   	pop    %esi
+  800d1d:	5f                   	pop    %edi
+  800d1e:	5d                   	pop    %ebp
+  800d1f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d20:	83 ec 0c             	sub    $0xc,%esp
+  800d23:	50                   	push   %eax
+  800d24:	6a 14                	push   $0x14
+  800d26:	68 a3 3e 80 00       	push   $0x803ea3
+  800d2b:	6a 23                	push   $0x23
+  800d2d:	68 c0 3e 80 00       	push   $0x803ec0
+  800d32:	e8 08 f5 ff ff       	call   80023f <_panic>
+
+00800d37 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d37:	55                   	push   %ebp
+  800d38:	89 e5                	mov    %esp,%ebp
+  800d3a:	57                   	push   %edi
+  800d3b:	56                   	push   %esi
+  800d3c:	53                   	push   %ebx
+  800d3d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d40:	be 00 00 00 00       	mov    $0x0,%esi
+  800d45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d53:	89 f7                	mov    %esi,%edi
+  800d55:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d57:	85 c0                	test   %eax,%eax
+  800d59:	7f 08                	jg     800d63 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800d5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d5e:	5b                   	pop    %ebx
+  800d5f:	5e                   	pop    %esi
+  800d60:	5f                   	pop    %edi
+  800d61:	5d                   	pop    %ebp
+  800d62:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d63:	83 ec 0c             	sub    $0xc,%esp
+  800d66:	50                   	push   %eax
+  800d67:	6a 04                	push   $0x4
+  800d69:	68 a3 3e 80 00       	push   $0x803ea3
+  800d6e:	6a 23                	push   $0x23
+  800d70:	68 c0 3e 80 00       	push   $0x803ec0
+  800d75:	e8 c5 f4 ff ff       	call   80023f <_panic>
+
+00800d7a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d7a:	55                   	push   %ebp
+  800d7b:	89 e5                	mov    %esp,%ebp
+  800d7d:	57                   	push   %edi
+  800d7e:	56                   	push   %esi
+  800d7f:	53                   	push   %ebx
+  800d80:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d89:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d91:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d94:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d97:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d99:	85 c0                	test   %eax,%eax
+  800d9b:	7f 08                	jg     800da5 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800d9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da0:	5b                   	pop    %ebx
+  800da1:	5e                   	pop    %esi
+  800da2:	5f                   	pop    %edi
+  800da3:	5d                   	pop    %ebp
+  800da4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800da5:	83 ec 0c             	sub    $0xc,%esp
+  800da8:	50                   	push   %eax
+  800da9:	6a 05                	push   $0x5
+  800dab:	68 a3 3e 80 00       	push   $0x803ea3
+  800db0:	6a 23                	push   $0x23
+  800db2:	68 c0 3e 80 00       	push   $0x803ec0
+  800db7:	e8 83 f4 ff ff       	call   80023f <_panic>
+
+00800dbc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dbc:	55                   	push   %ebp
+  800dbd:	89 e5                	mov    %esp,%ebp
+  800dbf:	57                   	push   %edi
+  800dc0:	56                   	push   %esi
+  800dc1:	53                   	push   %ebx
+  800dc2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd0:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dd5:	89 df                	mov    %ebx,%edi
+  800dd7:	89 de                	mov    %ebx,%esi
+  800dd9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ddb:	85 c0                	test   %eax,%eax
+  800ddd:	7f 08                	jg     800de7 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800ddf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de2:	5b                   	pop    %ebx
+  800de3:	5e                   	pop    %esi
+  800de4:	5f                   	pop    %edi
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800de7:	83 ec 0c             	sub    $0xc,%esp
+  800dea:	50                   	push   %eax
+  800deb:	6a 06                	push   $0x6
+  800ded:	68 a3 3e 80 00       	push   $0x803ea3
+  800df2:	6a 23                	push   $0x23
+  800df4:	68 c0 3e 80 00       	push   $0x803ec0
+  800df9:	e8 41 f4 ff ff       	call   80023f <_panic>
+
+00800dfe <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	57                   	push   %edi
+  800e02:	56                   	push   %esi
+  800e03:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e0a:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e0f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e12:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e15:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e18:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800e1a:	5b                   	pop    %ebx
+  800e1b:	5e                   	pop    %esi
+  800e1c:	5f                   	pop    %edi
+  800e1d:	5d                   	pop    %ebp
+  800e1e:	c3                   	ret
+
+00800e1f <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800e1f:	55                   	push   %ebp
+  800e20:	89 e5                	mov    %esp,%ebp
+  800e22:	57                   	push   %edi
+  800e23:	56                   	push   %esi
+  800e24:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2b:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e30:	be 00 00 00 00       	mov    $0x0,%esi
+  800e35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e38:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e3b:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800e3d:	5b                   	pop    %ebx
+  800e3e:	5e                   	pop    %esi
+  800e3f:	5f                   	pop    %edi
+  800e40:	5d                   	pop    %ebp
+  800e41:	c3                   	ret
+
+00800e42 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	57                   	push   %edi
+  800e46:	56                   	push   %esi
+  800e47:	53                   	push   %ebx
+  800e48:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e56:	b8 16 00 00 00       	mov    $0x16,%eax
+  800e5b:	89 df                	mov    %ebx,%edi
+  800e5d:	89 de                	mov    %ebx,%esi
+  800e5f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e61:	85 c0                	test   %eax,%eax
+  800e63:	7f 08                	jg     800e6d <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800e65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e68:	5b                   	pop    %ebx
+  800e69:	5e                   	pop    %esi
+  800e6a:	5f                   	pop    %edi
+  800e6b:	5d                   	pop    %ebp
+  800e6c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e6d:	83 ec 0c             	sub    $0xc,%esp
+  800e70:	50                   	push   %eax
+  800e71:	6a 16                	push   $0x16
+  800e73:	68 a3 3e 80 00       	push   $0x803ea3
+  800e78:	6a 23                	push   $0x23
+  800e7a:	68 c0 3e 80 00       	push   $0x803ec0
+  800e7f:	e8 bb f3 ff ff       	call   80023f <_panic>
+
+00800e84 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800e84:	55                   	push   %ebp
+  800e85:	89 e5                	mov    %esp,%ebp
+  800e87:	57                   	push   %edi
+  800e88:	56                   	push   %esi
+  800e89:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e92:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e97:	89 cb                	mov    %ecx,%ebx
+  800e99:	89 cf                	mov    %ecx,%edi
+  800e9b:	89 ce                	mov    %ecx,%esi
+  800e9d:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800e9f:	5b                   	pop    %ebx
+  800ea0:	5e                   	pop    %esi
+  800ea1:	5f                   	pop    %edi
+  800ea2:	5d                   	pop    %ebp
+  800ea3:	c3                   	ret
+
+00800ea4 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800ea4:	55                   	push   %ebp
+  800ea5:	89 e5                	mov    %esp,%ebp
+  800ea7:	57                   	push   %edi
+  800ea8:	56                   	push   %esi
+  800ea9:	53                   	push   %ebx
+  800eaa:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ead:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb8:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ebd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec0:	89 f7                	mov    %esi,%edi
+  800ec2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ec4:	85 c0                	test   %eax,%eax
+  800ec6:	7f 08                	jg     800ed0 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800ec8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecb:	5b                   	pop    %ebx
+  800ecc:	5e                   	pop    %esi
+  800ecd:	5f                   	pop    %edi
+  800ece:	5d                   	pop    %ebp
+  800ecf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ed0:	83 ec 0c             	sub    $0xc,%esp
+  800ed3:	50                   	push   %eax
+  800ed4:	6a 18                	push   $0x18
+  800ed6:	68 a3 3e 80 00       	push   $0x803ea3
+  800edb:	6a 23                	push   $0x23
+  800edd:	68 c0 3e 80 00       	push   $0x803ec0
+  800ee2:	e8 58 f3 ff ff       	call   80023f <_panic>
+
+00800ee7 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	57                   	push   %edi
+  800eeb:	56                   	push   %esi
+  800eec:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800eed:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef8:	b8 19 00 00 00       	mov    $0x19,%eax
+  800efd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f00:	89 f7                	mov    %esi,%edi
+  800f02:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800f04:	5b                   	pop    %ebx
+  800f05:	5e                   	pop    %esi
+  800f06:	5f                   	pop    %edi
+  800f07:	5d                   	pop    %ebp
+  800f08:	c3                   	ret
+
+00800f09 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	57                   	push   %edi
+  800f0d:	56                   	push   %esi
+  800f0e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f14:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f19:	89 d1                	mov    %edx,%ecx
+  800f1b:	89 d3                	mov    %edx,%ebx
+  800f1d:	89 d7                	mov    %edx,%edi
+  800f1f:	89 d6                	mov    %edx,%esi
+  800f21:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f23:	5b                   	pop    %ebx
+  800f24:	5e                   	pop    %esi
+  800f25:	5f                   	pop    %edi
+  800f26:	5d                   	pop    %ebp
+  800f27:	c3                   	ret
+
+00800f28 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f28:	55                   	push   %ebp
+  800f29:	89 e5                	mov    %esp,%ebp
+  800f2b:	57                   	push   %edi
+  800f2c:	56                   	push   %esi
+  800f2d:	53                   	push   %ebx
+  800f2e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3c:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f41:	89 df                	mov    %ebx,%edi
+  800f43:	89 de                	mov    %ebx,%esi
+  800f45:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f47:	85 c0                	test   %eax,%eax
+  800f49:	7f 08                	jg     800f53 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5e                   	pop    %esi
+  800f50:	5f                   	pop    %edi
+  800f51:	5d                   	pop    %ebp
+  800f52:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f53:	83 ec 0c             	sub    $0xc,%esp
+  800f56:	50                   	push   %eax
+  800f57:	6a 08                	push   $0x8
+  800f59:	68 a3 3e 80 00       	push   $0x803ea3
+  800f5e:	6a 23                	push   $0x23
+  800f60:	68 c0 3e 80 00       	push   $0x803ec0
+  800f65:	e8 d5 f2 ff ff       	call   80023f <_panic>
+
+00800f6a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f6a:	55                   	push   %ebp
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	57                   	push   %edi
+  800f6e:	56                   	push   %esi
+  800f6f:	53                   	push   %ebx
+  800f70:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7e:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f83:	89 df                	mov    %ebx,%edi
+  800f85:	89 de                	mov    %ebx,%esi
+  800f87:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f89:	85 c0                	test   %eax,%eax
+  800f8b:	7f 08                	jg     800f95 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800f8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f90:	5b                   	pop    %ebx
+  800f91:	5e                   	pop    %esi
+  800f92:	5f                   	pop    %edi
+  800f93:	5d                   	pop    %ebp
+  800f94:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f95:	83 ec 0c             	sub    $0xc,%esp
+  800f98:	50                   	push   %eax
+  800f99:	6a 09                	push   $0x9
+  800f9b:	68 a3 3e 80 00       	push   $0x803ea3
+  800fa0:	6a 23                	push   $0x23
+  800fa2:	68 c0 3e 80 00       	push   $0x803ec0
+  800fa7:	e8 93 f2 ff ff       	call   80023f <_panic>
+
+00800fac <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fac:	55                   	push   %ebp
+  800fad:	89 e5                	mov    %esp,%ebp
+  800faf:	57                   	push   %edi
+  800fb0:	56                   	push   %esi
+  800fb1:	53                   	push   %ebx
+  800fb2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fc5:	89 df                	mov    %ebx,%edi
+  800fc7:	89 de                	mov    %ebx,%esi
+  800fc9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fcb:	85 c0                	test   %eax,%eax
+  800fcd:	7f 08                	jg     800fd7 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800fcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd2:	5b                   	pop    %ebx
+  800fd3:	5e                   	pop    %esi
+  800fd4:	5f                   	pop    %edi
+  800fd5:	5d                   	pop    %ebp
+  800fd6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fd7:	83 ec 0c             	sub    $0xc,%esp
+  800fda:	50                   	push   %eax
+  800fdb:	6a 0a                	push   $0xa
+  800fdd:	68 a3 3e 80 00       	push   $0x803ea3
+  800fe2:	6a 23                	push   $0x23
+  800fe4:	68 c0 3e 80 00       	push   $0x803ec0
+  800fe9:	e8 51 f2 ff ff       	call   80023f <_panic>
+
+00800fee <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	57                   	push   %edi
+  800ff2:	56                   	push   %esi
+  800ff3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ff4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffa:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801002:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801005:	8b 75 18             	mov    0x18(%ebp),%esi
+  801008:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  80100a:	5b                   	pop    %ebx
+  80100b:	5e                   	pop    %esi
+  80100c:	5f                   	pop    %edi
+  80100d:	5d                   	pop    %ebp
+  80100e:	c3                   	ret
+
+0080100f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	57                   	push   %edi
+  801013:	56                   	push   %esi
+  801014:	53                   	push   %ebx
+  801015:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801018:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801020:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801023:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801028:	89 df                	mov    %ebx,%edi
+  80102a:	89 de                	mov    %ebx,%esi
+  80102c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80102e:	85 c0                	test   %eax,%eax
+  801030:	7f 08                	jg     80103a <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  801032:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801035:	5b                   	pop    %ebx
+  801036:	5e                   	pop    %esi
+  801037:	5f                   	pop    %edi
+  801038:	5d                   	pop    %ebp
+  801039:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80103a:	83 ec 0c             	sub    $0xc,%esp
+  80103d:	50                   	push   %eax
+  80103e:	6a 0d                	push   $0xd
+  801040:	68 a3 3e 80 00       	push   $0x803ea3
+  801045:	6a 23                	push   $0x23
+  801047:	68 c0 3e 80 00       	push   $0x803ec0
+  80104c:	e8 ee f1 ff ff       	call   80023f <_panic>
+
+00801051 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	57                   	push   %edi
+  801055:	56                   	push   %esi
+  801056:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801057:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801061:	89 d1                	mov    %edx,%ecx
+  801063:	89 d3                	mov    %edx,%ebx
+  801065:	89 d7                	mov    %edx,%edi
+  801067:	89 d6                	mov    %edx,%esi
+  801069:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80106b:	5b                   	pop    %ebx
+  80106c:	5e                   	pop    %esi
+  80106d:	5f                   	pop    %edi
+  80106e:	5d                   	pop    %ebp
+  80106f:	c3                   	ret
+
+00801070 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801070:	55                   	push   %ebp
+  801071:	89 e5                	mov    %esp,%ebp
+  801073:	57                   	push   %edi
+  801074:	56                   	push   %esi
+  801075:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801076:	8b 55 08             	mov    0x8(%ebp),%edx
+  801079:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801081:	be 00 00 00 00       	mov    $0x0,%esi
+  801086:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801089:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80108c:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  80108e:	5b                   	pop    %ebx
+  80108f:	5e                   	pop    %esi
+  801090:	5f                   	pop    %edi
+  801091:	5d                   	pop    %ebp
+  801092:	c3                   	ret
+
+00801093 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	57                   	push   %edi
+  801097:	56                   	push   %esi
+  801098:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801099:	be 00 00 00 00       	mov    $0x0,%esi
+  80109e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a4:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ac:	89 f7                	mov    %esi,%edi
+  8010ae:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8010b0:	5b                   	pop    %ebx
+  8010b1:	5e                   	pop    %esi
+  8010b2:	5f                   	pop    %edi
+  8010b3:	5d                   	pop    %ebp
+  8010b4:	c3                   	ret
+
+008010b5 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	57                   	push   %edi
+  8010b9:	56                   	push   %esi
+  8010ba:	53                   	push   %ebx
+  8010bb:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8010be:	80 3d a4 68 80 00 00 	cmpb   $0x0,0x8068a4
+  8010c5:	74 41                	je     801108 <sys_batch+0x53>
+  8010c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010ca:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8010cd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8010d4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010d7:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8010da:	7d 45                	jge    801121 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8010dc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8010df:	8b 06                	mov    (%esi),%eax
+  8010e1:	8b 56 04             	mov    0x4(%esi),%edx
+  8010e4:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8010e7:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8010ea:	8b 7e 10             	mov    0x10(%esi),%edi
+  8010ed:	8b 76 14             	mov    0x14(%esi),%esi
+  8010f0:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8010f2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8010f5:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8010f8:	83 c6 1c             	add    $0x1c,%esi
+  8010fb:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8010fe:	85 c0                	test   %eax,%eax
+  801100:	78 1f                	js     801121 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  801102:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801106:	eb cc                	jmp    8010d4 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801108:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801112:	8b 55 08             	mov    0x8(%ebp),%edx
+  801115:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801118:	89 df                	mov    %ebx,%edi
+  80111a:	89 de                	mov    %ebx,%esi
+  80111c:	cd 30                	int    $0x30
+  80111e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801121:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801124:	83 c4 08             	add    $0x8,%esp
+  801127:	5b                   	pop    %ebx
+  801128:	5e                   	pop    %esi
+  801129:	5f                   	pop    %edi
+  80112a:	5d                   	pop    %ebp
+  80112b:	c3                   	ret
+
+0080112c <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  80112c:	55                   	push   %ebp
+  80112d:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80112f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801132:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801138:	5d                   	pop    %ebp
+  801139:	c3                   	ret
+
+0080113a <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  80113a:	55                   	push   %ebp
+  80113b:	89 e5                	mov    %esp,%ebp
+  80113d:	56                   	push   %esi
+  80113e:	53                   	push   %ebx
+  80113f:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  801142:	8b 1e                	mov    (%esi),%ebx
+  801144:	85 db                	test   %ebx,%ebx
+  801146:	75 09                	jne    801151 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801148:	89 d8                	mov    %ebx,%eax
+  80114a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80114d:	5b                   	pop    %ebx
+  80114e:	5e                   	pop    %esi
+  80114f:	5d                   	pop    %ebp
+  801150:	c3                   	ret
+  b->sb_n = 0;
+  801151:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801157:	53                   	push   %ebx
+  801158:	8d 46 04             	lea    0x4(%esi),%eax
+  80115b:	50                   	push   %eax
+  80115c:	e8 54 ff ff ff       	call   8010b5 <sys_batch>
+  801161:	83 c4 08             	add    $0x8,%esp
+  801164:	85 c0                	test   %eax,%eax
+  801166:	78 1e                	js     801186 <sysbatch_flush+0x4c>
+  if (r < n)
+  801168:	39 c3                	cmp    %eax,%ebx
+  80116a:	7f 07                	jg     801173 <sysbatch_flush+0x39>
+  return 0;
+  80116c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801171:	eb d5                	jmp    801148 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801173:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801176:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  80117a:	85 db                	test   %ebx,%ebx
+  80117c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801181:	0f 49 d8             	cmovns %eax,%ebx
+  801184:	eb c2                	jmp    801148 <sysbatch_flush+0xe>
+    return r;
+  801186:	89 c3                	mov    %eax,%ebx
+  801188:	eb be                	jmp    801148 <sysbatch_flush+0xe>
+
+0080118a <sysbatch_add>:
+{
+  80118a:	55                   	push   %ebp
+  80118b:	89 e5                	mov    %esp,%ebp
+  80118d:	53                   	push   %ebx
+  80118e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801191:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801194:	74 41                	je     8011d7 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801196:	8b 03                	mov    (%ebx),%eax
+  801198:	8d 50 01             	lea    0x1(%eax),%edx
+  80119b:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80119d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8011a0:	01 d8                	add    %ebx,%eax
+  8011a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011a5:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8011a8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8011ab:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8011ae:	8b 55 14             	mov    0x14(%ebp),%edx
+  8011b1:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8011b4:	8b 55 18             	mov    0x18(%ebp),%edx
+  8011b7:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8011ba:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8011bd:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8011c0:	8b 55 20             	mov    0x20(%ebp),%edx
+  8011c3:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8011c6:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8011cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011d5:	c9                   	leave
+  8011d6:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8011d7:	53                   	push   %ebx
+  8011d8:	e8 5d ff ff ff       	call   80113a <sysbatch_flush>
+  8011dd:	83 c4 04             	add    $0x4,%esp
+  8011e0:	85 c0                	test   %eax,%eax
+  8011e2:	79 b2                	jns    801196 <sysbatch_add+0xc>
+  8011e4:	eb ec                	jmp    8011d2 <sysbatch_add+0x48>
+
+008011e6 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	56                   	push   %esi
+  8011ea:	53                   	push   %ebx
+  8011eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  8011ee:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  8011f0:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  8011f3:	83 ec 0c             	sub    $0xc,%esp
+  8011f6:	50                   	push   %eax
+  8011f7:	e8 b4 1d 00 00       	call   802fb0 <mmap_fault>
+  8011fc:	83 c4 10             	add    $0x10,%esp
+  8011ff:	84 c0                	test   %al,%al
+  801201:	75 7d                	jne    801280 <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  801203:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801209:	74 7c                	je     801287 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  80120b:	89 d8                	mov    %ebx,%eax
+  80120d:	c1 e8 0c             	shr    $0xc,%eax
+  801210:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801217:	f6 c4 08             	test   $0x8,%ah
+  80121a:	74 7d                	je     801299 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  80121c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801222:	83 ec 04             	sub    $0x4,%esp
+  801225:	6a 07                	push   $0x7
+  801227:	68 00 f0 7f 00       	push   $0x7ff000
+  80122c:	6a 00                	push   $0x0
+  80122e:	e8 04 fb ff ff       	call   800d37 <sys_page_alloc>
+  801233:	83 c4 10             	add    $0x10,%esp
+  801236:	85 c0                	test   %eax,%eax
+  801238:	78 73                	js     8012ad <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  80123a:	83 ec 04             	sub    $0x4,%esp
+  80123d:	68 00 10 00 00       	push   $0x1000
+  801242:	53                   	push   %ebx
+  801243:	68 00 f0 7f 00       	push   $0x7ff000
+  801248:	e8 41 f8 ff ff       	call   800a8e <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80124d:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801254:	53                   	push   %ebx
+  801255:	6a 00                	push   $0x0
+  801257:	68 00 f0 7f 00       	push   $0x7ff000
+  80125c:	6a 00                	push   $0x0
+  80125e:	e8 17 fb ff ff       	call   800d7a <sys_page_map>
+  801263:	83 c4 20             	add    $0x20,%esp
+  801266:	85 c0                	test   %eax,%eax
+  801268:	78 55                	js     8012bf <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  80126a:	83 ec 08             	sub    $0x8,%esp
+  80126d:	68 00 f0 7f 00       	push   $0x7ff000
+  801272:	6a 00                	push   $0x0
+  801274:	e8 43 fb ff ff       	call   800dbc <sys_page_unmap>
+  801279:	83 c4 10             	add    $0x10,%esp
+  80127c:	85 c0                	test   %eax,%eax
+  80127e:	78 51                	js     8012d1 <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801280:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801283:	5b                   	pop    %ebx
+  801284:	5e                   	pop    %esi
+  801285:	5d                   	pop    %ebp
+  801286:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  801287:	56                   	push   %esi
+  801288:	68 ce 3e 80 00       	push   $0x803ece
+  80128d:	6a 1d                	push   $0x1d
+  80128f:	68 df 3e 80 00       	push   $0x803edf
+  801294:	e8 a6 ef ff ff       	call   80023f <_panic>
+    panic("user_pgfault: page not COW");
+  801299:	83 ec 04             	sub    $0x4,%esp
+  80129c:	68 ea 3e 80 00       	push   $0x803eea
+  8012a1:	6a 21                	push   $0x21
+  8012a3:	68 df 3e 80 00       	push   $0x803edf
+  8012a8:	e8 92 ef ff ff       	call   80023f <_panic>
+    panic("sys_page_alloc: %e", r);
+  8012ad:	50                   	push   %eax
+  8012ae:	68 05 3f 80 00       	push   $0x803f05
+  8012b3:	6a 2f                	push   $0x2f
+  8012b5:	68 df 3e 80 00       	push   $0x803edf
+  8012ba:	e8 80 ef ff ff       	call   80023f <_panic>
+    panic("sys_page_map: %e", r);
+  8012bf:	50                   	push   %eax
+  8012c0:	68 18 3f 80 00       	push   $0x803f18
+  8012c5:	6a 37                	push   $0x37
+  8012c7:	68 df 3e 80 00       	push   $0x803edf
+  8012cc:	e8 6e ef ff ff       	call   80023f <_panic>
+    panic("sys_page_unmap: %e", r);
+  8012d1:	50                   	push   %eax
+  8012d2:	68 29 3f 80 00       	push   $0x803f29
+  8012d7:	6a 3b                	push   $0x3b
+  8012d9:	68 df 3e 80 00       	push   $0x803edf
+  8012de:	e8 5c ef ff ff       	call   80023f <_panic>
+
+008012e3 <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  8012e3:	55                   	push   %ebp
+  8012e4:	89 e5                	mov    %esp,%ebp
+  8012e6:	53                   	push   %ebx
+  8012e7:	83 ec 10             	sub    $0x10,%esp
+  8012ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  8012ed:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  8012ef:	50                   	push   %eax
+  8012f0:	e8 bb 1c 00 00       	call   802fb0 <mmap_fault>
+  8012f5:	83 c4 10             	add    $0x10,%esp
+  8012f8:	84 c0                	test   %al,%al
+  8012fa:	74 05                	je     801301 <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  8012fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012ff:	c9                   	leave
+  801300:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801301:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801307:	83 ec 04             	sub    $0x4,%esp
+  80130a:	6a 07                	push   $0x7
+  80130c:	68 00 f0 7f 00       	push   $0x7ff000
+  801311:	6a 00                	push   $0x0
+  801313:	e8 1f fa ff ff       	call   800d37 <sys_page_alloc>
+  801318:	83 c4 10             	add    $0x10,%esp
+  80131b:	85 c0                	test   %eax,%eax
+  80131d:	78 5b                	js     80137a <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  80131f:	83 ec 04             	sub    $0x4,%esp
+  801322:	68 00 10 00 00       	push   $0x1000
+  801327:	53                   	push   %ebx
+  801328:	68 00 f0 7f 00       	push   $0x7ff000
+  80132d:	e8 5c f7 ff ff       	call   800a8e <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801332:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801339:	53                   	push   %ebx
+  80133a:	6a 00                	push   $0x0
+  80133c:	68 00 f0 7f 00       	push   $0x7ff000
+  801341:	6a 00                	push   $0x0
+  801343:	e8 32 fa ff ff       	call   800d7a <sys_page_map>
+  801348:	83 c4 20             	add    $0x20,%esp
+  80134b:	85 c0                	test   %eax,%eax
+  80134d:	78 40                	js     80138f <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  80134f:	83 ec 08             	sub    $0x8,%esp
+  801352:	68 00 f0 7f 00       	push   $0x7ff000
+  801357:	6a 00                	push   $0x0
+  801359:	e8 5e fa ff ff       	call   800dbc <sys_page_unmap>
+  80135e:	83 c4 10             	add    $0x10,%esp
+  801361:	85 c0                	test   %eax,%eax
+  801363:	79 97                	jns    8012fc <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  801365:	50                   	push   %eax
+  801366:	68 29 3f 80 00       	push   $0x803f29
+  80136b:	68 b0 00 00 00       	push   $0xb0
+  801370:	68 df 3e 80 00       	push   $0x803edf
+  801375:	e8 c5 ee ff ff       	call   80023f <_panic>
+    panic("sys_page_alloc: %e", r);
+  80137a:	50                   	push   %eax
+  80137b:	68 05 3f 80 00       	push   $0x803f05
+  801380:	68 a4 00 00 00       	push   $0xa4
+  801385:	68 df 3e 80 00       	push   $0x803edf
+  80138a:	e8 b0 ee ff ff       	call   80023f <_panic>
+    panic("sys_page_map: %e", r);
+  80138f:	50                   	push   %eax
+  801390:	68 18 3f 80 00       	push   $0x803f18
+  801395:	68 ac 00 00 00       	push   $0xac
+  80139a:	68 df 3e 80 00       	push   $0x803edf
+  80139f:	e8 9b ee ff ff       	call   80023f <_panic>
+
+008013a4 <fork>:
+{
+  8013a4:	55                   	push   %ebp
+  8013a5:	89 e5                	mov    %esp,%ebp
+  8013a7:	53                   	push   %ebx
+  8013a8:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  8013ab:	e8 06 f9 ff ff       	call   800cb6 <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  8013b0:	83 ec 0c             	sub    $0xc,%esp
+  8013b3:	68 e6 11 80 00       	push   $0x8011e6
+  8013b8:	e8 82 22 00 00       	call   80363f <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8013bd:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013c2:	cd 30                	int    $0x30
+  8013c4:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  8013c6:	83 c4 10             	add    $0x10,%esp
+  8013c9:	85 c0                	test   %eax,%eax
+  8013cb:	78 66                	js     801433 <fork+0x8f>
+  } else if (envid == 0) {
+  8013cd:	74 76                	je     801445 <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  8013cf:	83 ec 0c             	sub    $0xc,%esp
+  8013d2:	6a 01                	push   $0x1
+  8013d4:	50                   	push   %eax
+  8013d5:	68 00 f0 bf ee       	push   $0xeebff000
+  8013da:	6a 00                	push   $0x0
+  8013dc:	6a 00                	push   $0x0
+  8013de:	e8 1b fa ff ff       	call   800dfe <sys_page_map_range>
+  8013e3:	83 c4 20             	add    $0x20,%esp
+  8013e6:	85 c0                	test   %eax,%eax
+  8013e8:	78 77                	js     801461 <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  8013ea:	83 ec 04             	sub    $0x4,%esp
+  8013ed:	6a 07                	push   $0x7
+  8013ef:	68 00 f0 bf ee       	push   $0xeebff000
+  8013f4:	53                   	push   %ebx
+  8013f5:	e8 3d f9 ff ff       	call   800d37 <sys_page_alloc>
+  8013fa:	83 c4 10             	add    $0x10,%esp
+  8013fd:	85 c0                	test   %eax,%eax
+  8013ff:	78 72                	js     801473 <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  801401:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801406:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801409:	83 ec 08             	sub    $0x8,%esp
+  80140c:	50                   	push   %eax
+  80140d:	53                   	push   %ebx
+  80140e:	e8 99 fb ff ff       	call   800fac <sys_env_set_pgfault_upcall>
+  801413:	83 c4 10             	add    $0x10,%esp
+  801416:	85 c0                	test   %eax,%eax
+  801418:	78 6b                	js     801485 <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80141a:	83 ec 08             	sub    $0x8,%esp
+  80141d:	6a 02                	push   $0x2
+  80141f:	53                   	push   %ebx
+  801420:	e8 03 fb ff ff       	call   800f28 <sys_env_set_status>
+  801425:	83 c4 10             	add    $0x10,%esp
+  801428:	85 c0                	test   %eax,%eax
+  80142a:	78 6b                	js     801497 <fork+0xf3>
+}
+  80142c:	89 d8                	mov    %ebx,%eax
+  80142e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801431:	c9                   	leave
+  801432:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801433:	50                   	push   %eax
+  801434:	68 3c 3f 80 00       	push   $0x803f3c
+  801439:	6a 5e                	push   $0x5e
+  80143b:	68 df 3e 80 00       	push   $0x803edf
+  801440:	e8 fa ed ff ff       	call   80023f <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801445:	e8 6c f8 ff ff       	call   800cb6 <sys_getenvid>
+  80144a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80144f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801452:	c1 e0 04             	shl    $0x4,%eax
+  801455:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80145a:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+    return 0;
+  80145f:	eb cb                	jmp    80142c <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  801461:	50                   	push   %eax
+  801462:	68 4c 3f 80 00       	push   $0x803f4c
+  801467:	6a 69                	push   $0x69
+  801469:	68 df 3e 80 00       	push   $0x803edf
+  80146e:	e8 cc ed ff ff       	call   80023f <_panic>
+    panic("sys_page_alloc: %e", error);
+  801473:	50                   	push   %eax
+  801474:	68 05 3f 80 00       	push   $0x803f05
+  801479:	6a 70                	push   $0x70
+  80147b:	68 df 3e 80 00       	push   $0x803edf
+  801480:	e8 ba ed ff ff       	call   80023f <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801485:	50                   	push   %eax
+  801486:	68 7c 3f 80 00       	push   $0x803f7c
+  80148b:	6a 76                	push   $0x76
+  80148d:	68 df 3e 80 00       	push   $0x803edf
+  801492:	e8 a8 ed ff ff       	call   80023f <_panic>
+    panic("sys_env_set_status: %e", error);
+  801497:	50                   	push   %eax
+  801498:	68 63 3f 80 00       	push   $0x803f63
+  80149d:	6a 7a                	push   $0x7a
+  80149f:	68 df 3e 80 00       	push   $0x803edf
+  8014a4:	e8 96 ed ff ff       	call   80023f <_panic>
+
+008014a9 <kfork>:
+{
+  8014a9:	55                   	push   %ebp
+  8014aa:	89 e5                	mov    %esp,%ebp
+  8014ac:	53                   	push   %ebx
+  8014ad:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  8014b0:	68 e6 11 80 00       	push   $0x8011e6
+  8014b5:	e8 85 21 00 00       	call   80363f <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  8014ba:	e8 4a fa ff ff       	call   800f09 <sys_fork>
+  8014bf:	89 c3                	mov    %eax,%ebx
+  8014c1:	83 c4 10             	add    $0x10,%esp
+  8014c4:	85 c0                	test   %eax,%eax
+  8014c6:	74 07                	je     8014cf <kfork+0x26>
+}
+  8014c8:	89 d8                	mov    %ebx,%eax
+  8014ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014cd:	c9                   	leave
+  8014ce:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8014cf:	e8 e2 f7 ff ff       	call   800cb6 <sys_getenvid>
+  8014d4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014d9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8014dc:	c1 e0 04             	shl    $0x4,%eax
+  8014df:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014e4:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+  return envid;
+  8014e9:	eb dd                	jmp    8014c8 <kfork+0x1f>
+
+008014eb <sfork>:
+
+int
+sfork(void)
+{
+  8014eb:	55                   	push   %ebp
+  8014ec:	89 e5                	mov    %esp,%ebp
+  8014ee:	53                   	push   %ebx
+  8014ef:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  8014f2:	e8 bf f7 ff ff       	call   800cb6 <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  8014f7:	83 ec 0c             	sub    $0xc,%esp
+  8014fa:	68 e3 12 80 00       	push   $0x8012e3
+  8014ff:	e8 3b 21 00 00       	call   80363f <set_pgfault_handler>
+  801504:	b8 07 00 00 00       	mov    $0x7,%eax
+  801509:	cd 30                	int    $0x30
+  80150b:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  80150d:	83 c4 10             	add    $0x10,%esp
+  801510:	85 c0                	test   %eax,%eax
+  801512:	78 09                	js     80151d <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  801514:	75 1c                	jne    801532 <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  801516:	89 d8                	mov    %ebx,%eax
+  801518:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80151b:	c9                   	leave
+  80151c:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  80151d:	50                   	push   %eax
+  80151e:	68 3c 3f 80 00       	push   $0x803f3c
+  801523:	68 c3 00 00 00       	push   $0xc3
+  801528:	68 df 3e 80 00       	push   $0x803edf
+  80152d:	e8 0d ed ff ff       	call   80023f <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  801532:	83 ec 0c             	sub    $0xc,%esp
+  801535:	6a 00                	push   $0x0
+  801537:	50                   	push   %eax
+  801538:	68 00 d0 bf ee       	push   $0xeebfd000
+  80153d:	6a 00                	push   $0x0
+  80153f:	6a 00                	push   $0x0
+  801541:	e8 b8 f8 ff ff       	call   800dfe <sys_page_map_range>
+  801546:	83 c4 20             	add    $0x20,%esp
+  801549:	85 c0                	test   %eax,%eax
+  80154b:	78 79                	js     8015c6 <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  80154d:	83 ec 0c             	sub    $0xc,%esp
+  801550:	6a 01                	push   $0x1
+  801552:	53                   	push   %ebx
+  801553:	68 00 10 00 00       	push   $0x1000
+  801558:	68 00 d0 bf ee       	push   $0xeebfd000
+  80155d:	6a 00                	push   $0x0
+  80155f:	e8 9a f8 ff ff       	call   800dfe <sys_page_map_range>
+  801564:	83 c4 20             	add    $0x20,%esp
+  801567:	85 c0                	test   %eax,%eax
+  801569:	78 70                	js     8015db <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  80156b:	83 ec 04             	sub    $0x4,%esp
+  80156e:	6a 07                	push   $0x7
+  801570:	68 00 f0 bf ee       	push   $0xeebff000
+  801575:	53                   	push   %ebx
+  801576:	e8 bc f7 ff ff       	call   800d37 <sys_page_alloc>
+  80157b:	83 c4 10             	add    $0x10,%esp
+  80157e:	85 c0                	test   %eax,%eax
+  801580:	78 6e                	js     8015f0 <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  801582:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801587:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  80158a:	83 ec 08             	sub    $0x8,%esp
+  80158d:	50                   	push   %eax
+  80158e:	53                   	push   %ebx
+  80158f:	e8 18 fa ff ff       	call   800fac <sys_env_set_pgfault_upcall>
+  801594:	83 c4 10             	add    $0x10,%esp
+  801597:	85 c0                	test   %eax,%eax
+  801599:	78 6a                	js     801605 <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80159b:	83 ec 08             	sub    $0x8,%esp
+  80159e:	6a 02                	push   $0x2
+  8015a0:	53                   	push   %ebx
+  8015a1:	e8 82 f9 ff ff       	call   800f28 <sys_env_set_status>
+  8015a6:	83 c4 10             	add    $0x10,%esp
+  8015a9:	85 c0                	test   %eax,%eax
+  8015ab:	0f 89 65 ff ff ff    	jns    801516 <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  8015b1:	50                   	push   %eax
+  8015b2:	68 63 3f 80 00       	push   $0x803f63
+  8015b7:	68 e4 00 00 00       	push   $0xe4
+  8015bc:	68 df 3e 80 00       	push   $0x803edf
+  8015c1:	e8 79 ec ff ff       	call   80023f <_panic>
+    panic("sys_page_map_range: %e", error);
+  8015c6:	50                   	push   %eax
+  8015c7:	68 4c 3f 80 00       	push   $0x803f4c
+  8015cc:	68 ce 00 00 00       	push   $0xce
+  8015d1:	68 df 3e 80 00       	push   $0x803edf
+  8015d6:	e8 64 ec ff ff       	call   80023f <_panic>
+    panic("sys_page_map_range: %e", error);
+  8015db:	50                   	push   %eax
+  8015dc:	68 4c 3f 80 00       	push   $0x803f4c
+  8015e1:	68 d3 00 00 00       	push   $0xd3
+  8015e6:	68 df 3e 80 00       	push   $0x803edf
+  8015eb:	e8 4f ec ff ff       	call   80023f <_panic>
+    panic("sys_page_alloc: %e", error);
+  8015f0:	50                   	push   %eax
+  8015f1:	68 05 3f 80 00       	push   $0x803f05
+  8015f6:	68 da 00 00 00       	push   $0xda
+  8015fb:	68 df 3e 80 00       	push   $0x803edf
+  801600:	e8 3a ec ff ff       	call   80023f <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801605:	50                   	push   %eax
+  801606:	68 7c 3f 80 00       	push   $0x803f7c
+  80160b:	68 e0 00 00 00       	push   $0xe0
+  801610:	68 df 3e 80 00       	push   $0x803edf
+  801615:	e8 25 ec ff ff       	call   80023f <_panic>
+
+0080161a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80161a:	55                   	push   %ebp
+  80161b:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80161d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801620:	05 00 00 00 30       	add    $0x30000000,%eax
+  801625:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801628:	5d                   	pop    %ebp
+  801629:	c3                   	ret
+
+0080162a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80162a:	55                   	push   %ebp
+  80162b:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80162d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801630:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801633:	66 b8 00 00          	mov    $0x0,%ax
+  801637:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80163c:	5d                   	pop    %ebp
+  80163d:	c3                   	ret
+
+0080163e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80163e:	55                   	push   %ebp
+  80163f:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801641:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801646:	eb 02                	jmp    80164a <fd_alloc+0xc>
+  801648:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80164a:	89 c2                	mov    %eax,%edx
+  80164c:	c1 ea 16             	shr    $0x16,%edx
+  80164f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801656:	f6 c2 01             	test   $0x1,%dl
+  801659:	74 2b                	je     801686 <fd_alloc+0x48>
+  80165b:	89 c2                	mov    %eax,%edx
+  80165d:	c1 ea 0c             	shr    $0xc,%edx
+  801660:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801667:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80166d:	f6 c1 01             	test   $0x1,%cl
+  801670:	74 14                	je     801686 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801672:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801678:	75 ce                	jne    801648 <fd_alloc+0xa>
+  80167a:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  80167f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801684:	eb 05                	jmp    80168b <fd_alloc+0x4d>
+      return 0;
+  801686:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  80168b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80168e:	89 02                	mov    %eax,(%edx)
+}
+  801690:	89 c8                	mov    %ecx,%eax
+  801692:	5d                   	pop    %ebp
+  801693:	c3                   	ret
+
+00801694 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801694:	55                   	push   %ebp
+  801695:	89 e5                	mov    %esp,%ebp
+  801697:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80169a:	83 f8 1f             	cmp    $0x1f,%eax
+  80169d:	77 30                	ja     8016cf <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  80169f:	c1 e0 0c             	shl    $0xc,%eax
+  8016a2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8016a7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8016ad:	f6 c2 01             	test   $0x1,%dl
+  8016b0:	74 24                	je     8016d6 <fd_lookup+0x42>
+  8016b2:	89 c2                	mov    %eax,%edx
+  8016b4:	c1 ea 0c             	shr    $0xc,%edx
+  8016b7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016be:	f6 c2 01             	test   $0x1,%dl
+  8016c1:	74 1a                	je     8016dd <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8016c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016c6:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8016c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016cd:	5d                   	pop    %ebp
+  8016ce:	c3                   	ret
+    return -E_INVAL;
+  8016cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d4:	eb f7                	jmp    8016cd <fd_lookup+0x39>
+    return -E_INVAL;
+  8016d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016db:	eb f0                	jmp    8016cd <fd_lookup+0x39>
+  8016dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e2:	eb e9                	jmp    8016cd <fd_lookup+0x39>
+
+008016e4 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8016e4:	55                   	push   %ebp
+  8016e5:	89 e5                	mov    %esp,%ebp
+  8016e7:	53                   	push   %ebx
+  8016e8:	83 ec 04             	sub    $0x4,%esp
+  8016eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8016ee:	b8 18 40 80 00       	mov    $0x804018,%eax
+  8016f3:	8b 18                	mov    (%eax),%ebx
+  8016f5:	85 db                	test   %ebx,%ebx
+  8016f7:	74 0e                	je     801707 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8016f9:	83 c0 04             	add    $0x4,%eax
+  8016fc:	39 13                	cmp    %edx,(%ebx)
+  8016fe:	75 f3                	jne    8016f3 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801700:	b8 00 00 00 00       	mov    $0x0,%eax
+  801705:	eb 1f                	jmp    801726 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801707:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80170c:	8b 40 48             	mov    0x48(%eax),%eax
+  80170f:	83 ec 04             	sub    $0x4,%esp
+  801712:	52                   	push   %edx
+  801713:	50                   	push   %eax
+  801714:	68 9c 3f 80 00       	push   $0x803f9c
+  801719:	e8 fc eb ff ff       	call   80031a <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80171e:	83 c4 10             	add    $0x10,%esp
+  801721:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801726:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801729:	89 1a                	mov    %ebx,(%edx)
+}
+  80172b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80172e:	c9                   	leave
+  80172f:	c3                   	ret
+
+00801730 <fd_close>:
+{
+  801730:	55                   	push   %ebp
+  801731:	89 e5                	mov    %esp,%ebp
+  801733:	57                   	push   %edi
+  801734:	56                   	push   %esi
+  801735:	53                   	push   %ebx
+  801736:	83 ec 24             	sub    $0x24,%esp
+  801739:	8b 75 08             	mov    0x8(%ebp),%esi
+  80173c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80173f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801742:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801743:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801749:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80174c:	50                   	push   %eax
+  80174d:	e8 42 ff ff ff       	call   801694 <fd_lookup>
+  801752:	89 c3                	mov    %eax,%ebx
+  801754:	83 c4 10             	add    $0x10,%esp
+  801757:	85 c0                	test   %eax,%eax
+  801759:	78 05                	js     801760 <fd_close+0x30>
+      || fd != fd2)
+  80175b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80175e:	74 16                	je     801776 <fd_close+0x46>
+    return must_exist ? r : 0;
+  801760:	89 f8                	mov    %edi,%eax
+  801762:	84 c0                	test   %al,%al
+  801764:	b8 00 00 00 00       	mov    $0x0,%eax
+  801769:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80176c:	89 d8                	mov    %ebx,%eax
+  80176e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801771:	5b                   	pop    %ebx
+  801772:	5e                   	pop    %esi
+  801773:	5f                   	pop    %edi
+  801774:	5d                   	pop    %ebp
+  801775:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801776:	83 ec 08             	sub    $0x8,%esp
+  801779:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80177c:	50                   	push   %eax
+  80177d:	ff 36                	push   (%esi)
+  80177f:	e8 60 ff ff ff       	call   8016e4 <dev_lookup>
+  801784:	89 c3                	mov    %eax,%ebx
+  801786:	83 c4 10             	add    $0x10,%esp
+  801789:	85 c0                	test   %eax,%eax
+  80178b:	78 1a                	js     8017a7 <fd_close+0x77>
+    if (dev->dev_close)
+  80178d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801790:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801793:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801798:	85 c0                	test   %eax,%eax
+  80179a:	74 0b                	je     8017a7 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  80179c:	83 ec 0c             	sub    $0xc,%esp
+  80179f:	56                   	push   %esi
+  8017a0:	ff d0                	call   *%eax
+  8017a2:	89 c3                	mov    %eax,%ebx
+  8017a4:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8017a7:	83 ec 08             	sub    $0x8,%esp
+  8017aa:	56                   	push   %esi
+  8017ab:	6a 00                	push   $0x0
+  8017ad:	e8 0a f6 ff ff       	call   800dbc <sys_page_unmap>
+  return r;
+  8017b2:	83 c4 10             	add    $0x10,%esp
+  8017b5:	eb b5                	jmp    80176c <fd_close+0x3c>
+
+008017b7 <close>:
+
+int
+close(int fdnum)
+{
+  8017b7:	55                   	push   %ebp
+  8017b8:	89 e5                	mov    %esp,%ebp
+  8017ba:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017c0:	50                   	push   %eax
+  8017c1:	ff 75 08             	push   0x8(%ebp)
+  8017c4:	e8 cb fe ff ff       	call   801694 <fd_lookup>
+  8017c9:	83 c4 10             	add    $0x10,%esp
+  8017cc:	85 c0                	test   %eax,%eax
+  8017ce:	79 02                	jns    8017d2 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8017d0:	c9                   	leave
+  8017d1:	c3                   	ret
+    return fd_close(fd, 1);
+  8017d2:	83 ec 08             	sub    $0x8,%esp
+  8017d5:	6a 01                	push   $0x1
+  8017d7:	ff 75 f4             	push   -0xc(%ebp)
+  8017da:	e8 51 ff ff ff       	call   801730 <fd_close>
+  8017df:	83 c4 10             	add    $0x10,%esp
+  8017e2:	eb ec                	jmp    8017d0 <close+0x19>
+
+008017e4 <close_all>:
+
+void
+close_all(void)
+{
+  8017e4:	55                   	push   %ebp
+  8017e5:	89 e5                	mov    %esp,%ebp
+  8017e7:	53                   	push   %ebx
+  8017e8:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8017eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8017f0:	83 ec 0c             	sub    $0xc,%esp
+  8017f3:	53                   	push   %ebx
+  8017f4:	e8 be ff ff ff       	call   8017b7 <close>
+  for (i = 0; i < MAXFD; i++)
+  8017f9:	83 c3 01             	add    $0x1,%ebx
+  8017fc:	83 c4 10             	add    $0x10,%esp
+  8017ff:	83 fb 20             	cmp    $0x20,%ebx
+  801802:	75 ec                	jne    8017f0 <close_all+0xc>
+}
+  801804:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801807:	c9                   	leave
+  801808:	c3                   	ret
+
+00801809 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801809:	55                   	push   %ebp
+  80180a:	89 e5                	mov    %esp,%ebp
+  80180c:	57                   	push   %edi
+  80180d:	56                   	push   %esi
+  80180e:	53                   	push   %ebx
+  80180f:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801812:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801815:	50                   	push   %eax
+  801816:	ff 75 08             	push   0x8(%ebp)
+  801819:	e8 76 fe ff ff       	call   801694 <fd_lookup>
+  80181e:	89 c6                	mov    %eax,%esi
+  801820:	83 c4 10             	add    $0x10,%esp
+  801823:	85 c0                	test   %eax,%eax
+  801825:	0f 88 0a 01 00 00    	js     801935 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  80182b:	83 ec 0c             	sub    $0xc,%esp
+  80182e:	ff 75 0c             	push   0xc(%ebp)
+  801831:	e8 81 ff ff ff       	call   8017b7 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801836:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801839:	c1 e0 0c             	shl    $0xc,%eax
+  80183c:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801842:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801845:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801848:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80184b:	89 04 24             	mov    %eax,(%esp)
+  80184e:	e8 d7 fd ff ff       	call   80162a <fd2data>
+  801853:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801855:	89 3c 24             	mov    %edi,(%esp)
+  801858:	e8 cd fd ff ff       	call   80162a <fd2data>
+  80185d:	83 c4 10             	add    $0x10,%esp
+  801860:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801863:	89 f3                	mov    %esi,%ebx
+  801865:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  80186b:	89 c6                	mov    %eax,%esi
+  80186d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801870:	89 cf                	mov    %ecx,%edi
+  801872:	eb 0c                	jmp    801880 <dup+0x77>
+  801874:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80187a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801880:	39 fb                	cmp    %edi,%ebx
+  801882:	74 7b                	je     8018ff <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801884:	89 d8                	mov    %ebx,%eax
+  801886:	c1 e8 16             	shr    $0x16,%eax
+  801889:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801890:	a8 01                	test   $0x1,%al
+  801892:	74 e0                	je     801874 <dup+0x6b>
+  801894:	89 d8                	mov    %ebx,%eax
+  801896:	c1 e8 0c             	shr    $0xc,%eax
+  801899:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018a0:	f6 c2 01             	test   $0x1,%dl
+  8018a3:	74 cf                	je     801874 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8018a5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8018ac:	83 ec 0c             	sub    $0xc,%esp
+  8018af:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018b4:	50                   	push   %eax
+  8018b5:	56                   	push   %esi
+  8018b6:	6a 00                	push   $0x0
+  8018b8:	53                   	push   %ebx
+  8018b9:	6a 00                	push   $0x0
+  8018bb:	e8 ba f4 ff ff       	call   800d7a <sys_page_map>
+  8018c0:	83 c4 20             	add    $0x20,%esp
+  8018c3:	85 c0                	test   %eax,%eax
+  8018c5:	79 ad                	jns    801874 <dup+0x6b>
+  8018c7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018ca:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8018cc:	83 ec 08             	sub    $0x8,%esp
+  8018cf:	ff 75 d4             	push   -0x2c(%ebp)
+  8018d2:	6a 00                	push   $0x0
+  8018d4:	e8 e3 f4 ff ff       	call   800dbc <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8018d9:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8018dc:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8018e2:	83 c4 10             	add    $0x10,%esp
+  8018e5:	39 df                	cmp    %ebx,%edi
+  8018e7:	74 4c                	je     801935 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8018e9:	83 ec 08             	sub    $0x8,%esp
+  8018ec:	57                   	push   %edi
+  8018ed:	6a 00                	push   $0x0
+  8018ef:	e8 c8 f4 ff ff       	call   800dbc <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8018f4:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8018fa:	83 c4 10             	add    $0x10,%esp
+  8018fd:	eb e6                	jmp    8018e5 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8018ff:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801902:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801905:	89 c8                	mov    %ecx,%eax
+  801907:	c1 e8 0c             	shr    $0xc,%eax
+  80190a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801911:	83 ec 0c             	sub    $0xc,%esp
+  801914:	25 07 0e 00 00       	and    $0xe07,%eax
+  801919:	50                   	push   %eax
+  80191a:	ff 75 d4             	push   -0x2c(%ebp)
+  80191d:	6a 00                	push   $0x0
+  80191f:	51                   	push   %ecx
+  801920:	6a 00                	push   $0x0
+  801922:	e8 53 f4 ff ff       	call   800d7a <sys_page_map>
+  801927:	89 c6                	mov    %eax,%esi
+  801929:	83 c4 20             	add    $0x20,%esp
+  80192c:	85 c0                	test   %eax,%eax
+  80192e:	78 9c                	js     8018cc <dup+0xc3>
+  return newfdnum;
+  801930:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801933:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801935:	89 f0                	mov    %esi,%eax
+  801937:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80193a:	5b                   	pop    %ebx
+  80193b:	5e                   	pop    %esi
+  80193c:	5f                   	pop    %edi
+  80193d:	5d                   	pop    %ebp
+  80193e:	c3                   	ret
+
+0080193f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80193f:	55                   	push   %ebp
+  801940:	89 e5                	mov    %esp,%ebp
+  801942:	56                   	push   %esi
+  801943:	53                   	push   %ebx
+  801944:	83 ec 18             	sub    $0x18,%esp
+  801947:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80194a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80194d:	50                   	push   %eax
+  80194e:	56                   	push   %esi
+  80194f:	e8 40 fd ff ff       	call   801694 <fd_lookup>
+  801954:	83 c4 10             	add    $0x10,%esp
+  801957:	85 c0                	test   %eax,%eax
+  801959:	78 3c                	js     801997 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80195b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80195e:	83 ec 08             	sub    $0x8,%esp
+  801961:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801964:	50                   	push   %eax
+  801965:	ff 33                	push   (%ebx)
+  801967:	e8 78 fd ff ff       	call   8016e4 <dev_lookup>
+  80196c:	83 c4 10             	add    $0x10,%esp
+  80196f:	85 c0                	test   %eax,%eax
+  801971:	78 24                	js     801997 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801973:	8b 43 08             	mov    0x8(%ebx),%eax
+  801976:	83 e0 03             	and    $0x3,%eax
+  801979:	83 f8 01             	cmp    $0x1,%eax
+  80197c:	74 20                	je     80199e <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  80197e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801981:	8b 40 08             	mov    0x8(%eax),%eax
+  801984:	85 c0                	test   %eax,%eax
+  801986:	74 37                	je     8019bf <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801988:	83 ec 04             	sub    $0x4,%esp
+  80198b:	ff 75 10             	push   0x10(%ebp)
+  80198e:	ff 75 0c             	push   0xc(%ebp)
+  801991:	53                   	push   %ebx
+  801992:	ff d0                	call   *%eax
+  801994:	83 c4 10             	add    $0x10,%esp
+}
+  801997:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80199a:	5b                   	pop    %ebx
+  80199b:	5e                   	pop    %esi
+  80199c:	5d                   	pop    %ebp
+  80199d:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80199e:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8019a3:	8b 40 48             	mov    0x48(%eax),%eax
+  8019a6:	83 ec 04             	sub    $0x4,%esp
+  8019a9:	56                   	push   %esi
+  8019aa:	50                   	push   %eax
+  8019ab:	68 dd 3f 80 00       	push   $0x803fdd
+  8019b0:	e8 65 e9 ff ff       	call   80031a <cprintf>
+    return -E_INVAL;
+  8019b5:	83 c4 10             	add    $0x10,%esp
+  8019b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019bd:	eb d8                	jmp    801997 <read+0x58>
+    return -E_NOT_SUPP;
+  8019bf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019c4:	eb d1                	jmp    801997 <read+0x58>
+
+008019c6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8019c6:	55                   	push   %ebp
+  8019c7:	89 e5                	mov    %esp,%ebp
+  8019c9:	57                   	push   %edi
+  8019ca:	56                   	push   %esi
+  8019cb:	53                   	push   %ebx
+  8019cc:	83 ec 0c             	sub    $0xc,%esp
+  8019cf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8019d2:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8019d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019da:	eb 02                	jmp    8019de <readn+0x18>
+  8019dc:	01 c3                	add    %eax,%ebx
+  8019de:	39 f3                	cmp    %esi,%ebx
+  8019e0:	73 21                	jae    801a03 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8019e2:	83 ec 04             	sub    $0x4,%esp
+  8019e5:	89 f0                	mov    %esi,%eax
+  8019e7:	29 d8                	sub    %ebx,%eax
+  8019e9:	50                   	push   %eax
+  8019ea:	89 d8                	mov    %ebx,%eax
+  8019ec:	03 45 0c             	add    0xc(%ebp),%eax
+  8019ef:	50                   	push   %eax
+  8019f0:	57                   	push   %edi
+  8019f1:	e8 49 ff ff ff       	call   80193f <read>
+    if (m < 0)
+  8019f6:	83 c4 10             	add    $0x10,%esp
+  8019f9:	85 c0                	test   %eax,%eax
+  8019fb:	78 04                	js     801a01 <readn+0x3b>
+      return m;
+    if (m == 0)
+  8019fd:	75 dd                	jne    8019dc <readn+0x16>
+  8019ff:	eb 02                	jmp    801a03 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801a01:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801a03:	89 d8                	mov    %ebx,%eax
+  801a05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a08:	5b                   	pop    %ebx
+  801a09:	5e                   	pop    %esi
+  801a0a:	5f                   	pop    %edi
+  801a0b:	5d                   	pop    %ebp
+  801a0c:	c3                   	ret
+
+00801a0d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801a0d:	55                   	push   %ebp
+  801a0e:	89 e5                	mov    %esp,%ebp
+  801a10:	56                   	push   %esi
+  801a11:	53                   	push   %ebx
+  801a12:	83 ec 18             	sub    $0x18,%esp
+  801a15:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a18:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a1b:	50                   	push   %eax
+  801a1c:	53                   	push   %ebx
+  801a1d:	e8 72 fc ff ff       	call   801694 <fd_lookup>
+  801a22:	83 c4 10             	add    $0x10,%esp
+  801a25:	85 c0                	test   %eax,%eax
+  801a27:	78 37                	js     801a60 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a29:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a2c:	83 ec 08             	sub    $0x8,%esp
+  801a2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a32:	50                   	push   %eax
+  801a33:	ff 36                	push   (%esi)
+  801a35:	e8 aa fc ff ff       	call   8016e4 <dev_lookup>
+  801a3a:	83 c4 10             	add    $0x10,%esp
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	78 1f                	js     801a60 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a41:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a45:	74 20                	je     801a67 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801a47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a4a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a4d:	85 c0                	test   %eax,%eax
+  801a4f:	74 37                	je     801a88 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801a51:	83 ec 04             	sub    $0x4,%esp
+  801a54:	ff 75 10             	push   0x10(%ebp)
+  801a57:	ff 75 0c             	push   0xc(%ebp)
+  801a5a:	56                   	push   %esi
+  801a5b:	ff d0                	call   *%eax
+  801a5d:	83 c4 10             	add    $0x10,%esp
+}
+  801a60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a63:	5b                   	pop    %ebx
+  801a64:	5e                   	pop    %esi
+  801a65:	5d                   	pop    %ebp
+  801a66:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a67:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801a6c:	8b 40 48             	mov    0x48(%eax),%eax
+  801a6f:	83 ec 04             	sub    $0x4,%esp
+  801a72:	53                   	push   %ebx
+  801a73:	50                   	push   %eax
+  801a74:	68 f9 3f 80 00       	push   $0x803ff9
+  801a79:	e8 9c e8 ff ff       	call   80031a <cprintf>
+    return -E_INVAL;
+  801a7e:	83 c4 10             	add    $0x10,%esp
+  801a81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a86:	eb d8                	jmp    801a60 <write+0x53>
+    return -E_NOT_SUPP;
+  801a88:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a8d:	eb d1                	jmp    801a60 <write+0x53>
+
+00801a8f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801a8f:	55                   	push   %ebp
+  801a90:	89 e5                	mov    %esp,%ebp
+  801a92:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a98:	50                   	push   %eax
+  801a99:	ff 75 08             	push   0x8(%ebp)
+  801a9c:	e8 f3 fb ff ff       	call   801694 <fd_lookup>
+  801aa1:	83 c4 10             	add    $0x10,%esp
+  801aa4:	85 c0                	test   %eax,%eax
+  801aa6:	78 0e                	js     801ab6 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801aa8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801aab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aae:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801ab1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ab6:	c9                   	leave
+  801ab7:	c3                   	ret
+
+00801ab8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ab8:	55                   	push   %ebp
+  801ab9:	89 e5                	mov    %esp,%ebp
+  801abb:	56                   	push   %esi
+  801abc:	53                   	push   %ebx
+  801abd:	83 ec 18             	sub    $0x18,%esp
+  801ac0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ac3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ac6:	50                   	push   %eax
+  801ac7:	53                   	push   %ebx
+  801ac8:	e8 c7 fb ff ff       	call   801694 <fd_lookup>
+  801acd:	83 c4 10             	add    $0x10,%esp
+  801ad0:	85 c0                	test   %eax,%eax
+  801ad2:	78 34                	js     801b08 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ad4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ad7:	83 ec 08             	sub    $0x8,%esp
+  801ada:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801add:	50                   	push   %eax
+  801ade:	ff 36                	push   (%esi)
+  801ae0:	e8 ff fb ff ff       	call   8016e4 <dev_lookup>
+  801ae5:	83 c4 10             	add    $0x10,%esp
+  801ae8:	85 c0                	test   %eax,%eax
+  801aea:	78 1c                	js     801b08 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801aec:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801af0:	74 1d                	je     801b0f <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801af2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801af5:	8b 40 18             	mov    0x18(%eax),%eax
+  801af8:	85 c0                	test   %eax,%eax
+  801afa:	74 34                	je     801b30 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801afc:	83 ec 08             	sub    $0x8,%esp
+  801aff:	ff 75 0c             	push   0xc(%ebp)
+  801b02:	56                   	push   %esi
+  801b03:	ff d0                	call   *%eax
+  801b05:	83 c4 10             	add    $0x10,%esp
+}
+  801b08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b0b:	5b                   	pop    %ebx
+  801b0c:	5e                   	pop    %esi
+  801b0d:	5d                   	pop    %ebp
+  801b0e:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801b0f:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801b14:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b17:	83 ec 04             	sub    $0x4,%esp
+  801b1a:	53                   	push   %ebx
+  801b1b:	50                   	push   %eax
+  801b1c:	68 bc 3f 80 00       	push   $0x803fbc
+  801b21:	e8 f4 e7 ff ff       	call   80031a <cprintf>
+    return -E_INVAL;
+  801b26:	83 c4 10             	add    $0x10,%esp
+  801b29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b2e:	eb d8                	jmp    801b08 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801b30:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b35:	eb d1                	jmp    801b08 <ftruncate+0x50>
+
+00801b37 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801b37:	55                   	push   %ebp
+  801b38:	89 e5                	mov    %esp,%ebp
+  801b3a:	56                   	push   %esi
+  801b3b:	53                   	push   %ebx
+  801b3c:	83 ec 18             	sub    $0x18,%esp
+  801b3f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b42:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b45:	50                   	push   %eax
+  801b46:	ff 75 08             	push   0x8(%ebp)
+  801b49:	e8 46 fb ff ff       	call   801694 <fd_lookup>
+  801b4e:	83 c4 10             	add    $0x10,%esp
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	78 49                	js     801b9e <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b55:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b58:	83 ec 08             	sub    $0x8,%esp
+  801b5b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b5e:	50                   	push   %eax
+  801b5f:	ff 36                	push   (%esi)
+  801b61:	e8 7e fb ff ff       	call   8016e4 <dev_lookup>
+  801b66:	83 c4 10             	add    $0x10,%esp
+  801b69:	85 c0                	test   %eax,%eax
+  801b6b:	78 31                	js     801b9e <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801b6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b70:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b74:	74 2f                	je     801ba5 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801b76:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801b79:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b80:	00 00 00 
+  stat->st_isdir = 0;
+  801b83:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b8a:	00 00 00 
+  stat->st_dev = dev;
+  801b8d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801b93:	83 ec 08             	sub    $0x8,%esp
+  801b96:	53                   	push   %ebx
+  801b97:	56                   	push   %esi
+  801b98:	ff 50 14             	call   *0x14(%eax)
+  801b9b:	83 c4 10             	add    $0x10,%esp
+}
+  801b9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ba1:	5b                   	pop    %ebx
+  801ba2:	5e                   	pop    %esi
+  801ba3:	5d                   	pop    %ebp
+  801ba4:	c3                   	ret
+    return -E_NOT_SUPP;
+  801ba5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801baa:	eb f2                	jmp    801b9e <fstat+0x67>
+
+00801bac <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801bac:	55                   	push   %ebp
+  801bad:	89 e5                	mov    %esp,%ebp
+  801baf:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801bb2:	ff 75 0c             	push   0xc(%ebp)
+  801bb5:	ff 75 08             	push   0x8(%ebp)
+  801bb8:	e8 58 07 00 00       	call   802315 <file_stat>
+}
+  801bbd:	c9                   	leave
+  801bbe:	c3                   	ret
+
+00801bbf <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801bbf:	55                   	push   %ebp
+  801bc0:	89 e5                	mov    %esp,%ebp
+  801bc2:	57                   	push   %edi
+  801bc3:	56                   	push   %esi
+  801bc4:	53                   	push   %ebx
+  801bc5:	83 ec 1c             	sub    $0x1c,%esp
+  801bc8:	89 c7                	mov    %eax,%edi
+  801bca:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801bcd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801bd0:	e9 a2 00 00 00       	jmp    801c77 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801bd5:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801bdc:	00 00 00 
+  801bdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801be4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801be9:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801bee:	be 01 00 00 00       	mov    $0x1,%esi
+  801bf3:	eb 0f                	jmp    801c04 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801bf5:	83 c0 01             	add    $0x1,%eax
+  801bf8:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801bfd:	74 49                	je     801c48 <fsipc_send+0x89>
+  801bff:	83 f9 07             	cmp    $0x7,%ecx
+  801c02:	7f 50                	jg     801c54 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801c04:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c07:	c1 e2 04             	shl    $0x4,%edx
+  801c0a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c10:	8b 52 50             	mov    0x50(%edx),%edx
+  801c13:	83 fa 01             	cmp    $0x1,%edx
+  801c16:	75 dd                	jne    801bf5 <fsipc_send+0x36>
+  801c18:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c1b:	c1 e2 04             	shl    $0x4,%edx
+  801c1e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c24:	8b 52 54             	mov    0x54(%edx),%edx
+  801c27:	85 d2                	test   %edx,%edx
+  801c29:	74 ca                	je     801bf5 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801c2b:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c2e:	c1 e2 04             	shl    $0x4,%edx
+  801c31:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c37:	8b 52 48             	mov    0x48(%edx),%edx
+  801c3a:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801c41:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801c44:	89 f3                	mov    %esi,%ebx
+  801c46:	eb ad                	jmp    801bf5 <fsipc_send+0x36>
+  801c48:	84 db                	test   %bl,%bl
+  801c4a:	74 38                	je     801c84 <fsipc_send+0xc5>
+  801c4c:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801c52:	eb 30                	jmp    801c84 <fsipc_send+0xc5>
+  801c54:	84 db                	test   %bl,%bl
+  801c56:	74 2c                	je     801c84 <fsipc_send+0xc5>
+  801c58:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801c5e:	eb 24                	jmp    801c84 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801c60:	50                   	push   %eax
+  801c61:	68 28 40 80 00       	push   $0x804028
+  801c66:	6a 34                	push   $0x34
+  801c68:	68 32 40 80 00       	push   $0x804032
+  801c6d:	e8 cd e5 ff ff       	call   80023f <_panic>
+    }
+    sys_yield();
+  801c72:	e8 5e f0 ff ff       	call   800cd5 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801c77:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801c7e:	0f 8e 51 ff ff ff    	jle    801bd5 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801c84:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801c89:	8b 70 48             	mov    0x48(%eax),%esi
+  801c8c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801c92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c97:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801c9d:	39 d9                	cmp    %ebx,%ecx
+  801c9f:	7e d1                	jle    801c72 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801ca1:	83 ec 0c             	sub    $0xc,%esp
+  801ca4:	ff 75 e0             	push   -0x20(%ebp)
+  801ca7:	6a 07                	push   $0x7
+  801ca9:	ff 75 e4             	push   -0x1c(%ebp)
+  801cac:	57                   	push   %edi
+  801cad:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801cb0:	99                   	cltd
+  801cb1:	f7 f9                	idiv   %ecx
+  801cb3:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801cba:	e8 2f f3 ff ff       	call   800fee <sys_ipc_try_send>
+      if (r == 0)
+  801cbf:	83 c4 20             	add    $0x20,%esp
+  801cc2:	85 c0                	test   %eax,%eax
+  801cc4:	74 0a                	je     801cd0 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801cc6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801cc9:	75 95                	jne    801c60 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801ccb:	83 c3 01             	add    $0x1,%ebx
+  801cce:	eb c7                	jmp    801c97 <fsipc_send+0xd8>
+  }
+}
+  801cd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cd3:	5b                   	pop    %ebx
+  801cd4:	5e                   	pop    %esi
+  801cd5:	5f                   	pop    %edi
+  801cd6:	5d                   	pop    %ebp
+  801cd7:	c3                   	ret
+
+00801cd8 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801cd8:	55                   	push   %ebp
+  801cd9:	89 e5                	mov    %esp,%ebp
+  801cdb:	53                   	push   %ebx
+  801cdc:	83 ec 14             	sub    $0x14,%esp
+  801cdf:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801ce1:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801ce8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ced:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801cf2:	e8 c8 fe ff ff       	call   801bbf <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801cf7:	6a 00                	push   $0x0
+  801cf9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cfc:	50                   	push   %eax
+  801cfd:	53                   	push   %ebx
+  801cfe:	6a 00                	push   $0x0
+  801d00:	e8 a7 19 00 00       	call   8036ac <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801d05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d08:	c9                   	leave
+  801d09:	c3                   	ret
+
+00801d0a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801d0a:	55                   	push   %ebp
+  801d0b:	89 e5                	mov    %esp,%ebp
+  801d0d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d10:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d13:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d16:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801d1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d1e:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801d23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d28:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d2d:	e8 a6 ff ff ff       	call   801cd8 <fsipc>
+}
+  801d32:	c9                   	leave
+  801d33:	c3                   	ret
+
+00801d34 <devfile_flush>:
+{
+  801d34:	55                   	push   %ebp
+  801d35:	89 e5                	mov    %esp,%ebp
+  801d37:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d3d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d40:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801d45:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4a:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d4f:	e8 84 ff ff ff       	call   801cd8 <fsipc>
+}
+  801d54:	c9                   	leave
+  801d55:	c3                   	ret
+
+00801d56 <devfile_stat>:
+{
+  801d56:	55                   	push   %ebp
+  801d57:	89 e5                	mov    %esp,%ebp
+  801d59:	53                   	push   %ebx
+  801d5a:	83 ec 04             	sub    $0x4,%esp
+  801d5d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d63:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d66:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d70:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d75:	e8 5e ff ff ff       	call   801cd8 <fsipc>
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	78 2c                	js     801daa <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d7e:	83 ec 08             	sub    $0x8,%esp
+  801d81:	68 00 70 80 00       	push   $0x807000
+  801d86:	53                   	push   %ebx
+  801d87:	e8 7c eb ff ff       	call   800908 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801d8c:	a1 80 70 80 00       	mov    0x807080,%eax
+  801d91:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d97:	a1 84 70 80 00       	mov    0x807084,%eax
+  801d9c:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801da2:	83 c4 10             	add    $0x10,%esp
+  801da5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801daa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dad:	c9                   	leave
+  801dae:	c3                   	ret
+
+00801daf <fsv_alloc>:
+{
+  801daf:	55                   	push   %ebp
+  801db0:	89 e5                	mov    %esp,%ebp
+  801db2:	56                   	push   %esi
+  801db3:	53                   	push   %ebx
+  801db4:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801db6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dbb:	eb 22                	jmp    801ddf <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801dbd:	83 ec 04             	sub    $0x4,%esp
+  801dc0:	6a 00                	push   $0x0
+  801dc2:	6a 00                	push   $0x0
+  801dc4:	6a 07                	push   $0x7
+  801dc6:	50                   	push   %eax
+  801dc7:	6a 00                	push   $0x0
+  801dc9:	6a 04                	push   $0x4
+  801dcb:	68 40 60 80 00       	push   $0x806040
+  801dd0:	e8 b5 f3 ff ff       	call   80118a <sysbatch_add>
+  801dd5:	83 c4 20             	add    $0x20,%esp
+  801dd8:	85 c0                	test   %eax,%eax
+  801dda:	78 48                	js     801e24 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801ddc:	83 c3 01             	add    $0x1,%ebx
+  801ddf:	39 f3                	cmp    %esi,%ebx
+  801de1:	74 31                	je     801e14 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801de3:	89 d8                	mov    %ebx,%eax
+  801de5:	c1 e0 0c             	shl    $0xc,%eax
+  801de8:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801ded:	89 c2                	mov    %eax,%edx
+  801def:	c1 ea 16             	shr    $0x16,%edx
+  801df2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801df9:	f6 c2 01             	test   $0x1,%dl
+  801dfc:	74 bf                	je     801dbd <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801dfe:	89 c2                	mov    %eax,%edx
+  801e00:	c1 ea 0c             	shr    $0xc,%edx
+  801e03:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e0a:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801e0d:	83 fa 03             	cmp    $0x3,%edx
+  801e10:	75 ab                	jne    801dbd <fsv_alloc+0xe>
+  801e12:	eb c8                	jmp    801ddc <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801e14:	83 ec 0c             	sub    $0xc,%esp
+  801e17:	68 40 60 80 00       	push   $0x806040
+  801e1c:	e8 19 f3 ff ff       	call   80113a <sysbatch_flush>
+  801e21:	83 c4 10             	add    $0x10,%esp
+}
+  801e24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e27:	5b                   	pop    %ebx
+  801e28:	5e                   	pop    %esi
+  801e29:	5d                   	pop    %ebp
+  801e2a:	c3                   	ret
+
+00801e2b <devfile_read>:
+{
+  801e2b:	55                   	push   %ebp
+  801e2c:	89 e5                	mov    %esp,%ebp
+  801e2e:	57                   	push   %edi
+  801e2f:	56                   	push   %esi
+  801e30:	53                   	push   %ebx
+  801e31:	83 ec 3c             	sub    $0x3c,%esp
+  801e34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801e37:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801e3d:	77 57                	ja     801e96 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801e3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e42:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e45:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801e4a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801e50:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e55:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e5a:	e8 79 fe ff ff       	call   801cd8 <fsipc>
+  801e5f:	89 c6                	mov    %eax,%esi
+  801e61:	85 c0                	test   %eax,%eax
+  801e63:	78 27                	js     801e8c <devfile_read+0x61>
+  assert(r <= n);
+  801e65:	39 c3                	cmp    %eax,%ebx
+  801e67:	0f 82 0e 02 00 00    	jb     80207b <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801e6d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e72:	0f 8f 1c 02 00 00    	jg     802094 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e78:	83 ec 04             	sub    $0x4,%esp
+  801e7b:	50                   	push   %eax
+  801e7c:	68 00 70 80 00       	push   $0x807000
+  801e81:	ff 75 0c             	push   0xc(%ebp)
+  801e84:	e8 05 ec ff ff       	call   800a8e <memmove>
+  return r;
+  801e89:	83 c4 10             	add    $0x10,%esp
+}
+  801e8c:	89 f0                	mov    %esi,%eax
+  801e8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e91:	5b                   	pop    %ebx
+  801e92:	5e                   	pop    %esi
+  801e93:	5f                   	pop    %edi
+  801e94:	5d                   	pop    %ebp
+  801e95:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801e96:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e9b:	e8 0f ff ff ff       	call   801daf <fsv_alloc>
+  801ea0:	89 c6                	mov    %eax,%esi
+  801ea2:	85 c0                	test   %eax,%eax
+  801ea4:	78 e6                	js     801e8c <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801ea6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eac:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801eb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb4:	8b 40 04             	mov    0x4(%eax),%eax
+  801eb7:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801ebc:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801ec2:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801ec9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ece:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801ed3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ed8:	e8 e2 fc ff ff       	call   801bbf <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801edd:	6a 00                	push   $0x0
+  801edf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ee2:	50                   	push   %eax
+  801ee3:	68 00 10 c0 9f       	push   $0x9fc01000
+  801ee8:	6a 00                	push   $0x0
+  801eea:	e8 bd 17 00 00       	call   8036ac <ipc_recv_pages>
+  801eef:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801ef1:	83 c4 10             	add    $0x10,%esp
+  801ef4:	85 c0                	test   %eax,%eax
+  801ef6:	7e 94                	jle    801e8c <devfile_read+0x61>
+  assert(r <= n);
+  801ef8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801efb:	39 c3                	cmp    %eax,%ebx
+  801efd:	72 2e                	jb     801f2d <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801eff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f02:	8b 40 04             	mov    0x4(%eax),%eax
+  801f05:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f0a:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801f0d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f10:	c1 e2 0c             	shl    $0xc,%edx
+  801f13:	39 ca                	cmp    %ecx,%edx
+  801f15:	72 2f                	jb     801f46 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801f17:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801f1c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801f1f:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801f23:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801f28:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801f2b:	eb 52                	jmp    801f7f <devfile_read+0x154>
+  assert(r <= n);
+  801f2d:	68 3d 40 80 00       	push   $0x80403d
+  801f32:	68 44 40 80 00       	push   $0x804044
+  801f37:	68 49 01 00 00       	push   $0x149
+  801f3c:	68 32 40 80 00       	push   $0x804032
+  801f41:	e8 f9 e2 ff ff       	call   80023f <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801f46:	68 68 40 80 00       	push   $0x804068
+  801f4b:	68 44 40 80 00       	push   $0x804044
+  801f50:	68 4a 01 00 00       	push   $0x14a
+  801f55:	68 32 40 80 00       	push   $0x804032
+  801f5a:	e8 e0 e2 ff ff       	call   80023f <_panic>
+      memmove(dst + done, src + done, m);
+  801f5f:	83 ec 04             	sub    $0x4,%esp
+  801f62:	53                   	push   %ebx
+  801f63:	56                   	push   %esi
+  801f64:	89 f8                	mov    %edi,%eax
+  801f66:	03 45 0c             	add    0xc(%ebp),%eax
+  801f69:	50                   	push   %eax
+  801f6a:	e8 1f eb ff ff       	call   800a8e <memmove>
+  801f6f:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801f72:	01 df                	add    %ebx,%edi
+  801f74:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801f77:	39 c7                	cmp    %eax,%edi
+  801f79:	0f 83 c0 00 00 00    	jae    80203f <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801f7f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801f82:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801f85:	89 f0                	mov    %esi,%eax
+  801f87:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801f91:	29 c3                	sub    %eax,%ebx
+  801f93:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801f96:	29 f8                	sub    %edi,%eax
+  801f98:	39 c3                	cmp    %eax,%ebx
+  801f9a:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801f9d:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801fa3:	75 ba                	jne    801f5f <devfile_read+0x134>
+  801fa5:	89 f9                	mov    %edi,%ecx
+  801fa7:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801faa:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801fad:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801fb3:	75 aa                	jne    801f5f <devfile_read+0x134>
+  801fb5:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801fbb:	77 a2                	ja     801f5f <devfile_read+0x134>
+  801fbd:	89 c8                	mov    %ecx,%eax
+  801fbf:	c1 e8 16             	shr    $0x16,%eax
+  801fc2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801fc9:	a8 01                	test   $0x1,%al
+  801fcb:	74 92                	je     801f5f <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801fcd:	89 c8                	mov    %ecx,%eax
+  801fcf:	c1 e8 0c             	shr    $0xc,%eax
+  801fd2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801fd9:	a8 01                	test   $0x1,%al
+  801fdb:	74 82                	je     801f5f <devfile_read+0x134>
+  801fdd:	a9 02 08 00 00       	test   $0x802,%eax
+  801fe2:	0f 84 77 ff ff ff    	je     801f5f <devfile_read+0x134>
+  801fe8:	f6 c4 04             	test   $0x4,%ah
+  801feb:	0f 85 6e ff ff ff    	jne    801f5f <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801ff1:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801ff6:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801ffa:	84 c0                	test   %al,%al
+  801ffc:	75 17                	jne    802015 <devfile_read+0x1ea>
+  801ffe:	83 ec 08             	sub    $0x8,%esp
+  802001:	6a 01                	push   $0x1
+  802003:	6a 00                	push   $0x0
+  802005:	e8 ea ec ff ff       	call   800cf4 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  80200a:	83 c4 10             	add    $0x10,%esp
+  80200d:	85 c0                	test   %eax,%eax
+  80200f:	0f 85 4a ff ff ff    	jne    801f5f <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  802015:	83 ec 04             	sub    $0x4,%esp
+  802018:	68 05 08 00 00       	push   $0x805
+  80201d:	ff 75 cc             	push   -0x34(%ebp)
+  802020:	6a 00                	push   $0x0
+  802022:	56                   	push   %esi
+  802023:	6a 00                	push   $0x0
+  802025:	6a 05                	push   $0x5
+  802027:	68 40 60 80 00       	push   $0x806040
+  80202c:	e8 59 f1 ff ff       	call   80118a <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  802031:	c1 e8 1f             	shr    $0x1f,%eax
+  802034:	08 45 cb             	or     %al,-0x35(%ebp)
+  802037:	83 c4 20             	add    $0x20,%esp
+  80203a:	e9 33 ff ff ff       	jmp    801f72 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80203f:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  802042:	83 ec 0c             	sub    $0xc,%esp
+  802045:	68 40 60 80 00       	push   $0x806040
+  80204a:	e8 eb f0 ff ff       	call   80113a <sysbatch_flush>
+  80204f:	83 c4 10             	add    $0x10,%esp
+  802052:	85 c0                	test   %eax,%eax
+  802054:	78 06                	js     80205c <devfile_read+0x231>
+  802056:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  80205a:	74 14                	je     802070 <devfile_read+0x245>
+    memmove(dst, src, r);
+  80205c:	83 ec 04             	sub    $0x4,%esp
+  80205f:	ff 75 d4             	push   -0x2c(%ebp)
+  802062:	ff 75 d0             	push   -0x30(%ebp)
+  802065:	ff 75 0c             	push   0xc(%ebp)
+  802068:	e8 21 ea ff ff       	call   800a8e <memmove>
+  80206d:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  802070:	8b 45 08             	mov    0x8(%ebp),%eax
+  802073:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  802076:	e9 11 fe ff ff       	jmp    801e8c <devfile_read+0x61>
+  assert(r <= n);
+  80207b:	68 3d 40 80 00       	push   $0x80403d
+  802080:	68 44 40 80 00       	push   $0x804044
+  802085:	68 1c 01 00 00       	push   $0x11c
+  80208a:	68 32 40 80 00       	push   $0x804032
+  80208f:	e8 ab e1 ff ff       	call   80023f <_panic>
+  assert(r <= PGSIZE);
+  802094:	68 59 40 80 00       	push   $0x804059
+  802099:	68 44 40 80 00       	push   $0x804044
+  80209e:	68 1d 01 00 00       	push   $0x11d
+  8020a3:	68 32 40 80 00       	push   $0x804032
+  8020a8:	e8 92 e1 ff ff       	call   80023f <_panic>
+
+008020ad <devfile_write>:
+{
+  8020ad:	55                   	push   %ebp
+  8020ae:	89 e5                	mov    %esp,%ebp
+  8020b0:	57                   	push   %edi
+  8020b1:	56                   	push   %esi
+  8020b2:	53                   	push   %ebx
+  8020b3:	83 ec 1c             	sub    $0x1c,%esp
+  8020b6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020b9:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  8020bc:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  8020c1:	77 39                	ja     8020fc <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020c3:	8b 56 0c             	mov    0xc(%esi),%edx
+  8020c6:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  8020cc:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  8020d1:	83 ec 04             	sub    $0x4,%esp
+  8020d4:	50                   	push   %eax
+  8020d5:	ff 75 0c             	push   0xc(%ebp)
+  8020d8:	68 08 70 80 00       	push   $0x807008
+  8020dd:	e8 ac e9 ff ff       	call   800a8e <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8020e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020ec:	e8 e7 fb ff ff       	call   801cd8 <fsipc>
+  8020f1:	83 c4 10             	add    $0x10,%esp
+}
+  8020f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020f7:	5b                   	pop    %ebx
+  8020f8:	5e                   	pop    %esi
+  8020f9:	5f                   	pop    %edi
+  8020fa:	5d                   	pop    %ebp
+  8020fb:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  8020fc:	ba 00 00 10 00       	mov    $0x100000,%edx
+  802101:	39 d0                	cmp    %edx,%eax
+  802103:	89 d3                	mov    %edx,%ebx
+  802105:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  802108:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  80210e:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  802111:	83 c7 01             	add    $0x1,%edi
+  802114:	89 f8                	mov    %edi,%eax
+  802116:	e8 94 fc ff ff       	call   801daf <fsv_alloc>
+  80211b:	85 c0                	test   %eax,%eax
+  80211d:	78 d5                	js     8020f4 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80211f:	83 ec 04             	sub    $0x4,%esp
+  802122:	53                   	push   %ebx
+  802123:	ff 75 0c             	push   0xc(%ebp)
+  802126:	68 00 10 c0 9f       	push   $0x9fc01000
+  80212b:	e8 5e e9 ff ff       	call   800a8e <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  802130:	8b 46 0c             	mov    0xc(%esi),%eax
+  802133:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  802138:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  80213e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802145:	89 f9                	mov    %edi,%ecx
+  802147:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  80214c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802151:	e8 69 fa ff ff       	call   801bbf <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802156:	6a 00                	push   $0x0
+  802158:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80215b:	50                   	push   %eax
+  80215c:	6a 00                	push   $0x0
+  80215e:	6a 00                	push   $0x0
+  802160:	e8 47 15 00 00       	call   8036ac <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  802165:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  802168:	eb 8a                	jmp    8020f4 <devfile_write+0x47>
+
+0080216a <open>:
+{
+  80216a:	55                   	push   %ebp
+  80216b:	89 e5                	mov    %esp,%ebp
+  80216d:	56                   	push   %esi
+  80216e:	53                   	push   %ebx
+  80216f:	83 ec 1c             	sub    $0x1c,%esp
+  802172:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802175:	56                   	push   %esi
+  802176:	e8 52 e7 ff ff       	call   8008cd <strlen>
+  80217b:	83 c4 10             	add    $0x10,%esp
+  80217e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802183:	7f 6c                	jg     8021f1 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802185:	83 ec 0c             	sub    $0xc,%esp
+  802188:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80218b:	50                   	push   %eax
+  80218c:	e8 ad f4 ff ff       	call   80163e <fd_alloc>
+  802191:	89 c3                	mov    %eax,%ebx
+  802193:	83 c4 10             	add    $0x10,%esp
+  802196:	85 c0                	test   %eax,%eax
+  802198:	78 3c                	js     8021d6 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  80219a:	83 ec 08             	sub    $0x8,%esp
+  80219d:	56                   	push   %esi
+  80219e:	68 00 70 80 00       	push   $0x807000
+  8021a3:	e8 60 e7 ff ff       	call   800908 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8021a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021ab:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021b0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021b8:	e8 1b fb ff ff       	call   801cd8 <fsipc>
+  8021bd:	89 c3                	mov    %eax,%ebx
+  8021bf:	83 c4 10             	add    $0x10,%esp
+  8021c2:	85 c0                	test   %eax,%eax
+  8021c4:	78 19                	js     8021df <open+0x75>
+  return fd2num(fd);
+  8021c6:	83 ec 0c             	sub    $0xc,%esp
+  8021c9:	ff 75 f4             	push   -0xc(%ebp)
+  8021cc:	e8 49 f4 ff ff       	call   80161a <fd2num>
+  8021d1:	89 c3                	mov    %eax,%ebx
+  8021d3:	83 c4 10             	add    $0x10,%esp
+}
+  8021d6:	89 d8                	mov    %ebx,%eax
+  8021d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021db:	5b                   	pop    %ebx
+  8021dc:	5e                   	pop    %esi
+  8021dd:	5d                   	pop    %ebp
+  8021de:	c3                   	ret
+    fd_close(fd, 0);
+  8021df:	83 ec 08             	sub    $0x8,%esp
+  8021e2:	6a 00                	push   $0x0
+  8021e4:	ff 75 f4             	push   -0xc(%ebp)
+  8021e7:	e8 44 f5 ff ff       	call   801730 <fd_close>
+    return r;
+  8021ec:	83 c4 10             	add    $0x10,%esp
+  8021ef:	eb e5                	jmp    8021d6 <open+0x6c>
+    return -E_BAD_PATH;
+  8021f1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021f6:	eb de                	jmp    8021d6 <open+0x6c>
+
+008021f8 <open_read>:
+{
+  8021f8:	55                   	push   %ebp
+  8021f9:	89 e5                	mov    %esp,%ebp
+  8021fb:	57                   	push   %edi
+  8021fc:	56                   	push   %esi
+  8021fd:	53                   	push   %ebx
+  8021fe:	83 ec 28             	sub    $0x28,%esp
+  802201:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  802204:	57                   	push   %edi
+  802205:	e8 c3 e6 ff ff       	call   8008cd <strlen>
+  80220a:	83 c4 10             	add    $0x10,%esp
+  80220d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802212:	0f 87 f6 00 00 00    	ja     80230e <open_read+0x116>
+  802218:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  80221a:	83 ec 0c             	sub    $0xc,%esp
+  80221d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802220:	50                   	push   %eax
+  802221:	e8 18 f4 ff ff       	call   80163e <fd_alloc>
+  802226:	89 c3                	mov    %eax,%ebx
+  802228:	83 c4 10             	add    $0x10,%esp
+  80222b:	85 c0                	test   %eax,%eax
+  80222d:	0f 88 b2 00 00 00    	js     8022e5 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  802233:	83 ec 08             	sub    $0x8,%esp
+  802236:	57                   	push   %edi
+  802237:	68 e4 70 80 00       	push   $0x8070e4
+  80223c:	e8 c7 e6 ff ff       	call   800908 <strcpy>
+  req->req_nops = 2;
+  802241:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802248:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  80224b:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  802252:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  802255:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802258:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  80225d:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  802264:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802267:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  80226e:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802271:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  802278:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  80227b:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  802280:	29 f0                	sub    %esi,%eax
+  802282:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802285:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802289:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  80228e:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  802295:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802298:	83 c6 01             	add    $0x1,%esi
+  80229b:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8022a1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8022a4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8022a9:	e8 2a fa ff ff       	call   801cd8 <fsipc>
+  8022ae:	89 c3                	mov    %eax,%ebx
+  8022b0:	83 c4 10             	add    $0x10,%esp
+  8022b3:	83 f8 01             	cmp    $0x1,%eax
+  8022b6:	7e 37                	jle    8022ef <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8022b8:	a1 38 70 80 00       	mov    0x807038,%eax
+  8022bd:	8b 55 18             	mov    0x18(%ebp),%edx
+  8022c0:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8022c2:	83 ec 04             	sub    $0x4,%esp
+  8022c5:	50                   	push   %eax
+  8022c6:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  8022cc:	56                   	push   %esi
+  8022cd:	ff 75 10             	push   0x10(%ebp)
+  8022d0:	e8 b9 e7 ff ff       	call   800a8e <memmove>
+  return fd2num(fd);
+  8022d5:	83 c4 04             	add    $0x4,%esp
+  8022d8:	ff 75 e4             	push   -0x1c(%ebp)
+  8022db:	e8 3a f3 ff ff       	call   80161a <fd2num>
+  8022e0:	89 c3                	mov    %eax,%ebx
+  8022e2:	83 c4 10             	add    $0x10,%esp
+}
+  8022e5:	89 d8                	mov    %ebx,%eax
+  8022e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022ea:	5b                   	pop    %ebx
+  8022eb:	5e                   	pop    %esi
+  8022ec:	5f                   	pop    %edi
+  8022ed:	5d                   	pop    %ebp
+  8022ee:	c3                   	ret
+    fd_close(fd, 0);
+  8022ef:	83 ec 08             	sub    $0x8,%esp
+  8022f2:	6a 00                	push   $0x0
+  8022f4:	ff 75 e4             	push   -0x1c(%ebp)
+  8022f7:	e8 34 f4 ff ff       	call   801730 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8022fc:	83 c4 10             	add    $0x10,%esp
+  8022ff:	85 db                	test   %ebx,%ebx
+  802301:	78 e2                	js     8022e5 <open_read+0xed>
+  802303:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802306:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  80230c:	eb d7                	jmp    8022e5 <open_read+0xed>
+    return -E_BAD_PATH;
+  80230e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802313:	eb d0                	jmp    8022e5 <open_read+0xed>
+
+00802315 <file_stat>:
+{
+  802315:	55                   	push   %ebp
+  802316:	89 e5                	mov    %esp,%ebp
+  802318:	57                   	push   %edi
+  802319:	56                   	push   %esi
+  80231a:	53                   	push   %ebx
+  80231b:	83 ec 18             	sub    $0x18,%esp
+  80231e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802321:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802324:	57                   	push   %edi
+  802325:	e8 a3 e5 ff ff       	call   8008cd <strlen>
+  80232a:	83 c4 10             	add    $0x10,%esp
+  80232d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802332:	0f 8f c7 00 00 00    	jg     8023ff <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802338:	83 ec 0c             	sub    $0xc,%esp
+  80233b:	57                   	push   %edi
+  80233c:	e8 8c e5 ff ff       	call   8008cd <strlen>
+  802341:	8d 58 04             	lea    0x4(%eax),%ebx
+  802344:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802347:	83 c4 08             	add    $0x8,%esp
+  80234a:	57                   	push   %edi
+  80234b:	68 e4 70 80 00       	push   $0x8070e4
+  802350:	e8 b3 e5 ff ff       	call   800908 <strcpy>
+  req->req_nops = 2;
+  802355:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  80235c:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  80235f:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  802366:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802369:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  802370:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802373:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  80237a:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  80237d:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  802384:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802387:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  80238e:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802391:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802397:	ba 00 00 00 00       	mov    $0x0,%edx
+  80239c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8023a1:	e8 32 f9 ff ff       	call   801cd8 <fsipc>
+  8023a6:	83 c4 10             	add    $0x10,%esp
+  8023a9:	83 f8 01             	cmp    $0x1,%eax
+  8023ac:	7e 42                	jle    8023f0 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8023ae:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8023b4:	83 ec 08             	sub    $0x8,%esp
+  8023b7:	53                   	push   %ebx
+  8023b8:	56                   	push   %esi
+  8023b9:	e8 4a e5 ff ff       	call   800908 <strcpy>
+  st->st_size = ret->ret_size;
+  8023be:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8023c4:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8023ca:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8023d0:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8023d6:	c7 86 88 00 00 00 04 	movl   $0x805004,0x88(%esi)
+  8023dd:	50 80 00 
+  return 0;
+  8023e0:	83 c4 10             	add    $0x10,%esp
+  8023e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023eb:	5b                   	pop    %ebx
+  8023ec:	5e                   	pop    %esi
+  8023ed:	5f                   	pop    %edi
+  8023ee:	5d                   	pop    %ebp
+  8023ef:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8023f0:	85 c0                	test   %eax,%eax
+  8023f2:	78 f4                	js     8023e8 <file_stat+0xd3>
+  8023f4:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8023f7:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  8023fd:	eb e9                	jmp    8023e8 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8023ff:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802404:	eb e2                	jmp    8023e8 <file_stat+0xd3>
+
+00802406 <read_map>:
+{
+  802406:	55                   	push   %ebp
+  802407:	89 e5                	mov    %esp,%ebp
+  802409:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80240c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80240f:	50                   	push   %eax
+  802410:	ff 75 08             	push   0x8(%ebp)
+  802413:	e8 7c f2 ff ff       	call   801694 <fd_lookup>
+  802418:	83 c4 10             	add    $0x10,%esp
+  80241b:	85 c0                	test   %eax,%eax
+  80241d:	78 2a                	js     802449 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80241f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802422:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802428:	39 08                	cmp    %ecx,(%eax)
+  80242a:	75 1f                	jne    80244b <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  80242c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80242f:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  802434:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802437:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  80243c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80243f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802444:	e8 8f f8 ff ff       	call   801cd8 <fsipc>
+}
+  802449:	c9                   	leave
+  80244a:	c3                   	ret
+    return -E_INVAL;
+  80244b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802450:	eb f7                	jmp    802449 <read_map+0x43>
+
+00802452 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802452:	55                   	push   %ebp
+  802453:	89 e5                	mov    %esp,%ebp
+  802455:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802458:	ba 00 00 00 00       	mov    $0x0,%edx
+  80245d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802462:	e8 71 f8 ff ff       	call   801cd8 <fsipc>
+}
+  802467:	c9                   	leave
+  802468:	c3                   	ret
+
+00802469 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802469:	55                   	push   %ebp
+  80246a:	89 e5                	mov    %esp,%ebp
+  80246c:	57                   	push   %edi
+  80246d:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  80246e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802471:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802476:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  80247d:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802480:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802487:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80248a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80248f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802494:	e8 3f f8 ff ff       	call   801cd8 <fsipc>
+  802499:	85 c0                	test   %eax,%eax
+  80249b:	78 14                	js     8024b1 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  80249d:	be 00 70 80 00       	mov    $0x807000,%esi
+  8024a2:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8024a7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8024aa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8024ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024b1:	5e                   	pop    %esi
+  8024b2:	5f                   	pop    %edi
+  8024b3:	5d                   	pop    %ebp
+  8024b4:	c3                   	ret
+
+008024b5 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8024b5:	55                   	push   %ebp
+  8024b6:	89 e5                	mov    %esp,%ebp
+  8024b8:	53                   	push   %ebx
+  8024b9:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8024bc:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8024bf:	50                   	push   %eax
+  8024c0:	6a 00                	push   $0x0
+  8024c2:	e8 a2 ff ff ff       	call   802469 <fs_stats>
+  8024c7:	83 c4 10             	add    $0x10,%esp
+  8024ca:	85 c0                	test   %eax,%eax
+  8024cc:	78 28                	js     8024f6 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8024ce:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8024d1:	83 ec 08             	sub    $0x8,%esp
+  8024d4:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8024d7:	50                   	push   %eax
+  8024d8:	6a 20                	push   $0x20
+  8024da:	e8 8a ff ff ff       	call   802469 <fs_stats>
+  8024df:	83 c4 10             	add    $0x10,%esp
+  8024e2:	85 c0                	test   %eax,%eax
+  8024e4:	78 10                	js     8024f6 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8024e6:	83 ec 08             	sub    $0x8,%esp
+  8024e9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8024ec:	50                   	push   %eax
+  8024ed:	53                   	push   %ebx
+  8024ee:	e8 76 ff ff ff       	call   802469 <fs_stats>
+  8024f3:	83 c4 10             	add    $0x10,%esp
+}
+  8024f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024f9:	c9                   	leave
+  8024fa:	c3                   	ret
+
+008024fb <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8024fb:	55                   	push   %ebp
+  8024fc:	89 e5                	mov    %esp,%ebp
+  8024fe:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802501:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802508:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  80250b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250e:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  802513:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  80251a:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80251d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802522:	b8 09 00 00 00       	mov    $0x9,%eax
+  802527:	e8 ac f7 ff ff       	call   801cd8 <fsipc>
+}
+  80252c:	c9                   	leave
+  80252d:	c3                   	ret
+
+0080252e <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80252e:	55                   	push   %ebp
+  80252f:	89 e5                	mov    %esp,%ebp
+  802531:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802534:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  80253b:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80253e:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802545:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802548:	8b 45 08             	mov    0x8(%ebp),%eax
+  80254b:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  802550:	ba 00 00 00 00       	mov    $0x0,%edx
+  802555:	b8 09 00 00 00       	mov    $0x9,%eax
+  80255a:	e8 79 f7 ff ff       	call   801cd8 <fsipc>
+}
+  80255f:	c9                   	leave
+  802560:	c3                   	ret
+
+00802561 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802561:	55                   	push   %ebp
+  802562:	89 e5                	mov    %esp,%ebp
+  802564:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802567:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80256a:	50                   	push   %eax
+  80256b:	ff 75 08             	push   0x8(%ebp)
+  80256e:	e8 21 f1 ff ff       	call   801694 <fd_lookup>
+  802573:	83 c4 10             	add    $0x10,%esp
+  802576:	85 c0                	test   %eax,%eax
+  802578:	78 34                	js     8025ae <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80257a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80257d:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802583:	39 08                	cmp    %ecx,(%eax)
+  802585:	75 29                	jne    8025b0 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802587:	8b 40 0c             	mov    0xc(%eax),%eax
+  80258a:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  80258f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802592:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  802597:	8b 45 10             	mov    0x10(%ebp),%eax
+  80259a:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  80259f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8025a9:	e8 2a f7 ff ff       	call   801cd8 <fsipc>
+}
+  8025ae:	c9                   	leave
+  8025af:	c3                   	ret
+    return -E_INVAL;
+  8025b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025b5:	eb f7                	jmp    8025ae <fallocate+0x4d>
+
+008025b7 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8025b7:	55                   	push   %ebp
+  8025b8:	89 e5                	mov    %esp,%ebp
+  8025ba:	57                   	push   %edi
+  8025bb:	56                   	push   %esi
+  8025bc:	53                   	push   %ebx
+  8025bd:	83 ec 24             	sub    $0x24,%esp
+  8025c0:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025c3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8025c6:	50                   	push   %eax
+  8025c7:	ff 75 08             	push   0x8(%ebp)
+  8025ca:	e8 c5 f0 ff ff       	call   801694 <fd_lookup>
+  8025cf:	83 c4 10             	add    $0x10,%esp
+  8025d2:	85 c0                	test   %eax,%eax
+  8025d4:	78 66                	js     80263c <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8025d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025d9:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8025df:	39 08                	cmp    %ecx,(%eax)
+  8025e1:	75 61                	jne    802644 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8025e3:	85 f6                	test   %esi,%esi
+  8025e5:	7e 50                	jle    802637 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8025e7:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8025ec:	39 de                	cmp    %ebx,%esi
+  8025ee:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8025f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025f4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025f7:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  8025fc:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802602:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802609:	83 ec 04             	sub    $0x4,%esp
+  80260c:	57                   	push   %edi
+  80260d:	ff 75 0c             	push   0xc(%ebp)
+  802610:	68 08 70 80 00       	push   $0x807008
+  802615:	e8 74 e4 ff ff       	call   800a8e <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80261a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80261f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802624:	e8 af f6 ff ff       	call   801cd8 <fsipc>
+  802629:	83 c4 10             	add    $0x10,%esp
+  80262c:	85 c0                	test   %eax,%eax
+  80262e:	78 0c                	js     80263c <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802630:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802633:	29 de                	sub    %ebx,%esi
+  802635:	eb ac                	jmp    8025e3 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802637:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80263c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80263f:	5b                   	pop    %ebx
+  802640:	5e                   	pop    %esi
+  802641:	5f                   	pop    %edi
+  802642:	5d                   	pop    %ebp
+  802643:	c3                   	ret
+    return -E_INVAL;
+  802644:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802649:	eb f1                	jmp    80263c <prefetch+0x85>
+
+0080264b <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  80264b:	55                   	push   %ebp
+  80264c:	89 e5                	mov    %esp,%ebp
+  80264e:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802651:	50                   	push   %eax
+  802652:	e8 d3 ef ff ff       	call   80162a <fd2data>
+  802657:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  80265c:	c9                   	leave
+  80265d:	c3                   	ret
+
+0080265e <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80265e:	55                   	push   %ebp
+  80265f:	89 e5                	mov    %esp,%ebp
+  802661:	56                   	push   %esi
+  802662:	53                   	push   %ebx
+  802663:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802666:	83 ec 0c             	sub    $0xc,%esp
+  802669:	ff 75 08             	push   0x8(%ebp)
+  80266c:	e8 b9 ef ff ff       	call   80162a <fd2data>
+  802671:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802673:	83 c4 08             	add    $0x8,%esp
+  802676:	68 94 40 80 00       	push   $0x804094
+  80267b:	53                   	push   %ebx
+  80267c:	e8 87 e2 ff ff       	call   800908 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802681:	8b 46 04             	mov    0x4(%esi),%eax
+  802684:	2b 06                	sub    (%esi),%eax
+  802686:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  80268c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802693:	00 00 00 
+  stat->st_dev = &devpipe;
+  802696:	c7 83 88 00 00 00 20 	movl   $0x805020,0x88(%ebx)
+  80269d:	50 80 00 
+  return 0;
+}
+  8026a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026a8:	5b                   	pop    %ebx
+  8026a9:	5e                   	pop    %esi
+  8026aa:	5d                   	pop    %ebp
+  8026ab:	c3                   	ret
+
+008026ac <pipe_wakeup>:
+{
+  8026ac:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8026ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b3:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8026b6:	85 c0                	test   %eax,%eax
+  8026b8:	75 01                	jne    8026bb <pipe_wakeup+0xf>
+  8026ba:	c3                   	ret
+{
+  8026bb:	55                   	push   %ebp
+  8026bc:	89 e5                	mov    %esp,%ebp
+  8026be:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8026c1:	6a 00                	push   $0x0
+  8026c3:	68 00 00 c0 ee       	push   $0xeec00000
+  8026c8:	52                   	push   %edx
+  8026c9:	e8 c5 e9 ff ff       	call   801093 <sys_chan_wakeup>
+  8026ce:	83 c4 10             	add    $0x10,%esp
+}
+  8026d1:	c9                   	leave
+  8026d2:	c3                   	ret
+
+008026d3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8026d3:	55                   	push   %ebp
+  8026d4:	89 e5                	mov    %esp,%ebp
+  8026d6:	57                   	push   %edi
+  8026d7:	56                   	push   %esi
+  8026d8:	53                   	push   %ebx
+  8026d9:	83 ec 18             	sub    $0x18,%esp
+  8026dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8026df:	57                   	push   %edi
+  8026e0:	e8 45 ef ff ff       	call   80162a <fd2data>
+  8026e5:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8026e7:	83 c4 10             	add    $0x10,%esp
+  8026ea:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8026ee:	74 2a                	je     80271a <devpipe_close+0x47>
+  8026f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8026f5:	89 f8                	mov    %edi,%eax
+  8026f7:	e8 4f ff ff ff       	call   80264b <pipe_ring>
+  8026fc:	83 ec 08             	sub    $0x8,%esp
+  8026ff:	01 d8                	add    %ebx,%eax
+  802701:	50                   	push   %eax
+  802702:	6a 00                	push   $0x0
+  802704:	e8 b3 e6 ff ff       	call   800dbc <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802709:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80270f:	83 c4 10             	add    $0x10,%esp
+  802712:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802718:	75 db                	jne    8026f5 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  80271a:	83 ec 08             	sub    $0x8,%esp
+  80271d:	57                   	push   %edi
+  80271e:	6a 00                	push   $0x0
+  802720:	e8 97 e6 ff ff       	call   800dbc <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802725:	83 c4 10             	add    $0x10,%esp
+  802728:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  80272c:	75 13                	jne    802741 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  80272e:	83 ec 08             	sub    $0x8,%esp
+  802731:	56                   	push   %esi
+  802732:	6a 00                	push   $0x0
+  802734:	e8 83 e6 ff ff       	call   800dbc <sys_page_unmap>
+}
+  802739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80273c:	5b                   	pop    %ebx
+  80273d:	5e                   	pop    %esi
+  80273e:	5f                   	pop    %edi
+  80273f:	5d                   	pop    %ebp
+  802740:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802741:	8d 56 04             	lea    0x4(%esi),%edx
+  802744:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802747:	e8 60 ff ff ff       	call   8026ac <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80274c:	8d 46 30             	lea    0x30(%esi),%eax
+  80274f:	89 f2                	mov    %esi,%edx
+  802751:	e8 56 ff ff ff       	call   8026ac <pipe_wakeup>
+  802756:	eb d6                	jmp    80272e <devpipe_close+0x5b>
+
+00802758 <_pipeisclosed>:
+{
+  802758:	55                   	push   %ebp
+  802759:	89 e5                	mov    %esp,%ebp
+  80275b:	57                   	push   %edi
+  80275c:	56                   	push   %esi
+  80275d:	53                   	push   %ebx
+  80275e:	83 ec 1c             	sub    $0x1c,%esp
+  802761:	89 c7                	mov    %eax,%edi
+  802763:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802765:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80276a:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  80276d:	83 ec 0c             	sub    $0xc,%esp
+  802770:	57                   	push   %edi
+  802771:	e8 99 10 00 00       	call   80380f <pageref>
+  802776:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802779:	89 34 24             	mov    %esi,(%esp)
+  80277c:	e8 8e 10 00 00       	call   80380f <pageref>
+    nn = thisenv->env_runs;
+  802781:	8b 15 a0 68 80 00    	mov    0x8068a0,%edx
+  802787:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  80278a:	83 c4 10             	add    $0x10,%esp
+  80278d:	39 cb                	cmp    %ecx,%ebx
+  80278f:	74 1b                	je     8027ac <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802791:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802794:	75 cf                	jne    802765 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802796:	8b 42 58             	mov    0x58(%edx),%eax
+  802799:	6a 01                	push   $0x1
+  80279b:	50                   	push   %eax
+  80279c:	53                   	push   %ebx
+  80279d:	68 9b 40 80 00       	push   $0x80409b
+  8027a2:	e8 73 db ff ff       	call   80031a <cprintf>
+  8027a7:	83 c4 10             	add    $0x10,%esp
+  8027aa:	eb b9                	jmp    802765 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8027ac:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027af:	0f 94 c0             	sete   %al
+  8027b2:	0f b6 c0             	movzbl %al,%eax
+}
+  8027b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027b8:	5b                   	pop    %ebx
+  8027b9:	5e                   	pop    %esi
+  8027ba:	5f                   	pop    %edi
+  8027bb:	5d                   	pop    %ebp
+  8027bc:	c3                   	ret
+
+008027bd <devpipe_write_bulk>:
+{
+  8027bd:	55                   	push   %ebp
+  8027be:	89 e5                	mov    %esp,%ebp
+  8027c0:	57                   	push   %edi
+  8027c1:	56                   	push   %esi
+  8027c2:	53                   	push   %ebx
+  8027c3:	83 ec 1c             	sub    $0x1c,%esp
+  8027c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8027c9:	89 d6                	mov    %edx,%esi
+  8027cb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8027ce:	e8 78 fe ff ff       	call   80264b <pipe_ring>
+  8027d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8027d6:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8027db:	8d 46 04             	lea    0x4(%esi),%eax
+  8027de:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8027e1:	eb 75                	jmp    802858 <devpipe_write_bulk+0x9b>
+  8027e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027e8:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8027ec:	6a 64                	push   $0x64
+  8027ee:	68 00 00 c0 ee       	push   $0xeec00000
+  8027f3:	53                   	push   %ebx
+  8027f4:	56                   	push   %esi
+  8027f5:	e8 76 e8 ff ff       	call   801070 <sys_chan_sleep>
+      continue;
+  8027fa:	83 c4 10             	add    $0x10,%esp
+  8027fd:	eb 59                	jmp    802858 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8027ff:	89 d1                	mov    %edx,%ecx
+  802801:	c1 f9 1f             	sar    $0x1f,%ecx
+  802804:	c1 e9 11             	shr    $0x11,%ecx
+  802807:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80280a:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80280f:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802811:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802817:	29 d3                	sub    %edx,%ebx
+  802819:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80281e:	29 c2                	sub    %eax,%edx
+  802820:	39 d3                	cmp    %edx,%ebx
+  802822:	0f 47 da             	cmova  %edx,%ebx
+  802825:	8b 55 08             	mov    0x8(%ebp),%edx
+  802828:	29 fa                	sub    %edi,%edx
+  80282a:	39 d3                	cmp    %edx,%ebx
+  80282c:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80282f:	83 ec 04             	sub    $0x4,%esp
+  802832:	53                   	push   %ebx
+  802833:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802836:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802839:	52                   	push   %edx
+  80283a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80283d:	01 c8                	add    %ecx,%eax
+  80283f:	50                   	push   %eax
+  802840:	e8 ab e2 ff ff       	call   800af0 <memcpy>
+    i += m;
+  802845:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802847:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80284a:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80284d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802850:	e8 57 fe ff ff       	call   8026ac <pipe_wakeup>
+  802855:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802858:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80285b:	73 2b                	jae    802888 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  80285d:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  80285f:	8b 56 04             	mov    0x4(%esi),%edx
+  802862:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802868:	39 d0                	cmp    %edx,%eax
+  80286a:	7d 93                	jge    8027ff <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  80286c:	89 f2                	mov    %esi,%edx
+  80286e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802871:	e8 e2 fe ff ff       	call   802758 <_pipeisclosed>
+  802876:	85 c0                	test   %eax,%eax
+  802878:	0f 84 65 ff ff ff    	je     8027e3 <devpipe_write_bulk+0x26>
+        return i;
+  80287e:	89 f8                	mov    %edi,%eax
+}
+  802880:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802883:	5b                   	pop    %ebx
+  802884:	5e                   	pop    %esi
+  802885:	5f                   	pop    %edi
+  802886:	5d                   	pop    %ebp
+  802887:	c3                   	ret
+  return i;
+  802888:	89 f8                	mov    %edi,%eax
+  80288a:	eb f4                	jmp    802880 <devpipe_write_bulk+0xc3>
+
+0080288c <devpipe_write>:
+{
+  80288c:	55                   	push   %ebp
+  80288d:	89 e5                	mov    %esp,%ebp
+  80288f:	57                   	push   %edi
+  802890:	56                   	push   %esi
+  802891:	53                   	push   %ebx
+  802892:	83 ec 28             	sub    $0x28,%esp
+  802895:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802898:	56                   	push   %esi
+  802899:	e8 8c ed ff ff       	call   80162a <fd2data>
+  80289e:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8028a0:	8b 78 28             	mov    0x28(%eax),%edi
+  8028a3:	83 c4 10             	add    $0x10,%esp
+  8028a6:	85 ff                	test   %edi,%edi
+  8028a8:	75 25                	jne    8028cf <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8028aa:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8028ad:	74 66                	je     802915 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8028af:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028b2:	8b 0b                	mov    (%ebx),%ecx
+  8028b4:	8d 51 20             	lea    0x20(%ecx),%edx
+  8028b7:	39 d0                	cmp    %edx,%eax
+  8028b9:	72 2b                	jb     8028e6 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8028bb:	89 da                	mov    %ebx,%edx
+  8028bd:	89 f0                	mov    %esi,%eax
+  8028bf:	e8 94 fe ff ff       	call   802758 <_pipeisclosed>
+  8028c4:	85 c0                	test   %eax,%eax
+  8028c6:	75 51                	jne    802919 <devpipe_write+0x8d>
+      sys_yield();
+  8028c8:	e8 08 e4 ff ff       	call   800cd5 <sys_yield>
+  8028cd:	eb e0                	jmp    8028af <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8028cf:	83 ec 0c             	sub    $0xc,%esp
+  8028d2:	ff 75 10             	push   0x10(%ebp)
+  8028d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028d8:	89 c2                	mov    %eax,%edx
+  8028da:	89 f0                	mov    %esi,%eax
+  8028dc:	e8 dc fe ff ff       	call   8027bd <devpipe_write_bulk>
+  8028e1:	83 c4 10             	add    $0x10,%esp
+  8028e4:	eb 38                	jmp    80291e <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8028e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028e9:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8028ed:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8028f0:	89 c2                	mov    %eax,%edx
+  8028f2:	c1 fa 1f             	sar    $0x1f,%edx
+  8028f5:	89 d1                	mov    %edx,%ecx
+  8028f7:	c1 e9 1b             	shr    $0x1b,%ecx
+  8028fa:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8028fd:	83 e2 1f             	and    $0x1f,%edx
+  802900:	29 ca                	sub    %ecx,%edx
+  802902:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802906:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  80290a:	83 c0 01             	add    $0x1,%eax
+  80290d:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802910:	83 c7 01             	add    $0x1,%edi
+  802913:	eb 95                	jmp    8028aa <devpipe_write+0x1e>
+  return i;
+  802915:	89 f8                	mov    %edi,%eax
+  802917:	eb 05                	jmp    80291e <devpipe_write+0x92>
+        return 0;
+  802919:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80291e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802921:	5b                   	pop    %ebx
+  802922:	5e                   	pop    %esi
+  802923:	5f                   	pop    %edi
+  802924:	5d                   	pop    %ebp
+  802925:	c3                   	ret
+
+00802926 <devpipe_read_bulk>:
+{
+  802926:	55                   	push   %ebp
+  802927:	89 e5                	mov    %esp,%ebp
+  802929:	57                   	push   %edi
+  80292a:	56                   	push   %esi
+  80292b:	53                   	push   %ebx
+  80292c:	83 ec 2c             	sub    $0x2c,%esp
+  80292f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802932:	89 d6                	mov    %edx,%esi
+  802934:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802937:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  80293a:	e8 0c fd ff ff       	call   80264b <pipe_ring>
+  80293f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802942:	85 db                	test   %ebx,%ebx
+  802944:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802949:	0f 45 c3             	cmovne %ebx,%eax
+  80294c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80294f:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802954:	8d 46 30             	lea    0x30(%esi),%eax
+  802957:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80295a:	eb 50                	jmp    8029ac <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  80295c:	89 d1                	mov    %edx,%ecx
+  80295e:	c1 f9 1f             	sar    $0x1f,%ecx
+  802961:	c1 e9 11             	shr    $0x11,%ecx
+  802964:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802967:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80296c:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  80296e:	29 d3                	sub    %edx,%ebx
+  802970:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802975:	29 c2                	sub    %eax,%edx
+  802977:	39 d3                	cmp    %edx,%ebx
+  802979:	0f 47 da             	cmova  %edx,%ebx
+  80297c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80297f:	29 fa                	sub    %edi,%edx
+  802981:	39 d3                	cmp    %edx,%ebx
+  802983:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802986:	83 ec 04             	sub    $0x4,%esp
+  802989:	53                   	push   %ebx
+  80298a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80298d:	01 c8                	add    %ecx,%eax
+  80298f:	50                   	push   %eax
+  802990:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802993:	01 f8                	add    %edi,%eax
+  802995:	50                   	push   %eax
+  802996:	e8 55 e1 ff ff       	call   800af0 <memcpy>
+    i += m;
+  80299b:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  80299d:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80299f:	89 f2                	mov    %esi,%edx
+  8029a1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8029a4:	e8 03 fd ff ff       	call   8026ac <pipe_wakeup>
+  8029a9:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8029ac:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8029af:	73 51                	jae    802a02 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8029b1:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8029b4:	8b 16                	mov    (%esi),%edx
+  8029b6:	39 da                	cmp    %ebx,%edx
+  8029b8:	75 a2                	jne    80295c <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8029ba:	85 ff                	test   %edi,%edi
+  8029bc:	75 44                	jne    802a02 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8029be:	89 f2                	mov    %esi,%edx
+  8029c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029c3:	e8 90 fd ff ff       	call   802758 <_pipeisclosed>
+  8029c8:	85 c0                	test   %eax,%eax
+  8029ca:	75 3a                	jne    802a06 <devpipe_read_bulk+0xe0>
+  8029cc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029d1:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8029d5:	6a 64                	push   $0x64
+  8029d7:	ff 75 d4             	push   -0x2c(%ebp)
+  8029da:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8029db:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8029de:	50                   	push   %eax
+  8029df:	e8 8c e6 ff ff       	call   801070 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8029e4:	85 c0                	test   %eax,%eax
+  8029e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029eb:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  8029ee:	83 c4 10             	add    $0x10,%esp
+  8029f1:	a8 01                	test   $0x1,%al
+  8029f3:	74 b7                	je     8029ac <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  8029f5:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  8029fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029fd:	5b                   	pop    %ebx
+  8029fe:	5e                   	pop    %esi
+  8029ff:	5f                   	pop    %edi
+  802a00:	5d                   	pop    %ebp
+  802a01:	c3                   	ret
+  return i;
+  802a02:	89 f8                	mov    %edi,%eax
+  802a04:	eb f4                	jmp    8029fa <devpipe_read_bulk+0xd4>
+        return 0;
+  802a06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0b:	eb ed                	jmp    8029fa <devpipe_read_bulk+0xd4>
+
+00802a0d <devpipe_read>:
+{
+  802a0d:	55                   	push   %ebp
+  802a0e:	89 e5                	mov    %esp,%ebp
+  802a10:	57                   	push   %edi
+  802a11:	56                   	push   %esi
+  802a12:	53                   	push   %ebx
+  802a13:	83 ec 18             	sub    $0x18,%esp
+  802a16:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802a19:	57                   	push   %edi
+  802a1a:	e8 0b ec ff ff       	call   80162a <fd2data>
+  802a1f:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802a21:	8b 70 28             	mov    0x28(%eax),%esi
+  802a24:	83 c4 10             	add    $0x10,%esp
+  802a27:	85 f6                	test   %esi,%esi
+  802a29:	75 24                	jne    802a4f <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802a2b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a2e:	74 60                	je     802a90 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802a30:	8b 03                	mov    (%ebx),%eax
+  802a32:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802a35:	75 3b                	jne    802a72 <devpipe_read+0x65>
+      if (i > 0)
+  802a37:	85 f6                	test   %esi,%esi
+  802a39:	75 2d                	jne    802a68 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802a3b:	89 da                	mov    %ebx,%edx
+  802a3d:	89 f8                	mov    %edi,%eax
+  802a3f:	e8 14 fd ff ff       	call   802758 <_pipeisclosed>
+  802a44:	85 c0                	test   %eax,%eax
+  802a46:	75 4c                	jne    802a94 <devpipe_read+0x87>
+      sys_yield();
+  802a48:	e8 88 e2 ff ff       	call   800cd5 <sys_yield>
+  802a4d:	eb e1                	jmp    802a30 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802a4f:	83 ec 08             	sub    $0x8,%esp
+  802a52:	6a 00                	push   $0x0
+  802a54:	ff 75 10             	push   0x10(%ebp)
+  802a57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a5a:	89 c2                	mov    %eax,%edx
+  802a5c:	89 f8                	mov    %edi,%eax
+  802a5e:	e8 c3 fe ff ff       	call   802926 <devpipe_read_bulk>
+  802a63:	83 c4 10             	add    $0x10,%esp
+  802a66:	eb 02                	jmp    802a6a <devpipe_read+0x5d>
+        return i;
+  802a68:	89 f0                	mov    %esi,%eax
+}
+  802a6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a6d:	5b                   	pop    %ebx
+  802a6e:	5e                   	pop    %esi
+  802a6f:	5f                   	pop    %edi
+  802a70:	5d                   	pop    %ebp
+  802a71:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802a72:	99                   	cltd
+  802a73:	c1 ea 1b             	shr    $0x1b,%edx
+  802a76:	01 d0                	add    %edx,%eax
+  802a78:	83 e0 1f             	and    $0x1f,%eax
+  802a7b:	29 d0                	sub    %edx,%eax
+  802a7d:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802a82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a85:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802a88:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802a8b:	83 c6 01             	add    $0x1,%esi
+  802a8e:	eb 9b                	jmp    802a2b <devpipe_read+0x1e>
+  return i;
+  802a90:	89 f0                	mov    %esi,%eax
+  802a92:	eb d6                	jmp    802a6a <devpipe_read+0x5d>
+        return 0;
+  802a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a99:	eb cf                	jmp    802a6a <devpipe_read+0x5d>
+
+00802a9b <pipe2>:
+{
+  802a9b:	55                   	push   %ebp
+  802a9c:	89 e5                	mov    %esp,%ebp
+  802a9e:	57                   	push   %edi
+  802a9f:	56                   	push   %esi
+  802aa0:	53                   	push   %ebx
+  802aa1:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802aa4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802aa7:	50                   	push   %eax
+  802aa8:	e8 91 eb ff ff       	call   80163e <fd_alloc>
+  802aad:	89 c3                	mov    %eax,%ebx
+  802aaf:	83 c4 10             	add    $0x10,%esp
+  802ab2:	85 c0                	test   %eax,%eax
+  802ab4:	0f 88 fb 01 00 00    	js     802cb5 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802aba:	83 ec 04             	sub    $0x4,%esp
+  802abd:	68 07 04 00 00       	push   $0x407
+  802ac2:	ff 75 e4             	push   -0x1c(%ebp)
+  802ac5:	6a 00                	push   $0x0
+  802ac7:	e8 6b e2 ff ff       	call   800d37 <sys_page_alloc>
+  802acc:	89 c3                	mov    %eax,%ebx
+  802ace:	83 c4 10             	add    $0x10,%esp
+  802ad1:	85 c0                	test   %eax,%eax
+  802ad3:	0f 88 dc 01 00 00    	js     802cb5 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802ad9:	83 ec 0c             	sub    $0xc,%esp
+  802adc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802adf:	50                   	push   %eax
+  802ae0:	e8 59 eb ff ff       	call   80163e <fd_alloc>
+  802ae5:	89 c3                	mov    %eax,%ebx
+  802ae7:	83 c4 10             	add    $0x10,%esp
+  802aea:	85 c0                	test   %eax,%eax
+  802aec:	0f 88 b3 01 00 00    	js     802ca5 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802af2:	83 ec 04             	sub    $0x4,%esp
+  802af5:	68 07 04 00 00       	push   $0x407
+  802afa:	ff 75 e0             	push   -0x20(%ebp)
+  802afd:	6a 00                	push   $0x0
+  802aff:	e8 33 e2 ff ff       	call   800d37 <sys_page_alloc>
+  802b04:	89 c3                	mov    %eax,%ebx
+  802b06:	83 c4 10             	add    $0x10,%esp
+  802b09:	85 c0                	test   %eax,%eax
+  802b0b:	0f 88 94 01 00 00    	js     802ca5 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802b11:	83 ec 0c             	sub    $0xc,%esp
+  802b14:	ff 75 e4             	push   -0x1c(%ebp)
+  802b17:	e8 0e eb ff ff       	call   80162a <fd2data>
+  802b1c:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b1e:	83 c4 0c             	add    $0xc,%esp
+  802b21:	68 07 04 00 00       	push   $0x407
+  802b26:	50                   	push   %eax
+  802b27:	6a 00                	push   $0x0
+  802b29:	e8 09 e2 ff ff       	call   800d37 <sys_page_alloc>
+  802b2e:	89 c3                	mov    %eax,%ebx
+  802b30:	83 c4 10             	add    $0x10,%esp
+  802b33:	85 c0                	test   %eax,%eax
+  802b35:	0f 88 5a 01 00 00    	js     802c95 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b3b:	83 ec 0c             	sub    $0xc,%esp
+  802b3e:	ff 75 e0             	push   -0x20(%ebp)
+  802b41:	e8 e4 ea ff ff       	call   80162a <fd2data>
+  802b46:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802b4d:	50                   	push   %eax
+  802b4e:	6a 00                	push   $0x0
+  802b50:	57                   	push   %edi
+  802b51:	6a 00                	push   $0x0
+  802b53:	e8 22 e2 ff ff       	call   800d7a <sys_page_map>
+  802b58:	89 c3                	mov    %eax,%ebx
+  802b5a:	83 c4 20             	add    $0x20,%esp
+  802b5d:	85 c0                	test   %eax,%eax
+  802b5f:	0f 88 22 01 00 00    	js     802c87 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802b65:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802b69:	74 72                	je     802bdd <pipe2+0x142>
+  802b6b:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802b70:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b73:	e8 d3 fa ff ff       	call   80264b <pipe_ring>
+  802b78:	83 ec 04             	sub    $0x4,%esp
+  802b7b:	68 07 04 00 00       	push   $0x407
+  802b80:	01 f0                	add    %esi,%eax
+  802b82:	50                   	push   %eax
+  802b83:	6a 00                	push   $0x0
+  802b85:	e8 ad e1 ff ff       	call   800d37 <sys_page_alloc>
+  802b8a:	89 c3                	mov    %eax,%ebx
+  802b8c:	83 c4 10             	add    $0x10,%esp
+  802b8f:	85 c0                	test   %eax,%eax
+  802b91:	0f 88 97 00 00 00    	js     802c2e <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802b97:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b9a:	e8 ac fa ff ff       	call   80264b <pipe_ring>
+  802b9f:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802ba2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ba5:	e8 a1 fa ff ff       	call   80264b <pipe_ring>
+  802baa:	83 ec 0c             	sub    $0xc,%esp
+  802bad:	68 07 04 00 00       	push   $0x407
+  802bb2:	53                   	push   %ebx
+  802bb3:	6a 00                	push   $0x0
+  802bb5:	01 f0                	add    %esi,%eax
+  802bb7:	50                   	push   %eax
+  802bb8:	6a 00                	push   $0x0
+  802bba:	e8 bb e1 ff ff       	call   800d7a <sys_page_map>
+  802bbf:	89 c3                	mov    %eax,%ebx
+  802bc1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802bc7:	83 c4 20             	add    $0x20,%esp
+  802bca:	85 c0                	test   %eax,%eax
+  802bcc:	78 60                	js     802c2e <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802bce:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802bd4:	75 9a                	jne    802b70 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802bd6:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802bdd:	a1 20 50 80 00       	mov    0x805020,%eax
+  802be2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802be5:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802be7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802bea:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802bf1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802bf4:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802bf6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802bf9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802c00:	83 ec 0c             	sub    $0xc,%esp
+  802c03:	ff 75 e4             	push   -0x1c(%ebp)
+  802c06:	e8 0f ea ff ff       	call   80161a <fd2num>
+  802c0b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c0e:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802c10:	83 c4 04             	add    $0x4,%esp
+  802c13:	ff 75 e0             	push   -0x20(%ebp)
+  802c16:	e8 ff e9 ff ff       	call   80161a <fd2num>
+  802c1b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c1e:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802c21:	83 c4 10             	add    $0x10,%esp
+  802c24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c29:	e9 87 00 00 00       	jmp    802cb5 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802c2e:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802c33:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c36:	e8 10 fa ff ff       	call   80264b <pipe_ring>
+  802c3b:	83 ec 08             	sub    $0x8,%esp
+  802c3e:	01 f0                	add    %esi,%eax
+  802c40:	50                   	push   %eax
+  802c41:	6a 00                	push   $0x0
+  802c43:	e8 74 e1 ff ff       	call   800dbc <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802c48:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c4b:	e8 fb f9 ff ff       	call   80264b <pipe_ring>
+  802c50:	83 c4 08             	add    $0x8,%esp
+  802c53:	01 f0                	add    %esi,%eax
+  802c55:	50                   	push   %eax
+  802c56:	6a 00                	push   $0x0
+  802c58:	e8 5f e1 ff ff       	call   800dbc <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802c5d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c63:	83 c4 10             	add    $0x10,%esp
+  802c66:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802c6c:	75 c5                	jne    802c33 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802c6e:	83 ec 0c             	sub    $0xc,%esp
+  802c71:	ff 75 e0             	push   -0x20(%ebp)
+  802c74:	e8 b1 e9 ff ff       	call   80162a <fd2data>
+  802c79:	83 c4 08             	add    $0x8,%esp
+  802c7c:	50                   	push   %eax
+  802c7d:	6a 00                	push   $0x0
+  802c7f:	e8 38 e1 ff ff       	call   800dbc <sys_page_unmap>
+  802c84:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802c87:	83 ec 08             	sub    $0x8,%esp
+  802c8a:	57                   	push   %edi
+  802c8b:	6a 00                	push   $0x0
+  802c8d:	e8 2a e1 ff ff       	call   800dbc <sys_page_unmap>
+  802c92:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802c95:	83 ec 08             	sub    $0x8,%esp
+  802c98:	ff 75 e0             	push   -0x20(%ebp)
+  802c9b:	6a 00                	push   $0x0
+  802c9d:	e8 1a e1 ff ff       	call   800dbc <sys_page_unmap>
+  802ca2:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802ca5:	83 ec 08             	sub    $0x8,%esp
+  802ca8:	ff 75 e4             	push   -0x1c(%ebp)
+  802cab:	6a 00                	push   $0x0
+  802cad:	e8 0a e1 ff ff       	call   800dbc <sys_page_unmap>
+  802cb2:	83 c4 10             	add    $0x10,%esp
+}
+  802cb5:	89 d8                	mov    %ebx,%eax
+  802cb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cba:	5b                   	pop    %ebx
+  802cbb:	5e                   	pop    %esi
+  802cbc:	5f                   	pop    %edi
+  802cbd:	5d                   	pop    %ebp
+  802cbe:	c3                   	ret
+
+00802cbf <pipe>:
+{
+  802cbf:	55                   	push   %ebp
+  802cc0:	89 e5                	mov    %esp,%ebp
+  802cc2:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802cc5:	6a 00                	push   $0x0
+  802cc7:	ff 75 08             	push   0x8(%ebp)
+  802cca:	e8 cc fd ff ff       	call   802a9b <pipe2>
+}
+  802ccf:	c9                   	leave
+  802cd0:	c3                   	ret
+
+00802cd1 <pipeisclosed>:
+{
+  802cd1:	55                   	push   %ebp
+  802cd2:	89 e5                	mov    %esp,%ebp
+  802cd4:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802cd7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cda:	50                   	push   %eax
+  802cdb:	ff 75 08             	push   0x8(%ebp)
+  802cde:	e8 b1 e9 ff ff       	call   801694 <fd_lookup>
+  802ce3:	83 c4 10             	add    $0x10,%esp
+  802ce6:	85 c0                	test   %eax,%eax
+  802ce8:	78 18                	js     802d02 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802cea:	83 ec 0c             	sub    $0xc,%esp
+  802ced:	ff 75 f4             	push   -0xc(%ebp)
+  802cf0:	e8 35 e9 ff ff       	call   80162a <fd2data>
+  802cf5:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802cf7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cfa:	e8 59 fa ff ff       	call   802758 <_pipeisclosed>
+  802cff:	83 c4 10             	add    $0x10,%esp
+}
+  802d02:	c9                   	leave
+  802d03:	c3                   	ret
+
+00802d04 <pipe_splice>:
+{
+  802d04:	55                   	push   %ebp
+  802d05:	89 e5                	mov    %esp,%ebp
+  802d07:	57                   	push   %edi
+  802d08:	56                   	push   %esi
+  802d09:	53                   	push   %ebx
+  802d0a:	83 ec 34             	sub    $0x34,%esp
+  802d0d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d10:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802d13:	50                   	push   %eax
+  802d14:	ff 75 08             	push   0x8(%ebp)
+  802d17:	e8 78 e9 ff ff       	call   801694 <fd_lookup>
+  802d1c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d1f:	83 c4 10             	add    $0x10,%esp
+  802d22:	85 c0                	test   %eax,%eax
+  802d24:	0f 88 d7 00 00 00    	js     802e01 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802d2a:	83 ec 0c             	sub    $0xc,%esp
+  802d2d:	ff 75 e4             	push   -0x1c(%ebp)
+  802d30:	e8 f5 e8 ff ff       	call   80162a <fd2data>
+  802d35:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802d37:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d3a:	83 c4 10             	add    $0x10,%esp
+  802d3d:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802d43:	39 10                	cmp    %edx,(%eax)
+  802d45:	0f 85 c1 00 00 00    	jne    802e0c <pipe_splice+0x108>
+  802d4b:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802d4f:	0f 84 c0 00 00 00    	je     802e15 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802d55:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802d59:	0f 84 bf 00 00 00    	je     802e1e <pipe_splice+0x11a>
+  802d5f:	89 f7                	mov    %esi,%edi
+  802d61:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802d67:	0f 85 ba 00 00 00    	jne    802e27 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802d6d:	8d 43 04             	lea    0x4(%ebx),%eax
+  802d70:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d73:	eb 38                	jmp    802dad <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802d75:	83 ec 0c             	sub    $0xc,%esp
+  802d78:	68 00 10 00 00       	push   $0x1000
+  802d7d:	89 f1                	mov    %esi,%ecx
+  802d7f:	89 da                	mov    %ebx,%edx
+  802d81:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d84:	e8 34 fa ff ff       	call   8027bd <devpipe_write_bulk>
+  802d89:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d8c:	83 c4 10             	add    $0x10,%esp
+  802d8f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802d94:	75 53                	jne    802de9 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802d96:	83 ec 08             	sub    $0x8,%esp
+  802d99:	56                   	push   %esi
+  802d9a:	6a 00                	push   $0x0
+  802d9c:	e8 1b e0 ff ff       	call   800dbc <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802da1:	83 c7 01             	add    $0x1,%edi
+  802da4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802daa:	83 c4 10             	add    $0x10,%esp
+  802dad:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802db0:	74 3a                	je     802dec <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802db2:	8b 03                	mov    (%ebx),%eax
+  802db4:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802db7:	75 bc                	jne    802d75 <pipe_splice+0x71>
+  802db9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dbe:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802dc2:	85 c0                	test   %eax,%eax
+  802dc4:	74 af                	je     802d75 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802dc6:	83 ec 04             	sub    $0x4,%esp
+  802dc9:	6a 07                	push   $0x7
+  802dcb:	56                   	push   %esi
+  802dcc:	ff 75 d0             	push   -0x30(%ebp)
+  802dcf:	e8 bf e2 ff ff       	call   801093 <sys_chan_wakeup>
+  802dd4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802dd7:	83 c4 10             	add    $0x10,%esp
+  802dda:	85 c0                	test   %eax,%eax
+  802ddc:	79 b8                	jns    802d96 <pipe_splice+0x92>
+  802dde:	b8 01 00 00 00       	mov    $0x1,%eax
+  802de3:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802de7:	eb 8c                	jmp    802d75 <pipe_splice+0x71>
+  802de9:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802dec:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802df0:	75 06                	jne    802df8 <pipe_splice+0xf4>
+  802df2:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802df6:	78 09                	js     802e01 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802df8:	8b 45 10             	mov    0x10(%ebp),%eax
+  802dfb:	c1 e0 0c             	shl    $0xc,%eax
+  802dfe:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802e01:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802e04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e07:	5b                   	pop    %ebx
+  802e08:	5e                   	pop    %esi
+  802e09:	5f                   	pop    %edi
+  802e0a:	5d                   	pop    %ebp
+  802e0b:	c3                   	ret
+    return -E_INVAL;
+  802e0c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e13:	eb ec                	jmp    802e01 <pipe_splice+0xfd>
+  802e15:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e1c:	eb e3                	jmp    802e01 <pipe_splice+0xfd>
+  802e1e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e25:	eb da                	jmp    802e01 <pipe_splice+0xfd>
+  802e27:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e2e:	eb d1                	jmp    802e01 <pipe_splice+0xfd>
+
+00802e30 <pipe_splice_read>:
+{
+  802e30:	55                   	push   %ebp
+  802e31:	89 e5                	mov    %esp,%ebp
+  802e33:	53                   	push   %ebx
+  802e34:	83 ec 1c             	sub    $0x1c,%esp
+  802e37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e3d:	50                   	push   %eax
+  802e3e:	ff 75 08             	push   0x8(%ebp)
+  802e41:	e8 4e e8 ff ff       	call   801694 <fd_lookup>
+  802e46:	83 c4 10             	add    $0x10,%esp
+  802e49:	85 c0                	test   %eax,%eax
+  802e4b:	78 49                	js     802e96 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802e4d:	83 ec 0c             	sub    $0xc,%esp
+  802e50:	ff 75 f4             	push   -0xc(%ebp)
+  802e53:	e8 d2 e7 ff ff       	call   80162a <fd2data>
+  802e58:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802e5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e5d:	83 c4 10             	add    $0x10,%esp
+  802e60:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802e66:	39 08                	cmp    %ecx,(%eax)
+  802e68:	75 31                	jne    802e9b <pipe_splice_read+0x6b>
+  802e6a:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802e6e:	74 32                	je     802ea2 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802e70:	8b 48 08             	mov    0x8(%eax),%ecx
+  802e73:	83 e1 03             	and    $0x3,%ecx
+  802e76:	83 f9 01             	cmp    $0x1,%ecx
+  802e79:	74 2e                	je     802ea9 <pipe_splice_read+0x79>
+  802e7b:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802e81:	75 2d                	jne    802eb0 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802e83:	83 ec 08             	sub    $0x8,%esp
+  802e86:	53                   	push   %ebx
+  802e87:	68 00 10 00 00       	push   $0x1000
+  802e8c:	89 d9                	mov    %ebx,%ecx
+  802e8e:	e8 93 fa ff ff       	call   802926 <devpipe_read_bulk>
+  802e93:	83 c4 10             	add    $0x10,%esp
+}
+  802e96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e99:	c9                   	leave
+  802e9a:	c3                   	ret
+    return -E_INVAL;
+  802e9b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ea0:	eb f4                	jmp    802e96 <pipe_splice_read+0x66>
+  802ea2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ea7:	eb ed                	jmp    802e96 <pipe_splice_read+0x66>
+  802ea9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eae:	eb e6                	jmp    802e96 <pipe_splice_read+0x66>
+  802eb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eb5:	eb df                	jmp    802e96 <pipe_splice_read+0x66>
+
+00802eb7 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  802eb7:	55                   	push   %ebp
+  802eb8:	89 e5                	mov    %esp,%ebp
+  802eba:	56                   	push   %esi
+  802ebb:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  802ebc:	ba 60 67 80 00       	mov    $0x806760,%edx
+  802ec1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ec6:	eb 0b                	jmp    802ed3 <mmap_find+0x1c>
+  802ec8:	83 c3 01             	add    $0x1,%ebx
+  802ecb:	83 c2 14             	add    $0x14,%edx
+  802ece:	83 fb 10             	cmp    $0x10,%ebx
+  802ed1:	74 1d                	je     802ef0 <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802ed3:	8b 0a                	mov    (%edx),%ecx
+  802ed5:	39 c8                	cmp    %ecx,%eax
+  802ed7:	72 ef                	jb     802ec8 <mmap_find+0x11>
+  802ed9:	85 c9                	test   %ecx,%ecx
+  802edb:	74 eb                	je     802ec8 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  802edd:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802ee0:	39 c8                	cmp    %ecx,%eax
+  802ee2:	73 e4                	jae    802ec8 <mmap_find+0x11>
+      return &mmaps[i];
+  802ee4:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ee7:	8d 04 85 60 67 80 00 	lea    0x806760(,%eax,4),%eax
+  802eee:	eb 05                	jmp    802ef5 <mmap_find+0x3e>
+  return NULL;
+  802ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ef5:	5b                   	pop    %ebx
+  802ef6:	5e                   	pop    %esi
+  802ef7:	5d                   	pop    %ebp
+  802ef8:	c3                   	ret
+
+00802ef9 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802ef9:	89 c2                	mov    %eax,%edx
+  802efb:	c1 ea 16             	shr    $0x16,%edx
+  802efe:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802f05:	f6 c2 01             	test   $0x1,%dl
+  802f08:	74 11                	je     802f1b <va_mapped+0x22>
+  802f0a:	c1 e8 0c             	shr    $0xc,%eax
+  802f0d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f14:	83 e0 01             	and    $0x1,%eax
+  802f17:	83 e0 01             	and    $0x1,%eax
+}
+  802f1a:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f20:	eb f5                	jmp    802f17 <va_mapped+0x1e>
+
+00802f22 <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  802f22:	55                   	push   %ebp
+  802f23:	89 e5                	mov    %esp,%ebp
+  802f25:	57                   	push   %edi
+  802f26:	56                   	push   %esi
+  802f27:	53                   	push   %ebx
+  802f28:	83 ec 10             	sub    $0x10,%esp
+  802f2b:	89 c3                	mov    %eax,%ebx
+  802f2d:	89 d7                	mov    %edx,%edi
+  802f2f:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802f31:	6a 07                	push   $0x7
+  802f33:	68 00 f0 7f 00       	push   $0x7ff000
+  802f38:	6a 00                	push   $0x0
+  802f3a:	e8 f8 dd ff ff       	call   800d37 <sys_page_alloc>
+  802f3f:	83 c4 10             	add    $0x10,%esp
+  802f42:	85 c0                	test   %eax,%eax
+  802f44:	78 46                	js     802f8c <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  802f46:	83 ec 04             	sub    $0x4,%esp
+  802f49:	57                   	push   %edi
+  802f4a:	53                   	push   %ebx
+  802f4b:	68 00 f0 7f 00       	push   $0x7ff000
+  802f50:	e8 39 db ff ff       	call   800a8e <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802f55:	89 34 24             	mov    %esi,(%esp)
+  802f58:	53                   	push   %ebx
+  802f59:	6a 00                	push   $0x0
+  802f5b:	68 00 f0 7f 00       	push   $0x7ff000
+  802f60:	6a 00                	push   $0x0
+  802f62:	e8 13 de ff ff       	call   800d7a <sys_page_map>
+  802f67:	83 c4 20             	add    $0x20,%esp
+  802f6a:	85 c0                	test   %eax,%eax
+  802f6c:	78 30                	js     802f9e <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  802f6e:	83 ec 08             	sub    $0x8,%esp
+  802f71:	68 00 f0 7f 00       	push   $0x7ff000
+  802f76:	6a 00                	push   $0x0
+  802f78:	e8 3f de ff ff       	call   800dbc <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802f7d:	83 c4 10             	add    $0x10,%esp
+  802f80:	85 c0                	test   %eax,%eax
+  802f82:	78 1a                	js     802f9e <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  802f84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f87:	5b                   	pop    %ebx
+  802f88:	5e                   	pop    %esi
+  802f89:	5f                   	pop    %edi
+  802f8a:	5d                   	pop    %ebp
+  802f8b:	c3                   	ret
+    panic("mmap: %e", r);
+  802f8c:	50                   	push   %eax
+  802f8d:	68 b3 40 80 00       	push   $0x8040b3
+  802f92:	6a 3e                	push   $0x3e
+  802f94:	68 bc 40 80 00       	push   $0x8040bc
+  802f99:	e8 a1 d2 ff ff       	call   80023f <_panic>
+    panic("mmap: %e", r);
+  802f9e:	50                   	push   %eax
+  802f9f:	68 b3 40 80 00       	push   $0x8040b3
+  802fa4:	6a 42                	push   $0x42
+  802fa6:	68 bc 40 80 00       	push   $0x8040bc
+  802fab:	e8 8f d2 ff ff       	call   80023f <_panic>
+
+00802fb0 <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  802fb0:	55                   	push   %ebp
+  802fb1:	89 e5                	mov    %esp,%ebp
+  802fb3:	57                   	push   %edi
+  802fb4:	56                   	push   %esi
+  802fb5:	53                   	push   %ebx
+  802fb6:	83 ec 1c             	sub    $0x1c,%esp
+  802fb9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  802fbc:	8b 1f                	mov    (%edi),%ebx
+  802fbe:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  802fc4:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  802fca:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  802fcf:	0f 87 24 01 00 00    	ja     8030f9 <mmap_fault+0x149>
+  802fd5:	89 d8                	mov    %ebx,%eax
+  802fd7:	e8 db fe ff ff       	call   802eb7 <mmap_find>
+  802fdc:	89 c6                	mov    %eax,%esi
+  802fde:	85 c0                	test   %eax,%eax
+  802fe0:	0f 84 20 01 00 00    	je     803106 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  802fe6:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  802fea:	74 13                	je     802fff <mmap_fault+0x4f>
+  802fec:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  802ff0:	0f 84 17 01 00 00    	je     80310d <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  802ff6:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  802ffd:	eb 0f                	jmp    80300e <mmap_fault+0x5e>
+  802fff:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  803003:	19 c0                	sbb    %eax,%eax
+  803005:	83 e0 fe             	and    $0xfffffffe,%eax
+  803008:	83 c0 07             	add    $0x7,%eax
+  80300b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  80300e:	89 d8                	mov    %ebx,%eax
+  803010:	e8 e4 fe ff ff       	call   802ef9 <va_mapped>
+  803015:	84 c0                	test   %al,%al
+  803017:	74 42                	je     80305b <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  803019:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  80301e:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803022:	0f 84 d6 00 00 00    	je     8030fe <mmap_fault+0x14e>
+  803028:	89 d8                	mov    %ebx,%eax
+  80302a:	c1 e8 0c             	shr    $0xc,%eax
+  80302d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  803034:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803039:	f6 c2 02             	test   $0x2,%dl
+  80303c:	0f 85 bc 00 00 00    	jne    8030fe <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  803042:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803045:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80304a:	89 d8                	mov    %ebx,%eax
+  80304c:	e8 d1 fe ff ff       	call   802f22 <mmap_copy>
+  return 1;
+  803051:	b8 01 00 00 00       	mov    $0x1,%eax
+  803056:	e9 a3 00 00 00       	jmp    8030fe <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  80305b:	a1 00 70 80 00       	mov    0x807000,%eax
+  803060:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803063:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  803069:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  80306c:	83 ec 04             	sub    $0x4,%esp
+  80306f:	53                   	push   %ebx
+  803070:	89 d8                	mov    %ebx,%eax
+  803072:	03 46 0c             	add    0xc(%esi),%eax
+  803075:	2b 06                	sub    (%esi),%eax
+  803077:	50                   	push   %eax
+  803078:	ff 76 08             	push   0x8(%esi)
+  80307b:	e8 86 f3 ff ff       	call   802406 <read_map>
+    fsipcbuf.read_map = saved;
+  803080:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803083:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+  803089:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80308c:	89 15 04 70 80 00    	mov    %edx,0x807004
+    if (r < 0)
+  803092:	83 c4 10             	add    $0x10,%esp
+  803095:	85 c0                	test   %eax,%eax
+  803097:	78 20                	js     8030b9 <mmap_fault+0x109>
+    if (r == 0) {
+  803099:	74 30                	je     8030cb <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  80309b:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8030a0:	0f 8f 73 ff ff ff    	jg     803019 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  8030a6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8030a9:	89 c2                	mov    %eax,%edx
+  8030ab:	89 d8                	mov    %ebx,%eax
+  8030ad:	e8 70 fe ff ff       	call   802f22 <mmap_copy>
+      return 1;
+  8030b2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030b7:	eb 45                	jmp    8030fe <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  8030b9:	50                   	push   %eax
+  8030ba:	68 c7 40 80 00       	push   $0x8040c7
+  8030bf:	6a 5f                	push   $0x5f
+  8030c1:	68 bc 40 80 00       	push   $0x8040bc
+  8030c6:	e8 74 d1 ff ff       	call   80023f <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  8030cb:	83 ec 04             	sub    $0x4,%esp
+  8030ce:	ff 75 e4             	push   -0x1c(%ebp)
+  8030d1:	53                   	push   %ebx
+  8030d2:	6a 00                	push   $0x0
+  8030d4:	e8 5e dc ff ff       	call   800d37 <sys_page_alloc>
+  8030d9:	83 c4 10             	add    $0x10,%esp
+  8030dc:	85 c0                	test   %eax,%eax
+  8030de:	78 07                	js     8030e7 <mmap_fault+0x137>
+      return 1;
+  8030e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030e5:	eb 17                	jmp    8030fe <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  8030e7:	50                   	push   %eax
+  8030e8:	68 b3 40 80 00       	push   $0x8040b3
+  8030ed:	6a 64                	push   $0x64
+  8030ef:	68 bc 40 80 00       	push   $0x8040bc
+  8030f4:	e8 46 d1 ff ff       	call   80023f <_panic>
+    return 0;
+  8030f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803101:	5b                   	pop    %ebx
+  803102:	5e                   	pop    %esi
+  803103:	5f                   	pop    %edi
+  803104:	5d                   	pop    %ebp
+  803105:	c3                   	ret
+    return 0;
+  803106:	b8 00 00 00 00       	mov    $0x0,%eax
+  80310b:	eb f1                	jmp    8030fe <mmap_fault+0x14e>
+    return 0;
+  80310d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803112:	eb ea                	jmp    8030fe <mmap_fault+0x14e>
+
+00803114 <mmap_pgfault>:
+{
+  803114:	55                   	push   %ebp
+  803115:	89 e5                	mov    %esp,%ebp
+  803117:	53                   	push   %ebx
+  803118:	83 ec 10             	sub    $0x10,%esp
+  80311b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  80311e:	53                   	push   %ebx
+  80311f:	e8 8c fe ff ff       	call   802fb0 <mmap_fault>
+  803124:	83 c4 10             	add    $0x10,%esp
+  803127:	84 c0                	test   %al,%al
+  803129:	74 05                	je     803130 <mmap_pgfault+0x1c>
+}
+  80312b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80312e:	c9                   	leave
+  80312f:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  803130:	83 ec 08             	sub    $0x8,%esp
+  803133:	ff 73 04             	push   0x4(%ebx)
+  803136:	ff 73 28             	push   0x28(%ebx)
+  803139:	ff 33                	push   (%ebx)
+  80313b:	68 dc 40 80 00       	push   $0x8040dc
+  803140:	6a 20                	push   $0x20
+  803142:	68 bc 40 80 00       	push   $0x8040bc
+  803147:	e8 f3 d0 ff ff       	call   80023f <_panic>
+
+0080314c <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  80314c:	55                   	push   %ebp
+  80314d:	89 e5                	mov    %esp,%ebp
+  80314f:	57                   	push   %edi
+  803150:	56                   	push   %esi
+  803151:	53                   	push   %ebx
+  803152:	83 ec 44             	sub    $0x44,%esp
+  803155:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803158:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80315b:	50                   	push   %eax
+  80315c:	ff 75 08             	push   0x8(%ebp)
+  80315f:	e8 30 e5 ff ff       	call   801694 <fd_lookup>
+  803164:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803167:	83 c4 10             	add    $0x10,%esp
+  80316a:	85 c0                	test   %eax,%eax
+  80316c:	0f 88 3e 01 00 00    	js     8032b0 <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  803172:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803176:	0f 88 d1 00 00 00    	js     80324d <mmap+0x101>
+  80317c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80317f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803184:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803187:	0f 85 c9 00 00 00    	jne    803256 <mmap+0x10a>
+  80318d:	85 db                	test   %ebx,%ebx
+  80318f:	0f 84 ca 00 00 00    	je     80325f <mmap+0x113>
+  803195:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  803199:	0f 87 c0 00 00 00    	ja     80325f <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  80319f:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  8031a5:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8031ab:	89 d9                	mov    %ebx,%ecx
+  8031ad:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  8031b0:	bb 4c 67 80 00       	mov    $0x80674c,%ebx
+  8031b5:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  8031ba:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  8031bf:	eb 53                	jmp    803214 <mmap+0xc8>
+  8031c1:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  8031c6:	eb 4c                	jmp    803214 <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  8031c8:	83 c0 01             	add    $0x1,%eax
+  8031cb:	83 f8 10             	cmp    $0x10,%eax
+  8031ce:	0f 84 e7 00 00 00    	je     8032bb <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  8031d4:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  8031d7:	8b 14 b5 60 67 80 00 	mov    0x806760(,%esi,4),%edx
+  8031de:	85 d2                	test   %edx,%edx
+  8031e0:	74 e6                	je     8031c8 <mmap+0x7c>
+  8031e2:	89 d1                	mov    %edx,%ecx
+  8031e4:	03 0c b5 64 67 80 00 	add    0x806764(,%esi,4),%ecx
+  8031eb:	39 cf                	cmp    %ecx,%edi
+  8031ed:	73 d9                	jae    8031c8 <mmap+0x7c>
+  8031ef:	39 da                	cmp    %ebx,%edx
+  8031f1:	73 d5                	jae    8031c8 <mmap+0x7c>
+  8031f3:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8031f6:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  8031f9:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  8031fc:	83 c2 01             	add    $0x1,%edx
+  8031ff:	83 c3 14             	add    $0x14,%ebx
+  803202:	83 fa 10             	cmp    $0x10,%edx
+  803205:	74 2b                	je     803232 <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  803207:	85 d2                	test   %edx,%edx
+  803209:	78 b6                	js     8031c1 <mmap+0x75>
+  80320b:	8b 3b                	mov    (%ebx),%edi
+  80320d:	85 ff                	test   %edi,%edi
+  80320f:	74 eb                	je     8031fc <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803211:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  803214:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  803219:	29 f8                	sub    %edi,%eax
+  80321b:	39 c8                	cmp    %ecx,%eax
+  80321d:	72 dd                	jb     8031fc <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  80321f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  803222:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  803225:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  803228:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80322b:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  80322e:	89 f3                	mov    %esi,%ebx
+  803230:	eb a2                	jmp    8031d4 <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  803232:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803239:	eb 75                	jmp    8032b0 <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  80323b:	83 ec 0c             	sub    $0xc,%esp
+  80323e:	68 14 31 80 00       	push   $0x803114
+  803243:	e8 f7 03 00 00       	call   80363f <set_pgfault_handler>
+  803248:	83 c4 10             	add    $0x10,%esp
+  80324b:	eb 24                	jmp    803271 <mmap+0x125>
+    return -E_INVAL;
+  80324d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803254:	eb 5a                	jmp    8032b0 <mmap+0x164>
+  803256:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80325d:	eb 51                	jmp    8032b0 <mmap+0x164>
+  80325f:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803266:	eb 48                	jmp    8032b0 <mmap+0x164>
+  if (_pgfault_handler == 0)
+  803268:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80326f:	74 ca                	je     80323b <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  803271:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803278:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80327b:	c1 e2 02             	shl    $0x2,%edx
+  80327e:	89 ba 60 67 80 00    	mov    %edi,0x806760(%edx)
+  mmaps[j].mm_len = len;
+  803284:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  803287:	89 b2 64 67 80 00    	mov    %esi,0x806764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  80328d:	8b 75 08             	mov    0x8(%ebp),%esi
+  803290:	89 b2 68 67 80 00    	mov    %esi,0x806768(%edx)
+  mmaps[j].mm_offset = offset;
+  803296:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803299:	89 b2 6c 67 80 00    	mov    %esi,0x80676c(%edx)
+  mmaps[j].mm_perm = perm;
+  80329f:	01 d8                	add    %ebx,%eax
+  8032a1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8032a4:	89 1c 85 70 67 80 00 	mov    %ebx,0x806770(,%eax,4)
+  *addr = (void *) va;
+  8032ab:	8b 45 18             	mov    0x18(%ebp),%eax
+  8032ae:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  8032b0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8032b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032b6:	5b                   	pop    %ebx
+  8032b7:	5e                   	pop    %esi
+  8032b8:	5f                   	pop    %edi
+  8032b9:	5d                   	pop    %ebp
+  8032ba:	c3                   	ret
+  if (i == NMMAP)
+  8032bb:	b8 60 67 80 00       	mov    $0x806760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  8032c0:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8032c3:	83 c0 14             	add    $0x14,%eax
+  8032c6:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  8032ca:	74 9c                	je     803268 <mmap+0x11c>
+  8032cc:	83 c3 01             	add    $0x1,%ebx
+  8032cf:	83 fb 10             	cmp    $0x10,%ebx
+  8032d2:	75 ef                	jne    8032c3 <mmap+0x177>
+    return -E_NO_MEM;
+  8032d4:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  8032db:	eb d3                	jmp    8032b0 <mmap+0x164>
+
+008032dd <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  8032dd:	55                   	push   %ebp
+  8032de:	89 e5                	mov    %esp,%ebp
+  8032e0:	57                   	push   %edi
+  8032e1:	56                   	push   %esi
+  8032e2:	53                   	push   %ebx
+  8032e3:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8032e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ec:	e8 c6 fb ff ff       	call   802eb7 <mmap_find>
+  8032f1:	85 c0                	test   %eax,%eax
+  8032f3:	0f 84 58 01 00 00    	je     803451 <msync+0x174>
+  8032f9:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  8032fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  803300:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  803304:	74 0a                	je     803310 <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  803306:	89 d8                	mov    %ebx,%eax
+  803308:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80330b:	5b                   	pop    %ebx
+  80330c:	5e                   	pop    %esi
+  80330d:	5f                   	pop    %edi
+  80330e:	5d                   	pop    %ebp
+  80330f:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  803310:	83 ec 08             	sub    $0x8,%esp
+  803313:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803316:	50                   	push   %eax
+  803317:	ff 77 08             	push   0x8(%edi)
+  80331a:	e8 75 e3 ff ff       	call   801694 <fd_lookup>
+  80331f:	89 c3                	mov    %eax,%ebx
+  803321:	83 c4 10             	add    $0x10,%esp
+  803324:	85 c0                	test   %eax,%eax
+  803326:	78 de                	js     803306 <msync+0x29>
+  803328:	83 ec 08             	sub    $0x8,%esp
+  80332b:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  803331:	50                   	push   %eax
+  803332:	ff 77 08             	push   0x8(%edi)
+  803335:	e8 fd e7 ff ff       	call   801b37 <fstat>
+  80333a:	89 c3                	mov    %eax,%ebx
+  80333c:	83 c4 10             	add    $0x10,%esp
+  80333f:	85 c0                	test   %eax,%eax
+  803341:	78 c3                	js     803306 <msync+0x29>
+  saved = fd->fd_offset;
+  803343:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803346:	8b 40 04             	mov    0x4(%eax),%eax
+  803349:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  80334f:	8b 37                	mov    (%edi),%esi
+  803351:	eb 29                	jmp    80337c <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  803353:	83 ec 0c             	sub    $0xc,%esp
+  803356:	6a 07                	push   $0x7
+  803358:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  80335e:	50                   	push   %eax
+  80335f:	6a 00                	push   $0x0
+  803361:	50                   	push   %eax
+  803362:	6a 00                	push   $0x0
+  803364:	e8 11 da ff ff       	call   800d7a <sys_page_map>
+  803369:	89 c3                	mov    %eax,%ebx
+  80336b:	83 c4 20             	add    $0x20,%esp
+  80336e:	85 c0                	test   %eax,%eax
+  803370:	0f 88 c0 00 00 00    	js     803436 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803376:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80337c:	8b 07                	mov    (%edi),%eax
+  80337e:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  803384:	03 47 04             	add    0x4(%edi),%eax
+  803387:	39 c6                	cmp    %eax,%esi
+  803389:	0f 83 a7 00 00 00    	jae    803436 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  80338f:	89 f0                	mov    %esi,%eax
+  803391:	e8 63 fb ff ff       	call   802ef9 <va_mapped>
+  803396:	84 c0                	test   %al,%al
+  803398:	74 dc                	je     803376 <msync+0x99>
+  80339a:	89 f0                	mov    %esi,%eax
+  80339c:	c1 e8 0c             	shr    $0xc,%eax
+  80339f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033a6:	a8 40                	test   $0x40,%al
+  8033a8:	74 cc                	je     803376 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  8033aa:	8b 47 0c             	mov    0xc(%edi),%eax
+  8033ad:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  8033b3:	29 c8                	sub    %ecx,%eax
+  8033b5:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  8033b7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8033ba:	39 c2                	cmp    %eax,%edx
+  8033bc:	7e 78                	jle    803436 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  8033be:	29 c2                	sub    %eax,%edx
+  8033c0:	89 d1                	mov    %edx,%ecx
+  8033c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033c7:	39 d1                	cmp    %edx,%ecx
+  8033c9:	0f 4e d1             	cmovle %ecx,%edx
+  8033cc:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  8033d2:	83 ec 08             	sub    $0x8,%esp
+  8033d5:	50                   	push   %eax
+  8033d6:	ff 77 08             	push   0x8(%edi)
+  8033d9:	e8 b1 e6 ff ff       	call   801a8f <seek>
+  8033de:	89 c3                	mov    %eax,%ebx
+  8033e0:	83 c4 10             	add    $0x10,%esp
+  8033e3:	85 c0                	test   %eax,%eax
+  8033e5:	78 4f                	js     803436 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  8033e7:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  8033ed:	83 ec 04             	sub    $0x4,%esp
+  8033f0:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  8033f6:	56                   	push   %esi
+  8033f7:	ff 77 08             	push   0x8(%edi)
+  8033fa:	e8 0e e6 ff ff       	call   801a0d <write>
+  8033ff:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803401:	83 c4 10             	add    $0x10,%esp
+  803404:	85 c0                	test   %eax,%eax
+  803406:	78 2e                	js     803436 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  803408:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  80340e:	39 c2                	cmp    %eax,%edx
+  803410:	0f 8e 3d ff ff ff    	jle    803353 <msync+0x76>
+  803416:	89 d0                	mov    %edx,%eax
+  803418:	29 d8                	sub    %ebx,%eax
+  80341a:	01 f3                	add    %esi,%ebx
+  80341c:	83 ec 04             	sub    $0x4,%esp
+  80341f:	50                   	push   %eax
+  803420:	53                   	push   %ebx
+  803421:	ff 77 08             	push   0x8(%edi)
+  803424:	e8 e4 e5 ff ff       	call   801a0d <write>
+  803429:	89 c3                	mov    %eax,%ebx
+  80342b:	83 c4 10             	add    $0x10,%esp
+  80342e:	85 c0                	test   %eax,%eax
+  803430:	0f 89 1d ff ff ff    	jns    803353 <msync+0x76>
+  fd->fd_offset = saved;
+  803436:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803439:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  80343f:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  803442:	85 db                	test   %ebx,%ebx
+  803444:	b8 00 00 00 00       	mov    $0x0,%eax
+  803449:	0f 4f d8             	cmovg  %eax,%ebx
+  80344c:	e9 b5 fe ff ff       	jmp    803306 <msync+0x29>
+    return -E_INVAL;
+  803451:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  803456:	e9 ab fe ff ff       	jmp    803306 <msync+0x29>
+
+0080345b <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  80345b:	55                   	push   %ebp
+  80345c:	89 e5                	mov    %esp,%ebp
+  80345e:	56                   	push   %esi
+  80345f:	53                   	push   %ebx
+  803460:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803463:	89 d8                	mov    %ebx,%eax
+  803465:	e8 4d fa ff ff       	call   802eb7 <mmap_find>
+  80346a:	85 c0                	test   %eax,%eax
+  80346c:	74 56                	je     8034c4 <munmap+0x69>
+  80346e:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  803470:	83 ec 0c             	sub    $0xc,%esp
+  803473:	53                   	push   %ebx
+  803474:	e8 64 fe ff ff       	call   8032dd <msync>
+  803479:	83 c4 10             	add    $0x10,%esp
+  80347c:	85 c0                	test   %eax,%eax
+  80347e:	78 3d                	js     8034bd <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  803480:	8b 1e                	mov    (%esi),%ebx
+  803482:	eb 06                	jmp    80348a <munmap+0x2f>
+  803484:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80348a:	8b 46 04             	mov    0x4(%esi),%eax
+  80348d:	03 06                	add    (%esi),%eax
+  80348f:	39 c3                	cmp    %eax,%ebx
+  803491:	73 1f                	jae    8034b2 <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  803493:	89 d8                	mov    %ebx,%eax
+  803495:	e8 5f fa ff ff       	call   802ef9 <va_mapped>
+  80349a:	84 c0                	test   %al,%al
+  80349c:	74 e6                	je     803484 <munmap+0x29>
+  80349e:	83 ec 08             	sub    $0x8,%esp
+  8034a1:	53                   	push   %ebx
+  8034a2:	6a 00                	push   $0x0
+  8034a4:	e8 13 d9 ff ff       	call   800dbc <sys_page_unmap>
+  8034a9:	83 c4 10             	add    $0x10,%esp
+  8034ac:	85 c0                	test   %eax,%eax
+  8034ae:	79 d4                	jns    803484 <munmap+0x29>
+  8034b0:	eb 0b                	jmp    8034bd <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  8034b2:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  8034b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034c0:	5b                   	pop    %ebx
+  8034c1:	5e                   	pop    %esi
+  8034c2:	5d                   	pop    %ebp
+  8034c3:	c3                   	ret
+    return -E_INVAL;
+  8034c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034c9:	eb f2                	jmp    8034bd <munmap+0x62>
+
+008034cb <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  8034cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d0:	c3                   	ret
+
+008034d1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8034d1:	55                   	push   %ebp
+  8034d2:	89 e5                	mov    %esp,%ebp
+  8034d4:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  8034d7:	68 03 41 80 00       	push   $0x804103
+  8034dc:	ff 75 0c             	push   0xc(%ebp)
+  8034df:	e8 24 d4 ff ff       	call   800908 <strcpy>
+  return 0;
+}
+  8034e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e9:	c9                   	leave
+  8034ea:	c3                   	ret
+
+008034eb <devcons_write>:
+{
+  8034eb:	55                   	push   %ebp
+  8034ec:	89 e5                	mov    %esp,%ebp
+  8034ee:	57                   	push   %edi
+  8034ef:	56                   	push   %esi
+  8034f0:	53                   	push   %ebx
+  8034f1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8034f7:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8034fc:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  803502:	eb 2e                	jmp    803532 <devcons_write+0x47>
+    m = n - tot;
+  803504:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803507:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  803509:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80350e:	39 c3                	cmp    %eax,%ebx
+  803510:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  803513:	83 ec 04             	sub    $0x4,%esp
+  803516:	53                   	push   %ebx
+  803517:	89 f0                	mov    %esi,%eax
+  803519:	03 45 0c             	add    0xc(%ebp),%eax
+  80351c:	50                   	push   %eax
+  80351d:	57                   	push   %edi
+  80351e:	e8 6b d5 ff ff       	call   800a8e <memmove>
+    sys_cputs(buf, m);
+  803523:	83 c4 08             	add    $0x8,%esp
+  803526:	53                   	push   %ebx
+  803527:	57                   	push   %edi
+  803528:	e8 0b d7 ff ff       	call   800c38 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  80352d:	01 de                	add    %ebx,%esi
+  80352f:	83 c4 10             	add    $0x10,%esp
+  803532:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803535:	72 cd                	jb     803504 <devcons_write+0x19>
+}
+  803537:	89 f0                	mov    %esi,%eax
+  803539:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80353c:	5b                   	pop    %ebx
+  80353d:	5e                   	pop    %esi
+  80353e:	5f                   	pop    %edi
+  80353f:	5d                   	pop    %ebp
+  803540:	c3                   	ret
+
+00803541 <devcons_read>:
+{
+  803541:	55                   	push   %ebp
+  803542:	89 e5                	mov    %esp,%ebp
+  803544:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  803547:	b8 00 00 00 00       	mov    $0x0,%eax
+  80354c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803550:	75 07                	jne    803559 <devcons_read+0x18>
+  803552:	eb 1f                	jmp    803573 <devcons_read+0x32>
+    sys_yield();
+  803554:	e8 7c d7 ff ff       	call   800cd5 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  803559:	e8 f8 d6 ff ff       	call   800c56 <sys_cgetc>
+  80355e:	85 c0                	test   %eax,%eax
+  803560:	74 f2                	je     803554 <devcons_read+0x13>
+  if (c < 0)
+  803562:	78 0f                	js     803573 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  803564:	83 f8 04             	cmp    $0x4,%eax
+  803567:	74 0c                	je     803575 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803569:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80356c:	88 02                	mov    %al,(%edx)
+  return 1;
+  80356e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803573:	c9                   	leave
+  803574:	c3                   	ret
+    return 0;
+  803575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80357a:	eb f7                	jmp    803573 <devcons_read+0x32>
+
+0080357c <cputchar>:
+{
+  80357c:	55                   	push   %ebp
+  80357d:	89 e5                	mov    %esp,%ebp
+  80357f:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  803582:	8b 45 08             	mov    0x8(%ebp),%eax
+  803585:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803588:	6a 01                	push   $0x1
+  80358a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80358d:	50                   	push   %eax
+  80358e:	e8 a5 d6 ff ff       	call   800c38 <sys_cputs>
+}
+  803593:	83 c4 10             	add    $0x10,%esp
+  803596:	c9                   	leave
+  803597:	c3                   	ret
+
+00803598 <getchar>:
+{
+  803598:	55                   	push   %ebp
+  803599:	89 e5                	mov    %esp,%ebp
+  80359b:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  80359e:	6a 01                	push   $0x1
+  8035a0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035a3:	50                   	push   %eax
+  8035a4:	6a 00                	push   $0x0
+  8035a6:	e8 94 e3 ff ff       	call   80193f <read>
+  if (r < 0)
+  8035ab:	83 c4 10             	add    $0x10,%esp
+  8035ae:	85 c0                	test   %eax,%eax
+  8035b0:	78 06                	js     8035b8 <getchar+0x20>
+  if (r < 1)
+  8035b2:	74 06                	je     8035ba <getchar+0x22>
+  return c;
+  8035b4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8035b8:	c9                   	leave
+  8035b9:	c3                   	ret
+    return -E_EOF;
+  8035ba:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8035bf:	eb f7                	jmp    8035b8 <getchar+0x20>
+
+008035c1 <iscons>:
+{
+  8035c1:	55                   	push   %ebp
+  8035c2:	89 e5                	mov    %esp,%ebp
+  8035c4:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8035c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035ca:	50                   	push   %eax
+  8035cb:	ff 75 08             	push   0x8(%ebp)
+  8035ce:	e8 c1 e0 ff ff       	call   801694 <fd_lookup>
+  8035d3:	83 c4 10             	add    $0x10,%esp
+  8035d6:	85 c0                	test   %eax,%eax
+  8035d8:	78 11                	js     8035eb <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  8035da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035dd:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  8035e3:	39 10                	cmp    %edx,(%eax)
+  8035e5:	0f 94 c0             	sete   %al
+  8035e8:	0f b6 c0             	movzbl %al,%eax
+}
+  8035eb:	c9                   	leave
+  8035ec:	c3                   	ret
+
+008035ed <opencons>:
+{
+  8035ed:	55                   	push   %ebp
+  8035ee:	89 e5                	mov    %esp,%ebp
+  8035f0:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  8035f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035f6:	50                   	push   %eax
+  8035f7:	e8 42 e0 ff ff       	call   80163e <fd_alloc>
+  8035fc:	83 c4 10             	add    $0x10,%esp
+  8035ff:	85 c0                	test   %eax,%eax
+  803601:	78 3a                	js     80363d <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803603:	83 ec 04             	sub    $0x4,%esp
+  803606:	68 07 04 00 00       	push   $0x407
+  80360b:	ff 75 f4             	push   -0xc(%ebp)
+  80360e:	6a 00                	push   $0x0
+  803610:	e8 22 d7 ff ff       	call   800d37 <sys_page_alloc>
+  803615:	83 c4 10             	add    $0x10,%esp
+  803618:	85 c0                	test   %eax,%eax
+  80361a:	78 21                	js     80363d <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  80361c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80361f:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  803625:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  803627:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80362a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  803631:	83 ec 0c             	sub    $0xc,%esp
+  803634:	50                   	push   %eax
+  803635:	e8 e0 df ff ff       	call   80161a <fd2num>
+  80363a:	83 c4 10             	add    $0x10,%esp
+}
+  80363d:	c9                   	leave
+  80363e:	c3                   	ret
+
+0080363f <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80363f:	55                   	push   %ebp
+  803640:	89 e5                	mov    %esp,%ebp
+  803642:	53                   	push   %ebx
+  803643:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  803646:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80364d:	74 0d                	je     80365c <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  80364f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803652:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803657:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80365a:	c9                   	leave
+  80365b:	c3                   	ret
+    envid_t id = sys_getenvid();
+  80365c:	e8 55 d6 ff ff       	call   800cb6 <sys_getenvid>
+  803661:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  803663:	83 ec 04             	sub    $0x4,%esp
+  803666:	6a 07                	push   $0x7
+  803668:	68 00 f0 bf ee       	push   $0xeebff000
+  80366d:	50                   	push   %eax
+  80366e:	e8 c4 d6 ff ff       	call   800d37 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  803673:	83 c4 08             	add    $0x8,%esp
+  803676:	68 86 36 80 00       	push   $0x803686
+  80367b:	53                   	push   %ebx
+  80367c:	e8 2b d9 ff ff       	call   800fac <sys_env_set_pgfault_upcall>
+  803681:	83 c4 10             	add    $0x10,%esp
+  803684:	eb c9                	jmp    80364f <set_pgfault_handler+0x10>
+
+00803686 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803686:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803687:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  80368c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80368e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  803691:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  803695:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  803698:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  80369c:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  8036a0:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  8036a2:	83 c4 08             	add    $0x8,%esp
+  popal
+  8036a5:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  8036a6:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  8036a9:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  8036aa:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  8036ab:	c3                   	ret
+
+008036ac <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  8036ac:	55                   	push   %ebp
+  8036ad:	89 e5                	mov    %esp,%ebp
+  8036af:	57                   	push   %edi
+  8036b0:	56                   	push   %esi
+  8036b1:	53                   	push   %ebx
+  8036b2:	83 ec 14             	sub    $0x14,%esp
+  8036b5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8036b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8036be:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  8036c1:	85 c0                	test   %eax,%eax
+  8036c3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8036c8:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  8036cb:	ff 33                	push   (%ebx)
+  8036cd:	50                   	push   %eax
+  8036ce:	e8 3c d9 ff ff       	call   80100f <sys_ipc_recv>
+  8036d3:	83 c4 10             	add    $0x10,%esp
+  8036d6:	85 c0                	test   %eax,%eax
+  8036d8:	78 39                	js     803713 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8036da:	85 ff                	test   %edi,%edi
+  8036dc:	74 0a                	je     8036e8 <ipc_recv_pages+0x3c>
+  8036de:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8036e3:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8036e6:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8036e8:	85 f6                	test   %esi,%esi
+  8036ea:	74 0d                	je     8036f9 <ipc_recv_pages+0x4d>
+  8036ec:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8036f1:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8036f7:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  8036f9:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8036fe:	8b 40 74             	mov    0x74(%eax),%eax
+  803701:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  803703:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  803708:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  80370b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80370e:	5b                   	pop    %ebx
+  80370f:	5e                   	pop    %esi
+  803710:	5f                   	pop    %edi
+  803711:	5d                   	pop    %ebp
+  803712:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  803713:	85 ff                	test   %edi,%edi
+  803715:	74 06                	je     80371d <ipc_recv_pages+0x71>
+  803717:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  80371d:	85 f6                	test   %esi,%esi
+  80371f:	74 06                	je     803727 <ipc_recv_pages+0x7b>
+  803721:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  803727:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  80372d:	eb dc                	jmp    80370b <ipc_recv_pages+0x5f>
+
+0080372f <ipc_recv>:
+{
+  80372f:	55                   	push   %ebp
+  803730:	89 e5                	mov    %esp,%ebp
+  803732:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  803735:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  80373c:	ff 75 10             	push   0x10(%ebp)
+  80373f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803742:	50                   	push   %eax
+  803743:	ff 75 0c             	push   0xc(%ebp)
+  803746:	ff 75 08             	push   0x8(%ebp)
+  803749:	e8 5e ff ff ff       	call   8036ac <ipc_recv_pages>
+}
+  80374e:	c9                   	leave
+  80374f:	c3                   	ret
+
+00803750 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  803750:	55                   	push   %ebp
+  803751:	89 e5                	mov    %esp,%ebp
+  803753:	57                   	push   %edi
+  803754:	56                   	push   %esi
+  803755:	53                   	push   %ebx
+  803756:	83 ec 0c             	sub    $0xc,%esp
+  803759:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80375c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80375f:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  803762:	89 c3                	mov    %eax,%ebx
+  803764:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80376a:	85 c0                	test   %eax,%eax
+  80376c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803771:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  803774:	83 ec 0c             	sub    $0xc,%esp
+  803777:	ff 75 14             	push   0x14(%ebp)
+  80377a:	ff 75 18             	push   0x18(%ebp)
+  80377d:	53                   	push   %ebx
+  80377e:	56                   	push   %esi
+  80377f:	57                   	push   %edi
+  803780:	e8 69 d8 ff ff       	call   800fee <sys_ipc_try_send>
+  803785:	83 c4 20             	add    $0x20,%esp
+  803788:	85 c0                	test   %eax,%eax
+  80378a:	79 1e                	jns    8037aa <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  80378c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80378f:	75 07                	jne    803798 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  803791:	e8 3f d5 ff ff       	call   800cd5 <sys_yield>
+  803796:	eb dc                	jmp    803774 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  803798:	50                   	push   %eax
+  803799:	68 0f 41 80 00       	push   $0x80410f
+  80379e:	6a 5c                	push   $0x5c
+  8037a0:	68 1c 41 80 00       	push   $0x80411c
+  8037a5:	e8 95 ca ff ff       	call   80023f <_panic>
+  }
+}
+  8037aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037ad:	5b                   	pop    %ebx
+  8037ae:	5e                   	pop    %esi
+  8037af:	5f                   	pop    %edi
+  8037b0:	5d                   	pop    %ebp
+  8037b1:	c3                   	ret
+
+008037b2 <ipc_send>:
+{
+  8037b2:	55                   	push   %ebp
+  8037b3:	89 e5                	mov    %esp,%ebp
+  8037b5:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  8037b8:	ff 75 14             	push   0x14(%ebp)
+  8037bb:	6a 01                	push   $0x1
+  8037bd:	ff 75 10             	push   0x10(%ebp)
+  8037c0:	ff 75 0c             	push   0xc(%ebp)
+  8037c3:	ff 75 08             	push   0x8(%ebp)
+  8037c6:	e8 85 ff ff ff       	call   803750 <ipc_send_pages>
+}
+  8037cb:	83 c4 20             	add    $0x20,%esp
+  8037ce:	c9                   	leave
+  8037cf:	c3                   	ret
+
+008037d0 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8037d0:	55                   	push   %ebp
+  8037d1:	89 e5                	mov    %esp,%ebp
+  8037d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  8037d6:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8037db:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8037de:	c1 e0 04             	shl    $0x4,%eax
+  8037e1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037e6:	8b 40 50             	mov    0x50(%eax),%eax
+  8037e9:	39 c8                	cmp    %ecx,%eax
+  8037eb:	74 12                	je     8037ff <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8037ed:	83 c2 01             	add    $0x1,%edx
+  8037f0:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8037f6:	75 e3                	jne    8037db <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8037f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037fd:	eb 0e                	jmp    80380d <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8037ff:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803802:	c1 e0 04             	shl    $0x4,%eax
+  803805:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80380a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80380d:	5d                   	pop    %ebp
+  80380e:	c3                   	ret
+
+0080380f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80380f:	55                   	push   %ebp
+  803810:	89 e5                	mov    %esp,%ebp
+  803812:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803815:	89 c2                	mov    %eax,%edx
+  803817:	c1 ea 16             	shr    $0x16,%edx
+  80381a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803821:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803826:	f6 c1 01             	test   $0x1,%cl
+  803829:	74 1c                	je     803847 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  80382b:	c1 e8 0c             	shr    $0xc,%eax
+  80382e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  803835:	a8 01                	test   $0x1,%al
+  803837:	74 0e                	je     803847 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  803839:	c1 e8 0c             	shr    $0xc,%eax
+  80383c:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803843:	ef 
+  803844:	0f b7 d2             	movzwl %dx,%edx
+}
+  803847:	89 d0                	mov    %edx,%eax
+  803849:	5d                   	pop    %ebp
+  80384a:	c3                   	ret
+
+0080384b <udivmod>:
+  80384b:	55                   	push   %ebp
+  80384c:	57                   	push   %edi
+  80384d:	56                   	push   %esi
+  80384e:	53                   	push   %ebx
+  80384f:	83 ec 14             	sub    $0x14,%esp
+  803852:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803856:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  80385a:	89 fb                	mov    %edi,%ebx
+  80385c:	09 f3                	or     %esi,%ebx
+  80385e:	0f 84 88 00 00 00    	je     8038ec <udivmod+0xa1>
+  803864:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803869:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803870:	00 
+  803871:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803878:	00 
+  803879:	89 cd                	mov    %ecx,%ebp
+  80387b:	89 34 24             	mov    %esi,(%esp)
+  80387e:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803882:	eb 08                	jmp    80388c <udivmod+0x41>
+  803884:	83 ed 01             	sub    $0x1,%ebp
+  803887:	83 fd ff             	cmp    $0xffffffff,%ebp
+  80388a:	74 6c                	je     8038f8 <udivmod+0xad>
+  80388c:	89 c3                	mov    %eax,%ebx
+  80388e:	89 d6                	mov    %edx,%esi
+  803890:	89 e9                	mov    %ebp,%ecx
+  803892:	0f ad f3             	shrd   %cl,%esi,%ebx
+  803895:	d3 ee                	shr    %cl,%esi
+  803897:	f6 c1 20             	test   $0x20,%cl
+  80389a:	74 04                	je     8038a0 <udivmod+0x55>
+  80389c:	89 f3                	mov    %esi,%ebx
+  80389e:	31 f6                	xor    %esi,%esi
+  8038a0:	8b 3c 24             	mov    (%esp),%edi
+  8038a3:	39 fb                	cmp    %edi,%ebx
+  8038a5:	89 f7                	mov    %esi,%edi
+  8038a7:	8b 1c 24             	mov    (%esp),%ebx
+  8038aa:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8038ae:	19 f7                	sbb    %esi,%edi
+  8038b0:	72 d2                	jb     803884 <udivmod+0x39>
+  8038b2:	89 f7                	mov    %esi,%edi
+  8038b4:	89 de                	mov    %ebx,%esi
+  8038b6:	89 e9                	mov    %ebp,%ecx
+  8038b8:	0f a5 f7             	shld   %cl,%esi,%edi
+  8038bb:	d3 e6                	shl    %cl,%esi
+  8038bd:	f6 c1 20             	test   $0x20,%cl
+  8038c0:	74 04                	je     8038c6 <udivmod+0x7b>
+  8038c2:	89 f7                	mov    %esi,%edi
+  8038c4:	31 f6                	xor    %esi,%esi
+  8038c6:	29 f0                	sub    %esi,%eax
+  8038c8:	19 fa                	sbb    %edi,%edx
+  8038ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8038cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038d4:	0f a5 f7             	shld   %cl,%esi,%edi
+  8038d7:	d3 e6                	shl    %cl,%esi
+  8038d9:	f6 c1 20             	test   $0x20,%cl
+  8038dc:	74 04                	je     8038e2 <udivmod+0x97>
+  8038de:	89 f7                	mov    %esi,%edi
+  8038e0:	31 f6                	xor    %esi,%esi
+  8038e2:	09 74 24 08          	or     %esi,0x8(%esp)
+  8038e6:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8038ea:	eb 98                	jmp    803884 <udivmod+0x39>
+  8038ec:	89 f0                	mov    %esi,%eax
+  8038ee:	89 fa                	mov    %edi,%edx
+  8038f0:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8038f4:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8038f8:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8038fc:	89 01                	mov    %eax,(%ecx)
+  8038fe:	89 51 04             	mov    %edx,0x4(%ecx)
+  803901:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803905:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803909:	83 c4 14             	add    $0x14,%esp
+  80390c:	5b                   	pop    %ebx
+  80390d:	5e                   	pop    %esi
+  80390e:	5f                   	pop    %edi
+  80390f:	5d                   	pop    %ebp
+  803910:	c3                   	ret
+
+00803911 <__udivdi3>:
+  803911:	83 ec 18             	sub    $0x18,%esp
+  803914:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803918:	50                   	push   %eax
+  803919:	ff 74 24 2c          	push   0x2c(%esp)
+  80391d:	ff 74 24 2c          	push   0x2c(%esp)
+  803921:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803925:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803929:	e8 1d ff ff ff       	call   80384b <udivmod>
+  80392e:	83 c4 24             	add    $0x24,%esp
+  803931:	c3                   	ret
+
+00803932 <__umoddi3>:
+  803932:	83 ec 18             	sub    $0x18,%esp
+  803935:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803939:	50                   	push   %eax
+  80393a:	ff 74 24 2c          	push   0x2c(%esp)
+  80393e:	ff 74 24 2c          	push   0x2c(%esp)
+  803942:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803946:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80394a:	e8 fc fe ff ff       	call   80384b <udivmod>
+  80394f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803953:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803957:	83 c4 24             	add    $0x24,%esp
+  80395a:	c3                   	ret
+
+0080395b <__divdi3>:
+  80395b:	56                   	push   %esi
+  80395c:	53                   	push   %ebx
+  80395d:	83 ec 14             	sub    $0x14,%esp
+  803960:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803964:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803968:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80396c:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803970:	85 d2                	test   %edx,%edx
+  803972:	78 18                	js     80398c <__divdi3+0x31>
+  803974:	85 db                	test   %ebx,%ebx
+  803976:	78 3e                	js     8039b6 <__divdi3+0x5b>
+  803978:	83 ec 04             	sub    $0x4,%esp
+  80397b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80397f:	56                   	push   %esi
+  803980:	53                   	push   %ebx
+  803981:	51                   	push   %ecx
+  803982:	e8 c4 fe ff ff       	call   80384b <udivmod>
+  803987:	83 c4 10             	add    $0x10,%esp
+  80398a:	eb 24                	jmp    8039b0 <__divdi3+0x55>
+  80398c:	f7 d8                	neg    %eax
+  80398e:	83 d2 00             	adc    $0x0,%edx
+  803991:	f7 da                	neg    %edx
+  803993:	85 db                	test   %ebx,%ebx
+  803995:	78 3a                	js     8039d1 <__divdi3+0x76>
+  803997:	83 ec 04             	sub    $0x4,%esp
+  80399a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80399e:	56                   	push   %esi
+  80399f:	53                   	push   %ebx
+  8039a0:	51                   	push   %ecx
+  8039a1:	e8 a5 fe ff ff       	call   80384b <udivmod>
+  8039a6:	83 c4 10             	add    $0x10,%esp
+  8039a9:	f7 d8                	neg    %eax
+  8039ab:	83 d2 00             	adc    $0x0,%edx
+  8039ae:	f7 da                	neg    %edx
+  8039b0:	83 c4 14             	add    $0x14,%esp
+  8039b3:	5b                   	pop    %ebx
+  8039b4:	5e                   	pop    %esi
+  8039b5:	c3                   	ret
+  8039b6:	83 ec 04             	sub    $0x4,%esp
+  8039b9:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8039bd:	56                   	push   %esi
+  8039be:	f7 d9                	neg    %ecx
+  8039c0:	83 d3 00             	adc    $0x0,%ebx
+  8039c3:	f7 db                	neg    %ebx
+  8039c5:	53                   	push   %ebx
+  8039c6:	51                   	push   %ecx
+  8039c7:	e8 7f fe ff ff       	call   80384b <udivmod>
+  8039cc:	83 c4 10             	add    $0x10,%esp
+  8039cf:	eb d8                	jmp    8039a9 <__divdi3+0x4e>
+  8039d1:	83 ec 04             	sub    $0x4,%esp
+  8039d4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8039d8:	56                   	push   %esi
+  8039d9:	f7 d9                	neg    %ecx
+  8039db:	83 d3 00             	adc    $0x0,%ebx
+  8039de:	f7 db                	neg    %ebx
+  8039e0:	53                   	push   %ebx
+  8039e1:	51                   	push   %ecx
+  8039e2:	e8 64 fe ff ff       	call   80384b <udivmod>
+  8039e7:	83 c4 10             	add    $0x10,%esp
+  8039ea:	eb c4                	jmp    8039b0 <__divdi3+0x55>
+
+008039ec <__moddi3>:
+  8039ec:	55                   	push   %ebp
+  8039ed:	57                   	push   %edi
+  8039ee:	56                   	push   %esi
+  8039ef:	53                   	push   %ebx
+  8039f0:	83 ec 24             	sub    $0x24,%esp
+  8039f3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8039f7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8039fb:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8039ff:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803a03:	85 d2                	test   %edx,%edx
+  803a05:	78 3b                	js     803a42 <__moddi3+0x56>
+  803a07:	83 ec 04             	sub    $0x4,%esp
+  803a0a:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a0e:	56                   	push   %esi
+  803a0f:	89 ce                	mov    %ecx,%esi
+  803a11:	f7 de                	neg    %esi
+  803a13:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803a17:	89 de                	mov    %ebx,%esi
+  803a19:	83 d6 00             	adc    $0x0,%esi
+  803a1c:	f7 de                	neg    %esi
+  803a1e:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803a22:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803a26:	0f 48 f1             	cmovs  %ecx,%esi
+  803a29:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803a2e:	53                   	push   %ebx
+  803a2f:	56                   	push   %esi
+  803a30:	e8 16 fe ff ff       	call   80384b <udivmod>
+  803a35:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a39:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a3d:	83 c4 10             	add    $0x10,%esp
+  803a40:	eb 47                	jmp    803a89 <__moddi3+0x9d>
+  803a42:	f7 d8                	neg    %eax
+  803a44:	83 d2 00             	adc    $0x0,%edx
+  803a47:	f7 da                	neg    %edx
+  803a49:	83 ec 04             	sub    $0x4,%esp
+  803a4c:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a50:	56                   	push   %esi
+  803a51:	89 cf                	mov    %ecx,%edi
+  803a53:	f7 df                	neg    %edi
+  803a55:	89 de                	mov    %ebx,%esi
+  803a57:	83 d6 00             	adc    $0x0,%esi
+  803a5a:	f7 de                	neg    %esi
+  803a5c:	0f 49 cf             	cmovns %edi,%ecx
+  803a5f:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803a63:	0f 49 de             	cmovns %esi,%ebx
+  803a66:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803a6a:	ff 74 24 0c          	push   0xc(%esp)
+  803a6e:	ff 74 24 0c          	push   0xc(%esp)
+  803a72:	e8 d4 fd ff ff       	call   80384b <udivmod>
+  803a77:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a7b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a7f:	f7 d8                	neg    %eax
+  803a81:	83 d2 00             	adc    $0x0,%edx
+  803a84:	f7 da                	neg    %edx
+  803a86:	83 c4 10             	add    $0x10,%esp
+  803a89:	83 c4 24             	add    $0x24,%esp
+  803a8c:	5b                   	pop    %ebx
+  803a8d:	5e                   	pop    %esi
+  803a8e:	5f                   	pop    %edi
+  803a8f:	5d                   	pop    %ebp
+  803a90:	c3                   	ret
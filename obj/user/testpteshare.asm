@@ -0,0 +1,8568 @@
+
+obj/user/testpteshare.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 63 01 00 00       	call   800194 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <childofspawn>:
+  breakpoint();
+}
+
+void
+childofspawn(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  strcpy(VA, msg2);
+  800039:	ff 35 00 50 80 00    	push   0x805000
+  80003f:	68 00 00 00 a0       	push   $0xa0000000
+  800044:	e8 81 08 00 00       	call   8008ca <strcpy>
+  exit();
+  800049:	e8 99 01 00 00       	call   8001e7 <exit>
+}
+  80004e:	83 c4 10             	add    $0x10,%esp
+  800051:	c9                   	leave
+  800052:	c3                   	ret
+
+00800053 <umain>:
+{
+  800053:	55                   	push   %ebp
+  800054:	89 e5                	mov    %esp,%ebp
+  800056:	53                   	push   %ebx
+  800057:	83 ec 04             	sub    $0x4,%esp
+  if (argc != 0)
+  80005a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80005e:	0f 85 d0 00 00 00    	jne    800134 <umain+0xe1>
+  if ((r = sys_page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  800064:	83 ec 04             	sub    $0x4,%esp
+  800067:	68 07 04 00 00       	push   $0x407
+  80006c:	68 00 00 00 a0       	push   $0xa0000000
+  800071:	6a 00                	push   $0x0
+  800073:	e8 81 0c 00 00       	call   800cf9 <sys_page_alloc>
+  800078:	83 c4 10             	add    $0x10,%esp
+  80007b:	85 c0                	test   %eax,%eax
+  80007d:	0f 88 bb 00 00 00    	js     80013e <umain+0xeb>
+  if ((r = fork()) < 0)
+  800083:	e8 de 12 00 00       	call   801366 <fork>
+  800088:	89 c3                	mov    %eax,%ebx
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	0f 88 be 00 00 00    	js     800150 <umain+0xfd>
+  if (r == 0) {
+  800092:	0f 84 ca 00 00 00    	je     800162 <umain+0x10f>
+  wait(r);
+  800098:	83 ec 0c             	sub    $0xc,%esp
+  80009b:	53                   	push   %ebx
+  80009c:	e8 7f 35 00 00       	call   803620 <wait>
+  cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	ff 35 04 50 80 00    	push   0x805004
+  8000aa:	68 00 00 00 a0       	push   $0xa0000000
+  8000af:	e8 c7 08 00 00       	call   80097b <strcmp>
+  8000b4:	83 c4 08             	add    $0x8,%esp
+  8000b7:	85 c0                	test   %eax,%eax
+  8000b9:	b8 66 42 80 00       	mov    $0x804266,%eax
+  8000be:	ba 60 42 80 00       	mov    $0x804260,%edx
+  8000c3:	0f 44 c2             	cmove  %edx,%eax
+  8000c6:	50                   	push   %eax
+  8000c7:	68 93 42 80 00       	push   $0x804293
+  8000cc:	e8 0b 02 00 00       	call   8002dc <cprintf>
+  if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  8000d1:	6a 00                	push   $0x0
+  8000d3:	68 ae 42 80 00       	push   $0x8042ae
+  8000d8:	68 b3 42 80 00       	push   $0x8042b3
+  8000dd:	68 b2 42 80 00       	push   $0x8042b2
+  8000e2:	e8 38 2c 00 00       	call   802d1f <spawnl>
+  8000e7:	83 c4 20             	add    $0x20,%esp
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	0f 88 90 00 00 00    	js     800182 <umain+0x12f>
+  wait(r);
+  8000f2:	83 ec 0c             	sub    $0xc,%esp
+  8000f5:	50                   	push   %eax
+  8000f6:	e8 25 35 00 00       	call   803620 <wait>
+  cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  8000fb:	83 c4 08             	add    $0x8,%esp
+  8000fe:	ff 35 00 50 80 00    	push   0x805000
+  800104:	68 00 00 00 a0       	push   $0xa0000000
+  800109:	e8 6d 08 00 00       	call   80097b <strcmp>
+  80010e:	83 c4 08             	add    $0x8,%esp
+  800111:	85 c0                	test   %eax,%eax
+  800113:	b8 66 42 80 00       	mov    $0x804266,%eax
+  800118:	ba 60 42 80 00       	mov    $0x804260,%edx
+  80011d:	0f 44 c2             	cmove  %edx,%eax
+  800120:	50                   	push   %eax
+  800121:	68 ca 42 80 00       	push   $0x8042ca
+  800126:	e8 b1 01 00 00       	call   8002dc <cprintf>
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+  __asm __volatile("int3");
+  80012b:	cc                   	int3
+}
+  80012c:	83 c4 10             	add    $0x10,%esp
+  80012f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800132:	c9                   	leave
+  800133:	c3                   	ret
+    childofspawn();
+  800134:	e8 fa fe ff ff       	call   800033 <childofspawn>
+  800139:	e9 26 ff ff ff       	jmp    800064 <umain+0x11>
+    panic("sys_page_alloc: %e", r);
+  80013e:	50                   	push   %eax
+  80013f:	68 6c 42 80 00       	push   $0x80426c
+  800144:	6a 13                	push   $0x13
+  800146:	68 7f 42 80 00       	push   $0x80427f
+  80014b:	e8 b1 00 00 00       	call   800201 <_panic>
+    panic("fork: %e", r);
+  800150:	50                   	push   %eax
+  800151:	68 d0 46 80 00       	push   $0x8046d0
+  800156:	6a 17                	push   $0x17
+  800158:	68 7f 42 80 00       	push   $0x80427f
+  80015d:	e8 9f 00 00 00       	call   800201 <_panic>
+    strcpy(VA, msg);
+  800162:	83 ec 08             	sub    $0x8,%esp
+  800165:	ff 35 04 50 80 00    	push   0x805004
+  80016b:	68 00 00 00 a0       	push   $0xa0000000
+  800170:	e8 55 07 00 00       	call   8008ca <strcpy>
+    exit();
+  800175:	e8 6d 00 00 00       	call   8001e7 <exit>
+  80017a:	83 c4 10             	add    $0x10,%esp
+  80017d:	e9 16 ff ff ff       	jmp    800098 <umain+0x45>
+    panic("spawn: %e", r);
+  800182:	50                   	push   %eax
+  800183:	68 c0 42 80 00       	push   $0x8042c0
+  800188:	6a 21                	push   $0x21
+  80018a:	68 7f 42 80 00       	push   $0x80427f
+  80018f:	e8 6d 00 00 00       	call   800201 <_panic>
+
+00800194 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	56                   	push   %esi
+  800198:	53                   	push   %ebx
+  800199:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80019c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80019f:	c7 05 c0 6f 80 00 00 	movl   $0x0,0x806fc0
+  8001a6:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8001a9:	e8 ca 0a 00 00       	call   800c78 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8001ae:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001b3:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8001b6:	c1 e0 04             	shl    $0x4,%eax
+  8001b9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001be:	a3 c0 6f 80 00       	mov    %eax,0x806fc0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001c3:	85 db                	test   %ebx,%ebx
+  8001c5:	7e 07                	jle    8001ce <libmain+0x3a>
+    binaryname = argv[0];
+  8001c7:	8b 06                	mov    (%esi),%eax
+  8001c9:	a3 08 50 80 00       	mov    %eax,0x805008
+
+  // call user main routine
+  umain(argc, argv);
+  8001ce:	83 ec 08             	sub    $0x8,%esp
+  8001d1:	56                   	push   %esi
+  8001d2:	53                   	push   %ebx
+  8001d3:	e8 7b fe ff ff       	call   800053 <umain>
+
+  // exit gracefully
+  exit();
+  8001d8:	e8 0a 00 00 00       	call   8001e7 <exit>
+}
+  8001dd:	83 c4 10             	add    $0x10,%esp
+  8001e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001e3:	5b                   	pop    %ebx
+  8001e4:	5e                   	pop    %esi
+  8001e5:	5d                   	pop    %ebp
+  8001e6:	c3                   	ret
+
+008001e7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001e7:	55                   	push   %ebp
+  8001e8:	89 e5                	mov    %esp,%ebp
+  8001ea:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8001ed:	e8 b4 15 00 00       	call   8017a6 <close_all>
+  sys_env_destroy(0);
+  8001f2:	83 ec 0c             	sub    $0xc,%esp
+  8001f5:	6a 00                	push   $0x0
+  8001f7:	e8 3b 0a 00 00       	call   800c37 <sys_env_destroy>
+}
+  8001fc:	83 c4 10             	add    $0x10,%esp
+  8001ff:	c9                   	leave
+  800200:	c3                   	ret
+
+00800201 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800201:	55                   	push   %ebp
+  800202:	89 e5                	mov    %esp,%ebp
+  800204:	56                   	push   %esi
+  800205:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  800206:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800209:	8b 35 08 50 80 00    	mov    0x805008,%esi
+  80020f:	e8 64 0a 00 00       	call   800c78 <sys_getenvid>
+  800214:	83 ec 0c             	sub    $0xc,%esp
+  800217:	ff 75 0c             	push   0xc(%ebp)
+  80021a:	ff 75 08             	push   0x8(%ebp)
+  80021d:	56                   	push   %esi
+  80021e:	50                   	push   %eax
+  80021f:	68 10 43 80 00       	push   $0x804310
+  800224:	e8 b3 00 00 00       	call   8002dc <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800229:	83 c4 18             	add    $0x18,%esp
+  80022c:	53                   	push   %ebx
+  80022d:	ff 75 10             	push   0x10(%ebp)
+  800230:	e8 56 00 00 00       	call   80028b <vcprintf>
+  cprintf("\n");
+  800235:	c7 04 24 95 48 80 00 	movl   $0x804895,(%esp)
+  80023c:	e8 9b 00 00 00       	call   8002dc <cprintf>
+  800241:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800244:	cc                   	int3
+  while (1)
+  800245:	eb fd                	jmp    800244 <_panic+0x43>
+
+00800247 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800247:	55                   	push   %ebp
+  800248:	89 e5                	mov    %esp,%ebp
+  80024a:	53                   	push   %ebx
+  80024b:	83 ec 04             	sub    $0x4,%esp
+  80024e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800251:	8b 13                	mov    (%ebx),%edx
+  800253:	8d 42 01             	lea    0x1(%edx),%eax
+  800256:	89 03                	mov    %eax,(%ebx)
+  800258:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80025b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  80025f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800264:	74 09                	je     80026f <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800266:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80026a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80026d:	c9                   	leave
+  80026e:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  80026f:	83 ec 08             	sub    $0x8,%esp
+  800272:	68 ff 00 00 00       	push   $0xff
+  800277:	8d 43 08             	lea    0x8(%ebx),%eax
+  80027a:	50                   	push   %eax
+  80027b:	e8 7a 09 00 00       	call   800bfa <sys_cputs>
+    b->idx = 0;
+  800280:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800286:	83 c4 10             	add    $0x10,%esp
+  800289:	eb db                	jmp    800266 <putch+0x1f>
+
+0080028b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80028b:	55                   	push   %ebp
+  80028c:	89 e5                	mov    %esp,%ebp
+  80028e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800294:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80029b:	00 00 00 
+  b.cnt = 0;
+  80029e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002a5:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8002a8:	ff 75 0c             	push   0xc(%ebp)
+  8002ab:	ff 75 08             	push   0x8(%ebp)
+  8002ae:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002b4:	50                   	push   %eax
+  8002b5:	68 47 02 80 00       	push   $0x800247
+  8002ba:	e8 14 01 00 00       	call   8003d3 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8002bf:	83 c4 08             	add    $0x8,%esp
+  8002c2:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002c8:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002ce:	50                   	push   %eax
+  8002cf:	e8 26 09 00 00       	call   800bfa <sys_cputs>
+
+  return b.cnt;
+}
+  8002d4:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002da:	c9                   	leave
+  8002db:	c3                   	ret
+
+008002dc <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002dc:	55                   	push   %ebp
+  8002dd:	89 e5                	mov    %esp,%ebp
+  8002df:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8002e2:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8002e5:	50                   	push   %eax
+  8002e6:	ff 75 08             	push   0x8(%ebp)
+  8002e9:	e8 9d ff ff ff       	call   80028b <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8002ee:	c9                   	leave
+  8002ef:	c3                   	ret
+
+008002f0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8002f0:	55                   	push   %ebp
+  8002f1:	89 e5                	mov    %esp,%ebp
+  8002f3:	57                   	push   %edi
+  8002f4:	56                   	push   %esi
+  8002f5:	53                   	push   %ebx
+  8002f6:	83 ec 1c             	sub    $0x1c,%esp
+  8002f9:	89 c7                	mov    %eax,%edi
+  8002fb:	89 d6                	mov    %edx,%esi
+  8002fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800300:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800303:	89 d1                	mov    %edx,%ecx
+  800305:	89 c2                	mov    %eax,%edx
+  800307:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80030a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80030d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800310:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800313:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800316:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80031d:	39 c2                	cmp    %eax,%edx
+  80031f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800322:	72 3e                	jb     800362 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	ff 75 18             	push   0x18(%ebp)
+  80032a:	83 eb 01             	sub    $0x1,%ebx
+  80032d:	53                   	push   %ebx
+  80032e:	50                   	push   %eax
+  80032f:	83 ec 08             	sub    $0x8,%esp
+  800332:	ff 75 e4             	push   -0x1c(%ebp)
+  800335:	ff 75 e0             	push   -0x20(%ebp)
+  800338:	ff 75 dc             	push   -0x24(%ebp)
+  80033b:	ff 75 d8             	push   -0x28(%ebp)
+  80033e:	e8 88 3d 00 00       	call   8040cb <__udivdi3>
+  800343:	83 c4 18             	add    $0x18,%esp
+  800346:	52                   	push   %edx
+  800347:	50                   	push   %eax
+  800348:	89 f2                	mov    %esi,%edx
+  80034a:	89 f8                	mov    %edi,%eax
+  80034c:	e8 9f ff ff ff       	call   8002f0 <printnum>
+  800351:	83 c4 20             	add    $0x20,%esp
+  800354:	eb 13                	jmp    800369 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800356:	83 ec 08             	sub    $0x8,%esp
+  800359:	56                   	push   %esi
+  80035a:	ff 75 18             	push   0x18(%ebp)
+  80035d:	ff d7                	call   *%edi
+  80035f:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800362:	83 eb 01             	sub    $0x1,%ebx
+  800365:	85 db                	test   %ebx,%ebx
+  800367:	7f ed                	jg     800356 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800369:	83 ec 08             	sub    $0x8,%esp
+  80036c:	56                   	push   %esi
+  80036d:	83 ec 04             	sub    $0x4,%esp
+  800370:	ff 75 e4             	push   -0x1c(%ebp)
+  800373:	ff 75 e0             	push   -0x20(%ebp)
+  800376:	ff 75 dc             	push   -0x24(%ebp)
+  800379:	ff 75 d8             	push   -0x28(%ebp)
+  80037c:	e8 6b 3d 00 00       	call   8040ec <__umoddi3>
+  800381:	83 c4 14             	add    $0x14,%esp
+  800384:	0f be 80 33 43 80 00 	movsbl 0x804333(%eax),%eax
+  80038b:	50                   	push   %eax
+  80038c:	ff d7                	call   *%edi
+}
+  80038e:	83 c4 10             	add    $0x10,%esp
+  800391:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800394:	5b                   	pop    %ebx
+  800395:	5e                   	pop    %esi
+  800396:	5f                   	pop    %edi
+  800397:	5d                   	pop    %ebp
+  800398:	c3                   	ret
+
+00800399 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800399:	55                   	push   %ebp
+  80039a:	89 e5                	mov    %esp,%ebp
+  80039c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80039f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8003a3:	8b 10                	mov    (%eax),%edx
+  8003a5:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003a8:	73 0a                	jae    8003b4 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8003aa:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003ad:	89 08                	mov    %ecx,(%eax)
+  8003af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003b2:	88 02                	mov    %al,(%edx)
+}
+  8003b4:	5d                   	pop    %ebp
+  8003b5:	c3                   	ret
+
+008003b6 <printfmt>:
+{
+  8003b6:	55                   	push   %ebp
+  8003b7:	89 e5                	mov    %esp,%ebp
+  8003b9:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8003bc:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8003bf:	50                   	push   %eax
+  8003c0:	ff 75 10             	push   0x10(%ebp)
+  8003c3:	ff 75 0c             	push   0xc(%ebp)
+  8003c6:	ff 75 08             	push   0x8(%ebp)
+  8003c9:	e8 05 00 00 00       	call   8003d3 <vprintfmt>
+}
+  8003ce:	83 c4 10             	add    $0x10,%esp
+  8003d1:	c9                   	leave
+  8003d2:	c3                   	ret
+
+008003d3 <vprintfmt>:
+{
+  8003d3:	55                   	push   %ebp
+  8003d4:	89 e5                	mov    %esp,%ebp
+  8003d6:	57                   	push   %edi
+  8003d7:	56                   	push   %esi
+  8003d8:	53                   	push   %ebx
+  8003d9:	83 ec 2c             	sub    $0x2c,%esp
+  8003dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003df:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003e2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003e5:	eb 0a                	jmp    8003f1 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	53                   	push   %ebx
+  8003eb:	50                   	push   %eax
+  8003ec:	ff d6                	call   *%esi
+  8003ee:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8003f1:	83 c7 01             	add    $0x1,%edi
+  8003f4:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003f8:	83 f8 25             	cmp    $0x25,%eax
+  8003fb:	74 0c                	je     800409 <vprintfmt+0x36>
+      if (ch == '\0')
+  8003fd:	85 c0                	test   %eax,%eax
+  8003ff:	75 e6                	jne    8003e7 <vprintfmt+0x14>
+}
+  800401:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800404:	5b                   	pop    %ebx
+  800405:	5e                   	pop    %esi
+  800406:	5f                   	pop    %edi
+  800407:	5d                   	pop    %ebp
+  800408:	c3                   	ret
+    padc = ' ';
+  800409:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  80040d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800414:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80041b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800422:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800427:	8d 47 01             	lea    0x1(%edi),%eax
+  80042a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80042d:	0f b6 17             	movzbl (%edi),%edx
+  800430:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800433:	3c 55                	cmp    $0x55,%al
+  800435:	0f 87 cf 03 00 00    	ja     80080a <vprintfmt+0x437>
+  80043b:	0f b6 c0             	movzbl %al,%eax
+  80043e:	ff 24 85 80 44 80 00 	jmp    *0x804480(,%eax,4)
+  800445:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800448:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80044c:	eb d9                	jmp    800427 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80044e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800451:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800455:	eb d0                	jmp    800427 <vprintfmt+0x54>
+  800457:	0f b6 d2             	movzbl %dl,%edx
+  80045a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800465:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800468:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  80046c:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  80046f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800472:	83 f9 09             	cmp    $0x9,%ecx
+  800475:	77 55                	ja     8004cc <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800477:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  80047a:	eb e9                	jmp    800465 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  80047c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047f:	8b 00                	mov    (%eax),%eax
+  800481:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800484:	8b 45 14             	mov    0x14(%ebp),%eax
+  800487:	8d 40 04             	lea    0x4(%eax),%eax
+  80048a:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80048d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800490:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800494:	79 91                	jns    800427 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800496:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800499:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80049c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004a3:	eb 82                	jmp    800427 <vprintfmt+0x54>
+      if (width < 0)
+  8004a5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004a8:	85 d2                	test   %edx,%edx
+  8004aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004af:	0f 49 c2             	cmovns %edx,%eax
+  8004b2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8004b5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8004b8:	e9 6a ff ff ff       	jmp    800427 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8004bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8004c0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8004c7:	e9 5b ff ff ff       	jmp    800427 <vprintfmt+0x54>
+  8004cc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004cf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004d2:	eb bc                	jmp    800490 <vprintfmt+0xbd>
+      lflag++;
+  8004d4:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8004d7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8004da:	e9 48 ff ff ff       	jmp    800427 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8004df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e2:	8d 78 04             	lea    0x4(%eax),%edi
+  8004e5:	83 ec 08             	sub    $0x8,%esp
+  8004e8:	53                   	push   %ebx
+  8004e9:	ff 30                	push   (%eax)
+  8004eb:	ff d6                	call   *%esi
+      break;
+  8004ed:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8004f0:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8004f3:	e9 b1 02 00 00       	jmp    8007a9 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8004f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fb:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8004fe:	8b 10                	mov    (%eax),%edx
+  800500:	89 d0                	mov    %edx,%eax
+  800502:	f7 d8                	neg    %eax
+  800504:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800507:	83 f8 10             	cmp    $0x10,%eax
+  80050a:	7f 23                	jg     80052f <vprintfmt+0x15c>
+  80050c:	8b 14 85 e0 45 80 00 	mov    0x8045e0(,%eax,4),%edx
+  800513:	85 d2                	test   %edx,%edx
+  800515:	74 18                	je     80052f <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800517:	52                   	push   %edx
+  800518:	68 e2 47 80 00       	push   $0x8047e2
+  80051d:	53                   	push   %ebx
+  80051e:	56                   	push   %esi
+  80051f:	e8 92 fe ff ff       	call   8003b6 <printfmt>
+  800524:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800527:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80052a:	e9 7a 02 00 00       	jmp    8007a9 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  80052f:	50                   	push   %eax
+  800530:	68 4b 43 80 00       	push   $0x80434b
+  800535:	53                   	push   %ebx
+  800536:	56                   	push   %esi
+  800537:	e8 7a fe ff ff       	call   8003b6 <printfmt>
+  80053c:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80053f:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800542:	e9 62 02 00 00       	jmp    8007a9 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800547:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054a:	83 c0 04             	add    $0x4,%eax
+  80054d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800550:	8b 45 14             	mov    0x14(%ebp),%eax
+  800553:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800555:	85 c9                	test   %ecx,%ecx
+  800557:	b8 44 43 80 00       	mov    $0x804344,%eax
+  80055c:	0f 45 c1             	cmovne %ecx,%eax
+  80055f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800562:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800566:	7e 06                	jle    80056e <vprintfmt+0x19b>
+  800568:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80056c:	75 0b                	jne    800579 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80056e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800571:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800574:	89 75 08             	mov    %esi,0x8(%ebp)
+  800577:	eb 5c                	jmp    8005d5 <vprintfmt+0x202>
+  800579:	83 ec 08             	sub    $0x8,%esp
+  80057c:	ff 75 d0             	push   -0x30(%ebp)
+  80057f:	ff 75 cc             	push   -0x34(%ebp)
+  800582:	e8 20 03 00 00       	call   8008a7 <strnlen>
+  800587:	89 c2                	mov    %eax,%edx
+  800589:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80058c:	29 d0                	sub    %edx,%eax
+  80058e:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800591:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800595:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800598:	89 75 08             	mov    %esi,0x8(%ebp)
+  80059b:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80059d:	eb 0e                	jmp    8005ad <vprintfmt+0x1da>
+          putch(padc, putdat);
+  80059f:	83 ec 08             	sub    $0x8,%esp
+  8005a2:	53                   	push   %ebx
+  8005a3:	57                   	push   %edi
+  8005a4:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005a7:	83 ee 01             	sub    $0x1,%esi
+  8005aa:	83 c4 10             	add    $0x10,%esp
+  8005ad:	85 f6                	test   %esi,%esi
+  8005af:	7f ee                	jg     80059f <vprintfmt+0x1cc>
+  8005b1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005b7:	85 c0                	test   %eax,%eax
+  8005b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005be:	0f 49 d0             	cmovns %eax,%edx
+  8005c1:	29 d0                	sub    %edx,%eax
+  8005c3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c6:	eb a6                	jmp    80056e <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8005c8:	83 ec 08             	sub    $0x8,%esp
+  8005cb:	53                   	push   %ebx
+  8005cc:	52                   	push   %edx
+  8005cd:	ff 55 08             	call   *0x8(%ebp)
+  8005d0:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005d3:	89 f1                	mov    %esi,%ecx
+  8005d5:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005d8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005dc:	0f be d0             	movsbl %al,%edx
+  8005df:	85 d2                	test   %edx,%edx
+  8005e1:	74 28                	je     80060b <vprintfmt+0x238>
+  8005e3:	85 ff                	test   %edi,%edi
+  8005e5:	78 05                	js     8005ec <vprintfmt+0x219>
+  8005e7:	83 ef 01             	sub    $0x1,%edi
+  8005ea:	78 30                	js     80061c <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8005ec:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005f0:	74 d6                	je     8005c8 <vprintfmt+0x1f5>
+  8005f2:	0f be c0             	movsbl %al,%eax
+  8005f5:	83 e8 20             	sub    $0x20,%eax
+  8005f8:	83 f8 5e             	cmp    $0x5e,%eax
+  8005fb:	76 cb                	jbe    8005c8 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8005fd:	83 ec 08             	sub    $0x8,%esp
+  800600:	53                   	push   %ebx
+  800601:	6a 3f                	push   $0x3f
+  800603:	ff 55 08             	call   *0x8(%ebp)
+  800606:	83 c4 10             	add    $0x10,%esp
+  800609:	eb c8                	jmp    8005d3 <vprintfmt+0x200>
+  80060b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80060e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800611:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800614:	01 d0                	add    %edx,%eax
+  800616:	29 c8                	sub    %ecx,%eax
+  800618:	89 c7                	mov    %eax,%edi
+  80061a:	eb 13                	jmp    80062f <vprintfmt+0x25c>
+  80061c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80061f:	eb ed                	jmp    80060e <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800621:	83 ec 08             	sub    $0x8,%esp
+  800624:	53                   	push   %ebx
+  800625:	6a 20                	push   $0x20
+  800627:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800629:	83 ef 01             	sub    $0x1,%edi
+  80062c:	83 c4 10             	add    $0x10,%esp
+  80062f:	85 ff                	test   %edi,%edi
+  800631:	7f ee                	jg     800621 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800633:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+  800639:	e9 6b 01 00 00       	jmp    8007a9 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  80063e:	83 f9 01             	cmp    $0x1,%ecx
+  800641:	7f 1f                	jg     800662 <vprintfmt+0x28f>
+  else if (lflag)
+  800643:	85 c9                	test   %ecx,%ecx
+  800645:	74 67                	je     8006ae <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064a:	8b 00                	mov    (%eax),%eax
+  80064c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80064f:	89 c1                	mov    %eax,%ecx
+  800651:	c1 f9 1f             	sar    $0x1f,%ecx
+  800654:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8d 40 04             	lea    0x4(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800660:	eb 17                	jmp    800679 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800662:	8b 45 14             	mov    0x14(%ebp),%eax
+  800665:	8b 50 04             	mov    0x4(%eax),%edx
+  800668:	8b 00                	mov    (%eax),%eax
+  80066a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80066d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800670:	8b 45 14             	mov    0x14(%ebp),%eax
+  800673:	8d 40 08             	lea    0x8(%eax),%eax
+  800676:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800679:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80067c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  80067f:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800684:	85 c9                	test   %ecx,%ecx
+  800686:	0f 89 03 01 00 00    	jns    80078f <vprintfmt+0x3bc>
+        putch('-', putdat);
+  80068c:	83 ec 08             	sub    $0x8,%esp
+  80068f:	53                   	push   %ebx
+  800690:	6a 2d                	push   $0x2d
+  800692:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800694:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800697:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80069a:	f7 da                	neg    %edx
+  80069c:	83 d1 00             	adc    $0x0,%ecx
+  80069f:	f7 d9                	neg    %ecx
+  8006a1:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8006a4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006a9:	e9 e1 00 00 00       	jmp    80078f <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8006ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b1:	8b 00                	mov    (%eax),%eax
+  8006b3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006b6:	89 c1                	mov    %eax,%ecx
+  8006b8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006bb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c7:	eb b0                	jmp    800679 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8006c9:	83 f9 01             	cmp    $0x1,%ecx
+  8006cc:	7f 1e                	jg     8006ec <vprintfmt+0x319>
+  else if (lflag)
+  8006ce:	85 c9                	test   %ecx,%ecx
+  8006d0:	74 32                	je     800704 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8006d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d5:	8b 10                	mov    (%eax),%edx
+  8006d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006df:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006e2:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8006e7:	e9 a3 00 00 00       	jmp    80078f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ef:	8b 10                	mov    (%eax),%edx
+  8006f1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006f7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006fa:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8006ff:	e9 8b 00 00 00       	jmp    80078f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800704:	8b 45 14             	mov    0x14(%ebp),%eax
+  800707:	8b 10                	mov    (%eax),%edx
+  800709:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070e:	8d 40 04             	lea    0x4(%eax),%eax
+  800711:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800714:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800719:	eb 74                	jmp    80078f <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  80071b:	83 f9 01             	cmp    $0x1,%ecx
+  80071e:	7f 1b                	jg     80073b <vprintfmt+0x368>
+  else if (lflag)
+  800720:	85 c9                	test   %ecx,%ecx
+  800722:	74 2c                	je     800750 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800724:	8b 45 14             	mov    0x14(%ebp),%eax
+  800727:	8b 10                	mov    (%eax),%edx
+  800729:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80072e:	8d 40 04             	lea    0x4(%eax),%eax
+  800731:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800734:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800739:	eb 54                	jmp    80078f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80073b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073e:	8b 10                	mov    (%eax),%edx
+  800740:	8b 48 04             	mov    0x4(%eax),%ecx
+  800743:	8d 40 08             	lea    0x8(%eax),%eax
+  800746:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800749:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  80074e:	eb 3f                	jmp    80078f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800750:	8b 45 14             	mov    0x14(%ebp),%eax
+  800753:	8b 10                	mov    (%eax),%edx
+  800755:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075a:	8d 40 04             	lea    0x4(%eax),%eax
+  80075d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800760:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800765:	eb 28                	jmp    80078f <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800767:	83 ec 08             	sub    $0x8,%esp
+  80076a:	53                   	push   %ebx
+  80076b:	6a 30                	push   $0x30
+  80076d:	ff d6                	call   *%esi
+      putch('x', putdat);
+  80076f:	83 c4 08             	add    $0x8,%esp
+  800772:	53                   	push   %ebx
+  800773:	6a 78                	push   $0x78
+  800775:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800777:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077a:	8b 10                	mov    (%eax),%edx
+  80077c:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800781:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800784:	8d 40 04             	lea    0x4(%eax),%eax
+  800787:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80078a:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  80078f:	83 ec 0c             	sub    $0xc,%esp
+  800792:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800796:	50                   	push   %eax
+  800797:	ff 75 e0             	push   -0x20(%ebp)
+  80079a:	57                   	push   %edi
+  80079b:	51                   	push   %ecx
+  80079c:	52                   	push   %edx
+  80079d:	89 da                	mov    %ebx,%edx
+  80079f:	89 f0                	mov    %esi,%eax
+  8007a1:	e8 4a fb ff ff       	call   8002f0 <printnum>
+      break;
+  8007a6:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8007a9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8007ac:	e9 40 fc ff ff       	jmp    8003f1 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8007b1:	83 f9 01             	cmp    $0x1,%ecx
+  8007b4:	7f 1b                	jg     8007d1 <vprintfmt+0x3fe>
+  else if (lflag)
+  8007b6:	85 c9                	test   %ecx,%ecx
+  8007b8:	74 2c                	je     8007e6 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8007ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bd:	8b 10                	mov    (%eax),%edx
+  8007bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007ca:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8007cf:	eb be                	jmp    80078f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8007d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d4:	8b 10                	mov    (%eax),%edx
+  8007d6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d9:	8d 40 08             	lea    0x8(%eax),%eax
+  8007dc:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007df:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8007e4:	eb a9                	jmp    80078f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8007e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e9:	8b 10                	mov    (%eax),%edx
+  8007eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007f6:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8007fb:	eb 92                	jmp    80078f <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8007fd:	83 ec 08             	sub    $0x8,%esp
+  800800:	53                   	push   %ebx
+  800801:	6a 25                	push   $0x25
+  800803:	ff d6                	call   *%esi
+      break;
+  800805:	83 c4 10             	add    $0x10,%esp
+  800808:	eb 9f                	jmp    8007a9 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80080a:	83 ec 08             	sub    $0x8,%esp
+  80080d:	53                   	push   %ebx
+  80080e:	6a 25                	push   $0x25
+  800810:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800812:	83 c4 10             	add    $0x10,%esp
+  800815:	89 f8                	mov    %edi,%eax
+  800817:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80081b:	74 05                	je     800822 <vprintfmt+0x44f>
+  80081d:	83 e8 01             	sub    $0x1,%eax
+  800820:	eb f5                	jmp    800817 <vprintfmt+0x444>
+  800822:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800825:	eb 82                	jmp    8007a9 <vprintfmt+0x3d6>
+
+00800827 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800827:	55                   	push   %ebp
+  800828:	89 e5                	mov    %esp,%ebp
+  80082a:	83 ec 18             	sub    $0x18,%esp
+  80082d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800830:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800833:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800836:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80083a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80083d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800844:	85 c0                	test   %eax,%eax
+  800846:	74 26                	je     80086e <vsnprintf+0x47>
+  800848:	85 d2                	test   %edx,%edx
+  80084a:	7e 22                	jle    80086e <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80084c:	ff 75 14             	push   0x14(%ebp)
+  80084f:	ff 75 10             	push   0x10(%ebp)
+  800852:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800855:	50                   	push   %eax
+  800856:	68 99 03 80 00       	push   $0x800399
+  80085b:	e8 73 fb ff ff       	call   8003d3 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800860:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800863:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800866:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800869:	83 c4 10             	add    $0x10,%esp
+}
+  80086c:	c9                   	leave
+  80086d:	c3                   	ret
+    return -E_INVAL;
+  80086e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800873:	eb f7                	jmp    80086c <vsnprintf+0x45>
+
+00800875 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800875:	55                   	push   %ebp
+  800876:	89 e5                	mov    %esp,%ebp
+  800878:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80087b:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  80087e:	50                   	push   %eax
+  80087f:	ff 75 10             	push   0x10(%ebp)
+  800882:	ff 75 0c             	push   0xc(%ebp)
+  800885:	ff 75 08             	push   0x8(%ebp)
+  800888:	e8 9a ff ff ff       	call   800827 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  80088d:	c9                   	leave
+  80088e:	c3                   	ret
+
+0080088f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80088f:	55                   	push   %ebp
+  800890:	89 e5                	mov    %esp,%ebp
+  800892:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089a:	eb 03                	jmp    80089f <strlen+0x10>
+    n++;
+  80089c:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  80089f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008a3:	75 f7                	jne    80089c <strlen+0xd>
+  return n;
+}
+  8008a5:	5d                   	pop    %ebp
+  8008a6:	c3                   	ret
+
+008008a7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008a7:	55                   	push   %ebp
+  8008a8:	89 e5                	mov    %esp,%ebp
+  8008aa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b5:	eb 03                	jmp    8008ba <strnlen+0x13>
+    n++;
+  8008b7:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008ba:	39 d0                	cmp    %edx,%eax
+  8008bc:	74 08                	je     8008c6 <strnlen+0x1f>
+  8008be:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008c2:	75 f3                	jne    8008b7 <strnlen+0x10>
+  8008c4:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8008c6:	89 d0                	mov    %edx,%eax
+  8008c8:	5d                   	pop    %ebp
+  8008c9:	c3                   	ret
+
+008008ca <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008ca:	55                   	push   %ebp
+  8008cb:	89 e5                	mov    %esp,%ebp
+  8008cd:	53                   	push   %ebx
+  8008ce:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  8008d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008dd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008e0:	83 c0 01             	add    $0x1,%eax
+  8008e3:	84 d2                	test   %dl,%dl
+  8008e5:	75 f2                	jne    8008d9 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  8008e7:	89 c8                	mov    %ecx,%eax
+  8008e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ec:	c9                   	leave
+  8008ed:	c3                   	ret
+
+008008ee <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008ee:	55                   	push   %ebp
+  8008ef:	89 e5                	mov    %esp,%ebp
+  8008f1:	53                   	push   %ebx
+  8008f2:	83 ec 10             	sub    $0x10,%esp
+  8008f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  8008f8:	53                   	push   %ebx
+  8008f9:	e8 91 ff ff ff       	call   80088f <strlen>
+  8008fe:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800901:	ff 75 0c             	push   0xc(%ebp)
+  800904:	01 d8                	add    %ebx,%eax
+  800906:	50                   	push   %eax
+  800907:	e8 be ff ff ff       	call   8008ca <strcpy>
+  return dst;
+}
+  80090c:	89 d8                	mov    %ebx,%eax
+  80090e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800911:	c9                   	leave
+  800912:	c3                   	ret
+
+00800913 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800913:	55                   	push   %ebp
+  800914:	89 e5                	mov    %esp,%ebp
+  800916:	56                   	push   %esi
+  800917:	53                   	push   %ebx
+  800918:	8b 75 08             	mov    0x8(%ebp),%esi
+  80091b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  80091e:	89 f3                	mov    %esi,%ebx
+  800920:	03 5d 10             	add    0x10(%ebp),%ebx
+  800923:	89 f0                	mov    %esi,%eax
+  800925:	eb 0f                	jmp    800936 <strncpy+0x23>
+    *dst++ = *src;
+  800927:	83 c0 01             	add    $0x1,%eax
+  80092a:	0f b6 0a             	movzbl (%edx),%ecx
+  80092d:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800930:	80 f9 01             	cmp    $0x1,%cl
+  800933:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800936:	39 d8                	cmp    %ebx,%eax
+  800938:	75 ed                	jne    800927 <strncpy+0x14>
+  }
+  return ret;
+}
+  80093a:	89 f0                	mov    %esi,%eax
+  80093c:	5b                   	pop    %ebx
+  80093d:	5e                   	pop    %esi
+  80093e:	5d                   	pop    %ebp
+  80093f:	c3                   	ret
+
+00800940 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800940:	55                   	push   %ebp
+  800941:	89 e5                	mov    %esp,%ebp
+  800943:	56                   	push   %esi
+  800944:	53                   	push   %ebx
+  800945:	8b 75 08             	mov    0x8(%ebp),%esi
+  800948:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80094b:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  80094e:	89 f0                	mov    %esi,%eax
+  800950:	85 d2                	test   %edx,%edx
+  800952:	74 21                	je     800975 <strlcpy+0x35>
+  800954:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800958:	89 f2                	mov    %esi,%edx
+  80095a:	eb 09                	jmp    800965 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  80095c:	83 c1 01             	add    $0x1,%ecx
+  80095f:	83 c2 01             	add    $0x1,%edx
+  800962:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800965:	39 c2                	cmp    %eax,%edx
+  800967:	74 09                	je     800972 <strlcpy+0x32>
+  800969:	0f b6 19             	movzbl (%ecx),%ebx
+  80096c:	84 db                	test   %bl,%bl
+  80096e:	75 ec                	jne    80095c <strlcpy+0x1c>
+  800970:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800972:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800975:	29 f0                	sub    %esi,%eax
+}
+  800977:	5b                   	pop    %ebx
+  800978:	5e                   	pop    %esi
+  800979:	5d                   	pop    %ebp
+  80097a:	c3                   	ret
+
+0080097b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80097b:	55                   	push   %ebp
+  80097c:	89 e5                	mov    %esp,%ebp
+  80097e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800981:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800984:	eb 06                	jmp    80098c <strcmp+0x11>
+    p++, q++;
+  800986:	83 c1 01             	add    $0x1,%ecx
+  800989:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  80098c:	0f b6 01             	movzbl (%ecx),%eax
+  80098f:	84 c0                	test   %al,%al
+  800991:	74 04                	je     800997 <strcmp+0x1c>
+  800993:	3a 02                	cmp    (%edx),%al
+  800995:	74 ef                	je     800986 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800997:	0f b6 c0             	movzbl %al,%eax
+  80099a:	0f b6 12             	movzbl (%edx),%edx
+  80099d:	29 d0                	sub    %edx,%eax
+}
+  80099f:	5d                   	pop    %ebp
+  8009a0:	c3                   	ret
+
+008009a1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009a1:	55                   	push   %ebp
+  8009a2:	89 e5                	mov    %esp,%ebp
+  8009a4:	53                   	push   %ebx
+  8009a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009ab:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  8009ae:	eb 09                	jmp    8009b9 <strncmp+0x18>
+    n--, p++, q++;
+  8009b0:	83 ea 01             	sub    $0x1,%edx
+  8009b3:	83 c0 01             	add    $0x1,%eax
+  8009b6:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  8009b9:	85 d2                	test   %edx,%edx
+  8009bb:	74 18                	je     8009d5 <strncmp+0x34>
+  8009bd:	0f b6 18             	movzbl (%eax),%ebx
+  8009c0:	84 db                	test   %bl,%bl
+  8009c2:	74 04                	je     8009c8 <strncmp+0x27>
+  8009c4:	3a 19                	cmp    (%ecx),%bl
+  8009c6:	74 e8                	je     8009b0 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8009c8:	0f b6 00             	movzbl (%eax),%eax
+  8009cb:	0f b6 11             	movzbl (%ecx),%edx
+  8009ce:	29 d0                	sub    %edx,%eax
+}
+  8009d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d3:	c9                   	leave
+  8009d4:	c3                   	ret
+    return 0;
+  8009d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009da:	eb f4                	jmp    8009d0 <strncmp+0x2f>
+
+008009dc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8009e6:	eb 03                	jmp    8009eb <strchr+0xf>
+  8009e8:	83 c0 01             	add    $0x1,%eax
+  8009eb:	0f b6 10             	movzbl (%eax),%edx
+  8009ee:	84 d2                	test   %dl,%dl
+  8009f0:	74 06                	je     8009f8 <strchr+0x1c>
+    if (*s == c)
+  8009f2:	38 ca                	cmp    %cl,%dl
+  8009f4:	75 f2                	jne    8009e8 <strchr+0xc>
+  8009f6:	eb 05                	jmp    8009fd <strchr+0x21>
+      return (char*)s;
+  return 0;
+  8009f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009fd:	5d                   	pop    %ebp
+  8009fe:	c3                   	ret
+
+008009ff <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009ff:	55                   	push   %ebp
+  800a00:	89 e5                	mov    %esp,%ebp
+  800a02:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a05:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800a09:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800a0c:	38 ca                	cmp    %cl,%dl
+  800a0e:	74 09                	je     800a19 <strfind+0x1a>
+  800a10:	84 d2                	test   %dl,%dl
+  800a12:	74 05                	je     800a19 <strfind+0x1a>
+  for (; *s; s++)
+  800a14:	83 c0 01             	add    $0x1,%eax
+  800a17:	eb f0                	jmp    800a09 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800a19:	5d                   	pop    %ebp
+  800a1a:	c3                   	ret
+
+00800a1b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a1b:	55                   	push   %ebp
+  800a1c:	89 e5                	mov    %esp,%ebp
+  800a1e:	57                   	push   %edi
+  800a1f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a22:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800a25:	85 c9                	test   %ecx,%ecx
+  800a27:	74 20                	je     800a49 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800a29:	89 f8                	mov    %edi,%eax
+  800a2b:	09 c8                	or     %ecx,%eax
+  800a2d:	a8 03                	test   $0x3,%al
+  800a2f:	75 12                	jne    800a43 <memset+0x28>
+    c &= 0xFF;
+  800a31:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a35:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800a3b:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800a3e:	fc                   	cld
+  800a3f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a41:	eb 06                	jmp    800a49 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800a43:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a46:	fc                   	cld
+  800a47:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800a49:	89 f8                	mov    %edi,%eax
+  800a4b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a4e:	c9                   	leave
+  800a4f:	c3                   	ret
+
+00800a50 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a50:	55                   	push   %ebp
+  800a51:	89 e5                	mov    %esp,%ebp
+  800a53:	57                   	push   %edi
+  800a54:	56                   	push   %esi
+  800a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a58:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a5b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800a5e:	39 c6                	cmp    %eax,%esi
+  800a60:	73 32                	jae    800a94 <memmove+0x44>
+  800a62:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a65:	39 d0                	cmp    %edx,%eax
+  800a67:	73 2b                	jae    800a94 <memmove+0x44>
+    s += n;
+    d += n;
+  800a69:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a6c:	89 d6                	mov    %edx,%esi
+  800a6e:	09 fe                	or     %edi,%esi
+  800a70:	09 ce                	or     %ecx,%esi
+  800a72:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a78:	75 0e                	jne    800a88 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a7a:	83 ef 04             	sub    $0x4,%edi
+  800a7d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a80:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800a83:	fd                   	std
+  800a84:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a86:	eb 09                	jmp    800a91 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a88:	83 ef 01             	sub    $0x1,%edi
+  800a8b:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800a8e:	fd                   	std
+  800a8f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800a91:	fc                   	cld
+  800a92:	eb 1a                	jmp    800aae <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a94:	89 f2                	mov    %esi,%edx
+  800a96:	09 c2                	or     %eax,%edx
+  800a98:	09 ca                	or     %ecx,%edx
+  800a9a:	f6 c2 03             	test   $0x3,%dl
+  800a9d:	75 0a                	jne    800aa9 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a9f:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800aa2:	89 c7                	mov    %eax,%edi
+  800aa4:	fc                   	cld
+  800aa5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800aa7:	eb 05                	jmp    800aae <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800aa9:	89 c7                	mov    %eax,%edi
+  800aab:	fc                   	cld
+  800aac:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800aae:	5e                   	pop    %esi
+  800aaf:	5f                   	pop    %edi
+  800ab0:	5d                   	pop    %ebp
+  800ab1:	c3                   	ret
+
+00800ab2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ab2:	55                   	push   %ebp
+  800ab3:	89 e5                	mov    %esp,%ebp
+  800ab5:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800ab8:	ff 75 10             	push   0x10(%ebp)
+  800abb:	ff 75 0c             	push   0xc(%ebp)
+  800abe:	ff 75 08             	push   0x8(%ebp)
+  800ac1:	e8 8a ff ff ff       	call   800a50 <memmove>
+}
+  800ac6:	c9                   	leave
+  800ac7:	c3                   	ret
+
+00800ac8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ac8:	55                   	push   %ebp
+  800ac9:	89 e5                	mov    %esp,%ebp
+  800acb:	56                   	push   %esi
+  800acc:	53                   	push   %ebx
+  800acd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800ad3:	89 c6                	mov    %eax,%esi
+  800ad5:	03 75 10             	add    0x10(%ebp),%esi
+  800ad8:	eb 06                	jmp    800ae0 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800ada:	83 c0 01             	add    $0x1,%eax
+  800add:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800ae0:	39 f0                	cmp    %esi,%eax
+  800ae2:	74 14                	je     800af8 <memcmp+0x30>
+    if (*s1 != *s2)
+  800ae4:	0f b6 08             	movzbl (%eax),%ecx
+  800ae7:	0f b6 1a             	movzbl (%edx),%ebx
+  800aea:	38 d9                	cmp    %bl,%cl
+  800aec:	74 ec                	je     800ada <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800aee:	0f b6 c1             	movzbl %cl,%eax
+  800af1:	0f b6 db             	movzbl %bl,%ebx
+  800af4:	29 d8                	sub    %ebx,%eax
+  800af6:	eb 05                	jmp    800afd <memcmp+0x35>
+  }
+
+  return 0;
+  800af8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800afd:	5b                   	pop    %ebx
+  800afe:	5e                   	pop    %esi
+  800aff:	5d                   	pop    %ebp
+  800b00:	c3                   	ret
+
+00800b01 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b01:	55                   	push   %ebp
+  800b02:	89 e5                	mov    %esp,%ebp
+  800b04:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800b0a:	89 c2                	mov    %eax,%edx
+  800b0c:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800b0f:	eb 03                	jmp    800b14 <memfind+0x13>
+  800b11:	83 c0 01             	add    $0x1,%eax
+  800b14:	39 d0                	cmp    %edx,%eax
+  800b16:	73 04                	jae    800b1c <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800b18:	38 08                	cmp    %cl,(%eax)
+  800b1a:	75 f5                	jne    800b11 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800b1c:	5d                   	pop    %ebp
+  800b1d:	c3                   	ret
+
+00800b1e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	57                   	push   %edi
+  800b22:	56                   	push   %esi
+  800b23:	53                   	push   %ebx
+  800b24:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800b2a:	eb 03                	jmp    800b2f <strtol+0x11>
+    s++;
+  800b2c:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800b2f:	0f b6 02             	movzbl (%edx),%eax
+  800b32:	3c 20                	cmp    $0x20,%al
+  800b34:	74 f6                	je     800b2c <strtol+0xe>
+  800b36:	3c 09                	cmp    $0x9,%al
+  800b38:	74 f2                	je     800b2c <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800b3a:	3c 2b                	cmp    $0x2b,%al
+  800b3c:	74 2a                	je     800b68 <strtol+0x4a>
+  int neg = 0;
+  800b3e:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800b43:	3c 2d                	cmp    $0x2d,%al
+  800b45:	74 2b                	je     800b72 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b47:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b4d:	75 0f                	jne    800b5e <strtol+0x40>
+  800b4f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b52:	74 28                	je     800b7c <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800b54:	85 db                	test   %ebx,%ebx
+  800b56:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b5b:	0f 44 d8             	cmove  %eax,%ebx
+  800b5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b63:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b66:	eb 46                	jmp    800bae <strtol+0x90>
+    s++;
+  800b68:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800b6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b70:	eb d5                	jmp    800b47 <strtol+0x29>
+    s++, neg = 1;
+  800b72:	83 c2 01             	add    $0x1,%edx
+  800b75:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b7a:	eb cb                	jmp    800b47 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b7c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b80:	74 0e                	je     800b90 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800b82:	85 db                	test   %ebx,%ebx
+  800b84:	75 d8                	jne    800b5e <strtol+0x40>
+    s++, base = 8;
+  800b86:	83 c2 01             	add    $0x1,%edx
+  800b89:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b8e:	eb ce                	jmp    800b5e <strtol+0x40>
+    s += 2, base = 16;
+  800b90:	83 c2 02             	add    $0x2,%edx
+  800b93:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b98:	eb c4                	jmp    800b5e <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800b9a:	0f be c0             	movsbl %al,%eax
+  800b9d:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800ba0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ba3:	7d 3a                	jge    800bdf <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800ba5:	83 c2 01             	add    $0x1,%edx
+  800ba8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bac:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800bae:	0f b6 02             	movzbl (%edx),%eax
+  800bb1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bb4:	89 f3                	mov    %esi,%ebx
+  800bb6:	80 fb 09             	cmp    $0x9,%bl
+  800bb9:	76 df                	jbe    800b9a <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800bbb:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bbe:	89 f3                	mov    %esi,%ebx
+  800bc0:	80 fb 19             	cmp    $0x19,%bl
+  800bc3:	77 08                	ja     800bcd <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800bc5:	0f be c0             	movsbl %al,%eax
+  800bc8:	83 e8 57             	sub    $0x57,%eax
+  800bcb:	eb d3                	jmp    800ba0 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800bcd:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bd0:	89 f3                	mov    %esi,%ebx
+  800bd2:	80 fb 19             	cmp    $0x19,%bl
+  800bd5:	77 08                	ja     800bdf <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800bd7:	0f be c0             	movsbl %al,%eax
+  800bda:	83 e8 37             	sub    $0x37,%eax
+  800bdd:	eb c1                	jmp    800ba0 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800bdf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800be3:	74 05                	je     800bea <strtol+0xcc>
+    *endptr = (char*)s;
+  800be5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800be8:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800bea:	89 c8                	mov    %ecx,%eax
+  800bec:	f7 d8                	neg    %eax
+  800bee:	85 ff                	test   %edi,%edi
+  800bf0:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bf3:	89 c8                	mov    %ecx,%eax
+  800bf5:	5b                   	pop    %ebx
+  800bf6:	5e                   	pop    %esi
+  800bf7:	5f                   	pop    %edi
+  800bf8:	5d                   	pop    %ebp
+  800bf9:	c3                   	ret
+
+00800bfa <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bfa:	55                   	push   %ebp
+  800bfb:	89 e5                	mov    %esp,%ebp
+  800bfd:	57                   	push   %edi
+  800bfe:	56                   	push   %esi
+  800bff:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c0b:	89 c3                	mov    %eax,%ebx
+  800c0d:	89 c7                	mov    %eax,%edi
+  800c0f:	89 c6                	mov    %eax,%esi
+  800c11:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c13:	5b                   	pop    %ebx
+  800c14:	5e                   	pop    %esi
+  800c15:	5f                   	pop    %edi
+  800c16:	5d                   	pop    %ebp
+  800c17:	c3                   	ret
+
+00800c18 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c18:	55                   	push   %ebp
+  800c19:	89 e5                	mov    %esp,%ebp
+  800c1b:	57                   	push   %edi
+  800c1c:	56                   	push   %esi
+  800c1d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c23:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c28:	89 d1                	mov    %edx,%ecx
+  800c2a:	89 d3                	mov    %edx,%ebx
+  800c2c:	89 d7                	mov    %edx,%edi
+  800c2e:	89 d6                	mov    %edx,%esi
+  800c30:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c32:	5b                   	pop    %ebx
+  800c33:	5e                   	pop    %esi
+  800c34:	5f                   	pop    %edi
+  800c35:	5d                   	pop    %ebp
+  800c36:	c3                   	ret
+
+00800c37 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c37:	55                   	push   %ebp
+  800c38:	89 e5                	mov    %esp,%ebp
+  800c3a:	57                   	push   %edi
+  800c3b:	56                   	push   %esi
+  800c3c:	53                   	push   %ebx
+  800c3d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c48:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c4d:	89 cb                	mov    %ecx,%ebx
+  800c4f:	89 cf                	mov    %ecx,%edi
+  800c51:	89 ce                	mov    %ecx,%esi
+  800c53:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c55:	85 c0                	test   %eax,%eax
+  800c57:	7f 08                	jg     800c61 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5c:	5b                   	pop    %ebx
+  800c5d:	5e                   	pop    %esi
+  800c5e:	5f                   	pop    %edi
+  800c5f:	5d                   	pop    %ebp
+  800c60:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c61:	83 ec 0c             	sub    $0xc,%esp
+  800c64:	50                   	push   %eax
+  800c65:	6a 03                	push   $0x3
+  800c67:	68 43 46 80 00       	push   $0x804643
+  800c6c:	6a 23                	push   $0x23
+  800c6e:	68 60 46 80 00       	push   $0x804660
+  800c73:	e8 89 f5 ff ff       	call   800201 <_panic>
+
+00800c78 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	57                   	push   %edi
+  800c7c:	56                   	push   %esi
+  800c7d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c83:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c88:	89 d1                	mov    %edx,%ecx
+  800c8a:	89 d3                	mov    %edx,%ebx
+  800c8c:	89 d7                	mov    %edx,%edi
+  800c8e:	89 d6                	mov    %edx,%esi
+  800c90:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c92:	5b                   	pop    %ebx
+  800c93:	5e                   	pop    %esi
+  800c94:	5f                   	pop    %edi
+  800c95:	5d                   	pop    %ebp
+  800c96:	c3                   	ret
+
+00800c97 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c97:	55                   	push   %ebp
+  800c98:	89 e5                	mov    %esp,%ebp
+  800c9a:	57                   	push   %edi
+  800c9b:	56                   	push   %esi
+  800c9c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ca7:	89 d1                	mov    %edx,%ecx
+  800ca9:	89 d3                	mov    %edx,%ebx
+  800cab:	89 d7                	mov    %edx,%edi
+  800cad:	89 d6                	mov    %edx,%esi
+  800caf:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cb1:	5b                   	pop    %ebx
+  800cb2:	5e                   	pop    %esi
+  800cb3:	5f                   	pop    %edi
+  800cb4:	5d                   	pop    %ebp
+  800cb5:	c3                   	ret
+
+00800cb6 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800cb6:	55                   	push   %ebp
+  800cb7:	89 e5                	mov    %esp,%ebp
+  800cb9:	57                   	push   %edi
+  800cba:	56                   	push   %esi
+  800cbb:	53                   	push   %ebx
+  800cbc:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800cbf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800cc3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccb:	b8 14 00 00 00       	mov    $0x14,%eax
+  800cd0:	89 df                	mov    %ebx,%edi
+  800cd2:	89 de                	mov    %ebx,%esi
+  800cd4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cd6:	85 c0                	test   %eax,%eax
+  800cd8:	7f 08                	jg     800ce2 <sys_env_set_cow+0x2c>
+}
+  800cda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdd:	5b                   	pop    %ebx
+  800cde:	5e                   	pop    %esi
+  800cdf:	5f                   	pop    %edi
+  800ce0:	5d                   	pop    %ebp
+  800ce1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ce2:	83 ec 0c             	sub    $0xc,%esp
+  800ce5:	50                   	push   %eax
+  800ce6:	6a 14                	push   $0x14
+  800ce8:	68 43 46 80 00       	push   $0x804643
+  800ced:	6a 23                	push   $0x23
+  800cef:	68 60 46 80 00       	push   $0x804660
+  800cf4:	e8 08 f5 ff ff       	call   800201 <_panic>
+
+00800cf9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cf9:	55                   	push   %ebp
+  800cfa:	89 e5                	mov    %esp,%ebp
+  800cfc:	57                   	push   %edi
+  800cfd:	56                   	push   %esi
+  800cfe:	53                   	push   %ebx
+  800cff:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d02:	be 00 00 00 00       	mov    $0x0,%esi
+  800d07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d12:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d15:	89 f7                	mov    %esi,%edi
+  800d17:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d19:	85 c0                	test   %eax,%eax
+  800d1b:	7f 08                	jg     800d25 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800d1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d20:	5b                   	pop    %ebx
+  800d21:	5e                   	pop    %esi
+  800d22:	5f                   	pop    %edi
+  800d23:	5d                   	pop    %ebp
+  800d24:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d25:	83 ec 0c             	sub    $0xc,%esp
+  800d28:	50                   	push   %eax
+  800d29:	6a 04                	push   $0x4
+  800d2b:	68 43 46 80 00       	push   $0x804643
+  800d30:	6a 23                	push   $0x23
+  800d32:	68 60 46 80 00       	push   $0x804660
+  800d37:	e8 c5 f4 ff ff       	call   800201 <_panic>
+
+00800d3c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d3c:	55                   	push   %ebp
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	57                   	push   %edi
+  800d40:	56                   	push   %esi
+  800d41:	53                   	push   %ebx
+  800d42:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d53:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d56:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d59:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d5b:	85 c0                	test   %eax,%eax
+  800d5d:	7f 08                	jg     800d67 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800d5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d62:	5b                   	pop    %ebx
+  800d63:	5e                   	pop    %esi
+  800d64:	5f                   	pop    %edi
+  800d65:	5d                   	pop    %ebp
+  800d66:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d67:	83 ec 0c             	sub    $0xc,%esp
+  800d6a:	50                   	push   %eax
+  800d6b:	6a 05                	push   $0x5
+  800d6d:	68 43 46 80 00       	push   $0x804643
+  800d72:	6a 23                	push   $0x23
+  800d74:	68 60 46 80 00       	push   $0x804660
+  800d79:	e8 83 f4 ff ff       	call   800201 <_panic>
+
+00800d7e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d7e:	55                   	push   %ebp
+  800d7f:	89 e5                	mov    %esp,%ebp
+  800d81:	57                   	push   %edi
+  800d82:	56                   	push   %esi
+  800d83:	53                   	push   %ebx
+  800d84:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d92:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d97:	89 df                	mov    %ebx,%edi
+  800d99:	89 de                	mov    %ebx,%esi
+  800d9b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d9d:	85 c0                	test   %eax,%eax
+  800d9f:	7f 08                	jg     800da9 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800da1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da4:	5b                   	pop    %ebx
+  800da5:	5e                   	pop    %esi
+  800da6:	5f                   	pop    %edi
+  800da7:	5d                   	pop    %ebp
+  800da8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800da9:	83 ec 0c             	sub    $0xc,%esp
+  800dac:	50                   	push   %eax
+  800dad:	6a 06                	push   $0x6
+  800daf:	68 43 46 80 00       	push   $0x804643
+  800db4:	6a 23                	push   $0x23
+  800db6:	68 60 46 80 00       	push   $0x804660
+  800dbb:	e8 41 f4 ff ff       	call   800201 <_panic>
+
+00800dc0 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800dc0:	55                   	push   %ebp
+  800dc1:	89 e5                	mov    %esp,%ebp
+  800dc3:	57                   	push   %edi
+  800dc4:	56                   	push   %esi
+  800dc5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcc:	b8 11 00 00 00       	mov    $0x11,%eax
+  800dd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dd7:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dda:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800ddc:	5b                   	pop    %ebx
+  800ddd:	5e                   	pop    %esi
+  800dde:	5f                   	pop    %edi
+  800ddf:	5d                   	pop    %ebp
+  800de0:	c3                   	ret
+
+00800de1 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800de1:	55                   	push   %ebp
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	57                   	push   %edi
+  800de5:	56                   	push   %esi
+  800de6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800de7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ded:	b8 12 00 00 00       	mov    $0x12,%eax
+  800df2:	be 00 00 00 00       	mov    $0x0,%esi
+  800df7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dfd:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800dff:	5b                   	pop    %ebx
+  800e00:	5e                   	pop    %esi
+  800e01:	5f                   	pop    %edi
+  800e02:	5d                   	pop    %ebp
+  800e03:	c3                   	ret
+
+00800e04 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800e04:	55                   	push   %ebp
+  800e05:	89 e5                	mov    %esp,%ebp
+  800e07:	57                   	push   %edi
+  800e08:	56                   	push   %esi
+  800e09:	53                   	push   %ebx
+  800e0a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e18:	b8 16 00 00 00       	mov    $0x16,%eax
+  800e1d:	89 df                	mov    %ebx,%edi
+  800e1f:	89 de                	mov    %ebx,%esi
+  800e21:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e23:	85 c0                	test   %eax,%eax
+  800e25:	7f 08                	jg     800e2f <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800e27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2a:	5b                   	pop    %ebx
+  800e2b:	5e                   	pop    %esi
+  800e2c:	5f                   	pop    %edi
+  800e2d:	5d                   	pop    %ebp
+  800e2e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e2f:	83 ec 0c             	sub    $0xc,%esp
+  800e32:	50                   	push   %eax
+  800e33:	6a 16                	push   $0x16
+  800e35:	68 43 46 80 00       	push   $0x804643
+  800e3a:	6a 23                	push   $0x23
+  800e3c:	68 60 46 80 00       	push   $0x804660
+  800e41:	e8 bb f3 ff ff       	call   800201 <_panic>
+
+00800e46 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800e46:	55                   	push   %ebp
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	57                   	push   %edi
+  800e4a:	56                   	push   %esi
+  800e4b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e54:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e59:	89 cb                	mov    %ecx,%ebx
+  800e5b:	89 cf                	mov    %ecx,%edi
+  800e5d:	89 ce                	mov    %ecx,%esi
+  800e5f:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800e61:	5b                   	pop    %ebx
+  800e62:	5e                   	pop    %esi
+  800e63:	5f                   	pop    %edi
+  800e64:	5d                   	pop    %ebp
+  800e65:	c3                   	ret
+
+00800e66 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800e66:	55                   	push   %ebp
+  800e67:	89 e5                	mov    %esp,%ebp
+  800e69:	57                   	push   %edi
+  800e6a:	56                   	push   %esi
+  800e6b:	53                   	push   %ebx
+  800e6c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e6f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7a:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e82:	89 f7                	mov    %esi,%edi
+  800e84:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e86:	85 c0                	test   %eax,%eax
+  800e88:	7f 08                	jg     800e92 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800e8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8d:	5b                   	pop    %ebx
+  800e8e:	5e                   	pop    %esi
+  800e8f:	5f                   	pop    %edi
+  800e90:	5d                   	pop    %ebp
+  800e91:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e92:	83 ec 0c             	sub    $0xc,%esp
+  800e95:	50                   	push   %eax
+  800e96:	6a 18                	push   $0x18
+  800e98:	68 43 46 80 00       	push   $0x804643
+  800e9d:	6a 23                	push   $0x23
+  800e9f:	68 60 46 80 00       	push   $0x804660
+  800ea4:	e8 58 f3 ff ff       	call   800201 <_panic>
+
+00800ea9 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800ea9:	55                   	push   %ebp
+  800eaa:	89 e5                	mov    %esp,%ebp
+  800eac:	57                   	push   %edi
+  800ead:	56                   	push   %esi
+  800eae:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800eaf:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eba:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ebf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec2:	89 f7                	mov    %esi,%edi
+  800ec4:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800ec6:	5b                   	pop    %ebx
+  800ec7:	5e                   	pop    %esi
+  800ec8:	5f                   	pop    %edi
+  800ec9:	5d                   	pop    %ebp
+  800eca:	c3                   	ret
+
+00800ecb <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800ecb:	55                   	push   %ebp
+  800ecc:	89 e5                	mov    %esp,%ebp
+  800ece:	57                   	push   %edi
+  800ecf:	56                   	push   %esi
+  800ed0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ed1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed6:	b8 15 00 00 00       	mov    $0x15,%eax
+  800edb:	89 d1                	mov    %edx,%ecx
+  800edd:	89 d3                	mov    %edx,%ebx
+  800edf:	89 d7                	mov    %edx,%edi
+  800ee1:	89 d6                	mov    %edx,%esi
+  800ee3:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800ee5:	5b                   	pop    %ebx
+  800ee6:	5e                   	pop    %esi
+  800ee7:	5f                   	pop    %edi
+  800ee8:	5d                   	pop    %ebp
+  800ee9:	c3                   	ret
+
+00800eea <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800eea:	55                   	push   %ebp
+  800eeb:	89 e5                	mov    %esp,%ebp
+  800eed:	57                   	push   %edi
+  800eee:	56                   	push   %esi
+  800eef:	53                   	push   %ebx
+  800ef0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ef3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ef8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efe:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f03:	89 df                	mov    %ebx,%edi
+  800f05:	89 de                	mov    %ebx,%esi
+  800f07:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f09:	85 c0                	test   %eax,%eax
+  800f0b:	7f 08                	jg     800f15 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f10:	5b                   	pop    %ebx
+  800f11:	5e                   	pop    %esi
+  800f12:	5f                   	pop    %edi
+  800f13:	5d                   	pop    %ebp
+  800f14:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f15:	83 ec 0c             	sub    $0xc,%esp
+  800f18:	50                   	push   %eax
+  800f19:	6a 08                	push   $0x8
+  800f1b:	68 43 46 80 00       	push   $0x804643
+  800f20:	6a 23                	push   $0x23
+  800f22:	68 60 46 80 00       	push   $0x804660
+  800f27:	e8 d5 f2 ff ff       	call   800201 <_panic>
+
+00800f2c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f2c:	55                   	push   %ebp
+  800f2d:	89 e5                	mov    %esp,%ebp
+  800f2f:	57                   	push   %edi
+  800f30:	56                   	push   %esi
+  800f31:	53                   	push   %ebx
+  800f32:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f40:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f45:	89 df                	mov    %ebx,%edi
+  800f47:	89 de                	mov    %ebx,%esi
+  800f49:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f4b:	85 c0                	test   %eax,%eax
+  800f4d:	7f 08                	jg     800f57 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800f4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f52:	5b                   	pop    %ebx
+  800f53:	5e                   	pop    %esi
+  800f54:	5f                   	pop    %edi
+  800f55:	5d                   	pop    %ebp
+  800f56:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f57:	83 ec 0c             	sub    $0xc,%esp
+  800f5a:	50                   	push   %eax
+  800f5b:	6a 09                	push   $0x9
+  800f5d:	68 43 46 80 00       	push   $0x804643
+  800f62:	6a 23                	push   $0x23
+  800f64:	68 60 46 80 00       	push   $0x804660
+  800f69:	e8 93 f2 ff ff       	call   800201 <_panic>
+
+00800f6e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f6e:	55                   	push   %ebp
+  800f6f:	89 e5                	mov    %esp,%ebp
+  800f71:	57                   	push   %edi
+  800f72:	56                   	push   %esi
+  800f73:	53                   	push   %ebx
+  800f74:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f82:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f87:	89 df                	mov    %ebx,%edi
+  800f89:	89 de                	mov    %ebx,%esi
+  800f8b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f8d:	85 c0                	test   %eax,%eax
+  800f8f:	7f 08                	jg     800f99 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800f91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f94:	5b                   	pop    %ebx
+  800f95:	5e                   	pop    %esi
+  800f96:	5f                   	pop    %edi
+  800f97:	5d                   	pop    %ebp
+  800f98:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f99:	83 ec 0c             	sub    $0xc,%esp
+  800f9c:	50                   	push   %eax
+  800f9d:	6a 0a                	push   $0xa
+  800f9f:	68 43 46 80 00       	push   $0x804643
+  800fa4:	6a 23                	push   $0x23
+  800fa6:	68 60 46 80 00       	push   $0x804660
+  800fab:	e8 51 f2 ff ff       	call   800201 <_panic>
+
+00800fb0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800fb0:	55                   	push   %ebp
+  800fb1:	89 e5                	mov    %esp,%ebp
+  800fb3:	57                   	push   %edi
+  800fb4:	56                   	push   %esi
+  800fb5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fc1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc7:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fca:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800fcc:	5b                   	pop    %ebx
+  800fcd:	5e                   	pop    %esi
+  800fce:	5f                   	pop    %edi
+  800fcf:	5d                   	pop    %ebp
+  800fd0:	c3                   	ret
+
+00800fd1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800fd1:	55                   	push   %ebp
+  800fd2:	89 e5                	mov    %esp,%ebp
+  800fd4:	57                   	push   %edi
+  800fd5:	56                   	push   %esi
+  800fd6:	53                   	push   %ebx
+  800fd7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fea:	89 df                	mov    %ebx,%edi
+  800fec:	89 de                	mov    %ebx,%esi
+  800fee:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ff0:	85 c0                	test   %eax,%eax
+  800ff2:	7f 08                	jg     800ffc <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800ff4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff7:	5b                   	pop    %ebx
+  800ff8:	5e                   	pop    %esi
+  800ff9:	5f                   	pop    %edi
+  800ffa:	5d                   	pop    %ebp
+  800ffb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ffc:	83 ec 0c             	sub    $0xc,%esp
+  800fff:	50                   	push   %eax
+  801000:	6a 0d                	push   $0xd
+  801002:	68 43 46 80 00       	push   $0x804643
+  801007:	6a 23                	push   $0x23
+  801009:	68 60 46 80 00       	push   $0x804660
+  80100e:	e8 ee f1 ff ff       	call   800201 <_panic>
+
+00801013 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  801013:	55                   	push   %ebp
+  801014:	89 e5                	mov    %esp,%ebp
+  801016:	57                   	push   %edi
+  801017:	56                   	push   %esi
+  801018:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801019:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801023:	89 d1                	mov    %edx,%ecx
+  801025:	89 d3                	mov    %edx,%ebx
+  801027:	89 d7                	mov    %edx,%edi
+  801029:	89 d6                	mov    %edx,%esi
+  80102b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80102d:	5b                   	pop    %ebx
+  80102e:	5e                   	pop    %esi
+  80102f:	5f                   	pop    %edi
+  801030:	5d                   	pop    %ebp
+  801031:	c3                   	ret
+
+00801032 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801032:	55                   	push   %ebp
+  801033:	89 e5                	mov    %esp,%ebp
+  801035:	57                   	push   %edi
+  801036:	56                   	push   %esi
+  801037:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801038:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801043:	be 00 00 00 00       	mov    $0x0,%esi
+  801048:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80104b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80104e:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801050:	5b                   	pop    %ebx
+  801051:	5e                   	pop    %esi
+  801052:	5f                   	pop    %edi
+  801053:	5d                   	pop    %ebp
+  801054:	c3                   	ret
+
+00801055 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	57                   	push   %edi
+  801059:	56                   	push   %esi
+  80105a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80105b:	be 00 00 00 00       	mov    $0x0,%esi
+  801060:	8b 55 08             	mov    0x8(%ebp),%edx
+  801063:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801066:	b8 10 00 00 00       	mov    $0x10,%eax
+  80106b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80106e:	89 f7                	mov    %esi,%edi
+  801070:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801072:	5b                   	pop    %ebx
+  801073:	5e                   	pop    %esi
+  801074:	5f                   	pop    %edi
+  801075:	5d                   	pop    %ebp
+  801076:	c3                   	ret
+
+00801077 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801077:	55                   	push   %ebp
+  801078:	89 e5                	mov    %esp,%ebp
+  80107a:	57                   	push   %edi
+  80107b:	56                   	push   %esi
+  80107c:	53                   	push   %ebx
+  80107d:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801080:	80 3d c4 6f 80 00 00 	cmpb   $0x0,0x806fc4
+  801087:	74 41                	je     8010ca <sys_batch+0x53>
+  801089:	8b 45 08             	mov    0x8(%ebp),%eax
+  80108c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80108f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801096:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801099:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80109c:	7d 45                	jge    8010e3 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80109e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8010a1:	8b 06                	mov    (%esi),%eax
+  8010a3:	8b 56 04             	mov    0x4(%esi),%edx
+  8010a6:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8010a9:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8010ac:	8b 7e 10             	mov    0x10(%esi),%edi
+  8010af:	8b 76 14             	mov    0x14(%esi),%esi
+  8010b2:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8010b4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8010b7:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8010ba:	83 c6 1c             	add    $0x1c,%esi
+  8010bd:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	78 1f                	js     8010e3 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8010c4:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8010c8:	eb cc                	jmp    801096 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8010ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cf:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010da:	89 df                	mov    %ebx,%edi
+  8010dc:	89 de                	mov    %ebx,%esi
+  8010de:	cd 30                	int    $0x30
+  8010e0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8010e3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010e6:	83 c4 08             	add    $0x8,%esp
+  8010e9:	5b                   	pop    %ebx
+  8010ea:	5e                   	pop    %esi
+  8010eb:	5f                   	pop    %edi
+  8010ec:	5d                   	pop    %ebp
+  8010ed:	c3                   	ret
+
+008010ee <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8010ee:	55                   	push   %ebp
+  8010ef:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8010f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010f4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8010fa:	5d                   	pop    %ebp
+  8010fb:	c3                   	ret
+
+008010fc <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8010fc:	55                   	push   %ebp
+  8010fd:	89 e5                	mov    %esp,%ebp
+  8010ff:	56                   	push   %esi
+  801100:	53                   	push   %ebx
+  801101:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  801104:	8b 1e                	mov    (%esi),%ebx
+  801106:	85 db                	test   %ebx,%ebx
+  801108:	75 09                	jne    801113 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  80110a:	89 d8                	mov    %ebx,%eax
+  80110c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80110f:	5b                   	pop    %ebx
+  801110:	5e                   	pop    %esi
+  801111:	5d                   	pop    %ebp
+  801112:	c3                   	ret
+  b->sb_n = 0;
+  801113:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801119:	53                   	push   %ebx
+  80111a:	8d 46 04             	lea    0x4(%esi),%eax
+  80111d:	50                   	push   %eax
+  80111e:	e8 54 ff ff ff       	call   801077 <sys_batch>
+  801123:	83 c4 08             	add    $0x8,%esp
+  801126:	85 c0                	test   %eax,%eax
+  801128:	78 1e                	js     801148 <sysbatch_flush+0x4c>
+  if (r < n)
+  80112a:	39 c3                	cmp    %eax,%ebx
+  80112c:	7f 07                	jg     801135 <sysbatch_flush+0x39>
+  return 0;
+  80112e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801133:	eb d5                	jmp    80110a <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801135:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801138:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  80113c:	85 db                	test   %ebx,%ebx
+  80113e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801143:	0f 49 d8             	cmovns %eax,%ebx
+  801146:	eb c2                	jmp    80110a <sysbatch_flush+0xe>
+    return r;
+  801148:	89 c3                	mov    %eax,%ebx
+  80114a:	eb be                	jmp    80110a <sysbatch_flush+0xe>
+
+0080114c <sysbatch_add>:
+{
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	53                   	push   %ebx
+  801150:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801153:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801156:	74 41                	je     801199 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801158:	8b 03                	mov    (%ebx),%eax
+  80115a:	8d 50 01             	lea    0x1(%eax),%edx
+  80115d:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80115f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801162:	01 d8                	add    %ebx,%eax
+  801164:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801167:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80116a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80116d:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801170:	8b 55 14             	mov    0x14(%ebp),%edx
+  801173:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801176:	8b 55 18             	mov    0x18(%ebp),%edx
+  801179:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  80117c:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80117f:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801182:	8b 55 20             	mov    0x20(%ebp),%edx
+  801185:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801188:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80118f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801194:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801197:	c9                   	leave
+  801198:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801199:	53                   	push   %ebx
+  80119a:	e8 5d ff ff ff       	call   8010fc <sysbatch_flush>
+  80119f:	83 c4 04             	add    $0x4,%esp
+  8011a2:	85 c0                	test   %eax,%eax
+  8011a4:	79 b2                	jns    801158 <sysbatch_add+0xc>
+  8011a6:	eb ec                	jmp    801194 <sysbatch_add+0x48>
+
+008011a8 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8011a8:	55                   	push   %ebp
+  8011a9:	89 e5                	mov    %esp,%ebp
+  8011ab:	56                   	push   %esi
+  8011ac:	53                   	push   %ebx
+  8011ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  8011b0:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  8011b2:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  8011b5:	83 ec 0c             	sub    $0xc,%esp
+  8011b8:	50                   	push   %eax
+  8011b9:	e8 ac 25 00 00       	call   80376a <mmap_fault>
+  8011be:	83 c4 10             	add    $0x10,%esp
+  8011c1:	84 c0                	test   %al,%al
+  8011c3:	75 7d                	jne    801242 <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  8011c5:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8011cb:	74 7c                	je     801249 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  8011cd:	89 d8                	mov    %ebx,%eax
+  8011cf:	c1 e8 0c             	shr    $0xc,%eax
+  8011d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011d9:	f6 c4 08             	test   $0x8,%ah
+  8011dc:	74 7d                	je     80125b <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8011de:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8011e4:	83 ec 04             	sub    $0x4,%esp
+  8011e7:	6a 07                	push   $0x7
+  8011e9:	68 00 f0 7f 00       	push   $0x7ff000
+  8011ee:	6a 00                	push   $0x0
+  8011f0:	e8 04 fb ff ff       	call   800cf9 <sys_page_alloc>
+  8011f5:	83 c4 10             	add    $0x10,%esp
+  8011f8:	85 c0                	test   %eax,%eax
+  8011fa:	78 73                	js     80126f <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  8011fc:	83 ec 04             	sub    $0x4,%esp
+  8011ff:	68 00 10 00 00       	push   $0x1000
+  801204:	53                   	push   %ebx
+  801205:	68 00 f0 7f 00       	push   $0x7ff000
+  80120a:	e8 41 f8 ff ff       	call   800a50 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80120f:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801216:	53                   	push   %ebx
+  801217:	6a 00                	push   $0x0
+  801219:	68 00 f0 7f 00       	push   $0x7ff000
+  80121e:	6a 00                	push   $0x0
+  801220:	e8 17 fb ff ff       	call   800d3c <sys_page_map>
+  801225:	83 c4 20             	add    $0x20,%esp
+  801228:	85 c0                	test   %eax,%eax
+  80122a:	78 55                	js     801281 <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  80122c:	83 ec 08             	sub    $0x8,%esp
+  80122f:	68 00 f0 7f 00       	push   $0x7ff000
+  801234:	6a 00                	push   $0x0
+  801236:	e8 43 fb ff ff       	call   800d7e <sys_page_unmap>
+  80123b:	83 c4 10             	add    $0x10,%esp
+  80123e:	85 c0                	test   %eax,%eax
+  801240:	78 51                	js     801293 <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801242:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801245:	5b                   	pop    %ebx
+  801246:	5e                   	pop    %esi
+  801247:	5d                   	pop    %ebp
+  801248:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  801249:	56                   	push   %esi
+  80124a:	68 6e 46 80 00       	push   $0x80466e
+  80124f:	6a 1d                	push   $0x1d
+  801251:	68 7f 46 80 00       	push   $0x80467f
+  801256:	e8 a6 ef ff ff       	call   800201 <_panic>
+    panic("user_pgfault: page not COW");
+  80125b:	83 ec 04             	sub    $0x4,%esp
+  80125e:	68 8a 46 80 00       	push   $0x80468a
+  801263:	6a 21                	push   $0x21
+  801265:	68 7f 46 80 00       	push   $0x80467f
+  80126a:	e8 92 ef ff ff       	call   800201 <_panic>
+    panic("sys_page_alloc: %e", r);
+  80126f:	50                   	push   %eax
+  801270:	68 6c 42 80 00       	push   $0x80426c
+  801275:	6a 2f                	push   $0x2f
+  801277:	68 7f 46 80 00       	push   $0x80467f
+  80127c:	e8 80 ef ff ff       	call   800201 <_panic>
+    panic("sys_page_map: %e", r);
+  801281:	50                   	push   %eax
+  801282:	68 a5 46 80 00       	push   $0x8046a5
+  801287:	6a 37                	push   $0x37
+  801289:	68 7f 46 80 00       	push   $0x80467f
+  80128e:	e8 6e ef ff ff       	call   800201 <_panic>
+    panic("sys_page_unmap: %e", r);
+  801293:	50                   	push   %eax
+  801294:	68 b6 46 80 00       	push   $0x8046b6
+  801299:	6a 3b                	push   $0x3b
+  80129b:	68 7f 46 80 00       	push   $0x80467f
+  8012a0:	e8 5c ef ff ff       	call   800201 <_panic>
+
+008012a5 <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  8012a5:	55                   	push   %ebp
+  8012a6:	89 e5                	mov    %esp,%ebp
+  8012a8:	53                   	push   %ebx
+  8012a9:	83 ec 10             	sub    $0x10,%esp
+  8012ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  8012af:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  8012b1:	50                   	push   %eax
+  8012b2:	e8 b3 24 00 00       	call   80376a <mmap_fault>
+  8012b7:	83 c4 10             	add    $0x10,%esp
+  8012ba:	84 c0                	test   %al,%al
+  8012bc:	74 05                	je     8012c3 <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  8012be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012c1:	c9                   	leave
+  8012c2:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8012c3:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8012c9:	83 ec 04             	sub    $0x4,%esp
+  8012cc:	6a 07                	push   $0x7
+  8012ce:	68 00 f0 7f 00       	push   $0x7ff000
+  8012d3:	6a 00                	push   $0x0
+  8012d5:	e8 1f fa ff ff       	call   800cf9 <sys_page_alloc>
+  8012da:	83 c4 10             	add    $0x10,%esp
+  8012dd:	85 c0                	test   %eax,%eax
+  8012df:	78 5b                	js     80133c <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  8012e1:	83 ec 04             	sub    $0x4,%esp
+  8012e4:	68 00 10 00 00       	push   $0x1000
+  8012e9:	53                   	push   %ebx
+  8012ea:	68 00 f0 7f 00       	push   $0x7ff000
+  8012ef:	e8 5c f7 ff ff       	call   800a50 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8012f4:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8012fb:	53                   	push   %ebx
+  8012fc:	6a 00                	push   $0x0
+  8012fe:	68 00 f0 7f 00       	push   $0x7ff000
+  801303:	6a 00                	push   $0x0
+  801305:	e8 32 fa ff ff       	call   800d3c <sys_page_map>
+  80130a:	83 c4 20             	add    $0x20,%esp
+  80130d:	85 c0                	test   %eax,%eax
+  80130f:	78 40                	js     801351 <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801311:	83 ec 08             	sub    $0x8,%esp
+  801314:	68 00 f0 7f 00       	push   $0x7ff000
+  801319:	6a 00                	push   $0x0
+  80131b:	e8 5e fa ff ff       	call   800d7e <sys_page_unmap>
+  801320:	83 c4 10             	add    $0x10,%esp
+  801323:	85 c0                	test   %eax,%eax
+  801325:	79 97                	jns    8012be <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  801327:	50                   	push   %eax
+  801328:	68 b6 46 80 00       	push   $0x8046b6
+  80132d:	68 b0 00 00 00       	push   $0xb0
+  801332:	68 7f 46 80 00       	push   $0x80467f
+  801337:	e8 c5 ee ff ff       	call   800201 <_panic>
+    panic("sys_page_alloc: %e", r);
+  80133c:	50                   	push   %eax
+  80133d:	68 6c 42 80 00       	push   $0x80426c
+  801342:	68 a4 00 00 00       	push   $0xa4
+  801347:	68 7f 46 80 00       	push   $0x80467f
+  80134c:	e8 b0 ee ff ff       	call   800201 <_panic>
+    panic("sys_page_map: %e", r);
+  801351:	50                   	push   %eax
+  801352:	68 a5 46 80 00       	push   $0x8046a5
+  801357:	68 ac 00 00 00       	push   $0xac
+  80135c:	68 7f 46 80 00       	push   $0x80467f
+  801361:	e8 9b ee ff ff       	call   800201 <_panic>
+
+00801366 <fork>:
+{
+  801366:	55                   	push   %ebp
+  801367:	89 e5                	mov    %esp,%ebp
+  801369:	53                   	push   %ebx
+  80136a:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  80136d:	e8 06 f9 ff ff       	call   800c78 <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  801372:	83 ec 0c             	sub    $0xc,%esp
+  801375:	68 a8 11 80 00       	push   $0x8011a8
+  80137a:	e8 7a 2a 00 00       	call   803df9 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  80137f:	b8 07 00 00 00       	mov    $0x7,%eax
+  801384:	cd 30                	int    $0x30
+  801386:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  801388:	83 c4 10             	add    $0x10,%esp
+  80138b:	85 c0                	test   %eax,%eax
+  80138d:	78 66                	js     8013f5 <fork+0x8f>
+  } else if (envid == 0) {
+  80138f:	74 76                	je     801407 <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  801391:	83 ec 0c             	sub    $0xc,%esp
+  801394:	6a 01                	push   $0x1
+  801396:	50                   	push   %eax
+  801397:	68 00 f0 bf ee       	push   $0xeebff000
+  80139c:	6a 00                	push   $0x0
+  80139e:	6a 00                	push   $0x0
+  8013a0:	e8 1b fa ff ff       	call   800dc0 <sys_page_map_range>
+  8013a5:	83 c4 20             	add    $0x20,%esp
+  8013a8:	85 c0                	test   %eax,%eax
+  8013aa:	78 77                	js     801423 <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  8013ac:	83 ec 04             	sub    $0x4,%esp
+  8013af:	6a 07                	push   $0x7
+  8013b1:	68 00 f0 bf ee       	push   $0xeebff000
+  8013b6:	53                   	push   %ebx
+  8013b7:	e8 3d f9 ff ff       	call   800cf9 <sys_page_alloc>
+  8013bc:	83 c4 10             	add    $0x10,%esp
+  8013bf:	85 c0                	test   %eax,%eax
+  8013c1:	78 72                	js     801435 <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  8013c3:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  8013c8:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  8013cb:	83 ec 08             	sub    $0x8,%esp
+  8013ce:	50                   	push   %eax
+  8013cf:	53                   	push   %ebx
+  8013d0:	e8 99 fb ff ff       	call   800f6e <sys_env_set_pgfault_upcall>
+  8013d5:	83 c4 10             	add    $0x10,%esp
+  8013d8:	85 c0                	test   %eax,%eax
+  8013da:	78 6b                	js     801447 <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8013dc:	83 ec 08             	sub    $0x8,%esp
+  8013df:	6a 02                	push   $0x2
+  8013e1:	53                   	push   %ebx
+  8013e2:	e8 03 fb ff ff       	call   800eea <sys_env_set_status>
+  8013e7:	83 c4 10             	add    $0x10,%esp
+  8013ea:	85 c0                	test   %eax,%eax
+  8013ec:	78 6b                	js     801459 <fork+0xf3>
+}
+  8013ee:	89 d8                	mov    %ebx,%eax
+  8013f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013f3:	c9                   	leave
+  8013f4:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8013f5:	50                   	push   %eax
+  8013f6:	68 c9 46 80 00       	push   $0x8046c9
+  8013fb:	6a 5e                	push   $0x5e
+  8013fd:	68 7f 46 80 00       	push   $0x80467f
+  801402:	e8 fa ed ff ff       	call   800201 <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801407:	e8 6c f8 ff ff       	call   800c78 <sys_getenvid>
+  80140c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801411:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801414:	c1 e0 04             	shl    $0x4,%eax
+  801417:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80141c:	a3 c0 6f 80 00       	mov    %eax,0x806fc0
+    return 0;
+  801421:	eb cb                	jmp    8013ee <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  801423:	50                   	push   %eax
+  801424:	68 d9 46 80 00       	push   $0x8046d9
+  801429:	6a 69                	push   $0x69
+  80142b:	68 7f 46 80 00       	push   $0x80467f
+  801430:	e8 cc ed ff ff       	call   800201 <_panic>
+    panic("sys_page_alloc: %e", error);
+  801435:	50                   	push   %eax
+  801436:	68 6c 42 80 00       	push   $0x80426c
+  80143b:	6a 70                	push   $0x70
+  80143d:	68 7f 46 80 00       	push   $0x80467f
+  801442:	e8 ba ed ff ff       	call   800201 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801447:	50                   	push   %eax
+  801448:	68 08 47 80 00       	push   $0x804708
+  80144d:	6a 76                	push   $0x76
+  80144f:	68 7f 46 80 00       	push   $0x80467f
+  801454:	e8 a8 ed ff ff       	call   800201 <_panic>
+    panic("sys_env_set_status: %e", error);
+  801459:	50                   	push   %eax
+  80145a:	68 f0 46 80 00       	push   $0x8046f0
+  80145f:	6a 7a                	push   $0x7a
+  801461:	68 7f 46 80 00       	push   $0x80467f
+  801466:	e8 96 ed ff ff       	call   800201 <_panic>
+
+0080146b <kfork>:
+{
+  80146b:	55                   	push   %ebp
+  80146c:	89 e5                	mov    %esp,%ebp
+  80146e:	53                   	push   %ebx
+  80146f:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  801472:	68 a8 11 80 00       	push   $0x8011a8
+  801477:	e8 7d 29 00 00       	call   803df9 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  80147c:	e8 4a fa ff ff       	call   800ecb <sys_fork>
+  801481:	89 c3                	mov    %eax,%ebx
+  801483:	83 c4 10             	add    $0x10,%esp
+  801486:	85 c0                	test   %eax,%eax
+  801488:	74 07                	je     801491 <kfork+0x26>
+}
+  80148a:	89 d8                	mov    %ebx,%eax
+  80148c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80148f:	c9                   	leave
+  801490:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801491:	e8 e2 f7 ff ff       	call   800c78 <sys_getenvid>
+  801496:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80149b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80149e:	c1 e0 04             	shl    $0x4,%eax
+  8014a1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014a6:	a3 c0 6f 80 00       	mov    %eax,0x806fc0
+  return envid;
+  8014ab:	eb dd                	jmp    80148a <kfork+0x1f>
+
+008014ad <sfork>:
+
+int
+sfork(void)
+{
+  8014ad:	55                   	push   %ebp
+  8014ae:	89 e5                	mov    %esp,%ebp
+  8014b0:	53                   	push   %ebx
+  8014b1:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  8014b4:	e8 bf f7 ff ff       	call   800c78 <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  8014b9:	83 ec 0c             	sub    $0xc,%esp
+  8014bc:	68 a5 12 80 00       	push   $0x8012a5
+  8014c1:	e8 33 29 00 00       	call   803df9 <set_pgfault_handler>
+  8014c6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8014cb:	cd 30                	int    $0x30
+  8014cd:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  8014cf:	83 c4 10             	add    $0x10,%esp
+  8014d2:	85 c0                	test   %eax,%eax
+  8014d4:	78 09                	js     8014df <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  8014d6:	75 1c                	jne    8014f4 <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  8014d8:	89 d8                	mov    %ebx,%eax
+  8014da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014dd:	c9                   	leave
+  8014de:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8014df:	50                   	push   %eax
+  8014e0:	68 c9 46 80 00       	push   $0x8046c9
+  8014e5:	68 c3 00 00 00       	push   $0xc3
+  8014ea:	68 7f 46 80 00       	push   $0x80467f
+  8014ef:	e8 0d ed ff ff       	call   800201 <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  8014f4:	83 ec 0c             	sub    $0xc,%esp
+  8014f7:	6a 00                	push   $0x0
+  8014f9:	50                   	push   %eax
+  8014fa:	68 00 d0 bf ee       	push   $0xeebfd000
+  8014ff:	6a 00                	push   $0x0
+  801501:	6a 00                	push   $0x0
+  801503:	e8 b8 f8 ff ff       	call   800dc0 <sys_page_map_range>
+  801508:	83 c4 20             	add    $0x20,%esp
+  80150b:	85 c0                	test   %eax,%eax
+  80150d:	78 79                	js     801588 <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  80150f:	83 ec 0c             	sub    $0xc,%esp
+  801512:	6a 01                	push   $0x1
+  801514:	53                   	push   %ebx
+  801515:	68 00 10 00 00       	push   $0x1000
+  80151a:	68 00 d0 bf ee       	push   $0xeebfd000
+  80151f:	6a 00                	push   $0x0
+  801521:	e8 9a f8 ff ff       	call   800dc0 <sys_page_map_range>
+  801526:	83 c4 20             	add    $0x20,%esp
+  801529:	85 c0                	test   %eax,%eax
+  80152b:	78 70                	js     80159d <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  80152d:	83 ec 04             	sub    $0x4,%esp
+  801530:	6a 07                	push   $0x7
+  801532:	68 00 f0 bf ee       	push   $0xeebff000
+  801537:	53                   	push   %ebx
+  801538:	e8 bc f7 ff ff       	call   800cf9 <sys_page_alloc>
+  80153d:	83 c4 10             	add    $0x10,%esp
+  801540:	85 c0                	test   %eax,%eax
+  801542:	78 6e                	js     8015b2 <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  801544:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  801549:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  80154c:	83 ec 08             	sub    $0x8,%esp
+  80154f:	50                   	push   %eax
+  801550:	53                   	push   %ebx
+  801551:	e8 18 fa ff ff       	call   800f6e <sys_env_set_pgfault_upcall>
+  801556:	83 c4 10             	add    $0x10,%esp
+  801559:	85 c0                	test   %eax,%eax
+  80155b:	78 6a                	js     8015c7 <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80155d:	83 ec 08             	sub    $0x8,%esp
+  801560:	6a 02                	push   $0x2
+  801562:	53                   	push   %ebx
+  801563:	e8 82 f9 ff ff       	call   800eea <sys_env_set_status>
+  801568:	83 c4 10             	add    $0x10,%esp
+  80156b:	85 c0                	test   %eax,%eax
+  80156d:	0f 89 65 ff ff ff    	jns    8014d8 <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  801573:	50                   	push   %eax
+  801574:	68 f0 46 80 00       	push   $0x8046f0
+  801579:	68 e4 00 00 00       	push   $0xe4
+  80157e:	68 7f 46 80 00       	push   $0x80467f
+  801583:	e8 79 ec ff ff       	call   800201 <_panic>
+    panic("sys_page_map_range: %e", error);
+  801588:	50                   	push   %eax
+  801589:	68 d9 46 80 00       	push   $0x8046d9
+  80158e:	68 ce 00 00 00       	push   $0xce
+  801593:	68 7f 46 80 00       	push   $0x80467f
+  801598:	e8 64 ec ff ff       	call   800201 <_panic>
+    panic("sys_page_map_range: %e", error);
+  80159d:	50                   	push   %eax
+  80159e:	68 d9 46 80 00       	push   $0x8046d9
+  8015a3:	68 d3 00 00 00       	push   $0xd3
+  8015a8:	68 7f 46 80 00       	push   $0x80467f
+  8015ad:	e8 4f ec ff ff       	call   800201 <_panic>
+    panic("sys_page_alloc: %e", error);
+  8015b2:	50                   	push   %eax
+  8015b3:	68 6c 42 80 00       	push   $0x80426c
+  8015b8:	68 da 00 00 00       	push   $0xda
+  8015bd:	68 7f 46 80 00       	push   $0x80467f
+  8015c2:	e8 3a ec ff ff       	call   800201 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  8015c7:	50                   	push   %eax
+  8015c8:	68 08 47 80 00       	push   $0x804708
+  8015cd:	68 e0 00 00 00       	push   $0xe0
+  8015d2:	68 7f 46 80 00       	push   $0x80467f
+  8015d7:	e8 25 ec ff ff       	call   800201 <_panic>
+
+008015dc <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8015dc:	55                   	push   %ebp
+  8015dd:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8015df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e2:	05 00 00 00 30       	add    $0x30000000,%eax
+  8015e7:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8015ea:	5d                   	pop    %ebp
+  8015eb:	c3                   	ret
+
+008015ec <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8015ec:	55                   	push   %ebp
+  8015ed:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8015ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015f2:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8015f5:	66 b8 00 00          	mov    $0x0,%ax
+  8015f9:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8015fe:	5d                   	pop    %ebp
+  8015ff:	c3                   	ret
+
+00801600 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801600:	55                   	push   %ebp
+  801601:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801603:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801608:	eb 02                	jmp    80160c <fd_alloc+0xc>
+  80160a:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80160c:	89 c2                	mov    %eax,%edx
+  80160e:	c1 ea 16             	shr    $0x16,%edx
+  801611:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801618:	f6 c2 01             	test   $0x1,%dl
+  80161b:	74 2b                	je     801648 <fd_alloc+0x48>
+  80161d:	89 c2                	mov    %eax,%edx
+  80161f:	c1 ea 0c             	shr    $0xc,%edx
+  801622:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801629:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80162f:	f6 c1 01             	test   $0x1,%cl
+  801632:	74 14                	je     801648 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801634:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80163a:	75 ce                	jne    80160a <fd_alloc+0xa>
+  80163c:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801641:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801646:	eb 05                	jmp    80164d <fd_alloc+0x4d>
+      return 0;
+  801648:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  80164d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801650:	89 02                	mov    %eax,(%edx)
+}
+  801652:	89 c8                	mov    %ecx,%eax
+  801654:	5d                   	pop    %ebp
+  801655:	c3                   	ret
+
+00801656 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801656:	55                   	push   %ebp
+  801657:	89 e5                	mov    %esp,%ebp
+  801659:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80165c:	83 f8 1f             	cmp    $0x1f,%eax
+  80165f:	77 30                	ja     801691 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801661:	c1 e0 0c             	shl    $0xc,%eax
+  801664:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801669:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80166f:	f6 c2 01             	test   $0x1,%dl
+  801672:	74 24                	je     801698 <fd_lookup+0x42>
+  801674:	89 c2                	mov    %eax,%edx
+  801676:	c1 ea 0c             	shr    $0xc,%edx
+  801679:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801680:	f6 c2 01             	test   $0x1,%dl
+  801683:	74 1a                	je     80169f <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801685:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801688:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80168a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80168f:	5d                   	pop    %ebp
+  801690:	c3                   	ret
+    return -E_INVAL;
+  801691:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801696:	eb f7                	jmp    80168f <fd_lookup+0x39>
+    return -E_INVAL;
+  801698:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80169d:	eb f0                	jmp    80168f <fd_lookup+0x39>
+  80169f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016a4:	eb e9                	jmp    80168f <fd_lookup+0x39>
+
+008016a6 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8016a6:	55                   	push   %ebp
+  8016a7:	89 e5                	mov    %esp,%ebp
+  8016a9:	53                   	push   %ebx
+  8016aa:	83 ec 04             	sub    $0x4,%esp
+  8016ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8016b0:	b8 a4 47 80 00       	mov    $0x8047a4,%eax
+  8016b5:	8b 18                	mov    (%eax),%ebx
+  8016b7:	85 db                	test   %ebx,%ebx
+  8016b9:	74 0e                	je     8016c9 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8016bb:	83 c0 04             	add    $0x4,%eax
+  8016be:	39 13                	cmp    %edx,(%ebx)
+  8016c0:	75 f3                	jne    8016b5 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8016c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c7:	eb 1f                	jmp    8016e8 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8016c9:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  8016ce:	8b 40 48             	mov    0x48(%eax),%eax
+  8016d1:	83 ec 04             	sub    $0x4,%esp
+  8016d4:	52                   	push   %edx
+  8016d5:	50                   	push   %eax
+  8016d6:	68 28 47 80 00       	push   $0x804728
+  8016db:	e8 fc eb ff ff       	call   8002dc <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8016e0:	83 c4 10             	add    $0x10,%esp
+  8016e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8016e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016eb:	89 1a                	mov    %ebx,(%edx)
+}
+  8016ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016f0:	c9                   	leave
+  8016f1:	c3                   	ret
+
+008016f2 <fd_close>:
+{
+  8016f2:	55                   	push   %ebp
+  8016f3:	89 e5                	mov    %esp,%ebp
+  8016f5:	57                   	push   %edi
+  8016f6:	56                   	push   %esi
+  8016f7:	53                   	push   %ebx
+  8016f8:	83 ec 24             	sub    $0x24,%esp
+  8016fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8016fe:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801701:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801704:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801705:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80170b:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80170e:	50                   	push   %eax
+  80170f:	e8 42 ff ff ff       	call   801656 <fd_lookup>
+  801714:	89 c3                	mov    %eax,%ebx
+  801716:	83 c4 10             	add    $0x10,%esp
+  801719:	85 c0                	test   %eax,%eax
+  80171b:	78 05                	js     801722 <fd_close+0x30>
+      || fd != fd2)
+  80171d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801720:	74 16                	je     801738 <fd_close+0x46>
+    return must_exist ? r : 0;
+  801722:	89 f8                	mov    %edi,%eax
+  801724:	84 c0                	test   %al,%al
+  801726:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80172e:	89 d8                	mov    %ebx,%eax
+  801730:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801733:	5b                   	pop    %ebx
+  801734:	5e                   	pop    %esi
+  801735:	5f                   	pop    %edi
+  801736:	5d                   	pop    %ebp
+  801737:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801738:	83 ec 08             	sub    $0x8,%esp
+  80173b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80173e:	50                   	push   %eax
+  80173f:	ff 36                	push   (%esi)
+  801741:	e8 60 ff ff ff       	call   8016a6 <dev_lookup>
+  801746:	89 c3                	mov    %eax,%ebx
+  801748:	83 c4 10             	add    $0x10,%esp
+  80174b:	85 c0                	test   %eax,%eax
+  80174d:	78 1a                	js     801769 <fd_close+0x77>
+    if (dev->dev_close)
+  80174f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801752:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801755:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  80175a:	85 c0                	test   %eax,%eax
+  80175c:	74 0b                	je     801769 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  80175e:	83 ec 0c             	sub    $0xc,%esp
+  801761:	56                   	push   %esi
+  801762:	ff d0                	call   *%eax
+  801764:	89 c3                	mov    %eax,%ebx
+  801766:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801769:	83 ec 08             	sub    $0x8,%esp
+  80176c:	56                   	push   %esi
+  80176d:	6a 00                	push   $0x0
+  80176f:	e8 0a f6 ff ff       	call   800d7e <sys_page_unmap>
+  return r;
+  801774:	83 c4 10             	add    $0x10,%esp
+  801777:	eb b5                	jmp    80172e <fd_close+0x3c>
+
+00801779 <close>:
+
+int
+close(int fdnum)
+{
+  801779:	55                   	push   %ebp
+  80177a:	89 e5                	mov    %esp,%ebp
+  80177c:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80177f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801782:	50                   	push   %eax
+  801783:	ff 75 08             	push   0x8(%ebp)
+  801786:	e8 cb fe ff ff       	call   801656 <fd_lookup>
+  80178b:	83 c4 10             	add    $0x10,%esp
+  80178e:	85 c0                	test   %eax,%eax
+  801790:	79 02                	jns    801794 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801792:	c9                   	leave
+  801793:	c3                   	ret
+    return fd_close(fd, 1);
+  801794:	83 ec 08             	sub    $0x8,%esp
+  801797:	6a 01                	push   $0x1
+  801799:	ff 75 f4             	push   -0xc(%ebp)
+  80179c:	e8 51 ff ff ff       	call   8016f2 <fd_close>
+  8017a1:	83 c4 10             	add    $0x10,%esp
+  8017a4:	eb ec                	jmp    801792 <close+0x19>
+
+008017a6 <close_all>:
+
+void
+close_all(void)
+{
+  8017a6:	55                   	push   %ebp
+  8017a7:	89 e5                	mov    %esp,%ebp
+  8017a9:	53                   	push   %ebx
+  8017aa:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8017ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8017b2:	83 ec 0c             	sub    $0xc,%esp
+  8017b5:	53                   	push   %ebx
+  8017b6:	e8 be ff ff ff       	call   801779 <close>
+  for (i = 0; i < MAXFD; i++)
+  8017bb:	83 c3 01             	add    $0x1,%ebx
+  8017be:	83 c4 10             	add    $0x10,%esp
+  8017c1:	83 fb 20             	cmp    $0x20,%ebx
+  8017c4:	75 ec                	jne    8017b2 <close_all+0xc>
+}
+  8017c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017c9:	c9                   	leave
+  8017ca:	c3                   	ret
+
+008017cb <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8017cb:	55                   	push   %ebp
+  8017cc:	89 e5                	mov    %esp,%ebp
+  8017ce:	57                   	push   %edi
+  8017cf:	56                   	push   %esi
+  8017d0:	53                   	push   %ebx
+  8017d1:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8017d4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017d7:	50                   	push   %eax
+  8017d8:	ff 75 08             	push   0x8(%ebp)
+  8017db:	e8 76 fe ff ff       	call   801656 <fd_lookup>
+  8017e0:	89 c6                	mov    %eax,%esi
+  8017e2:	83 c4 10             	add    $0x10,%esp
+  8017e5:	85 c0                	test   %eax,%eax
+  8017e7:	0f 88 0a 01 00 00    	js     8018f7 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8017ed:	83 ec 0c             	sub    $0xc,%esp
+  8017f0:	ff 75 0c             	push   0xc(%ebp)
+  8017f3:	e8 81 ff ff ff       	call   801779 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8017f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017fb:	c1 e0 0c             	shl    $0xc,%eax
+  8017fe:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801804:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801807:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80180a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80180d:	89 04 24             	mov    %eax,(%esp)
+  801810:	e8 d7 fd ff ff       	call   8015ec <fd2data>
+  801815:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801817:	89 3c 24             	mov    %edi,(%esp)
+  80181a:	e8 cd fd ff ff       	call   8015ec <fd2data>
+  80181f:	83 c4 10             	add    $0x10,%esp
+  801822:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801825:	89 f3                	mov    %esi,%ebx
+  801827:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  80182d:	89 c6                	mov    %eax,%esi
+  80182f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801832:	89 cf                	mov    %ecx,%edi
+  801834:	eb 0c                	jmp    801842 <dup+0x77>
+  801836:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80183c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801842:	39 fb                	cmp    %edi,%ebx
+  801844:	74 7b                	je     8018c1 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801846:	89 d8                	mov    %ebx,%eax
+  801848:	c1 e8 16             	shr    $0x16,%eax
+  80184b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801852:	a8 01                	test   $0x1,%al
+  801854:	74 e0                	je     801836 <dup+0x6b>
+  801856:	89 d8                	mov    %ebx,%eax
+  801858:	c1 e8 0c             	shr    $0xc,%eax
+  80185b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801862:	f6 c2 01             	test   $0x1,%dl
+  801865:	74 cf                	je     801836 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801867:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  80186e:	83 ec 0c             	sub    $0xc,%esp
+  801871:	25 07 0e 00 00       	and    $0xe07,%eax
+  801876:	50                   	push   %eax
+  801877:	56                   	push   %esi
+  801878:	6a 00                	push   $0x0
+  80187a:	53                   	push   %ebx
+  80187b:	6a 00                	push   $0x0
+  80187d:	e8 ba f4 ff ff       	call   800d3c <sys_page_map>
+  801882:	83 c4 20             	add    $0x20,%esp
+  801885:	85 c0                	test   %eax,%eax
+  801887:	79 ad                	jns    801836 <dup+0x6b>
+  801889:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80188c:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  80188e:	83 ec 08             	sub    $0x8,%esp
+  801891:	ff 75 d4             	push   -0x2c(%ebp)
+  801894:	6a 00                	push   $0x0
+  801896:	e8 e3 f4 ff ff       	call   800d7e <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80189b:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80189e:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8018a4:	83 c4 10             	add    $0x10,%esp
+  8018a7:	39 df                	cmp    %ebx,%edi
+  8018a9:	74 4c                	je     8018f7 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8018ab:	83 ec 08             	sub    $0x8,%esp
+  8018ae:	57                   	push   %edi
+  8018af:	6a 00                	push   $0x0
+  8018b1:	e8 c8 f4 ff ff       	call   800d7e <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8018b6:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8018bc:	83 c4 10             	add    $0x10,%esp
+  8018bf:	eb e6                	jmp    8018a7 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8018c1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018c4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8018c7:	89 c8                	mov    %ecx,%eax
+  8018c9:	c1 e8 0c             	shr    $0xc,%eax
+  8018cc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018d3:	83 ec 0c             	sub    $0xc,%esp
+  8018d6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018db:	50                   	push   %eax
+  8018dc:	ff 75 d4             	push   -0x2c(%ebp)
+  8018df:	6a 00                	push   $0x0
+  8018e1:	51                   	push   %ecx
+  8018e2:	6a 00                	push   $0x0
+  8018e4:	e8 53 f4 ff ff       	call   800d3c <sys_page_map>
+  8018e9:	89 c6                	mov    %eax,%esi
+  8018eb:	83 c4 20             	add    $0x20,%esp
+  8018ee:	85 c0                	test   %eax,%eax
+  8018f0:	78 9c                	js     80188e <dup+0xc3>
+  return newfdnum;
+  8018f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018f5:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8018f7:	89 f0                	mov    %esi,%eax
+  8018f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018fc:	5b                   	pop    %ebx
+  8018fd:	5e                   	pop    %esi
+  8018fe:	5f                   	pop    %edi
+  8018ff:	5d                   	pop    %ebp
+  801900:	c3                   	ret
+
+00801901 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801901:	55                   	push   %ebp
+  801902:	89 e5                	mov    %esp,%ebp
+  801904:	56                   	push   %esi
+  801905:	53                   	push   %ebx
+  801906:	83 ec 18             	sub    $0x18,%esp
+  801909:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80190c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80190f:	50                   	push   %eax
+  801910:	56                   	push   %esi
+  801911:	e8 40 fd ff ff       	call   801656 <fd_lookup>
+  801916:	83 c4 10             	add    $0x10,%esp
+  801919:	85 c0                	test   %eax,%eax
+  80191b:	78 3c                	js     801959 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80191d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801920:	83 ec 08             	sub    $0x8,%esp
+  801923:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801926:	50                   	push   %eax
+  801927:	ff 33                	push   (%ebx)
+  801929:	e8 78 fd ff ff       	call   8016a6 <dev_lookup>
+  80192e:	83 c4 10             	add    $0x10,%esp
+  801931:	85 c0                	test   %eax,%eax
+  801933:	78 24                	js     801959 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801935:	8b 43 08             	mov    0x8(%ebx),%eax
+  801938:	83 e0 03             	and    $0x3,%eax
+  80193b:	83 f8 01             	cmp    $0x1,%eax
+  80193e:	74 20                	je     801960 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801940:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801943:	8b 40 08             	mov    0x8(%eax),%eax
+  801946:	85 c0                	test   %eax,%eax
+  801948:	74 37                	je     801981 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  80194a:	83 ec 04             	sub    $0x4,%esp
+  80194d:	ff 75 10             	push   0x10(%ebp)
+  801950:	ff 75 0c             	push   0xc(%ebp)
+  801953:	53                   	push   %ebx
+  801954:	ff d0                	call   *%eax
+  801956:	83 c4 10             	add    $0x10,%esp
+}
+  801959:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80195c:	5b                   	pop    %ebx
+  80195d:	5e                   	pop    %esi
+  80195e:	5d                   	pop    %ebp
+  80195f:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801960:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  801965:	8b 40 48             	mov    0x48(%eax),%eax
+  801968:	83 ec 04             	sub    $0x4,%esp
+  80196b:	56                   	push   %esi
+  80196c:	50                   	push   %eax
+  80196d:	68 69 47 80 00       	push   $0x804769
+  801972:	e8 65 e9 ff ff       	call   8002dc <cprintf>
+    return -E_INVAL;
+  801977:	83 c4 10             	add    $0x10,%esp
+  80197a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80197f:	eb d8                	jmp    801959 <read+0x58>
+    return -E_NOT_SUPP;
+  801981:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801986:	eb d1                	jmp    801959 <read+0x58>
+
+00801988 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801988:	55                   	push   %ebp
+  801989:	89 e5                	mov    %esp,%ebp
+  80198b:	57                   	push   %edi
+  80198c:	56                   	push   %esi
+  80198d:	53                   	push   %ebx
+  80198e:	83 ec 0c             	sub    $0xc,%esp
+  801991:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801994:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801997:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80199c:	eb 02                	jmp    8019a0 <readn+0x18>
+  80199e:	01 c3                	add    %eax,%ebx
+  8019a0:	39 f3                	cmp    %esi,%ebx
+  8019a2:	73 21                	jae    8019c5 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8019a4:	83 ec 04             	sub    $0x4,%esp
+  8019a7:	89 f0                	mov    %esi,%eax
+  8019a9:	29 d8                	sub    %ebx,%eax
+  8019ab:	50                   	push   %eax
+  8019ac:	89 d8                	mov    %ebx,%eax
+  8019ae:	03 45 0c             	add    0xc(%ebp),%eax
+  8019b1:	50                   	push   %eax
+  8019b2:	57                   	push   %edi
+  8019b3:	e8 49 ff ff ff       	call   801901 <read>
+    if (m < 0)
+  8019b8:	83 c4 10             	add    $0x10,%esp
+  8019bb:	85 c0                	test   %eax,%eax
+  8019bd:	78 04                	js     8019c3 <readn+0x3b>
+      return m;
+    if (m == 0)
+  8019bf:	75 dd                	jne    80199e <readn+0x16>
+  8019c1:	eb 02                	jmp    8019c5 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8019c3:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8019c5:	89 d8                	mov    %ebx,%eax
+  8019c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ca:	5b                   	pop    %ebx
+  8019cb:	5e                   	pop    %esi
+  8019cc:	5f                   	pop    %edi
+  8019cd:	5d                   	pop    %ebp
+  8019ce:	c3                   	ret
+
+008019cf <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8019cf:	55                   	push   %ebp
+  8019d0:	89 e5                	mov    %esp,%ebp
+  8019d2:	56                   	push   %esi
+  8019d3:	53                   	push   %ebx
+  8019d4:	83 ec 18             	sub    $0x18,%esp
+  8019d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019da:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019dd:	50                   	push   %eax
+  8019de:	53                   	push   %ebx
+  8019df:	e8 72 fc ff ff       	call   801656 <fd_lookup>
+  8019e4:	83 c4 10             	add    $0x10,%esp
+  8019e7:	85 c0                	test   %eax,%eax
+  8019e9:	78 37                	js     801a22 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019eb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019ee:	83 ec 08             	sub    $0x8,%esp
+  8019f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019f4:	50                   	push   %eax
+  8019f5:	ff 36                	push   (%esi)
+  8019f7:	e8 aa fc ff ff       	call   8016a6 <dev_lookup>
+  8019fc:	83 c4 10             	add    $0x10,%esp
+  8019ff:	85 c0                	test   %eax,%eax
+  801a01:	78 1f                	js     801a22 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a03:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a07:	74 20                	je     801a29 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801a09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a0c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a0f:	85 c0                	test   %eax,%eax
+  801a11:	74 37                	je     801a4a <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801a13:	83 ec 04             	sub    $0x4,%esp
+  801a16:	ff 75 10             	push   0x10(%ebp)
+  801a19:	ff 75 0c             	push   0xc(%ebp)
+  801a1c:	56                   	push   %esi
+  801a1d:	ff d0                	call   *%eax
+  801a1f:	83 c4 10             	add    $0x10,%esp
+}
+  801a22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a25:	5b                   	pop    %ebx
+  801a26:	5e                   	pop    %esi
+  801a27:	5d                   	pop    %ebp
+  801a28:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a29:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  801a2e:	8b 40 48             	mov    0x48(%eax),%eax
+  801a31:	83 ec 04             	sub    $0x4,%esp
+  801a34:	53                   	push   %ebx
+  801a35:	50                   	push   %eax
+  801a36:	68 85 47 80 00       	push   $0x804785
+  801a3b:	e8 9c e8 ff ff       	call   8002dc <cprintf>
+    return -E_INVAL;
+  801a40:	83 c4 10             	add    $0x10,%esp
+  801a43:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a48:	eb d8                	jmp    801a22 <write+0x53>
+    return -E_NOT_SUPP;
+  801a4a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a4f:	eb d1                	jmp    801a22 <write+0x53>
+
+00801a51 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801a51:	55                   	push   %ebp
+  801a52:	89 e5                	mov    %esp,%ebp
+  801a54:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a5a:	50                   	push   %eax
+  801a5b:	ff 75 08             	push   0x8(%ebp)
+  801a5e:	e8 f3 fb ff ff       	call   801656 <fd_lookup>
+  801a63:	83 c4 10             	add    $0x10,%esp
+  801a66:	85 c0                	test   %eax,%eax
+  801a68:	78 0e                	js     801a78 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801a6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a70:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801a73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a78:	c9                   	leave
+  801a79:	c3                   	ret
+
+00801a7a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801a7a:	55                   	push   %ebp
+  801a7b:	89 e5                	mov    %esp,%ebp
+  801a7d:	56                   	push   %esi
+  801a7e:	53                   	push   %ebx
+  801a7f:	83 ec 18             	sub    $0x18,%esp
+  801a82:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a85:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a88:	50                   	push   %eax
+  801a89:	53                   	push   %ebx
+  801a8a:	e8 c7 fb ff ff       	call   801656 <fd_lookup>
+  801a8f:	83 c4 10             	add    $0x10,%esp
+  801a92:	85 c0                	test   %eax,%eax
+  801a94:	78 34                	js     801aca <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a96:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a99:	83 ec 08             	sub    $0x8,%esp
+  801a9c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a9f:	50                   	push   %eax
+  801aa0:	ff 36                	push   (%esi)
+  801aa2:	e8 ff fb ff ff       	call   8016a6 <dev_lookup>
+  801aa7:	83 c4 10             	add    $0x10,%esp
+  801aaa:	85 c0                	test   %eax,%eax
+  801aac:	78 1c                	js     801aca <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801aae:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ab2:	74 1d                	je     801ad1 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801ab4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ab7:	8b 40 18             	mov    0x18(%eax),%eax
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	74 34                	je     801af2 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801abe:	83 ec 08             	sub    $0x8,%esp
+  801ac1:	ff 75 0c             	push   0xc(%ebp)
+  801ac4:	56                   	push   %esi
+  801ac5:	ff d0                	call   *%eax
+  801ac7:	83 c4 10             	add    $0x10,%esp
+}
+  801aca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801acd:	5b                   	pop    %ebx
+  801ace:	5e                   	pop    %esi
+  801acf:	5d                   	pop    %ebp
+  801ad0:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801ad1:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  801ad6:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ad9:	83 ec 04             	sub    $0x4,%esp
+  801adc:	53                   	push   %ebx
+  801add:	50                   	push   %eax
+  801ade:	68 48 47 80 00       	push   $0x804748
+  801ae3:	e8 f4 e7 ff ff       	call   8002dc <cprintf>
+    return -E_INVAL;
+  801ae8:	83 c4 10             	add    $0x10,%esp
+  801aeb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801af0:	eb d8                	jmp    801aca <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801af2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801af7:	eb d1                	jmp    801aca <ftruncate+0x50>
+
+00801af9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801af9:	55                   	push   %ebp
+  801afa:	89 e5                	mov    %esp,%ebp
+  801afc:	56                   	push   %esi
+  801afd:	53                   	push   %ebx
+  801afe:	83 ec 18             	sub    $0x18,%esp
+  801b01:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b04:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b07:	50                   	push   %eax
+  801b08:	ff 75 08             	push   0x8(%ebp)
+  801b0b:	e8 46 fb ff ff       	call   801656 <fd_lookup>
+  801b10:	83 c4 10             	add    $0x10,%esp
+  801b13:	85 c0                	test   %eax,%eax
+  801b15:	78 49                	js     801b60 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b17:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b1a:	83 ec 08             	sub    $0x8,%esp
+  801b1d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b20:	50                   	push   %eax
+  801b21:	ff 36                	push   (%esi)
+  801b23:	e8 7e fb ff ff       	call   8016a6 <dev_lookup>
+  801b28:	83 c4 10             	add    $0x10,%esp
+  801b2b:	85 c0                	test   %eax,%eax
+  801b2d:	78 31                	js     801b60 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801b2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b32:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b36:	74 2f                	je     801b67 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801b38:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801b3b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b42:	00 00 00 
+  stat->st_isdir = 0;
+  801b45:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b4c:	00 00 00 
+  stat->st_dev = dev;
+  801b4f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801b55:	83 ec 08             	sub    $0x8,%esp
+  801b58:	53                   	push   %ebx
+  801b59:	56                   	push   %esi
+  801b5a:	ff 50 14             	call   *0x14(%eax)
+  801b5d:	83 c4 10             	add    $0x10,%esp
+}
+  801b60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b63:	5b                   	pop    %ebx
+  801b64:	5e                   	pop    %esi
+  801b65:	5d                   	pop    %ebp
+  801b66:	c3                   	ret
+    return -E_NOT_SUPP;
+  801b67:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b6c:	eb f2                	jmp    801b60 <fstat+0x67>
+
+00801b6e <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801b6e:	55                   	push   %ebp
+  801b6f:	89 e5                	mov    %esp,%ebp
+  801b71:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801b74:	ff 75 0c             	push   0xc(%ebp)
+  801b77:	ff 75 08             	push   0x8(%ebp)
+  801b7a:	e8 58 07 00 00       	call   8022d7 <file_stat>
+}
+  801b7f:	c9                   	leave
+  801b80:	c3                   	ret
+
+00801b81 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801b81:	55                   	push   %ebp
+  801b82:	89 e5                	mov    %esp,%ebp
+  801b84:	57                   	push   %edi
+  801b85:	56                   	push   %esi
+  801b86:	53                   	push   %ebx
+  801b87:	83 ec 1c             	sub    $0x1c,%esp
+  801b8a:	89 c7                	mov    %eax,%edi
+  801b8c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b8f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801b92:	e9 a2 00 00 00       	jmp    801c39 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801b97:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801b9e:	00 00 00 
+  801ba1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ba6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801bab:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801bb0:	be 01 00 00 00       	mov    $0x1,%esi
+  801bb5:	eb 0f                	jmp    801bc6 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801bb7:	83 c0 01             	add    $0x1,%eax
+  801bba:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801bbf:	74 49                	je     801c0a <fsipc_send+0x89>
+  801bc1:	83 f9 07             	cmp    $0x7,%ecx
+  801bc4:	7f 50                	jg     801c16 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801bc6:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801bc9:	c1 e2 04             	shl    $0x4,%edx
+  801bcc:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801bd2:	8b 52 50             	mov    0x50(%edx),%edx
+  801bd5:	83 fa 01             	cmp    $0x1,%edx
+  801bd8:	75 dd                	jne    801bb7 <fsipc_send+0x36>
+  801bda:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801bdd:	c1 e2 04             	shl    $0x4,%edx
+  801be0:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801be6:	8b 52 54             	mov    0x54(%edx),%edx
+  801be9:	85 d2                	test   %edx,%edx
+  801beb:	74 ca                	je     801bb7 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801bed:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801bf0:	c1 e2 04             	shl    $0x4,%edx
+  801bf3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801bf9:	8b 52 48             	mov    0x48(%edx),%edx
+  801bfc:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801c03:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801c06:	89 f3                	mov    %esi,%ebx
+  801c08:	eb ad                	jmp    801bb7 <fsipc_send+0x36>
+  801c0a:	84 db                	test   %bl,%bl
+  801c0c:	74 38                	je     801c46 <fsipc_send+0xc5>
+  801c0e:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801c14:	eb 30                	jmp    801c46 <fsipc_send+0xc5>
+  801c16:	84 db                	test   %bl,%bl
+  801c18:	74 2c                	je     801c46 <fsipc_send+0xc5>
+  801c1a:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801c20:	eb 24                	jmp    801c46 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801c22:	50                   	push   %eax
+  801c23:	68 b4 47 80 00       	push   $0x8047b4
+  801c28:	6a 34                	push   $0x34
+  801c2a:	68 be 47 80 00       	push   $0x8047be
+  801c2f:	e8 cd e5 ff ff       	call   800201 <_panic>
+    }
+    sys_yield();
+  801c34:	e8 5e f0 ff ff       	call   800c97 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801c39:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801c40:	0f 8e 51 ff ff ff    	jle    801b97 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801c46:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  801c4b:	8b 70 48             	mov    0x48(%eax),%esi
+  801c4e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801c54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c59:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801c5f:	39 d9                	cmp    %ebx,%ecx
+  801c61:	7e d1                	jle    801c34 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801c63:	83 ec 0c             	sub    $0xc,%esp
+  801c66:	ff 75 e0             	push   -0x20(%ebp)
+  801c69:	6a 07                	push   $0x7
+  801c6b:	ff 75 e4             	push   -0x1c(%ebp)
+  801c6e:	57                   	push   %edi
+  801c6f:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c72:	99                   	cltd
+  801c73:	f7 f9                	idiv   %ecx
+  801c75:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801c7c:	e8 2f f3 ff ff       	call   800fb0 <sys_ipc_try_send>
+      if (r == 0)
+  801c81:	83 c4 20             	add    $0x20,%esp
+  801c84:	85 c0                	test   %eax,%eax
+  801c86:	74 0a                	je     801c92 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801c88:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801c8b:	75 95                	jne    801c22 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801c8d:	83 c3 01             	add    $0x1,%ebx
+  801c90:	eb c7                	jmp    801c59 <fsipc_send+0xd8>
+  }
+}
+  801c92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c95:	5b                   	pop    %ebx
+  801c96:	5e                   	pop    %esi
+  801c97:	5f                   	pop    %edi
+  801c98:	5d                   	pop    %ebp
+  801c99:	c3                   	ret
+
+00801c9a <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801c9a:	55                   	push   %ebp
+  801c9b:	89 e5                	mov    %esp,%ebp
+  801c9d:	53                   	push   %ebx
+  801c9e:	83 ec 14             	sub    $0x14,%esp
+  801ca1:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801ca3:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801caa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801caf:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801cb4:	e8 c8 fe ff ff       	call   801b81 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801cb9:	6a 00                	push   $0x0
+  801cbb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cbe:	50                   	push   %eax
+  801cbf:	53                   	push   %ebx
+  801cc0:	6a 00                	push   $0x0
+  801cc2:	e8 9f 21 00 00       	call   803e66 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801cc7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cca:	c9                   	leave
+  801ccb:	c3                   	ret
+
+00801ccc <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ccc:	55                   	push   %ebp
+  801ccd:	89 e5                	mov    %esp,%ebp
+  801ccf:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801cd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cd8:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801cdd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ce0:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801ce5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cea:	b8 02 00 00 00       	mov    $0x2,%eax
+  801cef:	e8 a6 ff ff ff       	call   801c9a <fsipc>
+}
+  801cf4:	c9                   	leave
+  801cf5:	c3                   	ret
+
+00801cf6 <devfile_flush>:
+{
+  801cf6:	55                   	push   %ebp
+  801cf7:	89 e5                	mov    %esp,%ebp
+  801cf9:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801cfc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cff:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d02:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801d07:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d0c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d11:	e8 84 ff ff ff       	call   801c9a <fsipc>
+}
+  801d16:	c9                   	leave
+  801d17:	c3                   	ret
+
+00801d18 <devfile_stat>:
+{
+  801d18:	55                   	push   %ebp
+  801d19:	89 e5                	mov    %esp,%ebp
+  801d1b:	53                   	push   %ebx
+  801d1c:	83 ec 04             	sub    $0x4,%esp
+  801d1f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d22:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d25:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d28:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d32:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d37:	e8 5e ff ff ff       	call   801c9a <fsipc>
+  801d3c:	85 c0                	test   %eax,%eax
+  801d3e:	78 2c                	js     801d6c <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d40:	83 ec 08             	sub    $0x8,%esp
+  801d43:	68 00 70 80 00       	push   $0x807000
+  801d48:	53                   	push   %ebx
+  801d49:	e8 7c eb ff ff       	call   8008ca <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801d4e:	a1 80 70 80 00       	mov    0x807080,%eax
+  801d53:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d59:	a1 84 70 80 00       	mov    0x807084,%eax
+  801d5e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801d64:	83 c4 10             	add    $0x10,%esp
+  801d67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d6f:	c9                   	leave
+  801d70:	c3                   	ret
+
+00801d71 <fsv_alloc>:
+{
+  801d71:	55                   	push   %ebp
+  801d72:	89 e5                	mov    %esp,%ebp
+  801d74:	56                   	push   %esi
+  801d75:	53                   	push   %ebx
+  801d76:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801d78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d7d:	eb 22                	jmp    801da1 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801d7f:	83 ec 04             	sub    $0x4,%esp
+  801d82:	6a 00                	push   $0x0
+  801d84:	6a 00                	push   $0x0
+  801d86:	6a 07                	push   $0x7
+  801d88:	50                   	push   %eax
+  801d89:	6a 00                	push   $0x0
+  801d8b:	6a 04                	push   $0x4
+  801d8d:	68 40 60 80 00       	push   $0x806040
+  801d92:	e8 b5 f3 ff ff       	call   80114c <sysbatch_add>
+  801d97:	83 c4 20             	add    $0x20,%esp
+  801d9a:	85 c0                	test   %eax,%eax
+  801d9c:	78 48                	js     801de6 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801d9e:	83 c3 01             	add    $0x1,%ebx
+  801da1:	39 f3                	cmp    %esi,%ebx
+  801da3:	74 31                	je     801dd6 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801da5:	89 d8                	mov    %ebx,%eax
+  801da7:	c1 e0 0c             	shl    $0xc,%eax
+  801daa:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801daf:	89 c2                	mov    %eax,%edx
+  801db1:	c1 ea 16             	shr    $0x16,%edx
+  801db4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801dbb:	f6 c2 01             	test   $0x1,%dl
+  801dbe:	74 bf                	je     801d7f <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801dc0:	89 c2                	mov    %eax,%edx
+  801dc2:	c1 ea 0c             	shr    $0xc,%edx
+  801dc5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801dcc:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801dcf:	83 fa 03             	cmp    $0x3,%edx
+  801dd2:	75 ab                	jne    801d7f <fsv_alloc+0xe>
+  801dd4:	eb c8                	jmp    801d9e <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801dd6:	83 ec 0c             	sub    $0xc,%esp
+  801dd9:	68 40 60 80 00       	push   $0x806040
+  801dde:	e8 19 f3 ff ff       	call   8010fc <sysbatch_flush>
+  801de3:	83 c4 10             	add    $0x10,%esp
+}
+  801de6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801de9:	5b                   	pop    %ebx
+  801dea:	5e                   	pop    %esi
+  801deb:	5d                   	pop    %ebp
+  801dec:	c3                   	ret
+
+00801ded <devfile_read>:
+{
+  801ded:	55                   	push   %ebp
+  801dee:	89 e5                	mov    %esp,%ebp
+  801df0:	57                   	push   %edi
+  801df1:	56                   	push   %esi
+  801df2:	53                   	push   %ebx
+  801df3:	83 ec 3c             	sub    $0x3c,%esp
+  801df6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801df9:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801dff:	77 57                	ja     801e58 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801e01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e04:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e07:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801e0c:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801e12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e17:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e1c:	e8 79 fe ff ff       	call   801c9a <fsipc>
+  801e21:	89 c6                	mov    %eax,%esi
+  801e23:	85 c0                	test   %eax,%eax
+  801e25:	78 27                	js     801e4e <devfile_read+0x61>
+  assert(r <= n);
+  801e27:	39 c3                	cmp    %eax,%ebx
+  801e29:	0f 82 0e 02 00 00    	jb     80203d <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801e2f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e34:	0f 8f 1c 02 00 00    	jg     802056 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e3a:	83 ec 04             	sub    $0x4,%esp
+  801e3d:	50                   	push   %eax
+  801e3e:	68 00 70 80 00       	push   $0x807000
+  801e43:	ff 75 0c             	push   0xc(%ebp)
+  801e46:	e8 05 ec ff ff       	call   800a50 <memmove>
+  return r;
+  801e4b:	83 c4 10             	add    $0x10,%esp
+}
+  801e4e:	89 f0                	mov    %esi,%eax
+  801e50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e53:	5b                   	pop    %ebx
+  801e54:	5e                   	pop    %esi
+  801e55:	5f                   	pop    %edi
+  801e56:	5d                   	pop    %ebp
+  801e57:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801e58:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e5d:	e8 0f ff ff ff       	call   801d71 <fsv_alloc>
+  801e62:	89 c6                	mov    %eax,%esi
+  801e64:	85 c0                	test   %eax,%eax
+  801e66:	78 e6                	js     801e4e <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801e68:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e6b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e6e:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801e73:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e76:	8b 40 04             	mov    0x4(%eax),%eax
+  801e79:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801e7e:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801e84:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801e8b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e90:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801e95:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801e9a:	e8 e2 fc ff ff       	call   801b81 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801e9f:	6a 00                	push   $0x0
+  801ea1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ea4:	50                   	push   %eax
+  801ea5:	68 00 10 c0 9f       	push   $0x9fc01000
+  801eaa:	6a 00                	push   $0x0
+  801eac:	e8 b5 1f 00 00       	call   803e66 <ipc_recv_pages>
+  801eb1:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801eb3:	83 c4 10             	add    $0x10,%esp
+  801eb6:	85 c0                	test   %eax,%eax
+  801eb8:	7e 94                	jle    801e4e <devfile_read+0x61>
+  assert(r <= n);
+  801eba:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801ebd:	39 c3                	cmp    %eax,%ebx
+  801ebf:	72 2e                	jb     801eef <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801ec1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec4:	8b 40 04             	mov    0x4(%eax),%eax
+  801ec7:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ecc:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801ecf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ed2:	c1 e2 0c             	shl    $0xc,%edx
+  801ed5:	39 ca                	cmp    %ecx,%edx
+  801ed7:	72 2f                	jb     801f08 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801ed9:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801ede:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801ee1:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801ee5:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801eea:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801eed:	eb 52                	jmp    801f41 <devfile_read+0x154>
+  assert(r <= n);
+  801eef:	68 c9 47 80 00       	push   $0x8047c9
+  801ef4:	68 d0 47 80 00       	push   $0x8047d0
+  801ef9:	68 49 01 00 00       	push   $0x149
+  801efe:	68 be 47 80 00       	push   $0x8047be
+  801f03:	e8 f9 e2 ff ff       	call   800201 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801f08:	68 f4 47 80 00       	push   $0x8047f4
+  801f0d:	68 d0 47 80 00       	push   $0x8047d0
+  801f12:	68 4a 01 00 00       	push   $0x14a
+  801f17:	68 be 47 80 00       	push   $0x8047be
+  801f1c:	e8 e0 e2 ff ff       	call   800201 <_panic>
+      memmove(dst + done, src + done, m);
+  801f21:	83 ec 04             	sub    $0x4,%esp
+  801f24:	53                   	push   %ebx
+  801f25:	56                   	push   %esi
+  801f26:	89 f8                	mov    %edi,%eax
+  801f28:	03 45 0c             	add    0xc(%ebp),%eax
+  801f2b:	50                   	push   %eax
+  801f2c:	e8 1f eb ff ff       	call   800a50 <memmove>
+  801f31:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801f34:	01 df                	add    %ebx,%edi
+  801f36:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801f39:	39 c7                	cmp    %eax,%edi
+  801f3b:	0f 83 c0 00 00 00    	jae    802001 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801f41:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801f44:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801f47:	89 f0                	mov    %esi,%eax
+  801f49:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f4e:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801f53:	29 c3                	sub    %eax,%ebx
+  801f55:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801f58:	29 f8                	sub    %edi,%eax
+  801f5a:	39 c3                	cmp    %eax,%ebx
+  801f5c:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801f5f:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801f65:	75 ba                	jne    801f21 <devfile_read+0x134>
+  801f67:	89 f9                	mov    %edi,%ecx
+  801f69:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801f6c:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801f6f:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801f75:	75 aa                	jne    801f21 <devfile_read+0x134>
+  801f77:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801f7d:	77 a2                	ja     801f21 <devfile_read+0x134>
+  801f7f:	89 c8                	mov    %ecx,%eax
+  801f81:	c1 e8 16             	shr    $0x16,%eax
+  801f84:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801f8b:	a8 01                	test   $0x1,%al
+  801f8d:	74 92                	je     801f21 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801f8f:	89 c8                	mov    %ecx,%eax
+  801f91:	c1 e8 0c             	shr    $0xc,%eax
+  801f94:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801f9b:	a8 01                	test   $0x1,%al
+  801f9d:	74 82                	je     801f21 <devfile_read+0x134>
+  801f9f:	a9 02 08 00 00       	test   $0x802,%eax
+  801fa4:	0f 84 77 ff ff ff    	je     801f21 <devfile_read+0x134>
+  801faa:	f6 c4 04             	test   $0x4,%ah
+  801fad:	0f 85 6e ff ff ff    	jne    801f21 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801fb3:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  801fb8:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801fbc:	84 c0                	test   %al,%al
+  801fbe:	75 17                	jne    801fd7 <devfile_read+0x1ea>
+  801fc0:	83 ec 08             	sub    $0x8,%esp
+  801fc3:	6a 01                	push   $0x1
+  801fc5:	6a 00                	push   $0x0
+  801fc7:	e8 ea ec ff ff       	call   800cb6 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801fcc:	83 c4 10             	add    $0x10,%esp
+  801fcf:	85 c0                	test   %eax,%eax
+  801fd1:	0f 85 4a ff ff ff    	jne    801f21 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801fd7:	83 ec 04             	sub    $0x4,%esp
+  801fda:	68 05 08 00 00       	push   $0x805
+  801fdf:	ff 75 cc             	push   -0x34(%ebp)
+  801fe2:	6a 00                	push   $0x0
+  801fe4:	56                   	push   %esi
+  801fe5:	6a 00                	push   $0x0
+  801fe7:	6a 05                	push   $0x5
+  801fe9:	68 40 60 80 00       	push   $0x806040
+  801fee:	e8 59 f1 ff ff       	call   80114c <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801ff3:	c1 e8 1f             	shr    $0x1f,%eax
+  801ff6:	08 45 cb             	or     %al,-0x35(%ebp)
+  801ff9:	83 c4 20             	add    $0x20,%esp
+  801ffc:	e9 33 ff ff ff       	jmp    801f34 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  802001:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  802004:	83 ec 0c             	sub    $0xc,%esp
+  802007:	68 40 60 80 00       	push   $0x806040
+  80200c:	e8 eb f0 ff ff       	call   8010fc <sysbatch_flush>
+  802011:	83 c4 10             	add    $0x10,%esp
+  802014:	85 c0                	test   %eax,%eax
+  802016:	78 06                	js     80201e <devfile_read+0x231>
+  802018:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  80201c:	74 14                	je     802032 <devfile_read+0x245>
+    memmove(dst, src, r);
+  80201e:	83 ec 04             	sub    $0x4,%esp
+  802021:	ff 75 d4             	push   -0x2c(%ebp)
+  802024:	ff 75 d0             	push   -0x30(%ebp)
+  802027:	ff 75 0c             	push   0xc(%ebp)
+  80202a:	e8 21 ea ff ff       	call   800a50 <memmove>
+  80202f:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  802032:	8b 45 08             	mov    0x8(%ebp),%eax
+  802035:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  802038:	e9 11 fe ff ff       	jmp    801e4e <devfile_read+0x61>
+  assert(r <= n);
+  80203d:	68 c9 47 80 00       	push   $0x8047c9
+  802042:	68 d0 47 80 00       	push   $0x8047d0
+  802047:	68 1c 01 00 00       	push   $0x11c
+  80204c:	68 be 47 80 00       	push   $0x8047be
+  802051:	e8 ab e1 ff ff       	call   800201 <_panic>
+  assert(r <= PGSIZE);
+  802056:	68 e5 47 80 00       	push   $0x8047e5
+  80205b:	68 d0 47 80 00       	push   $0x8047d0
+  802060:	68 1d 01 00 00       	push   $0x11d
+  802065:	68 be 47 80 00       	push   $0x8047be
+  80206a:	e8 92 e1 ff ff       	call   800201 <_panic>
+
+0080206f <devfile_write>:
+{
+  80206f:	55                   	push   %ebp
+  802070:	89 e5                	mov    %esp,%ebp
+  802072:	57                   	push   %edi
+  802073:	56                   	push   %esi
+  802074:	53                   	push   %ebx
+  802075:	83 ec 1c             	sub    $0x1c,%esp
+  802078:	8b 75 08             	mov    0x8(%ebp),%esi
+  80207b:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  80207e:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  802083:	77 39                	ja     8020be <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802085:	8b 56 0c             	mov    0xc(%esi),%edx
+  802088:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  80208e:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  802093:	83 ec 04             	sub    $0x4,%esp
+  802096:	50                   	push   %eax
+  802097:	ff 75 0c             	push   0xc(%ebp)
+  80209a:	68 08 70 80 00       	push   $0x807008
+  80209f:	e8 ac e9 ff ff       	call   800a50 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8020a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020ae:	e8 e7 fb ff ff       	call   801c9a <fsipc>
+  8020b3:	83 c4 10             	add    $0x10,%esp
+}
+  8020b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020b9:	5b                   	pop    %ebx
+  8020ba:	5e                   	pop    %esi
+  8020bb:	5f                   	pop    %edi
+  8020bc:	5d                   	pop    %ebp
+  8020bd:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  8020be:	ba 00 00 10 00       	mov    $0x100000,%edx
+  8020c3:	39 d0                	cmp    %edx,%eax
+  8020c5:	89 d3                	mov    %edx,%ebx
+  8020c7:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8020ca:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  8020d0:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  8020d3:	83 c7 01             	add    $0x1,%edi
+  8020d6:	89 f8                	mov    %edi,%eax
+  8020d8:	e8 94 fc ff ff       	call   801d71 <fsv_alloc>
+  8020dd:	85 c0                	test   %eax,%eax
+  8020df:	78 d5                	js     8020b6 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  8020e1:	83 ec 04             	sub    $0x4,%esp
+  8020e4:	53                   	push   %ebx
+  8020e5:	ff 75 0c             	push   0xc(%ebp)
+  8020e8:	68 00 10 c0 9f       	push   $0x9fc01000
+  8020ed:	e8 5e e9 ff ff       	call   800a50 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  8020f2:	8b 46 0c             	mov    0xc(%esi),%eax
+  8020f5:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  8020fa:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  802100:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802107:	89 f9                	mov    %edi,%ecx
+  802109:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  80210e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802113:	e8 69 fa ff ff       	call   801b81 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802118:	6a 00                	push   $0x0
+  80211a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80211d:	50                   	push   %eax
+  80211e:	6a 00                	push   $0x0
+  802120:	6a 00                	push   $0x0
+  802122:	e8 3f 1d 00 00       	call   803e66 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  802127:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  80212a:	eb 8a                	jmp    8020b6 <devfile_write+0x47>
+
+0080212c <open>:
+{
+  80212c:	55                   	push   %ebp
+  80212d:	89 e5                	mov    %esp,%ebp
+  80212f:	56                   	push   %esi
+  802130:	53                   	push   %ebx
+  802131:	83 ec 1c             	sub    $0x1c,%esp
+  802134:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802137:	56                   	push   %esi
+  802138:	e8 52 e7 ff ff       	call   80088f <strlen>
+  80213d:	83 c4 10             	add    $0x10,%esp
+  802140:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802145:	7f 6c                	jg     8021b3 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802147:	83 ec 0c             	sub    $0xc,%esp
+  80214a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80214d:	50                   	push   %eax
+  80214e:	e8 ad f4 ff ff       	call   801600 <fd_alloc>
+  802153:	89 c3                	mov    %eax,%ebx
+  802155:	83 c4 10             	add    $0x10,%esp
+  802158:	85 c0                	test   %eax,%eax
+  80215a:	78 3c                	js     802198 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  80215c:	83 ec 08             	sub    $0x8,%esp
+  80215f:	56                   	push   %esi
+  802160:	68 00 70 80 00       	push   $0x807000
+  802165:	e8 60 e7 ff ff       	call   8008ca <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  80216a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80216d:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802172:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802175:	b8 01 00 00 00       	mov    $0x1,%eax
+  80217a:	e8 1b fb ff ff       	call   801c9a <fsipc>
+  80217f:	89 c3                	mov    %eax,%ebx
+  802181:	83 c4 10             	add    $0x10,%esp
+  802184:	85 c0                	test   %eax,%eax
+  802186:	78 19                	js     8021a1 <open+0x75>
+  return fd2num(fd);
+  802188:	83 ec 0c             	sub    $0xc,%esp
+  80218b:	ff 75 f4             	push   -0xc(%ebp)
+  80218e:	e8 49 f4 ff ff       	call   8015dc <fd2num>
+  802193:	89 c3                	mov    %eax,%ebx
+  802195:	83 c4 10             	add    $0x10,%esp
+}
+  802198:	89 d8                	mov    %ebx,%eax
+  80219a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80219d:	5b                   	pop    %ebx
+  80219e:	5e                   	pop    %esi
+  80219f:	5d                   	pop    %ebp
+  8021a0:	c3                   	ret
+    fd_close(fd, 0);
+  8021a1:	83 ec 08             	sub    $0x8,%esp
+  8021a4:	6a 00                	push   $0x0
+  8021a6:	ff 75 f4             	push   -0xc(%ebp)
+  8021a9:	e8 44 f5 ff ff       	call   8016f2 <fd_close>
+    return r;
+  8021ae:	83 c4 10             	add    $0x10,%esp
+  8021b1:	eb e5                	jmp    802198 <open+0x6c>
+    return -E_BAD_PATH;
+  8021b3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021b8:	eb de                	jmp    802198 <open+0x6c>
+
+008021ba <open_read>:
+{
+  8021ba:	55                   	push   %ebp
+  8021bb:	89 e5                	mov    %esp,%ebp
+  8021bd:	57                   	push   %edi
+  8021be:	56                   	push   %esi
+  8021bf:	53                   	push   %ebx
+  8021c0:	83 ec 28             	sub    $0x28,%esp
+  8021c3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  8021c6:	57                   	push   %edi
+  8021c7:	e8 c3 e6 ff ff       	call   80088f <strlen>
+  8021cc:	83 c4 10             	add    $0x10,%esp
+  8021cf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021d4:	0f 87 f6 00 00 00    	ja     8022d0 <open_read+0x116>
+  8021da:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  8021dc:	83 ec 0c             	sub    $0xc,%esp
+  8021df:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8021e2:	50                   	push   %eax
+  8021e3:	e8 18 f4 ff ff       	call   801600 <fd_alloc>
+  8021e8:	89 c3                	mov    %eax,%ebx
+  8021ea:	83 c4 10             	add    $0x10,%esp
+  8021ed:	85 c0                	test   %eax,%eax
+  8021ef:	0f 88 b2 00 00 00    	js     8022a7 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  8021f5:	83 ec 08             	sub    $0x8,%esp
+  8021f8:	57                   	push   %edi
+  8021f9:	68 e4 70 80 00       	push   $0x8070e4
+  8021fe:	e8 c7 e6 ff ff       	call   8008ca <strcpy>
+  req->req_nops = 2;
+  802203:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  80220a:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  80220d:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  802214:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  802217:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80221a:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  80221f:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  802226:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802229:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  802230:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802233:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  80223a:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  80223d:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  802242:	29 f0                	sub    %esi,%eax
+  802244:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802247:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  80224b:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  802250:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  802257:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  80225a:	83 c6 01             	add    $0x1,%esi
+  80225d:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  802263:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802266:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80226b:	e8 2a fa ff ff       	call   801c9a <fsipc>
+  802270:	89 c3                	mov    %eax,%ebx
+  802272:	83 c4 10             	add    $0x10,%esp
+  802275:	83 f8 01             	cmp    $0x1,%eax
+  802278:	7e 37                	jle    8022b1 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  80227a:	a1 38 70 80 00       	mov    0x807038,%eax
+  80227f:	8b 55 18             	mov    0x18(%ebp),%edx
+  802282:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  802284:	83 ec 04             	sub    $0x4,%esp
+  802287:	50                   	push   %eax
+  802288:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  80228e:	56                   	push   %esi
+  80228f:	ff 75 10             	push   0x10(%ebp)
+  802292:	e8 b9 e7 ff ff       	call   800a50 <memmove>
+  return fd2num(fd);
+  802297:	83 c4 04             	add    $0x4,%esp
+  80229a:	ff 75 e4             	push   -0x1c(%ebp)
+  80229d:	e8 3a f3 ff ff       	call   8015dc <fd2num>
+  8022a2:	89 c3                	mov    %eax,%ebx
+  8022a4:	83 c4 10             	add    $0x10,%esp
+}
+  8022a7:	89 d8                	mov    %ebx,%eax
+  8022a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022ac:	5b                   	pop    %ebx
+  8022ad:	5e                   	pop    %esi
+  8022ae:	5f                   	pop    %edi
+  8022af:	5d                   	pop    %ebp
+  8022b0:	c3                   	ret
+    fd_close(fd, 0);
+  8022b1:	83 ec 08             	sub    $0x8,%esp
+  8022b4:	6a 00                	push   $0x0
+  8022b6:	ff 75 e4             	push   -0x1c(%ebp)
+  8022b9:	e8 34 f4 ff ff       	call   8016f2 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8022be:	83 c4 10             	add    $0x10,%esp
+  8022c1:	85 db                	test   %ebx,%ebx
+  8022c3:	78 e2                	js     8022a7 <open_read+0xed>
+  8022c5:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  8022c8:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  8022ce:	eb d7                	jmp    8022a7 <open_read+0xed>
+    return -E_BAD_PATH;
+  8022d0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8022d5:	eb d0                	jmp    8022a7 <open_read+0xed>
+
+008022d7 <file_stat>:
+{
+  8022d7:	55                   	push   %ebp
+  8022d8:	89 e5                	mov    %esp,%ebp
+  8022da:	57                   	push   %edi
+  8022db:	56                   	push   %esi
+  8022dc:	53                   	push   %ebx
+  8022dd:	83 ec 18             	sub    $0x18,%esp
+  8022e0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8022e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8022e6:	57                   	push   %edi
+  8022e7:	e8 a3 e5 ff ff       	call   80088f <strlen>
+  8022ec:	83 c4 10             	add    $0x10,%esp
+  8022ef:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022f4:	0f 8f c7 00 00 00    	jg     8023c1 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  8022fa:	83 ec 0c             	sub    $0xc,%esp
+  8022fd:	57                   	push   %edi
+  8022fe:	e8 8c e5 ff ff       	call   80088f <strlen>
+  802303:	8d 58 04             	lea    0x4(%eax),%ebx
+  802306:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802309:	83 c4 08             	add    $0x8,%esp
+  80230c:	57                   	push   %edi
+  80230d:	68 e4 70 80 00       	push   $0x8070e4
+  802312:	e8 b3 e5 ff ff       	call   8008ca <strcpy>
+  req->req_nops = 2;
+  802317:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  80231e:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802321:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  802328:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  80232b:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  802332:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802335:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  80233c:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  80233f:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  802346:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802349:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  802350:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802353:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802359:	ba 00 00 00 00       	mov    $0x0,%edx
+  80235e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802363:	e8 32 f9 ff ff       	call   801c9a <fsipc>
+  802368:	83 c4 10             	add    $0x10,%esp
+  80236b:	83 f8 01             	cmp    $0x1,%eax
+  80236e:	7e 42                	jle    8023b2 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802370:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802376:	83 ec 08             	sub    $0x8,%esp
+  802379:	53                   	push   %ebx
+  80237a:	56                   	push   %esi
+  80237b:	e8 4a e5 ff ff       	call   8008ca <strcpy>
+  st->st_size = ret->ret_size;
+  802380:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802386:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  80238c:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802392:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802398:	c7 86 88 00 00 00 0c 	movl   $0x80500c,0x88(%esi)
+  80239f:	50 80 00 
+  return 0;
+  8023a2:	83 c4 10             	add    $0x10,%esp
+  8023a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ad:	5b                   	pop    %ebx
+  8023ae:	5e                   	pop    %esi
+  8023af:	5f                   	pop    %edi
+  8023b0:	5d                   	pop    %ebp
+  8023b1:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	78 f4                	js     8023aa <file_stat+0xd3>
+  8023b6:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8023b9:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  8023bf:	eb e9                	jmp    8023aa <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8023c1:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8023c6:	eb e2                	jmp    8023aa <file_stat+0xd3>
+
+008023c8 <read_map>:
+{
+  8023c8:	55                   	push   %ebp
+  8023c9:	89 e5                	mov    %esp,%ebp
+  8023cb:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023d1:	50                   	push   %eax
+  8023d2:	ff 75 08             	push   0x8(%ebp)
+  8023d5:	e8 7c f2 ff ff       	call   801656 <fd_lookup>
+  8023da:	83 c4 10             	add    $0x10,%esp
+  8023dd:	85 c0                	test   %eax,%eax
+  8023df:	78 2a                	js     80240b <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8023e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023e4:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  8023ea:	39 08                	cmp    %ecx,(%eax)
+  8023ec:	75 1f                	jne    80240d <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8023ee:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023f1:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  8023f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023f9:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8023fe:	8b 55 10             	mov    0x10(%ebp),%edx
+  802401:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802406:	e8 8f f8 ff ff       	call   801c9a <fsipc>
+}
+  80240b:	c9                   	leave
+  80240c:	c3                   	ret
+    return -E_INVAL;
+  80240d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802412:	eb f7                	jmp    80240b <read_map+0x43>
+
+00802414 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802414:	55                   	push   %ebp
+  802415:	89 e5                	mov    %esp,%ebp
+  802417:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80241a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80241f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802424:	e8 71 f8 ff ff       	call   801c9a <fsipc>
+}
+  802429:	c9                   	leave
+  80242a:	c3                   	ret
+
+0080242b <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  80242b:	55                   	push   %ebp
+  80242c:	89 e5                	mov    %esp,%ebp
+  80242e:	57                   	push   %edi
+  80242f:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802430:	8b 45 08             	mov    0x8(%ebp),%eax
+  802433:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802438:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  80243f:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802442:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802449:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80244c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802451:	b8 09 00 00 00       	mov    $0x9,%eax
+  802456:	e8 3f f8 ff ff       	call   801c9a <fsipc>
+  80245b:	85 c0                	test   %eax,%eax
+  80245d:	78 14                	js     802473 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  80245f:	be 00 70 80 00       	mov    $0x807000,%esi
+  802464:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802469:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80246c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  80246e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802473:	5e                   	pop    %esi
+  802474:	5f                   	pop    %edi
+  802475:	5d                   	pop    %ebp
+  802476:	c3                   	ret
+
+00802477 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802477:	55                   	push   %ebp
+  802478:	89 e5                	mov    %esp,%ebp
+  80247a:	53                   	push   %ebx
+  80247b:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  80247e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802481:	50                   	push   %eax
+  802482:	6a 00                	push   $0x0
+  802484:	e8 a2 ff ff ff       	call   80242b <fs_stats>
+  802489:	83 c4 10             	add    $0x10,%esp
+  80248c:	85 c0                	test   %eax,%eax
+  80248e:	78 28                	js     8024b8 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802490:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802493:	83 ec 08             	sub    $0x8,%esp
+  802496:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802499:	50                   	push   %eax
+  80249a:	6a 20                	push   $0x20
+  80249c:	e8 8a ff ff ff       	call   80242b <fs_stats>
+  8024a1:	83 c4 10             	add    $0x10,%esp
+  8024a4:	85 c0                	test   %eax,%eax
+  8024a6:	78 10                	js     8024b8 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8024a8:	83 ec 08             	sub    $0x8,%esp
+  8024ab:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8024ae:	50                   	push   %eax
+  8024af:	53                   	push   %ebx
+  8024b0:	e8 76 ff ff ff       	call   80242b <fs_stats>
+  8024b5:	83 c4 10             	add    $0x10,%esp
+}
+  8024b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024bb:	c9                   	leave
+  8024bc:	c3                   	ret
+
+008024bd <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8024bd:	55                   	push   %ebp
+  8024be:	89 e5                	mov    %esp,%ebp
+  8024c0:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8024c3:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8024ca:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8024cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d0:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  8024d5:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8024dc:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8024df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024e4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8024e9:	e8 ac f7 ff ff       	call   801c9a <fsipc>
+}
+  8024ee:	c9                   	leave
+  8024ef:	c3                   	ret
+
+008024f0 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8024f0:	55                   	push   %ebp
+  8024f1:	89 e5                	mov    %esp,%ebp
+  8024f3:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8024f6:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8024fd:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802500:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802507:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80250a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80250d:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  802512:	ba 00 00 00 00       	mov    $0x0,%edx
+  802517:	b8 09 00 00 00       	mov    $0x9,%eax
+  80251c:	e8 79 f7 ff ff       	call   801c9a <fsipc>
+}
+  802521:	c9                   	leave
+  802522:	c3                   	ret
+
+00802523 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802523:	55                   	push   %ebp
+  802524:	89 e5                	mov    %esp,%ebp
+  802526:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802529:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80252c:	50                   	push   %eax
+  80252d:	ff 75 08             	push   0x8(%ebp)
+  802530:	e8 21 f1 ff ff       	call   801656 <fd_lookup>
+  802535:	83 c4 10             	add    $0x10,%esp
+  802538:	85 c0                	test   %eax,%eax
+  80253a:	78 34                	js     802570 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80253c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80253f:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  802545:	39 08                	cmp    %ecx,(%eax)
+  802547:	75 29                	jne    802572 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802549:	8b 40 0c             	mov    0xc(%eax),%eax
+  80254c:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  802551:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802554:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  802559:	8b 45 10             	mov    0x10(%ebp),%eax
+  80255c:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802561:	ba 00 00 00 00       	mov    $0x0,%edx
+  802566:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80256b:	e8 2a f7 ff ff       	call   801c9a <fsipc>
+}
+  802570:	c9                   	leave
+  802571:	c3                   	ret
+    return -E_INVAL;
+  802572:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802577:	eb f7                	jmp    802570 <fallocate+0x4d>
+
+00802579 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802579:	55                   	push   %ebp
+  80257a:	89 e5                	mov    %esp,%ebp
+  80257c:	57                   	push   %edi
+  80257d:	56                   	push   %esi
+  80257e:	53                   	push   %ebx
+  80257f:	83 ec 24             	sub    $0x24,%esp
+  802582:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802585:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802588:	50                   	push   %eax
+  802589:	ff 75 08             	push   0x8(%ebp)
+  80258c:	e8 c5 f0 ff ff       	call   801656 <fd_lookup>
+  802591:	83 c4 10             	add    $0x10,%esp
+  802594:	85 c0                	test   %eax,%eax
+  802596:	78 66                	js     8025fe <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802598:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80259b:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  8025a1:	39 08                	cmp    %ecx,(%eax)
+  8025a3:	75 61                	jne    802606 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8025a5:	85 f6                	test   %esi,%esi
+  8025a7:	7e 50                	jle    8025f9 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8025a9:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8025ae:	39 de                	cmp    %ebx,%esi
+  8025b0:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8025b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025b6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025b9:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  8025be:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8025c4:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8025cb:	83 ec 04             	sub    $0x4,%esp
+  8025ce:	57                   	push   %edi
+  8025cf:	ff 75 0c             	push   0xc(%ebp)
+  8025d2:	68 08 70 80 00       	push   $0x807008
+  8025d7:	e8 74 e4 ff ff       	call   800a50 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8025dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025e1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8025e6:	e8 af f6 ff ff       	call   801c9a <fsipc>
+  8025eb:	83 c4 10             	add    $0x10,%esp
+  8025ee:	85 c0                	test   %eax,%eax
+  8025f0:	78 0c                	js     8025fe <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8025f2:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8025f5:	29 de                	sub    %ebx,%esi
+  8025f7:	eb ac                	jmp    8025a5 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8025f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802601:	5b                   	pop    %ebx
+  802602:	5e                   	pop    %esi
+  802603:	5f                   	pop    %edi
+  802604:	5d                   	pop    %ebp
+  802605:	c3                   	ret
+    return -E_INVAL;
+  802606:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80260b:	eb f1                	jmp    8025fe <prefetch+0x85>
+
+0080260d <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+//   which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  80260d:	55                   	push   %ebp
+  80260e:	89 e5                	mov    %esp,%ebp
+  802610:	57                   	push   %edi
+  802611:	56                   	push   %esi
+  802612:	53                   	push   %ebx
+  802613:	81 ec a8 02 00 00    	sub    $0x2a8,%esp
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  // Open the program and read its ELF header in one round trip.
+  if ((r = open_read(prog, O_RDONLY, elf_buf, sizeof(elf_buf), &n)) < 0)
+  802619:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  80261f:	50                   	push   %eax
+  802620:	68 00 02 00 00       	push   $0x200
+  802625:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80262b:	50                   	push   %eax
+  80262c:	6a 00                	push   $0x0
+  80262e:	ff 75 08             	push   0x8(%ebp)
+  802631:	e8 84 fb ff ff       	call   8021ba <open_read>
+  802636:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  80263c:	83 c4 20             	add    $0x20,%esp
+  80263f:	85 c0                	test   %eax,%eax
+  802641:	0f 88 66 06 00 00    	js     802cad <spawn+0x6a0>
+    return r;
+  fd = r;
+
+  elf = (struct Elf*)elf_buf;
+  if (n != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  802647:	81 bd a0 fd ff ff 00 	cmpl   $0x200,-0x260(%ebp)
+  80264e:	02 00 00 
+  802651:	0f 85 92 00 00 00    	jne    8026e9 <spawn+0xdc>
+  802657:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  80265e:	45 4c 46 
+  802661:	0f 85 82 00 00 00    	jne    8026e9 <spawn+0xdc>
+  802667:	b8 07 00 00 00       	mov    $0x7,%eax
+  80266c:	cd 30                	int    $0x30
+  80266e:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  802674:	89 c6                	mov    %eax,%esi
+  802676:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  80267c:	85 c0                	test   %eax,%eax
+  80267e:	0f 88 35 06 00 00    	js     802cb9 <spawn+0x6ac>
+    return r;
+  child = r;
+  sysbatch_init(&batch);
+  802684:	83 ec 0c             	sub    $0xc,%esp
+  802687:	68 60 67 80 00       	push   $0x806760
+  80268c:	e8 5d ea ff ff       	call   8010ee <sysbatch_init>
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  802691:	89 f0                	mov    %esi,%eax
+  802693:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802698:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  80269b:	c1 e6 04             	shl    $0x4,%esi
+  80269e:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8026a4:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8026aa:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8026af:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  8026b1:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8026b7:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  8026bd:	83 c4 10             	add    $0x10,%esp
+  8026c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  8026c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ca:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  8026cd:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  8026d0:	85 c0                	test   %eax,%eax
+  8026d2:	74 4d                	je     802721 <spawn+0x114>
+    string_size += strlen(argv[argc]) + 1;
+  8026d4:	83 ec 0c             	sub    $0xc,%esp
+  8026d7:	50                   	push   %eax
+  8026d8:	e8 b2 e1 ff ff       	call   80088f <strlen>
+  8026dd:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  8026e1:	83 c3 01             	add    $0x1,%ebx
+  8026e4:	83 c4 10             	add    $0x10,%esp
+  8026e7:	eb e4                	jmp    8026cd <spawn+0xc0>
+    close(fd);
+  8026e9:	83 ec 0c             	sub    $0xc,%esp
+  8026ec:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8026f2:	e8 82 f0 ff ff       	call   801779 <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8026f7:	83 c4 0c             	add    $0xc,%esp
+  8026fa:	68 7f 45 4c 46       	push   $0x464c457f
+  8026ff:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802705:	68 20 48 80 00       	push   $0x804820
+  80270a:	e8 cd db ff ff       	call   8002dc <cprintf>
+    return -E_NOT_EXEC;
+  80270f:	83 c4 10             	add    $0x10,%esp
+  802712:	c7 85 6c fd ff ff f2 	movl   $0xfffffff2,-0x294(%ebp)
+  802719:	ff ff ff 
+  80271c:	e9 98 05 00 00       	jmp    802cb9 <spawn+0x6ac>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char*)UTEMP + PGSIZE - string_size;
+  802721:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  802727:	bf 00 10 40 00       	mov    $0x401000,%edi
+  80272c:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t*)(ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80272e:	89 fa                	mov    %edi,%edx
+  802730:	83 e2 fc             	and    $0xfffffffc,%edx
+  802733:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  80273a:	29 c2                	sub    %eax,%edx
+  80273c:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void*)(argv_store - 2) < (void*)UTEMP)
+  802742:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802745:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80274a:	0f 86 a8 05 00 00    	jbe    802cf8 <spawn+0x6eb>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void*)UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802750:	83 ec 04             	sub    $0x4,%esp
+  802753:	6a 07                	push   $0x7
+  802755:	68 00 00 40 00       	push   $0x400000
+  80275a:	6a 00                	push   $0x0
+  80275c:	e8 98 e5 ff ff       	call   800cf9 <sys_page_alloc>
+  802761:	83 c4 10             	add    $0x10,%esp
+  802764:	85 c0                	test   %eax,%eax
+  802766:	0f 88 91 05 00 00    	js     802cfd <spawn+0x6f0>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  80276c:	be 00 00 00 00       	mov    $0x0,%esi
+  802771:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802777:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80277a:	eb 30                	jmp    8027ac <spawn+0x19f>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  80277c:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802782:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802788:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  80278b:	83 ec 08             	sub    $0x8,%esp
+  80278e:	ff 34 b3             	push   (%ebx,%esi,4)
+  802791:	57                   	push   %edi
+  802792:	e8 33 e1 ff ff       	call   8008ca <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  802797:	83 c4 04             	add    $0x4,%esp
+  80279a:	ff 34 b3             	push   (%ebx,%esi,4)
+  80279d:	e8 ed e0 ff ff       	call   80088f <strlen>
+  8027a2:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  8027a6:	83 c6 01             	add    $0x1,%esi
+  8027a9:	83 c4 10             	add    $0x10,%esp
+  8027ac:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  8027b2:	7f c8                	jg     80277c <spawn+0x16f>
+  }
+  argv_store[argc] = 0;
+  8027b4:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  8027ba:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8027c0:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  8027c7:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  8027cd:	0f 85 97 00 00 00    	jne    80286a <spawn+0x25d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  8027d3:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  8027d9:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  8027df:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  8027e2:	89 c8                	mov    %ecx,%eax
+  8027e4:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8027ea:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8027ed:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  8027f2:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!  Both calls ride along with the first batch
+  // of segment mappings.
+  if ((r = sysbatch_add(&batch, SYS_page_map, 0, (uint32_t) UTEMP, child,
+  8027f8:	83 ec 04             	sub    $0x4,%esp
+  8027fb:	6a 07                	push   $0x7
+  8027fd:	68 00 d0 bf ee       	push   $0xeebfd000
+  802802:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802808:	68 00 00 40 00       	push   $0x400000
+  80280d:	6a 00                	push   $0x0
+  80280f:	6a 05                	push   $0x5
+  802811:	68 60 67 80 00       	push   $0x806760
+  802816:	e8 31 e9 ff ff       	call   80114c <sysbatch_add>
+  80281b:	89 c3                	mov    %eax,%ebx
+  80281d:	83 c4 20             	add    $0x20,%esp
+  802820:	85 c0                	test   %eax,%eax
+  802822:	0f 88 dd 04 00 00    	js     802d05 <spawn+0x6f8>
+                        USTACKTOP - PGSIZE, PTE_P | PTE_U | PTE_W)) < 0)
+    goto error;
+  if ((r = sysbatch_add(&batch, SYS_page_unmap, 0, (uint32_t) UTEMP,
+  802828:	83 ec 04             	sub    $0x4,%esp
+  80282b:	6a 00                	push   $0x0
+  80282d:	6a 00                	push   $0x0
+  80282f:	6a 00                	push   $0x0
+  802831:	68 00 00 40 00       	push   $0x400000
+  802836:	6a 00                	push   $0x0
+  802838:	6a 06                	push   $0x6
+  80283a:	68 60 67 80 00       	push   $0x806760
+  80283f:	e8 08 e9 ff ff       	call   80114c <sysbatch_add>
+  802844:	89 c3                	mov    %eax,%ebx
+  802846:	83 c4 20             	add    $0x20,%esp
+  802849:	85 c0                	test   %eax,%eax
+  80284b:	0f 88 b4 04 00 00    	js     802d05 <spawn+0x6f8>
+  ph = (struct Proghdr*)(elf_buf + elf->e_phoff);
+  802851:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802857:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80285e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802863:	89 d6                	mov    %edx,%esi
+  802865:	e9 dd 01 00 00       	jmp    802a47 <spawn+0x43a>
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  80286a:	68 98 48 80 00       	push   $0x804898
+  80286f:	68 d0 47 80 00       	push   $0x8047d0
+  802874:	68 01 01 00 00       	push   $0x101
+  802879:	68 3a 48 80 00       	push   $0x80483a
+  80287e:	e8 7e d9 ff ff       	call   800201 <_panic>
+
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+    if (i >= filesz) {
+      // allocate a blank page
+      n = 1;
+      if ((r = sysbatch_add(&batch, SYS_page_alloc, child, va + i,
+  802883:	83 ec 04             	sub    $0x4,%esp
+  802886:	6a 00                	push   $0x0
+  802888:	6a 00                	push   $0x0
+  80288a:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802890:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802896:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  80289c:	01 c8                	add    %ecx,%eax
+  80289e:	50                   	push   %eax
+  80289f:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8028a5:	6a 04                	push   $0x4
+  8028a7:	68 60 67 80 00       	push   $0x806760
+  8028ac:	e8 9b e8 ff ff       	call   80114c <sysbatch_add>
+  8028b1:	83 c4 20             	add    $0x20,%esp
+  8028b4:	85 c0                	test   %eax,%eax
+  8028b6:	0f 88 0b 04 00 00    	js     802cc7 <spawn+0x6ba>
+      n = 1;
+  8028bc:	bf 01 00 00 00       	mov    $0x1,%edi
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  8028c1:	89 f8                	mov    %edi,%eax
+  8028c3:	c1 e0 0c             	shl    $0xc,%eax
+  8028c6:	01 85 84 fd ff ff    	add    %eax,-0x27c(%ebp)
+  8028cc:	e9 fc 01 00 00       	jmp    802acd <spawn+0x4c0>
+  8028d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028d6:	eb 0e                	jmp    8028e6 <spawn+0x2d9>
+  8028d8:	8b bd 60 fd ff ff    	mov    -0x2a0(%ebp),%edi
+  8028de:	e9 c1 00 00 00       	jmp    8029a4 <spawn+0x397>
+          return r;
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+          return -E_INVAL;
+      }
+    } else {
+      for (j = 0; j < n; j++)
+  8028e3:	83 c3 01             	add    $0x1,%ebx
+  8028e6:	39 df                	cmp    %ebx,%edi
+  8028e8:	7e 55                	jle    80293f <spawn+0x332>
+        if ((r = sysbatch_add(&batch, SYS_page_alloc, 0,
+  8028ea:	83 ec 04             	sub    $0x4,%esp
+  8028ed:	6a 00                	push   $0x0
+  8028ef:	6a 00                	push   $0x0
+  8028f1:	6a 07                	push   $0x7
+  8028f3:	89 d8                	mov    %ebx,%eax
+  8028f5:	c1 e0 0c             	shl    $0xc,%eax
+  8028f8:	05 00 10 40 00       	add    $0x401000,%eax
+  8028fd:	50                   	push   %eax
+  8028fe:	6a 00                	push   $0x0
+  802900:	6a 04                	push   $0x4
+  802902:	68 60 67 80 00       	push   $0x806760
+  802907:	e8 40 e8 ff ff       	call   80114c <sysbatch_add>
+  80290c:	83 c4 20             	add    $0x20,%esp
+  80290f:	85 c0                	test   %eax,%eax
+  802911:	79 d0                	jns    8028e3 <spawn+0x2d6>
+  802913:	89 c6                	mov    %eax,%esi
+  sys_env_destroy(child);
+  802915:	83 ec 0c             	sub    $0xc,%esp
+  802918:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80291e:	e8 14 e3 ff ff       	call   800c37 <sys_env_destroy>
+  close(fd);
+  802923:	83 c4 04             	add    $0x4,%esp
+  802926:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80292c:	e8 48 ee ff ff       	call   801779 <close>
+  return r;
+  802931:	83 c4 10             	add    $0x10,%esp
+  802934:	89 b5 6c fd ff ff    	mov    %esi,-0x294(%ebp)
+  80293a:	e9 7a 03 00 00       	jmp    802cb9 <spawn+0x6ac>
+                              (uint32_t) UTEMP2 + j * PGSIZE,
+                              PTE_P|PTE_U|PTE_W, 0, 0)) < 0)
+          return r;
+      if ((r = sysbatch_flush(&batch)) < 0)
+  80293f:	83 ec 0c             	sub    $0xc,%esp
+  802942:	68 60 67 80 00       	push   $0x806760
+  802947:	e8 b0 e7 ff ff       	call   8010fc <sysbatch_flush>
+  80294c:	83 c4 10             	add    $0x10,%esp
+  80294f:	85 c0                	test   %eax,%eax
+  802951:	0f 88 85 03 00 00    	js     802cdc <spawn+0x6cf>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  802957:	83 ec 08             	sub    $0x8,%esp
+  80295a:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802960:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802966:	01 c8                	add    %ecx,%eax
+  802968:	50                   	push   %eax
+  802969:	8b 9d 88 fd ff ff    	mov    -0x278(%ebp),%ebx
+  80296f:	53                   	push   %ebx
+  802970:	e8 dc f0 ff ff       	call   801a51 <seek>
+  802975:	83 c4 10             	add    $0x10,%esp
+  802978:	85 c0                	test   %eax,%eax
+  80297a:	0f 88 63 03 00 00    	js     802ce3 <spawn+0x6d6>
+        return r;
+      if ((r = readn(fd, UTEMP2, MIN(n * PGSIZE, filesz - i))) < 0)
+  802980:	83 ec 04             	sub    $0x4,%esp
+  802983:	89 f8                	mov    %edi,%eax
+  802985:	c1 e0 0c             	shl    $0xc,%eax
+  802988:	39 f0                	cmp    %esi,%eax
+  80298a:	0f 47 c6             	cmova  %esi,%eax
+  80298d:	50                   	push   %eax
+  80298e:	68 00 10 40 00       	push   $0x401000
+  802993:	53                   	push   %ebx
+  802994:	e8 ef ef ff ff       	call   801988 <readn>
+  802999:	83 c4 10             	add    $0x10,%esp
+  80299c:	85 c0                	test   %eax,%eax
+  80299e:	0f 88 46 03 00 00    	js     802cea <spawn+0x6dd>
+        return r;
+    }
+    for (j = 0; j < n; j++) {
+  8029a4:	8d b7 01 04 00 00    	lea    0x401(%edi),%esi
+  8029aa:	c1 e6 0c             	shl    $0xc,%esi
+  8029ad:	bb 00 10 40 00       	mov    $0x401000,%ebx
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  8029b2:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  8029b8:	8b 8d 78 fd ff ff    	mov    -0x288(%ebp),%ecx
+  8029be:	8d 84 08 00 f0 bf ff 	lea    -0x401000(%eax,%ecx,1),%eax
+  8029c5:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  8029cb:	89 c7                	mov    %eax,%edi
+    for (j = 0; j < n; j++) {
+  8029cd:	39 f3                	cmp    %esi,%ebx
+  8029cf:	74 59                	je     802a2a <spawn+0x41d>
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  8029d1:	83 ec 04             	sub    $0x4,%esp
+  8029d4:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  8029da:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  8029dd:	50                   	push   %eax
+  8029de:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8029e4:	53                   	push   %ebx
+  8029e5:	6a 00                	push   $0x0
+  8029e7:	6a 05                	push   $0x5
+  8029e9:	68 60 67 80 00       	push   $0x806760
+  8029ee:	e8 59 e7 ff ff       	call   80114c <sysbatch_add>
+  8029f3:	83 c4 20             	add    $0x20,%esp
+  8029f6:	85 c0                	test   %eax,%eax
+  8029f8:	0f 88 f3 02 00 00    	js     802cf1 <spawn+0x6e4>
+                            (uint32_t) UTEMP2 + j * PGSIZE, child,
+                            va + i + j * PGSIZE, perm)) < 0)
+        return r;
+      if ((r = sysbatch_add(&batch, SYS_page_unmap, 0,
+  8029fe:	83 ec 04             	sub    $0x4,%esp
+  802a01:	6a 00                	push   $0x0
+  802a03:	6a 00                	push   $0x0
+  802a05:	6a 00                	push   $0x0
+  802a07:	53                   	push   %ebx
+  802a08:	6a 00                	push   $0x0
+  802a0a:	6a 06                	push   $0x6
+  802a0c:	68 60 67 80 00       	push   $0x806760
+  802a11:	e8 36 e7 ff ff       	call   80114c <sysbatch_add>
+  802a16:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802a1c:	83 c4 20             	add    $0x20,%esp
+  802a1f:	85 c0                	test   %eax,%eax
+  802a21:	79 aa                	jns    8029cd <spawn+0x3c0>
+  802a23:	89 c6                	mov    %eax,%esi
+  802a25:	e9 eb fe ff ff       	jmp    802915 <spawn+0x308>
+  802a2a:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  802a30:	e9 8c fe ff ff       	jmp    8028c1 <spawn+0x2b4>
+  802a35:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  802a3b:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802a41:	83 c6 01             	add    $0x1,%esi
+  802a44:	83 c7 20             	add    $0x20,%edi
+  802a47:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802a4e:	39 f0                	cmp    %esi,%eax
+  802a50:	0f 8e 9b 01 00 00    	jle    802bf1 <spawn+0x5e4>
+    if (ph->p_type != ELF_PROG_LOAD)
+  802a56:	83 3f 01             	cmpl   $0x1,(%edi)
+  802a59:	75 e6                	jne    802a41 <spawn+0x434>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802a5b:	8b 47 18             	mov    0x18(%edi),%eax
+  802a5e:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  802a61:	83 f8 01             	cmp    $0x1,%eax
+  802a64:	19 c0                	sbb    %eax,%eax
+  802a66:	83 e0 fe             	and    $0xfffffffe,%eax
+  802a69:	83 c0 07             	add    $0x7,%eax
+  802a6c:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802a72:	8b 57 04             	mov    0x4(%edi),%edx
+  802a75:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  802a7b:	8b 5f 10             	mov    0x10(%edi),%ebx
+  802a7e:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802a84:	8b 47 14             	mov    0x14(%edi),%eax
+  802a87:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802a8d:	8b 4f 08             	mov    0x8(%edi),%ecx
+  if ((i = PGOFF(va))) {
+  802a90:	89 c8                	mov    %ecx,%eax
+  802a92:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802a97:	74 18                	je     802ab1 <spawn+0x4a4>
+    va -= i;
+  802a99:	29 c1                	sub    %eax,%ecx
+    memsz += i;
+  802a9b:	01 85 7c fd ff ff    	add    %eax,-0x284(%ebp)
+    filesz += i;
+  802aa1:	01 c3                	add    %eax,%ebx
+  802aa3:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+    fileoffset -= i;
+  802aa9:	29 c2                	sub    %eax,%edx
+  802aab:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  802ab1:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802ab8:	00 00 00 
+  802abb:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  802ac1:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  802ac7:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+  802acd:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802ad3:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802ad9:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802adf:	39 c8                	cmp    %ecx,%eax
+  802ae1:	0f 83 4e ff ff ff    	jae    802a35 <spawn+0x428>
+    if (i >= filesz) {
+  802ae7:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  802aed:	39 8d 84 fd ff ff    	cmp    %ecx,-0x27c(%ebp)
+  802af3:	0f 83 8a fd ff ff    	jae    802883 <spawn+0x276>
+    n = MIN(SEGCHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  802af9:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  802aff:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802b05:	29 c6                	sub    %eax,%esi
+  802b07:	8d 86 ff 0f 00 00    	lea    0xfff(%esi),%eax
+  802b0d:	c1 e8 0c             	shr    $0xc,%eax
+  802b10:	ba 10 00 00 00       	mov    $0x10,%edx
+  802b15:	39 d0                	cmp    %edx,%eax
+  802b17:	0f 47 c2             	cmova  %edx,%eax
+  802b1a:	89 c7                	mov    %eax,%edi
+  if ((perm & PTE_W) || PGOFF(fileoffset))
+  802b1c:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  802b22:	83 e3 02             	and    $0x2,%ebx
+  802b25:	8b 95 74 fd ff ff    	mov    -0x28c(%ebp),%edx
+  802b2b:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b31:	09 d3                	or     %edx,%ebx
+  802b33:	0f 85 98 fd ff ff    	jne    8028d1 <spawn+0x2c4>
+    n = MIN(n, (filesz - i) / PGSIZE);
+  802b39:	89 f2                	mov    %esi,%edx
+  802b3b:	c1 ea 0c             	shr    $0xc,%edx
+  802b3e:	39 c2                	cmp    %eax,%edx
+  802b40:	0f 47 d0             	cmova  %eax,%edx
+  802b43:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802b49:	39 8d 8c fd ff ff    	cmp    %ecx,-0x274(%ebp)
+  802b4f:	0f 43 d0             	cmovae %eax,%edx
+    if ((m = shared_pages(perm, memsz, filesz, fileoffset, i, n)) > 0) {
+  802b52:	89 95 60 fd ff ff    	mov    %edx,-0x2a0(%ebp)
+  802b58:	85 d2                	test   %edx,%edx
+  802b5a:	0f 8e 86 fd ff ff    	jle    8028e6 <spawn+0x2d9>
+      if ((r = sysbatch_flush(&batch)) < 0)
+  802b60:	83 ec 0c             	sub    $0xc,%esp
+  802b63:	68 60 67 80 00       	push   $0x806760
+  802b68:	e8 8f e5 ff ff       	call   8010fc <sysbatch_flush>
+  802b6d:	83 c4 10             	add    $0x10,%esp
+  802b70:	85 c0                	test   %eax,%eax
+  802b72:	0f 88 56 01 00 00    	js     802cce <spawn+0x6c1>
+  802b78:	8b 85 60 fd ff ff    	mov    -0x2a0(%ebp),%eax
+  802b7e:	c1 e0 0c             	shl    $0xc,%eax
+  802b81:	89 f1                	mov    %esi,%ecx
+  802b83:	29 c1                	sub    %eax,%ecx
+  802b85:	89 8d 80 fd ff ff    	mov    %ecx,-0x280(%ebp)
+  802b8b:	89 f3                	mov    %esi,%ebx
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  802b8d:	8d be 00 10 40 00    	lea    0x401000(%esi),%edi
+  802b93:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  802b99:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802b9f:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+      for (j = 0; j < n; j++) {
+  802ba2:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802ba8:	39 c3                	cmp    %eax,%ebx
+  802baa:	0f 84 28 fd ff ff    	je     8028d8 <spawn+0x2cb>
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  802bb0:	83 ec 04             	sub    $0x4,%esp
+  802bb3:	89 f8                	mov    %edi,%eax
+  802bb5:	29 d8                	sub    %ebx,%eax
+  802bb7:	50                   	push   %eax
+  802bb8:	89 f0                	mov    %esi,%eax
+  802bba:	29 d8                	sub    %ebx,%eax
+  802bbc:	50                   	push   %eax
+  802bbd:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802bc3:	e8 00 f8 ff ff       	call   8023c8 <read_map>
+  802bc8:	83 c4 10             	add    $0x10,%esp
+  802bcb:	85 c0                	test   %eax,%eax
+  802bcd:	0f 88 02 01 00 00    	js     802cd5 <spawn+0x6c8>
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+  802bd3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bd8:	39 d3                	cmp    %edx,%ebx
+  802bda:	0f 46 d3             	cmovbe %ebx,%edx
+  802bdd:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802be3:	39 d0                	cmp    %edx,%eax
+  802be5:	73 bb                	jae    802ba2 <spawn+0x595>
+          return -E_INVAL;
+  802be7:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+  802bec:	e9 24 fd ff ff       	jmp    802915 <spawn+0x308>
+  close(fd);
+  802bf1:	83 ec 0c             	sub    $0xc,%esp
+  802bf4:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802bfa:	e8 7a eb ff ff       	call   801779 <close>
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  // LAB 5: Your code here.
+  return sysbatch_add(&batch, SYS_page_map_range, 0, 0, UTOP,
+  802bff:	83 c4 0c             	add    $0xc,%esp
+  802c02:	6a 02                	push   $0x2
+  802c04:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802c0a:	68 00 00 c0 ee       	push   $0xeec00000
+  802c0f:	6a 00                	push   $0x0
+  802c11:	6a 00                	push   $0x0
+  802c13:	6a 11                	push   $0x11
+  802c15:	68 60 67 80 00       	push   $0x806760
+  802c1a:	e8 2d e5 ff ff       	call   80114c <sysbatch_add>
+  if ((r = copy_shared_pages(child)) < 0)
+  802c1f:	83 c4 20             	add    $0x20,%esp
+  802c22:	85 c0                	test   %eax,%eax
+  802c24:	78 72                	js     802c98 <spawn+0x68b>
+  if ((r = sysbatch_add(&batch, SYS_env_set_trapframe, child,
+  802c26:	83 ec 04             	sub    $0x4,%esp
+  802c29:	6a 00                	push   $0x0
+  802c2b:	6a 00                	push   $0x0
+  802c2d:	6a 00                	push   $0x0
+  802c2f:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802c35:	50                   	push   %eax
+  802c36:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+  802c3c:	57                   	push   %edi
+  802c3d:	6a 09                	push   $0x9
+  802c3f:	68 60 67 80 00       	push   $0x806760
+  802c44:	e8 03 e5 ff ff       	call   80114c <sysbatch_add>
+  802c49:	83 c4 20             	add    $0x20,%esp
+  802c4c:	85 c0                	test   %eax,%eax
+  802c4e:	78 33                	js     802c83 <spawn+0x676>
+      (r = sysbatch_add(&batch, SYS_env_set_status, child,
+  802c50:	83 ec 04             	sub    $0x4,%esp
+  802c53:	6a 00                	push   $0x0
+  802c55:	6a 00                	push   $0x0
+  802c57:	6a 00                	push   $0x0
+  802c59:	6a 02                	push   $0x2
+  802c5b:	57                   	push   %edi
+  802c5c:	6a 08                	push   $0x8
+  802c5e:	68 60 67 80 00       	push   $0x806760
+  802c63:	e8 e4 e4 ff ff       	call   80114c <sysbatch_add>
+                        (uint32_t) &child_tf, 0, 0, 0)) < 0 ||
+  802c68:	83 c4 20             	add    $0x20,%esp
+  802c6b:	85 c0                	test   %eax,%eax
+  802c6d:	78 14                	js     802c83 <spawn+0x676>
+      (r = sysbatch_flush(&batch)) < 0)
+  802c6f:	83 ec 0c             	sub    $0xc,%esp
+  802c72:	68 60 67 80 00       	push   $0x806760
+  802c77:	e8 80 e4 ff ff       	call   8010fc <sysbatch_flush>
+                        ENV_RUNNABLE, 0, 0, 0)) < 0 ||
+  802c7c:	83 c4 10             	add    $0x10,%esp
+  802c7f:	85 c0                	test   %eax,%eax
+  802c81:	79 36                	jns    802cb9 <spawn+0x6ac>
+    panic("spawn: starting child: %e", r);
+  802c83:	50                   	push   %eax
+  802c84:	68 5c 48 80 00       	push   $0x80485c
+  802c89:	68 93 00 00 00       	push   $0x93
+  802c8e:	68 3a 48 80 00       	push   $0x80483a
+  802c93:	e8 69 d5 ff ff       	call   800201 <_panic>
+    panic("copy_shared_pages: %e", r);
+  802c98:	50                   	push   %eax
+  802c99:	68 46 48 80 00       	push   $0x804846
+  802c9e:	68 8c 00 00 00       	push   $0x8c
+  802ca3:	68 3a 48 80 00       	push   $0x80483a
+  802ca8:	e8 54 d5 ff ff       	call   800201 <_panic>
+    return r;
+  802cad:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802cb3:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+}
+  802cb9:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802cbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cc2:	5b                   	pop    %ebx
+  802cc3:	5e                   	pop    %esi
+  802cc4:	5f                   	pop    %edi
+  802cc5:	5d                   	pop    %ebp
+  802cc6:	c3                   	ret
+  802cc7:	89 c6                	mov    %eax,%esi
+  802cc9:	e9 47 fc ff ff       	jmp    802915 <spawn+0x308>
+  802cce:	89 c6                	mov    %eax,%esi
+  802cd0:	e9 40 fc ff ff       	jmp    802915 <spawn+0x308>
+  802cd5:	89 c6                	mov    %eax,%esi
+  802cd7:	e9 39 fc ff ff       	jmp    802915 <spawn+0x308>
+  802cdc:	89 c6                	mov    %eax,%esi
+  802cde:	e9 32 fc ff ff       	jmp    802915 <spawn+0x308>
+  802ce3:	89 c6                	mov    %eax,%esi
+  802ce5:	e9 2b fc ff ff       	jmp    802915 <spawn+0x308>
+  802cea:	89 c6                	mov    %eax,%esi
+  802cec:	e9 24 fc ff ff       	jmp    802915 <spawn+0x308>
+  802cf1:	89 c6                	mov    %eax,%esi
+  802cf3:	e9 1d fc ff ff       	jmp    802915 <spawn+0x308>
+    return -E_NO_MEM;
+  802cf8:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  802cfd:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+  802d03:	eb b4                	jmp    802cb9 <spawn+0x6ac>
+  sys_page_unmap(0, UTEMP);
+  802d05:	83 ec 08             	sub    $0x8,%esp
+  802d08:	68 00 00 40 00       	push   $0x400000
+  802d0d:	6a 00                	push   $0x0
+  802d0f:	e8 6a e0 ff ff       	call   800d7e <sys_page_unmap>
+  802d14:	83 c4 10             	add    $0x10,%esp
+  802d17:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  802d1d:	eb 9a                	jmp    802cb9 <spawn+0x6ac>
+
+00802d1f <spawnl>:
+{
+  802d1f:	55                   	push   %ebp
+  802d20:	89 e5                	mov    %esp,%ebp
+  802d22:	56                   	push   %esi
+  802d23:	53                   	push   %ebx
+  va_start(vl, arg0);
+  802d24:	8d 45 10             	lea    0x10(%ebp),%eax
+  int argc = 0;
+  802d27:	be 00 00 00 00       	mov    $0x0,%esi
+  while (va_arg(vl, void *) != NULL) {
+  802d2c:	eb 17                	jmp    802d45 <spawnl+0x26>
+      cprintf("vl: %p saying %s\n", vl, vl);
+  802d2e:	83 ec 04             	sub    $0x4,%esp
+  802d31:	53                   	push   %ebx
+  802d32:	53                   	push   %ebx
+  802d33:	68 76 48 80 00       	push   $0x804876
+  802d38:	e8 9f d5 ff ff       	call   8002dc <cprintf>
+    argc++;
+  802d3d:	83 c6 01             	add    $0x1,%esi
+  802d40:	83 c4 10             	add    $0x10,%esp
+  while (va_arg(vl, void *) != NULL) {
+  802d43:	89 d8                	mov    %ebx,%eax
+  802d45:	8d 58 04             	lea    0x4(%eax),%ebx
+  802d48:	83 38 00             	cmpl   $0x0,(%eax)
+  802d4b:	75 e1                	jne    802d2e <spawnl+0xf>
+  cprintf("argc found %d\n", argc);
+  802d4d:	83 ec 08             	sub    $0x8,%esp
+  802d50:	56                   	push   %esi
+  802d51:	68 88 48 80 00       	push   $0x804888
+  802d56:	e8 81 d5 ff ff       	call   8002dc <cprintf>
+  const char *argv[argc+2];
+  802d5b:	8d 04 b5 17 00 00 00 	lea    0x17(,%esi,4),%eax
+  802d62:	83 e0 f0             	and    $0xfffffff0,%eax
+  802d65:	83 c4 10             	add    $0x10,%esp
+  802d68:	29 c4                	sub    %eax,%esp
+  802d6a:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802d6e:	89 d8                	mov    %ebx,%eax
+  802d70:	c1 e8 02             	shr    $0x2,%eax
+  802d73:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  802d76:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d79:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  argv[argc+1] = NULL;
+  802d80:	c7 44 b3 04 00 00 00 	movl   $0x0,0x4(%ebx,%esi,4)
+  802d87:	00 
+  va_start(vl, arg0);
+  802d88:	8d 55 10             	lea    0x10(%ebp),%edx
+  for (i = 0; i < argc; i++)
+  802d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d90:	eb 0b                	jmp    802d9d <spawnl+0x7e>
+    argv[i+1] = va_arg(vl, const char *);
+  802d92:	83 c0 01             	add    $0x1,%eax
+  802d95:	8b 0a                	mov    (%edx),%ecx
+  802d97:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802d9a:	8d 52 04             	lea    0x4(%edx),%edx
+  for (i = 0; i < argc; i++)
+  802d9d:	39 f0                	cmp    %esi,%eax
+  802d9f:	75 f1                	jne    802d92 <spawnl+0x73>
+  return spawn(prog, argv);
+  802da1:	83 ec 08             	sub    $0x8,%esp
+  802da4:	53                   	push   %ebx
+  802da5:	ff 75 08             	push   0x8(%ebp)
+  802da8:	e8 60 f8 ff ff       	call   80260d <spawn>
+}
+  802dad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802db0:	5b                   	pop    %ebx
+  802db1:	5e                   	pop    %esi
+  802db2:	5d                   	pop    %ebp
+  802db3:	c3                   	ret
+
+00802db4 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802db4:	55                   	push   %ebp
+  802db5:	89 e5                	mov    %esp,%ebp
+  802db7:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802dba:	50                   	push   %eax
+  802dbb:	e8 2c e8 ff ff       	call   8015ec <fd2data>
+  802dc0:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802dc5:	c9                   	leave
+  802dc6:	c3                   	ret
+
+00802dc7 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802dc7:	55                   	push   %ebp
+  802dc8:	89 e5                	mov    %esp,%ebp
+  802dca:	56                   	push   %esi
+  802dcb:	53                   	push   %ebx
+  802dcc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802dcf:	83 ec 0c             	sub    $0xc,%esp
+  802dd2:	ff 75 08             	push   0x8(%ebp)
+  802dd5:	e8 12 e8 ff ff       	call   8015ec <fd2data>
+  802dda:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802ddc:	83 c4 08             	add    $0x8,%esp
+  802ddf:	68 be 48 80 00       	push   $0x8048be
+  802de4:	53                   	push   %ebx
+  802de5:	e8 e0 da ff ff       	call   8008ca <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802dea:	8b 46 04             	mov    0x4(%esi),%eax
+  802ded:	2b 06                	sub    (%esi),%eax
+  802def:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802df5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802dfc:	00 00 00 
+  stat->st_dev = &devpipe;
+  802dff:	c7 83 88 00 00 00 28 	movl   $0x805028,0x88(%ebx)
+  802e06:	50 80 00 
+  return 0;
+}
+  802e09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e0e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e11:	5b                   	pop    %ebx
+  802e12:	5e                   	pop    %esi
+  802e13:	5d                   	pop    %ebp
+  802e14:	c3                   	ret
+
+00802e15 <pipe_wakeup>:
+{
+  802e15:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e1c:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802e1f:	85 c0                	test   %eax,%eax
+  802e21:	75 01                	jne    802e24 <pipe_wakeup+0xf>
+  802e23:	c3                   	ret
+{
+  802e24:	55                   	push   %ebp
+  802e25:	89 e5                	mov    %esp,%ebp
+  802e27:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802e2a:	6a 00                	push   $0x0
+  802e2c:	68 00 00 c0 ee       	push   $0xeec00000
+  802e31:	52                   	push   %edx
+  802e32:	e8 1e e2 ff ff       	call   801055 <sys_chan_wakeup>
+  802e37:	83 c4 10             	add    $0x10,%esp
+}
+  802e3a:	c9                   	leave
+  802e3b:	c3                   	ret
+
+00802e3c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e3c:	55                   	push   %ebp
+  802e3d:	89 e5                	mov    %esp,%ebp
+  802e3f:	57                   	push   %edi
+  802e40:	56                   	push   %esi
+  802e41:	53                   	push   %ebx
+  802e42:	83 ec 18             	sub    $0x18,%esp
+  802e45:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802e48:	57                   	push   %edi
+  802e49:	e8 9e e7 ff ff       	call   8015ec <fd2data>
+  802e4e:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802e50:	83 c4 10             	add    $0x10,%esp
+  802e53:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802e57:	74 2a                	je     802e83 <devpipe_close+0x47>
+  802e59:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802e5e:	89 f8                	mov    %edi,%eax
+  802e60:	e8 4f ff ff ff       	call   802db4 <pipe_ring>
+  802e65:	83 ec 08             	sub    $0x8,%esp
+  802e68:	01 d8                	add    %ebx,%eax
+  802e6a:	50                   	push   %eax
+  802e6b:	6a 00                	push   $0x0
+  802e6d:	e8 0c df ff ff       	call   800d7e <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802e72:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802e78:	83 c4 10             	add    $0x10,%esp
+  802e7b:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802e81:	75 db                	jne    802e5e <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802e83:	83 ec 08             	sub    $0x8,%esp
+  802e86:	57                   	push   %edi
+  802e87:	6a 00                	push   $0x0
+  802e89:	e8 f0 de ff ff       	call   800d7e <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802e8e:	83 c4 10             	add    $0x10,%esp
+  802e91:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802e95:	75 13                	jne    802eaa <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802e97:	83 ec 08             	sub    $0x8,%esp
+  802e9a:	56                   	push   %esi
+  802e9b:	6a 00                	push   $0x0
+  802e9d:	e8 dc de ff ff       	call   800d7e <sys_page_unmap>
+}
+  802ea2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ea5:	5b                   	pop    %ebx
+  802ea6:	5e                   	pop    %esi
+  802ea7:	5f                   	pop    %edi
+  802ea8:	5d                   	pop    %ebp
+  802ea9:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802eaa:	8d 56 04             	lea    0x4(%esi),%edx
+  802ead:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802eb0:	e8 60 ff ff ff       	call   802e15 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802eb5:	8d 46 30             	lea    0x30(%esi),%eax
+  802eb8:	89 f2                	mov    %esi,%edx
+  802eba:	e8 56 ff ff ff       	call   802e15 <pipe_wakeup>
+  802ebf:	eb d6                	jmp    802e97 <devpipe_close+0x5b>
+
+00802ec1 <_pipeisclosed>:
+{
+  802ec1:	55                   	push   %ebp
+  802ec2:	89 e5                	mov    %esp,%ebp
+  802ec4:	57                   	push   %edi
+  802ec5:	56                   	push   %esi
+  802ec6:	53                   	push   %ebx
+  802ec7:	83 ec 1c             	sub    $0x1c,%esp
+  802eca:	89 c7                	mov    %eax,%edi
+  802ecc:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802ece:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  802ed3:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802ed6:	83 ec 0c             	sub    $0xc,%esp
+  802ed9:	57                   	push   %edi
+  802eda:	e8 ea 10 00 00       	call   803fc9 <pageref>
+  802edf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ee2:	89 34 24             	mov    %esi,(%esp)
+  802ee5:	e8 df 10 00 00       	call   803fc9 <pageref>
+    nn = thisenv->env_runs;
+  802eea:	8b 15 c0 6f 80 00    	mov    0x806fc0,%edx
+  802ef0:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802ef3:	83 c4 10             	add    $0x10,%esp
+  802ef6:	39 cb                	cmp    %ecx,%ebx
+  802ef8:	74 1b                	je     802f15 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802efa:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802efd:	75 cf                	jne    802ece <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802eff:	8b 42 58             	mov    0x58(%edx),%eax
+  802f02:	6a 01                	push   $0x1
+  802f04:	50                   	push   %eax
+  802f05:	53                   	push   %ebx
+  802f06:	68 c5 48 80 00       	push   $0x8048c5
+  802f0b:	e8 cc d3 ff ff       	call   8002dc <cprintf>
+  802f10:	83 c4 10             	add    $0x10,%esp
+  802f13:	eb b9                	jmp    802ece <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802f15:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802f18:	0f 94 c0             	sete   %al
+  802f1b:	0f b6 c0             	movzbl %al,%eax
+}
+  802f1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f21:	5b                   	pop    %ebx
+  802f22:	5e                   	pop    %esi
+  802f23:	5f                   	pop    %edi
+  802f24:	5d                   	pop    %ebp
+  802f25:	c3                   	ret
+
+00802f26 <devpipe_write_bulk>:
+{
+  802f26:	55                   	push   %ebp
+  802f27:	89 e5                	mov    %esp,%ebp
+  802f29:	57                   	push   %edi
+  802f2a:	56                   	push   %esi
+  802f2b:	53                   	push   %ebx
+  802f2c:	83 ec 1c             	sub    $0x1c,%esp
+  802f2f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802f32:	89 d6                	mov    %edx,%esi
+  802f34:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802f37:	e8 78 fe ff ff       	call   802db4 <pipe_ring>
+  802f3c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802f3f:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802f44:	8d 46 04             	lea    0x4(%esi),%eax
+  802f47:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802f4a:	eb 75                	jmp    802fc1 <devpipe_write_bulk+0x9b>
+  802f4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f51:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802f55:	6a 64                	push   $0x64
+  802f57:	68 00 00 c0 ee       	push   $0xeec00000
+  802f5c:	53                   	push   %ebx
+  802f5d:	56                   	push   %esi
+  802f5e:	e8 cf e0 ff ff       	call   801032 <sys_chan_sleep>
+      continue;
+  802f63:	83 c4 10             	add    $0x10,%esp
+  802f66:	eb 59                	jmp    802fc1 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802f68:	89 d1                	mov    %edx,%ecx
+  802f6a:	c1 f9 1f             	sar    $0x1f,%ecx
+  802f6d:	c1 e9 11             	shr    $0x11,%ecx
+  802f70:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802f73:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802f78:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802f7a:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802f80:	29 d3                	sub    %edx,%ebx
+  802f82:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802f87:	29 c2                	sub    %eax,%edx
+  802f89:	39 d3                	cmp    %edx,%ebx
+  802f8b:	0f 47 da             	cmova  %edx,%ebx
+  802f8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802f91:	29 fa                	sub    %edi,%edx
+  802f93:	39 d3                	cmp    %edx,%ebx
+  802f95:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802f98:	83 ec 04             	sub    $0x4,%esp
+  802f9b:	53                   	push   %ebx
+  802f9c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802f9f:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802fa2:	52                   	push   %edx
+  802fa3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802fa6:	01 c8                	add    %ecx,%eax
+  802fa8:	50                   	push   %eax
+  802fa9:	e8 04 db ff ff       	call   800ab2 <memcpy>
+    i += m;
+  802fae:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802fb0:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802fb3:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802fb6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802fb9:	e8 57 fe ff ff       	call   802e15 <pipe_wakeup>
+  802fbe:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802fc1:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802fc4:	73 2b                	jae    802ff1 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802fc6:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802fc8:	8b 56 04             	mov    0x4(%esi),%edx
+  802fcb:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802fd1:	39 d0                	cmp    %edx,%eax
+  802fd3:	7d 93                	jge    802f68 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802fd5:	89 f2                	mov    %esi,%edx
+  802fd7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802fda:	e8 e2 fe ff ff       	call   802ec1 <_pipeisclosed>
+  802fdf:	85 c0                	test   %eax,%eax
+  802fe1:	0f 84 65 ff ff ff    	je     802f4c <devpipe_write_bulk+0x26>
+        return i;
+  802fe7:	89 f8                	mov    %edi,%eax
+}
+  802fe9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fec:	5b                   	pop    %ebx
+  802fed:	5e                   	pop    %esi
+  802fee:	5f                   	pop    %edi
+  802fef:	5d                   	pop    %ebp
+  802ff0:	c3                   	ret
+  return i;
+  802ff1:	89 f8                	mov    %edi,%eax
+  802ff3:	eb f4                	jmp    802fe9 <devpipe_write_bulk+0xc3>
+
+00802ff5 <devpipe_write>:
+{
+  802ff5:	55                   	push   %ebp
+  802ff6:	89 e5                	mov    %esp,%ebp
+  802ff8:	57                   	push   %edi
+  802ff9:	56                   	push   %esi
+  802ffa:	53                   	push   %ebx
+  802ffb:	83 ec 28             	sub    $0x28,%esp
+  802ffe:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  803001:	56                   	push   %esi
+  803002:	e8 e5 e5 ff ff       	call   8015ec <fd2data>
+  803007:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  803009:	8b 78 28             	mov    0x28(%eax),%edi
+  80300c:	83 c4 10             	add    $0x10,%esp
+  80300f:	85 ff                	test   %edi,%edi
+  803011:	75 25                	jne    803038 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  803013:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803016:	74 66                	je     80307e <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803018:	8b 43 04             	mov    0x4(%ebx),%eax
+  80301b:	8b 0b                	mov    (%ebx),%ecx
+  80301d:	8d 51 20             	lea    0x20(%ecx),%edx
+  803020:	39 d0                	cmp    %edx,%eax
+  803022:	72 2b                	jb     80304f <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  803024:	89 da                	mov    %ebx,%edx
+  803026:	89 f0                	mov    %esi,%eax
+  803028:	e8 94 fe ff ff       	call   802ec1 <_pipeisclosed>
+  80302d:	85 c0                	test   %eax,%eax
+  80302f:	75 51                	jne    803082 <devpipe_write+0x8d>
+      sys_yield();
+  803031:	e8 61 dc ff ff       	call   800c97 <sys_yield>
+  803036:	eb e0                	jmp    803018 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  803038:	83 ec 0c             	sub    $0xc,%esp
+  80303b:	ff 75 10             	push   0x10(%ebp)
+  80303e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803041:	89 c2                	mov    %eax,%edx
+  803043:	89 f0                	mov    %esi,%eax
+  803045:	e8 dc fe ff ff       	call   802f26 <devpipe_write_bulk>
+  80304a:	83 c4 10             	add    $0x10,%esp
+  80304d:	eb 38                	jmp    803087 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80304f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803052:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803056:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803059:	89 c2                	mov    %eax,%edx
+  80305b:	c1 fa 1f             	sar    $0x1f,%edx
+  80305e:	89 d1                	mov    %edx,%ecx
+  803060:	c1 e9 1b             	shr    $0x1b,%ecx
+  803063:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803066:	83 e2 1f             	and    $0x1f,%edx
+  803069:	29 ca                	sub    %ecx,%edx
+  80306b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80306f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  803073:	83 c0 01             	add    $0x1,%eax
+  803076:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  803079:	83 c7 01             	add    $0x1,%edi
+  80307c:	eb 95                	jmp    803013 <devpipe_write+0x1e>
+  return i;
+  80307e:	89 f8                	mov    %edi,%eax
+  803080:	eb 05                	jmp    803087 <devpipe_write+0x92>
+        return 0;
+  803082:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803087:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80308a:	5b                   	pop    %ebx
+  80308b:	5e                   	pop    %esi
+  80308c:	5f                   	pop    %edi
+  80308d:	5d                   	pop    %ebp
+  80308e:	c3                   	ret
+
+0080308f <devpipe_read_bulk>:
+{
+  80308f:	55                   	push   %ebp
+  803090:	89 e5                	mov    %esp,%ebp
+  803092:	57                   	push   %edi
+  803093:	56                   	push   %esi
+  803094:	53                   	push   %ebx
+  803095:	83 ec 2c             	sub    $0x2c,%esp
+  803098:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80309b:	89 d6                	mov    %edx,%esi
+  80309d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8030a0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  8030a3:	e8 0c fd ff ff       	call   802db4 <pipe_ring>
+  8030a8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8030ab:	85 db                	test   %ebx,%ebx
+  8030ad:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8030b2:	0f 45 c3             	cmovne %ebx,%eax
+  8030b5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8030b8:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8030bd:	8d 46 30             	lea    0x30(%esi),%eax
+  8030c0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8030c3:	eb 50                	jmp    803115 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8030c5:	89 d1                	mov    %edx,%ecx
+  8030c7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8030ca:	c1 e9 11             	shr    $0x11,%ecx
+  8030cd:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8030d0:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8030d5:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8030d7:	29 d3                	sub    %edx,%ebx
+  8030d9:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8030de:	29 c2                	sub    %eax,%edx
+  8030e0:	39 d3                	cmp    %edx,%ebx
+  8030e2:	0f 47 da             	cmova  %edx,%ebx
+  8030e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8030e8:	29 fa                	sub    %edi,%edx
+  8030ea:	39 d3                	cmp    %edx,%ebx
+  8030ec:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8030ef:	83 ec 04             	sub    $0x4,%esp
+  8030f2:	53                   	push   %ebx
+  8030f3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8030f6:	01 c8                	add    %ecx,%eax
+  8030f8:	50                   	push   %eax
+  8030f9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8030fc:	01 f8                	add    %edi,%eax
+  8030fe:	50                   	push   %eax
+  8030ff:	e8 ae d9 ff ff       	call   800ab2 <memcpy>
+    i += m;
+  803104:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  803106:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  803108:	89 f2                	mov    %esi,%edx
+  80310a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80310d:	e8 03 fd ff ff       	call   802e15 <pipe_wakeup>
+  803112:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  803115:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  803118:	73 51                	jae    80316b <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  80311a:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  80311d:	8b 16                	mov    (%esi),%edx
+  80311f:	39 da                	cmp    %ebx,%edx
+  803121:	75 a2                	jne    8030c5 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  803123:	85 ff                	test   %edi,%edi
+  803125:	75 44                	jne    80316b <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  803127:	89 f2                	mov    %esi,%edx
+  803129:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80312c:	e8 90 fd ff ff       	call   802ec1 <_pipeisclosed>
+  803131:	85 c0                	test   %eax,%eax
+  803133:	75 3a                	jne    80316f <devpipe_read_bulk+0xe0>
+  803135:	b8 01 00 00 00       	mov    $0x1,%eax
+  80313a:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80313e:	6a 64                	push   $0x64
+  803140:	ff 75 d4             	push   -0x2c(%ebp)
+  803143:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  803144:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  803147:	50                   	push   %eax
+  803148:	e8 e5 de ff ff       	call   801032 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80314d:	85 c0                	test   %eax,%eax
+  80314f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803154:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  803157:	83 c4 10             	add    $0x10,%esp
+  80315a:	a8 01                	test   $0x1,%al
+  80315c:	74 b7                	je     803115 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  80315e:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  803163:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803166:	5b                   	pop    %ebx
+  803167:	5e                   	pop    %esi
+  803168:	5f                   	pop    %edi
+  803169:	5d                   	pop    %ebp
+  80316a:	c3                   	ret
+  return i;
+  80316b:	89 f8                	mov    %edi,%eax
+  80316d:	eb f4                	jmp    803163 <devpipe_read_bulk+0xd4>
+        return 0;
+  80316f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803174:	eb ed                	jmp    803163 <devpipe_read_bulk+0xd4>
+
+00803176 <devpipe_read>:
+{
+  803176:	55                   	push   %ebp
+  803177:	89 e5                	mov    %esp,%ebp
+  803179:	57                   	push   %edi
+  80317a:	56                   	push   %esi
+  80317b:	53                   	push   %ebx
+  80317c:	83 ec 18             	sub    $0x18,%esp
+  80317f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  803182:	57                   	push   %edi
+  803183:	e8 64 e4 ff ff       	call   8015ec <fd2data>
+  803188:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80318a:	8b 70 28             	mov    0x28(%eax),%esi
+  80318d:	83 c4 10             	add    $0x10,%esp
+  803190:	85 f6                	test   %esi,%esi
+  803192:	75 24                	jne    8031b8 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  803194:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803197:	74 60                	je     8031f9 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  803199:	8b 03                	mov    (%ebx),%eax
+  80319b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80319e:	75 3b                	jne    8031db <devpipe_read+0x65>
+      if (i > 0)
+  8031a0:	85 f6                	test   %esi,%esi
+  8031a2:	75 2d                	jne    8031d1 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  8031a4:	89 da                	mov    %ebx,%edx
+  8031a6:	89 f8                	mov    %edi,%eax
+  8031a8:	e8 14 fd ff ff       	call   802ec1 <_pipeisclosed>
+  8031ad:	85 c0                	test   %eax,%eax
+  8031af:	75 4c                	jne    8031fd <devpipe_read+0x87>
+      sys_yield();
+  8031b1:	e8 e1 da ff ff       	call   800c97 <sys_yield>
+  8031b6:	eb e1                	jmp    803199 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  8031b8:	83 ec 08             	sub    $0x8,%esp
+  8031bb:	6a 00                	push   $0x0
+  8031bd:	ff 75 10             	push   0x10(%ebp)
+  8031c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031c3:	89 c2                	mov    %eax,%edx
+  8031c5:	89 f8                	mov    %edi,%eax
+  8031c7:	e8 c3 fe ff ff       	call   80308f <devpipe_read_bulk>
+  8031cc:	83 c4 10             	add    $0x10,%esp
+  8031cf:	eb 02                	jmp    8031d3 <devpipe_read+0x5d>
+        return i;
+  8031d1:	89 f0                	mov    %esi,%eax
+}
+  8031d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031d6:	5b                   	pop    %ebx
+  8031d7:	5e                   	pop    %esi
+  8031d8:	5f                   	pop    %edi
+  8031d9:	5d                   	pop    %ebp
+  8031da:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8031db:	99                   	cltd
+  8031dc:	c1 ea 1b             	shr    $0x1b,%edx
+  8031df:	01 d0                	add    %edx,%eax
+  8031e1:	83 e0 1f             	and    $0x1f,%eax
+  8031e4:	29 d0                	sub    %edx,%eax
+  8031e6:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8031eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031ee:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8031f1:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8031f4:	83 c6 01             	add    $0x1,%esi
+  8031f7:	eb 9b                	jmp    803194 <devpipe_read+0x1e>
+  return i;
+  8031f9:	89 f0                	mov    %esi,%eax
+  8031fb:	eb d6                	jmp    8031d3 <devpipe_read+0x5d>
+        return 0;
+  8031fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803202:	eb cf                	jmp    8031d3 <devpipe_read+0x5d>
+
+00803204 <pipe2>:
+{
+  803204:	55                   	push   %ebp
+  803205:	89 e5                	mov    %esp,%ebp
+  803207:	57                   	push   %edi
+  803208:	56                   	push   %esi
+  803209:	53                   	push   %ebx
+  80320a:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  80320d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803210:	50                   	push   %eax
+  803211:	e8 ea e3 ff ff       	call   801600 <fd_alloc>
+  803216:	89 c3                	mov    %eax,%ebx
+  803218:	83 c4 10             	add    $0x10,%esp
+  80321b:	85 c0                	test   %eax,%eax
+  80321d:	0f 88 fb 01 00 00    	js     80341e <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803223:	83 ec 04             	sub    $0x4,%esp
+  803226:	68 07 04 00 00       	push   $0x407
+  80322b:	ff 75 e4             	push   -0x1c(%ebp)
+  80322e:	6a 00                	push   $0x0
+  803230:	e8 c4 da ff ff       	call   800cf9 <sys_page_alloc>
+  803235:	89 c3                	mov    %eax,%ebx
+  803237:	83 c4 10             	add    $0x10,%esp
+  80323a:	85 c0                	test   %eax,%eax
+  80323c:	0f 88 dc 01 00 00    	js     80341e <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  803242:	83 ec 0c             	sub    $0xc,%esp
+  803245:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  803248:	50                   	push   %eax
+  803249:	e8 b2 e3 ff ff       	call   801600 <fd_alloc>
+  80324e:	89 c3                	mov    %eax,%ebx
+  803250:	83 c4 10             	add    $0x10,%esp
+  803253:	85 c0                	test   %eax,%eax
+  803255:	0f 88 b3 01 00 00    	js     80340e <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80325b:	83 ec 04             	sub    $0x4,%esp
+  80325e:	68 07 04 00 00       	push   $0x407
+  803263:	ff 75 e0             	push   -0x20(%ebp)
+  803266:	6a 00                	push   $0x0
+  803268:	e8 8c da ff ff       	call   800cf9 <sys_page_alloc>
+  80326d:	89 c3                	mov    %eax,%ebx
+  80326f:	83 c4 10             	add    $0x10,%esp
+  803272:	85 c0                	test   %eax,%eax
+  803274:	0f 88 94 01 00 00    	js     80340e <pipe2+0x20a>
+  va = fd2data(fd0);
+  80327a:	83 ec 0c             	sub    $0xc,%esp
+  80327d:	ff 75 e4             	push   -0x1c(%ebp)
+  803280:	e8 67 e3 ff ff       	call   8015ec <fd2data>
+  803285:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803287:	83 c4 0c             	add    $0xc,%esp
+  80328a:	68 07 04 00 00       	push   $0x407
+  80328f:	50                   	push   %eax
+  803290:	6a 00                	push   $0x0
+  803292:	e8 62 da ff ff       	call   800cf9 <sys_page_alloc>
+  803297:	89 c3                	mov    %eax,%ebx
+  803299:	83 c4 10             	add    $0x10,%esp
+  80329c:	85 c0                	test   %eax,%eax
+  80329e:	0f 88 5a 01 00 00    	js     8033fe <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032a4:	83 ec 0c             	sub    $0xc,%esp
+  8032a7:	ff 75 e0             	push   -0x20(%ebp)
+  8032aa:	e8 3d e3 ff ff       	call   8015ec <fd2data>
+  8032af:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8032b6:	50                   	push   %eax
+  8032b7:	6a 00                	push   $0x0
+  8032b9:	57                   	push   %edi
+  8032ba:	6a 00                	push   $0x0
+  8032bc:	e8 7b da ff ff       	call   800d3c <sys_page_map>
+  8032c1:	89 c3                	mov    %eax,%ebx
+  8032c3:	83 c4 20             	add    $0x20,%esp
+  8032c6:	85 c0                	test   %eax,%eax
+  8032c8:	0f 88 22 01 00 00    	js     8033f0 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  8032ce:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  8032d2:	74 72                	je     803346 <pipe2+0x142>
+  8032d4:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8032d9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032dc:	e8 d3 fa ff ff       	call   802db4 <pipe_ring>
+  8032e1:	83 ec 04             	sub    $0x4,%esp
+  8032e4:	68 07 04 00 00       	push   $0x407
+  8032e9:	01 f0                	add    %esi,%eax
+  8032eb:	50                   	push   %eax
+  8032ec:	6a 00                	push   $0x0
+  8032ee:	e8 06 da ff ff       	call   800cf9 <sys_page_alloc>
+  8032f3:	89 c3                	mov    %eax,%ebx
+  8032f5:	83 c4 10             	add    $0x10,%esp
+  8032f8:	85 c0                	test   %eax,%eax
+  8032fa:	0f 88 97 00 00 00    	js     803397 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  803300:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803303:	e8 ac fa ff ff       	call   802db4 <pipe_ring>
+  803308:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  80330b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80330e:	e8 a1 fa ff ff       	call   802db4 <pipe_ring>
+  803313:	83 ec 0c             	sub    $0xc,%esp
+  803316:	68 07 04 00 00       	push   $0x407
+  80331b:	53                   	push   %ebx
+  80331c:	6a 00                	push   $0x0
+  80331e:	01 f0                	add    %esi,%eax
+  803320:	50                   	push   %eax
+  803321:	6a 00                	push   $0x0
+  803323:	e8 14 da ff ff       	call   800d3c <sys_page_map>
+  803328:	89 c3                	mov    %eax,%ebx
+  80332a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803330:	83 c4 20             	add    $0x20,%esp
+  803333:	85 c0                	test   %eax,%eax
+  803335:	78 60                	js     803397 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  803337:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80333d:	75 9a                	jne    8032d9 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  80333f:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  803346:	a1 28 50 80 00       	mov    0x805028,%eax
+  80334b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80334e:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  803350:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803353:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  80335a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80335d:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  80335f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803362:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  803369:	83 ec 0c             	sub    $0xc,%esp
+  80336c:	ff 75 e4             	push   -0x1c(%ebp)
+  80336f:	e8 68 e2 ff ff       	call   8015dc <fd2num>
+  803374:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803377:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  803379:	83 c4 04             	add    $0x4,%esp
+  80337c:	ff 75 e0             	push   -0x20(%ebp)
+  80337f:	e8 58 e2 ff ff       	call   8015dc <fd2num>
+  803384:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803387:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  80338a:	83 c4 10             	add    $0x10,%esp
+  80338d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803392:	e9 87 00 00 00       	jmp    80341e <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  803397:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80339c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80339f:	e8 10 fa ff ff       	call   802db4 <pipe_ring>
+  8033a4:	83 ec 08             	sub    $0x8,%esp
+  8033a7:	01 f0                	add    %esi,%eax
+  8033a9:	50                   	push   %eax
+  8033aa:	6a 00                	push   $0x0
+  8033ac:	e8 cd d9 ff ff       	call   800d7e <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  8033b1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8033b4:	e8 fb f9 ff ff       	call   802db4 <pipe_ring>
+  8033b9:	83 c4 08             	add    $0x8,%esp
+  8033bc:	01 f0                	add    %esi,%eax
+  8033be:	50                   	push   %eax
+  8033bf:	6a 00                	push   $0x0
+  8033c1:	e8 b8 d9 ff ff       	call   800d7e <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8033c6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8033cc:	83 c4 10             	add    $0x10,%esp
+  8033cf:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8033d5:	75 c5                	jne    80339c <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  8033d7:	83 ec 0c             	sub    $0xc,%esp
+  8033da:	ff 75 e0             	push   -0x20(%ebp)
+  8033dd:	e8 0a e2 ff ff       	call   8015ec <fd2data>
+  8033e2:	83 c4 08             	add    $0x8,%esp
+  8033e5:	50                   	push   %eax
+  8033e6:	6a 00                	push   $0x0
+  8033e8:	e8 91 d9 ff ff       	call   800d7e <sys_page_unmap>
+  8033ed:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8033f0:	83 ec 08             	sub    $0x8,%esp
+  8033f3:	57                   	push   %edi
+  8033f4:	6a 00                	push   $0x0
+  8033f6:	e8 83 d9 ff ff       	call   800d7e <sys_page_unmap>
+  8033fb:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8033fe:	83 ec 08             	sub    $0x8,%esp
+  803401:	ff 75 e0             	push   -0x20(%ebp)
+  803404:	6a 00                	push   $0x0
+  803406:	e8 73 d9 ff ff       	call   800d7e <sys_page_unmap>
+  80340b:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  80340e:	83 ec 08             	sub    $0x8,%esp
+  803411:	ff 75 e4             	push   -0x1c(%ebp)
+  803414:	6a 00                	push   $0x0
+  803416:	e8 63 d9 ff ff       	call   800d7e <sys_page_unmap>
+  80341b:	83 c4 10             	add    $0x10,%esp
+}
+  80341e:	89 d8                	mov    %ebx,%eax
+  803420:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803423:	5b                   	pop    %ebx
+  803424:	5e                   	pop    %esi
+  803425:	5f                   	pop    %edi
+  803426:	5d                   	pop    %ebp
+  803427:	c3                   	ret
+
+00803428 <pipe>:
+{
+  803428:	55                   	push   %ebp
+  803429:	89 e5                	mov    %esp,%ebp
+  80342b:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  80342e:	6a 00                	push   $0x0
+  803430:	ff 75 08             	push   0x8(%ebp)
+  803433:	e8 cc fd ff ff       	call   803204 <pipe2>
+}
+  803438:	c9                   	leave
+  803439:	c3                   	ret
+
+0080343a <pipeisclosed>:
+{
+  80343a:	55                   	push   %ebp
+  80343b:	89 e5                	mov    %esp,%ebp
+  80343d:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803440:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803443:	50                   	push   %eax
+  803444:	ff 75 08             	push   0x8(%ebp)
+  803447:	e8 0a e2 ff ff       	call   801656 <fd_lookup>
+  80344c:	83 c4 10             	add    $0x10,%esp
+  80344f:	85 c0                	test   %eax,%eax
+  803451:	78 18                	js     80346b <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  803453:	83 ec 0c             	sub    $0xc,%esp
+  803456:	ff 75 f4             	push   -0xc(%ebp)
+  803459:	e8 8e e1 ff ff       	call   8015ec <fd2data>
+  80345e:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  803460:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803463:	e8 59 fa ff ff       	call   802ec1 <_pipeisclosed>
+  803468:	83 c4 10             	add    $0x10,%esp
+}
+  80346b:	c9                   	leave
+  80346c:	c3                   	ret
+
+0080346d <pipe_splice>:
+{
+  80346d:	55                   	push   %ebp
+  80346e:	89 e5                	mov    %esp,%ebp
+  803470:	57                   	push   %edi
+  803471:	56                   	push   %esi
+  803472:	53                   	push   %ebx
+  803473:	83 ec 34             	sub    $0x34,%esp
+  803476:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803479:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80347c:	50                   	push   %eax
+  80347d:	ff 75 08             	push   0x8(%ebp)
+  803480:	e8 d1 e1 ff ff       	call   801656 <fd_lookup>
+  803485:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803488:	83 c4 10             	add    $0x10,%esp
+  80348b:	85 c0                	test   %eax,%eax
+  80348d:	0f 88 d7 00 00 00    	js     80356a <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  803493:	83 ec 0c             	sub    $0xc,%esp
+  803496:	ff 75 e4             	push   -0x1c(%ebp)
+  803499:	e8 4e e1 ff ff       	call   8015ec <fd2data>
+  80349e:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8034a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8034a3:	83 c4 10             	add    $0x10,%esp
+  8034a6:	8b 15 28 50 80 00    	mov    0x805028,%edx
+  8034ac:	39 10                	cmp    %edx,(%eax)
+  8034ae:	0f 85 c1 00 00 00    	jne    803575 <pipe_splice+0x108>
+  8034b4:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  8034b8:	0f 84 c0 00 00 00    	je     80357e <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  8034be:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8034c2:	0f 84 bf 00 00 00    	je     803587 <pipe_splice+0x11a>
+  8034c8:	89 f7                	mov    %esi,%edi
+  8034ca:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8034d0:	0f 85 ba 00 00 00    	jne    803590 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8034d6:	8d 43 04             	lea    0x4(%ebx),%eax
+  8034d9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8034dc:	eb 38                	jmp    803516 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8034de:	83 ec 0c             	sub    $0xc,%esp
+  8034e1:	68 00 10 00 00       	push   $0x1000
+  8034e6:	89 f1                	mov    %esi,%ecx
+  8034e8:	89 da                	mov    %ebx,%edx
+  8034ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8034ed:	e8 34 fa ff ff       	call   802f26 <devpipe_write_bulk>
+  8034f2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8034f5:	83 c4 10             	add    $0x10,%esp
+  8034f8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8034fd:	75 53                	jne    803552 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8034ff:	83 ec 08             	sub    $0x8,%esp
+  803502:	56                   	push   %esi
+  803503:	6a 00                	push   $0x0
+  803505:	e8 74 d8 ff ff       	call   800d7e <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  80350a:	83 c7 01             	add    $0x1,%edi
+  80350d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803513:	83 c4 10             	add    $0x10,%esp
+  803516:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803519:	74 3a                	je     803555 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  80351b:	8b 03                	mov    (%ebx),%eax
+  80351d:	39 43 04             	cmp    %eax,0x4(%ebx)
+  803520:	75 bc                	jne    8034de <pipe_splice+0x71>
+  803522:	b8 00 00 00 00       	mov    $0x0,%eax
+  803527:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  80352b:	85 c0                	test   %eax,%eax
+  80352d:	74 af                	je     8034de <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  80352f:	83 ec 04             	sub    $0x4,%esp
+  803532:	6a 07                	push   $0x7
+  803534:	56                   	push   %esi
+  803535:	ff 75 d0             	push   -0x30(%ebp)
+  803538:	e8 18 db ff ff       	call   801055 <sys_chan_wakeup>
+  80353d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803540:	83 c4 10             	add    $0x10,%esp
+  803543:	85 c0                	test   %eax,%eax
+  803545:	79 b8                	jns    8034ff <pipe_splice+0x92>
+  803547:	b8 01 00 00 00       	mov    $0x1,%eax
+  80354c:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  803550:	eb 8c                	jmp    8034de <pipe_splice+0x71>
+  803552:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  803555:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803559:	75 06                	jne    803561 <pipe_splice+0xf4>
+  80355b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80355f:	78 09                	js     80356a <pipe_splice+0xfd>
+  return i * PGSIZE;
+  803561:	8b 45 10             	mov    0x10(%ebp),%eax
+  803564:	c1 e0 0c             	shl    $0xc,%eax
+  803567:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  80356a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80356d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803570:	5b                   	pop    %ebx
+  803571:	5e                   	pop    %esi
+  803572:	5f                   	pop    %edi
+  803573:	5d                   	pop    %ebp
+  803574:	c3                   	ret
+    return -E_INVAL;
+  803575:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80357c:	eb ec                	jmp    80356a <pipe_splice+0xfd>
+  80357e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803585:	eb e3                	jmp    80356a <pipe_splice+0xfd>
+  803587:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80358e:	eb da                	jmp    80356a <pipe_splice+0xfd>
+  803590:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803597:	eb d1                	jmp    80356a <pipe_splice+0xfd>
+
+00803599 <pipe_splice_read>:
+{
+  803599:	55                   	push   %ebp
+  80359a:	89 e5                	mov    %esp,%ebp
+  80359c:	53                   	push   %ebx
+  80359d:	83 ec 1c             	sub    $0x1c,%esp
+  8035a0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8035a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035a6:	50                   	push   %eax
+  8035a7:	ff 75 08             	push   0x8(%ebp)
+  8035aa:	e8 a7 e0 ff ff       	call   801656 <fd_lookup>
+  8035af:	83 c4 10             	add    $0x10,%esp
+  8035b2:	85 c0                	test   %eax,%eax
+  8035b4:	78 49                	js     8035ff <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  8035b6:	83 ec 0c             	sub    $0xc,%esp
+  8035b9:	ff 75 f4             	push   -0xc(%ebp)
+  8035bc:	e8 2b e0 ff ff       	call   8015ec <fd2data>
+  8035c1:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8035c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035c6:	83 c4 10             	add    $0x10,%esp
+  8035c9:	8b 0d 28 50 80 00    	mov    0x805028,%ecx
+  8035cf:	39 08                	cmp    %ecx,(%eax)
+  8035d1:	75 31                	jne    803604 <pipe_splice_read+0x6b>
+  8035d3:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  8035d7:	74 32                	je     80360b <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  8035d9:	8b 48 08             	mov    0x8(%eax),%ecx
+  8035dc:	83 e1 03             	and    $0x3,%ecx
+  8035df:	83 f9 01             	cmp    $0x1,%ecx
+  8035e2:	74 2e                	je     803612 <pipe_splice_read+0x79>
+  8035e4:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8035ea:	75 2d                	jne    803619 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  8035ec:	83 ec 08             	sub    $0x8,%esp
+  8035ef:	53                   	push   %ebx
+  8035f0:	68 00 10 00 00       	push   $0x1000
+  8035f5:	89 d9                	mov    %ebx,%ecx
+  8035f7:	e8 93 fa ff ff       	call   80308f <devpipe_read_bulk>
+  8035fc:	83 c4 10             	add    $0x10,%esp
+}
+  8035ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803602:	c9                   	leave
+  803603:	c3                   	ret
+    return -E_INVAL;
+  803604:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803609:	eb f4                	jmp    8035ff <pipe_splice_read+0x66>
+  80360b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803610:	eb ed                	jmp    8035ff <pipe_splice_read+0x66>
+  803612:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803617:	eb e6                	jmp    8035ff <pipe_splice_read+0x66>
+  803619:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80361e:	eb df                	jmp    8035ff <pipe_splice_read+0x66>
+
+00803620 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803620:	55                   	push   %ebp
+  803621:	89 e5                	mov    %esp,%ebp
+  803623:	56                   	push   %esi
+  803624:	53                   	push   %ebx
+  803625:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  803628:	85 f6                	test   %esi,%esi
+  80362a:	74 15                	je     803641 <wait+0x21>
+  e = &envs[ENVX(envid)];
+  80362c:	89 f0                	mov    %esi,%eax
+  80362e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  803633:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  803636:	c1 e3 04             	shl    $0x4,%ebx
+  803639:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  80363f:	eb 1b                	jmp    80365c <wait+0x3c>
+  assert(envid != 0);
+  803641:	68 dd 48 80 00       	push   $0x8048dd
+  803646:	68 d0 47 80 00       	push   $0x8047d0
+  80364b:	6a 09                	push   $0x9
+  80364d:	68 e8 48 80 00       	push   $0x8048e8
+  803652:	e8 aa cb ff ff       	call   800201 <_panic>
+    sys_yield();
+  803657:	e8 3b d6 ff ff       	call   800c97 <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  80365c:	8b 43 48             	mov    0x48(%ebx),%eax
+  80365f:	39 f0                	cmp    %esi,%eax
+  803661:	75 07                	jne    80366a <wait+0x4a>
+  803663:	8b 43 54             	mov    0x54(%ebx),%eax
+  803666:	85 c0                	test   %eax,%eax
+  803668:	75 ed                	jne    803657 <wait+0x37>
+}
+  80366a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80366d:	5b                   	pop    %ebx
+  80366e:	5e                   	pop    %esi
+  80366f:	5d                   	pop    %ebp
+  803670:	c3                   	ret
+
+00803671 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  803671:	55                   	push   %ebp
+  803672:	89 e5                	mov    %esp,%ebp
+  803674:	56                   	push   %esi
+  803675:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  803676:	ba 80 6e 80 00       	mov    $0x806e80,%edx
+  80367b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803680:	eb 0b                	jmp    80368d <mmap_find+0x1c>
+  803682:	83 c3 01             	add    $0x1,%ebx
+  803685:	83 c2 14             	add    $0x14,%edx
+  803688:	83 fb 10             	cmp    $0x10,%ebx
+  80368b:	74 1d                	je     8036aa <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  80368d:	8b 0a                	mov    (%edx),%ecx
+  80368f:	39 c8                	cmp    %ecx,%eax
+  803691:	72 ef                	jb     803682 <mmap_find+0x11>
+  803693:	85 c9                	test   %ecx,%ecx
+  803695:	74 eb                	je     803682 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  803697:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  80369a:	39 c8                	cmp    %ecx,%eax
+  80369c:	73 e4                	jae    803682 <mmap_find+0x11>
+      return &mmaps[i];
+  80369e:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8036a1:	8d 04 85 80 6e 80 00 	lea    0x806e80(,%eax,4),%eax
+  8036a8:	eb 05                	jmp    8036af <mmap_find+0x3e>
+  return NULL;
+  8036aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036af:	5b                   	pop    %ebx
+  8036b0:	5e                   	pop    %esi
+  8036b1:	5d                   	pop    %ebp
+  8036b2:	c3                   	ret
+
+008036b3 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8036b3:	89 c2                	mov    %eax,%edx
+  8036b5:	c1 ea 16             	shr    $0x16,%edx
+  8036b8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8036bf:	f6 c2 01             	test   $0x1,%dl
+  8036c2:	74 11                	je     8036d5 <va_mapped+0x22>
+  8036c4:	c1 e8 0c             	shr    $0xc,%eax
+  8036c7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036ce:	83 e0 01             	and    $0x1,%eax
+  8036d1:	83 e0 01             	and    $0x1,%eax
+}
+  8036d4:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8036d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036da:	eb f5                	jmp    8036d1 <va_mapped+0x1e>
+
+008036dc <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  8036dc:	55                   	push   %ebp
+  8036dd:	89 e5                	mov    %esp,%ebp
+  8036df:	57                   	push   %edi
+  8036e0:	56                   	push   %esi
+  8036e1:	53                   	push   %ebx
+  8036e2:	83 ec 10             	sub    $0x10,%esp
+  8036e5:	89 c3                	mov    %eax,%ebx
+  8036e7:	89 d7                	mov    %edx,%edi
+  8036e9:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8036eb:	6a 07                	push   $0x7
+  8036ed:	68 00 f0 7f 00       	push   $0x7ff000
+  8036f2:	6a 00                	push   $0x0
+  8036f4:	e8 00 d6 ff ff       	call   800cf9 <sys_page_alloc>
+  8036f9:	83 c4 10             	add    $0x10,%esp
+  8036fc:	85 c0                	test   %eax,%eax
+  8036fe:	78 46                	js     803746 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  803700:	83 ec 04             	sub    $0x4,%esp
+  803703:	57                   	push   %edi
+  803704:	53                   	push   %ebx
+  803705:	68 00 f0 7f 00       	push   $0x7ff000
+  80370a:	e8 41 d3 ff ff       	call   800a50 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  80370f:	89 34 24             	mov    %esi,(%esp)
+  803712:	53                   	push   %ebx
+  803713:	6a 00                	push   $0x0
+  803715:	68 00 f0 7f 00       	push   $0x7ff000
+  80371a:	6a 00                	push   $0x0
+  80371c:	e8 1b d6 ff ff       	call   800d3c <sys_page_map>
+  803721:	83 c4 20             	add    $0x20,%esp
+  803724:	85 c0                	test   %eax,%eax
+  803726:	78 30                	js     803758 <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  803728:	83 ec 08             	sub    $0x8,%esp
+  80372b:	68 00 f0 7f 00       	push   $0x7ff000
+  803730:	6a 00                	push   $0x0
+  803732:	e8 47 d6 ff ff       	call   800d7e <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  803737:	83 c4 10             	add    $0x10,%esp
+  80373a:	85 c0                	test   %eax,%eax
+  80373c:	78 1a                	js     803758 <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  80373e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803741:	5b                   	pop    %ebx
+  803742:	5e                   	pop    %esi
+  803743:	5f                   	pop    %edi
+  803744:	5d                   	pop    %ebp
+  803745:	c3                   	ret
+    panic("mmap: %e", r);
+  803746:	50                   	push   %eax
+  803747:	68 f3 48 80 00       	push   $0x8048f3
+  80374c:	6a 3e                	push   $0x3e
+  80374e:	68 fc 48 80 00       	push   $0x8048fc
+  803753:	e8 a9 ca ff ff       	call   800201 <_panic>
+    panic("mmap: %e", r);
+  803758:	50                   	push   %eax
+  803759:	68 f3 48 80 00       	push   $0x8048f3
+  80375e:	6a 42                	push   $0x42
+  803760:	68 fc 48 80 00       	push   $0x8048fc
+  803765:	e8 97 ca ff ff       	call   800201 <_panic>
+
+0080376a <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  80376a:	55                   	push   %ebp
+  80376b:	89 e5                	mov    %esp,%ebp
+  80376d:	57                   	push   %edi
+  80376e:	56                   	push   %esi
+  80376f:	53                   	push   %ebx
+  803770:	83 ec 1c             	sub    $0x1c,%esp
+  803773:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  803776:	8b 1f                	mov    (%edi),%ebx
+  803778:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  80377e:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  803784:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  803789:	0f 87 24 01 00 00    	ja     8038b3 <mmap_fault+0x149>
+  80378f:	89 d8                	mov    %ebx,%eax
+  803791:	e8 db fe ff ff       	call   803671 <mmap_find>
+  803796:	89 c6                	mov    %eax,%esi
+  803798:	85 c0                	test   %eax,%eax
+  80379a:	0f 84 20 01 00 00    	je     8038c0 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  8037a0:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  8037a4:	74 13                	je     8037b9 <mmap_fault+0x4f>
+  8037a6:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  8037aa:	0f 84 17 01 00 00    	je     8038c7 <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  8037b0:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  8037b7:	eb 0f                	jmp    8037c8 <mmap_fault+0x5e>
+  8037b9:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  8037bd:	19 c0                	sbb    %eax,%eax
+  8037bf:	83 e0 fe             	and    $0xfffffffe,%eax
+  8037c2:	83 c0 07             	add    $0x7,%eax
+  8037c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  8037c8:	89 d8                	mov    %ebx,%eax
+  8037ca:	e8 e4 fe ff ff       	call   8036b3 <va_mapped>
+  8037cf:	84 c0                	test   %al,%al
+  8037d1:	74 42                	je     803815 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  8037d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  8037d8:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  8037dc:	0f 84 d6 00 00 00    	je     8038b8 <mmap_fault+0x14e>
+  8037e2:	89 d8                	mov    %ebx,%eax
+  8037e4:	c1 e8 0c             	shr    $0xc,%eax
+  8037e7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  8037ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  8037f3:	f6 c2 02             	test   $0x2,%dl
+  8037f6:	0f 85 bc 00 00 00    	jne    8038b8 <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  8037fc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8037ff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803804:	89 d8                	mov    %ebx,%eax
+  803806:	e8 d1 fe ff ff       	call   8036dc <mmap_copy>
+  return 1;
+  80380b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803810:	e9 a3 00 00 00       	jmp    8038b8 <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  803815:	a1 00 70 80 00       	mov    0x807000,%eax
+  80381a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80381d:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  803823:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  803826:	83 ec 04             	sub    $0x4,%esp
+  803829:	53                   	push   %ebx
+  80382a:	89 d8                	mov    %ebx,%eax
+  80382c:	03 46 0c             	add    0xc(%esi),%eax
+  80382f:	2b 06                	sub    (%esi),%eax
+  803831:	50                   	push   %eax
+  803832:	ff 76 08             	push   0x8(%esi)
+  803835:	e8 8e eb ff ff       	call   8023c8 <read_map>
+    fsipcbuf.read_map = saved;
+  80383a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80383d:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+  803843:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  803846:	89 15 04 70 80 00    	mov    %edx,0x807004
+    if (r < 0)
+  80384c:	83 c4 10             	add    $0x10,%esp
+  80384f:	85 c0                	test   %eax,%eax
+  803851:	78 20                	js     803873 <mmap_fault+0x109>
+    if (r == 0) {
+  803853:	74 30                	je     803885 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  803855:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80385a:	0f 8f 73 ff ff ff    	jg     8037d3 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  803860:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803863:	89 c2                	mov    %eax,%edx
+  803865:	89 d8                	mov    %ebx,%eax
+  803867:	e8 70 fe ff ff       	call   8036dc <mmap_copy>
+      return 1;
+  80386c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803871:	eb 45                	jmp    8038b8 <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  803873:	50                   	push   %eax
+  803874:	68 07 49 80 00       	push   $0x804907
+  803879:	6a 5f                	push   $0x5f
+  80387b:	68 fc 48 80 00       	push   $0x8048fc
+  803880:	e8 7c c9 ff ff       	call   800201 <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  803885:	83 ec 04             	sub    $0x4,%esp
+  803888:	ff 75 e4             	push   -0x1c(%ebp)
+  80388b:	53                   	push   %ebx
+  80388c:	6a 00                	push   $0x0
+  80388e:	e8 66 d4 ff ff       	call   800cf9 <sys_page_alloc>
+  803893:	83 c4 10             	add    $0x10,%esp
+  803896:	85 c0                	test   %eax,%eax
+  803898:	78 07                	js     8038a1 <mmap_fault+0x137>
+      return 1;
+  80389a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80389f:	eb 17                	jmp    8038b8 <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  8038a1:	50                   	push   %eax
+  8038a2:	68 f3 48 80 00       	push   $0x8048f3
+  8038a7:	6a 64                	push   $0x64
+  8038a9:	68 fc 48 80 00       	push   $0x8048fc
+  8038ae:	e8 4e c9 ff ff       	call   800201 <_panic>
+    return 0;
+  8038b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038bb:	5b                   	pop    %ebx
+  8038bc:	5e                   	pop    %esi
+  8038bd:	5f                   	pop    %edi
+  8038be:	5d                   	pop    %ebp
+  8038bf:	c3                   	ret
+    return 0;
+  8038c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c5:	eb f1                	jmp    8038b8 <mmap_fault+0x14e>
+    return 0;
+  8038c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038cc:	eb ea                	jmp    8038b8 <mmap_fault+0x14e>
+
+008038ce <mmap_pgfault>:
+{
+  8038ce:	55                   	push   %ebp
+  8038cf:	89 e5                	mov    %esp,%ebp
+  8038d1:	53                   	push   %ebx
+  8038d2:	83 ec 10             	sub    $0x10,%esp
+  8038d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  8038d8:	53                   	push   %ebx
+  8038d9:	e8 8c fe ff ff       	call   80376a <mmap_fault>
+  8038de:	83 c4 10             	add    $0x10,%esp
+  8038e1:	84 c0                	test   %al,%al
+  8038e3:	74 05                	je     8038ea <mmap_pgfault+0x1c>
+}
+  8038e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038e8:	c9                   	leave
+  8038e9:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  8038ea:	83 ec 08             	sub    $0x8,%esp
+  8038ed:	ff 73 04             	push   0x4(%ebx)
+  8038f0:	ff 73 28             	push   0x28(%ebx)
+  8038f3:	ff 33                	push   (%ebx)
+  8038f5:	68 1c 49 80 00       	push   $0x80491c
+  8038fa:	6a 20                	push   $0x20
+  8038fc:	68 fc 48 80 00       	push   $0x8048fc
+  803901:	e8 fb c8 ff ff       	call   800201 <_panic>
+
+00803906 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  803906:	55                   	push   %ebp
+  803907:	89 e5                	mov    %esp,%ebp
+  803909:	57                   	push   %edi
+  80390a:	56                   	push   %esi
+  80390b:	53                   	push   %ebx
+  80390c:	83 ec 44             	sub    $0x44,%esp
+  80390f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803912:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803915:	50                   	push   %eax
+  803916:	ff 75 08             	push   0x8(%ebp)
+  803919:	e8 38 dd ff ff       	call   801656 <fd_lookup>
+  80391e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803921:	83 c4 10             	add    $0x10,%esp
+  803924:	85 c0                	test   %eax,%eax
+  803926:	0f 88 3e 01 00 00    	js     803a6a <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  80392c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803930:	0f 88 d1 00 00 00    	js     803a07 <mmap+0x101>
+  803936:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803939:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80393e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803941:	0f 85 c9 00 00 00    	jne    803a10 <mmap+0x10a>
+  803947:	85 db                	test   %ebx,%ebx
+  803949:	0f 84 ca 00 00 00    	je     803a19 <mmap+0x113>
+  80394f:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  803953:	0f 87 c0 00 00 00    	ja     803a19 <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  803959:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  80395f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803965:	89 d9                	mov    %ebx,%ecx
+  803967:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  80396a:	bb 6c 6e 80 00       	mov    $0x806e6c,%ebx
+  80396f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803974:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803979:	eb 53                	jmp    8039ce <mmap+0xc8>
+  80397b:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803980:	eb 4c                	jmp    8039ce <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  803982:	83 c0 01             	add    $0x1,%eax
+  803985:	83 f8 10             	cmp    $0x10,%eax
+  803988:	0f 84 e7 00 00 00    	je     803a75 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  80398e:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  803991:	8b 14 b5 80 6e 80 00 	mov    0x806e80(,%esi,4),%edx
+  803998:	85 d2                	test   %edx,%edx
+  80399a:	74 e6                	je     803982 <mmap+0x7c>
+  80399c:	89 d1                	mov    %edx,%ecx
+  80399e:	03 0c b5 84 6e 80 00 	add    0x806e84(,%esi,4),%ecx
+  8039a5:	39 cf                	cmp    %ecx,%edi
+  8039a7:	73 d9                	jae    803982 <mmap+0x7c>
+  8039a9:	39 da                	cmp    %ebx,%edx
+  8039ab:	73 d5                	jae    803982 <mmap+0x7c>
+  8039ad:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8039b0:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  8039b3:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  8039b6:	83 c2 01             	add    $0x1,%edx
+  8039b9:	83 c3 14             	add    $0x14,%ebx
+  8039bc:	83 fa 10             	cmp    $0x10,%edx
+  8039bf:	74 2b                	je     8039ec <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  8039c1:	85 d2                	test   %edx,%edx
+  8039c3:	78 b6                	js     80397b <mmap+0x75>
+  8039c5:	8b 3b                	mov    (%ebx),%edi
+  8039c7:	85 ff                	test   %edi,%edi
+  8039c9:	74 eb                	je     8039b6 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  8039cb:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  8039ce:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8039d3:	29 f8                	sub    %edi,%eax
+  8039d5:	39 c8                	cmp    %ecx,%eax
+  8039d7:	72 dd                	jb     8039b6 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  8039d9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  8039dc:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  8039df:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8039e2:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8039e5:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  8039e8:	89 f3                	mov    %esi,%ebx
+  8039ea:	eb a2                	jmp    80398e <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  8039ec:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  8039f3:	eb 75                	jmp    803a6a <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  8039f5:	83 ec 0c             	sub    $0xc,%esp
+  8039f8:	68 ce 38 80 00       	push   $0x8038ce
+  8039fd:	e8 f7 03 00 00       	call   803df9 <set_pgfault_handler>
+  803a02:	83 c4 10             	add    $0x10,%esp
+  803a05:	eb 24                	jmp    803a2b <mmap+0x125>
+    return -E_INVAL;
+  803a07:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803a0e:	eb 5a                	jmp    803a6a <mmap+0x164>
+  803a10:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803a17:	eb 51                	jmp    803a6a <mmap+0x164>
+  803a19:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803a20:	eb 48                	jmp    803a6a <mmap+0x164>
+  if (_pgfault_handler == 0)
+  803a22:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803a29:	74 ca                	je     8039f5 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  803a2b:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803a32:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803a35:	c1 e2 02             	shl    $0x2,%edx
+  803a38:	89 ba 80 6e 80 00    	mov    %edi,0x806e80(%edx)
+  mmaps[j].mm_len = len;
+  803a3e:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  803a41:	89 b2 84 6e 80 00    	mov    %esi,0x806e84(%edx)
+  mmaps[j].mm_fd = fdnum;
+  803a47:	8b 75 08             	mov    0x8(%ebp),%esi
+  803a4a:	89 b2 88 6e 80 00    	mov    %esi,0x806e88(%edx)
+  mmaps[j].mm_offset = offset;
+  803a50:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803a53:	89 b2 8c 6e 80 00    	mov    %esi,0x806e8c(%edx)
+  mmaps[j].mm_perm = perm;
+  803a59:	01 d8                	add    %ebx,%eax
+  803a5b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  803a5e:	89 1c 85 90 6e 80 00 	mov    %ebx,0x806e90(,%eax,4)
+  *addr = (void *) va;
+  803a65:	8b 45 18             	mov    0x18(%ebp),%eax
+  803a68:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  803a6a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803a6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a70:	5b                   	pop    %ebx
+  803a71:	5e                   	pop    %esi
+  803a72:	5f                   	pop    %edi
+  803a73:	5d                   	pop    %ebp
+  803a74:	c3                   	ret
+  if (i == NMMAP)
+  803a75:	b8 80 6e 80 00       	mov    $0x806e80,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  803a7a:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  803a7d:	83 c0 14             	add    $0x14,%eax
+  803a80:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  803a84:	74 9c                	je     803a22 <mmap+0x11c>
+  803a86:	83 c3 01             	add    $0x1,%ebx
+  803a89:	83 fb 10             	cmp    $0x10,%ebx
+  803a8c:	75 ef                	jne    803a7d <mmap+0x177>
+    return -E_NO_MEM;
+  803a8e:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803a95:	eb d3                	jmp    803a6a <mmap+0x164>
+
+00803a97 <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  803a97:	55                   	push   %ebp
+  803a98:	89 e5                	mov    %esp,%ebp
+  803a9a:	57                   	push   %edi
+  803a9b:	56                   	push   %esi
+  803a9c:	53                   	push   %ebx
+  803a9d:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803aa3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803aa6:	e8 c6 fb ff ff       	call   803671 <mmap_find>
+  803aab:	85 c0                	test   %eax,%eax
+  803aad:	0f 84 58 01 00 00    	je     803c0b <msync+0x174>
+  803ab3:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  803ab5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  803aba:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  803abe:	74 0a                	je     803aca <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  803ac0:	89 d8                	mov    %ebx,%eax
+  803ac2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ac5:	5b                   	pop    %ebx
+  803ac6:	5e                   	pop    %esi
+  803ac7:	5f                   	pop    %edi
+  803ac8:	5d                   	pop    %ebp
+  803ac9:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  803aca:	83 ec 08             	sub    $0x8,%esp
+  803acd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803ad0:	50                   	push   %eax
+  803ad1:	ff 77 08             	push   0x8(%edi)
+  803ad4:	e8 7d db ff ff       	call   801656 <fd_lookup>
+  803ad9:	89 c3                	mov    %eax,%ebx
+  803adb:	83 c4 10             	add    $0x10,%esp
+  803ade:	85 c0                	test   %eax,%eax
+  803ae0:	78 de                	js     803ac0 <msync+0x29>
+  803ae2:	83 ec 08             	sub    $0x8,%esp
+  803ae5:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  803aeb:	50                   	push   %eax
+  803aec:	ff 77 08             	push   0x8(%edi)
+  803aef:	e8 05 e0 ff ff       	call   801af9 <fstat>
+  803af4:	89 c3                	mov    %eax,%ebx
+  803af6:	83 c4 10             	add    $0x10,%esp
+  803af9:	85 c0                	test   %eax,%eax
+  803afb:	78 c3                	js     803ac0 <msync+0x29>
+  saved = fd->fd_offset;
+  803afd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803b00:	8b 40 04             	mov    0x4(%eax),%eax
+  803b03:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803b09:	8b 37                	mov    (%edi),%esi
+  803b0b:	eb 29                	jmp    803b36 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  803b0d:	83 ec 0c             	sub    $0xc,%esp
+  803b10:	6a 07                	push   $0x7
+  803b12:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  803b18:	50                   	push   %eax
+  803b19:	6a 00                	push   $0x0
+  803b1b:	50                   	push   %eax
+  803b1c:	6a 00                	push   $0x0
+  803b1e:	e8 19 d2 ff ff       	call   800d3c <sys_page_map>
+  803b23:	89 c3                	mov    %eax,%ebx
+  803b25:	83 c4 20             	add    $0x20,%esp
+  803b28:	85 c0                	test   %eax,%eax
+  803b2a:	0f 88 c0 00 00 00    	js     803bf0 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803b30:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803b36:	8b 07                	mov    (%edi),%eax
+  803b38:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  803b3e:	03 47 04             	add    0x4(%edi),%eax
+  803b41:	39 c6                	cmp    %eax,%esi
+  803b43:	0f 83 a7 00 00 00    	jae    803bf0 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  803b49:	89 f0                	mov    %esi,%eax
+  803b4b:	e8 63 fb ff ff       	call   8036b3 <va_mapped>
+  803b50:	84 c0                	test   %al,%al
+  803b52:	74 dc                	je     803b30 <msync+0x99>
+  803b54:	89 f0                	mov    %esi,%eax
+  803b56:	c1 e8 0c             	shr    $0xc,%eax
+  803b59:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b60:	a8 40                	test   $0x40,%al
+  803b62:	74 cc                	je     803b30 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  803b64:	8b 47 0c             	mov    0xc(%edi),%eax
+  803b67:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  803b6d:	29 c8                	sub    %ecx,%eax
+  803b6f:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  803b71:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803b74:	39 c2                	cmp    %eax,%edx
+  803b76:	7e 78                	jle    803bf0 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  803b78:	29 c2                	sub    %eax,%edx
+  803b7a:	89 d1                	mov    %edx,%ecx
+  803b7c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b81:	39 d1                	cmp    %edx,%ecx
+  803b83:	0f 4e d1             	cmovle %ecx,%edx
+  803b86:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803b8c:	83 ec 08             	sub    $0x8,%esp
+  803b8f:	50                   	push   %eax
+  803b90:	ff 77 08             	push   0x8(%edi)
+  803b93:	e8 b9 de ff ff       	call   801a51 <seek>
+  803b98:	89 c3                	mov    %eax,%ebx
+  803b9a:	83 c4 10             	add    $0x10,%esp
+  803b9d:	85 c0                	test   %eax,%eax
+  803b9f:	78 4f                	js     803bf0 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  803ba1:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  803ba7:	83 ec 04             	sub    $0x4,%esp
+  803baa:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  803bb0:	56                   	push   %esi
+  803bb1:	ff 77 08             	push   0x8(%edi)
+  803bb4:	e8 16 de ff ff       	call   8019cf <write>
+  803bb9:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803bbb:	83 c4 10             	add    $0x10,%esp
+  803bbe:	85 c0                	test   %eax,%eax
+  803bc0:	78 2e                	js     803bf0 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  803bc2:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  803bc8:	39 c2                	cmp    %eax,%edx
+  803bca:	0f 8e 3d ff ff ff    	jle    803b0d <msync+0x76>
+  803bd0:	89 d0                	mov    %edx,%eax
+  803bd2:	29 d8                	sub    %ebx,%eax
+  803bd4:	01 f3                	add    %esi,%ebx
+  803bd6:	83 ec 04             	sub    $0x4,%esp
+  803bd9:	50                   	push   %eax
+  803bda:	53                   	push   %ebx
+  803bdb:	ff 77 08             	push   0x8(%edi)
+  803bde:	e8 ec dd ff ff       	call   8019cf <write>
+  803be3:	89 c3                	mov    %eax,%ebx
+  803be5:	83 c4 10             	add    $0x10,%esp
+  803be8:	85 c0                	test   %eax,%eax
+  803bea:	0f 89 1d ff ff ff    	jns    803b0d <msync+0x76>
+  fd->fd_offset = saved;
+  803bf0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803bf3:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  803bf9:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  803bfc:	85 db                	test   %ebx,%ebx
+  803bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c03:	0f 4f d8             	cmovg  %eax,%ebx
+  803c06:	e9 b5 fe ff ff       	jmp    803ac0 <msync+0x29>
+    return -E_INVAL;
+  803c0b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  803c10:	e9 ab fe ff ff       	jmp    803ac0 <msync+0x29>
+
+00803c15 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  803c15:	55                   	push   %ebp
+  803c16:	89 e5                	mov    %esp,%ebp
+  803c18:	56                   	push   %esi
+  803c19:	53                   	push   %ebx
+  803c1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803c1d:	89 d8                	mov    %ebx,%eax
+  803c1f:	e8 4d fa ff ff       	call   803671 <mmap_find>
+  803c24:	85 c0                	test   %eax,%eax
+  803c26:	74 56                	je     803c7e <munmap+0x69>
+  803c28:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  803c2a:	83 ec 0c             	sub    $0xc,%esp
+  803c2d:	53                   	push   %ebx
+  803c2e:	e8 64 fe ff ff       	call   803a97 <msync>
+  803c33:	83 c4 10             	add    $0x10,%esp
+  803c36:	85 c0                	test   %eax,%eax
+  803c38:	78 3d                	js     803c77 <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  803c3a:	8b 1e                	mov    (%esi),%ebx
+  803c3c:	eb 06                	jmp    803c44 <munmap+0x2f>
+  803c3e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803c44:	8b 46 04             	mov    0x4(%esi),%eax
+  803c47:	03 06                	add    (%esi),%eax
+  803c49:	39 c3                	cmp    %eax,%ebx
+  803c4b:	73 1f                	jae    803c6c <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  803c4d:	89 d8                	mov    %ebx,%eax
+  803c4f:	e8 5f fa ff ff       	call   8036b3 <va_mapped>
+  803c54:	84 c0                	test   %al,%al
+  803c56:	74 e6                	je     803c3e <munmap+0x29>
+  803c58:	83 ec 08             	sub    $0x8,%esp
+  803c5b:	53                   	push   %ebx
+  803c5c:	6a 00                	push   $0x0
+  803c5e:	e8 1b d1 ff ff       	call   800d7e <sys_page_unmap>
+  803c63:	83 c4 10             	add    $0x10,%esp
+  803c66:	85 c0                	test   %eax,%eax
+  803c68:	79 d4                	jns    803c3e <munmap+0x29>
+  803c6a:	eb 0b                	jmp    803c77 <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  803c6c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  803c72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c77:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c7a:	5b                   	pop    %ebx
+  803c7b:	5e                   	pop    %esi
+  803c7c:	5d                   	pop    %ebp
+  803c7d:	c3                   	ret
+    return -E_INVAL;
+  803c7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c83:	eb f2                	jmp    803c77 <munmap+0x62>
+
+00803c85 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803c85:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c8a:	c3                   	ret
+
+00803c8b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803c8b:	55                   	push   %ebp
+  803c8c:	89 e5                	mov    %esp,%ebp
+  803c8e:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  803c91:	68 43 49 80 00       	push   $0x804943
+  803c96:	ff 75 0c             	push   0xc(%ebp)
+  803c99:	e8 2c cc ff ff       	call   8008ca <strcpy>
+  return 0;
+}
+  803c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ca3:	c9                   	leave
+  803ca4:	c3                   	ret
+
+00803ca5 <devcons_write>:
+{
+  803ca5:	55                   	push   %ebp
+  803ca6:	89 e5                	mov    %esp,%ebp
+  803ca8:	57                   	push   %edi
+  803ca9:	56                   	push   %esi
+  803caa:	53                   	push   %ebx
+  803cab:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  803cb1:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  803cb6:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  803cbc:	eb 2e                	jmp    803cec <devcons_write+0x47>
+    m = n - tot;
+  803cbe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803cc1:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  803cc3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803cc8:	39 c3                	cmp    %eax,%ebx
+  803cca:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  803ccd:	83 ec 04             	sub    $0x4,%esp
+  803cd0:	53                   	push   %ebx
+  803cd1:	89 f0                	mov    %esi,%eax
+  803cd3:	03 45 0c             	add    0xc(%ebp),%eax
+  803cd6:	50                   	push   %eax
+  803cd7:	57                   	push   %edi
+  803cd8:	e8 73 cd ff ff       	call   800a50 <memmove>
+    sys_cputs(buf, m);
+  803cdd:	83 c4 08             	add    $0x8,%esp
+  803ce0:	53                   	push   %ebx
+  803ce1:	57                   	push   %edi
+  803ce2:	e8 13 cf ff ff       	call   800bfa <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  803ce7:	01 de                	add    %ebx,%esi
+  803ce9:	83 c4 10             	add    $0x10,%esp
+  803cec:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803cef:	72 cd                	jb     803cbe <devcons_write+0x19>
+}
+  803cf1:	89 f0                	mov    %esi,%eax
+  803cf3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cf6:	5b                   	pop    %ebx
+  803cf7:	5e                   	pop    %esi
+  803cf8:	5f                   	pop    %edi
+  803cf9:	5d                   	pop    %ebp
+  803cfa:	c3                   	ret
+
+00803cfb <devcons_read>:
+{
+  803cfb:	55                   	push   %ebp
+  803cfc:	89 e5                	mov    %esp,%ebp
+  803cfe:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  803d01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d06:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803d0a:	75 07                	jne    803d13 <devcons_read+0x18>
+  803d0c:	eb 1f                	jmp    803d2d <devcons_read+0x32>
+    sys_yield();
+  803d0e:	e8 84 cf ff ff       	call   800c97 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  803d13:	e8 00 cf ff ff       	call   800c18 <sys_cgetc>
+  803d18:	85 c0                	test   %eax,%eax
+  803d1a:	74 f2                	je     803d0e <devcons_read+0x13>
+  if (c < 0)
+  803d1c:	78 0f                	js     803d2d <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  803d1e:	83 f8 04             	cmp    $0x4,%eax
+  803d21:	74 0c                	je     803d2f <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803d23:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d26:	88 02                	mov    %al,(%edx)
+  return 1;
+  803d28:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803d2d:	c9                   	leave
+  803d2e:	c3                   	ret
+    return 0;
+  803d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d34:	eb f7                	jmp    803d2d <devcons_read+0x32>
+
+00803d36 <cputchar>:
+{
+  803d36:	55                   	push   %ebp
+  803d37:	89 e5                	mov    %esp,%ebp
+  803d39:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  803d3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d3f:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803d42:	6a 01                	push   $0x1
+  803d44:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803d47:	50                   	push   %eax
+  803d48:	e8 ad ce ff ff       	call   800bfa <sys_cputs>
+}
+  803d4d:	83 c4 10             	add    $0x10,%esp
+  803d50:	c9                   	leave
+  803d51:	c3                   	ret
+
+00803d52 <getchar>:
+{
+  803d52:	55                   	push   %ebp
+  803d53:	89 e5                	mov    %esp,%ebp
+  803d55:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  803d58:	6a 01                	push   $0x1
+  803d5a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803d5d:	50                   	push   %eax
+  803d5e:	6a 00                	push   $0x0
+  803d60:	e8 9c db ff ff       	call   801901 <read>
+  if (r < 0)
+  803d65:	83 c4 10             	add    $0x10,%esp
+  803d68:	85 c0                	test   %eax,%eax
+  803d6a:	78 06                	js     803d72 <getchar+0x20>
+  if (r < 1)
+  803d6c:	74 06                	je     803d74 <getchar+0x22>
+  return c;
+  803d6e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803d72:	c9                   	leave
+  803d73:	c3                   	ret
+    return -E_EOF;
+  803d74:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803d79:	eb f7                	jmp    803d72 <getchar+0x20>
+
+00803d7b <iscons>:
+{
+  803d7b:	55                   	push   %ebp
+  803d7c:	89 e5                	mov    %esp,%ebp
+  803d7e:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d81:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d84:	50                   	push   %eax
+  803d85:	ff 75 08             	push   0x8(%ebp)
+  803d88:	e8 c9 d8 ff ff       	call   801656 <fd_lookup>
+  803d8d:	83 c4 10             	add    $0x10,%esp
+  803d90:	85 c0                	test   %eax,%eax
+  803d92:	78 11                	js     803da5 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  803d94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d97:	8b 15 44 50 80 00    	mov    0x805044,%edx
+  803d9d:	39 10                	cmp    %edx,(%eax)
+  803d9f:	0f 94 c0             	sete   %al
+  803da2:	0f b6 c0             	movzbl %al,%eax
+}
+  803da5:	c9                   	leave
+  803da6:	c3                   	ret
+
+00803da7 <opencons>:
+{
+  803da7:	55                   	push   %ebp
+  803da8:	89 e5                	mov    %esp,%ebp
+  803daa:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  803dad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803db0:	50                   	push   %eax
+  803db1:	e8 4a d8 ff ff       	call   801600 <fd_alloc>
+  803db6:	83 c4 10             	add    $0x10,%esp
+  803db9:	85 c0                	test   %eax,%eax
+  803dbb:	78 3a                	js     803df7 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803dbd:	83 ec 04             	sub    $0x4,%esp
+  803dc0:	68 07 04 00 00       	push   $0x407
+  803dc5:	ff 75 f4             	push   -0xc(%ebp)
+  803dc8:	6a 00                	push   $0x0
+  803dca:	e8 2a cf ff ff       	call   800cf9 <sys_page_alloc>
+  803dcf:	83 c4 10             	add    $0x10,%esp
+  803dd2:	85 c0                	test   %eax,%eax
+  803dd4:	78 21                	js     803df7 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  803dd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803dd9:	8b 15 44 50 80 00    	mov    0x805044,%edx
+  803ddf:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  803de1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803de4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  803deb:	83 ec 0c             	sub    $0xc,%esp
+  803dee:	50                   	push   %eax
+  803def:	e8 e8 d7 ff ff       	call   8015dc <fd2num>
+  803df4:	83 c4 10             	add    $0x10,%esp
+}
+  803df7:	c9                   	leave
+  803df8:	c3                   	ret
+
+00803df9 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803df9:	55                   	push   %ebp
+  803dfa:	89 e5                	mov    %esp,%ebp
+  803dfc:	53                   	push   %ebx
+  803dfd:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  803e00:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803e07:	74 0d                	je     803e16 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  803e09:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e0c:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803e11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e14:	c9                   	leave
+  803e15:	c3                   	ret
+    envid_t id = sys_getenvid();
+  803e16:	e8 5d ce ff ff       	call   800c78 <sys_getenvid>
+  803e1b:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  803e1d:	83 ec 04             	sub    $0x4,%esp
+  803e20:	6a 07                	push   $0x7
+  803e22:	68 00 f0 bf ee       	push   $0xeebff000
+  803e27:	50                   	push   %eax
+  803e28:	e8 cc ce ff ff       	call   800cf9 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  803e2d:	83 c4 08             	add    $0x8,%esp
+  803e30:	68 40 3e 80 00       	push   $0x803e40
+  803e35:	53                   	push   %ebx
+  803e36:	e8 33 d1 ff ff       	call   800f6e <sys_env_set_pgfault_upcall>
+  803e3b:	83 c4 10             	add    $0x10,%esp
+  803e3e:	eb c9                	jmp    803e09 <set_pgfault_handler+0x10>
+
+00803e40 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803e40:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803e41:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  803e46:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803e48:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  803e4b:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  803e4f:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  803e52:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  803e56:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  803e5a:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  803e5c:	83 c4 08             	add    $0x8,%esp
+  popal
+  803e5f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  803e60:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  803e63:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  803e64:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  803e65:	c3                   	ret
+
+00803e66 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  803e66:	55                   	push   %ebp
+  803e67:	89 e5                	mov    %esp,%ebp
+  803e69:	57                   	push   %edi
+  803e6a:	56                   	push   %esi
+  803e6b:	53                   	push   %ebx
+  803e6c:	83 ec 14             	sub    $0x14,%esp
+  803e6f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803e72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803e75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803e78:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  803e7b:	85 c0                	test   %eax,%eax
+  803e7d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803e82:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  803e85:	ff 33                	push   (%ebx)
+  803e87:	50                   	push   %eax
+  803e88:	e8 44 d1 ff ff       	call   800fd1 <sys_ipc_recv>
+  803e8d:	83 c4 10             	add    $0x10,%esp
+  803e90:	85 c0                	test   %eax,%eax
+  803e92:	78 39                	js     803ecd <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803e94:	85 ff                	test   %edi,%edi
+  803e96:	74 0a                	je     803ea2 <ipc_recv_pages+0x3c>
+  803e98:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  803e9d:	8b 40 7c             	mov    0x7c(%eax),%eax
+  803ea0:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803ea2:	85 f6                	test   %esi,%esi
+  803ea4:	74 0d                	je     803eb3 <ipc_recv_pages+0x4d>
+  803ea6:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  803eab:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  803eb1:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  803eb3:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  803eb8:	8b 40 74             	mov    0x74(%eax),%eax
+  803ebb:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  803ebd:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  803ec2:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  803ec5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ec8:	5b                   	pop    %ebx
+  803ec9:	5e                   	pop    %esi
+  803eca:	5f                   	pop    %edi
+  803ecb:	5d                   	pop    %ebp
+  803ecc:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  803ecd:	85 ff                	test   %edi,%edi
+  803ecf:	74 06                	je     803ed7 <ipc_recv_pages+0x71>
+  803ed1:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  803ed7:	85 f6                	test   %esi,%esi
+  803ed9:	74 06                	je     803ee1 <ipc_recv_pages+0x7b>
+  803edb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  803ee1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  803ee7:	eb dc                	jmp    803ec5 <ipc_recv_pages+0x5f>
+
+00803ee9 <ipc_recv>:
+{
+  803ee9:	55                   	push   %ebp
+  803eea:	89 e5                	mov    %esp,%ebp
+  803eec:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  803eef:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  803ef6:	ff 75 10             	push   0x10(%ebp)
+  803ef9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803efc:	50                   	push   %eax
+  803efd:	ff 75 0c             	push   0xc(%ebp)
+  803f00:	ff 75 08             	push   0x8(%ebp)
+  803f03:	e8 5e ff ff ff       	call   803e66 <ipc_recv_pages>
+}
+  803f08:	c9                   	leave
+  803f09:	c3                   	ret
+
+00803f0a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  803f0a:	55                   	push   %ebp
+  803f0b:	89 e5                	mov    %esp,%ebp
+  803f0d:	57                   	push   %edi
+  803f0e:	56                   	push   %esi
+  803f0f:	53                   	push   %ebx
+  803f10:	83 ec 0c             	sub    $0xc,%esp
+  803f13:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803f16:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803f19:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  803f1c:	89 c3                	mov    %eax,%ebx
+  803f1e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803f24:	85 c0                	test   %eax,%eax
+  803f26:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803f2b:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  803f2e:	83 ec 0c             	sub    $0xc,%esp
+  803f31:	ff 75 14             	push   0x14(%ebp)
+  803f34:	ff 75 18             	push   0x18(%ebp)
+  803f37:	53                   	push   %ebx
+  803f38:	56                   	push   %esi
+  803f39:	57                   	push   %edi
+  803f3a:	e8 71 d0 ff ff       	call   800fb0 <sys_ipc_try_send>
+  803f3f:	83 c4 20             	add    $0x20,%esp
+  803f42:	85 c0                	test   %eax,%eax
+  803f44:	79 1e                	jns    803f64 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  803f46:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803f49:	75 07                	jne    803f52 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  803f4b:	e8 47 cd ff ff       	call   800c97 <sys_yield>
+  803f50:	eb dc                	jmp    803f2e <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  803f52:	50                   	push   %eax
+  803f53:	68 4f 49 80 00       	push   $0x80494f
+  803f58:	6a 5c                	push   $0x5c
+  803f5a:	68 5c 49 80 00       	push   $0x80495c
+  803f5f:	e8 9d c2 ff ff       	call   800201 <_panic>
+  }
+}
+  803f64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f67:	5b                   	pop    %ebx
+  803f68:	5e                   	pop    %esi
+  803f69:	5f                   	pop    %edi
+  803f6a:	5d                   	pop    %ebp
+  803f6b:	c3                   	ret
+
+00803f6c <ipc_send>:
+{
+  803f6c:	55                   	push   %ebp
+  803f6d:	89 e5                	mov    %esp,%ebp
+  803f6f:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  803f72:	ff 75 14             	push   0x14(%ebp)
+  803f75:	6a 01                	push   $0x1
+  803f77:	ff 75 10             	push   0x10(%ebp)
+  803f7a:	ff 75 0c             	push   0xc(%ebp)
+  803f7d:	ff 75 08             	push   0x8(%ebp)
+  803f80:	e8 85 ff ff ff       	call   803f0a <ipc_send_pages>
+}
+  803f85:	83 c4 20             	add    $0x20,%esp
+  803f88:	c9                   	leave
+  803f89:	c3                   	ret
+
+00803f8a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803f8a:	55                   	push   %ebp
+  803f8b:	89 e5                	mov    %esp,%ebp
+  803f8d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  803f90:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  803f95:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803f98:	c1 e0 04             	shl    $0x4,%eax
+  803f9b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803fa0:	8b 40 50             	mov    0x50(%eax),%eax
+  803fa3:	39 c8                	cmp    %ecx,%eax
+  803fa5:	74 12                	je     803fb9 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  803fa7:	83 c2 01             	add    $0x1,%edx
+  803faa:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  803fb0:	75 e3                	jne    803f95 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  803fb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb7:	eb 0e                	jmp    803fc7 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  803fb9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803fbc:	c1 e0 04             	shl    $0x4,%eax
+  803fbf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803fc4:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803fc7:	5d                   	pop    %ebp
+  803fc8:	c3                   	ret
+
+00803fc9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803fc9:	55                   	push   %ebp
+  803fca:	89 e5                	mov    %esp,%ebp
+  803fcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803fcf:	89 c2                	mov    %eax,%edx
+  803fd1:	c1 ea 16             	shr    $0x16,%edx
+  803fd4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803fdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803fe0:	f6 c1 01             	test   $0x1,%cl
+  803fe3:	74 1c                	je     804001 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  803fe5:	c1 e8 0c             	shr    $0xc,%eax
+  803fe8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  803fef:	a8 01                	test   $0x1,%al
+  803ff1:	74 0e                	je     804001 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  803ff3:	c1 e8 0c             	shr    $0xc,%eax
+  803ff6:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803ffd:	ef 
+  803ffe:	0f b7 d2             	movzwl %dx,%edx
+}
+  804001:	89 d0                	mov    %edx,%eax
+  804003:	5d                   	pop    %ebp
+  804004:	c3                   	ret
+
+00804005 <udivmod>:
+  804005:	55                   	push   %ebp
+  804006:	57                   	push   %edi
+  804007:	56                   	push   %esi
+  804008:	53                   	push   %ebx
+  804009:	83 ec 14             	sub    $0x14,%esp
+  80400c:	8b 74 24 28          	mov    0x28(%esp),%esi
+  804010:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  804014:	89 fb                	mov    %edi,%ebx
+  804016:	09 f3                	or     %esi,%ebx
+  804018:	0f 84 88 00 00 00    	je     8040a6 <udivmod+0xa1>
+  80401e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804023:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  80402a:	00 
+  80402b:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  804032:	00 
+  804033:	89 cd                	mov    %ecx,%ebp
+  804035:	89 34 24             	mov    %esi,(%esp)
+  804038:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  80403c:	eb 08                	jmp    804046 <udivmod+0x41>
+  80403e:	83 ed 01             	sub    $0x1,%ebp
+  804041:	83 fd ff             	cmp    $0xffffffff,%ebp
+  804044:	74 6c                	je     8040b2 <udivmod+0xad>
+  804046:	89 c3                	mov    %eax,%ebx
+  804048:	89 d6                	mov    %edx,%esi
+  80404a:	89 e9                	mov    %ebp,%ecx
+  80404c:	0f ad f3             	shrd   %cl,%esi,%ebx
+  80404f:	d3 ee                	shr    %cl,%esi
+  804051:	f6 c1 20             	test   $0x20,%cl
+  804054:	74 04                	je     80405a <udivmod+0x55>
+  804056:	89 f3                	mov    %esi,%ebx
+  804058:	31 f6                	xor    %esi,%esi
+  80405a:	8b 3c 24             	mov    (%esp),%edi
+  80405d:	39 fb                	cmp    %edi,%ebx
+  80405f:	89 f7                	mov    %esi,%edi
+  804061:	8b 1c 24             	mov    (%esp),%ebx
+  804064:	8b 74 24 04          	mov    0x4(%esp),%esi
+  804068:	19 f7                	sbb    %esi,%edi
+  80406a:	72 d2                	jb     80403e <udivmod+0x39>
+  80406c:	89 f7                	mov    %esi,%edi
+  80406e:	89 de                	mov    %ebx,%esi
+  804070:	89 e9                	mov    %ebp,%ecx
+  804072:	0f a5 f7             	shld   %cl,%esi,%edi
+  804075:	d3 e6                	shl    %cl,%esi
+  804077:	f6 c1 20             	test   $0x20,%cl
+  80407a:	74 04                	je     804080 <udivmod+0x7b>
+  80407c:	89 f7                	mov    %esi,%edi
+  80407e:	31 f6                	xor    %esi,%esi
+  804080:	29 f0                	sub    %esi,%eax
+  804082:	19 fa                	sbb    %edi,%edx
+  804084:	be 01 00 00 00       	mov    $0x1,%esi
+  804089:	bf 00 00 00 00       	mov    $0x0,%edi
+  80408e:	0f a5 f7             	shld   %cl,%esi,%edi
+  804091:	d3 e6                	shl    %cl,%esi
+  804093:	f6 c1 20             	test   $0x20,%cl
+  804096:	74 04                	je     80409c <udivmod+0x97>
+  804098:	89 f7                	mov    %esi,%edi
+  80409a:	31 f6                	xor    %esi,%esi
+  80409c:	09 74 24 08          	or     %esi,0x8(%esp)
+  8040a0:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8040a4:	eb 98                	jmp    80403e <udivmod+0x39>
+  8040a6:	89 f0                	mov    %esi,%eax
+  8040a8:	89 fa                	mov    %edi,%edx
+  8040aa:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8040ae:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8040b2:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8040b6:	89 01                	mov    %eax,(%ecx)
+  8040b8:	89 51 04             	mov    %edx,0x4(%ecx)
+  8040bb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8040bf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8040c3:	83 c4 14             	add    $0x14,%esp
+  8040c6:	5b                   	pop    %ebx
+  8040c7:	5e                   	pop    %esi
+  8040c8:	5f                   	pop    %edi
+  8040c9:	5d                   	pop    %ebp
+  8040ca:	c3                   	ret
+
+008040cb <__udivdi3>:
+  8040cb:	83 ec 18             	sub    $0x18,%esp
+  8040ce:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8040d2:	50                   	push   %eax
+  8040d3:	ff 74 24 2c          	push   0x2c(%esp)
+  8040d7:	ff 74 24 2c          	push   0x2c(%esp)
+  8040db:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8040df:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8040e3:	e8 1d ff ff ff       	call   804005 <udivmod>
+  8040e8:	83 c4 24             	add    $0x24,%esp
+  8040eb:	c3                   	ret
+
+008040ec <__umoddi3>:
+  8040ec:	83 ec 18             	sub    $0x18,%esp
+  8040ef:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8040f3:	50                   	push   %eax
+  8040f4:	ff 74 24 2c          	push   0x2c(%esp)
+  8040f8:	ff 74 24 2c          	push   0x2c(%esp)
+  8040fc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804100:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804104:	e8 fc fe ff ff       	call   804005 <udivmod>
+  804109:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80410d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804111:	83 c4 24             	add    $0x24,%esp
+  804114:	c3                   	ret
+
+00804115 <__divdi3>:
+  804115:	56                   	push   %esi
+  804116:	53                   	push   %ebx
+  804117:	83 ec 14             	sub    $0x14,%esp
+  80411a:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80411e:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804122:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804126:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80412a:	85 d2                	test   %edx,%edx
+  80412c:	78 18                	js     804146 <__divdi3+0x31>
+  80412e:	85 db                	test   %ebx,%ebx
+  804130:	78 3e                	js     804170 <__divdi3+0x5b>
+  804132:	83 ec 04             	sub    $0x4,%esp
+  804135:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804139:	56                   	push   %esi
+  80413a:	53                   	push   %ebx
+  80413b:	51                   	push   %ecx
+  80413c:	e8 c4 fe ff ff       	call   804005 <udivmod>
+  804141:	83 c4 10             	add    $0x10,%esp
+  804144:	eb 24                	jmp    80416a <__divdi3+0x55>
+  804146:	f7 d8                	neg    %eax
+  804148:	83 d2 00             	adc    $0x0,%edx
+  80414b:	f7 da                	neg    %edx
+  80414d:	85 db                	test   %ebx,%ebx
+  80414f:	78 3a                	js     80418b <__divdi3+0x76>
+  804151:	83 ec 04             	sub    $0x4,%esp
+  804154:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804158:	56                   	push   %esi
+  804159:	53                   	push   %ebx
+  80415a:	51                   	push   %ecx
+  80415b:	e8 a5 fe ff ff       	call   804005 <udivmod>
+  804160:	83 c4 10             	add    $0x10,%esp
+  804163:	f7 d8                	neg    %eax
+  804165:	83 d2 00             	adc    $0x0,%edx
+  804168:	f7 da                	neg    %edx
+  80416a:	83 c4 14             	add    $0x14,%esp
+  80416d:	5b                   	pop    %ebx
+  80416e:	5e                   	pop    %esi
+  80416f:	c3                   	ret
+  804170:	83 ec 04             	sub    $0x4,%esp
+  804173:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804177:	56                   	push   %esi
+  804178:	f7 d9                	neg    %ecx
+  80417a:	83 d3 00             	adc    $0x0,%ebx
+  80417d:	f7 db                	neg    %ebx
+  80417f:	53                   	push   %ebx
+  804180:	51                   	push   %ecx
+  804181:	e8 7f fe ff ff       	call   804005 <udivmod>
+  804186:	83 c4 10             	add    $0x10,%esp
+  804189:	eb d8                	jmp    804163 <__divdi3+0x4e>
+  80418b:	83 ec 04             	sub    $0x4,%esp
+  80418e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804192:	56                   	push   %esi
+  804193:	f7 d9                	neg    %ecx
+  804195:	83 d3 00             	adc    $0x0,%ebx
+  804198:	f7 db                	neg    %ebx
+  80419a:	53                   	push   %ebx
+  80419b:	51                   	push   %ecx
+  80419c:	e8 64 fe ff ff       	call   804005 <udivmod>
+  8041a1:	83 c4 10             	add    $0x10,%esp
+  8041a4:	eb c4                	jmp    80416a <__divdi3+0x55>
+
+008041a6 <__moddi3>:
+  8041a6:	55                   	push   %ebp
+  8041a7:	57                   	push   %edi
+  8041a8:	56                   	push   %esi
+  8041a9:	53                   	push   %ebx
+  8041aa:	83 ec 24             	sub    $0x24,%esp
+  8041ad:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8041b1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8041b5:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8041b9:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8041bd:	85 d2                	test   %edx,%edx
+  8041bf:	78 3b                	js     8041fc <__moddi3+0x56>
+  8041c1:	83 ec 04             	sub    $0x4,%esp
+  8041c4:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8041c8:	56                   	push   %esi
+  8041c9:	89 ce                	mov    %ecx,%esi
+  8041cb:	f7 de                	neg    %esi
+  8041cd:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8041d1:	89 de                	mov    %ebx,%esi
+  8041d3:	83 d6 00             	adc    $0x0,%esi
+  8041d6:	f7 de                	neg    %esi
+  8041d8:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8041dc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8041e0:	0f 48 f1             	cmovs  %ecx,%esi
+  8041e3:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8041e8:	53                   	push   %ebx
+  8041e9:	56                   	push   %esi
+  8041ea:	e8 16 fe ff ff       	call   804005 <udivmod>
+  8041ef:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8041f3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8041f7:	83 c4 10             	add    $0x10,%esp
+  8041fa:	eb 47                	jmp    804243 <__moddi3+0x9d>
+  8041fc:	f7 d8                	neg    %eax
+  8041fe:	83 d2 00             	adc    $0x0,%edx
+  804201:	f7 da                	neg    %edx
+  804203:	83 ec 04             	sub    $0x4,%esp
+  804206:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80420a:	56                   	push   %esi
+  80420b:	89 cf                	mov    %ecx,%edi
+  80420d:	f7 df                	neg    %edi
+  80420f:	89 de                	mov    %ebx,%esi
+  804211:	83 d6 00             	adc    $0x0,%esi
+  804214:	f7 de                	neg    %esi
+  804216:	0f 49 cf             	cmovns %edi,%ecx
+  804219:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80421d:	0f 49 de             	cmovns %esi,%ebx
+  804220:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804224:	ff 74 24 0c          	push   0xc(%esp)
+  804228:	ff 74 24 0c          	push   0xc(%esp)
+  80422c:	e8 d4 fd ff ff       	call   804005 <udivmod>
+  804231:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804235:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804239:	f7 d8                	neg    %eax
+  80423b:	83 d2 00             	adc    $0x0,%edx
+  80423e:	f7 da                	neg    %edx
+  804240:	83 c4 10             	add    $0x10,%esp
+  804243:	83 c4 24             	add    $0x24,%esp
+  804246:	5b                   	pop    %ebx
+  804247:	5e                   	pop    %esi
+  804248:	5f                   	pop    %edi
+  804249:	5d                   	pop    %ebp
+  80424a:	c3                   	ret
@@ -0,0 +1,8748 @@
+
+obj/user/testshell.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 54 04 00 00       	call   800485 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <wrong>:
+  breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec 84 00 00 00    	sub    $0x84,%esp
+  80003f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800042:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800045:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char buf[100];
+  int n;
+
+  seek(rfd, off);
+  800048:	53                   	push   %ebx
+  800049:	56                   	push   %esi
+  80004a:	e8 f3 1c 00 00       	call   801d42 <seek>
+  seek(kfd, off);
+  80004f:	83 c4 08             	add    $0x8,%esp
+  800052:	53                   	push   %ebx
+  800053:	57                   	push   %edi
+  800054:	e8 e9 1c 00 00       	call   801d42 <seek>
+
+  cprintf("shell produced incorrect output.\n");
+  800059:	c7 04 24 e0 43 80 00 	movl   $0x8043e0,(%esp)
+  800060:	e8 68 05 00 00       	call   8005cd <cprintf>
+  cprintf("expected:\n===\n");
+  800065:	c7 04 24 4b 44 80 00 	movl   $0x80444b,(%esp)
+  80006c:	e8 5c 05 00 00       	call   8005cd <cprintf>
+  while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800071:	83 c4 10             	add    $0x10,%esp
+  800074:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  800077:	eb 0d                	jmp    800086 <wrong+0x53>
+    sys_cputs(buf, n);
+  800079:	83 ec 08             	sub    $0x8,%esp
+  80007c:	50                   	push   %eax
+  80007d:	53                   	push   %ebx
+  80007e:	e8 68 0e 00 00       	call   800eeb <sys_cputs>
+  800083:	83 c4 10             	add    $0x10,%esp
+  while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800086:	83 ec 04             	sub    $0x4,%esp
+  800089:	6a 63                	push   $0x63
+  80008b:	53                   	push   %ebx
+  80008c:	57                   	push   %edi
+  80008d:	e8 60 1b 00 00       	call   801bf2 <read>
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	85 c0                	test   %eax,%eax
+  800097:	7f e0                	jg     800079 <wrong+0x46>
+  cprintf("===\ngot:\n===\n");
+  800099:	83 ec 0c             	sub    $0xc,%esp
+  80009c:	68 5a 44 80 00       	push   $0x80445a
+  8000a1:	e8 27 05 00 00       	call   8005cd <cprintf>
+  while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000a6:	83 c4 10             	add    $0x10,%esp
+  8000a9:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  8000ac:	eb 0d                	jmp    8000bb <wrong+0x88>
+    sys_cputs(buf, n);
+  8000ae:	83 ec 08             	sub    $0x8,%esp
+  8000b1:	50                   	push   %eax
+  8000b2:	53                   	push   %ebx
+  8000b3:	e8 33 0e 00 00       	call   800eeb <sys_cputs>
+  8000b8:	83 c4 10             	add    $0x10,%esp
+  while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	6a 63                	push   $0x63
+  8000c0:	53                   	push   %ebx
+  8000c1:	56                   	push   %esi
+  8000c2:	e8 2b 1b 00 00       	call   801bf2 <read>
+  8000c7:	83 c4 10             	add    $0x10,%esp
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f e0                	jg     8000ae <wrong+0x7b>
+  cprintf("===\n");
+  8000ce:	83 ec 0c             	sub    $0xc,%esp
+  8000d1:	68 55 44 80 00       	push   $0x804455
+  8000d6:	e8 f2 04 00 00       	call   8005cd <cprintf>
+  exit();
+  8000db:	e8 f8 03 00 00       	call   8004d8 <exit>
+}
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5f                   	pop    %edi
+  8000e9:	5d                   	pop    %ebp
+  8000ea:	c3                   	ret
+
+008000eb <umain>:
+{
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	57                   	push   %edi
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+  8000f1:	83 ec 38             	sub    $0x38,%esp
+  close(0);
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	e8 6f 19 00 00       	call   801a6a <close>
+  close(1);
+  8000fb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800102:	e8 63 19 00 00       	call   801a6a <close>
+  opencons();
+  800107:	e8 27 03 00 00       	call   800433 <opencons>
+  opencons();
+  80010c:	e8 22 03 00 00       	call   800433 <opencons>
+  if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800111:	83 c4 08             	add    $0x8,%esp
+  800114:	6a 00                	push   $0x0
+  800116:	68 68 44 80 00       	push   $0x804468
+  80011b:	e8 fd 22 00 00       	call   80241d <open>
+  800120:	89 c3                	mov    %eax,%ebx
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 e7 00 00 00    	js     800214 <umain+0x129>
+  if ((wfd = pipe(pfds)) < 0)
+  80012d:	83 ec 0c             	sub    $0xc,%esp
+  800130:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800133:	50                   	push   %eax
+  800134:	e8 e0 35 00 00       	call   803719 <pipe>
+  800139:	83 c4 10             	add    $0x10,%esp
+  80013c:	85 c0                	test   %eax,%eax
+  80013e:	0f 88 e2 00 00 00    	js     800226 <umain+0x13b>
+  wfd = pfds[1];
+  800144:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  cprintf("running sh -x < testshell.sh | cat\n");
+  800147:	83 ec 0c             	sub    $0xc,%esp
+  80014a:	68 04 44 80 00       	push   $0x804404
+  80014f:	e8 79 04 00 00       	call   8005cd <cprintf>
+  if ((r = fork()) < 0)
+  800154:	e8 fe 14 00 00       	call   801657 <fork>
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	85 c0                	test   %eax,%eax
+  80015e:	0f 88 d4 00 00 00    	js     800238 <umain+0x14d>
+  if (r == 0) {
+  800164:	75 6f                	jne    8001d5 <umain+0xea>
+    dup(rfd, 0);
+  800166:	83 ec 08             	sub    $0x8,%esp
+  800169:	6a 00                	push   $0x0
+  80016b:	53                   	push   %ebx
+  80016c:	e8 4b 19 00 00       	call   801abc <dup>
+    dup(wfd, 1);
+  800171:	83 c4 08             	add    $0x8,%esp
+  800174:	6a 01                	push   $0x1
+  800176:	56                   	push   %esi
+  800177:	e8 40 19 00 00       	call   801abc <dup>
+    close(rfd);
+  80017c:	89 1c 24             	mov    %ebx,(%esp)
+  80017f:	e8 e6 18 00 00       	call   801a6a <close>
+    close(wfd);
+  800184:	89 34 24             	mov    %esi,(%esp)
+  800187:	e8 de 18 00 00       	call   801a6a <close>
+    if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  80018c:	6a 00                	push   $0x0
+  80018e:	68 a5 44 80 00       	push   $0x8044a5
+  800193:	68 72 44 80 00       	push   $0x804472
+  800198:	68 a8 44 80 00       	push   $0x8044a8
+  80019d:	e8 6e 2e 00 00       	call   803010 <spawnl>
+  8001a2:	89 c7                	mov    %eax,%edi
+  8001a4:	83 c4 20             	add    $0x20,%esp
+  8001a7:	85 c0                	test   %eax,%eax
+  8001a9:	0f 88 9b 00 00 00    	js     80024a <umain+0x15f>
+    close(0);
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+  8001b2:	6a 00                	push   $0x0
+  8001b4:	e8 b1 18 00 00       	call   801a6a <close>
+    close(1);
+  8001b9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8001c0:	e8 a5 18 00 00       	call   801a6a <close>
+    wait(r);
+  8001c5:	89 3c 24             	mov    %edi,(%esp)
+  8001c8:	e8 44 37 00 00       	call   803911 <wait>
+    exit();
+  8001cd:	e8 06 03 00 00       	call   8004d8 <exit>
+  8001d2:	83 c4 10             	add    $0x10,%esp
+  close(rfd);
+  8001d5:	83 ec 0c             	sub    $0xc,%esp
+  8001d8:	53                   	push   %ebx
+  8001d9:	e8 8c 18 00 00       	call   801a6a <close>
+  close(wfd);
+  8001de:	89 34 24             	mov    %esi,(%esp)
+  8001e1:	e8 84 18 00 00       	call   801a6a <close>
+  rfd = pfds[0];
+  8001e6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8001e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8001ec:	83 c4 08             	add    $0x8,%esp
+  8001ef:	6a 00                	push   $0x0
+  8001f1:	68 b6 44 80 00       	push   $0x8044b6
+  8001f6:	e8 22 22 00 00       	call   80241d <open>
+  8001fb:	83 c4 10             	add    $0x10,%esp
+  8001fe:	85 c0                	test   %eax,%eax
+  800200:	78 5a                	js     80025c <umain+0x171>
+  800202:	be 01 00 00 00       	mov    $0x1,%esi
+  nloff = 0;
+  800207:	bf 00 00 00 00       	mov    $0x0,%edi
+    n2 = read(kfd, &c2, 1);
+  80020c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80020f:	e9 9a 00 00 00       	jmp    8002ae <umain+0x1c3>
+    panic("open testshell.sh: %e", rfd);
+  800214:	50                   	push   %eax
+  800215:	68 75 44 80 00       	push   $0x804475
+  80021a:	6a 13                	push   $0x13
+  80021c:	68 8b 44 80 00       	push   $0x80448b
+  800221:	e8 cc 02 00 00       	call   8004f2 <_panic>
+    panic("pipe: %e", wfd);
+  800226:	50                   	push   %eax
+  800227:	68 9c 44 80 00       	push   $0x80449c
+  80022c:	6a 15                	push   $0x15
+  80022e:	68 8b 44 80 00       	push   $0x80448b
+  800233:	e8 ba 02 00 00       	call   8004f2 <_panic>
+    panic("fork: %e", r);
+  800238:	50                   	push   %eax
+  800239:	68 03 49 80 00       	push   $0x804903
+  80023e:	6a 1a                	push   $0x1a
+  800240:	68 8b 44 80 00       	push   $0x80448b
+  800245:	e8 a8 02 00 00       	call   8004f2 <_panic>
+      panic("spawn: %e", r);
+  80024a:	50                   	push   %eax
+  80024b:	68 ac 44 80 00       	push   $0x8044ac
+  800250:	6a 21                	push   $0x21
+  800252:	68 8b 44 80 00       	push   $0x80448b
+  800257:	e8 96 02 00 00       	call   8004f2 <_panic>
+    panic("open testshell.key for reading: %e", kfd);
+  80025c:	50                   	push   %eax
+  80025d:	68 28 44 80 00       	push   $0x804428
+  800262:	6a 2c                	push   $0x2c
+  800264:	68 8b 44 80 00       	push   $0x80448b
+  800269:	e8 84 02 00 00       	call   8004f2 <_panic>
+      panic("reading testshell.out: %e", n1);
+  80026e:	53                   	push   %ebx
+  80026f:	68 c4 44 80 00       	push   $0x8044c4
+  800274:	6a 33                	push   $0x33
+  800276:	68 8b 44 80 00       	push   $0x80448b
+  80027b:	e8 72 02 00 00       	call   8004f2 <_panic>
+      panic("reading testshell.key: %e", n2);
+  800280:	50                   	push   %eax
+  800281:	68 de 44 80 00       	push   $0x8044de
+  800286:	6a 35                	push   $0x35
+  800288:	68 8b 44 80 00       	push   $0x80448b
+  80028d:	e8 60 02 00 00       	call   8004f2 <_panic>
+      wrong(rfd, kfd, nloff);
+  800292:	83 ec 04             	sub    $0x4,%esp
+  800295:	57                   	push   %edi
+  800296:	ff 75 d0             	push   -0x30(%ebp)
+  800299:	ff 75 d4             	push   -0x2c(%ebp)
+  80029c:	e8 92 fd ff ff       	call   800033 <wrong>
+  8002a1:	83 c4 10             	add    $0x10,%esp
+      nloff = off+1;
+  8002a4:	80 7d e7 0a          	cmpb   $0xa,-0x19(%ebp)
+  8002a8:	0f 44 fe             	cmove  %esi,%edi
+  for (off = 0;; off++) {
+  8002ab:	83 c6 01             	add    $0x1,%esi
+    n1 = read(rfd, &c1, 1);
+  8002ae:	83 ec 04             	sub    $0x4,%esp
+  8002b1:	6a 01                	push   $0x1
+  8002b3:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  8002b6:	50                   	push   %eax
+  8002b7:	ff 75 d4             	push   -0x2c(%ebp)
+  8002ba:	e8 33 19 00 00       	call   801bf2 <read>
+  8002bf:	89 c3                	mov    %eax,%ebx
+    n2 = read(kfd, &c2, 1);
+  8002c1:	83 c4 0c             	add    $0xc,%esp
+  8002c4:	6a 01                	push   $0x1
+  8002c6:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  8002c9:	50                   	push   %eax
+  8002ca:	ff 75 d0             	push   -0x30(%ebp)
+  8002cd:	e8 20 19 00 00       	call   801bf2 <read>
+    if (n1 < 0)
+  8002d2:	83 c4 10             	add    $0x10,%esp
+  8002d5:	85 db                	test   %ebx,%ebx
+  8002d7:	78 95                	js     80026e <umain+0x183>
+    if (n2 < 0)
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	78 a3                	js     800280 <umain+0x195>
+    if (n1 == 0 && n2 == 0)
+  8002dd:	89 d9                	mov    %ebx,%ecx
+  8002df:	09 c1                	or     %eax,%ecx
+  8002e1:	74 15                	je     8002f8 <umain+0x20d>
+    if (n1 != 1 || n2 != 1 || c1 != c2)
+  8002e3:	83 fb 01             	cmp    $0x1,%ebx
+  8002e6:	75 aa                	jne    800292 <umain+0x1a7>
+  8002e8:	83 f8 01             	cmp    $0x1,%eax
+  8002eb:	75 a5                	jne    800292 <umain+0x1a7>
+  8002ed:	0f b6 45 e6          	movzbl -0x1a(%ebp),%eax
+  8002f1:	38 45 e7             	cmp    %al,-0x19(%ebp)
+  8002f4:	75 9c                	jne    800292 <umain+0x1a7>
+  8002f6:	eb ac                	jmp    8002a4 <umain+0x1b9>
+  cprintf("shell ran correctly\n");
+  8002f8:	83 ec 0c             	sub    $0xc,%esp
+  8002fb:	68 f8 44 80 00       	push   $0x8044f8
+  800300:	e8 c8 02 00 00       	call   8005cd <cprintf>
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+  __asm __volatile("int3");
+  800305:	cc                   	int3
+}
+  800306:	83 c4 10             	add    $0x10,%esp
+  800309:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030c:	5b                   	pop    %ebx
+  80030d:	5e                   	pop    %esi
+  80030e:	5f                   	pop    %edi
+  80030f:	5d                   	pop    %ebp
+  800310:	c3                   	ret
+
+00800311 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	c3                   	ret
+
+00800317 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  80031d:	68 0d 45 80 00       	push   $0x80450d
+  800322:	ff 75 0c             	push   0xc(%ebp)
+  800325:	e8 91 08 00 00       	call   800bbb <strcpy>
+  return 0;
+}
+  80032a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032f:	c9                   	leave
+  800330:	c3                   	ret
+
+00800331 <devcons_write>:
+{
+  800331:	55                   	push   %ebp
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	57                   	push   %edi
+  800335:	56                   	push   %esi
+  800336:	53                   	push   %ebx
+  800337:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  80033d:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  800342:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  800348:	eb 2e                	jmp    800378 <devcons_write+0x47>
+    m = n - tot;
+  80034a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80034d:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  80034f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  800354:	39 c3                	cmp    %eax,%ebx
+  800356:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  800359:	83 ec 04             	sub    $0x4,%esp
+  80035c:	53                   	push   %ebx
+  80035d:	89 f0                	mov    %esi,%eax
+  80035f:	03 45 0c             	add    0xc(%ebp),%eax
+  800362:	50                   	push   %eax
+  800363:	57                   	push   %edi
+  800364:	e8 d8 09 00 00       	call   800d41 <memmove>
+    sys_cputs(buf, m);
+  800369:	83 c4 08             	add    $0x8,%esp
+  80036c:	53                   	push   %ebx
+  80036d:	57                   	push   %edi
+  80036e:	e8 78 0b 00 00       	call   800eeb <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  800373:	01 de                	add    %ebx,%esi
+  800375:	83 c4 10             	add    $0x10,%esp
+  800378:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80037b:	72 cd                	jb     80034a <devcons_write+0x19>
+}
+  80037d:	89 f0                	mov    %esi,%eax
+  80037f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800382:	5b                   	pop    %ebx
+  800383:	5e                   	pop    %esi
+  800384:	5f                   	pop    %edi
+  800385:	5d                   	pop    %ebp
+  800386:	c3                   	ret
+
+00800387 <devcons_read>:
+{
+  800387:	55                   	push   %ebp
+  800388:	89 e5                	mov    %esp,%ebp
+  80038a:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  80038d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800392:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800396:	75 07                	jne    80039f <devcons_read+0x18>
+  800398:	eb 1f                	jmp    8003b9 <devcons_read+0x32>
+    sys_yield();
+  80039a:	e8 e9 0b 00 00       	call   800f88 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  80039f:	e8 65 0b 00 00       	call   800f09 <sys_cgetc>
+  8003a4:	85 c0                	test   %eax,%eax
+  8003a6:	74 f2                	je     80039a <devcons_read+0x13>
+  if (c < 0)
+  8003a8:	78 0f                	js     8003b9 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  8003aa:	83 f8 04             	cmp    $0x4,%eax
+  8003ad:	74 0c                	je     8003bb <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8003af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003b2:	88 02                	mov    %al,(%edx)
+  return 1;
+  8003b4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8003b9:	c9                   	leave
+  8003ba:	c3                   	ret
+    return 0;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c0:	eb f7                	jmp    8003b9 <devcons_read+0x32>
+
+008003c2 <cputchar>:
+{
+  8003c2:	55                   	push   %ebp
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  8003c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003cb:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8003ce:	6a 01                	push   $0x1
+  8003d0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003d3:	50                   	push   %eax
+  8003d4:	e8 12 0b 00 00       	call   800eeb <sys_cputs>
+}
+  8003d9:	83 c4 10             	add    $0x10,%esp
+  8003dc:	c9                   	leave
+  8003dd:	c3                   	ret
+
+008003de <getchar>:
+{
+  8003de:	55                   	push   %ebp
+  8003df:	89 e5                	mov    %esp,%ebp
+  8003e1:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8003e4:	6a 01                	push   $0x1
+  8003e6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003e9:	50                   	push   %eax
+  8003ea:	6a 00                	push   $0x0
+  8003ec:	e8 01 18 00 00       	call   801bf2 <read>
+  if (r < 0)
+  8003f1:	83 c4 10             	add    $0x10,%esp
+  8003f4:	85 c0                	test   %eax,%eax
+  8003f6:	78 06                	js     8003fe <getchar+0x20>
+  if (r < 1)
+  8003f8:	74 06                	je     800400 <getchar+0x22>
+  return c;
+  8003fa:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8003fe:	c9                   	leave
+  8003ff:	c3                   	ret
+    return -E_EOF;
+  800400:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800405:	eb f7                	jmp    8003fe <getchar+0x20>
+
+00800407 <iscons>:
+{
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80040d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800410:	50                   	push   %eax
+  800411:	ff 75 08             	push   0x8(%ebp)
+  800414:	e8 2e 15 00 00       	call   801947 <fd_lookup>
+  800419:	83 c4 10             	add    $0x10,%esp
+  80041c:	85 c0                	test   %eax,%eax
+  80041e:	78 11                	js     800431 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  800420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800423:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  800429:	39 10                	cmp    %edx,(%eax)
+  80042b:	0f 94 c0             	sete   %al
+  80042e:	0f b6 c0             	movzbl %al,%eax
+}
+  800431:	c9                   	leave
+  800432:	c3                   	ret
+
+00800433 <opencons>:
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  800439:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80043c:	50                   	push   %eax
+  80043d:	e8 af 14 00 00       	call   8018f1 <fd_alloc>
+  800442:	83 c4 10             	add    $0x10,%esp
+  800445:	85 c0                	test   %eax,%eax
+  800447:	78 3a                	js     800483 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800449:	83 ec 04             	sub    $0x4,%esp
+  80044c:	68 07 04 00 00       	push   $0x407
+  800451:	ff 75 f4             	push   -0xc(%ebp)
+  800454:	6a 00                	push   $0x0
+  800456:	e8 8f 0b 00 00       	call   800fea <sys_page_alloc>
+  80045b:	83 c4 10             	add    $0x10,%esp
+  80045e:	85 c0                	test   %eax,%eax
+  800460:	78 21                	js     800483 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  800462:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800465:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80046b:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  80046d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800470:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  800477:	83 ec 0c             	sub    $0xc,%esp
+  80047a:	50                   	push   %eax
+  80047b:	e8 4d 14 00 00       	call   8018cd <fd2num>
+  800480:	83 c4 10             	add    $0x10,%esp
+}
+  800483:	c9                   	leave
+  800484:	c3                   	ret
+
+00800485 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800485:	55                   	push   %ebp
+  800486:	89 e5                	mov    %esp,%ebp
+  800488:	56                   	push   %esi
+  800489:	53                   	push   %ebx
+  80048a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80048d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800490:	c7 05 c0 6f 80 00 00 	movl   $0x0,0x806fc0
+  800497:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  80049a:	e8 ca 0a 00 00       	call   800f69 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80049f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004a4:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8004a7:	c1 e0 04             	shl    $0x4,%eax
+  8004aa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004af:	a3 c0 6f 80 00       	mov    %eax,0x806fc0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8004b4:	85 db                	test   %ebx,%ebx
+  8004b6:	7e 07                	jle    8004bf <libmain+0x3a>
+    binaryname = argv[0];
+  8004b8:	8b 06                	mov    (%esi),%eax
+  8004ba:	a3 1c 50 80 00       	mov    %eax,0x80501c
+
+  // call user main routine
+  umain(argc, argv);
+  8004bf:	83 ec 08             	sub    $0x8,%esp
+  8004c2:	56                   	push   %esi
+  8004c3:	53                   	push   %ebx
+  8004c4:	e8 22 fc ff ff       	call   8000eb <umain>
+
+  // exit gracefully
+  exit();
+  8004c9:	e8 0a 00 00 00       	call   8004d8 <exit>
+}
+  8004ce:	83 c4 10             	add    $0x10,%esp
+  8004d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8004d4:	5b                   	pop    %ebx
+  8004d5:	5e                   	pop    %esi
+  8004d6:	5d                   	pop    %ebp
+  8004d7:	c3                   	ret
+
+008004d8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8004d8:	55                   	push   %ebp
+  8004d9:	89 e5                	mov    %esp,%ebp
+  8004db:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8004de:	e8 b4 15 00 00       	call   801a97 <close_all>
+  sys_env_destroy(0);
+  8004e3:	83 ec 0c             	sub    $0xc,%esp
+  8004e6:	6a 00                	push   $0x0
+  8004e8:	e8 3b 0a 00 00       	call   800f28 <sys_env_destroy>
+}
+  8004ed:	83 c4 10             	add    $0x10,%esp
+  8004f0:	c9                   	leave
+  8004f1:	c3                   	ret
+
+008004f2 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8004f2:	55                   	push   %ebp
+  8004f3:	89 e5                	mov    %esp,%ebp
+  8004f5:	56                   	push   %esi
+  8004f6:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8004f7:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004fa:	8b 35 1c 50 80 00    	mov    0x80501c,%esi
+  800500:	e8 64 0a 00 00       	call   800f69 <sys_getenvid>
+  800505:	83 ec 0c             	sub    $0xc,%esp
+  800508:	ff 75 0c             	push   0xc(%ebp)
+  80050b:	ff 75 08             	push   0x8(%ebp)
+  80050e:	56                   	push   %esi
+  80050f:	50                   	push   %eax
+  800510:	68 24 45 80 00       	push   $0x804524
+  800515:	e8 b3 00 00 00       	call   8005cd <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80051a:	83 c4 18             	add    $0x18,%esp
+  80051d:	53                   	push   %ebx
+  80051e:	ff 75 10             	push   0x10(%ebp)
+  800521:	e8 56 00 00 00       	call   80057c <vcprintf>
+  cprintf("\n");
+  800526:	c7 04 24 58 44 80 00 	movl   $0x804458,(%esp)
+  80052d:	e8 9b 00 00 00       	call   8005cd <cprintf>
+  800532:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800535:	cc                   	int3
+  while (1)
+  800536:	eb fd                	jmp    800535 <_panic+0x43>
+
+00800538 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800538:	55                   	push   %ebp
+  800539:	89 e5                	mov    %esp,%ebp
+  80053b:	53                   	push   %ebx
+  80053c:	83 ec 04             	sub    $0x4,%esp
+  80053f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800542:	8b 13                	mov    (%ebx),%edx
+  800544:	8d 42 01             	lea    0x1(%edx),%eax
+  800547:	89 03                	mov    %eax,(%ebx)
+  800549:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80054c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800550:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800555:	74 09                	je     800560 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800557:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80055b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80055e:	c9                   	leave
+  80055f:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800560:	83 ec 08             	sub    $0x8,%esp
+  800563:	68 ff 00 00 00       	push   $0xff
+  800568:	8d 43 08             	lea    0x8(%ebx),%eax
+  80056b:	50                   	push   %eax
+  80056c:	e8 7a 09 00 00       	call   800eeb <sys_cputs>
+    b->idx = 0;
+  800571:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800577:	83 c4 10             	add    $0x10,%esp
+  80057a:	eb db                	jmp    800557 <putch+0x1f>
+
+0080057c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80057c:	55                   	push   %ebp
+  80057d:	89 e5                	mov    %esp,%ebp
+  80057f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800585:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80058c:	00 00 00 
+  b.cnt = 0;
+  80058f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800596:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800599:	ff 75 0c             	push   0xc(%ebp)
+  80059c:	ff 75 08             	push   0x8(%ebp)
+  80059f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005a5:	50                   	push   %eax
+  8005a6:	68 38 05 80 00       	push   $0x800538
+  8005ab:	e8 14 01 00 00       	call   8006c4 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8005b0:	83 c4 08             	add    $0x8,%esp
+  8005b3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005b9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005bf:	50                   	push   %eax
+  8005c0:	e8 26 09 00 00       	call   800eeb <sys_cputs>
+
+  return b.cnt;
+}
+  8005c5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005cb:	c9                   	leave
+  8005cc:	c3                   	ret
+
+008005cd <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005cd:	55                   	push   %ebp
+  8005ce:	89 e5                	mov    %esp,%ebp
+  8005d0:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8005d3:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8005d6:	50                   	push   %eax
+  8005d7:	ff 75 08             	push   0x8(%ebp)
+  8005da:	e8 9d ff ff ff       	call   80057c <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8005df:	c9                   	leave
+  8005e0:	c3                   	ret
+
+008005e1 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8005e1:	55                   	push   %ebp
+  8005e2:	89 e5                	mov    %esp,%ebp
+  8005e4:	57                   	push   %edi
+  8005e5:	56                   	push   %esi
+  8005e6:	53                   	push   %ebx
+  8005e7:	83 ec 1c             	sub    $0x1c,%esp
+  8005ea:	89 c7                	mov    %eax,%edi
+  8005ec:	89 d6                	mov    %edx,%esi
+  8005ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005f4:	89 d1                	mov    %edx,%ecx
+  8005f6:	89 c2                	mov    %eax,%edx
+  8005f8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005fe:	8b 45 10             	mov    0x10(%ebp),%eax
+  800601:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800604:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800607:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80060e:	39 c2                	cmp    %eax,%edx
+  800610:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800613:	72 3e                	jb     800653 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800615:	83 ec 0c             	sub    $0xc,%esp
+  800618:	ff 75 18             	push   0x18(%ebp)
+  80061b:	83 eb 01             	sub    $0x1,%ebx
+  80061e:	53                   	push   %ebx
+  80061f:	50                   	push   %eax
+  800620:	83 ec 08             	sub    $0x8,%esp
+  800623:	ff 75 e4             	push   -0x1c(%ebp)
+  800626:	ff 75 e0             	push   -0x20(%ebp)
+  800629:	ff 75 dc             	push   -0x24(%ebp)
+  80062c:	ff 75 d8             	push   -0x28(%ebp)
+  80062f:	e8 14 3c 00 00       	call   804248 <__udivdi3>
+  800634:	83 c4 18             	add    $0x18,%esp
+  800637:	52                   	push   %edx
+  800638:	50                   	push   %eax
+  800639:	89 f2                	mov    %esi,%edx
+  80063b:	89 f8                	mov    %edi,%eax
+  80063d:	e8 9f ff ff ff       	call   8005e1 <printnum>
+  800642:	83 c4 20             	add    $0x20,%esp
+  800645:	eb 13                	jmp    80065a <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800647:	83 ec 08             	sub    $0x8,%esp
+  80064a:	56                   	push   %esi
+  80064b:	ff 75 18             	push   0x18(%ebp)
+  80064e:	ff d7                	call   *%edi
+  800650:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800653:	83 eb 01             	sub    $0x1,%ebx
+  800656:	85 db                	test   %ebx,%ebx
+  800658:	7f ed                	jg     800647 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80065a:	83 ec 08             	sub    $0x8,%esp
+  80065d:	56                   	push   %esi
+  80065e:	83 ec 04             	sub    $0x4,%esp
+  800661:	ff 75 e4             	push   -0x1c(%ebp)
+  800664:	ff 75 e0             	push   -0x20(%ebp)
+  800667:	ff 75 dc             	push   -0x24(%ebp)
+  80066a:	ff 75 d8             	push   -0x28(%ebp)
+  80066d:	e8 f7 3b 00 00       	call   804269 <__umoddi3>
+  800672:	83 c4 14             	add    $0x14,%esp
+  800675:	0f be 80 47 45 80 00 	movsbl 0x804547(%eax),%eax
+  80067c:	50                   	push   %eax
+  80067d:	ff d7                	call   *%edi
+}
+  80067f:	83 c4 10             	add    $0x10,%esp
+  800682:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800685:	5b                   	pop    %ebx
+  800686:	5e                   	pop    %esi
+  800687:	5f                   	pop    %edi
+  800688:	5d                   	pop    %ebp
+  800689:	c3                   	ret
+
+0080068a <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80068a:	55                   	push   %ebp
+  80068b:	89 e5                	mov    %esp,%ebp
+  80068d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800690:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800694:	8b 10                	mov    (%eax),%edx
+  800696:	3b 50 04             	cmp    0x4(%eax),%edx
+  800699:	73 0a                	jae    8006a5 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80069b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80069e:	89 08                	mov    %ecx,(%eax)
+  8006a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006a3:	88 02                	mov    %al,(%edx)
+}
+  8006a5:	5d                   	pop    %ebp
+  8006a6:	c3                   	ret
+
+008006a7 <printfmt>:
+{
+  8006a7:	55                   	push   %ebp
+  8006a8:	89 e5                	mov    %esp,%ebp
+  8006aa:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8006ad:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8006b0:	50                   	push   %eax
+  8006b1:	ff 75 10             	push   0x10(%ebp)
+  8006b4:	ff 75 0c             	push   0xc(%ebp)
+  8006b7:	ff 75 08             	push   0x8(%ebp)
+  8006ba:	e8 05 00 00 00       	call   8006c4 <vprintfmt>
+}
+  8006bf:	83 c4 10             	add    $0x10,%esp
+  8006c2:	c9                   	leave
+  8006c3:	c3                   	ret
+
+008006c4 <vprintfmt>:
+{
+  8006c4:	55                   	push   %ebp
+  8006c5:	89 e5                	mov    %esp,%ebp
+  8006c7:	57                   	push   %edi
+  8006c8:	56                   	push   %esi
+  8006c9:	53                   	push   %ebx
+  8006ca:	83 ec 2c             	sub    $0x2c,%esp
+  8006cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006d0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006d3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8006d6:	eb 0a                	jmp    8006e2 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8006d8:	83 ec 08             	sub    $0x8,%esp
+  8006db:	53                   	push   %ebx
+  8006dc:	50                   	push   %eax
+  8006dd:	ff d6                	call   *%esi
+  8006df:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8006e2:	83 c7 01             	add    $0x1,%edi
+  8006e5:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8006e9:	83 f8 25             	cmp    $0x25,%eax
+  8006ec:	74 0c                	je     8006fa <vprintfmt+0x36>
+      if (ch == '\0')
+  8006ee:	85 c0                	test   %eax,%eax
+  8006f0:	75 e6                	jne    8006d8 <vprintfmt+0x14>
+}
+  8006f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006f5:	5b                   	pop    %ebx
+  8006f6:	5e                   	pop    %esi
+  8006f7:	5f                   	pop    %edi
+  8006f8:	5d                   	pop    %ebp
+  8006f9:	c3                   	ret
+    padc = ' ';
+  8006fa:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8006fe:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800705:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80070c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800713:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800718:	8d 47 01             	lea    0x1(%edi),%eax
+  80071b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80071e:	0f b6 17             	movzbl (%edi),%edx
+  800721:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800724:	3c 55                	cmp    $0x55,%al
+  800726:	0f 87 cf 03 00 00    	ja     800afb <vprintfmt+0x437>
+  80072c:	0f b6 c0             	movzbl %al,%eax
+  80072f:	ff 24 85 a0 46 80 00 	jmp    *0x8046a0(,%eax,4)
+  800736:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800739:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80073d:	eb d9                	jmp    800718 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80073f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800742:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800746:	eb d0                	jmp    800718 <vprintfmt+0x54>
+  800748:	0f b6 d2             	movzbl %dl,%edx
+  80074b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  80074e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800753:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800756:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800759:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  80075d:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800760:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800763:	83 f9 09             	cmp    $0x9,%ecx
+  800766:	77 55                	ja     8007bd <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800768:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  80076b:	eb e9                	jmp    800756 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  80076d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800770:	8b 00                	mov    (%eax),%eax
+  800772:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800775:	8b 45 14             	mov    0x14(%ebp),%eax
+  800778:	8d 40 04             	lea    0x4(%eax),%eax
+  80077b:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80077e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800781:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800785:	79 91                	jns    800718 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800787:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80078a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80078d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800794:	eb 82                	jmp    800718 <vprintfmt+0x54>
+      if (width < 0)
+  800796:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800799:	85 d2                	test   %edx,%edx
+  80079b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a0:	0f 49 c2             	cmovns %edx,%eax
+  8007a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8007a6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8007a9:	e9 6a ff ff ff       	jmp    800718 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8007ae:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8007b1:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8007b8:	e9 5b ff ff ff       	jmp    800718 <vprintfmt+0x54>
+  8007bd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007c0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007c3:	eb bc                	jmp    800781 <vprintfmt+0xbd>
+      lflag++;
+  8007c5:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8007c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8007cb:	e9 48 ff ff ff       	jmp    800718 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8007d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d3:	8d 78 04             	lea    0x4(%eax),%edi
+  8007d6:	83 ec 08             	sub    $0x8,%esp
+  8007d9:	53                   	push   %ebx
+  8007da:	ff 30                	push   (%eax)
+  8007dc:	ff d6                	call   *%esi
+      break;
+  8007de:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8007e1:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8007e4:	e9 b1 02 00 00       	jmp    800a9a <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8007e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ec:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8007ef:	8b 10                	mov    (%eax),%edx
+  8007f1:	89 d0                	mov    %edx,%eax
+  8007f3:	f7 d8                	neg    %eax
+  8007f5:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007f8:	83 f8 10             	cmp    $0x10,%eax
+  8007fb:	7f 23                	jg     800820 <vprintfmt+0x15c>
+  8007fd:	8b 14 85 00 48 80 00 	mov    0x804800(,%eax,4),%edx
+  800804:	85 d2                	test   %edx,%edx
+  800806:	74 18                	je     800820 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800808:	52                   	push   %edx
+  800809:	68 16 4a 80 00       	push   $0x804a16
+  80080e:	53                   	push   %ebx
+  80080f:	56                   	push   %esi
+  800810:	e8 92 fe ff ff       	call   8006a7 <printfmt>
+  800815:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800818:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80081b:	e9 7a 02 00 00       	jmp    800a9a <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800820:	50                   	push   %eax
+  800821:	68 5f 45 80 00       	push   $0x80455f
+  800826:	53                   	push   %ebx
+  800827:	56                   	push   %esi
+  800828:	e8 7a fe ff ff       	call   8006a7 <printfmt>
+  80082d:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800830:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800833:	e9 62 02 00 00       	jmp    800a9a <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800838:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083b:	83 c0 04             	add    $0x4,%eax
+  80083e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800841:	8b 45 14             	mov    0x14(%ebp),%eax
+  800844:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800846:	85 c9                	test   %ecx,%ecx
+  800848:	b8 58 45 80 00       	mov    $0x804558,%eax
+  80084d:	0f 45 c1             	cmovne %ecx,%eax
+  800850:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800853:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800857:	7e 06                	jle    80085f <vprintfmt+0x19b>
+  800859:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80085d:	75 0b                	jne    80086a <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80085f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800862:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800865:	89 75 08             	mov    %esi,0x8(%ebp)
+  800868:	eb 5c                	jmp    8008c6 <vprintfmt+0x202>
+  80086a:	83 ec 08             	sub    $0x8,%esp
+  80086d:	ff 75 d0             	push   -0x30(%ebp)
+  800870:	ff 75 cc             	push   -0x34(%ebp)
+  800873:	e8 20 03 00 00       	call   800b98 <strnlen>
+  800878:	89 c2                	mov    %eax,%edx
+  80087a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80087d:	29 d0                	sub    %edx,%eax
+  80087f:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800882:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800886:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800889:	89 75 08             	mov    %esi,0x8(%ebp)
+  80088c:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80088e:	eb 0e                	jmp    80089e <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800890:	83 ec 08             	sub    $0x8,%esp
+  800893:	53                   	push   %ebx
+  800894:	57                   	push   %edi
+  800895:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800898:	83 ee 01             	sub    $0x1,%esi
+  80089b:	83 c4 10             	add    $0x10,%esp
+  80089e:	85 f6                	test   %esi,%esi
+  8008a0:	7f ee                	jg     800890 <vprintfmt+0x1cc>
+  8008a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008a5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a8:	85 c0                	test   %eax,%eax
+  8008aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008af:	0f 49 d0             	cmovns %eax,%edx
+  8008b2:	29 d0                	sub    %edx,%eax
+  8008b4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008b7:	eb a6                	jmp    80085f <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8008b9:	83 ec 08             	sub    $0x8,%esp
+  8008bc:	53                   	push   %ebx
+  8008bd:	52                   	push   %edx
+  8008be:	ff 55 08             	call   *0x8(%ebp)
+  8008c1:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008c4:	89 f1                	mov    %esi,%ecx
+  8008c6:	8d 71 01             	lea    0x1(%ecx),%esi
+  8008c9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008cd:	0f be d0             	movsbl %al,%edx
+  8008d0:	85 d2                	test   %edx,%edx
+  8008d2:	74 28                	je     8008fc <vprintfmt+0x238>
+  8008d4:	85 ff                	test   %edi,%edi
+  8008d6:	78 05                	js     8008dd <vprintfmt+0x219>
+  8008d8:	83 ef 01             	sub    $0x1,%edi
+  8008db:	78 30                	js     80090d <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8008dd:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008e1:	74 d6                	je     8008b9 <vprintfmt+0x1f5>
+  8008e3:	0f be c0             	movsbl %al,%eax
+  8008e6:	83 e8 20             	sub    $0x20,%eax
+  8008e9:	83 f8 5e             	cmp    $0x5e,%eax
+  8008ec:	76 cb                	jbe    8008b9 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8008ee:	83 ec 08             	sub    $0x8,%esp
+  8008f1:	53                   	push   %ebx
+  8008f2:	6a 3f                	push   $0x3f
+  8008f4:	ff 55 08             	call   *0x8(%ebp)
+  8008f7:	83 c4 10             	add    $0x10,%esp
+  8008fa:	eb c8                	jmp    8008c4 <vprintfmt+0x200>
+  8008fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ff:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800902:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800905:	01 d0                	add    %edx,%eax
+  800907:	29 c8                	sub    %ecx,%eax
+  800909:	89 c7                	mov    %eax,%edi
+  80090b:	eb 13                	jmp    800920 <vprintfmt+0x25c>
+  80090d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800910:	eb ed                	jmp    8008ff <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800912:	83 ec 08             	sub    $0x8,%esp
+  800915:	53                   	push   %ebx
+  800916:	6a 20                	push   $0x20
+  800918:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80091a:	83 ef 01             	sub    $0x1,%edi
+  80091d:	83 c4 10             	add    $0x10,%esp
+  800920:	85 ff                	test   %edi,%edi
+  800922:	7f ee                	jg     800912 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800924:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800927:	89 45 14             	mov    %eax,0x14(%ebp)
+  80092a:	e9 6b 01 00 00       	jmp    800a9a <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  80092f:	83 f9 01             	cmp    $0x1,%ecx
+  800932:	7f 1f                	jg     800953 <vprintfmt+0x28f>
+  else if (lflag)
+  800934:	85 c9                	test   %ecx,%ecx
+  800936:	74 67                	je     80099f <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800938:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093b:	8b 00                	mov    (%eax),%eax
+  80093d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800940:	89 c1                	mov    %eax,%ecx
+  800942:	c1 f9 1f             	sar    $0x1f,%ecx
+  800945:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800948:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094b:	8d 40 04             	lea    0x4(%eax),%eax
+  80094e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800951:	eb 17                	jmp    80096a <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800953:	8b 45 14             	mov    0x14(%ebp),%eax
+  800956:	8b 50 04             	mov    0x4(%eax),%edx
+  800959:	8b 00                	mov    (%eax),%eax
+  80095b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80095e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800961:	8b 45 14             	mov    0x14(%ebp),%eax
+  800964:	8d 40 08             	lea    0x8(%eax),%eax
+  800967:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  80096a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80096d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800970:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800975:	85 c9                	test   %ecx,%ecx
+  800977:	0f 89 03 01 00 00    	jns    800a80 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  80097d:	83 ec 08             	sub    $0x8,%esp
+  800980:	53                   	push   %ebx
+  800981:	6a 2d                	push   $0x2d
+  800983:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800985:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800988:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80098b:	f7 da                	neg    %edx
+  80098d:	83 d1 00             	adc    $0x0,%ecx
+  800990:	f7 d9                	neg    %ecx
+  800992:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800995:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80099a:	e9 e1 00 00 00       	jmp    800a80 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  80099f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a2:	8b 00                	mov    (%eax),%eax
+  8009a4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009a7:	89 c1                	mov    %eax,%ecx
+  8009a9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009ac:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009b8:	eb b0                	jmp    80096a <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8009ba:	83 f9 01             	cmp    $0x1,%ecx
+  8009bd:	7f 1e                	jg     8009dd <vprintfmt+0x319>
+  else if (lflag)
+  8009bf:	85 c9                	test   %ecx,%ecx
+  8009c1:	74 32                	je     8009f5 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8009c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c6:	8b 10                	mov    (%eax),%edx
+  8009c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8009d0:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8009d3:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8009d8:	e9 a3 00 00 00       	jmp    800a80 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8009dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e0:	8b 10                	mov    (%eax),%edx
+  8009e2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009e5:	8d 40 08             	lea    0x8(%eax),%eax
+  8009e8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8009eb:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8009f0:	e9 8b 00 00 00       	jmp    800a80 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8009f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f8:	8b 10                	mov    (%eax),%edx
+  8009fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800a02:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800a05:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800a0a:	eb 74                	jmp    800a80 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800a0c:	83 f9 01             	cmp    $0x1,%ecx
+  800a0f:	7f 1b                	jg     800a2c <vprintfmt+0x368>
+  else if (lflag)
+  800a11:	85 c9                	test   %ecx,%ecx
+  800a13:	74 2c                	je     800a41 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800a15:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a18:	8b 10                	mov    (%eax),%edx
+  800a1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a1f:	8d 40 04             	lea    0x4(%eax),%eax
+  800a22:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800a25:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800a2a:	eb 54                	jmp    800a80 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800a2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a2f:	8b 10                	mov    (%eax),%edx
+  800a31:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a34:	8d 40 08             	lea    0x8(%eax),%eax
+  800a37:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800a3a:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800a3f:	eb 3f                	jmp    800a80 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800a41:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a44:	8b 10                	mov    (%eax),%edx
+  800a46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a4b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a4e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800a51:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800a56:	eb 28                	jmp    800a80 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800a58:	83 ec 08             	sub    $0x8,%esp
+  800a5b:	53                   	push   %ebx
+  800a5c:	6a 30                	push   $0x30
+  800a5e:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800a60:	83 c4 08             	add    $0x8,%esp
+  800a63:	53                   	push   %ebx
+  800a64:	6a 78                	push   $0x78
+  800a66:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800a68:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6b:	8b 10                	mov    (%eax),%edx
+  800a6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800a72:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800a75:	8d 40 04             	lea    0x4(%eax),%eax
+  800a78:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800a7b:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800a80:	83 ec 0c             	sub    $0xc,%esp
+  800a83:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a87:	50                   	push   %eax
+  800a88:	ff 75 e0             	push   -0x20(%ebp)
+  800a8b:	57                   	push   %edi
+  800a8c:	51                   	push   %ecx
+  800a8d:	52                   	push   %edx
+  800a8e:	89 da                	mov    %ebx,%edx
+  800a90:	89 f0                	mov    %esi,%eax
+  800a92:	e8 4a fb ff ff       	call   8005e1 <printnum>
+      break;
+  800a97:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800a9a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800a9d:	e9 40 fc ff ff       	jmp    8006e2 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800aa2:	83 f9 01             	cmp    $0x1,%ecx
+  800aa5:	7f 1b                	jg     800ac2 <vprintfmt+0x3fe>
+  else if (lflag)
+  800aa7:	85 c9                	test   %ecx,%ecx
+  800aa9:	74 2c                	je     800ad7 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800aab:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aae:	8b 10                	mov    (%eax),%edx
+  800ab0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab5:	8d 40 04             	lea    0x4(%eax),%eax
+  800ab8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800abb:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800ac0:	eb be                	jmp    800a80 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800ac2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac5:	8b 10                	mov    (%eax),%edx
+  800ac7:	8b 48 04             	mov    0x4(%eax),%ecx
+  800aca:	8d 40 08             	lea    0x8(%eax),%eax
+  800acd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800ad0:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800ad5:	eb a9                	jmp    800a80 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800ad7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ada:	8b 10                	mov    (%eax),%edx
+  800adc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ae1:	8d 40 04             	lea    0x4(%eax),%eax
+  800ae4:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800ae7:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800aec:	eb 92                	jmp    800a80 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800aee:	83 ec 08             	sub    $0x8,%esp
+  800af1:	53                   	push   %ebx
+  800af2:	6a 25                	push   $0x25
+  800af4:	ff d6                	call   *%esi
+      break;
+  800af6:	83 c4 10             	add    $0x10,%esp
+  800af9:	eb 9f                	jmp    800a9a <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800afb:	83 ec 08             	sub    $0x8,%esp
+  800afe:	53                   	push   %ebx
+  800aff:	6a 25                	push   $0x25
+  800b01:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800b03:	83 c4 10             	add    $0x10,%esp
+  800b06:	89 f8                	mov    %edi,%eax
+  800b08:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b0c:	74 05                	je     800b13 <vprintfmt+0x44f>
+  800b0e:	83 e8 01             	sub    $0x1,%eax
+  800b11:	eb f5                	jmp    800b08 <vprintfmt+0x444>
+  800b13:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b16:	eb 82                	jmp    800a9a <vprintfmt+0x3d6>
+
+00800b18 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b18:	55                   	push   %ebp
+  800b19:	89 e5                	mov    %esp,%ebp
+  800b1b:	83 ec 18             	sub    $0x18,%esp
+  800b1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b21:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800b24:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b27:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b2b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b2e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800b35:	85 c0                	test   %eax,%eax
+  800b37:	74 26                	je     800b5f <vsnprintf+0x47>
+  800b39:	85 d2                	test   %edx,%edx
+  800b3b:	7e 22                	jle    800b5f <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b3d:	ff 75 14             	push   0x14(%ebp)
+  800b40:	ff 75 10             	push   0x10(%ebp)
+  800b43:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b46:	50                   	push   %eax
+  800b47:	68 8a 06 80 00       	push   $0x80068a
+  800b4c:	e8 73 fb ff ff       	call   8006c4 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800b51:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b54:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800b57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b5a:	83 c4 10             	add    $0x10,%esp
+}
+  800b5d:	c9                   	leave
+  800b5e:	c3                   	ret
+    return -E_INVAL;
+  800b5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b64:	eb f7                	jmp    800b5d <vsnprintf+0x45>
+
+00800b66 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b66:	55                   	push   %ebp
+  800b67:	89 e5                	mov    %esp,%ebp
+  800b69:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800b6c:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800b6f:	50                   	push   %eax
+  800b70:	ff 75 10             	push   0x10(%ebp)
+  800b73:	ff 75 0c             	push   0xc(%ebp)
+  800b76:	ff 75 08             	push   0x8(%ebp)
+  800b79:	e8 9a ff ff ff       	call   800b18 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800b7e:	c9                   	leave
+  800b7f:	c3                   	ret
+
+00800b80 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b8b:	eb 03                	jmp    800b90 <strlen+0x10>
+    n++;
+  800b8d:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800b90:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b94:	75 f7                	jne    800b8d <strlen+0xd>
+  return n;
+}
+  800b96:	5d                   	pop    %ebp
+  800b97:	c3                   	ret
+
+00800b98 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b98:	55                   	push   %ebp
+  800b99:	89 e5                	mov    %esp,%ebp
+  800b9b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b9e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba6:	eb 03                	jmp    800bab <strnlen+0x13>
+    n++;
+  800ba8:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bab:	39 d0                	cmp    %edx,%eax
+  800bad:	74 08                	je     800bb7 <strnlen+0x1f>
+  800baf:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bb3:	75 f3                	jne    800ba8 <strnlen+0x10>
+  800bb5:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800bb7:	89 d0                	mov    %edx,%eax
+  800bb9:	5d                   	pop    %ebp
+  800bba:	c3                   	ret
+
+00800bbb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bbb:	55                   	push   %ebp
+  800bbc:	89 e5                	mov    %esp,%ebp
+  800bbe:	53                   	push   %ebx
+  800bbf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bc2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bca:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bce:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bd1:	83 c0 01             	add    $0x1,%eax
+  800bd4:	84 d2                	test   %dl,%dl
+  800bd6:	75 f2                	jne    800bca <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800bd8:	89 c8                	mov    %ecx,%eax
+  800bda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bdd:	c9                   	leave
+  800bde:	c3                   	ret
+
+00800bdf <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800bdf:	55                   	push   %ebp
+  800be0:	89 e5                	mov    %esp,%ebp
+  800be2:	53                   	push   %ebx
+  800be3:	83 ec 10             	sub    $0x10,%esp
+  800be6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800be9:	53                   	push   %ebx
+  800bea:	e8 91 ff ff ff       	call   800b80 <strlen>
+  800bef:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800bf2:	ff 75 0c             	push   0xc(%ebp)
+  800bf5:	01 d8                	add    %ebx,%eax
+  800bf7:	50                   	push   %eax
+  800bf8:	e8 be ff ff ff       	call   800bbb <strcpy>
+  return dst;
+}
+  800bfd:	89 d8                	mov    %ebx,%eax
+  800bff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c02:	c9                   	leave
+  800c03:	c3                   	ret
+
+00800c04 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800c04:	55                   	push   %ebp
+  800c05:	89 e5                	mov    %esp,%ebp
+  800c07:	56                   	push   %esi
+  800c08:	53                   	push   %ebx
+  800c09:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800c0f:	89 f3                	mov    %esi,%ebx
+  800c11:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c14:	89 f0                	mov    %esi,%eax
+  800c16:	eb 0f                	jmp    800c27 <strncpy+0x23>
+    *dst++ = *src;
+  800c18:	83 c0 01             	add    $0x1,%eax
+  800c1b:	0f b6 0a             	movzbl (%edx),%ecx
+  800c1e:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800c21:	80 f9 01             	cmp    $0x1,%cl
+  800c24:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800c27:	39 d8                	cmp    %ebx,%eax
+  800c29:	75 ed                	jne    800c18 <strncpy+0x14>
+  }
+  return ret;
+}
+  800c2b:	89 f0                	mov    %esi,%eax
+  800c2d:	5b                   	pop    %ebx
+  800c2e:	5e                   	pop    %esi
+  800c2f:	5d                   	pop    %ebp
+  800c30:	c3                   	ret
+
+00800c31 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c31:	55                   	push   %ebp
+  800c32:	89 e5                	mov    %esp,%ebp
+  800c34:	56                   	push   %esi
+  800c35:	53                   	push   %ebx
+  800c36:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3c:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800c3f:	89 f0                	mov    %esi,%eax
+  800c41:	85 d2                	test   %edx,%edx
+  800c43:	74 21                	je     800c66 <strlcpy+0x35>
+  800c45:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c49:	89 f2                	mov    %esi,%edx
+  800c4b:	eb 09                	jmp    800c56 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800c4d:	83 c1 01             	add    $0x1,%ecx
+  800c50:	83 c2 01             	add    $0x1,%edx
+  800c53:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800c56:	39 c2                	cmp    %eax,%edx
+  800c58:	74 09                	je     800c63 <strlcpy+0x32>
+  800c5a:	0f b6 19             	movzbl (%ecx),%ebx
+  800c5d:	84 db                	test   %bl,%bl
+  800c5f:	75 ec                	jne    800c4d <strlcpy+0x1c>
+  800c61:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800c63:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800c66:	29 f0                	sub    %esi,%eax
+}
+  800c68:	5b                   	pop    %ebx
+  800c69:	5e                   	pop    %esi
+  800c6a:	5d                   	pop    %ebp
+  800c6b:	c3                   	ret
+
+00800c6c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c6c:	55                   	push   %ebp
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c72:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800c75:	eb 06                	jmp    800c7d <strcmp+0x11>
+    p++, q++;
+  800c77:	83 c1 01             	add    $0x1,%ecx
+  800c7a:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800c7d:	0f b6 01             	movzbl (%ecx),%eax
+  800c80:	84 c0                	test   %al,%al
+  800c82:	74 04                	je     800c88 <strcmp+0x1c>
+  800c84:	3a 02                	cmp    (%edx),%al
+  800c86:	74 ef                	je     800c77 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800c88:	0f b6 c0             	movzbl %al,%eax
+  800c8b:	0f b6 12             	movzbl (%edx),%edx
+  800c8e:	29 d0                	sub    %edx,%eax
+}
+  800c90:	5d                   	pop    %ebp
+  800c91:	c3                   	ret
+
+00800c92 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c92:	55                   	push   %ebp
+  800c93:	89 e5                	mov    %esp,%ebp
+  800c95:	53                   	push   %ebx
+  800c96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9c:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800c9f:	eb 09                	jmp    800caa <strncmp+0x18>
+    n--, p++, q++;
+  800ca1:	83 ea 01             	sub    $0x1,%edx
+  800ca4:	83 c0 01             	add    $0x1,%eax
+  800ca7:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800caa:	85 d2                	test   %edx,%edx
+  800cac:	74 18                	je     800cc6 <strncmp+0x34>
+  800cae:	0f b6 18             	movzbl (%eax),%ebx
+  800cb1:	84 db                	test   %bl,%bl
+  800cb3:	74 04                	je     800cb9 <strncmp+0x27>
+  800cb5:	3a 19                	cmp    (%ecx),%bl
+  800cb7:	74 e8                	je     800ca1 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cb9:	0f b6 00             	movzbl (%eax),%eax
+  800cbc:	0f b6 11             	movzbl (%ecx),%edx
+  800cbf:	29 d0                	sub    %edx,%eax
+}
+  800cc1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cc4:	c9                   	leave
+  800cc5:	c3                   	ret
+    return 0;
+  800cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccb:	eb f4                	jmp    800cc1 <strncmp+0x2f>
+
+00800ccd <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cd3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800cd7:	eb 03                	jmp    800cdc <strchr+0xf>
+  800cd9:	83 c0 01             	add    $0x1,%eax
+  800cdc:	0f b6 10             	movzbl (%eax),%edx
+  800cdf:	84 d2                	test   %dl,%dl
+  800ce1:	74 06                	je     800ce9 <strchr+0x1c>
+    if (*s == c)
+  800ce3:	38 ca                	cmp    %cl,%dl
+  800ce5:	75 f2                	jne    800cd9 <strchr+0xc>
+  800ce7:	eb 05                	jmp    800cee <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cee:	5d                   	pop    %ebp
+  800cef:	c3                   	ret
+
+00800cf0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800cfa:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800cfd:	38 ca                	cmp    %cl,%dl
+  800cff:	74 09                	je     800d0a <strfind+0x1a>
+  800d01:	84 d2                	test   %dl,%dl
+  800d03:	74 05                	je     800d0a <strfind+0x1a>
+  for (; *s; s++)
+  800d05:	83 c0 01             	add    $0x1,%eax
+  800d08:	eb f0                	jmp    800cfa <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800d0a:	5d                   	pop    %ebp
+  800d0b:	c3                   	ret
+
+00800d0c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d0c:	55                   	push   %ebp
+  800d0d:	89 e5                	mov    %esp,%ebp
+  800d0f:	57                   	push   %edi
+  800d10:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d13:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800d16:	85 c9                	test   %ecx,%ecx
+  800d18:	74 20                	je     800d3a <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800d1a:	89 f8                	mov    %edi,%eax
+  800d1c:	09 c8                	or     %ecx,%eax
+  800d1e:	a8 03                	test   $0x3,%al
+  800d20:	75 12                	jne    800d34 <memset+0x28>
+    c &= 0xFF;
+  800d22:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d26:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800d2c:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800d2f:	fc                   	cld
+  800d30:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d32:	eb 06                	jmp    800d3a <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800d34:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d37:	fc                   	cld
+  800d38:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800d3a:	89 f8                	mov    %edi,%eax
+  800d3c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d3f:	c9                   	leave
+  800d40:	c3                   	ret
+
+00800d41 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d41:	55                   	push   %ebp
+  800d42:	89 e5                	mov    %esp,%ebp
+  800d44:	57                   	push   %edi
+  800d45:	56                   	push   %esi
+  800d46:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d49:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d4c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800d4f:	39 c6                	cmp    %eax,%esi
+  800d51:	73 32                	jae    800d85 <memmove+0x44>
+  800d53:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d56:	39 d0                	cmp    %edx,%eax
+  800d58:	73 2b                	jae    800d85 <memmove+0x44>
+    s += n;
+    d += n;
+  800d5a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d5d:	89 d6                	mov    %edx,%esi
+  800d5f:	09 fe                	or     %edi,%esi
+  800d61:	09 ce                	or     %ecx,%esi
+  800d63:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d69:	75 0e                	jne    800d79 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d6b:	83 ef 04             	sub    $0x4,%edi
+  800d6e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d71:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800d74:	fd                   	std
+  800d75:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d77:	eb 09                	jmp    800d82 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d79:	83 ef 01             	sub    $0x1,%edi
+  800d7c:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800d7f:	fd                   	std
+  800d80:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800d82:	fc                   	cld
+  800d83:	eb 1a                	jmp    800d9f <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d85:	89 f2                	mov    %esi,%edx
+  800d87:	09 c2                	or     %eax,%edx
+  800d89:	09 ca                	or     %ecx,%edx
+  800d8b:	f6 c2 03             	test   $0x3,%dl
+  800d8e:	75 0a                	jne    800d9a <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d90:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800d93:	89 c7                	mov    %eax,%edi
+  800d95:	fc                   	cld
+  800d96:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d98:	eb 05                	jmp    800d9f <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800d9a:	89 c7                	mov    %eax,%edi
+  800d9c:	fc                   	cld
+  800d9d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800d9f:	5e                   	pop    %esi
+  800da0:	5f                   	pop    %edi
+  800da1:	5d                   	pop    %ebp
+  800da2:	c3                   	ret
+
+00800da3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800da3:	55                   	push   %ebp
+  800da4:	89 e5                	mov    %esp,%ebp
+  800da6:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800da9:	ff 75 10             	push   0x10(%ebp)
+  800dac:	ff 75 0c             	push   0xc(%ebp)
+  800daf:	ff 75 08             	push   0x8(%ebp)
+  800db2:	e8 8a ff ff ff       	call   800d41 <memmove>
+}
+  800db7:	c9                   	leave
+  800db8:	c3                   	ret
+
+00800db9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800db9:	55                   	push   %ebp
+  800dba:	89 e5                	mov    %esp,%ebp
+  800dbc:	56                   	push   %esi
+  800dbd:	53                   	push   %ebx
+  800dbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800dc4:	89 c6                	mov    %eax,%esi
+  800dc6:	03 75 10             	add    0x10(%ebp),%esi
+  800dc9:	eb 06                	jmp    800dd1 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800dcb:	83 c0 01             	add    $0x1,%eax
+  800dce:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800dd1:	39 f0                	cmp    %esi,%eax
+  800dd3:	74 14                	je     800de9 <memcmp+0x30>
+    if (*s1 != *s2)
+  800dd5:	0f b6 08             	movzbl (%eax),%ecx
+  800dd8:	0f b6 1a             	movzbl (%edx),%ebx
+  800ddb:	38 d9                	cmp    %bl,%cl
+  800ddd:	74 ec                	je     800dcb <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800ddf:	0f b6 c1             	movzbl %cl,%eax
+  800de2:	0f b6 db             	movzbl %bl,%ebx
+  800de5:	29 d8                	sub    %ebx,%eax
+  800de7:	eb 05                	jmp    800dee <memcmp+0x35>
+  }
+
+  return 0;
+  800de9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dee:	5b                   	pop    %ebx
+  800def:	5e                   	pop    %esi
+  800df0:	5d                   	pop    %ebp
+  800df1:	c3                   	ret
+
+00800df2 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800df8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800dfb:	89 c2                	mov    %eax,%edx
+  800dfd:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800e00:	eb 03                	jmp    800e05 <memfind+0x13>
+  800e02:	83 c0 01             	add    $0x1,%eax
+  800e05:	39 d0                	cmp    %edx,%eax
+  800e07:	73 04                	jae    800e0d <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800e09:	38 08                	cmp    %cl,(%eax)
+  800e0b:	75 f5                	jne    800e02 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	c3                   	ret
+
+00800e0f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e0f:	55                   	push   %ebp
+  800e10:	89 e5                	mov    %esp,%ebp
+  800e12:	57                   	push   %edi
+  800e13:	56                   	push   %esi
+  800e14:	53                   	push   %ebx
+  800e15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800e1b:	eb 03                	jmp    800e20 <strtol+0x11>
+    s++;
+  800e1d:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800e20:	0f b6 02             	movzbl (%edx),%eax
+  800e23:	3c 20                	cmp    $0x20,%al
+  800e25:	74 f6                	je     800e1d <strtol+0xe>
+  800e27:	3c 09                	cmp    $0x9,%al
+  800e29:	74 f2                	je     800e1d <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800e2b:	3c 2b                	cmp    $0x2b,%al
+  800e2d:	74 2a                	je     800e59 <strtol+0x4a>
+  int neg = 0;
+  800e2f:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800e34:	3c 2d                	cmp    $0x2d,%al
+  800e36:	74 2b                	je     800e63 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e38:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e3e:	75 0f                	jne    800e4f <strtol+0x40>
+  800e40:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e43:	74 28                	je     800e6d <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800e45:	85 db                	test   %ebx,%ebx
+  800e47:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e4c:	0f 44 d8             	cmove  %eax,%ebx
+  800e4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e54:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e57:	eb 46                	jmp    800e9f <strtol+0x90>
+    s++;
+  800e59:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800e5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e61:	eb d5                	jmp    800e38 <strtol+0x29>
+    s++, neg = 1;
+  800e63:	83 c2 01             	add    $0x1,%edx
+  800e66:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e6b:	eb cb                	jmp    800e38 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e6d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e71:	74 0e                	je     800e81 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800e73:	85 db                	test   %ebx,%ebx
+  800e75:	75 d8                	jne    800e4f <strtol+0x40>
+    s++, base = 8;
+  800e77:	83 c2 01             	add    $0x1,%edx
+  800e7a:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e7f:	eb ce                	jmp    800e4f <strtol+0x40>
+    s += 2, base = 16;
+  800e81:	83 c2 02             	add    $0x2,%edx
+  800e84:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e89:	eb c4                	jmp    800e4f <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800e8b:	0f be c0             	movsbl %al,%eax
+  800e8e:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800e91:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e94:	7d 3a                	jge    800ed0 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800e96:	83 c2 01             	add    $0x1,%edx
+  800e99:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e9d:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800e9f:	0f b6 02             	movzbl (%edx),%eax
+  800ea2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ea5:	89 f3                	mov    %esi,%ebx
+  800ea7:	80 fb 09             	cmp    $0x9,%bl
+  800eaa:	76 df                	jbe    800e8b <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800eac:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800eaf:	89 f3                	mov    %esi,%ebx
+  800eb1:	80 fb 19             	cmp    $0x19,%bl
+  800eb4:	77 08                	ja     800ebe <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800eb6:	0f be c0             	movsbl %al,%eax
+  800eb9:	83 e8 57             	sub    $0x57,%eax
+  800ebc:	eb d3                	jmp    800e91 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800ebe:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ec1:	89 f3                	mov    %esi,%ebx
+  800ec3:	80 fb 19             	cmp    $0x19,%bl
+  800ec6:	77 08                	ja     800ed0 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800ec8:	0f be c0             	movsbl %al,%eax
+  800ecb:	83 e8 37             	sub    $0x37,%eax
+  800ece:	eb c1                	jmp    800e91 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800ed0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ed4:	74 05                	je     800edb <strtol+0xcc>
+    *endptr = (char*)s;
+  800ed6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ed9:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800edb:	89 c8                	mov    %ecx,%eax
+  800edd:	f7 d8                	neg    %eax
+  800edf:	85 ff                	test   %edi,%edi
+  800ee1:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ee4:	89 c8                	mov    %ecx,%eax
+  800ee6:	5b                   	pop    %ebx
+  800ee7:	5e                   	pop    %esi
+  800ee8:	5f                   	pop    %edi
+  800ee9:	5d                   	pop    %ebp
+  800eea:	c3                   	ret
+
+00800eeb <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	57                   	push   %edi
+  800eef:	56                   	push   %esi
+  800ef0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ef1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efc:	89 c3                	mov    %eax,%ebx
+  800efe:	89 c7                	mov    %eax,%edi
+  800f00:	89 c6                	mov    %eax,%esi
+  800f02:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f04:	5b                   	pop    %ebx
+  800f05:	5e                   	pop    %esi
+  800f06:	5f                   	pop    %edi
+  800f07:	5d                   	pop    %ebp
+  800f08:	c3                   	ret
+
+00800f09 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	57                   	push   %edi
+  800f0d:	56                   	push   %esi
+  800f0e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f14:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f19:	89 d1                	mov    %edx,%ecx
+  800f1b:	89 d3                	mov    %edx,%ebx
+  800f1d:	89 d7                	mov    %edx,%edi
+  800f1f:	89 d6                	mov    %edx,%esi
+  800f21:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f23:	5b                   	pop    %ebx
+  800f24:	5e                   	pop    %esi
+  800f25:	5f                   	pop    %edi
+  800f26:	5d                   	pop    %ebp
+  800f27:	c3                   	ret
+
+00800f28 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f28:	55                   	push   %ebp
+  800f29:	89 e5                	mov    %esp,%ebp
+  800f2b:	57                   	push   %edi
+  800f2c:	56                   	push   %esi
+  800f2d:	53                   	push   %ebx
+  800f2e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f39:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f3e:	89 cb                	mov    %ecx,%ebx
+  800f40:	89 cf                	mov    %ecx,%edi
+  800f42:	89 ce                	mov    %ecx,%esi
+  800f44:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f46:	85 c0                	test   %eax,%eax
+  800f48:	7f 08                	jg     800f52 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4d:	5b                   	pop    %ebx
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f52:	83 ec 0c             	sub    $0xc,%esp
+  800f55:	50                   	push   %eax
+  800f56:	6a 03                	push   $0x3
+  800f58:	68 63 48 80 00       	push   $0x804863
+  800f5d:	6a 23                	push   $0x23
+  800f5f:	68 80 48 80 00       	push   $0x804880
+  800f64:	e8 89 f5 ff ff       	call   8004f2 <_panic>
+
+00800f69 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	57                   	push   %edi
+  800f6d:	56                   	push   %esi
+  800f6e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f74:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f79:	89 d1                	mov    %edx,%ecx
+  800f7b:	89 d3                	mov    %edx,%ebx
+  800f7d:	89 d7                	mov    %edx,%edi
+  800f7f:	89 d6                	mov    %edx,%esi
+  800f81:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f83:	5b                   	pop    %ebx
+  800f84:	5e                   	pop    %esi
+  800f85:	5f                   	pop    %edi
+  800f86:	5d                   	pop    %ebp
+  800f87:	c3                   	ret
+
+00800f88 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f88:	55                   	push   %ebp
+  800f89:	89 e5                	mov    %esp,%ebp
+  800f8b:	57                   	push   %edi
+  800f8c:	56                   	push   %esi
+  800f8d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f93:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f98:	89 d1                	mov    %edx,%ecx
+  800f9a:	89 d3                	mov    %edx,%ebx
+  800f9c:	89 d7                	mov    %edx,%edi
+  800f9e:	89 d6                	mov    %edx,%esi
+  800fa0:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fa2:	5b                   	pop    %ebx
+  800fa3:	5e                   	pop    %esi
+  800fa4:	5f                   	pop    %edi
+  800fa5:	5d                   	pop    %ebp
+  800fa6:	c3                   	ret
+
+00800fa7 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800fa7:	55                   	push   %ebp
+  800fa8:	89 e5                	mov    %esp,%ebp
+  800faa:	57                   	push   %edi
+  800fab:	56                   	push   %esi
+  800fac:	53                   	push   %ebx
+  800fad:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800fb0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800fb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbc:	b8 14 00 00 00       	mov    $0x14,%eax
+  800fc1:	89 df                	mov    %ebx,%edi
+  800fc3:	89 de                	mov    %ebx,%esi
+  800fc5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fc7:	85 c0                	test   %eax,%eax
+  800fc9:	7f 08                	jg     800fd3 <sys_env_set_cow+0x2c>
+}
+  800fcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fce:	5b                   	pop    %ebx
+  800fcf:	5e                   	pop    %esi
+  800fd0:	5f                   	pop    %edi
+  800fd1:	5d                   	pop    %ebp
+  800fd2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fd3:	83 ec 0c             	sub    $0xc,%esp
+  800fd6:	50                   	push   %eax
+  800fd7:	6a 14                	push   $0x14
+  800fd9:	68 63 48 80 00       	push   $0x804863
+  800fde:	6a 23                	push   $0x23
+  800fe0:	68 80 48 80 00       	push   $0x804880
+  800fe5:	e8 08 f5 ff ff       	call   8004f2 <_panic>
+
+00800fea <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800fea:	55                   	push   %ebp
+  800feb:	89 e5                	mov    %esp,%ebp
+  800fed:	57                   	push   %edi
+  800fee:	56                   	push   %esi
+  800fef:	53                   	push   %ebx
+  800ff0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ff3:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffe:	b8 04 00 00 00       	mov    $0x4,%eax
+  801003:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801006:	89 f7                	mov    %esi,%edi
+  801008:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80100a:	85 c0                	test   %eax,%eax
+  80100c:	7f 08                	jg     801016 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  80100e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801011:	5b                   	pop    %ebx
+  801012:	5e                   	pop    %esi
+  801013:	5f                   	pop    %edi
+  801014:	5d                   	pop    %ebp
+  801015:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801016:	83 ec 0c             	sub    $0xc,%esp
+  801019:	50                   	push   %eax
+  80101a:	6a 04                	push   $0x4
+  80101c:	68 63 48 80 00       	push   $0x804863
+  801021:	6a 23                	push   $0x23
+  801023:	68 80 48 80 00       	push   $0x804880
+  801028:	e8 c5 f4 ff ff       	call   8004f2 <_panic>
+
+0080102d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80102d:	55                   	push   %ebp
+  80102e:	89 e5                	mov    %esp,%ebp
+  801030:	57                   	push   %edi
+  801031:	56                   	push   %esi
+  801032:	53                   	push   %ebx
+  801033:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+  801039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801041:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801044:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801047:	8b 75 18             	mov    0x18(%ebp),%esi
+  80104a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80104c:	85 c0                	test   %eax,%eax
+  80104e:	7f 08                	jg     801058 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  801050:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801053:	5b                   	pop    %ebx
+  801054:	5e                   	pop    %esi
+  801055:	5f                   	pop    %edi
+  801056:	5d                   	pop    %ebp
+  801057:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801058:	83 ec 0c             	sub    $0xc,%esp
+  80105b:	50                   	push   %eax
+  80105c:	6a 05                	push   $0x5
+  80105e:	68 63 48 80 00       	push   $0x804863
+  801063:	6a 23                	push   $0x23
+  801065:	68 80 48 80 00       	push   $0x804880
+  80106a:	e8 83 f4 ff ff       	call   8004f2 <_panic>
+
+0080106f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	57                   	push   %edi
+  801073:	56                   	push   %esi
+  801074:	53                   	push   %ebx
+  801075:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801078:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801080:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801083:	b8 06 00 00 00       	mov    $0x6,%eax
+  801088:	89 df                	mov    %ebx,%edi
+  80108a:	89 de                	mov    %ebx,%esi
+  80108c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80108e:	85 c0                	test   %eax,%eax
+  801090:	7f 08                	jg     80109a <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  801092:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801095:	5b                   	pop    %ebx
+  801096:	5e                   	pop    %esi
+  801097:	5f                   	pop    %edi
+  801098:	5d                   	pop    %ebp
+  801099:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80109a:	83 ec 0c             	sub    $0xc,%esp
+  80109d:	50                   	push   %eax
+  80109e:	6a 06                	push   $0x6
+  8010a0:	68 63 48 80 00       	push   $0x804863
+  8010a5:	6a 23                	push   $0x23
+  8010a7:	68 80 48 80 00       	push   $0x804880
+  8010ac:	e8 41 f4 ff ff       	call   8004f2 <_panic>
+
+008010b1 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	57                   	push   %edi
+  8010b5:	56                   	push   %esi
+  8010b6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bd:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010c2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010c5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010c8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010cb:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  8010cd:	5b                   	pop    %ebx
+  8010ce:	5e                   	pop    %esi
+  8010cf:	5f                   	pop    %edi
+  8010d0:	5d                   	pop    %ebp
+  8010d1:	c3                   	ret
+
+008010d2 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  8010d2:	55                   	push   %ebp
+  8010d3:	89 e5                	mov    %esp,%ebp
+  8010d5:	57                   	push   %edi
+  8010d6:	56                   	push   %esi
+  8010d7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010de:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010eb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ee:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8010f0:	5b                   	pop    %ebx
+  8010f1:	5e                   	pop    %esi
+  8010f2:	5f                   	pop    %edi
+  8010f3:	5d                   	pop    %ebp
+  8010f4:	c3                   	ret
+
+008010f5 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8010f5:	55                   	push   %ebp
+  8010f6:	89 e5                	mov    %esp,%ebp
+  8010f8:	57                   	push   %edi
+  8010f9:	56                   	push   %esi
+  8010fa:	53                   	push   %ebx
+  8010fb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801103:	8b 55 08             	mov    0x8(%ebp),%edx
+  801106:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801109:	b8 16 00 00 00       	mov    $0x16,%eax
+  80110e:	89 df                	mov    %ebx,%edi
+  801110:	89 de                	mov    %ebx,%esi
+  801112:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801114:	85 c0                	test   %eax,%eax
+  801116:	7f 08                	jg     801120 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  801118:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111b:	5b                   	pop    %ebx
+  80111c:	5e                   	pop    %esi
+  80111d:	5f                   	pop    %edi
+  80111e:	5d                   	pop    %ebp
+  80111f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801120:	83 ec 0c             	sub    $0xc,%esp
+  801123:	50                   	push   %eax
+  801124:	6a 16                	push   $0x16
+  801126:	68 63 48 80 00       	push   $0x804863
+  80112b:	6a 23                	push   $0x23
+  80112d:	68 80 48 80 00       	push   $0x804880
+  801132:	e8 bb f3 ff ff       	call   8004f2 <_panic>
+
+00801137 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  801137:	55                   	push   %ebp
+  801138:	89 e5                	mov    %esp,%ebp
+  80113a:	57                   	push   %edi
+  80113b:	56                   	push   %esi
+  80113c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80113d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801142:	8b 55 08             	mov    0x8(%ebp),%edx
+  801145:	b8 17 00 00 00       	mov    $0x17,%eax
+  80114a:	89 cb                	mov    %ecx,%ebx
+  80114c:	89 cf                	mov    %ecx,%edi
+  80114e:	89 ce                	mov    %ecx,%esi
+  801150:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  801152:	5b                   	pop    %ebx
+  801153:	5e                   	pop    %esi
+  801154:	5f                   	pop    %edi
+  801155:	5d                   	pop    %ebp
+  801156:	c3                   	ret
+
+00801157 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  801157:	55                   	push   %ebp
+  801158:	89 e5                	mov    %esp,%ebp
+  80115a:	57                   	push   %edi
+  80115b:	56                   	push   %esi
+  80115c:	53                   	push   %ebx
+  80115d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801160:	be 00 00 00 00       	mov    $0x0,%esi
+  801165:	8b 55 08             	mov    0x8(%ebp),%edx
+  801168:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116b:	b8 18 00 00 00       	mov    $0x18,%eax
+  801170:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801173:	89 f7                	mov    %esi,%edi
+  801175:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801177:	85 c0                	test   %eax,%eax
+  801179:	7f 08                	jg     801183 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  80117b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117e:	5b                   	pop    %ebx
+  80117f:	5e                   	pop    %esi
+  801180:	5f                   	pop    %edi
+  801181:	5d                   	pop    %ebp
+  801182:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801183:	83 ec 0c             	sub    $0xc,%esp
+  801186:	50                   	push   %eax
+  801187:	6a 18                	push   $0x18
+  801189:	68 63 48 80 00       	push   $0x804863
+  80118e:	6a 23                	push   $0x23
+  801190:	68 80 48 80 00       	push   $0x804880
+  801195:	e8 58 f3 ff ff       	call   8004f2 <_panic>
+
+0080119a <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	57                   	push   %edi
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ab:	b8 19 00 00 00       	mov    $0x19,%eax
+  8011b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b3:	89 f7                	mov    %esi,%edi
+  8011b5:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  8011b7:	5b                   	pop    %ebx
+  8011b8:	5e                   	pop    %esi
+  8011b9:	5f                   	pop    %edi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+
+008011bc <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011cc:	89 d1                	mov    %edx,%ecx
+  8011ce:	89 d3                	mov    %edx,%ebx
+  8011d0:	89 d7                	mov    %edx,%edi
+  8011d2:	89 d6                	mov    %edx,%esi
+  8011d4:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8011d6:	5b                   	pop    %ebx
+  8011d7:	5e                   	pop    %esi
+  8011d8:	5f                   	pop    %edi
+  8011d9:	5d                   	pop    %ebp
+  8011da:	c3                   	ret
+
+008011db <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	57                   	push   %edi
+  8011df:	56                   	push   %esi
+  8011e0:	53                   	push   %ebx
+  8011e1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8011e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ef:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011f4:	89 df                	mov    %ebx,%edi
+  8011f6:	89 de                	mov    %ebx,%esi
+  8011f8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011fa:	85 c0                	test   %eax,%eax
+  8011fc:	7f 08                	jg     801206 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8011fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801201:	5b                   	pop    %ebx
+  801202:	5e                   	pop    %esi
+  801203:	5f                   	pop    %edi
+  801204:	5d                   	pop    %ebp
+  801205:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801206:	83 ec 0c             	sub    $0xc,%esp
+  801209:	50                   	push   %eax
+  80120a:	6a 08                	push   $0x8
+  80120c:	68 63 48 80 00       	push   $0x804863
+  801211:	6a 23                	push   $0x23
+  801213:	68 80 48 80 00       	push   $0x804880
+  801218:	e8 d5 f2 ff ff       	call   8004f2 <_panic>
+
+0080121d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	57                   	push   %edi
+  801221:	56                   	push   %esi
+  801222:	53                   	push   %ebx
+  801223:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801226:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801231:	b8 09 00 00 00       	mov    $0x9,%eax
+  801236:	89 df                	mov    %ebx,%edi
+  801238:	89 de                	mov    %ebx,%esi
+  80123a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80123c:	85 c0                	test   %eax,%eax
+  80123e:	7f 08                	jg     801248 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801240:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801243:	5b                   	pop    %ebx
+  801244:	5e                   	pop    %esi
+  801245:	5f                   	pop    %edi
+  801246:	5d                   	pop    %ebp
+  801247:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801248:	83 ec 0c             	sub    $0xc,%esp
+  80124b:	50                   	push   %eax
+  80124c:	6a 09                	push   $0x9
+  80124e:	68 63 48 80 00       	push   $0x804863
+  801253:	6a 23                	push   $0x23
+  801255:	68 80 48 80 00       	push   $0x804880
+  80125a:	e8 93 f2 ff ff       	call   8004f2 <_panic>
+
+0080125f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80125f:	55                   	push   %ebp
+  801260:	89 e5                	mov    %esp,%ebp
+  801262:	57                   	push   %edi
+  801263:	56                   	push   %esi
+  801264:	53                   	push   %ebx
+  801265:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801268:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801270:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801273:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801278:	89 df                	mov    %ebx,%edi
+  80127a:	89 de                	mov    %ebx,%esi
+  80127c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80127e:	85 c0                	test   %eax,%eax
+  801280:	7f 08                	jg     80128a <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  801282:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801285:	5b                   	pop    %ebx
+  801286:	5e                   	pop    %esi
+  801287:	5f                   	pop    %edi
+  801288:	5d                   	pop    %ebp
+  801289:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80128a:	83 ec 0c             	sub    $0xc,%esp
+  80128d:	50                   	push   %eax
+  80128e:	6a 0a                	push   $0xa
+  801290:	68 63 48 80 00       	push   $0x804863
+  801295:	6a 23                	push   $0x23
+  801297:	68 80 48 80 00       	push   $0x804880
+  80129c:	e8 51 f2 ff ff       	call   8004f2 <_panic>
+
+008012a1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8012a1:	55                   	push   %ebp
+  8012a2:	89 e5                	mov    %esp,%ebp
+  8012a4:	57                   	push   %edi
+  8012a5:	56                   	push   %esi
+  8012a6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8012a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ad:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012b5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012b8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012bb:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  8012bd:	5b                   	pop    %ebx
+  8012be:	5e                   	pop    %esi
+  8012bf:	5f                   	pop    %edi
+  8012c0:	5d                   	pop    %ebp
+  8012c1:	c3                   	ret
+
+008012c2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  8012c2:	55                   	push   %ebp
+  8012c3:	89 e5                	mov    %esp,%ebp
+  8012c5:	57                   	push   %edi
+  8012c6:	56                   	push   %esi
+  8012c7:	53                   	push   %ebx
+  8012c8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8012cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012db:	89 df                	mov    %ebx,%edi
+  8012dd:	89 de                	mov    %ebx,%esi
+  8012df:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8012e1:	85 c0                	test   %eax,%eax
+  8012e3:	7f 08                	jg     8012ed <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8012e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e8:	5b                   	pop    %ebx
+  8012e9:	5e                   	pop    %esi
+  8012ea:	5f                   	pop    %edi
+  8012eb:	5d                   	pop    %ebp
+  8012ec:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8012ed:	83 ec 0c             	sub    $0xc,%esp
+  8012f0:	50                   	push   %eax
+  8012f1:	6a 0d                	push   $0xd
+  8012f3:	68 63 48 80 00       	push   $0x804863
+  8012f8:	6a 23                	push   $0x23
+  8012fa:	68 80 48 80 00       	push   $0x804880
+  8012ff:	e8 ee f1 ff ff       	call   8004f2 <_panic>
+
+00801304 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  801304:	55                   	push   %ebp
+  801305:	89 e5                	mov    %esp,%ebp
+  801307:	57                   	push   %edi
+  801308:	56                   	push   %esi
+  801309:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80130a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80130f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801314:	89 d1                	mov    %edx,%ecx
+  801316:	89 d3                	mov    %edx,%ebx
+  801318:	89 d7                	mov    %edx,%edi
+  80131a:	89 d6                	mov    %edx,%esi
+  80131c:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80131e:	5b                   	pop    %ebx
+  80131f:	5e                   	pop    %esi
+  801320:	5f                   	pop    %edi
+  801321:	5d                   	pop    %ebp
+  801322:	c3                   	ret
+
+00801323 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801323:	55                   	push   %ebp
+  801324:	89 e5                	mov    %esp,%ebp
+  801326:	57                   	push   %edi
+  801327:	56                   	push   %esi
+  801328:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801329:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80132f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801334:	be 00 00 00 00       	mov    $0x0,%esi
+  801339:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80133c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80133f:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801341:	5b                   	pop    %ebx
+  801342:	5e                   	pop    %esi
+  801343:	5f                   	pop    %edi
+  801344:	5d                   	pop    %ebp
+  801345:	c3                   	ret
+
+00801346 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801346:	55                   	push   %ebp
+  801347:	89 e5                	mov    %esp,%ebp
+  801349:	57                   	push   %edi
+  80134a:	56                   	push   %esi
+  80134b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80134c:	be 00 00 00 00       	mov    $0x0,%esi
+  801351:	8b 55 08             	mov    0x8(%ebp),%edx
+  801354:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801357:	b8 10 00 00 00       	mov    $0x10,%eax
+  80135c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80135f:	89 f7                	mov    %esi,%edi
+  801361:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801363:	5b                   	pop    %ebx
+  801364:	5e                   	pop    %esi
+  801365:	5f                   	pop    %edi
+  801366:	5d                   	pop    %ebp
+  801367:	c3                   	ret
+
+00801368 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801368:	55                   	push   %ebp
+  801369:	89 e5                	mov    %esp,%ebp
+  80136b:	57                   	push   %edi
+  80136c:	56                   	push   %esi
+  80136d:	53                   	push   %ebx
+  80136e:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801371:	80 3d c4 6f 80 00 00 	cmpb   $0x0,0x806fc4
+  801378:	74 41                	je     8013bb <sys_batch+0x53>
+  80137a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80137d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  801380:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801387:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80138a:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80138d:	7d 45                	jge    8013d4 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80138f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801392:	8b 06                	mov    (%esi),%eax
+  801394:	8b 56 04             	mov    0x4(%esi),%edx
+  801397:	8b 4e 08             	mov    0x8(%esi),%ecx
+  80139a:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  80139d:	8b 7e 10             	mov    0x10(%esi),%edi
+  8013a0:	8b 76 14             	mov    0x14(%esi),%esi
+  8013a3:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8013a5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013a8:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8013ab:	83 c6 1c             	add    $0x1c,%esi
+  8013ae:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8013b1:	85 c0                	test   %eax,%eax
+  8013b3:	78 1f                	js     8013d4 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8013b5:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8013b9:	eb cc                	jmp    801387 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8013bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c0:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cb:	89 df                	mov    %ebx,%edi
+  8013cd:	89 de                	mov    %ebx,%esi
+  8013cf:	cd 30                	int    $0x30
+  8013d1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8013d4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8013d7:	83 c4 08             	add    $0x8,%esp
+  8013da:	5b                   	pop    %ebx
+  8013db:	5e                   	pop    %esi
+  8013dc:	5f                   	pop    %edi
+  8013dd:	5d                   	pop    %ebp
+  8013de:	c3                   	ret
+
+008013df <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8013df:	55                   	push   %ebp
+  8013e0:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8013e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013e5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8013eb:	5d                   	pop    %ebp
+  8013ec:	c3                   	ret
+
+008013ed <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8013ed:	55                   	push   %ebp
+  8013ee:	89 e5                	mov    %esp,%ebp
+  8013f0:	56                   	push   %esi
+  8013f1:	53                   	push   %ebx
+  8013f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8013f5:	8b 1e                	mov    (%esi),%ebx
+  8013f7:	85 db                	test   %ebx,%ebx
+  8013f9:	75 09                	jne    801404 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8013fb:	89 d8                	mov    %ebx,%eax
+  8013fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801400:	5b                   	pop    %ebx
+  801401:	5e                   	pop    %esi
+  801402:	5d                   	pop    %ebp
+  801403:	c3                   	ret
+  b->sb_n = 0;
+  801404:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  80140a:	53                   	push   %ebx
+  80140b:	8d 46 04             	lea    0x4(%esi),%eax
+  80140e:	50                   	push   %eax
+  80140f:	e8 54 ff ff ff       	call   801368 <sys_batch>
+  801414:	83 c4 08             	add    $0x8,%esp
+  801417:	85 c0                	test   %eax,%eax
+  801419:	78 1e                	js     801439 <sysbatch_flush+0x4c>
+  if (r < n)
+  80141b:	39 c3                	cmp    %eax,%ebx
+  80141d:	7f 07                	jg     801426 <sysbatch_flush+0x39>
+  return 0;
+  80141f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801424:	eb d5                	jmp    8013fb <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801426:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801429:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  80142d:	85 db                	test   %ebx,%ebx
+  80142f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801434:	0f 49 d8             	cmovns %eax,%ebx
+  801437:	eb c2                	jmp    8013fb <sysbatch_flush+0xe>
+    return r;
+  801439:	89 c3                	mov    %eax,%ebx
+  80143b:	eb be                	jmp    8013fb <sysbatch_flush+0xe>
+
+0080143d <sysbatch_add>:
+{
+  80143d:	55                   	push   %ebp
+  80143e:	89 e5                	mov    %esp,%ebp
+  801440:	53                   	push   %ebx
+  801441:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801444:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801447:	74 41                	je     80148a <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801449:	8b 03                	mov    (%ebx),%eax
+  80144b:	8d 50 01             	lea    0x1(%eax),%edx
+  80144e:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801450:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801453:	01 d8                	add    %ebx,%eax
+  801455:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801458:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80145b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80145e:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801461:	8b 55 14             	mov    0x14(%ebp),%edx
+  801464:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801467:	8b 55 18             	mov    0x18(%ebp),%edx
+  80146a:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  80146d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801470:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801473:	8b 55 20             	mov    0x20(%ebp),%edx
+  801476:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801479:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801480:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801488:	c9                   	leave
+  801489:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80148a:	53                   	push   %ebx
+  80148b:	e8 5d ff ff ff       	call   8013ed <sysbatch_flush>
+  801490:	83 c4 04             	add    $0x4,%esp
+  801493:	85 c0                	test   %eax,%eax
+  801495:	79 b2                	jns    801449 <sysbatch_add+0xc>
+  801497:	eb ec                	jmp    801485 <sysbatch_add+0x48>
+
+00801499 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801499:	55                   	push   %ebp
+  80149a:	89 e5                	mov    %esp,%ebp
+  80149c:	56                   	push   %esi
+  80149d:	53                   	push   %ebx
+  80149e:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  8014a1:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  8014a3:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  8014a6:	83 ec 0c             	sub    $0xc,%esp
+  8014a9:	50                   	push   %eax
+  8014aa:	e8 ac 25 00 00       	call   803a5b <mmap_fault>
+  8014af:	83 c4 10             	add    $0x10,%esp
+  8014b2:	84 c0                	test   %al,%al
+  8014b4:	75 7d                	jne    801533 <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  8014b6:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8014bc:	74 7c                	je     80153a <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  8014be:	89 d8                	mov    %ebx,%eax
+  8014c0:	c1 e8 0c             	shr    $0xc,%eax
+  8014c3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014ca:	f6 c4 08             	test   $0x8,%ah
+  8014cd:	74 7d                	je     80154c <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8014cf:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8014d5:	83 ec 04             	sub    $0x4,%esp
+  8014d8:	6a 07                	push   $0x7
+  8014da:	68 00 f0 7f 00       	push   $0x7ff000
+  8014df:	6a 00                	push   $0x0
+  8014e1:	e8 04 fb ff ff       	call   800fea <sys_page_alloc>
+  8014e6:	83 c4 10             	add    $0x10,%esp
+  8014e9:	85 c0                	test   %eax,%eax
+  8014eb:	78 73                	js     801560 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  8014ed:	83 ec 04             	sub    $0x4,%esp
+  8014f0:	68 00 10 00 00       	push   $0x1000
+  8014f5:	53                   	push   %ebx
+  8014f6:	68 00 f0 7f 00       	push   $0x7ff000
+  8014fb:	e8 41 f8 ff ff       	call   800d41 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801500:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801507:	53                   	push   %ebx
+  801508:	6a 00                	push   $0x0
+  80150a:	68 00 f0 7f 00       	push   $0x7ff000
+  80150f:	6a 00                	push   $0x0
+  801511:	e8 17 fb ff ff       	call   80102d <sys_page_map>
+  801516:	83 c4 20             	add    $0x20,%esp
+  801519:	85 c0                	test   %eax,%eax
+  80151b:	78 55                	js     801572 <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  80151d:	83 ec 08             	sub    $0x8,%esp
+  801520:	68 00 f0 7f 00       	push   $0x7ff000
+  801525:	6a 00                	push   $0x0
+  801527:	e8 43 fb ff ff       	call   80106f <sys_page_unmap>
+  80152c:	83 c4 10             	add    $0x10,%esp
+  80152f:	85 c0                	test   %eax,%eax
+  801531:	78 51                	js     801584 <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801533:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801536:	5b                   	pop    %ebx
+  801537:	5e                   	pop    %esi
+  801538:	5d                   	pop    %ebp
+  801539:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  80153a:	56                   	push   %esi
+  80153b:	68 8e 48 80 00       	push   $0x80488e
+  801540:	6a 1d                	push   $0x1d
+  801542:	68 9f 48 80 00       	push   $0x80489f
+  801547:	e8 a6 ef ff ff       	call   8004f2 <_panic>
+    panic("user_pgfault: page not COW");
+  80154c:	83 ec 04             	sub    $0x4,%esp
+  80154f:	68 aa 48 80 00       	push   $0x8048aa
+  801554:	6a 21                	push   $0x21
+  801556:	68 9f 48 80 00       	push   $0x80489f
+  80155b:	e8 92 ef ff ff       	call   8004f2 <_panic>
+    panic("sys_page_alloc: %e", r);
+  801560:	50                   	push   %eax
+  801561:	68 c5 48 80 00       	push   $0x8048c5
+  801566:	6a 2f                	push   $0x2f
+  801568:	68 9f 48 80 00       	push   $0x80489f
+  80156d:	e8 80 ef ff ff       	call   8004f2 <_panic>
+    panic("sys_page_map: %e", r);
+  801572:	50                   	push   %eax
+  801573:	68 d8 48 80 00       	push   $0x8048d8
+  801578:	6a 37                	push   $0x37
+  80157a:	68 9f 48 80 00       	push   $0x80489f
+  80157f:	e8 6e ef ff ff       	call   8004f2 <_panic>
+    panic("sys_page_unmap: %e", r);
+  801584:	50                   	push   %eax
+  801585:	68 e9 48 80 00       	push   $0x8048e9
+  80158a:	6a 3b                	push   $0x3b
+  80158c:	68 9f 48 80 00       	push   $0x80489f
+  801591:	e8 5c ef ff ff       	call   8004f2 <_panic>
+
+00801596 <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  801596:	55                   	push   %ebp
+  801597:	89 e5                	mov    %esp,%ebp
+  801599:	53                   	push   %ebx
+  80159a:	83 ec 10             	sub    $0x10,%esp
+  80159d:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  8015a0:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  8015a2:	50                   	push   %eax
+  8015a3:	e8 b3 24 00 00       	call   803a5b <mmap_fault>
+  8015a8:	83 c4 10             	add    $0x10,%esp
+  8015ab:	84 c0                	test   %al,%al
+  8015ad:	74 05                	je     8015b4 <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  8015af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015b2:	c9                   	leave
+  8015b3:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8015b4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8015ba:	83 ec 04             	sub    $0x4,%esp
+  8015bd:	6a 07                	push   $0x7
+  8015bf:	68 00 f0 7f 00       	push   $0x7ff000
+  8015c4:	6a 00                	push   $0x0
+  8015c6:	e8 1f fa ff ff       	call   800fea <sys_page_alloc>
+  8015cb:	83 c4 10             	add    $0x10,%esp
+  8015ce:	85 c0                	test   %eax,%eax
+  8015d0:	78 5b                	js     80162d <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  8015d2:	83 ec 04             	sub    $0x4,%esp
+  8015d5:	68 00 10 00 00       	push   $0x1000
+  8015da:	53                   	push   %ebx
+  8015db:	68 00 f0 7f 00       	push   $0x7ff000
+  8015e0:	e8 5c f7 ff ff       	call   800d41 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8015e5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8015ec:	53                   	push   %ebx
+  8015ed:	6a 00                	push   $0x0
+  8015ef:	68 00 f0 7f 00       	push   $0x7ff000
+  8015f4:	6a 00                	push   $0x0
+  8015f6:	e8 32 fa ff ff       	call   80102d <sys_page_map>
+  8015fb:	83 c4 20             	add    $0x20,%esp
+  8015fe:	85 c0                	test   %eax,%eax
+  801600:	78 40                	js     801642 <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801602:	83 ec 08             	sub    $0x8,%esp
+  801605:	68 00 f0 7f 00       	push   $0x7ff000
+  80160a:	6a 00                	push   $0x0
+  80160c:	e8 5e fa ff ff       	call   80106f <sys_page_unmap>
+  801611:	83 c4 10             	add    $0x10,%esp
+  801614:	85 c0                	test   %eax,%eax
+  801616:	79 97                	jns    8015af <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  801618:	50                   	push   %eax
+  801619:	68 e9 48 80 00       	push   $0x8048e9
+  80161e:	68 b0 00 00 00       	push   $0xb0
+  801623:	68 9f 48 80 00       	push   $0x80489f
+  801628:	e8 c5 ee ff ff       	call   8004f2 <_panic>
+    panic("sys_page_alloc: %e", r);
+  80162d:	50                   	push   %eax
+  80162e:	68 c5 48 80 00       	push   $0x8048c5
+  801633:	68 a4 00 00 00       	push   $0xa4
+  801638:	68 9f 48 80 00       	push   $0x80489f
+  80163d:	e8 b0 ee ff ff       	call   8004f2 <_panic>
+    panic("sys_page_map: %e", r);
+  801642:	50                   	push   %eax
+  801643:	68 d8 48 80 00       	push   $0x8048d8
+  801648:	68 ac 00 00 00       	push   $0xac
+  80164d:	68 9f 48 80 00       	push   $0x80489f
+  801652:	e8 9b ee ff ff       	call   8004f2 <_panic>
+
+00801657 <fork>:
+{
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	53                   	push   %ebx
+  80165b:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  80165e:	e8 06 f9 ff ff       	call   800f69 <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  801663:	83 ec 0c             	sub    $0xc,%esp
+  801666:	68 99 14 80 00       	push   $0x801499
+  80166b:	e8 06 29 00 00       	call   803f76 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  801670:	b8 07 00 00 00       	mov    $0x7,%eax
+  801675:	cd 30                	int    $0x30
+  801677:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  801679:	83 c4 10             	add    $0x10,%esp
+  80167c:	85 c0                	test   %eax,%eax
+  80167e:	78 66                	js     8016e6 <fork+0x8f>
+  } else if (envid == 0) {
+  801680:	74 76                	je     8016f8 <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  801682:	83 ec 0c             	sub    $0xc,%esp
+  801685:	6a 01                	push   $0x1
+  801687:	50                   	push   %eax
+  801688:	68 00 f0 bf ee       	push   $0xeebff000
+  80168d:	6a 00                	push   $0x0
+  80168f:	6a 00                	push   $0x0
+  801691:	e8 1b fa ff ff       	call   8010b1 <sys_page_map_range>
+  801696:	83 c4 20             	add    $0x20,%esp
+  801699:	85 c0                	test   %eax,%eax
+  80169b:	78 77                	js     801714 <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  80169d:	83 ec 04             	sub    $0x4,%esp
+  8016a0:	6a 07                	push   $0x7
+  8016a2:	68 00 f0 bf ee       	push   $0xeebff000
+  8016a7:	53                   	push   %ebx
+  8016a8:	e8 3d f9 ff ff       	call   800fea <sys_page_alloc>
+  8016ad:	83 c4 10             	add    $0x10,%esp
+  8016b0:	85 c0                	test   %eax,%eax
+  8016b2:	78 72                	js     801726 <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  8016b4:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  8016b9:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  8016bc:	83 ec 08             	sub    $0x8,%esp
+  8016bf:	50                   	push   %eax
+  8016c0:	53                   	push   %ebx
+  8016c1:	e8 99 fb ff ff       	call   80125f <sys_env_set_pgfault_upcall>
+  8016c6:	83 c4 10             	add    $0x10,%esp
+  8016c9:	85 c0                	test   %eax,%eax
+  8016cb:	78 6b                	js     801738 <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8016cd:	83 ec 08             	sub    $0x8,%esp
+  8016d0:	6a 02                	push   $0x2
+  8016d2:	53                   	push   %ebx
+  8016d3:	e8 03 fb ff ff       	call   8011db <sys_env_set_status>
+  8016d8:	83 c4 10             	add    $0x10,%esp
+  8016db:	85 c0                	test   %eax,%eax
+  8016dd:	78 6b                	js     80174a <fork+0xf3>
+}
+  8016df:	89 d8                	mov    %ebx,%eax
+  8016e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016e4:	c9                   	leave
+  8016e5:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8016e6:	50                   	push   %eax
+  8016e7:	68 fc 48 80 00       	push   $0x8048fc
+  8016ec:	6a 5e                	push   $0x5e
+  8016ee:	68 9f 48 80 00       	push   $0x80489f
+  8016f3:	e8 fa ed ff ff       	call   8004f2 <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8016f8:	e8 6c f8 ff ff       	call   800f69 <sys_getenvid>
+  8016fd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801702:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801705:	c1 e0 04             	shl    $0x4,%eax
+  801708:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80170d:	a3 c0 6f 80 00       	mov    %eax,0x806fc0
+    return 0;
+  801712:	eb cb                	jmp    8016df <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  801714:	50                   	push   %eax
+  801715:	68 0c 49 80 00       	push   $0x80490c
+  80171a:	6a 69                	push   $0x69
+  80171c:	68 9f 48 80 00       	push   $0x80489f
+  801721:	e8 cc ed ff ff       	call   8004f2 <_panic>
+    panic("sys_page_alloc: %e", error);
+  801726:	50                   	push   %eax
+  801727:	68 c5 48 80 00       	push   $0x8048c5
+  80172c:	6a 70                	push   $0x70
+  80172e:	68 9f 48 80 00       	push   $0x80489f
+  801733:	e8 ba ed ff ff       	call   8004f2 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801738:	50                   	push   %eax
+  801739:	68 3c 49 80 00       	push   $0x80493c
+  80173e:	6a 76                	push   $0x76
+  801740:	68 9f 48 80 00       	push   $0x80489f
+  801745:	e8 a8 ed ff ff       	call   8004f2 <_panic>
+    panic("sys_env_set_status: %e", error);
+  80174a:	50                   	push   %eax
+  80174b:	68 23 49 80 00       	push   $0x804923
+  801750:	6a 7a                	push   $0x7a
+  801752:	68 9f 48 80 00       	push   $0x80489f
+  801757:	e8 96 ed ff ff       	call   8004f2 <_panic>
+
+0080175c <kfork>:
+{
+  80175c:	55                   	push   %ebp
+  80175d:	89 e5                	mov    %esp,%ebp
+  80175f:	53                   	push   %ebx
+  801760:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  801763:	68 99 14 80 00       	push   $0x801499
+  801768:	e8 09 28 00 00       	call   803f76 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  80176d:	e8 4a fa ff ff       	call   8011bc <sys_fork>
+  801772:	89 c3                	mov    %eax,%ebx
+  801774:	83 c4 10             	add    $0x10,%esp
+  801777:	85 c0                	test   %eax,%eax
+  801779:	74 07                	je     801782 <kfork+0x26>
+}
+  80177b:	89 d8                	mov    %ebx,%eax
+  80177d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801780:	c9                   	leave
+  801781:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801782:	e8 e2 f7 ff ff       	call   800f69 <sys_getenvid>
+  801787:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80178c:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80178f:	c1 e0 04             	shl    $0x4,%eax
+  801792:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801797:	a3 c0 6f 80 00       	mov    %eax,0x806fc0
+  return envid;
+  80179c:	eb dd                	jmp    80177b <kfork+0x1f>
+
+0080179e <sfork>:
+
+int
+sfork(void)
+{
+  80179e:	55                   	push   %ebp
+  80179f:	89 e5                	mov    %esp,%ebp
+  8017a1:	53                   	push   %ebx
+  8017a2:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  8017a5:	e8 bf f7 ff ff       	call   800f69 <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  8017aa:	83 ec 0c             	sub    $0xc,%esp
+  8017ad:	68 96 15 80 00       	push   $0x801596
+  8017b2:	e8 bf 27 00 00       	call   803f76 <set_pgfault_handler>
+  8017b7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8017bc:	cd 30                	int    $0x30
+  8017be:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  8017c0:	83 c4 10             	add    $0x10,%esp
+  8017c3:	85 c0                	test   %eax,%eax
+  8017c5:	78 09                	js     8017d0 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  8017c7:	75 1c                	jne    8017e5 <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  8017c9:	89 d8                	mov    %ebx,%eax
+  8017cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017ce:	c9                   	leave
+  8017cf:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8017d0:	50                   	push   %eax
+  8017d1:	68 fc 48 80 00       	push   $0x8048fc
+  8017d6:	68 c3 00 00 00       	push   $0xc3
+  8017db:	68 9f 48 80 00       	push   $0x80489f
+  8017e0:	e8 0d ed ff ff       	call   8004f2 <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  8017e5:	83 ec 0c             	sub    $0xc,%esp
+  8017e8:	6a 00                	push   $0x0
+  8017ea:	50                   	push   %eax
+  8017eb:	68 00 d0 bf ee       	push   $0xeebfd000
+  8017f0:	6a 00                	push   $0x0
+  8017f2:	6a 00                	push   $0x0
+  8017f4:	e8 b8 f8 ff ff       	call   8010b1 <sys_page_map_range>
+  8017f9:	83 c4 20             	add    $0x20,%esp
+  8017fc:	85 c0                	test   %eax,%eax
+  8017fe:	78 79                	js     801879 <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  801800:	83 ec 0c             	sub    $0xc,%esp
+  801803:	6a 01                	push   $0x1
+  801805:	53                   	push   %ebx
+  801806:	68 00 10 00 00       	push   $0x1000
+  80180b:	68 00 d0 bf ee       	push   $0xeebfd000
+  801810:	6a 00                	push   $0x0
+  801812:	e8 9a f8 ff ff       	call   8010b1 <sys_page_map_range>
+  801817:	83 c4 20             	add    $0x20,%esp
+  80181a:	85 c0                	test   %eax,%eax
+  80181c:	78 70                	js     80188e <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  80181e:	83 ec 04             	sub    $0x4,%esp
+  801821:	6a 07                	push   $0x7
+  801823:	68 00 f0 bf ee       	push   $0xeebff000
+  801828:	53                   	push   %ebx
+  801829:	e8 bc f7 ff ff       	call   800fea <sys_page_alloc>
+  80182e:	83 c4 10             	add    $0x10,%esp
+  801831:	85 c0                	test   %eax,%eax
+  801833:	78 6e                	js     8018a3 <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  801835:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  80183a:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  80183d:	83 ec 08             	sub    $0x8,%esp
+  801840:	50                   	push   %eax
+  801841:	53                   	push   %ebx
+  801842:	e8 18 fa ff ff       	call   80125f <sys_env_set_pgfault_upcall>
+  801847:	83 c4 10             	add    $0x10,%esp
+  80184a:	85 c0                	test   %eax,%eax
+  80184c:	78 6a                	js     8018b8 <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80184e:	83 ec 08             	sub    $0x8,%esp
+  801851:	6a 02                	push   $0x2
+  801853:	53                   	push   %ebx
+  801854:	e8 82 f9 ff ff       	call   8011db <sys_env_set_status>
+  801859:	83 c4 10             	add    $0x10,%esp
+  80185c:	85 c0                	test   %eax,%eax
+  80185e:	0f 89 65 ff ff ff    	jns    8017c9 <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  801864:	50                   	push   %eax
+  801865:	68 23 49 80 00       	push   $0x804923
+  80186a:	68 e4 00 00 00       	push   $0xe4
+  80186f:	68 9f 48 80 00       	push   $0x80489f
+  801874:	e8 79 ec ff ff       	call   8004f2 <_panic>
+    panic("sys_page_map_range: %e", error);
+  801879:	50                   	push   %eax
+  80187a:	68 0c 49 80 00       	push   $0x80490c
+  80187f:	68 ce 00 00 00       	push   $0xce
+  801884:	68 9f 48 80 00       	push   $0x80489f
+  801889:	e8 64 ec ff ff       	call   8004f2 <_panic>
+    panic("sys_page_map_range: %e", error);
+  80188e:	50                   	push   %eax
+  80188f:	68 0c 49 80 00       	push   $0x80490c
+  801894:	68 d3 00 00 00       	push   $0xd3
+  801899:	68 9f 48 80 00       	push   $0x80489f
+  80189e:	e8 4f ec ff ff       	call   8004f2 <_panic>
+    panic("sys_page_alloc: %e", error);
+  8018a3:	50                   	push   %eax
+  8018a4:	68 c5 48 80 00       	push   $0x8048c5
+  8018a9:	68 da 00 00 00       	push   $0xda
+  8018ae:	68 9f 48 80 00       	push   $0x80489f
+  8018b3:	e8 3a ec ff ff       	call   8004f2 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  8018b8:	50                   	push   %eax
+  8018b9:	68 3c 49 80 00       	push   $0x80493c
+  8018be:	68 e0 00 00 00       	push   $0xe0
+  8018c3:	68 9f 48 80 00       	push   $0x80489f
+  8018c8:	e8 25 ec ff ff       	call   8004f2 <_panic>
+
+008018cd <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8018cd:	55                   	push   %ebp
+  8018ce:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8018d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8018d8:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8018db:	5d                   	pop    %ebp
+  8018dc:	c3                   	ret
+
+008018dd <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8018dd:	55                   	push   %ebp
+  8018de:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8018e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e3:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8018e6:	66 b8 00 00          	mov    $0x0,%ax
+  8018ea:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8018ef:	5d                   	pop    %ebp
+  8018f0:	c3                   	ret
+
+008018f1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8018f1:	55                   	push   %ebp
+  8018f2:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8018f4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8018f9:	eb 02                	jmp    8018fd <fd_alloc+0xc>
+  8018fb:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8018fd:	89 c2                	mov    %eax,%edx
+  8018ff:	c1 ea 16             	shr    $0x16,%edx
+  801902:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801909:	f6 c2 01             	test   $0x1,%dl
+  80190c:	74 2b                	je     801939 <fd_alloc+0x48>
+  80190e:	89 c2                	mov    %eax,%edx
+  801910:	c1 ea 0c             	shr    $0xc,%edx
+  801913:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80191a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801920:	f6 c1 01             	test   $0x1,%cl
+  801923:	74 14                	je     801939 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801925:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80192b:	75 ce                	jne    8018fb <fd_alloc+0xa>
+  80192d:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801932:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801937:	eb 05                	jmp    80193e <fd_alloc+0x4d>
+      return 0;
+  801939:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  80193e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801941:	89 02                	mov    %eax,(%edx)
+}
+  801943:	89 c8                	mov    %ecx,%eax
+  801945:	5d                   	pop    %ebp
+  801946:	c3                   	ret
+
+00801947 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801947:	55                   	push   %ebp
+  801948:	89 e5                	mov    %esp,%ebp
+  80194a:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80194d:	83 f8 1f             	cmp    $0x1f,%eax
+  801950:	77 30                	ja     801982 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801952:	c1 e0 0c             	shl    $0xc,%eax
+  801955:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80195a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801960:	f6 c2 01             	test   $0x1,%dl
+  801963:	74 24                	je     801989 <fd_lookup+0x42>
+  801965:	89 c2                	mov    %eax,%edx
+  801967:	c1 ea 0c             	shr    $0xc,%edx
+  80196a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801971:	f6 c2 01             	test   $0x1,%dl
+  801974:	74 1a                	je     801990 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801976:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801979:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80197b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801980:	5d                   	pop    %ebp
+  801981:	c3                   	ret
+    return -E_INVAL;
+  801982:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801987:	eb f7                	jmp    801980 <fd_lookup+0x39>
+    return -E_INVAL;
+  801989:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80198e:	eb f0                	jmp    801980 <fd_lookup+0x39>
+  801990:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801995:	eb e9                	jmp    801980 <fd_lookup+0x39>
+
+00801997 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801997:	55                   	push   %ebp
+  801998:	89 e5                	mov    %esp,%ebp
+  80199a:	53                   	push   %ebx
+  80199b:	83 ec 04             	sub    $0x4,%esp
+  80199e:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8019a1:	b8 d8 49 80 00       	mov    $0x8049d8,%eax
+  8019a6:	8b 18                	mov    (%eax),%ebx
+  8019a8:	85 db                	test   %ebx,%ebx
+  8019aa:	74 0e                	je     8019ba <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8019ac:	83 c0 04             	add    $0x4,%eax
+  8019af:	39 13                	cmp    %edx,(%ebx)
+  8019b1:	75 f3                	jne    8019a6 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8019b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b8:	eb 1f                	jmp    8019d9 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019ba:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  8019bf:	8b 40 48             	mov    0x48(%eax),%eax
+  8019c2:	83 ec 04             	sub    $0x4,%esp
+  8019c5:	52                   	push   %edx
+  8019c6:	50                   	push   %eax
+  8019c7:	68 5c 49 80 00       	push   $0x80495c
+  8019cc:	e8 fc eb ff ff       	call   8005cd <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8019d1:	83 c4 10             	add    $0x10,%esp
+  8019d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8019d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019dc:	89 1a                	mov    %ebx,(%edx)
+}
+  8019de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019e1:	c9                   	leave
+  8019e2:	c3                   	ret
+
+008019e3 <fd_close>:
+{
+  8019e3:	55                   	push   %ebp
+  8019e4:	89 e5                	mov    %esp,%ebp
+  8019e6:	57                   	push   %edi
+  8019e7:	56                   	push   %esi
+  8019e8:	53                   	push   %ebx
+  8019e9:	83 ec 24             	sub    $0x24,%esp
+  8019ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8019ef:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019f2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019f5:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8019f6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019fc:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019ff:	50                   	push   %eax
+  801a00:	e8 42 ff ff ff       	call   801947 <fd_lookup>
+  801a05:	89 c3                	mov    %eax,%ebx
+  801a07:	83 c4 10             	add    $0x10,%esp
+  801a0a:	85 c0                	test   %eax,%eax
+  801a0c:	78 05                	js     801a13 <fd_close+0x30>
+      || fd != fd2)
+  801a0e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a11:	74 16                	je     801a29 <fd_close+0x46>
+    return must_exist ? r : 0;
+  801a13:	89 f8                	mov    %edi,%eax
+  801a15:	84 c0                	test   %al,%al
+  801a17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a1f:	89 d8                	mov    %ebx,%eax
+  801a21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a24:	5b                   	pop    %ebx
+  801a25:	5e                   	pop    %esi
+  801a26:	5f                   	pop    %edi
+  801a27:	5d                   	pop    %ebp
+  801a28:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a29:	83 ec 08             	sub    $0x8,%esp
+  801a2c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a2f:	50                   	push   %eax
+  801a30:	ff 36                	push   (%esi)
+  801a32:	e8 60 ff ff ff       	call   801997 <dev_lookup>
+  801a37:	89 c3                	mov    %eax,%ebx
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	85 c0                	test   %eax,%eax
+  801a3e:	78 1a                	js     801a5a <fd_close+0x77>
+    if (dev->dev_close)
+  801a40:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a43:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801a46:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801a4b:	85 c0                	test   %eax,%eax
+  801a4d:	74 0b                	je     801a5a <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801a4f:	83 ec 0c             	sub    $0xc,%esp
+  801a52:	56                   	push   %esi
+  801a53:	ff d0                	call   *%eax
+  801a55:	89 c3                	mov    %eax,%ebx
+  801a57:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801a5a:	83 ec 08             	sub    $0x8,%esp
+  801a5d:	56                   	push   %esi
+  801a5e:	6a 00                	push   $0x0
+  801a60:	e8 0a f6 ff ff       	call   80106f <sys_page_unmap>
+  return r;
+  801a65:	83 c4 10             	add    $0x10,%esp
+  801a68:	eb b5                	jmp    801a1f <fd_close+0x3c>
+
+00801a6a <close>:
+
+int
+close(int fdnum)
+{
+  801a6a:	55                   	push   %ebp
+  801a6b:	89 e5                	mov    %esp,%ebp
+  801a6d:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a73:	50                   	push   %eax
+  801a74:	ff 75 08             	push   0x8(%ebp)
+  801a77:	e8 cb fe ff ff       	call   801947 <fd_lookup>
+  801a7c:	83 c4 10             	add    $0x10,%esp
+  801a7f:	85 c0                	test   %eax,%eax
+  801a81:	79 02                	jns    801a85 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801a83:	c9                   	leave
+  801a84:	c3                   	ret
+    return fd_close(fd, 1);
+  801a85:	83 ec 08             	sub    $0x8,%esp
+  801a88:	6a 01                	push   $0x1
+  801a8a:	ff 75 f4             	push   -0xc(%ebp)
+  801a8d:	e8 51 ff ff ff       	call   8019e3 <fd_close>
+  801a92:	83 c4 10             	add    $0x10,%esp
+  801a95:	eb ec                	jmp    801a83 <close+0x19>
+
+00801a97 <close_all>:
+
+void
+close_all(void)
+{
+  801a97:	55                   	push   %ebp
+  801a98:	89 e5                	mov    %esp,%ebp
+  801a9a:	53                   	push   %ebx
+  801a9b:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801a9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801aa3:	83 ec 0c             	sub    $0xc,%esp
+  801aa6:	53                   	push   %ebx
+  801aa7:	e8 be ff ff ff       	call   801a6a <close>
+  for (i = 0; i < MAXFD; i++)
+  801aac:	83 c3 01             	add    $0x1,%ebx
+  801aaf:	83 c4 10             	add    $0x10,%esp
+  801ab2:	83 fb 20             	cmp    $0x20,%ebx
+  801ab5:	75 ec                	jne    801aa3 <close_all+0xc>
+}
+  801ab7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aba:	c9                   	leave
+  801abb:	c3                   	ret
+
+00801abc <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801abc:	55                   	push   %ebp
+  801abd:	89 e5                	mov    %esp,%ebp
+  801abf:	57                   	push   %edi
+  801ac0:	56                   	push   %esi
+  801ac1:	53                   	push   %ebx
+  801ac2:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801ac5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ac8:	50                   	push   %eax
+  801ac9:	ff 75 08             	push   0x8(%ebp)
+  801acc:	e8 76 fe ff ff       	call   801947 <fd_lookup>
+  801ad1:	89 c6                	mov    %eax,%esi
+  801ad3:	83 c4 10             	add    $0x10,%esp
+  801ad6:	85 c0                	test   %eax,%eax
+  801ad8:	0f 88 0a 01 00 00    	js     801be8 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801ade:	83 ec 0c             	sub    $0xc,%esp
+  801ae1:	ff 75 0c             	push   0xc(%ebp)
+  801ae4:	e8 81 ff ff ff       	call   801a6a <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801ae9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aec:	c1 e0 0c             	shl    $0xc,%eax
+  801aef:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801af5:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801af8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801afb:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801afe:	89 04 24             	mov    %eax,(%esp)
+  801b01:	e8 d7 fd ff ff       	call   8018dd <fd2data>
+  801b06:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801b08:	89 3c 24             	mov    %edi,(%esp)
+  801b0b:	e8 cd fd ff ff       	call   8018dd <fd2data>
+  801b10:	83 c4 10             	add    $0x10,%esp
+  801b13:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801b16:	89 f3                	mov    %esi,%ebx
+  801b18:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801b1e:	89 c6                	mov    %eax,%esi
+  801b20:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801b23:	89 cf                	mov    %ecx,%edi
+  801b25:	eb 0c                	jmp    801b33 <dup+0x77>
+  801b27:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b2d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801b33:	39 fb                	cmp    %edi,%ebx
+  801b35:	74 7b                	je     801bb2 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801b37:	89 d8                	mov    %ebx,%eax
+  801b39:	c1 e8 16             	shr    $0x16,%eax
+  801b3c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b43:	a8 01                	test   $0x1,%al
+  801b45:	74 e0                	je     801b27 <dup+0x6b>
+  801b47:	89 d8                	mov    %ebx,%eax
+  801b49:	c1 e8 0c             	shr    $0xc,%eax
+  801b4c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b53:	f6 c2 01             	test   $0x1,%dl
+  801b56:	74 cf                	je     801b27 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801b58:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801b5f:	83 ec 0c             	sub    $0xc,%esp
+  801b62:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b67:	50                   	push   %eax
+  801b68:	56                   	push   %esi
+  801b69:	6a 00                	push   $0x0
+  801b6b:	53                   	push   %ebx
+  801b6c:	6a 00                	push   $0x0
+  801b6e:	e8 ba f4 ff ff       	call   80102d <sys_page_map>
+  801b73:	83 c4 20             	add    $0x20,%esp
+  801b76:	85 c0                	test   %eax,%eax
+  801b78:	79 ad                	jns    801b27 <dup+0x6b>
+  801b7a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801b7d:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801b7f:	83 ec 08             	sub    $0x8,%esp
+  801b82:	ff 75 d4             	push   -0x2c(%ebp)
+  801b85:	6a 00                	push   $0x0
+  801b87:	e8 e3 f4 ff ff       	call   80106f <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801b8c:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801b8f:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801b95:	83 c4 10             	add    $0x10,%esp
+  801b98:	39 df                	cmp    %ebx,%edi
+  801b9a:	74 4c                	je     801be8 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801b9c:	83 ec 08             	sub    $0x8,%esp
+  801b9f:	57                   	push   %edi
+  801ba0:	6a 00                	push   $0x0
+  801ba2:	e8 c8 f4 ff ff       	call   80106f <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801ba7:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801bad:	83 c4 10             	add    $0x10,%esp
+  801bb0:	eb e6                	jmp    801b98 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801bb2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801bb5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801bb8:	89 c8                	mov    %ecx,%eax
+  801bba:	c1 e8 0c             	shr    $0xc,%eax
+  801bbd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bc4:	83 ec 0c             	sub    $0xc,%esp
+  801bc7:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bcc:	50                   	push   %eax
+  801bcd:	ff 75 d4             	push   -0x2c(%ebp)
+  801bd0:	6a 00                	push   $0x0
+  801bd2:	51                   	push   %ecx
+  801bd3:	6a 00                	push   $0x0
+  801bd5:	e8 53 f4 ff ff       	call   80102d <sys_page_map>
+  801bda:	89 c6                	mov    %eax,%esi
+  801bdc:	83 c4 20             	add    $0x20,%esp
+  801bdf:	85 c0                	test   %eax,%eax
+  801be1:	78 9c                	js     801b7f <dup+0xc3>
+  return newfdnum;
+  801be3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801be6:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801be8:	89 f0                	mov    %esi,%eax
+  801bea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bed:	5b                   	pop    %ebx
+  801bee:	5e                   	pop    %esi
+  801bef:	5f                   	pop    %edi
+  801bf0:	5d                   	pop    %ebp
+  801bf1:	c3                   	ret
+
+00801bf2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801bf2:	55                   	push   %ebp
+  801bf3:	89 e5                	mov    %esp,%ebp
+  801bf5:	56                   	push   %esi
+  801bf6:	53                   	push   %ebx
+  801bf7:	83 ec 18             	sub    $0x18,%esp
+  801bfa:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bfd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c00:	50                   	push   %eax
+  801c01:	56                   	push   %esi
+  801c02:	e8 40 fd ff ff       	call   801947 <fd_lookup>
+  801c07:	83 c4 10             	add    $0x10,%esp
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	78 3c                	js     801c4a <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c0e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c11:	83 ec 08             	sub    $0x8,%esp
+  801c14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c17:	50                   	push   %eax
+  801c18:	ff 33                	push   (%ebx)
+  801c1a:	e8 78 fd ff ff       	call   801997 <dev_lookup>
+  801c1f:	83 c4 10             	add    $0x10,%esp
+  801c22:	85 c0                	test   %eax,%eax
+  801c24:	78 24                	js     801c4a <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c26:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c29:	83 e0 03             	and    $0x3,%eax
+  801c2c:	83 f8 01             	cmp    $0x1,%eax
+  801c2f:	74 20                	je     801c51 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801c31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c34:	8b 40 08             	mov    0x8(%eax),%eax
+  801c37:	85 c0                	test   %eax,%eax
+  801c39:	74 37                	je     801c72 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801c3b:	83 ec 04             	sub    $0x4,%esp
+  801c3e:	ff 75 10             	push   0x10(%ebp)
+  801c41:	ff 75 0c             	push   0xc(%ebp)
+  801c44:	53                   	push   %ebx
+  801c45:	ff d0                	call   *%eax
+  801c47:	83 c4 10             	add    $0x10,%esp
+}
+  801c4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c4d:	5b                   	pop    %ebx
+  801c4e:	5e                   	pop    %esi
+  801c4f:	5d                   	pop    %ebp
+  801c50:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c51:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  801c56:	8b 40 48             	mov    0x48(%eax),%eax
+  801c59:	83 ec 04             	sub    $0x4,%esp
+  801c5c:	56                   	push   %esi
+  801c5d:	50                   	push   %eax
+  801c5e:	68 9d 49 80 00       	push   $0x80499d
+  801c63:	e8 65 e9 ff ff       	call   8005cd <cprintf>
+    return -E_INVAL;
+  801c68:	83 c4 10             	add    $0x10,%esp
+  801c6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c70:	eb d8                	jmp    801c4a <read+0x58>
+    return -E_NOT_SUPP;
+  801c72:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c77:	eb d1                	jmp    801c4a <read+0x58>
+
+00801c79 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c79:	55                   	push   %ebp
+  801c7a:	89 e5                	mov    %esp,%ebp
+  801c7c:	57                   	push   %edi
+  801c7d:	56                   	push   %esi
+  801c7e:	53                   	push   %ebx
+  801c7f:	83 ec 0c             	sub    $0xc,%esp
+  801c82:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c85:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801c88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c8d:	eb 02                	jmp    801c91 <readn+0x18>
+  801c8f:	01 c3                	add    %eax,%ebx
+  801c91:	39 f3                	cmp    %esi,%ebx
+  801c93:	73 21                	jae    801cb6 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801c95:	83 ec 04             	sub    $0x4,%esp
+  801c98:	89 f0                	mov    %esi,%eax
+  801c9a:	29 d8                	sub    %ebx,%eax
+  801c9c:	50                   	push   %eax
+  801c9d:	89 d8                	mov    %ebx,%eax
+  801c9f:	03 45 0c             	add    0xc(%ebp),%eax
+  801ca2:	50                   	push   %eax
+  801ca3:	57                   	push   %edi
+  801ca4:	e8 49 ff ff ff       	call   801bf2 <read>
+    if (m < 0)
+  801ca9:	83 c4 10             	add    $0x10,%esp
+  801cac:	85 c0                	test   %eax,%eax
+  801cae:	78 04                	js     801cb4 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801cb0:	75 dd                	jne    801c8f <readn+0x16>
+  801cb2:	eb 02                	jmp    801cb6 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801cb4:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801cb6:	89 d8                	mov    %ebx,%eax
+  801cb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cbb:	5b                   	pop    %ebx
+  801cbc:	5e                   	pop    %esi
+  801cbd:	5f                   	pop    %edi
+  801cbe:	5d                   	pop    %ebp
+  801cbf:	c3                   	ret
+
+00801cc0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801cc0:	55                   	push   %ebp
+  801cc1:	89 e5                	mov    %esp,%ebp
+  801cc3:	56                   	push   %esi
+  801cc4:	53                   	push   %ebx
+  801cc5:	83 ec 18             	sub    $0x18,%esp
+  801cc8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ccb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cce:	50                   	push   %eax
+  801ccf:	53                   	push   %ebx
+  801cd0:	e8 72 fc ff ff       	call   801947 <fd_lookup>
+  801cd5:	83 c4 10             	add    $0x10,%esp
+  801cd8:	85 c0                	test   %eax,%eax
+  801cda:	78 37                	js     801d13 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cdc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cdf:	83 ec 08             	sub    $0x8,%esp
+  801ce2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ce5:	50                   	push   %eax
+  801ce6:	ff 36                	push   (%esi)
+  801ce8:	e8 aa fc ff ff       	call   801997 <dev_lookup>
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	85 c0                	test   %eax,%eax
+  801cf2:	78 1f                	js     801d13 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cf4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cf8:	74 20                	je     801d1a <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801cfa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cfd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d00:	85 c0                	test   %eax,%eax
+  801d02:	74 37                	je     801d3b <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801d04:	83 ec 04             	sub    $0x4,%esp
+  801d07:	ff 75 10             	push   0x10(%ebp)
+  801d0a:	ff 75 0c             	push   0xc(%ebp)
+  801d0d:	56                   	push   %esi
+  801d0e:	ff d0                	call   *%eax
+  801d10:	83 c4 10             	add    $0x10,%esp
+}
+  801d13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d16:	5b                   	pop    %ebx
+  801d17:	5e                   	pop    %esi
+  801d18:	5d                   	pop    %ebp
+  801d19:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d1a:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  801d1f:	8b 40 48             	mov    0x48(%eax),%eax
+  801d22:	83 ec 04             	sub    $0x4,%esp
+  801d25:	53                   	push   %ebx
+  801d26:	50                   	push   %eax
+  801d27:	68 b9 49 80 00       	push   $0x8049b9
+  801d2c:	e8 9c e8 ff ff       	call   8005cd <cprintf>
+    return -E_INVAL;
+  801d31:	83 c4 10             	add    $0x10,%esp
+  801d34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d39:	eb d8                	jmp    801d13 <write+0x53>
+    return -E_NOT_SUPP;
+  801d3b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d40:	eb d1                	jmp    801d13 <write+0x53>
+
+00801d42 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d42:	55                   	push   %ebp
+  801d43:	89 e5                	mov    %esp,%ebp
+  801d45:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d48:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d4b:	50                   	push   %eax
+  801d4c:	ff 75 08             	push   0x8(%ebp)
+  801d4f:	e8 f3 fb ff ff       	call   801947 <fd_lookup>
+  801d54:	83 c4 10             	add    $0x10,%esp
+  801d57:	85 c0                	test   %eax,%eax
+  801d59:	78 0e                	js     801d69 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801d5b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d61:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801d64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d69:	c9                   	leave
+  801d6a:	c3                   	ret
+
+00801d6b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d6b:	55                   	push   %ebp
+  801d6c:	89 e5                	mov    %esp,%ebp
+  801d6e:	56                   	push   %esi
+  801d6f:	53                   	push   %ebx
+  801d70:	83 ec 18             	sub    $0x18,%esp
+  801d73:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d76:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d79:	50                   	push   %eax
+  801d7a:	53                   	push   %ebx
+  801d7b:	e8 c7 fb ff ff       	call   801947 <fd_lookup>
+  801d80:	83 c4 10             	add    $0x10,%esp
+  801d83:	85 c0                	test   %eax,%eax
+  801d85:	78 34                	js     801dbb <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d87:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d8a:	83 ec 08             	sub    $0x8,%esp
+  801d8d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d90:	50                   	push   %eax
+  801d91:	ff 36                	push   (%esi)
+  801d93:	e8 ff fb ff ff       	call   801997 <dev_lookup>
+  801d98:	83 c4 10             	add    $0x10,%esp
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	78 1c                	js     801dbb <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d9f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801da3:	74 1d                	je     801dc2 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801da5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801da8:	8b 40 18             	mov    0x18(%eax),%eax
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	74 34                	je     801de3 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801daf:	83 ec 08             	sub    $0x8,%esp
+  801db2:	ff 75 0c             	push   0xc(%ebp)
+  801db5:	56                   	push   %esi
+  801db6:	ff d0                	call   *%eax
+  801db8:	83 c4 10             	add    $0x10,%esp
+}
+  801dbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dbe:	5b                   	pop    %ebx
+  801dbf:	5e                   	pop    %esi
+  801dc0:	5d                   	pop    %ebp
+  801dc1:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801dc2:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  801dc7:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dca:	83 ec 04             	sub    $0x4,%esp
+  801dcd:	53                   	push   %ebx
+  801dce:	50                   	push   %eax
+  801dcf:	68 7c 49 80 00       	push   $0x80497c
+  801dd4:	e8 f4 e7 ff ff       	call   8005cd <cprintf>
+    return -E_INVAL;
+  801dd9:	83 c4 10             	add    $0x10,%esp
+  801ddc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de1:	eb d8                	jmp    801dbb <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801de3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801de8:	eb d1                	jmp    801dbb <ftruncate+0x50>
+
+00801dea <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801dea:	55                   	push   %ebp
+  801deb:	89 e5                	mov    %esp,%ebp
+  801ded:	56                   	push   %esi
+  801dee:	53                   	push   %ebx
+  801def:	83 ec 18             	sub    $0x18,%esp
+  801df2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801df5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801df8:	50                   	push   %eax
+  801df9:	ff 75 08             	push   0x8(%ebp)
+  801dfc:	e8 46 fb ff ff       	call   801947 <fd_lookup>
+  801e01:	83 c4 10             	add    $0x10,%esp
+  801e04:	85 c0                	test   %eax,%eax
+  801e06:	78 49                	js     801e51 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e08:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e0b:	83 ec 08             	sub    $0x8,%esp
+  801e0e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e11:	50                   	push   %eax
+  801e12:	ff 36                	push   (%esi)
+  801e14:	e8 7e fb ff ff       	call   801997 <dev_lookup>
+  801e19:	83 c4 10             	add    $0x10,%esp
+  801e1c:	85 c0                	test   %eax,%eax
+  801e1e:	78 31                	js     801e51 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801e20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e23:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e27:	74 2f                	je     801e58 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801e29:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801e2c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e33:	00 00 00 
+  stat->st_isdir = 0;
+  801e36:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e3d:	00 00 00 
+  stat->st_dev = dev;
+  801e40:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801e46:	83 ec 08             	sub    $0x8,%esp
+  801e49:	53                   	push   %ebx
+  801e4a:	56                   	push   %esi
+  801e4b:	ff 50 14             	call   *0x14(%eax)
+  801e4e:	83 c4 10             	add    $0x10,%esp
+}
+  801e51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e54:	5b                   	pop    %ebx
+  801e55:	5e                   	pop    %esi
+  801e56:	5d                   	pop    %ebp
+  801e57:	c3                   	ret
+    return -E_NOT_SUPP;
+  801e58:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e5d:	eb f2                	jmp    801e51 <fstat+0x67>
+
+00801e5f <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e5f:	55                   	push   %ebp
+  801e60:	89 e5                	mov    %esp,%ebp
+  801e62:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801e65:	ff 75 0c             	push   0xc(%ebp)
+  801e68:	ff 75 08             	push   0x8(%ebp)
+  801e6b:	e8 58 07 00 00       	call   8025c8 <file_stat>
+}
+  801e70:	c9                   	leave
+  801e71:	c3                   	ret
+
+00801e72 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801e72:	55                   	push   %ebp
+  801e73:	89 e5                	mov    %esp,%ebp
+  801e75:	57                   	push   %edi
+  801e76:	56                   	push   %esi
+  801e77:	53                   	push   %ebx
+  801e78:	83 ec 1c             	sub    $0x1c,%esp
+  801e7b:	89 c7                	mov    %eax,%edi
+  801e7d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801e80:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801e83:	e9 a2 00 00 00       	jmp    801f2a <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801e88:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801e8f:	00 00 00 
+  801e92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e97:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801e9c:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801ea1:	be 01 00 00 00       	mov    $0x1,%esi
+  801ea6:	eb 0f                	jmp    801eb7 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801ea8:	83 c0 01             	add    $0x1,%eax
+  801eab:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801eb0:	74 49                	je     801efb <fsipc_send+0x89>
+  801eb2:	83 f9 07             	cmp    $0x7,%ecx
+  801eb5:	7f 50                	jg     801f07 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801eb7:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801eba:	c1 e2 04             	shl    $0x4,%edx
+  801ebd:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801ec3:	8b 52 50             	mov    0x50(%edx),%edx
+  801ec6:	83 fa 01             	cmp    $0x1,%edx
+  801ec9:	75 dd                	jne    801ea8 <fsipc_send+0x36>
+  801ecb:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801ece:	c1 e2 04             	shl    $0x4,%edx
+  801ed1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801ed7:	8b 52 54             	mov    0x54(%edx),%edx
+  801eda:	85 d2                	test   %edx,%edx
+  801edc:	74 ca                	je     801ea8 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801ede:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801ee1:	c1 e2 04             	shl    $0x4,%edx
+  801ee4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801eea:	8b 52 48             	mov    0x48(%edx),%edx
+  801eed:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801ef4:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801ef7:	89 f3                	mov    %esi,%ebx
+  801ef9:	eb ad                	jmp    801ea8 <fsipc_send+0x36>
+  801efb:	84 db                	test   %bl,%bl
+  801efd:	74 38                	je     801f37 <fsipc_send+0xc5>
+  801eff:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801f05:	eb 30                	jmp    801f37 <fsipc_send+0xc5>
+  801f07:	84 db                	test   %bl,%bl
+  801f09:	74 2c                	je     801f37 <fsipc_send+0xc5>
+  801f0b:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801f11:	eb 24                	jmp    801f37 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801f13:	50                   	push   %eax
+  801f14:	68 e8 49 80 00       	push   $0x8049e8
+  801f19:	6a 34                	push   $0x34
+  801f1b:	68 f2 49 80 00       	push   $0x8049f2
+  801f20:	e8 cd e5 ff ff       	call   8004f2 <_panic>
+    }
+    sys_yield();
+  801f25:	e8 5e f0 ff ff       	call   800f88 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801f2a:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801f31:	0f 8e 51 ff ff ff    	jle    801e88 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801f37:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  801f3c:	8b 70 48             	mov    0x48(%eax),%esi
+  801f3f:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801f45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f4a:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801f50:	39 d9                	cmp    %ebx,%ecx
+  801f52:	7e d1                	jle    801f25 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801f54:	83 ec 0c             	sub    $0xc,%esp
+  801f57:	ff 75 e0             	push   -0x20(%ebp)
+  801f5a:	6a 07                	push   $0x7
+  801f5c:	ff 75 e4             	push   -0x1c(%ebp)
+  801f5f:	57                   	push   %edi
+  801f60:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801f63:	99                   	cltd
+  801f64:	f7 f9                	idiv   %ecx
+  801f66:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801f6d:	e8 2f f3 ff ff       	call   8012a1 <sys_ipc_try_send>
+      if (r == 0)
+  801f72:	83 c4 20             	add    $0x20,%esp
+  801f75:	85 c0                	test   %eax,%eax
+  801f77:	74 0a                	je     801f83 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801f79:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801f7c:	75 95                	jne    801f13 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801f7e:	83 c3 01             	add    $0x1,%ebx
+  801f81:	eb c7                	jmp    801f4a <fsipc_send+0xd8>
+  }
+}
+  801f83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f86:	5b                   	pop    %ebx
+  801f87:	5e                   	pop    %esi
+  801f88:	5f                   	pop    %edi
+  801f89:	5d                   	pop    %ebp
+  801f8a:	c3                   	ret
+
+00801f8b <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801f8b:	55                   	push   %ebp
+  801f8c:	89 e5                	mov    %esp,%ebp
+  801f8e:	53                   	push   %ebx
+  801f8f:	83 ec 14             	sub    $0x14,%esp
+  801f92:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801f94:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801f9b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fa0:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801fa5:	e8 c8 fe ff ff       	call   801e72 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801faa:	6a 00                	push   $0x0
+  801fac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801faf:	50                   	push   %eax
+  801fb0:	53                   	push   %ebx
+  801fb1:	6a 00                	push   $0x0
+  801fb3:	e8 2b 20 00 00       	call   803fe3 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801fb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fbb:	c9                   	leave
+  801fbc:	c3                   	ret
+
+00801fbd <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801fbd:	55                   	push   %ebp
+  801fbe:	89 e5                	mov    %esp,%ebp
+  801fc0:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801fc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fc6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fc9:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801fce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fd1:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801fd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fdb:	b8 02 00 00 00       	mov    $0x2,%eax
+  801fe0:	e8 a6 ff ff ff       	call   801f8b <fsipc>
+}
+  801fe5:	c9                   	leave
+  801fe6:	c3                   	ret
+
+00801fe7 <devfile_flush>:
+{
+  801fe7:	55                   	push   %ebp
+  801fe8:	89 e5                	mov    %esp,%ebp
+  801fea:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801fed:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ff3:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801ff8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ffd:	b8 06 00 00 00       	mov    $0x6,%eax
+  802002:	e8 84 ff ff ff       	call   801f8b <fsipc>
+}
+  802007:	c9                   	leave
+  802008:	c3                   	ret
+
+00802009 <devfile_stat>:
+{
+  802009:	55                   	push   %ebp
+  80200a:	89 e5                	mov    %esp,%ebp
+  80200c:	53                   	push   %ebx
+  80200d:	83 ec 04             	sub    $0x4,%esp
+  802010:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802013:	8b 45 08             	mov    0x8(%ebp),%eax
+  802016:	8b 40 0c             	mov    0xc(%eax),%eax
+  802019:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80201e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802023:	b8 05 00 00 00       	mov    $0x5,%eax
+  802028:	e8 5e ff ff ff       	call   801f8b <fsipc>
+  80202d:	85 c0                	test   %eax,%eax
+  80202f:	78 2c                	js     80205d <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802031:	83 ec 08             	sub    $0x8,%esp
+  802034:	68 00 70 80 00       	push   $0x807000
+  802039:	53                   	push   %ebx
+  80203a:	e8 7c eb ff ff       	call   800bbb <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80203f:	a1 80 70 80 00       	mov    0x807080,%eax
+  802044:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80204a:	a1 84 70 80 00       	mov    0x807084,%eax
+  80204f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  802055:	83 c4 10             	add    $0x10,%esp
+  802058:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80205d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802060:	c9                   	leave
+  802061:	c3                   	ret
+
+00802062 <fsv_alloc>:
+{
+  802062:	55                   	push   %ebp
+  802063:	89 e5                	mov    %esp,%ebp
+  802065:	56                   	push   %esi
+  802066:	53                   	push   %ebx
+  802067:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  802069:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80206e:	eb 22                	jmp    802092 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  802070:	83 ec 04             	sub    $0x4,%esp
+  802073:	6a 00                	push   $0x0
+  802075:	6a 00                	push   $0x0
+  802077:	6a 07                	push   $0x7
+  802079:	50                   	push   %eax
+  80207a:	6a 00                	push   $0x0
+  80207c:	6a 04                	push   $0x4
+  80207e:	68 40 60 80 00       	push   $0x806040
+  802083:	e8 b5 f3 ff ff       	call   80143d <sysbatch_add>
+  802088:	83 c4 20             	add    $0x20,%esp
+  80208b:	85 c0                	test   %eax,%eax
+  80208d:	78 48                	js     8020d7 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  80208f:	83 c3 01             	add    $0x1,%ebx
+  802092:	39 f3                	cmp    %esi,%ebx
+  802094:	74 31                	je     8020c7 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  802096:	89 d8                	mov    %ebx,%eax
+  802098:	c1 e0 0c             	shl    $0xc,%eax
+  80209b:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  8020a0:	89 c2                	mov    %eax,%edx
+  8020a2:	c1 ea 16             	shr    $0x16,%edx
+  8020a5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8020ac:	f6 c2 01             	test   $0x1,%dl
+  8020af:	74 bf                	je     802070 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  8020b1:	89 c2                	mov    %eax,%edx
+  8020b3:	c1 ea 0c             	shr    $0xc,%edx
+  8020b6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8020bd:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  8020c0:	83 fa 03             	cmp    $0x3,%edx
+  8020c3:	75 ab                	jne    802070 <fsv_alloc+0xe>
+  8020c5:	eb c8                	jmp    80208f <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  8020c7:	83 ec 0c             	sub    $0xc,%esp
+  8020ca:	68 40 60 80 00       	push   $0x806040
+  8020cf:	e8 19 f3 ff ff       	call   8013ed <sysbatch_flush>
+  8020d4:	83 c4 10             	add    $0x10,%esp
+}
+  8020d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020da:	5b                   	pop    %ebx
+  8020db:	5e                   	pop    %esi
+  8020dc:	5d                   	pop    %ebp
+  8020dd:	c3                   	ret
+
+008020de <devfile_read>:
+{
+  8020de:	55                   	push   %ebp
+  8020df:	89 e5                	mov    %esp,%ebp
+  8020e1:	57                   	push   %edi
+  8020e2:	56                   	push   %esi
+  8020e3:	53                   	push   %ebx
+  8020e4:	83 ec 3c             	sub    $0x3c,%esp
+  8020e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  8020ea:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  8020f0:	77 57                	ja     802149 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020f8:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  8020fd:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802103:	ba 00 00 00 00       	mov    $0x0,%edx
+  802108:	b8 03 00 00 00       	mov    $0x3,%eax
+  80210d:	e8 79 fe ff ff       	call   801f8b <fsipc>
+  802112:	89 c6                	mov    %eax,%esi
+  802114:	85 c0                	test   %eax,%eax
+  802116:	78 27                	js     80213f <devfile_read+0x61>
+  assert(r <= n);
+  802118:	39 c3                	cmp    %eax,%ebx
+  80211a:	0f 82 0e 02 00 00    	jb     80232e <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  802120:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802125:	0f 8f 1c 02 00 00    	jg     802347 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80212b:	83 ec 04             	sub    $0x4,%esp
+  80212e:	50                   	push   %eax
+  80212f:	68 00 70 80 00       	push   $0x807000
+  802134:	ff 75 0c             	push   0xc(%ebp)
+  802137:	e8 05 ec ff ff       	call   800d41 <memmove>
+  return r;
+  80213c:	83 c4 10             	add    $0x10,%esp
+}
+  80213f:	89 f0                	mov    %esi,%eax
+  802141:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802144:	5b                   	pop    %ebx
+  802145:	5e                   	pop    %esi
+  802146:	5f                   	pop    %edi
+  802147:	5d                   	pop    %ebp
+  802148:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  802149:	b8 01 00 00 00       	mov    $0x1,%eax
+  80214e:	e8 0f ff ff ff       	call   802062 <fsv_alloc>
+  802153:	89 c6                	mov    %eax,%esi
+  802155:	85 c0                	test   %eax,%eax
+  802157:	78 e6                	js     80213f <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  802159:	8b 45 08             	mov    0x8(%ebp),%eax
+  80215c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80215f:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  802164:	8b 45 08             	mov    0x8(%ebp),%eax
+  802167:	8b 40 04             	mov    0x4(%eax),%eax
+  80216a:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  80216f:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  802175:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  80217c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802181:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  802186:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80218b:	e8 e2 fc ff ff       	call   801e72 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802190:	6a 00                	push   $0x0
+  802192:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802195:	50                   	push   %eax
+  802196:	68 00 10 c0 9f       	push   $0x9fc01000
+  80219b:	6a 00                	push   $0x0
+  80219d:	e8 41 1e 00 00       	call   803fe3 <ipc_recv_pages>
+  8021a2:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  8021a4:	83 c4 10             	add    $0x10,%esp
+  8021a7:	85 c0                	test   %eax,%eax
+  8021a9:	7e 94                	jle    80213f <devfile_read+0x61>
+  assert(r <= n);
+  8021ab:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8021ae:	39 c3                	cmp    %eax,%ebx
+  8021b0:	72 2e                	jb     8021e0 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  8021b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b5:	8b 40 04             	mov    0x4(%eax),%eax
+  8021b8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8021bd:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  8021c0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8021c3:	c1 e2 0c             	shl    $0xc,%edx
+  8021c6:	39 ca                	cmp    %ecx,%edx
+  8021c8:	72 2f                	jb     8021f9 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  8021ca:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  8021cf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  8021d2:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  8021d6:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  8021db:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  8021de:	eb 52                	jmp    802232 <devfile_read+0x154>
+  assert(r <= n);
+  8021e0:	68 fd 49 80 00       	push   $0x8049fd
+  8021e5:	68 04 4a 80 00       	push   $0x804a04
+  8021ea:	68 49 01 00 00       	push   $0x149
+  8021ef:	68 f2 49 80 00       	push   $0x8049f2
+  8021f4:	e8 f9 e2 ff ff       	call   8004f2 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  8021f9:	68 28 4a 80 00       	push   $0x804a28
+  8021fe:	68 04 4a 80 00       	push   $0x804a04
+  802203:	68 4a 01 00 00       	push   $0x14a
+  802208:	68 f2 49 80 00       	push   $0x8049f2
+  80220d:	e8 e0 e2 ff ff       	call   8004f2 <_panic>
+      memmove(dst + done, src + done, m);
+  802212:	83 ec 04             	sub    $0x4,%esp
+  802215:	53                   	push   %ebx
+  802216:	56                   	push   %esi
+  802217:	89 f8                	mov    %edi,%eax
+  802219:	03 45 0c             	add    0xc(%ebp),%eax
+  80221c:	50                   	push   %eax
+  80221d:	e8 1f eb ff ff       	call   800d41 <memmove>
+  802222:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  802225:	01 df                	add    %ebx,%edi
+  802227:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80222a:	39 c7                	cmp    %eax,%edi
+  80222c:	0f 83 c0 00 00 00    	jae    8022f2 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  802232:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802235:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  802238:	89 f0                	mov    %esi,%eax
+  80223a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80223f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802244:	29 c3                	sub    %eax,%ebx
+  802246:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802249:	29 f8                	sub    %edi,%eax
+  80224b:	39 c3                	cmp    %eax,%ebx
+  80224d:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  802250:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802256:	75 ba                	jne    802212 <devfile_read+0x134>
+  802258:	89 f9                	mov    %edi,%ecx
+  80225a:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80225d:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  802260:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  802266:	75 aa                	jne    802212 <devfile_read+0x134>
+  802268:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  80226e:	77 a2                	ja     802212 <devfile_read+0x134>
+  802270:	89 c8                	mov    %ecx,%eax
+  802272:	c1 e8 16             	shr    $0x16,%eax
+  802275:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80227c:	a8 01                	test   $0x1,%al
+  80227e:	74 92                	je     802212 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  802280:	89 c8                	mov    %ecx,%eax
+  802282:	c1 e8 0c             	shr    $0xc,%eax
+  802285:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  80228c:	a8 01                	test   $0x1,%al
+  80228e:	74 82                	je     802212 <devfile_read+0x134>
+  802290:	a9 02 08 00 00       	test   $0x802,%eax
+  802295:	0f 84 77 ff ff ff    	je     802212 <devfile_read+0x134>
+  80229b:	f6 c4 04             	test   $0x4,%ah
+  80229e:	0f 85 6e ff ff ff    	jne    802212 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  8022a4:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  8022a9:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  8022ad:	84 c0                	test   %al,%al
+  8022af:	75 17                	jne    8022c8 <devfile_read+0x1ea>
+  8022b1:	83 ec 08             	sub    $0x8,%esp
+  8022b4:	6a 01                	push   $0x1
+  8022b6:	6a 00                	push   $0x0
+  8022b8:	e8 ea ec ff ff       	call   800fa7 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  8022bd:	83 c4 10             	add    $0x10,%esp
+  8022c0:	85 c0                	test   %eax,%eax
+  8022c2:	0f 85 4a ff ff ff    	jne    802212 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  8022c8:	83 ec 04             	sub    $0x4,%esp
+  8022cb:	68 05 08 00 00       	push   $0x805
+  8022d0:	ff 75 cc             	push   -0x34(%ebp)
+  8022d3:	6a 00                	push   $0x0
+  8022d5:	56                   	push   %esi
+  8022d6:	6a 00                	push   $0x0
+  8022d8:	6a 05                	push   $0x5
+  8022da:	68 40 60 80 00       	push   $0x806040
+  8022df:	e8 59 f1 ff ff       	call   80143d <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  8022e4:	c1 e8 1f             	shr    $0x1f,%eax
+  8022e7:	08 45 cb             	or     %al,-0x35(%ebp)
+  8022ea:	83 c4 20             	add    $0x20,%esp
+  8022ed:	e9 33 ff ff ff       	jmp    802225 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  8022f2:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8022f5:	83 ec 0c             	sub    $0xc,%esp
+  8022f8:	68 40 60 80 00       	push   $0x806040
+  8022fd:	e8 eb f0 ff ff       	call   8013ed <sysbatch_flush>
+  802302:	83 c4 10             	add    $0x10,%esp
+  802305:	85 c0                	test   %eax,%eax
+  802307:	78 06                	js     80230f <devfile_read+0x231>
+  802309:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  80230d:	74 14                	je     802323 <devfile_read+0x245>
+    memmove(dst, src, r);
+  80230f:	83 ec 04             	sub    $0x4,%esp
+  802312:	ff 75 d4             	push   -0x2c(%ebp)
+  802315:	ff 75 d0             	push   -0x30(%ebp)
+  802318:	ff 75 0c             	push   0xc(%ebp)
+  80231b:	e8 21 ea ff ff       	call   800d41 <memmove>
+  802320:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  802323:	8b 45 08             	mov    0x8(%ebp),%eax
+  802326:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  802329:	e9 11 fe ff ff       	jmp    80213f <devfile_read+0x61>
+  assert(r <= n);
+  80232e:	68 fd 49 80 00       	push   $0x8049fd
+  802333:	68 04 4a 80 00       	push   $0x804a04
+  802338:	68 1c 01 00 00       	push   $0x11c
+  80233d:	68 f2 49 80 00       	push   $0x8049f2
+  802342:	e8 ab e1 ff ff       	call   8004f2 <_panic>
+  assert(r <= PGSIZE);
+  802347:	68 19 4a 80 00       	push   $0x804a19
+  80234c:	68 04 4a 80 00       	push   $0x804a04
+  802351:	68 1d 01 00 00       	push   $0x11d
+  802356:	68 f2 49 80 00       	push   $0x8049f2
+  80235b:	e8 92 e1 ff ff       	call   8004f2 <_panic>
+
+00802360 <devfile_write>:
+{
+  802360:	55                   	push   %ebp
+  802361:	89 e5                	mov    %esp,%ebp
+  802363:	57                   	push   %edi
+  802364:	56                   	push   %esi
+  802365:	53                   	push   %ebx
+  802366:	83 ec 1c             	sub    $0x1c,%esp
+  802369:	8b 75 08             	mov    0x8(%ebp),%esi
+  80236c:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  80236f:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  802374:	77 39                	ja     8023af <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802376:	8b 56 0c             	mov    0xc(%esi),%edx
+  802379:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  80237f:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  802384:	83 ec 04             	sub    $0x4,%esp
+  802387:	50                   	push   %eax
+  802388:	ff 75 0c             	push   0xc(%ebp)
+  80238b:	68 08 70 80 00       	push   $0x807008
+  802390:	e8 ac e9 ff ff       	call   800d41 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  802395:	ba 00 00 00 00       	mov    $0x0,%edx
+  80239a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80239f:	e8 e7 fb ff ff       	call   801f8b <fsipc>
+  8023a4:	83 c4 10             	add    $0x10,%esp
+}
+  8023a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023aa:	5b                   	pop    %ebx
+  8023ab:	5e                   	pop    %esi
+  8023ac:	5f                   	pop    %edi
+  8023ad:	5d                   	pop    %ebp
+  8023ae:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  8023af:	ba 00 00 10 00       	mov    $0x100000,%edx
+  8023b4:	39 d0                	cmp    %edx,%eax
+  8023b6:	89 d3                	mov    %edx,%ebx
+  8023b8:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8023bb:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  8023c1:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  8023c4:	83 c7 01             	add    $0x1,%edi
+  8023c7:	89 f8                	mov    %edi,%eax
+  8023c9:	e8 94 fc ff ff       	call   802062 <fsv_alloc>
+  8023ce:	85 c0                	test   %eax,%eax
+  8023d0:	78 d5                	js     8023a7 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  8023d2:	83 ec 04             	sub    $0x4,%esp
+  8023d5:	53                   	push   %ebx
+  8023d6:	ff 75 0c             	push   0xc(%ebp)
+  8023d9:	68 00 10 c0 9f       	push   $0x9fc01000
+  8023de:	e8 5e e9 ff ff       	call   800d41 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  8023e3:	8b 46 0c             	mov    0xc(%esi),%eax
+  8023e6:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  8023eb:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  8023f1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8023f8:	89 f9                	mov    %edi,%ecx
+  8023fa:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8023ff:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802404:	e8 69 fa ff ff       	call   801e72 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802409:	6a 00                	push   $0x0
+  80240b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80240e:	50                   	push   %eax
+  80240f:	6a 00                	push   $0x0
+  802411:	6a 00                	push   $0x0
+  802413:	e8 cb 1b 00 00       	call   803fe3 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  802418:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  80241b:	eb 8a                	jmp    8023a7 <devfile_write+0x47>
+
+0080241d <open>:
+{
+  80241d:	55                   	push   %ebp
+  80241e:	89 e5                	mov    %esp,%ebp
+  802420:	56                   	push   %esi
+  802421:	53                   	push   %ebx
+  802422:	83 ec 1c             	sub    $0x1c,%esp
+  802425:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802428:	56                   	push   %esi
+  802429:	e8 52 e7 ff ff       	call   800b80 <strlen>
+  80242e:	83 c4 10             	add    $0x10,%esp
+  802431:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802436:	7f 6c                	jg     8024a4 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802438:	83 ec 0c             	sub    $0xc,%esp
+  80243b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80243e:	50                   	push   %eax
+  80243f:	e8 ad f4 ff ff       	call   8018f1 <fd_alloc>
+  802444:	89 c3                	mov    %eax,%ebx
+  802446:	83 c4 10             	add    $0x10,%esp
+  802449:	85 c0                	test   %eax,%eax
+  80244b:	78 3c                	js     802489 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  80244d:	83 ec 08             	sub    $0x8,%esp
+  802450:	56                   	push   %esi
+  802451:	68 00 70 80 00       	push   $0x807000
+  802456:	e8 60 e7 ff ff       	call   800bbb <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  80245b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80245e:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802463:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802466:	b8 01 00 00 00       	mov    $0x1,%eax
+  80246b:	e8 1b fb ff ff       	call   801f8b <fsipc>
+  802470:	89 c3                	mov    %eax,%ebx
+  802472:	83 c4 10             	add    $0x10,%esp
+  802475:	85 c0                	test   %eax,%eax
+  802477:	78 19                	js     802492 <open+0x75>
+  return fd2num(fd);
+  802479:	83 ec 0c             	sub    $0xc,%esp
+  80247c:	ff 75 f4             	push   -0xc(%ebp)
+  80247f:	e8 49 f4 ff ff       	call   8018cd <fd2num>
+  802484:	89 c3                	mov    %eax,%ebx
+  802486:	83 c4 10             	add    $0x10,%esp
+}
+  802489:	89 d8                	mov    %ebx,%eax
+  80248b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80248e:	5b                   	pop    %ebx
+  80248f:	5e                   	pop    %esi
+  802490:	5d                   	pop    %ebp
+  802491:	c3                   	ret
+    fd_close(fd, 0);
+  802492:	83 ec 08             	sub    $0x8,%esp
+  802495:	6a 00                	push   $0x0
+  802497:	ff 75 f4             	push   -0xc(%ebp)
+  80249a:	e8 44 f5 ff ff       	call   8019e3 <fd_close>
+    return r;
+  80249f:	83 c4 10             	add    $0x10,%esp
+  8024a2:	eb e5                	jmp    802489 <open+0x6c>
+    return -E_BAD_PATH;
+  8024a4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8024a9:	eb de                	jmp    802489 <open+0x6c>
+
+008024ab <open_read>:
+{
+  8024ab:	55                   	push   %ebp
+  8024ac:	89 e5                	mov    %esp,%ebp
+  8024ae:	57                   	push   %edi
+  8024af:	56                   	push   %esi
+  8024b0:	53                   	push   %ebx
+  8024b1:	83 ec 28             	sub    $0x28,%esp
+  8024b4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  8024b7:	57                   	push   %edi
+  8024b8:	e8 c3 e6 ff ff       	call   800b80 <strlen>
+  8024bd:	83 c4 10             	add    $0x10,%esp
+  8024c0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024c5:	0f 87 f6 00 00 00    	ja     8025c1 <open_read+0x116>
+  8024cb:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  8024cd:	83 ec 0c             	sub    $0xc,%esp
+  8024d0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024d3:	50                   	push   %eax
+  8024d4:	e8 18 f4 ff ff       	call   8018f1 <fd_alloc>
+  8024d9:	89 c3                	mov    %eax,%ebx
+  8024db:	83 c4 10             	add    $0x10,%esp
+  8024de:	85 c0                	test   %eax,%eax
+  8024e0:	0f 88 b2 00 00 00    	js     802598 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  8024e6:	83 ec 08             	sub    $0x8,%esp
+  8024e9:	57                   	push   %edi
+  8024ea:	68 e4 70 80 00       	push   $0x8070e4
+  8024ef:	e8 c7 e6 ff ff       	call   800bbb <strcpy>
+  req->req_nops = 2;
+  8024f4:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  8024fb:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  8024fe:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  802505:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  802508:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80250b:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  802510:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  802517:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  80251a:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  802521:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802524:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  80252b:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  80252e:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  802533:	29 f0                	sub    %esi,%eax
+  802535:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802538:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  80253c:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  802541:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  802548:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  80254b:	83 c6 01             	add    $0x1,%esi
+  80254e:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  802554:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802557:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80255c:	e8 2a fa ff ff       	call   801f8b <fsipc>
+  802561:	89 c3                	mov    %eax,%ebx
+  802563:	83 c4 10             	add    $0x10,%esp
+  802566:	83 f8 01             	cmp    $0x1,%eax
+  802569:	7e 37                	jle    8025a2 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  80256b:	a1 38 70 80 00       	mov    0x807038,%eax
+  802570:	8b 55 18             	mov    0x18(%ebp),%edx
+  802573:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  802575:	83 ec 04             	sub    $0x4,%esp
+  802578:	50                   	push   %eax
+  802579:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  80257f:	56                   	push   %esi
+  802580:	ff 75 10             	push   0x10(%ebp)
+  802583:	e8 b9 e7 ff ff       	call   800d41 <memmove>
+  return fd2num(fd);
+  802588:	83 c4 04             	add    $0x4,%esp
+  80258b:	ff 75 e4             	push   -0x1c(%ebp)
+  80258e:	e8 3a f3 ff ff       	call   8018cd <fd2num>
+  802593:	89 c3                	mov    %eax,%ebx
+  802595:	83 c4 10             	add    $0x10,%esp
+}
+  802598:	89 d8                	mov    %ebx,%eax
+  80259a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80259d:	5b                   	pop    %ebx
+  80259e:	5e                   	pop    %esi
+  80259f:	5f                   	pop    %edi
+  8025a0:	5d                   	pop    %ebp
+  8025a1:	c3                   	ret
+    fd_close(fd, 0);
+  8025a2:	83 ec 08             	sub    $0x8,%esp
+  8025a5:	6a 00                	push   $0x0
+  8025a7:	ff 75 e4             	push   -0x1c(%ebp)
+  8025aa:	e8 34 f4 ff ff       	call   8019e3 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8025af:	83 c4 10             	add    $0x10,%esp
+  8025b2:	85 db                	test   %ebx,%ebx
+  8025b4:	78 e2                	js     802598 <open_read+0xed>
+  8025b6:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  8025b9:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  8025bf:	eb d7                	jmp    802598 <open_read+0xed>
+    return -E_BAD_PATH;
+  8025c1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8025c6:	eb d0                	jmp    802598 <open_read+0xed>
+
+008025c8 <file_stat>:
+{
+  8025c8:	55                   	push   %ebp
+  8025c9:	89 e5                	mov    %esp,%ebp
+  8025cb:	57                   	push   %edi
+  8025cc:	56                   	push   %esi
+  8025cd:	53                   	push   %ebx
+  8025ce:	83 ec 18             	sub    $0x18,%esp
+  8025d1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8025d4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8025d7:	57                   	push   %edi
+  8025d8:	e8 a3 e5 ff ff       	call   800b80 <strlen>
+  8025dd:	83 c4 10             	add    $0x10,%esp
+  8025e0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025e5:	0f 8f c7 00 00 00    	jg     8026b2 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  8025eb:	83 ec 0c             	sub    $0xc,%esp
+  8025ee:	57                   	push   %edi
+  8025ef:	e8 8c e5 ff ff       	call   800b80 <strlen>
+  8025f4:	8d 58 04             	lea    0x4(%eax),%ebx
+  8025f7:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8025fa:	83 c4 08             	add    $0x8,%esp
+  8025fd:	57                   	push   %edi
+  8025fe:	68 e4 70 80 00       	push   $0x8070e4
+  802603:	e8 b3 e5 ff ff       	call   800bbb <strcpy>
+  req->req_nops = 2;
+  802608:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  80260f:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802612:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  802619:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  80261c:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  802623:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802626:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  80262d:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802630:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  802637:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80263a:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  802641:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802644:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  80264a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80264f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802654:	e8 32 f9 ff ff       	call   801f8b <fsipc>
+  802659:	83 c4 10             	add    $0x10,%esp
+  80265c:	83 f8 01             	cmp    $0x1,%eax
+  80265f:	7e 42                	jle    8026a3 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802661:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802667:	83 ec 08             	sub    $0x8,%esp
+  80266a:	53                   	push   %ebx
+  80266b:	56                   	push   %esi
+  80266c:	e8 4a e5 ff ff       	call   800bbb <strcpy>
+  st->st_size = ret->ret_size;
+  802671:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802677:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  80267d:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802683:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802689:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802690:	50 80 00 
+  return 0;
+  802693:	83 c4 10             	add    $0x10,%esp
+  802696:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80269b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80269e:	5b                   	pop    %ebx
+  80269f:	5e                   	pop    %esi
+  8026a0:	5f                   	pop    %edi
+  8026a1:	5d                   	pop    %ebp
+  8026a2:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8026a3:	85 c0                	test   %eax,%eax
+  8026a5:	78 f4                	js     80269b <file_stat+0xd3>
+  8026a7:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8026aa:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  8026b0:	eb e9                	jmp    80269b <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8026b2:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8026b7:	eb e2                	jmp    80269b <file_stat+0xd3>
+
+008026b9 <read_map>:
+{
+  8026b9:	55                   	push   %ebp
+  8026ba:	89 e5                	mov    %esp,%ebp
+  8026bc:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026c2:	50                   	push   %eax
+  8026c3:	ff 75 08             	push   0x8(%ebp)
+  8026c6:	e8 7c f2 ff ff       	call   801947 <fd_lookup>
+  8026cb:	83 c4 10             	add    $0x10,%esp
+  8026ce:	85 c0                	test   %eax,%eax
+  8026d0:	78 2a                	js     8026fc <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8026d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026d5:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  8026db:	39 08                	cmp    %ecx,(%eax)
+  8026dd:	75 1f                	jne    8026fe <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8026df:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026e2:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  8026e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026ea:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8026ef:	8b 55 10             	mov    0x10(%ebp),%edx
+  8026f2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8026f7:	e8 8f f8 ff ff       	call   801f8b <fsipc>
+}
+  8026fc:	c9                   	leave
+  8026fd:	c3                   	ret
+    return -E_INVAL;
+  8026fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802703:	eb f7                	jmp    8026fc <read_map+0x43>
+
+00802705 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802705:	55                   	push   %ebp
+  802706:	89 e5                	mov    %esp,%ebp
+  802708:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80270b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802710:	b8 08 00 00 00       	mov    $0x8,%eax
+  802715:	e8 71 f8 ff ff       	call   801f8b <fsipc>
+}
+  80271a:	c9                   	leave
+  80271b:	c3                   	ret
+
+0080271c <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  80271c:	55                   	push   %ebp
+  80271d:	89 e5                	mov    %esp,%ebp
+  80271f:	57                   	push   %edi
+  802720:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802721:	8b 45 08             	mov    0x8(%ebp),%eax
+  802724:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802729:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802730:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802733:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  80273a:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80273d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802742:	b8 09 00 00 00       	mov    $0x9,%eax
+  802747:	e8 3f f8 ff ff       	call   801f8b <fsipc>
+  80274c:	85 c0                	test   %eax,%eax
+  80274e:	78 14                	js     802764 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802750:	be 00 70 80 00       	mov    $0x807000,%esi
+  802755:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80275a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80275d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  80275f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802764:	5e                   	pop    %esi
+  802765:	5f                   	pop    %edi
+  802766:	5d                   	pop    %ebp
+  802767:	c3                   	ret
+
+00802768 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802768:	55                   	push   %ebp
+  802769:	89 e5                	mov    %esp,%ebp
+  80276b:	53                   	push   %ebx
+  80276c:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  80276f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802772:	50                   	push   %eax
+  802773:	6a 00                	push   $0x0
+  802775:	e8 a2 ff ff ff       	call   80271c <fs_stats>
+  80277a:	83 c4 10             	add    $0x10,%esp
+  80277d:	85 c0                	test   %eax,%eax
+  80277f:	78 28                	js     8027a9 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802781:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802784:	83 ec 08             	sub    $0x8,%esp
+  802787:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80278a:	50                   	push   %eax
+  80278b:	6a 20                	push   $0x20
+  80278d:	e8 8a ff ff ff       	call   80271c <fs_stats>
+  802792:	83 c4 10             	add    $0x10,%esp
+  802795:	85 c0                	test   %eax,%eax
+  802797:	78 10                	js     8027a9 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802799:	83 ec 08             	sub    $0x8,%esp
+  80279c:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80279f:	50                   	push   %eax
+  8027a0:	53                   	push   %ebx
+  8027a1:	e8 76 ff ff ff       	call   80271c <fs_stats>
+  8027a6:	83 c4 10             	add    $0x10,%esp
+}
+  8027a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027ac:	c9                   	leave
+  8027ad:	c3                   	ret
+
+008027ae <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8027ae:	55                   	push   %ebp
+  8027af:	89 e5                	mov    %esp,%ebp
+  8027b1:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8027b4:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8027bb:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8027be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027c1:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  8027c6:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8027cd:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8027d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027d5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8027da:	e8 ac f7 ff ff       	call   801f8b <fsipc>
+}
+  8027df:	c9                   	leave
+  8027e0:	c3                   	ret
+
+008027e1 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8027e1:	55                   	push   %ebp
+  8027e2:	89 e5                	mov    %esp,%ebp
+  8027e4:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8027e7:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8027ee:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8027f1:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8027f8:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8027fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027fe:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  802803:	ba 00 00 00 00       	mov    $0x0,%edx
+  802808:	b8 09 00 00 00       	mov    $0x9,%eax
+  80280d:	e8 79 f7 ff ff       	call   801f8b <fsipc>
+}
+  802812:	c9                   	leave
+  802813:	c3                   	ret
+
+00802814 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802814:	55                   	push   %ebp
+  802815:	89 e5                	mov    %esp,%ebp
+  802817:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80281a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80281d:	50                   	push   %eax
+  80281e:	ff 75 08             	push   0x8(%ebp)
+  802821:	e8 21 f1 ff ff       	call   801947 <fd_lookup>
+  802826:	83 c4 10             	add    $0x10,%esp
+  802829:	85 c0                	test   %eax,%eax
+  80282b:	78 34                	js     802861 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80282d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802830:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802836:	39 08                	cmp    %ecx,(%eax)
+  802838:	75 29                	jne    802863 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80283a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80283d:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  802842:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802845:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  80284a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80284d:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802852:	ba 00 00 00 00       	mov    $0x0,%edx
+  802857:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80285c:	e8 2a f7 ff ff       	call   801f8b <fsipc>
+}
+  802861:	c9                   	leave
+  802862:	c3                   	ret
+    return -E_INVAL;
+  802863:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802868:	eb f7                	jmp    802861 <fallocate+0x4d>
+
+0080286a <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80286a:	55                   	push   %ebp
+  80286b:	89 e5                	mov    %esp,%ebp
+  80286d:	57                   	push   %edi
+  80286e:	56                   	push   %esi
+  80286f:	53                   	push   %ebx
+  802870:	83 ec 24             	sub    $0x24,%esp
+  802873:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802876:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802879:	50                   	push   %eax
+  80287a:	ff 75 08             	push   0x8(%ebp)
+  80287d:	e8 c5 f0 ff ff       	call   801947 <fd_lookup>
+  802882:	83 c4 10             	add    $0x10,%esp
+  802885:	85 c0                	test   %eax,%eax
+  802887:	78 66                	js     8028ef <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802889:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80288c:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802892:	39 08                	cmp    %ecx,(%eax)
+  802894:	75 61                	jne    8028f7 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802896:	85 f6                	test   %esi,%esi
+  802898:	7e 50                	jle    8028ea <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80289a:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80289f:	39 de                	cmp    %ebx,%esi
+  8028a1:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8028a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028a7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8028aa:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  8028af:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8028b5:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8028bc:	83 ec 04             	sub    $0x4,%esp
+  8028bf:	57                   	push   %edi
+  8028c0:	ff 75 0c             	push   0xc(%ebp)
+  8028c3:	68 08 70 80 00       	push   $0x807008
+  8028c8:	e8 74 e4 ff ff       	call   800d41 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8028cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8028d7:	e8 af f6 ff ff       	call   801f8b <fsipc>
+  8028dc:	83 c4 10             	add    $0x10,%esp
+  8028df:	85 c0                	test   %eax,%eax
+  8028e1:	78 0c                	js     8028ef <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8028e3:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8028e6:	29 de                	sub    %ebx,%esi
+  8028e8:	eb ac                	jmp    802896 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8028ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028f2:	5b                   	pop    %ebx
+  8028f3:	5e                   	pop    %esi
+  8028f4:	5f                   	pop    %edi
+  8028f5:	5d                   	pop    %ebp
+  8028f6:	c3                   	ret
+    return -E_INVAL;
+  8028f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028fc:	eb f1                	jmp    8028ef <prefetch+0x85>
+
+008028fe <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+//   which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8028fe:	55                   	push   %ebp
+  8028ff:	89 e5                	mov    %esp,%ebp
+  802901:	57                   	push   %edi
+  802902:	56                   	push   %esi
+  802903:	53                   	push   %ebx
+  802904:	81 ec a8 02 00 00    	sub    $0x2a8,%esp
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  // Open the program and read its ELF header in one round trip.
+  if ((r = open_read(prog, O_RDONLY, elf_buf, sizeof(elf_buf), &n)) < 0)
+  80290a:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  802910:	50                   	push   %eax
+  802911:	68 00 02 00 00       	push   $0x200
+  802916:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80291c:	50                   	push   %eax
+  80291d:	6a 00                	push   $0x0
+  80291f:	ff 75 08             	push   0x8(%ebp)
+  802922:	e8 84 fb ff ff       	call   8024ab <open_read>
+  802927:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  80292d:	83 c4 20             	add    $0x20,%esp
+  802930:	85 c0                	test   %eax,%eax
+  802932:	0f 88 66 06 00 00    	js     802f9e <spawn+0x6a0>
+    return r;
+  fd = r;
+
+  elf = (struct Elf*)elf_buf;
+  if (n != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  802938:	81 bd a0 fd ff ff 00 	cmpl   $0x200,-0x260(%ebp)
+  80293f:	02 00 00 
+  802942:	0f 85 92 00 00 00    	jne    8029da <spawn+0xdc>
+  802948:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  80294f:	45 4c 46 
+  802952:	0f 85 82 00 00 00    	jne    8029da <spawn+0xdc>
+  802958:	b8 07 00 00 00       	mov    $0x7,%eax
+  80295d:	cd 30                	int    $0x30
+  80295f:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  802965:	89 c6                	mov    %eax,%esi
+  802967:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  80296d:	85 c0                	test   %eax,%eax
+  80296f:	0f 88 35 06 00 00    	js     802faa <spawn+0x6ac>
+    return r;
+  child = r;
+  sysbatch_init(&batch);
+  802975:	83 ec 0c             	sub    $0xc,%esp
+  802978:	68 60 67 80 00       	push   $0x806760
+  80297d:	e8 5d ea ff ff       	call   8013df <sysbatch_init>
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  802982:	89 f0                	mov    %esi,%eax
+  802984:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802989:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  80298c:	c1 e6 04             	shl    $0x4,%esi
+  80298f:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802995:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  80299b:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8029a0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  8029a2:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8029a8:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  8029ae:	83 c4 10             	add    $0x10,%esp
+  8029b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  8029b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8029bb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  8029be:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  8029c1:	85 c0                	test   %eax,%eax
+  8029c3:	74 4d                	je     802a12 <spawn+0x114>
+    string_size += strlen(argv[argc]) + 1;
+  8029c5:	83 ec 0c             	sub    $0xc,%esp
+  8029c8:	50                   	push   %eax
+  8029c9:	e8 b2 e1 ff ff       	call   800b80 <strlen>
+  8029ce:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  8029d2:	83 c3 01             	add    $0x1,%ebx
+  8029d5:	83 c4 10             	add    $0x10,%esp
+  8029d8:	eb e4                	jmp    8029be <spawn+0xc0>
+    close(fd);
+  8029da:	83 ec 0c             	sub    $0xc,%esp
+  8029dd:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8029e3:	e8 82 f0 ff ff       	call   801a6a <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8029e8:	83 c4 0c             	add    $0xc,%esp
+  8029eb:	68 7f 45 4c 46       	push   $0x464c457f
+  8029f0:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8029f6:	68 54 4a 80 00       	push   $0x804a54
+  8029fb:	e8 cd db ff ff       	call   8005cd <cprintf>
+    return -E_NOT_EXEC;
+  802a00:	83 c4 10             	add    $0x10,%esp
+  802a03:	c7 85 6c fd ff ff f2 	movl   $0xfffffff2,-0x294(%ebp)
+  802a0a:	ff ff ff 
+  802a0d:	e9 98 05 00 00       	jmp    802faa <spawn+0x6ac>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char*)UTEMP + PGSIZE - string_size;
+  802a12:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  802a18:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802a1d:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t*)(ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802a1f:	89 fa                	mov    %edi,%edx
+  802a21:	83 e2 fc             	and    $0xfffffffc,%edx
+  802a24:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802a2b:	29 c2                	sub    %eax,%edx
+  802a2d:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void*)(argv_store - 2) < (void*)UTEMP)
+  802a33:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802a36:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802a3b:	0f 86 a8 05 00 00    	jbe    802fe9 <spawn+0x6eb>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void*)UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802a41:	83 ec 04             	sub    $0x4,%esp
+  802a44:	6a 07                	push   $0x7
+  802a46:	68 00 00 40 00       	push   $0x400000
+  802a4b:	6a 00                	push   $0x0
+  802a4d:	e8 98 e5 ff ff       	call   800fea <sys_page_alloc>
+  802a52:	83 c4 10             	add    $0x10,%esp
+  802a55:	85 c0                	test   %eax,%eax
+  802a57:	0f 88 91 05 00 00    	js     802fee <spawn+0x6f0>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  802a5d:	be 00 00 00 00       	mov    $0x0,%esi
+  802a62:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802a68:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a6b:	eb 30                	jmp    802a9d <spawn+0x19f>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  802a6d:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802a73:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802a79:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  802a7c:	83 ec 08             	sub    $0x8,%esp
+  802a7f:	ff 34 b3             	push   (%ebx,%esi,4)
+  802a82:	57                   	push   %edi
+  802a83:	e8 33 e1 ff ff       	call   800bbb <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  802a88:	83 c4 04             	add    $0x4,%esp
+  802a8b:	ff 34 b3             	push   (%ebx,%esi,4)
+  802a8e:	e8 ed e0 ff ff       	call   800b80 <strlen>
+  802a93:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  802a97:	83 c6 01             	add    $0x1,%esi
+  802a9a:	83 c4 10             	add    $0x10,%esp
+  802a9d:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  802aa3:	7f c8                	jg     802a6d <spawn+0x16f>
+  }
+  argv_store[argc] = 0;
+  802aa5:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802aab:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802ab1:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  802ab8:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802abe:	0f 85 97 00 00 00    	jne    802b5b <spawn+0x25d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  802ac4:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802aca:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  802ad0:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  802ad3:	89 c8                	mov    %ecx,%eax
+  802ad5:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802adb:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802ade:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  802ae3:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!  Both calls ride along with the first batch
+  // of segment mappings.
+  if ((r = sysbatch_add(&batch, SYS_page_map, 0, (uint32_t) UTEMP, child,
+  802ae9:	83 ec 04             	sub    $0x4,%esp
+  802aec:	6a 07                	push   $0x7
+  802aee:	68 00 d0 bf ee       	push   $0xeebfd000
+  802af3:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802af9:	68 00 00 40 00       	push   $0x400000
+  802afe:	6a 00                	push   $0x0
+  802b00:	6a 05                	push   $0x5
+  802b02:	68 60 67 80 00       	push   $0x806760
+  802b07:	e8 31 e9 ff ff       	call   80143d <sysbatch_add>
+  802b0c:	89 c3                	mov    %eax,%ebx
+  802b0e:	83 c4 20             	add    $0x20,%esp
+  802b11:	85 c0                	test   %eax,%eax
+  802b13:	0f 88 dd 04 00 00    	js     802ff6 <spawn+0x6f8>
+                        USTACKTOP - PGSIZE, PTE_P | PTE_U | PTE_W)) < 0)
+    goto error;
+  if ((r = sysbatch_add(&batch, SYS_page_unmap, 0, (uint32_t) UTEMP,
+  802b19:	83 ec 04             	sub    $0x4,%esp
+  802b1c:	6a 00                	push   $0x0
+  802b1e:	6a 00                	push   $0x0
+  802b20:	6a 00                	push   $0x0
+  802b22:	68 00 00 40 00       	push   $0x400000
+  802b27:	6a 00                	push   $0x0
+  802b29:	6a 06                	push   $0x6
+  802b2b:	68 60 67 80 00       	push   $0x806760
+  802b30:	e8 08 e9 ff ff       	call   80143d <sysbatch_add>
+  802b35:	89 c3                	mov    %eax,%ebx
+  802b37:	83 c4 20             	add    $0x20,%esp
+  802b3a:	85 c0                	test   %eax,%eax
+  802b3c:	0f 88 b4 04 00 00    	js     802ff6 <spawn+0x6f8>
+  ph = (struct Proghdr*)(elf_buf + elf->e_phoff);
+  802b42:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802b48:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802b4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b54:	89 d6                	mov    %edx,%esi
+  802b56:	e9 dd 01 00 00       	jmp    802d38 <spawn+0x43a>
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  802b5b:	68 cc 4a 80 00       	push   $0x804acc
+  802b60:	68 04 4a 80 00       	push   $0x804a04
+  802b65:	68 01 01 00 00       	push   $0x101
+  802b6a:	68 6e 4a 80 00       	push   $0x804a6e
+  802b6f:	e8 7e d9 ff ff       	call   8004f2 <_panic>
+
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+    if (i >= filesz) {
+      // allocate a blank page
+      n = 1;
+      if ((r = sysbatch_add(&batch, SYS_page_alloc, child, va + i,
+  802b74:	83 ec 04             	sub    $0x4,%esp
+  802b77:	6a 00                	push   $0x0
+  802b79:	6a 00                	push   $0x0
+  802b7b:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802b81:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802b87:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  802b8d:	01 c8                	add    %ecx,%eax
+  802b8f:	50                   	push   %eax
+  802b90:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802b96:	6a 04                	push   $0x4
+  802b98:	68 60 67 80 00       	push   $0x806760
+  802b9d:	e8 9b e8 ff ff       	call   80143d <sysbatch_add>
+  802ba2:	83 c4 20             	add    $0x20,%esp
+  802ba5:	85 c0                	test   %eax,%eax
+  802ba7:	0f 88 0b 04 00 00    	js     802fb8 <spawn+0x6ba>
+      n = 1;
+  802bad:	bf 01 00 00 00       	mov    $0x1,%edi
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  802bb2:	89 f8                	mov    %edi,%eax
+  802bb4:	c1 e0 0c             	shl    $0xc,%eax
+  802bb7:	01 85 84 fd ff ff    	add    %eax,-0x27c(%ebp)
+  802bbd:	e9 fc 01 00 00       	jmp    802dbe <spawn+0x4c0>
+  802bc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bc7:	eb 0e                	jmp    802bd7 <spawn+0x2d9>
+  802bc9:	8b bd 60 fd ff ff    	mov    -0x2a0(%ebp),%edi
+  802bcf:	e9 c1 00 00 00       	jmp    802c95 <spawn+0x397>
+          return r;
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+          return -E_INVAL;
+      }
+    } else {
+      for (j = 0; j < n; j++)
+  802bd4:	83 c3 01             	add    $0x1,%ebx
+  802bd7:	39 df                	cmp    %ebx,%edi
+  802bd9:	7e 55                	jle    802c30 <spawn+0x332>
+        if ((r = sysbatch_add(&batch, SYS_page_alloc, 0,
+  802bdb:	83 ec 04             	sub    $0x4,%esp
+  802bde:	6a 00                	push   $0x0
+  802be0:	6a 00                	push   $0x0
+  802be2:	6a 07                	push   $0x7
+  802be4:	89 d8                	mov    %ebx,%eax
+  802be6:	c1 e0 0c             	shl    $0xc,%eax
+  802be9:	05 00 10 40 00       	add    $0x401000,%eax
+  802bee:	50                   	push   %eax
+  802bef:	6a 00                	push   $0x0
+  802bf1:	6a 04                	push   $0x4
+  802bf3:	68 60 67 80 00       	push   $0x806760
+  802bf8:	e8 40 e8 ff ff       	call   80143d <sysbatch_add>
+  802bfd:	83 c4 20             	add    $0x20,%esp
+  802c00:	85 c0                	test   %eax,%eax
+  802c02:	79 d0                	jns    802bd4 <spawn+0x2d6>
+  802c04:	89 c6                	mov    %eax,%esi
+  sys_env_destroy(child);
+  802c06:	83 ec 0c             	sub    $0xc,%esp
+  802c09:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802c0f:	e8 14 e3 ff ff       	call   800f28 <sys_env_destroy>
+  close(fd);
+  802c14:	83 c4 04             	add    $0x4,%esp
+  802c17:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802c1d:	e8 48 ee ff ff       	call   801a6a <close>
+  return r;
+  802c22:	83 c4 10             	add    $0x10,%esp
+  802c25:	89 b5 6c fd ff ff    	mov    %esi,-0x294(%ebp)
+  802c2b:	e9 7a 03 00 00       	jmp    802faa <spawn+0x6ac>
+                              (uint32_t) UTEMP2 + j * PGSIZE,
+                              PTE_P|PTE_U|PTE_W, 0, 0)) < 0)
+          return r;
+      if ((r = sysbatch_flush(&batch)) < 0)
+  802c30:	83 ec 0c             	sub    $0xc,%esp
+  802c33:	68 60 67 80 00       	push   $0x806760
+  802c38:	e8 b0 e7 ff ff       	call   8013ed <sysbatch_flush>
+  802c3d:	83 c4 10             	add    $0x10,%esp
+  802c40:	85 c0                	test   %eax,%eax
+  802c42:	0f 88 85 03 00 00    	js     802fcd <spawn+0x6cf>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  802c48:	83 ec 08             	sub    $0x8,%esp
+  802c4b:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802c51:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802c57:	01 c8                	add    %ecx,%eax
+  802c59:	50                   	push   %eax
+  802c5a:	8b 9d 88 fd ff ff    	mov    -0x278(%ebp),%ebx
+  802c60:	53                   	push   %ebx
+  802c61:	e8 dc f0 ff ff       	call   801d42 <seek>
+  802c66:	83 c4 10             	add    $0x10,%esp
+  802c69:	85 c0                	test   %eax,%eax
+  802c6b:	0f 88 63 03 00 00    	js     802fd4 <spawn+0x6d6>
+        return r;
+      if ((r = readn(fd, UTEMP2, MIN(n * PGSIZE, filesz - i))) < 0)
+  802c71:	83 ec 04             	sub    $0x4,%esp
+  802c74:	89 f8                	mov    %edi,%eax
+  802c76:	c1 e0 0c             	shl    $0xc,%eax
+  802c79:	39 f0                	cmp    %esi,%eax
+  802c7b:	0f 47 c6             	cmova  %esi,%eax
+  802c7e:	50                   	push   %eax
+  802c7f:	68 00 10 40 00       	push   $0x401000
+  802c84:	53                   	push   %ebx
+  802c85:	e8 ef ef ff ff       	call   801c79 <readn>
+  802c8a:	83 c4 10             	add    $0x10,%esp
+  802c8d:	85 c0                	test   %eax,%eax
+  802c8f:	0f 88 46 03 00 00    	js     802fdb <spawn+0x6dd>
+        return r;
+    }
+    for (j = 0; j < n; j++) {
+  802c95:	8d b7 01 04 00 00    	lea    0x401(%edi),%esi
+  802c9b:	c1 e6 0c             	shl    $0xc,%esi
+  802c9e:	bb 00 10 40 00       	mov    $0x401000,%ebx
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  802ca3:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  802ca9:	8b 8d 78 fd ff ff    	mov    -0x288(%ebp),%ecx
+  802caf:	8d 84 08 00 f0 bf ff 	lea    -0x401000(%eax,%ecx,1),%eax
+  802cb6:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  802cbc:	89 c7                	mov    %eax,%edi
+    for (j = 0; j < n; j++) {
+  802cbe:	39 f3                	cmp    %esi,%ebx
+  802cc0:	74 59                	je     802d1b <spawn+0x41d>
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  802cc2:	83 ec 04             	sub    $0x4,%esp
+  802cc5:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802ccb:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  802cce:	50                   	push   %eax
+  802ccf:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802cd5:	53                   	push   %ebx
+  802cd6:	6a 00                	push   $0x0
+  802cd8:	6a 05                	push   $0x5
+  802cda:	68 60 67 80 00       	push   $0x806760
+  802cdf:	e8 59 e7 ff ff       	call   80143d <sysbatch_add>
+  802ce4:	83 c4 20             	add    $0x20,%esp
+  802ce7:	85 c0                	test   %eax,%eax
+  802ce9:	0f 88 f3 02 00 00    	js     802fe2 <spawn+0x6e4>
+                            (uint32_t) UTEMP2 + j * PGSIZE, child,
+                            va + i + j * PGSIZE, perm)) < 0)
+        return r;
+      if ((r = sysbatch_add(&batch, SYS_page_unmap, 0,
+  802cef:	83 ec 04             	sub    $0x4,%esp
+  802cf2:	6a 00                	push   $0x0
+  802cf4:	6a 00                	push   $0x0
+  802cf6:	6a 00                	push   $0x0
+  802cf8:	53                   	push   %ebx
+  802cf9:	6a 00                	push   $0x0
+  802cfb:	6a 06                	push   $0x6
+  802cfd:	68 60 67 80 00       	push   $0x806760
+  802d02:	e8 36 e7 ff ff       	call   80143d <sysbatch_add>
+  802d07:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802d0d:	83 c4 20             	add    $0x20,%esp
+  802d10:	85 c0                	test   %eax,%eax
+  802d12:	79 aa                	jns    802cbe <spawn+0x3c0>
+  802d14:	89 c6                	mov    %eax,%esi
+  802d16:	e9 eb fe ff ff       	jmp    802c06 <spawn+0x308>
+  802d1b:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  802d21:	e9 8c fe ff ff       	jmp    802bb2 <spawn+0x2b4>
+  802d26:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  802d2c:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802d32:	83 c6 01             	add    $0x1,%esi
+  802d35:	83 c7 20             	add    $0x20,%edi
+  802d38:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802d3f:	39 f0                	cmp    %esi,%eax
+  802d41:	0f 8e 9b 01 00 00    	jle    802ee2 <spawn+0x5e4>
+    if (ph->p_type != ELF_PROG_LOAD)
+  802d47:	83 3f 01             	cmpl   $0x1,(%edi)
+  802d4a:	75 e6                	jne    802d32 <spawn+0x434>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802d4c:	8b 47 18             	mov    0x18(%edi),%eax
+  802d4f:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  802d52:	83 f8 01             	cmp    $0x1,%eax
+  802d55:	19 c0                	sbb    %eax,%eax
+  802d57:	83 e0 fe             	and    $0xfffffffe,%eax
+  802d5a:	83 c0 07             	add    $0x7,%eax
+  802d5d:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802d63:	8b 57 04             	mov    0x4(%edi),%edx
+  802d66:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  802d6c:	8b 5f 10             	mov    0x10(%edi),%ebx
+  802d6f:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802d75:	8b 47 14             	mov    0x14(%edi),%eax
+  802d78:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802d7e:	8b 4f 08             	mov    0x8(%edi),%ecx
+  if ((i = PGOFF(va))) {
+  802d81:	89 c8                	mov    %ecx,%eax
+  802d83:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d88:	74 18                	je     802da2 <spawn+0x4a4>
+    va -= i;
+  802d8a:	29 c1                	sub    %eax,%ecx
+    memsz += i;
+  802d8c:	01 85 7c fd ff ff    	add    %eax,-0x284(%ebp)
+    filesz += i;
+  802d92:	01 c3                	add    %eax,%ebx
+  802d94:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+    fileoffset -= i;
+  802d9a:	29 c2                	sub    %eax,%edx
+  802d9c:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  802da2:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802da9:	00 00 00 
+  802dac:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  802db2:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  802db8:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+  802dbe:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802dc4:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802dca:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802dd0:	39 c8                	cmp    %ecx,%eax
+  802dd2:	0f 83 4e ff ff ff    	jae    802d26 <spawn+0x428>
+    if (i >= filesz) {
+  802dd8:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  802dde:	39 8d 84 fd ff ff    	cmp    %ecx,-0x27c(%ebp)
+  802de4:	0f 83 8a fd ff ff    	jae    802b74 <spawn+0x276>
+    n = MIN(SEGCHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  802dea:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  802df0:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802df6:	29 c6                	sub    %eax,%esi
+  802df8:	8d 86 ff 0f 00 00    	lea    0xfff(%esi),%eax
+  802dfe:	c1 e8 0c             	shr    $0xc,%eax
+  802e01:	ba 10 00 00 00       	mov    $0x10,%edx
+  802e06:	39 d0                	cmp    %edx,%eax
+  802e08:	0f 47 c2             	cmova  %edx,%eax
+  802e0b:	89 c7                	mov    %eax,%edi
+  if ((perm & PTE_W) || PGOFF(fileoffset))
+  802e0d:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  802e13:	83 e3 02             	and    $0x2,%ebx
+  802e16:	8b 95 74 fd ff ff    	mov    -0x28c(%ebp),%edx
+  802e1c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802e22:	09 d3                	or     %edx,%ebx
+  802e24:	0f 85 98 fd ff ff    	jne    802bc2 <spawn+0x2c4>
+    n = MIN(n, (filesz - i) / PGSIZE);
+  802e2a:	89 f2                	mov    %esi,%edx
+  802e2c:	c1 ea 0c             	shr    $0xc,%edx
+  802e2f:	39 c2                	cmp    %eax,%edx
+  802e31:	0f 47 d0             	cmova  %eax,%edx
+  802e34:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802e3a:	39 8d 8c fd ff ff    	cmp    %ecx,-0x274(%ebp)
+  802e40:	0f 43 d0             	cmovae %eax,%edx
+    if ((m = shared_pages(perm, memsz, filesz, fileoffset, i, n)) > 0) {
+  802e43:	89 95 60 fd ff ff    	mov    %edx,-0x2a0(%ebp)
+  802e49:	85 d2                	test   %edx,%edx
+  802e4b:	0f 8e 86 fd ff ff    	jle    802bd7 <spawn+0x2d9>
+      if ((r = sysbatch_flush(&batch)) < 0)
+  802e51:	83 ec 0c             	sub    $0xc,%esp
+  802e54:	68 60 67 80 00       	push   $0x806760
+  802e59:	e8 8f e5 ff ff       	call   8013ed <sysbatch_flush>
+  802e5e:	83 c4 10             	add    $0x10,%esp
+  802e61:	85 c0                	test   %eax,%eax
+  802e63:	0f 88 56 01 00 00    	js     802fbf <spawn+0x6c1>
+  802e69:	8b 85 60 fd ff ff    	mov    -0x2a0(%ebp),%eax
+  802e6f:	c1 e0 0c             	shl    $0xc,%eax
+  802e72:	89 f1                	mov    %esi,%ecx
+  802e74:	29 c1                	sub    %eax,%ecx
+  802e76:	89 8d 80 fd ff ff    	mov    %ecx,-0x280(%ebp)
+  802e7c:	89 f3                	mov    %esi,%ebx
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  802e7e:	8d be 00 10 40 00    	lea    0x401000(%esi),%edi
+  802e84:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  802e8a:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802e90:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+      for (j = 0; j < n; j++) {
+  802e93:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802e99:	39 c3                	cmp    %eax,%ebx
+  802e9b:	0f 84 28 fd ff ff    	je     802bc9 <spawn+0x2cb>
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  802ea1:	83 ec 04             	sub    $0x4,%esp
+  802ea4:	89 f8                	mov    %edi,%eax
+  802ea6:	29 d8                	sub    %ebx,%eax
+  802ea8:	50                   	push   %eax
+  802ea9:	89 f0                	mov    %esi,%eax
+  802eab:	29 d8                	sub    %ebx,%eax
+  802ead:	50                   	push   %eax
+  802eae:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802eb4:	e8 00 f8 ff ff       	call   8026b9 <read_map>
+  802eb9:	83 c4 10             	add    $0x10,%esp
+  802ebc:	85 c0                	test   %eax,%eax
+  802ebe:	0f 88 02 01 00 00    	js     802fc6 <spawn+0x6c8>
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+  802ec4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ec9:	39 d3                	cmp    %edx,%ebx
+  802ecb:	0f 46 d3             	cmovbe %ebx,%edx
+  802ece:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802ed4:	39 d0                	cmp    %edx,%eax
+  802ed6:	73 bb                	jae    802e93 <spawn+0x595>
+          return -E_INVAL;
+  802ed8:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+  802edd:	e9 24 fd ff ff       	jmp    802c06 <spawn+0x308>
+  close(fd);
+  802ee2:	83 ec 0c             	sub    $0xc,%esp
+  802ee5:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802eeb:	e8 7a eb ff ff       	call   801a6a <close>
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  // LAB 5: Your code here.
+  return sysbatch_add(&batch, SYS_page_map_range, 0, 0, UTOP,
+  802ef0:	83 c4 0c             	add    $0xc,%esp
+  802ef3:	6a 02                	push   $0x2
+  802ef5:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802efb:	68 00 00 c0 ee       	push   $0xeec00000
+  802f00:	6a 00                	push   $0x0
+  802f02:	6a 00                	push   $0x0
+  802f04:	6a 11                	push   $0x11
+  802f06:	68 60 67 80 00       	push   $0x806760
+  802f0b:	e8 2d e5 ff ff       	call   80143d <sysbatch_add>
+  if ((r = copy_shared_pages(child)) < 0)
+  802f10:	83 c4 20             	add    $0x20,%esp
+  802f13:	85 c0                	test   %eax,%eax
+  802f15:	78 72                	js     802f89 <spawn+0x68b>
+  if ((r = sysbatch_add(&batch, SYS_env_set_trapframe, child,
+  802f17:	83 ec 04             	sub    $0x4,%esp
+  802f1a:	6a 00                	push   $0x0
+  802f1c:	6a 00                	push   $0x0
+  802f1e:	6a 00                	push   $0x0
+  802f20:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802f26:	50                   	push   %eax
+  802f27:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+  802f2d:	57                   	push   %edi
+  802f2e:	6a 09                	push   $0x9
+  802f30:	68 60 67 80 00       	push   $0x806760
+  802f35:	e8 03 e5 ff ff       	call   80143d <sysbatch_add>
+  802f3a:	83 c4 20             	add    $0x20,%esp
+  802f3d:	85 c0                	test   %eax,%eax
+  802f3f:	78 33                	js     802f74 <spawn+0x676>
+      (r = sysbatch_add(&batch, SYS_env_set_status, child,
+  802f41:	83 ec 04             	sub    $0x4,%esp
+  802f44:	6a 00                	push   $0x0
+  802f46:	6a 00                	push   $0x0
+  802f48:	6a 00                	push   $0x0
+  802f4a:	6a 02                	push   $0x2
+  802f4c:	57                   	push   %edi
+  802f4d:	6a 08                	push   $0x8
+  802f4f:	68 60 67 80 00       	push   $0x806760
+  802f54:	e8 e4 e4 ff ff       	call   80143d <sysbatch_add>
+                        (uint32_t) &child_tf, 0, 0, 0)) < 0 ||
+  802f59:	83 c4 20             	add    $0x20,%esp
+  802f5c:	85 c0                	test   %eax,%eax
+  802f5e:	78 14                	js     802f74 <spawn+0x676>
+      (r = sysbatch_flush(&batch)) < 0)
+  802f60:	83 ec 0c             	sub    $0xc,%esp
+  802f63:	68 60 67 80 00       	push   $0x806760
+  802f68:	e8 80 e4 ff ff       	call   8013ed <sysbatch_flush>
+                        ENV_RUNNABLE, 0, 0, 0)) < 0 ||
+  802f6d:	83 c4 10             	add    $0x10,%esp
+  802f70:	85 c0                	test   %eax,%eax
+  802f72:	79 36                	jns    802faa <spawn+0x6ac>
+    panic("spawn: starting child: %e", r);
+  802f74:	50                   	push   %eax
+  802f75:	68 90 4a 80 00       	push   $0x804a90
+  802f7a:	68 93 00 00 00       	push   $0x93
+  802f7f:	68 6e 4a 80 00       	push   $0x804a6e
+  802f84:	e8 69 d5 ff ff       	call   8004f2 <_panic>
+    panic("copy_shared_pages: %e", r);
+  802f89:	50                   	push   %eax
+  802f8a:	68 7a 4a 80 00       	push   $0x804a7a
+  802f8f:	68 8c 00 00 00       	push   $0x8c
+  802f94:	68 6e 4a 80 00       	push   $0x804a6e
+  802f99:	e8 54 d5 ff ff       	call   8004f2 <_panic>
+    return r;
+  802f9e:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802fa4:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+}
+  802faa:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fb3:	5b                   	pop    %ebx
+  802fb4:	5e                   	pop    %esi
+  802fb5:	5f                   	pop    %edi
+  802fb6:	5d                   	pop    %ebp
+  802fb7:	c3                   	ret
+  802fb8:	89 c6                	mov    %eax,%esi
+  802fba:	e9 47 fc ff ff       	jmp    802c06 <spawn+0x308>
+  802fbf:	89 c6                	mov    %eax,%esi
+  802fc1:	e9 40 fc ff ff       	jmp    802c06 <spawn+0x308>
+  802fc6:	89 c6                	mov    %eax,%esi
+  802fc8:	e9 39 fc ff ff       	jmp    802c06 <spawn+0x308>
+  802fcd:	89 c6                	mov    %eax,%esi
+  802fcf:	e9 32 fc ff ff       	jmp    802c06 <spawn+0x308>
+  802fd4:	89 c6                	mov    %eax,%esi
+  802fd6:	e9 2b fc ff ff       	jmp    802c06 <spawn+0x308>
+  802fdb:	89 c6                	mov    %eax,%esi
+  802fdd:	e9 24 fc ff ff       	jmp    802c06 <spawn+0x308>
+  802fe2:	89 c6                	mov    %eax,%esi
+  802fe4:	e9 1d fc ff ff       	jmp    802c06 <spawn+0x308>
+    return -E_NO_MEM;
+  802fe9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  802fee:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+  802ff4:	eb b4                	jmp    802faa <spawn+0x6ac>
+  sys_page_unmap(0, UTEMP);
+  802ff6:	83 ec 08             	sub    $0x8,%esp
+  802ff9:	68 00 00 40 00       	push   $0x400000
+  802ffe:	6a 00                	push   $0x0
+  803000:	e8 6a e0 ff ff       	call   80106f <sys_page_unmap>
+  803005:	83 c4 10             	add    $0x10,%esp
+  803008:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  80300e:	eb 9a                	jmp    802faa <spawn+0x6ac>
+
+00803010 <spawnl>:
+{
+  803010:	55                   	push   %ebp
+  803011:	89 e5                	mov    %esp,%ebp
+  803013:	56                   	push   %esi
+  803014:	53                   	push   %ebx
+  va_start(vl, arg0);
+  803015:	8d 45 10             	lea    0x10(%ebp),%eax
+  int argc = 0;
+  803018:	be 00 00 00 00       	mov    $0x0,%esi
+  while (va_arg(vl, void *) != NULL) {
+  80301d:	eb 17                	jmp    803036 <spawnl+0x26>
+      cprintf("vl: %p saying %s\n", vl, vl);
+  80301f:	83 ec 04             	sub    $0x4,%esp
+  803022:	53                   	push   %ebx
+  803023:	53                   	push   %ebx
+  803024:	68 aa 4a 80 00       	push   $0x804aaa
+  803029:	e8 9f d5 ff ff       	call   8005cd <cprintf>
+    argc++;
+  80302e:	83 c6 01             	add    $0x1,%esi
+  803031:	83 c4 10             	add    $0x10,%esp
+  while (va_arg(vl, void *) != NULL) {
+  803034:	89 d8                	mov    %ebx,%eax
+  803036:	8d 58 04             	lea    0x4(%eax),%ebx
+  803039:	83 38 00             	cmpl   $0x0,(%eax)
+  80303c:	75 e1                	jne    80301f <spawnl+0xf>
+  cprintf("argc found %d\n", argc);
+  80303e:	83 ec 08             	sub    $0x8,%esp
+  803041:	56                   	push   %esi
+  803042:	68 bc 4a 80 00       	push   $0x804abc
+  803047:	e8 81 d5 ff ff       	call   8005cd <cprintf>
+  const char *argv[argc+2];
+  80304c:	8d 04 b5 17 00 00 00 	lea    0x17(,%esi,4),%eax
+  803053:	83 e0 f0             	and    $0xfffffff0,%eax
+  803056:	83 c4 10             	add    $0x10,%esp
+  803059:	29 c4                	sub    %eax,%esp
+  80305b:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  80305f:	89 d8                	mov    %ebx,%eax
+  803061:	c1 e8 02             	shr    $0x2,%eax
+  803064:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  803067:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80306a:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  argv[argc+1] = NULL;
+  803071:	c7 44 b3 04 00 00 00 	movl   $0x0,0x4(%ebx,%esi,4)
+  803078:	00 
+  va_start(vl, arg0);
+  803079:	8d 55 10             	lea    0x10(%ebp),%edx
+  for (i = 0; i < argc; i++)
+  80307c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803081:	eb 0b                	jmp    80308e <spawnl+0x7e>
+    argv[i+1] = va_arg(vl, const char *);
+  803083:	83 c0 01             	add    $0x1,%eax
+  803086:	8b 0a                	mov    (%edx),%ecx
+  803088:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  80308b:	8d 52 04             	lea    0x4(%edx),%edx
+  for (i = 0; i < argc; i++)
+  80308e:	39 f0                	cmp    %esi,%eax
+  803090:	75 f1                	jne    803083 <spawnl+0x73>
+  return spawn(prog, argv);
+  803092:	83 ec 08             	sub    $0x8,%esp
+  803095:	53                   	push   %ebx
+  803096:	ff 75 08             	push   0x8(%ebp)
+  803099:	e8 60 f8 ff ff       	call   8028fe <spawn>
+}
+  80309e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030a1:	5b                   	pop    %ebx
+  8030a2:	5e                   	pop    %esi
+  8030a3:	5d                   	pop    %ebp
+  8030a4:	c3                   	ret
+
+008030a5 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8030a5:	55                   	push   %ebp
+  8030a6:	89 e5                	mov    %esp,%ebp
+  8030a8:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8030ab:	50                   	push   %eax
+  8030ac:	e8 2c e8 ff ff       	call   8018dd <fd2data>
+  8030b1:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8030b6:	c9                   	leave
+  8030b7:	c3                   	ret
+
+008030b8 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8030b8:	55                   	push   %ebp
+  8030b9:	89 e5                	mov    %esp,%ebp
+  8030bb:	56                   	push   %esi
+  8030bc:	53                   	push   %ebx
+  8030bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8030c0:	83 ec 0c             	sub    $0xc,%esp
+  8030c3:	ff 75 08             	push   0x8(%ebp)
+  8030c6:	e8 12 e8 ff ff       	call   8018dd <fd2data>
+  8030cb:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8030cd:	83 c4 08             	add    $0x8,%esp
+  8030d0:	68 f2 4a 80 00       	push   $0x804af2
+  8030d5:	53                   	push   %ebx
+  8030d6:	e8 e0 da ff ff       	call   800bbb <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8030db:	8b 46 04             	mov    0x4(%esi),%eax
+  8030de:	2b 06                	sub    (%esi),%eax
+  8030e0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8030e6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8030ed:	00 00 00 
+  stat->st_dev = &devpipe;
+  8030f0:	c7 83 88 00 00 00 3c 	movl   $0x80503c,0x88(%ebx)
+  8030f7:	50 80 00 
+  return 0;
+}
+  8030fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803102:	5b                   	pop    %ebx
+  803103:	5e                   	pop    %esi
+  803104:	5d                   	pop    %ebp
+  803105:	c3                   	ret
+
+00803106 <pipe_wakeup>:
+{
+  803106:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  803108:	b8 00 00 00 00       	mov    $0x0,%eax
+  80310d:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  803110:	85 c0                	test   %eax,%eax
+  803112:	75 01                	jne    803115 <pipe_wakeup+0xf>
+  803114:	c3                   	ret
+{
+  803115:	55                   	push   %ebp
+  803116:	89 e5                	mov    %esp,%ebp
+  803118:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  80311b:	6a 00                	push   $0x0
+  80311d:	68 00 00 c0 ee       	push   $0xeec00000
+  803122:	52                   	push   %edx
+  803123:	e8 1e e2 ff ff       	call   801346 <sys_chan_wakeup>
+  803128:	83 c4 10             	add    $0x10,%esp
+}
+  80312b:	c9                   	leave
+  80312c:	c3                   	ret
+
+0080312d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80312d:	55                   	push   %ebp
+  80312e:	89 e5                	mov    %esp,%ebp
+  803130:	57                   	push   %edi
+  803131:	56                   	push   %esi
+  803132:	53                   	push   %ebx
+  803133:	83 ec 18             	sub    $0x18,%esp
+  803136:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  803139:	57                   	push   %edi
+  80313a:	e8 9e e7 ff ff       	call   8018dd <fd2data>
+  80313f:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  803141:	83 c4 10             	add    $0x10,%esp
+  803144:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  803148:	74 2a                	je     803174 <devpipe_close+0x47>
+  80314a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80314f:	89 f8                	mov    %edi,%eax
+  803151:	e8 4f ff ff ff       	call   8030a5 <pipe_ring>
+  803156:	83 ec 08             	sub    $0x8,%esp
+  803159:	01 d8                	add    %ebx,%eax
+  80315b:	50                   	push   %eax
+  80315c:	6a 00                	push   $0x0
+  80315e:	e8 0c df ff ff       	call   80106f <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  803163:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803169:	83 c4 10             	add    $0x10,%esp
+  80316c:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  803172:	75 db                	jne    80314f <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  803174:	83 ec 08             	sub    $0x8,%esp
+  803177:	57                   	push   %edi
+  803178:	6a 00                	push   $0x0
+  80317a:	e8 f0 de ff ff       	call   80106f <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80317f:	83 c4 10             	add    $0x10,%esp
+  803182:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  803186:	75 13                	jne    80319b <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  803188:	83 ec 08             	sub    $0x8,%esp
+  80318b:	56                   	push   %esi
+  80318c:	6a 00                	push   $0x0
+  80318e:	e8 dc de ff ff       	call   80106f <sys_page_unmap>
+}
+  803193:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803196:	5b                   	pop    %ebx
+  803197:	5e                   	pop    %esi
+  803198:	5f                   	pop    %edi
+  803199:	5d                   	pop    %ebp
+  80319a:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80319b:	8d 56 04             	lea    0x4(%esi),%edx
+  80319e:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8031a1:	e8 60 ff ff ff       	call   803106 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8031a6:	8d 46 30             	lea    0x30(%esi),%eax
+  8031a9:	89 f2                	mov    %esi,%edx
+  8031ab:	e8 56 ff ff ff       	call   803106 <pipe_wakeup>
+  8031b0:	eb d6                	jmp    803188 <devpipe_close+0x5b>
+
+008031b2 <_pipeisclosed>:
+{
+  8031b2:	55                   	push   %ebp
+  8031b3:	89 e5                	mov    %esp,%ebp
+  8031b5:	57                   	push   %edi
+  8031b6:	56                   	push   %esi
+  8031b7:	53                   	push   %ebx
+  8031b8:	83 ec 1c             	sub    $0x1c,%esp
+  8031bb:	89 c7                	mov    %eax,%edi
+  8031bd:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8031bf:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  8031c4:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8031c7:	83 ec 0c             	sub    $0xc,%esp
+  8031ca:	57                   	push   %edi
+  8031cb:	e8 76 0f 00 00       	call   804146 <pageref>
+  8031d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8031d3:	89 34 24             	mov    %esi,(%esp)
+  8031d6:	e8 6b 0f 00 00       	call   804146 <pageref>
+    nn = thisenv->env_runs;
+  8031db:	8b 15 c0 6f 80 00    	mov    0x806fc0,%edx
+  8031e1:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8031e4:	83 c4 10             	add    $0x10,%esp
+  8031e7:	39 cb                	cmp    %ecx,%ebx
+  8031e9:	74 1b                	je     803206 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8031eb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8031ee:	75 cf                	jne    8031bf <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8031f0:	8b 42 58             	mov    0x58(%edx),%eax
+  8031f3:	6a 01                	push   $0x1
+  8031f5:	50                   	push   %eax
+  8031f6:	53                   	push   %ebx
+  8031f7:	68 f9 4a 80 00       	push   $0x804af9
+  8031fc:	e8 cc d3 ff ff       	call   8005cd <cprintf>
+  803201:	83 c4 10             	add    $0x10,%esp
+  803204:	eb b9                	jmp    8031bf <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  803206:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803209:	0f 94 c0             	sete   %al
+  80320c:	0f b6 c0             	movzbl %al,%eax
+}
+  80320f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803212:	5b                   	pop    %ebx
+  803213:	5e                   	pop    %esi
+  803214:	5f                   	pop    %edi
+  803215:	5d                   	pop    %ebp
+  803216:	c3                   	ret
+
+00803217 <devpipe_write_bulk>:
+{
+  803217:	55                   	push   %ebp
+  803218:	89 e5                	mov    %esp,%ebp
+  80321a:	57                   	push   %edi
+  80321b:	56                   	push   %esi
+  80321c:	53                   	push   %ebx
+  80321d:	83 ec 1c             	sub    $0x1c,%esp
+  803220:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803223:	89 d6                	mov    %edx,%esi
+  803225:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  803228:	e8 78 fe ff ff       	call   8030a5 <pipe_ring>
+  80322d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  803230:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  803235:	8d 46 04             	lea    0x4(%esi),%eax
+  803238:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80323b:	eb 75                	jmp    8032b2 <devpipe_write_bulk+0x9b>
+  80323d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803242:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  803246:	6a 64                	push   $0x64
+  803248:	68 00 00 c0 ee       	push   $0xeec00000
+  80324d:	53                   	push   %ebx
+  80324e:	56                   	push   %esi
+  80324f:	e8 cf e0 ff ff       	call   801323 <sys_chan_sleep>
+      continue;
+  803254:	83 c4 10             	add    $0x10,%esp
+  803257:	eb 59                	jmp    8032b2 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  803259:	89 d1                	mov    %edx,%ecx
+  80325b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80325e:	c1 e9 11             	shr    $0x11,%ecx
+  803261:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  803264:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  803269:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80326b:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  803271:	29 d3                	sub    %edx,%ebx
+  803273:	ba 00 80 00 00       	mov    $0x8000,%edx
+  803278:	29 c2                	sub    %eax,%edx
+  80327a:	39 d3                	cmp    %edx,%ebx
+  80327c:	0f 47 da             	cmova  %edx,%ebx
+  80327f:	8b 55 08             	mov    0x8(%ebp),%edx
+  803282:	29 fa                	sub    %edi,%edx
+  803284:	39 d3                	cmp    %edx,%ebx
+  803286:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  803289:	83 ec 04             	sub    $0x4,%esp
+  80328c:	53                   	push   %ebx
+  80328d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803290:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  803293:	52                   	push   %edx
+  803294:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803297:	01 c8                	add    %ecx,%eax
+  803299:	50                   	push   %eax
+  80329a:	e8 04 db ff ff       	call   800da3 <memcpy>
+    i += m;
+  80329f:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8032a1:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8032a4:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8032a7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8032aa:	e8 57 fe ff ff       	call   803106 <pipe_wakeup>
+  8032af:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8032b2:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8032b5:	73 2b                	jae    8032e2 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8032b7:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8032b9:	8b 56 04             	mov    0x4(%esi),%edx
+  8032bc:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8032c2:	39 d0                	cmp    %edx,%eax
+  8032c4:	7d 93                	jge    803259 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8032c6:	89 f2                	mov    %esi,%edx
+  8032c8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8032cb:	e8 e2 fe ff ff       	call   8031b2 <_pipeisclosed>
+  8032d0:	85 c0                	test   %eax,%eax
+  8032d2:	0f 84 65 ff ff ff    	je     80323d <devpipe_write_bulk+0x26>
+        return i;
+  8032d8:	89 f8                	mov    %edi,%eax
+}
+  8032da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032dd:	5b                   	pop    %ebx
+  8032de:	5e                   	pop    %esi
+  8032df:	5f                   	pop    %edi
+  8032e0:	5d                   	pop    %ebp
+  8032e1:	c3                   	ret
+  return i;
+  8032e2:	89 f8                	mov    %edi,%eax
+  8032e4:	eb f4                	jmp    8032da <devpipe_write_bulk+0xc3>
+
+008032e6 <devpipe_write>:
+{
+  8032e6:	55                   	push   %ebp
+  8032e7:	89 e5                	mov    %esp,%ebp
+  8032e9:	57                   	push   %edi
+  8032ea:	56                   	push   %esi
+  8032eb:	53                   	push   %ebx
+  8032ec:	83 ec 28             	sub    $0x28,%esp
+  8032ef:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8032f2:	56                   	push   %esi
+  8032f3:	e8 e5 e5 ff ff       	call   8018dd <fd2data>
+  8032f8:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8032fa:	8b 78 28             	mov    0x28(%eax),%edi
+  8032fd:	83 c4 10             	add    $0x10,%esp
+  803300:	85 ff                	test   %edi,%edi
+  803302:	75 25                	jne    803329 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  803304:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803307:	74 66                	je     80336f <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803309:	8b 43 04             	mov    0x4(%ebx),%eax
+  80330c:	8b 0b                	mov    (%ebx),%ecx
+  80330e:	8d 51 20             	lea    0x20(%ecx),%edx
+  803311:	39 d0                	cmp    %edx,%eax
+  803313:	72 2b                	jb     803340 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  803315:	89 da                	mov    %ebx,%edx
+  803317:	89 f0                	mov    %esi,%eax
+  803319:	e8 94 fe ff ff       	call   8031b2 <_pipeisclosed>
+  80331e:	85 c0                	test   %eax,%eax
+  803320:	75 51                	jne    803373 <devpipe_write+0x8d>
+      sys_yield();
+  803322:	e8 61 dc ff ff       	call   800f88 <sys_yield>
+  803327:	eb e0                	jmp    803309 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  803329:	83 ec 0c             	sub    $0xc,%esp
+  80332c:	ff 75 10             	push   0x10(%ebp)
+  80332f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803332:	89 c2                	mov    %eax,%edx
+  803334:	89 f0                	mov    %esi,%eax
+  803336:	e8 dc fe ff ff       	call   803217 <devpipe_write_bulk>
+  80333b:	83 c4 10             	add    $0x10,%esp
+  80333e:	eb 38                	jmp    803378 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803340:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803343:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803347:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80334a:	89 c2                	mov    %eax,%edx
+  80334c:	c1 fa 1f             	sar    $0x1f,%edx
+  80334f:	89 d1                	mov    %edx,%ecx
+  803351:	c1 e9 1b             	shr    $0x1b,%ecx
+  803354:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803357:	83 e2 1f             	and    $0x1f,%edx
+  80335a:	29 ca                	sub    %ecx,%edx
+  80335c:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803360:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  803364:	83 c0 01             	add    $0x1,%eax
+  803367:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80336a:	83 c7 01             	add    $0x1,%edi
+  80336d:	eb 95                	jmp    803304 <devpipe_write+0x1e>
+  return i;
+  80336f:	89 f8                	mov    %edi,%eax
+  803371:	eb 05                	jmp    803378 <devpipe_write+0x92>
+        return 0;
+  803373:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803378:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80337b:	5b                   	pop    %ebx
+  80337c:	5e                   	pop    %esi
+  80337d:	5f                   	pop    %edi
+  80337e:	5d                   	pop    %ebp
+  80337f:	c3                   	ret
+
+00803380 <devpipe_read_bulk>:
+{
+  803380:	55                   	push   %ebp
+  803381:	89 e5                	mov    %esp,%ebp
+  803383:	57                   	push   %edi
+  803384:	56                   	push   %esi
+  803385:	53                   	push   %ebx
+  803386:	83 ec 2c             	sub    $0x2c,%esp
+  803389:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80338c:	89 d6                	mov    %edx,%esi
+  80338e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803391:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  803394:	e8 0c fd ff ff       	call   8030a5 <pipe_ring>
+  803399:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80339c:	85 db                	test   %ebx,%ebx
+  80339e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8033a3:	0f 45 c3             	cmovne %ebx,%eax
+  8033a6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8033a9:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8033ae:	8d 46 30             	lea    0x30(%esi),%eax
+  8033b1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8033b4:	eb 50                	jmp    803406 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8033b6:	89 d1                	mov    %edx,%ecx
+  8033b8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8033bb:	c1 e9 11             	shr    $0x11,%ecx
+  8033be:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8033c1:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8033c6:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8033c8:	29 d3                	sub    %edx,%ebx
+  8033ca:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8033cf:	29 c2                	sub    %eax,%edx
+  8033d1:	39 d3                	cmp    %edx,%ebx
+  8033d3:	0f 47 da             	cmova  %edx,%ebx
+  8033d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8033d9:	29 fa                	sub    %edi,%edx
+  8033db:	39 d3                	cmp    %edx,%ebx
+  8033dd:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8033e0:	83 ec 04             	sub    $0x4,%esp
+  8033e3:	53                   	push   %ebx
+  8033e4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8033e7:	01 c8                	add    %ecx,%eax
+  8033e9:	50                   	push   %eax
+  8033ea:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8033ed:	01 f8                	add    %edi,%eax
+  8033ef:	50                   	push   %eax
+  8033f0:	e8 ae d9 ff ff       	call   800da3 <memcpy>
+    i += m;
+  8033f5:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8033f7:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8033f9:	89 f2                	mov    %esi,%edx
+  8033fb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8033fe:	e8 03 fd ff ff       	call   803106 <pipe_wakeup>
+  803403:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  803406:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  803409:	73 51                	jae    80345c <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  80340b:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  80340e:	8b 16                	mov    (%esi),%edx
+  803410:	39 da                	cmp    %ebx,%edx
+  803412:	75 a2                	jne    8033b6 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  803414:	85 ff                	test   %edi,%edi
+  803416:	75 44                	jne    80345c <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  803418:	89 f2                	mov    %esi,%edx
+  80341a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80341d:	e8 90 fd ff ff       	call   8031b2 <_pipeisclosed>
+  803422:	85 c0                	test   %eax,%eax
+  803424:	75 3a                	jne    803460 <devpipe_read_bulk+0xe0>
+  803426:	b8 01 00 00 00       	mov    $0x1,%eax
+  80342b:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80342f:	6a 64                	push   $0x64
+  803431:	ff 75 d4             	push   -0x2c(%ebp)
+  803434:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  803435:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  803438:	50                   	push   %eax
+  803439:	e8 e5 de ff ff       	call   801323 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80343e:	85 c0                	test   %eax,%eax
+  803440:	ba 00 00 00 00       	mov    $0x0,%edx
+  803445:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  803448:	83 c4 10             	add    $0x10,%esp
+  80344b:	a8 01                	test   $0x1,%al
+  80344d:	74 b7                	je     803406 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  80344f:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  803454:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803457:	5b                   	pop    %ebx
+  803458:	5e                   	pop    %esi
+  803459:	5f                   	pop    %edi
+  80345a:	5d                   	pop    %ebp
+  80345b:	c3                   	ret
+  return i;
+  80345c:	89 f8                	mov    %edi,%eax
+  80345e:	eb f4                	jmp    803454 <devpipe_read_bulk+0xd4>
+        return 0;
+  803460:	b8 00 00 00 00       	mov    $0x0,%eax
+  803465:	eb ed                	jmp    803454 <devpipe_read_bulk+0xd4>
+
+00803467 <devpipe_read>:
+{
+  803467:	55                   	push   %ebp
+  803468:	89 e5                	mov    %esp,%ebp
+  80346a:	57                   	push   %edi
+  80346b:	56                   	push   %esi
+  80346c:	53                   	push   %ebx
+  80346d:	83 ec 18             	sub    $0x18,%esp
+  803470:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  803473:	57                   	push   %edi
+  803474:	e8 64 e4 ff ff       	call   8018dd <fd2data>
+  803479:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80347b:	8b 70 28             	mov    0x28(%eax),%esi
+  80347e:	83 c4 10             	add    $0x10,%esp
+  803481:	85 f6                	test   %esi,%esi
+  803483:	75 24                	jne    8034a9 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  803485:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803488:	74 60                	je     8034ea <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  80348a:	8b 03                	mov    (%ebx),%eax
+  80348c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80348f:	75 3b                	jne    8034cc <devpipe_read+0x65>
+      if (i > 0)
+  803491:	85 f6                	test   %esi,%esi
+  803493:	75 2d                	jne    8034c2 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  803495:	89 da                	mov    %ebx,%edx
+  803497:	89 f8                	mov    %edi,%eax
+  803499:	e8 14 fd ff ff       	call   8031b2 <_pipeisclosed>
+  80349e:	85 c0                	test   %eax,%eax
+  8034a0:	75 4c                	jne    8034ee <devpipe_read+0x87>
+      sys_yield();
+  8034a2:	e8 e1 da ff ff       	call   800f88 <sys_yield>
+  8034a7:	eb e1                	jmp    80348a <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  8034a9:	83 ec 08             	sub    $0x8,%esp
+  8034ac:	6a 00                	push   $0x0
+  8034ae:	ff 75 10             	push   0x10(%ebp)
+  8034b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8034b4:	89 c2                	mov    %eax,%edx
+  8034b6:	89 f8                	mov    %edi,%eax
+  8034b8:	e8 c3 fe ff ff       	call   803380 <devpipe_read_bulk>
+  8034bd:	83 c4 10             	add    $0x10,%esp
+  8034c0:	eb 02                	jmp    8034c4 <devpipe_read+0x5d>
+        return i;
+  8034c2:	89 f0                	mov    %esi,%eax
+}
+  8034c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034c7:	5b                   	pop    %ebx
+  8034c8:	5e                   	pop    %esi
+  8034c9:	5f                   	pop    %edi
+  8034ca:	5d                   	pop    %ebp
+  8034cb:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8034cc:	99                   	cltd
+  8034cd:	c1 ea 1b             	shr    $0x1b,%edx
+  8034d0:	01 d0                	add    %edx,%eax
+  8034d2:	83 e0 1f             	and    $0x1f,%eax
+  8034d5:	29 d0                	sub    %edx,%eax
+  8034d7:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8034dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8034df:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8034e2:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8034e5:	83 c6 01             	add    $0x1,%esi
+  8034e8:	eb 9b                	jmp    803485 <devpipe_read+0x1e>
+  return i;
+  8034ea:	89 f0                	mov    %esi,%eax
+  8034ec:	eb d6                	jmp    8034c4 <devpipe_read+0x5d>
+        return 0;
+  8034ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f3:	eb cf                	jmp    8034c4 <devpipe_read+0x5d>
+
+008034f5 <pipe2>:
+{
+  8034f5:	55                   	push   %ebp
+  8034f6:	89 e5                	mov    %esp,%ebp
+  8034f8:	57                   	push   %edi
+  8034f9:	56                   	push   %esi
+  8034fa:	53                   	push   %ebx
+  8034fb:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8034fe:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803501:	50                   	push   %eax
+  803502:	e8 ea e3 ff ff       	call   8018f1 <fd_alloc>
+  803507:	89 c3                	mov    %eax,%ebx
+  803509:	83 c4 10             	add    $0x10,%esp
+  80350c:	85 c0                	test   %eax,%eax
+  80350e:	0f 88 fb 01 00 00    	js     80370f <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803514:	83 ec 04             	sub    $0x4,%esp
+  803517:	68 07 04 00 00       	push   $0x407
+  80351c:	ff 75 e4             	push   -0x1c(%ebp)
+  80351f:	6a 00                	push   $0x0
+  803521:	e8 c4 da ff ff       	call   800fea <sys_page_alloc>
+  803526:	89 c3                	mov    %eax,%ebx
+  803528:	83 c4 10             	add    $0x10,%esp
+  80352b:	85 c0                	test   %eax,%eax
+  80352d:	0f 88 dc 01 00 00    	js     80370f <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  803533:	83 ec 0c             	sub    $0xc,%esp
+  803536:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  803539:	50                   	push   %eax
+  80353a:	e8 b2 e3 ff ff       	call   8018f1 <fd_alloc>
+  80353f:	89 c3                	mov    %eax,%ebx
+  803541:	83 c4 10             	add    $0x10,%esp
+  803544:	85 c0                	test   %eax,%eax
+  803546:	0f 88 b3 01 00 00    	js     8036ff <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80354c:	83 ec 04             	sub    $0x4,%esp
+  80354f:	68 07 04 00 00       	push   $0x407
+  803554:	ff 75 e0             	push   -0x20(%ebp)
+  803557:	6a 00                	push   $0x0
+  803559:	e8 8c da ff ff       	call   800fea <sys_page_alloc>
+  80355e:	89 c3                	mov    %eax,%ebx
+  803560:	83 c4 10             	add    $0x10,%esp
+  803563:	85 c0                	test   %eax,%eax
+  803565:	0f 88 94 01 00 00    	js     8036ff <pipe2+0x20a>
+  va = fd2data(fd0);
+  80356b:	83 ec 0c             	sub    $0xc,%esp
+  80356e:	ff 75 e4             	push   -0x1c(%ebp)
+  803571:	e8 67 e3 ff ff       	call   8018dd <fd2data>
+  803576:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803578:	83 c4 0c             	add    $0xc,%esp
+  80357b:	68 07 04 00 00       	push   $0x407
+  803580:	50                   	push   %eax
+  803581:	6a 00                	push   $0x0
+  803583:	e8 62 da ff ff       	call   800fea <sys_page_alloc>
+  803588:	89 c3                	mov    %eax,%ebx
+  80358a:	83 c4 10             	add    $0x10,%esp
+  80358d:	85 c0                	test   %eax,%eax
+  80358f:	0f 88 5a 01 00 00    	js     8036ef <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803595:	83 ec 0c             	sub    $0xc,%esp
+  803598:	ff 75 e0             	push   -0x20(%ebp)
+  80359b:	e8 3d e3 ff ff       	call   8018dd <fd2data>
+  8035a0:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8035a7:	50                   	push   %eax
+  8035a8:	6a 00                	push   $0x0
+  8035aa:	57                   	push   %edi
+  8035ab:	6a 00                	push   $0x0
+  8035ad:	e8 7b da ff ff       	call   80102d <sys_page_map>
+  8035b2:	89 c3                	mov    %eax,%ebx
+  8035b4:	83 c4 20             	add    $0x20,%esp
+  8035b7:	85 c0                	test   %eax,%eax
+  8035b9:	0f 88 22 01 00 00    	js     8036e1 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  8035bf:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  8035c3:	74 72                	je     803637 <pipe2+0x142>
+  8035c5:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8035ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035cd:	e8 d3 fa ff ff       	call   8030a5 <pipe_ring>
+  8035d2:	83 ec 04             	sub    $0x4,%esp
+  8035d5:	68 07 04 00 00       	push   $0x407
+  8035da:	01 f0                	add    %esi,%eax
+  8035dc:	50                   	push   %eax
+  8035dd:	6a 00                	push   $0x0
+  8035df:	e8 06 da ff ff       	call   800fea <sys_page_alloc>
+  8035e4:	89 c3                	mov    %eax,%ebx
+  8035e6:	83 c4 10             	add    $0x10,%esp
+  8035e9:	85 c0                	test   %eax,%eax
+  8035eb:	0f 88 97 00 00 00    	js     803688 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8035f1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8035f4:	e8 ac fa ff ff       	call   8030a5 <pipe_ring>
+  8035f9:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8035fc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035ff:	e8 a1 fa ff ff       	call   8030a5 <pipe_ring>
+  803604:	83 ec 0c             	sub    $0xc,%esp
+  803607:	68 07 04 00 00       	push   $0x407
+  80360c:	53                   	push   %ebx
+  80360d:	6a 00                	push   $0x0
+  80360f:	01 f0                	add    %esi,%eax
+  803611:	50                   	push   %eax
+  803612:	6a 00                	push   $0x0
+  803614:	e8 14 da ff ff       	call   80102d <sys_page_map>
+  803619:	89 c3                	mov    %eax,%ebx
+  80361b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803621:	83 c4 20             	add    $0x20,%esp
+  803624:	85 c0                	test   %eax,%eax
+  803626:	78 60                	js     803688 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  803628:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80362e:	75 9a                	jne    8035ca <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  803630:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  803637:	a1 3c 50 80 00       	mov    0x80503c,%eax
+  80363c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80363f:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  803641:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803644:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  80364b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80364e:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  803650:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803653:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  80365a:	83 ec 0c             	sub    $0xc,%esp
+  80365d:	ff 75 e4             	push   -0x1c(%ebp)
+  803660:	e8 68 e2 ff ff       	call   8018cd <fd2num>
+  803665:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803668:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  80366a:	83 c4 04             	add    $0x4,%esp
+  80366d:	ff 75 e0             	push   -0x20(%ebp)
+  803670:	e8 58 e2 ff ff       	call   8018cd <fd2num>
+  803675:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803678:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  80367b:	83 c4 10             	add    $0x10,%esp
+  80367e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803683:	e9 87 00 00 00       	jmp    80370f <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  803688:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80368d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803690:	e8 10 fa ff ff       	call   8030a5 <pipe_ring>
+  803695:	83 ec 08             	sub    $0x8,%esp
+  803698:	01 f0                	add    %esi,%eax
+  80369a:	50                   	push   %eax
+  80369b:	6a 00                	push   $0x0
+  80369d:	e8 cd d9 ff ff       	call   80106f <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  8036a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8036a5:	e8 fb f9 ff ff       	call   8030a5 <pipe_ring>
+  8036aa:	83 c4 08             	add    $0x8,%esp
+  8036ad:	01 f0                	add    %esi,%eax
+  8036af:	50                   	push   %eax
+  8036b0:	6a 00                	push   $0x0
+  8036b2:	e8 b8 d9 ff ff       	call   80106f <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8036b7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8036bd:	83 c4 10             	add    $0x10,%esp
+  8036c0:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8036c6:	75 c5                	jne    80368d <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  8036c8:	83 ec 0c             	sub    $0xc,%esp
+  8036cb:	ff 75 e0             	push   -0x20(%ebp)
+  8036ce:	e8 0a e2 ff ff       	call   8018dd <fd2data>
+  8036d3:	83 c4 08             	add    $0x8,%esp
+  8036d6:	50                   	push   %eax
+  8036d7:	6a 00                	push   $0x0
+  8036d9:	e8 91 d9 ff ff       	call   80106f <sys_page_unmap>
+  8036de:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8036e1:	83 ec 08             	sub    $0x8,%esp
+  8036e4:	57                   	push   %edi
+  8036e5:	6a 00                	push   $0x0
+  8036e7:	e8 83 d9 ff ff       	call   80106f <sys_page_unmap>
+  8036ec:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8036ef:	83 ec 08             	sub    $0x8,%esp
+  8036f2:	ff 75 e0             	push   -0x20(%ebp)
+  8036f5:	6a 00                	push   $0x0
+  8036f7:	e8 73 d9 ff ff       	call   80106f <sys_page_unmap>
+  8036fc:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8036ff:	83 ec 08             	sub    $0x8,%esp
+  803702:	ff 75 e4             	push   -0x1c(%ebp)
+  803705:	6a 00                	push   $0x0
+  803707:	e8 63 d9 ff ff       	call   80106f <sys_page_unmap>
+  80370c:	83 c4 10             	add    $0x10,%esp
+}
+  80370f:	89 d8                	mov    %ebx,%eax
+  803711:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803714:	5b                   	pop    %ebx
+  803715:	5e                   	pop    %esi
+  803716:	5f                   	pop    %edi
+  803717:	5d                   	pop    %ebp
+  803718:	c3                   	ret
+
+00803719 <pipe>:
+{
+  803719:	55                   	push   %ebp
+  80371a:	89 e5                	mov    %esp,%ebp
+  80371c:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  80371f:	6a 00                	push   $0x0
+  803721:	ff 75 08             	push   0x8(%ebp)
+  803724:	e8 cc fd ff ff       	call   8034f5 <pipe2>
+}
+  803729:	c9                   	leave
+  80372a:	c3                   	ret
+
+0080372b <pipeisclosed>:
+{
+  80372b:	55                   	push   %ebp
+  80372c:	89 e5                	mov    %esp,%ebp
+  80372e:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803731:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803734:	50                   	push   %eax
+  803735:	ff 75 08             	push   0x8(%ebp)
+  803738:	e8 0a e2 ff ff       	call   801947 <fd_lookup>
+  80373d:	83 c4 10             	add    $0x10,%esp
+  803740:	85 c0                	test   %eax,%eax
+  803742:	78 18                	js     80375c <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  803744:	83 ec 0c             	sub    $0xc,%esp
+  803747:	ff 75 f4             	push   -0xc(%ebp)
+  80374a:	e8 8e e1 ff ff       	call   8018dd <fd2data>
+  80374f:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  803751:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803754:	e8 59 fa ff ff       	call   8031b2 <_pipeisclosed>
+  803759:	83 c4 10             	add    $0x10,%esp
+}
+  80375c:	c9                   	leave
+  80375d:	c3                   	ret
+
+0080375e <pipe_splice>:
+{
+  80375e:	55                   	push   %ebp
+  80375f:	89 e5                	mov    %esp,%ebp
+  803761:	57                   	push   %edi
+  803762:	56                   	push   %esi
+  803763:	53                   	push   %ebx
+  803764:	83 ec 34             	sub    $0x34,%esp
+  803767:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80376a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80376d:	50                   	push   %eax
+  80376e:	ff 75 08             	push   0x8(%ebp)
+  803771:	e8 d1 e1 ff ff       	call   801947 <fd_lookup>
+  803776:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803779:	83 c4 10             	add    $0x10,%esp
+  80377c:	85 c0                	test   %eax,%eax
+  80377e:	0f 88 d7 00 00 00    	js     80385b <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  803784:	83 ec 0c             	sub    $0xc,%esp
+  803787:	ff 75 e4             	push   -0x1c(%ebp)
+  80378a:	e8 4e e1 ff ff       	call   8018dd <fd2data>
+  80378f:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  803791:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803794:	83 c4 10             	add    $0x10,%esp
+  803797:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  80379d:	39 10                	cmp    %edx,(%eax)
+  80379f:	0f 85 c1 00 00 00    	jne    803866 <pipe_splice+0x108>
+  8037a5:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  8037a9:	0f 84 c0 00 00 00    	je     80386f <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  8037af:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8037b3:	0f 84 bf 00 00 00    	je     803878 <pipe_splice+0x11a>
+  8037b9:	89 f7                	mov    %esi,%edi
+  8037bb:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8037c1:	0f 85 ba 00 00 00    	jne    803881 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8037c7:	8d 43 04             	lea    0x4(%ebx),%eax
+  8037ca:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8037cd:	eb 38                	jmp    803807 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8037cf:	83 ec 0c             	sub    $0xc,%esp
+  8037d2:	68 00 10 00 00       	push   $0x1000
+  8037d7:	89 f1                	mov    %esi,%ecx
+  8037d9:	89 da                	mov    %ebx,%edx
+  8037db:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8037de:	e8 34 fa ff ff       	call   803217 <devpipe_write_bulk>
+  8037e3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8037e6:	83 c4 10             	add    $0x10,%esp
+  8037e9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8037ee:	75 53                	jne    803843 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8037f0:	83 ec 08             	sub    $0x8,%esp
+  8037f3:	56                   	push   %esi
+  8037f4:	6a 00                	push   $0x0
+  8037f6:	e8 74 d8 ff ff       	call   80106f <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8037fb:	83 c7 01             	add    $0x1,%edi
+  8037fe:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803804:	83 c4 10             	add    $0x10,%esp
+  803807:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80380a:	74 3a                	je     803846 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  80380c:	8b 03                	mov    (%ebx),%eax
+  80380e:	39 43 04             	cmp    %eax,0x4(%ebx)
+  803811:	75 bc                	jne    8037cf <pipe_splice+0x71>
+  803813:	b8 00 00 00 00       	mov    $0x0,%eax
+  803818:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  80381c:	85 c0                	test   %eax,%eax
+  80381e:	74 af                	je     8037cf <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  803820:	83 ec 04             	sub    $0x4,%esp
+  803823:	6a 07                	push   $0x7
+  803825:	56                   	push   %esi
+  803826:	ff 75 d0             	push   -0x30(%ebp)
+  803829:	e8 18 db ff ff       	call   801346 <sys_chan_wakeup>
+  80382e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803831:	83 c4 10             	add    $0x10,%esp
+  803834:	85 c0                	test   %eax,%eax
+  803836:	79 b8                	jns    8037f0 <pipe_splice+0x92>
+  803838:	b8 01 00 00 00       	mov    $0x1,%eax
+  80383d:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  803841:	eb 8c                	jmp    8037cf <pipe_splice+0x71>
+  803843:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  803846:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80384a:	75 06                	jne    803852 <pipe_splice+0xf4>
+  80384c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  803850:	78 09                	js     80385b <pipe_splice+0xfd>
+  return i * PGSIZE;
+  803852:	8b 45 10             	mov    0x10(%ebp),%eax
+  803855:	c1 e0 0c             	shl    $0xc,%eax
+  803858:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  80385b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80385e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803861:	5b                   	pop    %ebx
+  803862:	5e                   	pop    %esi
+  803863:	5f                   	pop    %edi
+  803864:	5d                   	pop    %ebp
+  803865:	c3                   	ret
+    return -E_INVAL;
+  803866:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80386d:	eb ec                	jmp    80385b <pipe_splice+0xfd>
+  80386f:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803876:	eb e3                	jmp    80385b <pipe_splice+0xfd>
+  803878:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80387f:	eb da                	jmp    80385b <pipe_splice+0xfd>
+  803881:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803888:	eb d1                	jmp    80385b <pipe_splice+0xfd>
+
+0080388a <pipe_splice_read>:
+{
+  80388a:	55                   	push   %ebp
+  80388b:	89 e5                	mov    %esp,%ebp
+  80388d:	53                   	push   %ebx
+  80388e:	83 ec 1c             	sub    $0x1c,%esp
+  803891:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803894:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803897:	50                   	push   %eax
+  803898:	ff 75 08             	push   0x8(%ebp)
+  80389b:	e8 a7 e0 ff ff       	call   801947 <fd_lookup>
+  8038a0:	83 c4 10             	add    $0x10,%esp
+  8038a3:	85 c0                	test   %eax,%eax
+  8038a5:	78 49                	js     8038f0 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  8038a7:	83 ec 0c             	sub    $0xc,%esp
+  8038aa:	ff 75 f4             	push   -0xc(%ebp)
+  8038ad:	e8 2b e0 ff ff       	call   8018dd <fd2data>
+  8038b2:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8038b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8038b7:	83 c4 10             	add    $0x10,%esp
+  8038ba:	8b 0d 3c 50 80 00    	mov    0x80503c,%ecx
+  8038c0:	39 08                	cmp    %ecx,(%eax)
+  8038c2:	75 31                	jne    8038f5 <pipe_splice_read+0x6b>
+  8038c4:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  8038c8:	74 32                	je     8038fc <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  8038ca:	8b 48 08             	mov    0x8(%eax),%ecx
+  8038cd:	83 e1 03             	and    $0x3,%ecx
+  8038d0:	83 f9 01             	cmp    $0x1,%ecx
+  8038d3:	74 2e                	je     803903 <pipe_splice_read+0x79>
+  8038d5:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8038db:	75 2d                	jne    80390a <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  8038dd:	83 ec 08             	sub    $0x8,%esp
+  8038e0:	53                   	push   %ebx
+  8038e1:	68 00 10 00 00       	push   $0x1000
+  8038e6:	89 d9                	mov    %ebx,%ecx
+  8038e8:	e8 93 fa ff ff       	call   803380 <devpipe_read_bulk>
+  8038ed:	83 c4 10             	add    $0x10,%esp
+}
+  8038f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038f3:	c9                   	leave
+  8038f4:	c3                   	ret
+    return -E_INVAL;
+  8038f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038fa:	eb f4                	jmp    8038f0 <pipe_splice_read+0x66>
+  8038fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803901:	eb ed                	jmp    8038f0 <pipe_splice_read+0x66>
+  803903:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803908:	eb e6                	jmp    8038f0 <pipe_splice_read+0x66>
+  80390a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80390f:	eb df                	jmp    8038f0 <pipe_splice_read+0x66>
+
+00803911 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803911:	55                   	push   %ebp
+  803912:	89 e5                	mov    %esp,%ebp
+  803914:	56                   	push   %esi
+  803915:	53                   	push   %ebx
+  803916:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  803919:	85 f6                	test   %esi,%esi
+  80391b:	74 15                	je     803932 <wait+0x21>
+  e = &envs[ENVX(envid)];
+  80391d:	89 f0                	mov    %esi,%eax
+  80391f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  803924:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  803927:	c1 e3 04             	shl    $0x4,%ebx
+  80392a:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803930:	eb 1b                	jmp    80394d <wait+0x3c>
+  assert(envid != 0);
+  803932:	68 11 4b 80 00       	push   $0x804b11
+  803937:	68 04 4a 80 00       	push   $0x804a04
+  80393c:	6a 09                	push   $0x9
+  80393e:	68 1c 4b 80 00       	push   $0x804b1c
+  803943:	e8 aa cb ff ff       	call   8004f2 <_panic>
+    sys_yield();
+  803948:	e8 3b d6 ff ff       	call   800f88 <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  80394d:	8b 43 48             	mov    0x48(%ebx),%eax
+  803950:	39 f0                	cmp    %esi,%eax
+  803952:	75 07                	jne    80395b <wait+0x4a>
+  803954:	8b 43 54             	mov    0x54(%ebx),%eax
+  803957:	85 c0                	test   %eax,%eax
+  803959:	75 ed                	jne    803948 <wait+0x37>
+}
+  80395b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80395e:	5b                   	pop    %ebx
+  80395f:	5e                   	pop    %esi
+  803960:	5d                   	pop    %ebp
+  803961:	c3                   	ret
+
+00803962 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  803962:	55                   	push   %ebp
+  803963:	89 e5                	mov    %esp,%ebp
+  803965:	56                   	push   %esi
+  803966:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  803967:	ba 80 6e 80 00       	mov    $0x806e80,%edx
+  80396c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803971:	eb 0b                	jmp    80397e <mmap_find+0x1c>
+  803973:	83 c3 01             	add    $0x1,%ebx
+  803976:	83 c2 14             	add    $0x14,%edx
+  803979:	83 fb 10             	cmp    $0x10,%ebx
+  80397c:	74 1d                	je     80399b <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  80397e:	8b 0a                	mov    (%edx),%ecx
+  803980:	39 c8                	cmp    %ecx,%eax
+  803982:	72 ef                	jb     803973 <mmap_find+0x11>
+  803984:	85 c9                	test   %ecx,%ecx
+  803986:	74 eb                	je     803973 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  803988:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  80398b:	39 c8                	cmp    %ecx,%eax
+  80398d:	73 e4                	jae    803973 <mmap_find+0x11>
+      return &mmaps[i];
+  80398f:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803992:	8d 04 85 80 6e 80 00 	lea    0x806e80(,%eax,4),%eax
+  803999:	eb 05                	jmp    8039a0 <mmap_find+0x3e>
+  return NULL;
+  80399b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039a0:	5b                   	pop    %ebx
+  8039a1:	5e                   	pop    %esi
+  8039a2:	5d                   	pop    %ebp
+  8039a3:	c3                   	ret
+
+008039a4 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8039a4:	89 c2                	mov    %eax,%edx
+  8039a6:	c1 ea 16             	shr    $0x16,%edx
+  8039a9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8039b0:	f6 c2 01             	test   $0x1,%dl
+  8039b3:	74 11                	je     8039c6 <va_mapped+0x22>
+  8039b5:	c1 e8 0c             	shr    $0xc,%eax
+  8039b8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8039bf:	83 e0 01             	and    $0x1,%eax
+  8039c2:	83 e0 01             	and    $0x1,%eax
+}
+  8039c5:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8039c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039cb:	eb f5                	jmp    8039c2 <va_mapped+0x1e>
+
+008039cd <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  8039cd:	55                   	push   %ebp
+  8039ce:	89 e5                	mov    %esp,%ebp
+  8039d0:	57                   	push   %edi
+  8039d1:	56                   	push   %esi
+  8039d2:	53                   	push   %ebx
+  8039d3:	83 ec 10             	sub    $0x10,%esp
+  8039d6:	89 c3                	mov    %eax,%ebx
+  8039d8:	89 d7                	mov    %edx,%edi
+  8039da:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8039dc:	6a 07                	push   $0x7
+  8039de:	68 00 f0 7f 00       	push   $0x7ff000
+  8039e3:	6a 00                	push   $0x0
+  8039e5:	e8 00 d6 ff ff       	call   800fea <sys_page_alloc>
+  8039ea:	83 c4 10             	add    $0x10,%esp
+  8039ed:	85 c0                	test   %eax,%eax
+  8039ef:	78 46                	js     803a37 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  8039f1:	83 ec 04             	sub    $0x4,%esp
+  8039f4:	57                   	push   %edi
+  8039f5:	53                   	push   %ebx
+  8039f6:	68 00 f0 7f 00       	push   $0x7ff000
+  8039fb:	e8 41 d3 ff ff       	call   800d41 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  803a00:	89 34 24             	mov    %esi,(%esp)
+  803a03:	53                   	push   %ebx
+  803a04:	6a 00                	push   $0x0
+  803a06:	68 00 f0 7f 00       	push   $0x7ff000
+  803a0b:	6a 00                	push   $0x0
+  803a0d:	e8 1b d6 ff ff       	call   80102d <sys_page_map>
+  803a12:	83 c4 20             	add    $0x20,%esp
+  803a15:	85 c0                	test   %eax,%eax
+  803a17:	78 30                	js     803a49 <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  803a19:	83 ec 08             	sub    $0x8,%esp
+  803a1c:	68 00 f0 7f 00       	push   $0x7ff000
+  803a21:	6a 00                	push   $0x0
+  803a23:	e8 47 d6 ff ff       	call   80106f <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  803a28:	83 c4 10             	add    $0x10,%esp
+  803a2b:	85 c0                	test   %eax,%eax
+  803a2d:	78 1a                	js     803a49 <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  803a2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a32:	5b                   	pop    %ebx
+  803a33:	5e                   	pop    %esi
+  803a34:	5f                   	pop    %edi
+  803a35:	5d                   	pop    %ebp
+  803a36:	c3                   	ret
+    panic("mmap: %e", r);
+  803a37:	50                   	push   %eax
+  803a38:	68 27 4b 80 00       	push   $0x804b27
+  803a3d:	6a 3e                	push   $0x3e
+  803a3f:	68 30 4b 80 00       	push   $0x804b30
+  803a44:	e8 a9 ca ff ff       	call   8004f2 <_panic>
+    panic("mmap: %e", r);
+  803a49:	50                   	push   %eax
+  803a4a:	68 27 4b 80 00       	push   $0x804b27
+  803a4f:	6a 42                	push   $0x42
+  803a51:	68 30 4b 80 00       	push   $0x804b30
+  803a56:	e8 97 ca ff ff       	call   8004f2 <_panic>
+
+00803a5b <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  803a5b:	55                   	push   %ebp
+  803a5c:	89 e5                	mov    %esp,%ebp
+  803a5e:	57                   	push   %edi
+  803a5f:	56                   	push   %esi
+  803a60:	53                   	push   %ebx
+  803a61:	83 ec 1c             	sub    $0x1c,%esp
+  803a64:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  803a67:	8b 1f                	mov    (%edi),%ebx
+  803a69:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  803a6f:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  803a75:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  803a7a:	0f 87 24 01 00 00    	ja     803ba4 <mmap_fault+0x149>
+  803a80:	89 d8                	mov    %ebx,%eax
+  803a82:	e8 db fe ff ff       	call   803962 <mmap_find>
+  803a87:	89 c6                	mov    %eax,%esi
+  803a89:	85 c0                	test   %eax,%eax
+  803a8b:	0f 84 20 01 00 00    	je     803bb1 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  803a91:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803a95:	74 13                	je     803aaa <mmap_fault+0x4f>
+  803a97:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  803a9b:	0f 84 17 01 00 00    	je     803bb8 <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  803aa1:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  803aa8:	eb 0f                	jmp    803ab9 <mmap_fault+0x5e>
+  803aaa:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  803aae:	19 c0                	sbb    %eax,%eax
+  803ab0:	83 e0 fe             	and    $0xfffffffe,%eax
+  803ab3:	83 c0 07             	add    $0x7,%eax
+  803ab6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  803ab9:	89 d8                	mov    %ebx,%eax
+  803abb:	e8 e4 fe ff ff       	call   8039a4 <va_mapped>
+  803ac0:	84 c0                	test   %al,%al
+  803ac2:	74 42                	je     803b06 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  803ac4:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803ac9:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803acd:	0f 84 d6 00 00 00    	je     803ba9 <mmap_fault+0x14e>
+  803ad3:	89 d8                	mov    %ebx,%eax
+  803ad5:	c1 e8 0c             	shr    $0xc,%eax
+  803ad8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  803adf:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803ae4:	f6 c2 02             	test   $0x2,%dl
+  803ae7:	0f 85 bc 00 00 00    	jne    803ba9 <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  803aed:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803af0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803af5:	89 d8                	mov    %ebx,%eax
+  803af7:	e8 d1 fe ff ff       	call   8039cd <mmap_copy>
+  return 1;
+  803afc:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b01:	e9 a3 00 00 00       	jmp    803ba9 <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  803b06:	a1 00 70 80 00       	mov    0x807000,%eax
+  803b0b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803b0e:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  803b14:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  803b17:	83 ec 04             	sub    $0x4,%esp
+  803b1a:	53                   	push   %ebx
+  803b1b:	89 d8                	mov    %ebx,%eax
+  803b1d:	03 46 0c             	add    0xc(%esi),%eax
+  803b20:	2b 06                	sub    (%esi),%eax
+  803b22:	50                   	push   %eax
+  803b23:	ff 76 08             	push   0x8(%esi)
+  803b26:	e8 8e eb ff ff       	call   8026b9 <read_map>
+    fsipcbuf.read_map = saved;
+  803b2b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803b2e:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+  803b34:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  803b37:	89 15 04 70 80 00    	mov    %edx,0x807004
+    if (r < 0)
+  803b3d:	83 c4 10             	add    $0x10,%esp
+  803b40:	85 c0                	test   %eax,%eax
+  803b42:	78 20                	js     803b64 <mmap_fault+0x109>
+    if (r == 0) {
+  803b44:	74 30                	je     803b76 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  803b46:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803b4b:	0f 8f 73 ff ff ff    	jg     803ac4 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  803b51:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803b54:	89 c2                	mov    %eax,%edx
+  803b56:	89 d8                	mov    %ebx,%eax
+  803b58:	e8 70 fe ff ff       	call   8039cd <mmap_copy>
+      return 1;
+  803b5d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b62:	eb 45                	jmp    803ba9 <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  803b64:	50                   	push   %eax
+  803b65:	68 3b 4b 80 00       	push   $0x804b3b
+  803b6a:	6a 5f                	push   $0x5f
+  803b6c:	68 30 4b 80 00       	push   $0x804b30
+  803b71:	e8 7c c9 ff ff       	call   8004f2 <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  803b76:	83 ec 04             	sub    $0x4,%esp
+  803b79:	ff 75 e4             	push   -0x1c(%ebp)
+  803b7c:	53                   	push   %ebx
+  803b7d:	6a 00                	push   $0x0
+  803b7f:	e8 66 d4 ff ff       	call   800fea <sys_page_alloc>
+  803b84:	83 c4 10             	add    $0x10,%esp
+  803b87:	85 c0                	test   %eax,%eax
+  803b89:	78 07                	js     803b92 <mmap_fault+0x137>
+      return 1;
+  803b8b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b90:	eb 17                	jmp    803ba9 <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  803b92:	50                   	push   %eax
+  803b93:	68 27 4b 80 00       	push   $0x804b27
+  803b98:	6a 64                	push   $0x64
+  803b9a:	68 30 4b 80 00       	push   $0x804b30
+  803b9f:	e8 4e c9 ff ff       	call   8004f2 <_panic>
+    return 0;
+  803ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ba9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bac:	5b                   	pop    %ebx
+  803bad:	5e                   	pop    %esi
+  803bae:	5f                   	pop    %edi
+  803baf:	5d                   	pop    %ebp
+  803bb0:	c3                   	ret
+    return 0;
+  803bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb6:	eb f1                	jmp    803ba9 <mmap_fault+0x14e>
+    return 0;
+  803bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bbd:	eb ea                	jmp    803ba9 <mmap_fault+0x14e>
+
+00803bbf <mmap_pgfault>:
+{
+  803bbf:	55                   	push   %ebp
+  803bc0:	89 e5                	mov    %esp,%ebp
+  803bc2:	53                   	push   %ebx
+  803bc3:	83 ec 10             	sub    $0x10,%esp
+  803bc6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  803bc9:	53                   	push   %ebx
+  803bca:	e8 8c fe ff ff       	call   803a5b <mmap_fault>
+  803bcf:	83 c4 10             	add    $0x10,%esp
+  803bd2:	84 c0                	test   %al,%al
+  803bd4:	74 05                	je     803bdb <mmap_pgfault+0x1c>
+}
+  803bd6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803bd9:	c9                   	leave
+  803bda:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  803bdb:	83 ec 08             	sub    $0x8,%esp
+  803bde:	ff 73 04             	push   0x4(%ebx)
+  803be1:	ff 73 28             	push   0x28(%ebx)
+  803be4:	ff 33                	push   (%ebx)
+  803be6:	68 50 4b 80 00       	push   $0x804b50
+  803beb:	6a 20                	push   $0x20
+  803bed:	68 30 4b 80 00       	push   $0x804b30
+  803bf2:	e8 fb c8 ff ff       	call   8004f2 <_panic>
+
+00803bf7 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  803bf7:	55                   	push   %ebp
+  803bf8:	89 e5                	mov    %esp,%ebp
+  803bfa:	57                   	push   %edi
+  803bfb:	56                   	push   %esi
+  803bfc:	53                   	push   %ebx
+  803bfd:	83 ec 44             	sub    $0x44,%esp
+  803c00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c03:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803c06:	50                   	push   %eax
+  803c07:	ff 75 08             	push   0x8(%ebp)
+  803c0a:	e8 38 dd ff ff       	call   801947 <fd_lookup>
+  803c0f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803c12:	83 c4 10             	add    $0x10,%esp
+  803c15:	85 c0                	test   %eax,%eax
+  803c17:	0f 88 3e 01 00 00    	js     803d5b <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  803c1d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803c21:	0f 88 d1 00 00 00    	js     803cf8 <mmap+0x101>
+  803c27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803c2a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803c2f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803c32:	0f 85 c9 00 00 00    	jne    803d01 <mmap+0x10a>
+  803c38:	85 db                	test   %ebx,%ebx
+  803c3a:	0f 84 ca 00 00 00    	je     803d0a <mmap+0x113>
+  803c40:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  803c44:	0f 87 c0 00 00 00    	ja     803d0a <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  803c4a:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  803c50:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803c56:	89 d9                	mov    %ebx,%ecx
+  803c58:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  803c5b:	bb 6c 6e 80 00       	mov    $0x806e6c,%ebx
+  803c60:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803c65:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803c6a:	eb 53                	jmp    803cbf <mmap+0xc8>
+  803c6c:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803c71:	eb 4c                	jmp    803cbf <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  803c73:	83 c0 01             	add    $0x1,%eax
+  803c76:	83 f8 10             	cmp    $0x10,%eax
+  803c79:	0f 84 e7 00 00 00    	je     803d66 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  803c7f:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  803c82:	8b 14 b5 80 6e 80 00 	mov    0x806e80(,%esi,4),%edx
+  803c89:	85 d2                	test   %edx,%edx
+  803c8b:	74 e6                	je     803c73 <mmap+0x7c>
+  803c8d:	89 d1                	mov    %edx,%ecx
+  803c8f:	03 0c b5 84 6e 80 00 	add    0x806e84(,%esi,4),%ecx
+  803c96:	39 cf                	cmp    %ecx,%edi
+  803c98:	73 d9                	jae    803c73 <mmap+0x7c>
+  803c9a:	39 da                	cmp    %ebx,%edx
+  803c9c:	73 d5                	jae    803c73 <mmap+0x7c>
+  803c9e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  803ca1:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  803ca4:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  803ca7:	83 c2 01             	add    $0x1,%edx
+  803caa:	83 c3 14             	add    $0x14,%ebx
+  803cad:	83 fa 10             	cmp    $0x10,%edx
+  803cb0:	74 2b                	je     803cdd <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  803cb2:	85 d2                	test   %edx,%edx
+  803cb4:	78 b6                	js     803c6c <mmap+0x75>
+  803cb6:	8b 3b                	mov    (%ebx),%edi
+  803cb8:	85 ff                	test   %edi,%edi
+  803cba:	74 eb                	je     803ca7 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803cbc:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  803cbf:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  803cc4:	29 f8                	sub    %edi,%eax
+  803cc6:	39 c8                	cmp    %ecx,%eax
+  803cc8:	72 dd                	jb     803ca7 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  803cca:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  803ccd:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  803cd0:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  803cd3:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  803cd6:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  803cd9:	89 f3                	mov    %esi,%ebx
+  803cdb:	eb a2                	jmp    803c7f <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  803cdd:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803ce4:	eb 75                	jmp    803d5b <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  803ce6:	83 ec 0c             	sub    $0xc,%esp
+  803ce9:	68 bf 3b 80 00       	push   $0x803bbf
+  803cee:	e8 83 02 00 00       	call   803f76 <set_pgfault_handler>
+  803cf3:	83 c4 10             	add    $0x10,%esp
+  803cf6:	eb 24                	jmp    803d1c <mmap+0x125>
+    return -E_INVAL;
+  803cf8:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803cff:	eb 5a                	jmp    803d5b <mmap+0x164>
+  803d01:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803d08:	eb 51                	jmp    803d5b <mmap+0x164>
+  803d0a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803d11:	eb 48                	jmp    803d5b <mmap+0x164>
+  if (_pgfault_handler == 0)
+  803d13:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803d1a:	74 ca                	je     803ce6 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  803d1c:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803d23:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803d26:	c1 e2 02             	shl    $0x2,%edx
+  803d29:	89 ba 80 6e 80 00    	mov    %edi,0x806e80(%edx)
+  mmaps[j].mm_len = len;
+  803d2f:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  803d32:	89 b2 84 6e 80 00    	mov    %esi,0x806e84(%edx)
+  mmaps[j].mm_fd = fdnum;
+  803d38:	8b 75 08             	mov    0x8(%ebp),%esi
+  803d3b:	89 b2 88 6e 80 00    	mov    %esi,0x806e88(%edx)
+  mmaps[j].mm_offset = offset;
+  803d41:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803d44:	89 b2 8c 6e 80 00    	mov    %esi,0x806e8c(%edx)
+  mmaps[j].mm_perm = perm;
+  803d4a:	01 d8                	add    %ebx,%eax
+  803d4c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  803d4f:	89 1c 85 90 6e 80 00 	mov    %ebx,0x806e90(,%eax,4)
+  *addr = (void *) va;
+  803d56:	8b 45 18             	mov    0x18(%ebp),%eax
+  803d59:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  803d5b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803d5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d61:	5b                   	pop    %ebx
+  803d62:	5e                   	pop    %esi
+  803d63:	5f                   	pop    %edi
+  803d64:	5d                   	pop    %ebp
+  803d65:	c3                   	ret
+  if (i == NMMAP)
+  803d66:	b8 80 6e 80 00       	mov    $0x806e80,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  803d6b:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  803d6e:	83 c0 14             	add    $0x14,%eax
+  803d71:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  803d75:	74 9c                	je     803d13 <mmap+0x11c>
+  803d77:	83 c3 01             	add    $0x1,%ebx
+  803d7a:	83 fb 10             	cmp    $0x10,%ebx
+  803d7d:	75 ef                	jne    803d6e <mmap+0x177>
+    return -E_NO_MEM;
+  803d7f:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803d86:	eb d3                	jmp    803d5b <mmap+0x164>
+
+00803d88 <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  803d88:	55                   	push   %ebp
+  803d89:	89 e5                	mov    %esp,%ebp
+  803d8b:	57                   	push   %edi
+  803d8c:	56                   	push   %esi
+  803d8d:	53                   	push   %ebx
+  803d8e:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803d94:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d97:	e8 c6 fb ff ff       	call   803962 <mmap_find>
+  803d9c:	85 c0                	test   %eax,%eax
+  803d9e:	0f 84 58 01 00 00    	je     803efc <msync+0x174>
+  803da4:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  803da6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  803dab:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  803daf:	74 0a                	je     803dbb <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  803db1:	89 d8                	mov    %ebx,%eax
+  803db3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803db6:	5b                   	pop    %ebx
+  803db7:	5e                   	pop    %esi
+  803db8:	5f                   	pop    %edi
+  803db9:	5d                   	pop    %ebp
+  803dba:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  803dbb:	83 ec 08             	sub    $0x8,%esp
+  803dbe:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803dc1:	50                   	push   %eax
+  803dc2:	ff 77 08             	push   0x8(%edi)
+  803dc5:	e8 7d db ff ff       	call   801947 <fd_lookup>
+  803dca:	89 c3                	mov    %eax,%ebx
+  803dcc:	83 c4 10             	add    $0x10,%esp
+  803dcf:	85 c0                	test   %eax,%eax
+  803dd1:	78 de                	js     803db1 <msync+0x29>
+  803dd3:	83 ec 08             	sub    $0x8,%esp
+  803dd6:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  803ddc:	50                   	push   %eax
+  803ddd:	ff 77 08             	push   0x8(%edi)
+  803de0:	e8 05 e0 ff ff       	call   801dea <fstat>
+  803de5:	89 c3                	mov    %eax,%ebx
+  803de7:	83 c4 10             	add    $0x10,%esp
+  803dea:	85 c0                	test   %eax,%eax
+  803dec:	78 c3                	js     803db1 <msync+0x29>
+  saved = fd->fd_offset;
+  803dee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803df1:	8b 40 04             	mov    0x4(%eax),%eax
+  803df4:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803dfa:	8b 37                	mov    (%edi),%esi
+  803dfc:	eb 29                	jmp    803e27 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  803dfe:	83 ec 0c             	sub    $0xc,%esp
+  803e01:	6a 07                	push   $0x7
+  803e03:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  803e09:	50                   	push   %eax
+  803e0a:	6a 00                	push   $0x0
+  803e0c:	50                   	push   %eax
+  803e0d:	6a 00                	push   $0x0
+  803e0f:	e8 19 d2 ff ff       	call   80102d <sys_page_map>
+  803e14:	89 c3                	mov    %eax,%ebx
+  803e16:	83 c4 20             	add    $0x20,%esp
+  803e19:	85 c0                	test   %eax,%eax
+  803e1b:	0f 88 c0 00 00 00    	js     803ee1 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803e21:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803e27:	8b 07                	mov    (%edi),%eax
+  803e29:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  803e2f:	03 47 04             	add    0x4(%edi),%eax
+  803e32:	39 c6                	cmp    %eax,%esi
+  803e34:	0f 83 a7 00 00 00    	jae    803ee1 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  803e3a:	89 f0                	mov    %esi,%eax
+  803e3c:	e8 63 fb ff ff       	call   8039a4 <va_mapped>
+  803e41:	84 c0                	test   %al,%al
+  803e43:	74 dc                	je     803e21 <msync+0x99>
+  803e45:	89 f0                	mov    %esi,%eax
+  803e47:	c1 e8 0c             	shr    $0xc,%eax
+  803e4a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803e51:	a8 40                	test   $0x40,%al
+  803e53:	74 cc                	je     803e21 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  803e55:	8b 47 0c             	mov    0xc(%edi),%eax
+  803e58:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  803e5e:	29 c8                	sub    %ecx,%eax
+  803e60:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  803e62:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803e65:	39 c2                	cmp    %eax,%edx
+  803e67:	7e 78                	jle    803ee1 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  803e69:	29 c2                	sub    %eax,%edx
+  803e6b:	89 d1                	mov    %edx,%ecx
+  803e6d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e72:	39 d1                	cmp    %edx,%ecx
+  803e74:	0f 4e d1             	cmovle %ecx,%edx
+  803e77:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803e7d:	83 ec 08             	sub    $0x8,%esp
+  803e80:	50                   	push   %eax
+  803e81:	ff 77 08             	push   0x8(%edi)
+  803e84:	e8 b9 de ff ff       	call   801d42 <seek>
+  803e89:	89 c3                	mov    %eax,%ebx
+  803e8b:	83 c4 10             	add    $0x10,%esp
+  803e8e:	85 c0                	test   %eax,%eax
+  803e90:	78 4f                	js     803ee1 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  803e92:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  803e98:	83 ec 04             	sub    $0x4,%esp
+  803e9b:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  803ea1:	56                   	push   %esi
+  803ea2:	ff 77 08             	push   0x8(%edi)
+  803ea5:	e8 16 de ff ff       	call   801cc0 <write>
+  803eaa:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803eac:	83 c4 10             	add    $0x10,%esp
+  803eaf:	85 c0                	test   %eax,%eax
+  803eb1:	78 2e                	js     803ee1 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  803eb3:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  803eb9:	39 c2                	cmp    %eax,%edx
+  803ebb:	0f 8e 3d ff ff ff    	jle    803dfe <msync+0x76>
+  803ec1:	89 d0                	mov    %edx,%eax
+  803ec3:	29 d8                	sub    %ebx,%eax
+  803ec5:	01 f3                	add    %esi,%ebx
+  803ec7:	83 ec 04             	sub    $0x4,%esp
+  803eca:	50                   	push   %eax
+  803ecb:	53                   	push   %ebx
+  803ecc:	ff 77 08             	push   0x8(%edi)
+  803ecf:	e8 ec dd ff ff       	call   801cc0 <write>
+  803ed4:	89 c3                	mov    %eax,%ebx
+  803ed6:	83 c4 10             	add    $0x10,%esp
+  803ed9:	85 c0                	test   %eax,%eax
+  803edb:	0f 89 1d ff ff ff    	jns    803dfe <msync+0x76>
+  fd->fd_offset = saved;
+  803ee1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ee4:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  803eea:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  803eed:	85 db                	test   %ebx,%ebx
+  803eef:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef4:	0f 4f d8             	cmovg  %eax,%ebx
+  803ef7:	e9 b5 fe ff ff       	jmp    803db1 <msync+0x29>
+    return -E_INVAL;
+  803efc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  803f01:	e9 ab fe ff ff       	jmp    803db1 <msync+0x29>
+
+00803f06 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  803f06:	55                   	push   %ebp
+  803f07:	89 e5                	mov    %esp,%ebp
+  803f09:	56                   	push   %esi
+  803f0a:	53                   	push   %ebx
+  803f0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803f0e:	89 d8                	mov    %ebx,%eax
+  803f10:	e8 4d fa ff ff       	call   803962 <mmap_find>
+  803f15:	85 c0                	test   %eax,%eax
+  803f17:	74 56                	je     803f6f <munmap+0x69>
+  803f19:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  803f1b:	83 ec 0c             	sub    $0xc,%esp
+  803f1e:	53                   	push   %ebx
+  803f1f:	e8 64 fe ff ff       	call   803d88 <msync>
+  803f24:	83 c4 10             	add    $0x10,%esp
+  803f27:	85 c0                	test   %eax,%eax
+  803f29:	78 3d                	js     803f68 <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  803f2b:	8b 1e                	mov    (%esi),%ebx
+  803f2d:	eb 06                	jmp    803f35 <munmap+0x2f>
+  803f2f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803f35:	8b 46 04             	mov    0x4(%esi),%eax
+  803f38:	03 06                	add    (%esi),%eax
+  803f3a:	39 c3                	cmp    %eax,%ebx
+  803f3c:	73 1f                	jae    803f5d <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  803f3e:	89 d8                	mov    %ebx,%eax
+  803f40:	e8 5f fa ff ff       	call   8039a4 <va_mapped>
+  803f45:	84 c0                	test   %al,%al
+  803f47:	74 e6                	je     803f2f <munmap+0x29>
+  803f49:	83 ec 08             	sub    $0x8,%esp
+  803f4c:	53                   	push   %ebx
+  803f4d:	6a 00                	push   $0x0
+  803f4f:	e8 1b d1 ff ff       	call   80106f <sys_page_unmap>
+  803f54:	83 c4 10             	add    $0x10,%esp
+  803f57:	85 c0                	test   %eax,%eax
+  803f59:	79 d4                	jns    803f2f <munmap+0x29>
+  803f5b:	eb 0b                	jmp    803f68 <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  803f5d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  803f63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f6b:	5b                   	pop    %ebx
+  803f6c:	5e                   	pop    %esi
+  803f6d:	5d                   	pop    %ebp
+  803f6e:	c3                   	ret
+    return -E_INVAL;
+  803f6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f74:	eb f2                	jmp    803f68 <munmap+0x62>
+
+00803f76 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803f76:	55                   	push   %ebp
+  803f77:	89 e5                	mov    %esp,%ebp
+  803f79:	53                   	push   %ebx
+  803f7a:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  803f7d:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803f84:	74 0d                	je     803f93 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  803f86:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f89:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803f8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f91:	c9                   	leave
+  803f92:	c3                   	ret
+    envid_t id = sys_getenvid();
+  803f93:	e8 d1 cf ff ff       	call   800f69 <sys_getenvid>
+  803f98:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  803f9a:	83 ec 04             	sub    $0x4,%esp
+  803f9d:	6a 07                	push   $0x7
+  803f9f:	68 00 f0 bf ee       	push   $0xeebff000
+  803fa4:	50                   	push   %eax
+  803fa5:	e8 40 d0 ff ff       	call   800fea <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  803faa:	83 c4 08             	add    $0x8,%esp
+  803fad:	68 bd 3f 80 00       	push   $0x803fbd
+  803fb2:	53                   	push   %ebx
+  803fb3:	e8 a7 d2 ff ff       	call   80125f <sys_env_set_pgfault_upcall>
+  803fb8:	83 c4 10             	add    $0x10,%esp
+  803fbb:	eb c9                	jmp    803f86 <set_pgfault_handler+0x10>
+
+00803fbd <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803fbd:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803fbe:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  803fc3:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803fc5:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  803fc8:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  803fcc:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  803fcf:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  803fd3:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  803fd7:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  803fd9:	83 c4 08             	add    $0x8,%esp
+  popal
+  803fdc:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  803fdd:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  803fe0:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  803fe1:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  803fe2:	c3                   	ret
+
+00803fe3 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  803fe3:	55                   	push   %ebp
+  803fe4:	89 e5                	mov    %esp,%ebp
+  803fe6:	57                   	push   %edi
+  803fe7:	56                   	push   %esi
+  803fe8:	53                   	push   %ebx
+  803fe9:	83 ec 14             	sub    $0x14,%esp
+  803fec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803fef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803ff2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803ff5:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  803ff8:	85 c0                	test   %eax,%eax
+  803ffa:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803fff:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  804002:	ff 33                	push   (%ebx)
+  804004:	50                   	push   %eax
+  804005:	e8 b8 d2 ff ff       	call   8012c2 <sys_ipc_recv>
+  80400a:	83 c4 10             	add    $0x10,%esp
+  80400d:	85 c0                	test   %eax,%eax
+  80400f:	78 39                	js     80404a <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  804011:	85 ff                	test   %edi,%edi
+  804013:	74 0a                	je     80401f <ipc_recv_pages+0x3c>
+  804015:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  80401a:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80401d:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80401f:	85 f6                	test   %esi,%esi
+  804021:	74 0d                	je     804030 <ipc_recv_pages+0x4d>
+  804023:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  804028:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  80402e:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  804030:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  804035:	8b 40 74             	mov    0x74(%eax),%eax
+  804038:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  80403a:	a1 c0 6f 80 00       	mov    0x806fc0,%eax
+  80403f:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  804042:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804045:	5b                   	pop    %ebx
+  804046:	5e                   	pop    %esi
+  804047:	5f                   	pop    %edi
+  804048:	5d                   	pop    %ebp
+  804049:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  80404a:	85 ff                	test   %edi,%edi
+  80404c:	74 06                	je     804054 <ipc_recv_pages+0x71>
+  80404e:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  804054:	85 f6                	test   %esi,%esi
+  804056:	74 06                	je     80405e <ipc_recv_pages+0x7b>
+  804058:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  80405e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  804064:	eb dc                	jmp    804042 <ipc_recv_pages+0x5f>
+
+00804066 <ipc_recv>:
+{
+  804066:	55                   	push   %ebp
+  804067:	89 e5                	mov    %esp,%ebp
+  804069:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  80406c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  804073:	ff 75 10             	push   0x10(%ebp)
+  804076:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804079:	50                   	push   %eax
+  80407a:	ff 75 0c             	push   0xc(%ebp)
+  80407d:	ff 75 08             	push   0x8(%ebp)
+  804080:	e8 5e ff ff ff       	call   803fe3 <ipc_recv_pages>
+}
+  804085:	c9                   	leave
+  804086:	c3                   	ret
+
+00804087 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  804087:	55                   	push   %ebp
+  804088:	89 e5                	mov    %esp,%ebp
+  80408a:	57                   	push   %edi
+  80408b:	56                   	push   %esi
+  80408c:	53                   	push   %ebx
+  80408d:	83 ec 0c             	sub    $0xc,%esp
+  804090:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804093:	8b 75 0c             	mov    0xc(%ebp),%esi
+  804096:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  804099:	89 c3                	mov    %eax,%ebx
+  80409b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8040a1:	85 c0                	test   %eax,%eax
+  8040a3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8040a8:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  8040ab:	83 ec 0c             	sub    $0xc,%esp
+  8040ae:	ff 75 14             	push   0x14(%ebp)
+  8040b1:	ff 75 18             	push   0x18(%ebp)
+  8040b4:	53                   	push   %ebx
+  8040b5:	56                   	push   %esi
+  8040b6:	57                   	push   %edi
+  8040b7:	e8 e5 d1 ff ff       	call   8012a1 <sys_ipc_try_send>
+  8040bc:	83 c4 20             	add    $0x20,%esp
+  8040bf:	85 c0                	test   %eax,%eax
+  8040c1:	79 1e                	jns    8040e1 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  8040c3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8040c6:	75 07                	jne    8040cf <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8040c8:	e8 bb ce ff ff       	call   800f88 <sys_yield>
+  8040cd:	eb dc                	jmp    8040ab <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8040cf:	50                   	push   %eax
+  8040d0:	68 77 4b 80 00       	push   $0x804b77
+  8040d5:	6a 5c                	push   $0x5c
+  8040d7:	68 84 4b 80 00       	push   $0x804b84
+  8040dc:	e8 11 c4 ff ff       	call   8004f2 <_panic>
+  }
+}
+  8040e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040e4:	5b                   	pop    %ebx
+  8040e5:	5e                   	pop    %esi
+  8040e6:	5f                   	pop    %edi
+  8040e7:	5d                   	pop    %ebp
+  8040e8:	c3                   	ret
+
+008040e9 <ipc_send>:
+{
+  8040e9:	55                   	push   %ebp
+  8040ea:	89 e5                	mov    %esp,%ebp
+  8040ec:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  8040ef:	ff 75 14             	push   0x14(%ebp)
+  8040f2:	6a 01                	push   $0x1
+  8040f4:	ff 75 10             	push   0x10(%ebp)
+  8040f7:	ff 75 0c             	push   0xc(%ebp)
+  8040fa:	ff 75 08             	push   0x8(%ebp)
+  8040fd:	e8 85 ff ff ff       	call   804087 <ipc_send_pages>
+}
+  804102:	83 c4 20             	add    $0x20,%esp
+  804105:	c9                   	leave
+  804106:	c3                   	ret
+
+00804107 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804107:	55                   	push   %ebp
+  804108:	89 e5                	mov    %esp,%ebp
+  80410a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  80410d:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  804112:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804115:	c1 e0 04             	shl    $0x4,%eax
+  804118:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80411d:	8b 40 50             	mov    0x50(%eax),%eax
+  804120:	39 c8                	cmp    %ecx,%eax
+  804122:	74 12                	je     804136 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  804124:	83 c2 01             	add    $0x1,%edx
+  804127:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80412d:	75 e3                	jne    804112 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80412f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804134:	eb 0e                	jmp    804144 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  804136:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  804139:	c1 e0 04             	shl    $0x4,%eax
+  80413c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804141:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804144:	5d                   	pop    %ebp
+  804145:	c3                   	ret
+
+00804146 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804146:	55                   	push   %ebp
+  804147:	89 e5                	mov    %esp,%ebp
+  804149:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80414c:	89 c2                	mov    %eax,%edx
+  80414e:	c1 ea 16             	shr    $0x16,%edx
+  804151:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  804158:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80415d:	f6 c1 01             	test   $0x1,%cl
+  804160:	74 1c                	je     80417e <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  804162:	c1 e8 0c             	shr    $0xc,%eax
+  804165:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  80416c:	a8 01                	test   $0x1,%al
+  80416e:	74 0e                	je     80417e <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  804170:	c1 e8 0c             	shr    $0xc,%eax
+  804173:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80417a:	ef 
+  80417b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80417e:	89 d0                	mov    %edx,%eax
+  804180:	5d                   	pop    %ebp
+  804181:	c3                   	ret
+
+00804182 <udivmod>:
+  804182:	55                   	push   %ebp
+  804183:	57                   	push   %edi
+  804184:	56                   	push   %esi
+  804185:	53                   	push   %ebx
+  804186:	83 ec 14             	sub    $0x14,%esp
+  804189:	8b 74 24 28          	mov    0x28(%esp),%esi
+  80418d:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  804191:	89 fb                	mov    %edi,%ebx
+  804193:	09 f3                	or     %esi,%ebx
+  804195:	0f 84 88 00 00 00    	je     804223 <udivmod+0xa1>
+  80419b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8041a0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8041a7:	00 
+  8041a8:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8041af:	00 
+  8041b0:	89 cd                	mov    %ecx,%ebp
+  8041b2:	89 34 24             	mov    %esi,(%esp)
+  8041b5:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8041b9:	eb 08                	jmp    8041c3 <udivmod+0x41>
+  8041bb:	83 ed 01             	sub    $0x1,%ebp
+  8041be:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8041c1:	74 6c                	je     80422f <udivmod+0xad>
+  8041c3:	89 c3                	mov    %eax,%ebx
+  8041c5:	89 d6                	mov    %edx,%esi
+  8041c7:	89 e9                	mov    %ebp,%ecx
+  8041c9:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8041cc:	d3 ee                	shr    %cl,%esi
+  8041ce:	f6 c1 20             	test   $0x20,%cl
+  8041d1:	74 04                	je     8041d7 <udivmod+0x55>
+  8041d3:	89 f3                	mov    %esi,%ebx
+  8041d5:	31 f6                	xor    %esi,%esi
+  8041d7:	8b 3c 24             	mov    (%esp),%edi
+  8041da:	39 fb                	cmp    %edi,%ebx
+  8041dc:	89 f7                	mov    %esi,%edi
+  8041de:	8b 1c 24             	mov    (%esp),%ebx
+  8041e1:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8041e5:	19 f7                	sbb    %esi,%edi
+  8041e7:	72 d2                	jb     8041bb <udivmod+0x39>
+  8041e9:	89 f7                	mov    %esi,%edi
+  8041eb:	89 de                	mov    %ebx,%esi
+  8041ed:	89 e9                	mov    %ebp,%ecx
+  8041ef:	0f a5 f7             	shld   %cl,%esi,%edi
+  8041f2:	d3 e6                	shl    %cl,%esi
+  8041f4:	f6 c1 20             	test   $0x20,%cl
+  8041f7:	74 04                	je     8041fd <udivmod+0x7b>
+  8041f9:	89 f7                	mov    %esi,%edi
+  8041fb:	31 f6                	xor    %esi,%esi
+  8041fd:	29 f0                	sub    %esi,%eax
+  8041ff:	19 fa                	sbb    %edi,%edx
+  804201:	be 01 00 00 00       	mov    $0x1,%esi
+  804206:	bf 00 00 00 00       	mov    $0x0,%edi
+  80420b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80420e:	d3 e6                	shl    %cl,%esi
+  804210:	f6 c1 20             	test   $0x20,%cl
+  804213:	74 04                	je     804219 <udivmod+0x97>
+  804215:	89 f7                	mov    %esi,%edi
+  804217:	31 f6                	xor    %esi,%esi
+  804219:	09 74 24 08          	or     %esi,0x8(%esp)
+  80421d:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  804221:	eb 98                	jmp    8041bb <udivmod+0x39>
+  804223:	89 f0                	mov    %esi,%eax
+  804225:	89 fa                	mov    %edi,%edx
+  804227:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80422b:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  80422f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  804233:	89 01                	mov    %eax,(%ecx)
+  804235:	89 51 04             	mov    %edx,0x4(%ecx)
+  804238:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80423c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804240:	83 c4 14             	add    $0x14,%esp
+  804243:	5b                   	pop    %ebx
+  804244:	5e                   	pop    %esi
+  804245:	5f                   	pop    %edi
+  804246:	5d                   	pop    %ebp
+  804247:	c3                   	ret
+
+00804248 <__udivdi3>:
+  804248:	83 ec 18             	sub    $0x18,%esp
+  80424b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80424f:	50                   	push   %eax
+  804250:	ff 74 24 2c          	push   0x2c(%esp)
+  804254:	ff 74 24 2c          	push   0x2c(%esp)
+  804258:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80425c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804260:	e8 1d ff ff ff       	call   804182 <udivmod>
+  804265:	83 c4 24             	add    $0x24,%esp
+  804268:	c3                   	ret
+
+00804269 <__umoddi3>:
+  804269:	83 ec 18             	sub    $0x18,%esp
+  80426c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804270:	50                   	push   %eax
+  804271:	ff 74 24 2c          	push   0x2c(%esp)
+  804275:	ff 74 24 2c          	push   0x2c(%esp)
+  804279:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80427d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804281:	e8 fc fe ff ff       	call   804182 <udivmod>
+  804286:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80428a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80428e:	83 c4 24             	add    $0x24,%esp
+  804291:	c3                   	ret
+
+00804292 <__divdi3>:
+  804292:	56                   	push   %esi
+  804293:	53                   	push   %ebx
+  804294:	83 ec 14             	sub    $0x14,%esp
+  804297:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80429b:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80429f:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8042a3:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8042a7:	85 d2                	test   %edx,%edx
+  8042a9:	78 18                	js     8042c3 <__divdi3+0x31>
+  8042ab:	85 db                	test   %ebx,%ebx
+  8042ad:	78 3e                	js     8042ed <__divdi3+0x5b>
+  8042af:	83 ec 04             	sub    $0x4,%esp
+  8042b2:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8042b6:	56                   	push   %esi
+  8042b7:	53                   	push   %ebx
+  8042b8:	51                   	push   %ecx
+  8042b9:	e8 c4 fe ff ff       	call   804182 <udivmod>
+  8042be:	83 c4 10             	add    $0x10,%esp
+  8042c1:	eb 24                	jmp    8042e7 <__divdi3+0x55>
+  8042c3:	f7 d8                	neg    %eax
+  8042c5:	83 d2 00             	adc    $0x0,%edx
+  8042c8:	f7 da                	neg    %edx
+  8042ca:	85 db                	test   %ebx,%ebx
+  8042cc:	78 3a                	js     804308 <__divdi3+0x76>
+  8042ce:	83 ec 04             	sub    $0x4,%esp
+  8042d1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8042d5:	56                   	push   %esi
+  8042d6:	53                   	push   %ebx
+  8042d7:	51                   	push   %ecx
+  8042d8:	e8 a5 fe ff ff       	call   804182 <udivmod>
+  8042dd:	83 c4 10             	add    $0x10,%esp
+  8042e0:	f7 d8                	neg    %eax
+  8042e2:	83 d2 00             	adc    $0x0,%edx
+  8042e5:	f7 da                	neg    %edx
+  8042e7:	83 c4 14             	add    $0x14,%esp
+  8042ea:	5b                   	pop    %ebx
+  8042eb:	5e                   	pop    %esi
+  8042ec:	c3                   	ret
+  8042ed:	83 ec 04             	sub    $0x4,%esp
+  8042f0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8042f4:	56                   	push   %esi
+  8042f5:	f7 d9                	neg    %ecx
+  8042f7:	83 d3 00             	adc    $0x0,%ebx
+  8042fa:	f7 db                	neg    %ebx
+  8042fc:	53                   	push   %ebx
+  8042fd:	51                   	push   %ecx
+  8042fe:	e8 7f fe ff ff       	call   804182 <udivmod>
+  804303:	83 c4 10             	add    $0x10,%esp
+  804306:	eb d8                	jmp    8042e0 <__divdi3+0x4e>
+  804308:	83 ec 04             	sub    $0x4,%esp
+  80430b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80430f:	56                   	push   %esi
+  804310:	f7 d9                	neg    %ecx
+  804312:	83 d3 00             	adc    $0x0,%ebx
+  804315:	f7 db                	neg    %ebx
+  804317:	53                   	push   %ebx
+  804318:	51                   	push   %ecx
+  804319:	e8 64 fe ff ff       	call   804182 <udivmod>
+  80431e:	83 c4 10             	add    $0x10,%esp
+  804321:	eb c4                	jmp    8042e7 <__divdi3+0x55>
+
+00804323 <__moddi3>:
+  804323:	55                   	push   %ebp
+  804324:	57                   	push   %edi
+  804325:	56                   	push   %esi
+  804326:	53                   	push   %ebx
+  804327:	83 ec 24             	sub    $0x24,%esp
+  80432a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80432e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804332:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804336:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80433a:	85 d2                	test   %edx,%edx
+  80433c:	78 3b                	js     804379 <__moddi3+0x56>
+  80433e:	83 ec 04             	sub    $0x4,%esp
+  804341:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804345:	56                   	push   %esi
+  804346:	89 ce                	mov    %ecx,%esi
+  804348:	f7 de                	neg    %esi
+  80434a:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80434e:	89 de                	mov    %ebx,%esi
+  804350:	83 d6 00             	adc    $0x0,%esi
+  804353:	f7 de                	neg    %esi
+  804355:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804359:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80435d:	0f 48 f1             	cmovs  %ecx,%esi
+  804360:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804365:	53                   	push   %ebx
+  804366:	56                   	push   %esi
+  804367:	e8 16 fe ff ff       	call   804182 <udivmod>
+  80436c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804370:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804374:	83 c4 10             	add    $0x10,%esp
+  804377:	eb 47                	jmp    8043c0 <__moddi3+0x9d>
+  804379:	f7 d8                	neg    %eax
+  80437b:	83 d2 00             	adc    $0x0,%edx
+  80437e:	f7 da                	neg    %edx
+  804380:	83 ec 04             	sub    $0x4,%esp
+  804383:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804387:	56                   	push   %esi
+  804388:	89 cf                	mov    %ecx,%edi
+  80438a:	f7 df                	neg    %edi
+  80438c:	89 de                	mov    %ebx,%esi
+  80438e:	83 d6 00             	adc    $0x0,%esi
+  804391:	f7 de                	neg    %esi
+  804393:	0f 49 cf             	cmovns %edi,%ecx
+  804396:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80439a:	0f 49 de             	cmovns %esi,%ebx
+  80439d:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8043a1:	ff 74 24 0c          	push   0xc(%esp)
+  8043a5:	ff 74 24 0c          	push   0xc(%esp)
+  8043a9:	e8 d4 fd ff ff       	call   804182 <udivmod>
+  8043ae:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8043b2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8043b6:	f7 d8                	neg    %eax
+  8043b8:	83 d2 00             	adc    $0x0,%edx
+  8043bb:	f7 da                	neg    %edx
+  8043bd:	83 c4 10             	add    $0x10,%esp
+  8043c0:	83 c4 24             	add    $0x24,%esp
+  8043c3:	5b                   	pop    %ebx
+  8043c4:	5e                   	pop    %esi
+  8043c5:	5f                   	pop    %edi
+  8043c6:	5d                   	pop    %ebp
+  8043c7:	c3                   	ret
@@ -0,0 +1,6759 @@
+
+obj/user/tinybench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 10 04 00 00       	call   800441 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <getstats>:
+
+static char buf[BLKSIZE];
+
+static void
+getstats(struct Fsret_stats *st)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  int r;
+
+  if ((r = fs_stats(0, st)) < 0)
+  800039:	50                   	push   %eax
+  80003a:	6a 00                	push   $0x0
+  80003c:	e8 63 22 00 00       	call   8022a4 <fs_stats>
+  800041:	83 c4 10             	add    $0x10,%esp
+  800044:	85 c0                	test   %eax,%eax
+  800046:	78 02                	js     80004a <getstats+0x17>
+    panic("fs_stats: %e", r);
+}
+  800048:	c9                   	leave
+  800049:	c3                   	ret
+    panic("fs_stats: %e", r);
+  80004a:	50                   	push   %eax
+  80004b:	68 60 32 80 00       	push   $0x803260
+  800050:	6a 17                	push   $0x17
+  800052:	68 6d 32 80 00       	push   $0x80326d
+  800057:	e8 52 04 00 00       	call   8004ae <_panic>
+
+0080005c <readall>:
+
+// Open, read and close each file of the set from a cold cache, with
+// open_read or, if 'paged', open and read().
+static void
+readall(const char *prefix, int nfiles, size_t size, bool paged)
+{
+  80005c:	55                   	push   %ebp
+  80005d:	89 e5                	mov    %esp,%ebp
+  80005f:	57                   	push   %edi
+  800060:	56                   	push   %esi
+  800061:	53                   	push   %ebx
+  800062:	81 ec 6c 01 00 00    	sub    $0x16c,%esp
+  800068:	89 85 9c fe ff ff    	mov    %eax,-0x164(%ebp)
+  80006e:	89 95 a0 fe ff ff    	mov    %edx,-0x160(%ebp)
+  800074:	89 8d a4 fe ff ff    	mov    %ecx,-0x15c(%ebp)
+  80007a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80007d:	89 85 90 fe ff ff    	mov    %eax,-0x170(%ebp)
+  800083:	88 85 9b fe ff ff    	mov    %al,-0x165(%ebp)
+  char path[MAXNAMELEN];
+  unsigned start, ms;
+  ssize_t nread;
+  int i, fd, r;
+
+  if ((r = fs_dropcache()) < 0)
+  800089:	e8 62 22 00 00       	call   8022f0 <fs_dropcache>
+  80008e:	85 c0                	test   %eax,%eax
+  800090:	78 20                	js     8000b2 <readall+0x56>
+    panic("fs_dropcache: %e", r);
+  getstats(&before);
+  800092:	8d 45 90             	lea    -0x70(%ebp),%eax
+  800095:	e8 99 ff ff ff       	call   800033 <getstats>
+  start = sys_time_msec();
+  80009a:	e8 21 12 00 00       	call   8012c0 <sys_time_msec>
+  80009f:	89 85 94 fe ff ff    	mov    %eax,-0x16c(%ebp)
+  for (i = 0; i < nfiles; i++) {
+  8000a5:	be 00 00 00 00       	mov    $0x0,%esi
+    snprintf(path, sizeof(path), "%s%d", prefix, i);
+  8000aa:	8d bd b8 fe ff ff    	lea    -0x148(%ebp),%edi
+  for (i = 0; i < nfiles; i++) {
+  8000b0:	eb 79                	jmp    80012b <readall+0xcf>
+    panic("fs_dropcache: %e", r);
+  8000b2:	50                   	push   %eax
+  8000b3:	68 92 32 80 00       	push   $0x803292
+  8000b8:	6a 26                	push   $0x26
+  8000ba:	68 6d 32 80 00       	push   $0x80326d
+  8000bf:	e8 ea 03 00 00       	call   8004ae <_panic>
+    if (paged) {
+      if ((fd = open(path, O_RDONLY)) < 0)
+        panic("open %s: %e", path, fd);
+  8000c4:	83 ec 0c             	sub    $0xc,%esp
+  8000c7:	50                   	push   %eax
+  8000c8:	8d 85 b8 fe ff ff    	lea    -0x148(%ebp),%eax
+  8000ce:	50                   	push   %eax
+  8000cf:	68 a8 32 80 00       	push   $0x8032a8
+  8000d4:	6a 2d                	push   $0x2d
+  8000d6:	68 6d 32 80 00       	push   $0x80326d
+  8000db:	e8 ce 03 00 00       	call   8004ae <_panic>
+      if ((nread = read(fd, buf, sizeof(buf))) != size)
+        panic("read %s: %e", path, nread);
+    } else if ((fd = open_read(path, O_RDONLY, buf, size, &nread)) < 0 ||
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  8000e3:	8d 85 b4 fe ff ff    	lea    -0x14c(%ebp),%eax
+  8000e9:	50                   	push   %eax
+  8000ea:	ff b5 a4 fe ff ff    	push   -0x15c(%ebp)
+  8000f0:	68 00 50 80 00       	push   $0x805000
+  8000f5:	6a 00                	push   $0x0
+  8000f7:	57                   	push   %edi
+  8000f8:	e8 36 1f 00 00       	call   802033 <open_read>
+  8000fd:	89 c3                	mov    %eax,%ebx
+  8000ff:	83 c4 20             	add    $0x20,%esp
+  800102:	85 c0                	test   %eax,%eax
+  800104:	0f 88 b3 00 00 00    	js     8001bd <readall+0x161>
+  80010a:	8b 85 a4 fe ff ff    	mov    -0x15c(%ebp),%eax
+  800110:	39 85 b4 fe ff ff    	cmp    %eax,-0x14c(%ebp)
+  800116:	0f 85 a1 00 00 00    	jne    8001bd <readall+0x161>
+               nread != size)
+      panic("open_read %s: %e", path, fd);
+    close(fd);
+  80011c:	83 ec 0c             	sub    $0xc,%esp
+  80011f:	53                   	push   %ebx
+  800120:	e8 cd 14 00 00       	call   8015f2 <close>
+  for (i = 0; i < nfiles; i++) {
+  800125:	83 c6 01             	add    $0x1,%esi
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	8b 85 a0 fe ff ff    	mov    -0x160(%ebp),%eax
+  800131:	39 c6                	cmp    %eax,%esi
+  800133:	0f 8d a0 00 00 00    	jge    8001d9 <readall+0x17d>
+    snprintf(path, sizeof(path), "%s%d", prefix, i);
+  800139:	83 ec 0c             	sub    $0xc,%esp
+  80013c:	56                   	push   %esi
+  80013d:	ff b5 9c fe ff ff    	push   -0x164(%ebp)
+  800143:	68 a3 32 80 00       	push   $0x8032a3
+  800148:	68 80 00 00 00       	push   $0x80
+  80014d:	57                   	push   %edi
+  80014e:	e8 cf 09 00 00       	call   800b22 <snprintf>
+    if (paged) {
+  800153:	83 c4 20             	add    $0x20,%esp
+  800156:	80 bd 9b fe ff ff 00 	cmpb   $0x0,-0x165(%ebp)
+  80015d:	74 81                	je     8000e0 <readall+0x84>
+      if ((fd = open(path, O_RDONLY)) < 0)
+  80015f:	83 ec 08             	sub    $0x8,%esp
+  800162:	6a 00                	push   $0x0
+  800164:	57                   	push   %edi
+  800165:	e8 3b 1e 00 00       	call   801fa5 <open>
+  80016a:	89 c3                	mov    %eax,%ebx
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	85 c0                	test   %eax,%eax
+  800171:	0f 88 4d ff ff ff    	js     8000c4 <readall+0x68>
+      if ((nread = read(fd, buf, sizeof(buf))) != size)
+  800177:	83 ec 04             	sub    $0x4,%esp
+  80017a:	68 00 10 00 00       	push   $0x1000
+  80017f:	68 00 50 80 00       	push   $0x805000
+  800184:	50                   	push   %eax
+  800185:	e8 f0 15 00 00       	call   80177a <read>
+  80018a:	89 85 b4 fe ff ff    	mov    %eax,-0x14c(%ebp)
+  800190:	83 c4 10             	add    $0x10,%esp
+  800193:	8b 95 a4 fe ff ff    	mov    -0x15c(%ebp),%edx
+  800199:	39 d0                	cmp    %edx,%eax
+  80019b:	0f 84 7b ff ff ff    	je     80011c <readall+0xc0>
+        panic("read %s: %e", path, nread);
+  8001a1:	83 ec 0c             	sub    $0xc,%esp
+  8001a4:	50                   	push   %eax
+  8001a5:	8d 85 b8 fe ff ff    	lea    -0x148(%ebp),%eax
+  8001ab:	50                   	push   %eax
+  8001ac:	68 b9 32 80 00       	push   $0x8032b9
+  8001b1:	6a 2f                	push   $0x2f
+  8001b3:	68 6d 32 80 00       	push   $0x80326d
+  8001b8:	e8 f1 02 00 00       	call   8004ae <_panic>
+      panic("open_read %s: %e", path, fd);
+  8001bd:	83 ec 0c             	sub    $0xc,%esp
+  8001c0:	53                   	push   %ebx
+  8001c1:	8d 85 b8 fe ff ff    	lea    -0x148(%ebp),%eax
+  8001c7:	50                   	push   %eax
+  8001c8:	68 b4 32 80 00       	push   $0x8032b4
+  8001cd:	6a 32                	push   $0x32
+  8001cf:	68 6d 32 80 00       	push   $0x80326d
+  8001d4:	e8 d5 02 00 00       	call   8004ae <_panic>
+  }
+  ms = sys_time_msec() - start;
+  8001d9:	e8 e2 10 00 00       	call   8012c0 <sys_time_msec>
+  8001de:	8b 8d 94 fe ff ff    	mov    -0x16c(%ebp),%ecx
+  8001e4:	29 c8                	sub    %ecx,%eax
+  8001e6:	89 c3                	mov    %eax,%ebx
+  getstats(&after);
+  8001e8:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+  8001ee:	e8 40 fe ff ff       	call   800033 <getstats>
+  cprintf("tinybench: %s cold: %5d us/file, %4d blocks read\n",
+          paged ? "read()   " : "open_read", ms * 1000 / nfiles,
+          after.ret_bc_misses + after.ret_bc_readahead -
+  8001f3:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  8001f9:	03 8d 44 ff ff ff    	add    -0xbc(%ebp),%ecx
+  8001ff:	2b 4d 9c             	sub    -0x64(%ebp),%ecx
+  cprintf("tinybench: %s cold: %5d us/file, %4d blocks read\n",
+  800202:	2b 4d a4             	sub    -0x5c(%ebp),%ecx
+          paged ? "read()   " : "open_read", ms * 1000 / nfiles,
+  800205:	69 c3 e8 03 00 00    	imul   $0x3e8,%ebx,%eax
+  cprintf("tinybench: %s cold: %5d us/file, %4d blocks read\n",
+  80020b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800210:	f7 b5 a0 fe ff ff    	divl   -0x160(%ebp)
+  800216:	80 bd 90 fe ff ff 00 	cmpb   $0x0,-0x170(%ebp)
+  80021d:	ba 88 32 80 00       	mov    $0x803288,%edx
+  800222:	bb 7e 32 80 00       	mov    $0x80327e,%ebx
+  800227:	0f 45 d3             	cmovne %ebx,%edx
+  80022a:	51                   	push   %ecx
+  80022b:	50                   	push   %eax
+  80022c:	52                   	push   %edx
+  80022d:	68 f8 32 80 00       	push   $0x8032f8
+  800232:	e8 52 03 00 00       	call   800589 <cprintf>
+          before.ret_bc_misses - before.ret_bc_readahead);
+}
+  800237:	83 c4 10             	add    $0x10,%esp
+  80023a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80023d:	5b                   	pop    %ebx
+  80023e:	5e                   	pop    %esi
+  80023f:	5f                   	pop    %edi
+  800240:	5d                   	pop    %ebp
+  800241:	c3                   	ret
+
+00800242 <run>:
+
+static void
+run(const char *prefix, int nfiles, size_t size)
+{
+  800242:	55                   	push   %ebp
+  800243:	89 e5                	mov    %esp,%ebp
+  800245:	57                   	push   %edi
+  800246:	56                   	push   %esi
+  800247:	53                   	push   %ebx
+  800248:	81 ec 4c 01 00 00    	sub    $0x14c,%esp
+  80024e:	89 85 b0 fe ff ff    	mov    %eax,-0x150(%ebp)
+  800254:	89 95 b4 fe ff ff    	mov    %edx,-0x14c(%ebp)
+  80025a:	89 cf                	mov    %ecx,%edi
+  struct Fsret_stats before, after;
+  char path[MAXNAMELEN];
+  int i, fd, r;
+
+  getstats(&before);
+  80025c:	8d 45 90             	lea    -0x70(%ebp),%eax
+  80025f:	e8 cf fd ff ff       	call   800033 <getstats>
+  for (i = 0; i < nfiles; i++) {
+  800264:	be 00 00 00 00       	mov    $0x0,%esi
+  800269:	8b 85 b4 fe ff ff    	mov    -0x14c(%ebp),%eax
+  80026f:	39 c6                	cmp    %eax,%esi
+  800271:	0f 8d 9c 00 00 00    	jge    800313 <run+0xd1>
+    snprintf(path, sizeof(path), "%s%d", prefix, i);
+  800277:	83 ec 0c             	sub    $0xc,%esp
+  80027a:	56                   	push   %esi
+  80027b:	ff b5 b0 fe ff ff    	push   -0x150(%ebp)
+  800281:	68 a3 32 80 00       	push   $0x8032a3
+  800286:	68 80 00 00 00       	push   $0x80
+  80028b:	8d 85 b8 fe ff ff    	lea    -0x148(%ebp),%eax
+  800291:	50                   	push   %eax
+  800292:	e8 8b 08 00 00       	call   800b22 <snprintf>
+    if ((fd = open(path, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  800297:	83 c4 18             	add    $0x18,%esp
+  80029a:	68 02 03 00 00       	push   $0x302
+  80029f:	8d 85 b8 fe ff ff    	lea    -0x148(%ebp),%eax
+  8002a5:	50                   	push   %eax
+  8002a6:	e8 fa 1c 00 00       	call   801fa5 <open>
+  8002ab:	89 c3                	mov    %eax,%ebx
+  8002ad:	83 c4 10             	add    $0x10,%esp
+  8002b0:	85 c0                	test   %eax,%eax
+  8002b2:	78 27                	js     8002db <run+0x99>
+      panic("open %s: %e", path, fd);
+    if ((r = write(fd, buf, size)) != size)
+  8002b4:	83 ec 04             	sub    $0x4,%esp
+  8002b7:	57                   	push   %edi
+  8002b8:	68 00 50 80 00       	push   $0x805000
+  8002bd:	50                   	push   %eax
+  8002be:	e8 85 15 00 00       	call   801848 <write>
+  8002c3:	83 c4 10             	add    $0x10,%esp
+  8002c6:	39 f8                	cmp    %edi,%eax
+  8002c8:	75 2d                	jne    8002f7 <run+0xb5>
+      panic("write %s: %e", path, r);
+    close(fd);
+  8002ca:	83 ec 0c             	sub    $0xc,%esp
+  8002cd:	53                   	push   %ebx
+  8002ce:	e8 1f 13 00 00       	call   8015f2 <close>
+  for (i = 0; i < nfiles; i++) {
+  8002d3:	83 c6 01             	add    $0x1,%esi
+  8002d6:	83 c4 10             	add    $0x10,%esp
+  8002d9:	eb 8e                	jmp    800269 <run+0x27>
+      panic("open %s: %e", path, fd);
+  8002db:	83 ec 0c             	sub    $0xc,%esp
+  8002de:	50                   	push   %eax
+  8002df:	8d 85 b8 fe ff ff    	lea    -0x148(%ebp),%eax
+  8002e5:	50                   	push   %eax
+  8002e6:	68 a8 32 80 00       	push   $0x8032a8
+  8002eb:	6a 48                	push   $0x48
+  8002ed:	68 6d 32 80 00       	push   $0x80326d
+  8002f2:	e8 b7 01 00 00       	call   8004ae <_panic>
+      panic("write %s: %e", path, r);
+  8002f7:	83 ec 0c             	sub    $0xc,%esp
+  8002fa:	50                   	push   %eax
+  8002fb:	8d 85 b8 fe ff ff    	lea    -0x148(%ebp),%eax
+  800301:	50                   	push   %eax
+  800302:	68 c5 32 80 00       	push   $0x8032c5
+  800307:	6a 4a                	push   $0x4a
+  800309:	68 6d 32 80 00       	push   $0x80326d
+  80030e:	e8 9b 01 00 00       	call   8004ae <_panic>
+  }
+  if ((r = sync()) < 0)
+  800313:	e8 75 1f 00 00       	call   80228d <sync>
+  800318:	85 c0                	test   %eax,%eax
+  80031a:	0f 88 8a 00 00 00    	js     8003aa <run+0x168>
+    panic("sync: %e", r);
+  getstats(&after);
+  800320:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+  800326:	e8 08 fd ff ff       	call   800033 <getstats>
+  cprintf("tinybench: %d files of %3d bytes: %4d disk blocks\n", nfiles,
+  80032b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80032e:	2b 85 7c ff ff ff    	sub    -0x84(%ebp),%eax
+  800334:	50                   	push   %eax
+  800335:	57                   	push   %edi
+  800336:	8b b5 b4 fe ff ff    	mov    -0x14c(%ebp),%esi
+  80033c:	56                   	push   %esi
+  80033d:	68 2c 33 80 00       	push   $0x80332c
+  800342:	e8 42 02 00 00       	call   800589 <cprintf>
+          size, before.ret_fs_nfree - after.ret_fs_nfree);
+
+  readall(prefix, nfiles, size, 0);
+  800347:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80034e:	89 f9                	mov    %edi,%ecx
+  800350:	89 f2                	mov    %esi,%edx
+  800352:	8b 9d b0 fe ff ff    	mov    -0x150(%ebp),%ebx
+  800358:	89 d8                	mov    %ebx,%eax
+  80035a:	e8 fd fc ff ff       	call   80005c <readall>
+  readall(prefix, nfiles, size, 1);
+  80035f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800366:	89 f9                	mov    %edi,%ecx
+  800368:	89 f2                	mov    %esi,%edx
+  80036a:	89 d8                	mov    %ebx,%eax
+  80036c:	e8 eb fc ff ff       	call   80005c <readall>
+  if ((r = sync()) < 0)
+  800371:	e8 17 1f 00 00       	call   80228d <sync>
+  800376:	83 c4 10             	add    $0x10,%esp
+  800379:	85 c0                	test   %eax,%eax
+  80037b:	78 3f                	js     8003bc <run+0x17a>
+    panic("sync: %e", r);
+  getstats(&after);
+  80037d:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+  800383:	e8 ab fc ff ff       	call   800033 <getstats>
+  cprintf("tinybench: after reading them:       %4d disk blocks\n",
+  800388:	83 ec 08             	sub    $0x8,%esp
+  80038b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80038e:	2b 85 7c ff ff ff    	sub    -0x84(%ebp),%eax
+  800394:	50                   	push   %eax
+  800395:	68 60 33 80 00       	push   $0x803360
+  80039a:	e8 ea 01 00 00       	call   800589 <cprintf>
+          before.ret_fs_nfree - after.ret_fs_nfree);
+}
+  80039f:	83 c4 10             	add    $0x10,%esp
+  8003a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a5:	5b                   	pop    %ebx
+  8003a6:	5e                   	pop    %esi
+  8003a7:	5f                   	pop    %edi
+  8003a8:	5d                   	pop    %ebp
+  8003a9:	c3                   	ret
+    panic("sync: %e", r);
+  8003aa:	50                   	push   %eax
+  8003ab:	68 d2 32 80 00       	push   $0x8032d2
+  8003b0:	6a 4e                	push   $0x4e
+  8003b2:	68 6d 32 80 00       	push   $0x80326d
+  8003b7:	e8 f2 00 00 00       	call   8004ae <_panic>
+    panic("sync: %e", r);
+  8003bc:	50                   	push   %eax
+  8003bd:	68 d2 32 80 00       	push   $0x8032d2
+  8003c2:	6a 56                	push   $0x56
+  8003c4:	68 6d 32 80 00       	push   $0x80326d
+  8003c9:	e8 e0 00 00 00       	call   8004ae <_panic>
+
+008003ce <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8003ce:	55                   	push   %ebp
+  8003cf:	89 e5                	mov    %esp,%ebp
+  8003d1:	53                   	push   %ebx
+  8003d2:	83 ec 04             	sub    $0x4,%esp
+  int nfiles;
+
+  binaryname = "tinybench";
+  8003d5:	c7 05 00 40 80 00 db 	movl   $0x8032db,0x804000
+  8003dc:	32 80 00 
+  nfiles = 1000;
+  8003df:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  if (argc > 1)
+  8003e4:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8003e8:	7f 3e                	jg     800428 <umain+0x5a>
+    nfiles = strtol(argv[1], 0, 0);
+  memset(buf, 't', sizeof(buf));
+  8003ea:	83 ec 04             	sub    $0x4,%esp
+  8003ed:	68 00 10 00 00       	push   $0x1000
+  8003f2:	6a 74                	push   $0x74
+  8003f4:	68 00 50 80 00       	push   $0x805000
+  8003f9:	e8 ca 08 00 00       	call   800cc8 <memset>
+
+  run("/tiny.i", nfiles, NINLINE);
+  8003fe:	b9 74 00 00 00       	mov    $0x74,%ecx
+  800403:	89 da                	mov    %ebx,%edx
+  800405:	b8 e5 32 80 00       	mov    $0x8032e5,%eax
+  80040a:	e8 33 fe ff ff       	call   800242 <run>
+  run("/tiny.b", nfiles, NINLINE + 1);
+  80040f:	b9 75 00 00 00       	mov    $0x75,%ecx
+  800414:	89 da                	mov    %ebx,%edx
+  800416:	b8 ed 32 80 00       	mov    $0x8032ed,%eax
+  80041b:	e8 22 fe ff ff       	call   800242 <run>
+}
+  800420:	83 c4 10             	add    $0x10,%esp
+  800423:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800426:	c9                   	leave
+  800427:	c3                   	ret
+    nfiles = strtol(argv[1], 0, 0);
+  800428:	83 ec 04             	sub    $0x4,%esp
+  80042b:	6a 00                	push   $0x0
+  80042d:	6a 00                	push   $0x0
+  80042f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800432:	ff 70 04             	push   0x4(%eax)
+  800435:	e8 91 09 00 00       	call   800dcb <strtol>
+  80043a:	89 c3                	mov    %eax,%ebx
+  80043c:	83 c4 10             	add    $0x10,%esp
+  80043f:	eb a9                	jmp    8003ea <umain+0x1c>
+
+00800441 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800441:	55                   	push   %ebp
+  800442:	89 e5                	mov    %esp,%ebp
+  800444:	56                   	push   %esi
+  800445:	53                   	push   %ebx
+  800446:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800449:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80044c:	c7 05 44 67 80 00 00 	movl   $0x0,0x806744
+  800453:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800456:	e8 ca 0a 00 00       	call   800f25 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80045b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800460:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800463:	c1 e0 04             	shl    $0x4,%eax
+  800466:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80046b:	a3 44 67 80 00       	mov    %eax,0x806744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800470:	85 db                	test   %ebx,%ebx
+  800472:	7e 07                	jle    80047b <libmain+0x3a>
+    binaryname = argv[0];
+  800474:	8b 06                	mov    (%esi),%eax
+  800476:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80047b:	83 ec 08             	sub    $0x8,%esp
+  80047e:	56                   	push   %esi
+  80047f:	53                   	push   %ebx
+  800480:	e8 49 ff ff ff       	call   8003ce <umain>
+
+  // exit gracefully
+  exit();
+  800485:	e8 0a 00 00 00       	call   800494 <exit>
+}
+  80048a:	83 c4 10             	add    $0x10,%esp
+  80048d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800490:	5b                   	pop    %ebx
+  800491:	5e                   	pop    %esi
+  800492:	5d                   	pop    %ebp
+  800493:	c3                   	ret
+
+00800494 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800494:	55                   	push   %ebp
+  800495:	89 e5                	mov    %esp,%ebp
+  800497:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80049a:	e8 80 11 00 00       	call   80161f <close_all>
+  sys_env_destroy(0);
+  80049f:	83 ec 0c             	sub    $0xc,%esp
+  8004a2:	6a 00                	push   $0x0
+  8004a4:	e8 3b 0a 00 00       	call   800ee4 <sys_env_destroy>
+}
+  8004a9:	83 c4 10             	add    $0x10,%esp
+  8004ac:	c9                   	leave
+  8004ad:	c3                   	ret
+
+008004ae <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8004ae:	55                   	push   %ebp
+  8004af:	89 e5                	mov    %esp,%ebp
+  8004b1:	56                   	push   %esi
+  8004b2:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8004b3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004b6:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8004bc:	e8 64 0a 00 00       	call   800f25 <sys_getenvid>
+  8004c1:	83 ec 0c             	sub    $0xc,%esp
+  8004c4:	ff 75 0c             	push   0xc(%ebp)
+  8004c7:	ff 75 08             	push   0x8(%ebp)
+  8004ca:	56                   	push   %esi
+  8004cb:	50                   	push   %eax
+  8004cc:	68 a0 33 80 00       	push   $0x8033a0
+  8004d1:	e8 b3 00 00 00       	call   800589 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8004d6:	83 c4 18             	add    $0x18,%esp
+  8004d9:	53                   	push   %ebx
+  8004da:	ff 75 10             	push   0x10(%ebp)
+  8004dd:	e8 56 00 00 00       	call   800538 <vcprintf>
+  cprintf("\n");
+  8004e2:	c7 04 24 00 38 80 00 	movl   $0x803800,(%esp)
+  8004e9:	e8 9b 00 00 00       	call   800589 <cprintf>
+  8004ee:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8004f1:	cc                   	int3
+  while (1)
+  8004f2:	eb fd                	jmp    8004f1 <_panic+0x43>
+
+008004f4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8004f4:	55                   	push   %ebp
+  8004f5:	89 e5                	mov    %esp,%ebp
+  8004f7:	53                   	push   %ebx
+  8004f8:	83 ec 04             	sub    $0x4,%esp
+  8004fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8004fe:	8b 13                	mov    (%ebx),%edx
+  800500:	8d 42 01             	lea    0x1(%edx),%eax
+  800503:	89 03                	mov    %eax,(%ebx)
+  800505:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800508:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  80050c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800511:	74 09                	je     80051c <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800513:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800517:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80051a:	c9                   	leave
+  80051b:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  80051c:	83 ec 08             	sub    $0x8,%esp
+  80051f:	68 ff 00 00 00       	push   $0xff
+  800524:	8d 43 08             	lea    0x8(%ebx),%eax
+  800527:	50                   	push   %eax
+  800528:	e8 7a 09 00 00       	call   800ea7 <sys_cputs>
+    b->idx = 0;
+  80052d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800533:	83 c4 10             	add    $0x10,%esp
+  800536:	eb db                	jmp    800513 <putch+0x1f>
+
+00800538 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800538:	55                   	push   %ebp
+  800539:	89 e5                	mov    %esp,%ebp
+  80053b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800541:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800548:	00 00 00 
+  b.cnt = 0;
+  80054b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800552:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800555:	ff 75 0c             	push   0xc(%ebp)
+  800558:	ff 75 08             	push   0x8(%ebp)
+  80055b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800561:	50                   	push   %eax
+  800562:	68 f4 04 80 00       	push   $0x8004f4
+  800567:	e8 14 01 00 00       	call   800680 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  80056c:	83 c4 08             	add    $0x8,%esp
+  80056f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800575:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80057b:	50                   	push   %eax
+  80057c:	e8 26 09 00 00       	call   800ea7 <sys_cputs>
+
+  return b.cnt;
+}
+  800581:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800587:	c9                   	leave
+  800588:	c3                   	ret
+
+00800589 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800589:	55                   	push   %ebp
+  80058a:	89 e5                	mov    %esp,%ebp
+  80058c:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80058f:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800592:	50                   	push   %eax
+  800593:	ff 75 08             	push   0x8(%ebp)
+  800596:	e8 9d ff ff ff       	call   800538 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80059b:	c9                   	leave
+  80059c:	c3                   	ret
+
+0080059d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  80059d:	55                   	push   %ebp
+  80059e:	89 e5                	mov    %esp,%ebp
+  8005a0:	57                   	push   %edi
+  8005a1:	56                   	push   %esi
+  8005a2:	53                   	push   %ebx
+  8005a3:	83 ec 1c             	sub    $0x1c,%esp
+  8005a6:	89 c7                	mov    %eax,%edi
+  8005a8:	89 d6                	mov    %edx,%esi
+  8005aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005b0:	89 d1                	mov    %edx,%ecx
+  8005b2:	89 c2                	mov    %eax,%edx
+  8005b4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ba:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005bd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8005c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8005ca:	39 c2                	cmp    %eax,%edx
+  8005cc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8005cf:	72 3e                	jb     80060f <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8005d1:	83 ec 0c             	sub    $0xc,%esp
+  8005d4:	ff 75 18             	push   0x18(%ebp)
+  8005d7:	83 eb 01             	sub    $0x1,%ebx
+  8005da:	53                   	push   %ebx
+  8005db:	50                   	push   %eax
+  8005dc:	83 ec 08             	sub    $0x8,%esp
+  8005df:	ff 75 e4             	push   -0x1c(%ebp)
+  8005e2:	ff 75 e0             	push   -0x20(%ebp)
+  8005e5:	ff 75 dc             	push   -0x24(%ebp)
+  8005e8:	ff 75 d8             	push   -0x28(%ebp)
+  8005eb:	e8 db 2a 00 00       	call   8030cb <__udivdi3>
+  8005f0:	83 c4 18             	add    $0x18,%esp
+  8005f3:	52                   	push   %edx
+  8005f4:	50                   	push   %eax
+  8005f5:	89 f2                	mov    %esi,%edx
+  8005f7:	89 f8                	mov    %edi,%eax
+  8005f9:	e8 9f ff ff ff       	call   80059d <printnum>
+  8005fe:	83 c4 20             	add    $0x20,%esp
+  800601:	eb 13                	jmp    800616 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800603:	83 ec 08             	sub    $0x8,%esp
+  800606:	56                   	push   %esi
+  800607:	ff 75 18             	push   0x18(%ebp)
+  80060a:	ff d7                	call   *%edi
+  80060c:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  80060f:	83 eb 01             	sub    $0x1,%ebx
+  800612:	85 db                	test   %ebx,%ebx
+  800614:	7f ed                	jg     800603 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800616:	83 ec 08             	sub    $0x8,%esp
+  800619:	56                   	push   %esi
+  80061a:	83 ec 04             	sub    $0x4,%esp
+  80061d:	ff 75 e4             	push   -0x1c(%ebp)
+  800620:	ff 75 e0             	push   -0x20(%ebp)
+  800623:	ff 75 dc             	push   -0x24(%ebp)
+  800626:	ff 75 d8             	push   -0x28(%ebp)
+  800629:	e8 be 2a 00 00       	call   8030ec <__umoddi3>
+  80062e:	83 c4 14             	add    $0x14,%esp
+  800631:	0f be 80 c3 33 80 00 	movsbl 0x8033c3(%eax),%eax
+  800638:	50                   	push   %eax
+  800639:	ff d7                	call   *%edi
+}
+  80063b:	83 c4 10             	add    $0x10,%esp
+  80063e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800641:	5b                   	pop    %ebx
+  800642:	5e                   	pop    %esi
+  800643:	5f                   	pop    %edi
+  800644:	5d                   	pop    %ebp
+  800645:	c3                   	ret
+
+00800646 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800646:	55                   	push   %ebp
+  800647:	89 e5                	mov    %esp,%ebp
+  800649:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80064c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800650:	8b 10                	mov    (%eax),%edx
+  800652:	3b 50 04             	cmp    0x4(%eax),%edx
+  800655:	73 0a                	jae    800661 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800657:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80065a:	89 08                	mov    %ecx,(%eax)
+  80065c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80065f:	88 02                	mov    %al,(%edx)
+}
+  800661:	5d                   	pop    %ebp
+  800662:	c3                   	ret
+
+00800663 <printfmt>:
+{
+  800663:	55                   	push   %ebp
+  800664:	89 e5                	mov    %esp,%ebp
+  800666:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800669:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  80066c:	50                   	push   %eax
+  80066d:	ff 75 10             	push   0x10(%ebp)
+  800670:	ff 75 0c             	push   0xc(%ebp)
+  800673:	ff 75 08             	push   0x8(%ebp)
+  800676:	e8 05 00 00 00       	call   800680 <vprintfmt>
+}
+  80067b:	83 c4 10             	add    $0x10,%esp
+  80067e:	c9                   	leave
+  80067f:	c3                   	ret
+
+00800680 <vprintfmt>:
+{
+  800680:	55                   	push   %ebp
+  800681:	89 e5                	mov    %esp,%ebp
+  800683:	57                   	push   %edi
+  800684:	56                   	push   %esi
+  800685:	53                   	push   %ebx
+  800686:	83 ec 2c             	sub    $0x2c,%esp
+  800689:	8b 75 08             	mov    0x8(%ebp),%esi
+  80068c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80068f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800692:	eb 0a                	jmp    80069e <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800694:	83 ec 08             	sub    $0x8,%esp
+  800697:	53                   	push   %ebx
+  800698:	50                   	push   %eax
+  800699:	ff d6                	call   *%esi
+  80069b:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80069e:	83 c7 01             	add    $0x1,%edi
+  8006a1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8006a5:	83 f8 25             	cmp    $0x25,%eax
+  8006a8:	74 0c                	je     8006b6 <vprintfmt+0x36>
+      if (ch == '\0')
+  8006aa:	85 c0                	test   %eax,%eax
+  8006ac:	75 e6                	jne    800694 <vprintfmt+0x14>
+}
+  8006ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006b1:	5b                   	pop    %ebx
+  8006b2:	5e                   	pop    %esi
+  8006b3:	5f                   	pop    %edi
+  8006b4:	5d                   	pop    %ebp
+  8006b5:	c3                   	ret
+    padc = ' ';
+  8006b6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8006ba:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8006c1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8006c8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8006cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8006d4:	8d 47 01             	lea    0x1(%edi),%eax
+  8006d7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006da:	0f b6 17             	movzbl (%edi),%edx
+  8006dd:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8006e0:	3c 55                	cmp    $0x55,%al
+  8006e2:	0f 87 cf 03 00 00    	ja     800ab7 <vprintfmt+0x437>
+  8006e8:	0f b6 c0             	movzbl %al,%eax
+  8006eb:	ff 24 85 00 35 80 00 	jmp    *0x803500(,%eax,4)
+  8006f2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8006f5:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8006f9:	eb d9                	jmp    8006d4 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8006fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8006fe:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800702:	eb d0                	jmp    8006d4 <vprintfmt+0x54>
+  800704:	0f b6 d2             	movzbl %dl,%edx
+  800707:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  80070a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80070f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800712:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800715:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800719:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  80071c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80071f:	83 f9 09             	cmp    $0x9,%ecx
+  800722:	77 55                	ja     800779 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800724:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800727:	eb e9                	jmp    800712 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800729:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072c:	8b 00                	mov    (%eax),%eax
+  80072e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800731:	8b 45 14             	mov    0x14(%ebp),%eax
+  800734:	8d 40 04             	lea    0x4(%eax),%eax
+  800737:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80073a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  80073d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800741:	79 91                	jns    8006d4 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800743:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800746:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800749:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800750:	eb 82                	jmp    8006d4 <vprintfmt+0x54>
+      if (width < 0)
+  800752:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800755:	85 d2                	test   %edx,%edx
+  800757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075c:	0f 49 c2             	cmovns %edx,%eax
+  80075f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800762:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800765:	e9 6a ff ff ff       	jmp    8006d4 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80076a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  80076d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800774:	e9 5b ff ff ff       	jmp    8006d4 <vprintfmt+0x54>
+  800779:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80077c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80077f:	eb bc                	jmp    80073d <vprintfmt+0xbd>
+      lflag++;
+  800781:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800784:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800787:	e9 48 ff ff ff       	jmp    8006d4 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  80078c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078f:	8d 78 04             	lea    0x4(%eax),%edi
+  800792:	83 ec 08             	sub    $0x8,%esp
+  800795:	53                   	push   %ebx
+  800796:	ff 30                	push   (%eax)
+  800798:	ff d6                	call   *%esi
+      break;
+  80079a:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  80079d:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8007a0:	e9 b1 02 00 00       	jmp    800a56 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8007a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a8:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8007ab:	8b 10                	mov    (%eax),%edx
+  8007ad:	89 d0                	mov    %edx,%eax
+  8007af:	f7 d8                	neg    %eax
+  8007b1:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007b4:	83 f8 10             	cmp    $0x10,%eax
+  8007b7:	7f 23                	jg     8007dc <vprintfmt+0x15c>
+  8007b9:	8b 14 85 60 36 80 00 	mov    0x803660(,%eax,4),%edx
+  8007c0:	85 d2                	test   %edx,%edx
+  8007c2:	74 18                	je     8007dc <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8007c4:	52                   	push   %edx
+  8007c5:	68 aa 37 80 00       	push   $0x8037aa
+  8007ca:	53                   	push   %ebx
+  8007cb:	56                   	push   %esi
+  8007cc:	e8 92 fe ff ff       	call   800663 <printfmt>
+  8007d1:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8007d4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8007d7:	e9 7a 02 00 00       	jmp    800a56 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8007dc:	50                   	push   %eax
+  8007dd:	68 db 33 80 00       	push   $0x8033db
+  8007e2:	53                   	push   %ebx
+  8007e3:	56                   	push   %esi
+  8007e4:	e8 7a fe ff ff       	call   800663 <printfmt>
+  8007e9:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8007ec:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8007ef:	e9 62 02 00 00       	jmp    800a56 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8007f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f7:	83 c0 04             	add    $0x4,%eax
+  8007fa:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8007fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800800:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800802:	85 c9                	test   %ecx,%ecx
+  800804:	b8 d4 33 80 00       	mov    $0x8033d4,%eax
+  800809:	0f 45 c1             	cmovne %ecx,%eax
+  80080c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  80080f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800813:	7e 06                	jle    80081b <vprintfmt+0x19b>
+  800815:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800819:	75 0b                	jne    800826 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80081b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80081e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800821:	89 75 08             	mov    %esi,0x8(%ebp)
+  800824:	eb 5c                	jmp    800882 <vprintfmt+0x202>
+  800826:	83 ec 08             	sub    $0x8,%esp
+  800829:	ff 75 d0             	push   -0x30(%ebp)
+  80082c:	ff 75 cc             	push   -0x34(%ebp)
+  80082f:	e8 20 03 00 00       	call   800b54 <strnlen>
+  800834:	89 c2                	mov    %eax,%edx
+  800836:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800839:	29 d0                	sub    %edx,%eax
+  80083b:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80083e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800842:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800845:	89 75 08             	mov    %esi,0x8(%ebp)
+  800848:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80084a:	eb 0e                	jmp    80085a <vprintfmt+0x1da>
+          putch(padc, putdat);
+  80084c:	83 ec 08             	sub    $0x8,%esp
+  80084f:	53                   	push   %ebx
+  800850:	57                   	push   %edi
+  800851:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800854:	83 ee 01             	sub    $0x1,%esi
+  800857:	83 c4 10             	add    $0x10,%esp
+  80085a:	85 f6                	test   %esi,%esi
+  80085c:	7f ee                	jg     80084c <vprintfmt+0x1cc>
+  80085e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800861:	8b 75 08             	mov    0x8(%ebp),%esi
+  800864:	85 c0                	test   %eax,%eax
+  800866:	ba 00 00 00 00       	mov    $0x0,%edx
+  80086b:	0f 49 d0             	cmovns %eax,%edx
+  80086e:	29 d0                	sub    %edx,%eax
+  800870:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800873:	eb a6                	jmp    80081b <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800875:	83 ec 08             	sub    $0x8,%esp
+  800878:	53                   	push   %ebx
+  800879:	52                   	push   %edx
+  80087a:	ff 55 08             	call   *0x8(%ebp)
+  80087d:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800880:	89 f1                	mov    %esi,%ecx
+  800882:	8d 71 01             	lea    0x1(%ecx),%esi
+  800885:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800889:	0f be d0             	movsbl %al,%edx
+  80088c:	85 d2                	test   %edx,%edx
+  80088e:	74 28                	je     8008b8 <vprintfmt+0x238>
+  800890:	85 ff                	test   %edi,%edi
+  800892:	78 05                	js     800899 <vprintfmt+0x219>
+  800894:	83 ef 01             	sub    $0x1,%edi
+  800897:	78 30                	js     8008c9 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800899:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80089d:	74 d6                	je     800875 <vprintfmt+0x1f5>
+  80089f:	0f be c0             	movsbl %al,%eax
+  8008a2:	83 e8 20             	sub    $0x20,%eax
+  8008a5:	83 f8 5e             	cmp    $0x5e,%eax
+  8008a8:	76 cb                	jbe    800875 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8008aa:	83 ec 08             	sub    $0x8,%esp
+  8008ad:	53                   	push   %ebx
+  8008ae:	6a 3f                	push   $0x3f
+  8008b0:	ff 55 08             	call   *0x8(%ebp)
+  8008b3:	83 c4 10             	add    $0x10,%esp
+  8008b6:	eb c8                	jmp    800880 <vprintfmt+0x200>
+  8008b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008bb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008be:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008c1:	01 d0                	add    %edx,%eax
+  8008c3:	29 c8                	sub    %ecx,%eax
+  8008c5:	89 c7                	mov    %eax,%edi
+  8008c7:	eb 13                	jmp    8008dc <vprintfmt+0x25c>
+  8008c9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008cc:	eb ed                	jmp    8008bb <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8008ce:	83 ec 08             	sub    $0x8,%esp
+  8008d1:	53                   	push   %ebx
+  8008d2:	6a 20                	push   $0x20
+  8008d4:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8008d6:	83 ef 01             	sub    $0x1,%edi
+  8008d9:	83 c4 10             	add    $0x10,%esp
+  8008dc:	85 ff                	test   %edi,%edi
+  8008de:	7f ee                	jg     8008ce <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8008e0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8008e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008e6:	e9 6b 01 00 00       	jmp    800a56 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8008eb:	83 f9 01             	cmp    $0x1,%ecx
+  8008ee:	7f 1f                	jg     80090f <vprintfmt+0x28f>
+  else if (lflag)
+  8008f0:	85 c9                	test   %ecx,%ecx
+  8008f2:	74 67                	je     80095b <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8008f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f7:	8b 00                	mov    (%eax),%eax
+  8008f9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008fc:	89 c1                	mov    %eax,%ecx
+  8008fe:	c1 f9 1f             	sar    $0x1f,%ecx
+  800901:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800904:	8b 45 14             	mov    0x14(%ebp),%eax
+  800907:	8d 40 04             	lea    0x4(%eax),%eax
+  80090a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80090d:	eb 17                	jmp    800926 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  80090f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800912:	8b 50 04             	mov    0x4(%eax),%edx
+  800915:	8b 00                	mov    (%eax),%eax
+  800917:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80091a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80091d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800920:	8d 40 08             	lea    0x8(%eax),%eax
+  800923:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800926:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800929:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  80092c:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800931:	85 c9                	test   %ecx,%ecx
+  800933:	0f 89 03 01 00 00    	jns    800a3c <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800939:	83 ec 08             	sub    $0x8,%esp
+  80093c:	53                   	push   %ebx
+  80093d:	6a 2d                	push   $0x2d
+  80093f:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800941:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800944:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800947:	f7 da                	neg    %edx
+  800949:	83 d1 00             	adc    $0x0,%ecx
+  80094c:	f7 d9                	neg    %ecx
+  80094e:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800951:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800956:	e9 e1 00 00 00       	jmp    800a3c <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  80095b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095e:	8b 00                	mov    (%eax),%eax
+  800960:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800963:	89 c1                	mov    %eax,%ecx
+  800965:	c1 f9 1f             	sar    $0x1f,%ecx
+  800968:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80096b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096e:	8d 40 04             	lea    0x4(%eax),%eax
+  800971:	89 45 14             	mov    %eax,0x14(%ebp)
+  800974:	eb b0                	jmp    800926 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800976:	83 f9 01             	cmp    $0x1,%ecx
+  800979:	7f 1e                	jg     800999 <vprintfmt+0x319>
+  else if (lflag)
+  80097b:	85 c9                	test   %ecx,%ecx
+  80097d:	74 32                	je     8009b1 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80097f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800982:	8b 10                	mov    (%eax),%edx
+  800984:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800989:	8d 40 04             	lea    0x4(%eax),%eax
+  80098c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80098f:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800994:	e9 a3 00 00 00       	jmp    800a3c <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800999:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099c:	8b 10                	mov    (%eax),%edx
+  80099e:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009a1:	8d 40 08             	lea    0x8(%eax),%eax
+  8009a4:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8009a7:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8009ac:	e9 8b 00 00 00       	jmp    800a3c <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8009b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b4:	8b 10                	mov    (%eax),%edx
+  8009b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8009be:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8009c1:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8009c6:	eb 74                	jmp    800a3c <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8009c8:	83 f9 01             	cmp    $0x1,%ecx
+  8009cb:	7f 1b                	jg     8009e8 <vprintfmt+0x368>
+  else if (lflag)
+  8009cd:	85 c9                	test   %ecx,%ecx
+  8009cf:	74 2c                	je     8009fd <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8009d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d4:	8b 10                	mov    (%eax),%edx
+  8009d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009db:	8d 40 04             	lea    0x4(%eax),%eax
+  8009de:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8009e1:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8009e6:	eb 54                	jmp    800a3c <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8009e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009eb:	8b 10                	mov    (%eax),%edx
+  8009ed:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009f0:	8d 40 08             	lea    0x8(%eax),%eax
+  8009f3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8009f6:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8009fb:	eb 3f                	jmp    800a3c <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8009fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a00:	8b 10                	mov    (%eax),%edx
+  800a02:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a07:	8d 40 04             	lea    0x4(%eax),%eax
+  800a0a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800a0d:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800a12:	eb 28                	jmp    800a3c <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800a14:	83 ec 08             	sub    $0x8,%esp
+  800a17:	53                   	push   %ebx
+  800a18:	6a 30                	push   $0x30
+  800a1a:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800a1c:	83 c4 08             	add    $0x8,%esp
+  800a1f:	53                   	push   %ebx
+  800a20:	6a 78                	push   $0x78
+  800a22:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800a24:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a27:	8b 10                	mov    (%eax),%edx
+  800a29:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800a2e:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800a31:	8d 40 04             	lea    0x4(%eax),%eax
+  800a34:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800a37:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800a3c:	83 ec 0c             	sub    $0xc,%esp
+  800a3f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a43:	50                   	push   %eax
+  800a44:	ff 75 e0             	push   -0x20(%ebp)
+  800a47:	57                   	push   %edi
+  800a48:	51                   	push   %ecx
+  800a49:	52                   	push   %edx
+  800a4a:	89 da                	mov    %ebx,%edx
+  800a4c:	89 f0                	mov    %esi,%eax
+  800a4e:	e8 4a fb ff ff       	call   80059d <printnum>
+      break;
+  800a53:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800a56:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800a59:	e9 40 fc ff ff       	jmp    80069e <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800a5e:	83 f9 01             	cmp    $0x1,%ecx
+  800a61:	7f 1b                	jg     800a7e <vprintfmt+0x3fe>
+  else if (lflag)
+  800a63:	85 c9                	test   %ecx,%ecx
+  800a65:	74 2c                	je     800a93 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800a67:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6a:	8b 10                	mov    (%eax),%edx
+  800a6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a71:	8d 40 04             	lea    0x4(%eax),%eax
+  800a74:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800a77:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800a7c:	eb be                	jmp    800a3c <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800a7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a81:	8b 10                	mov    (%eax),%edx
+  800a83:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a86:	8d 40 08             	lea    0x8(%eax),%eax
+  800a89:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800a8c:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800a91:	eb a9                	jmp    800a3c <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800a93:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a96:	8b 10                	mov    (%eax),%edx
+  800a98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a9d:	8d 40 04             	lea    0x4(%eax),%eax
+  800aa0:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800aa3:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800aa8:	eb 92                	jmp    800a3c <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800aaa:	83 ec 08             	sub    $0x8,%esp
+  800aad:	53                   	push   %ebx
+  800aae:	6a 25                	push   $0x25
+  800ab0:	ff d6                	call   *%esi
+      break;
+  800ab2:	83 c4 10             	add    $0x10,%esp
+  800ab5:	eb 9f                	jmp    800a56 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800ab7:	83 ec 08             	sub    $0x8,%esp
+  800aba:	53                   	push   %ebx
+  800abb:	6a 25                	push   $0x25
+  800abd:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800abf:	83 c4 10             	add    $0x10,%esp
+  800ac2:	89 f8                	mov    %edi,%eax
+  800ac4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800ac8:	74 05                	je     800acf <vprintfmt+0x44f>
+  800aca:	83 e8 01             	sub    $0x1,%eax
+  800acd:	eb f5                	jmp    800ac4 <vprintfmt+0x444>
+  800acf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800ad2:	eb 82                	jmp    800a56 <vprintfmt+0x3d6>
+
+00800ad4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ad4:	55                   	push   %ebp
+  800ad5:	89 e5                	mov    %esp,%ebp
+  800ad7:	83 ec 18             	sub    $0x18,%esp
+  800ada:	8b 45 08             	mov    0x8(%ebp),%eax
+  800add:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800ae0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800ae3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ae7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800aea:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800af1:	85 c0                	test   %eax,%eax
+  800af3:	74 26                	je     800b1b <vsnprintf+0x47>
+  800af5:	85 d2                	test   %edx,%edx
+  800af7:	7e 22                	jle    800b1b <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800af9:	ff 75 14             	push   0x14(%ebp)
+  800afc:	ff 75 10             	push   0x10(%ebp)
+  800aff:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b02:	50                   	push   %eax
+  800b03:	68 46 06 80 00       	push   $0x800646
+  800b08:	e8 73 fb ff ff       	call   800680 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800b0d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b10:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800b13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b16:	83 c4 10             	add    $0x10,%esp
+}
+  800b19:	c9                   	leave
+  800b1a:	c3                   	ret
+    return -E_INVAL;
+  800b1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b20:	eb f7                	jmp    800b19 <vsnprintf+0x45>
+
+00800b22 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b22:	55                   	push   %ebp
+  800b23:	89 e5                	mov    %esp,%ebp
+  800b25:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800b28:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800b2b:	50                   	push   %eax
+  800b2c:	ff 75 10             	push   0x10(%ebp)
+  800b2f:	ff 75 0c             	push   0xc(%ebp)
+  800b32:	ff 75 08             	push   0x8(%ebp)
+  800b35:	e8 9a ff ff ff       	call   800ad4 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800b3a:	c9                   	leave
+  800b3b:	c3                   	ret
+
+00800b3c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b3c:	55                   	push   %ebp
+  800b3d:	89 e5                	mov    %esp,%ebp
+  800b3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b47:	eb 03                	jmp    800b4c <strlen+0x10>
+    n++;
+  800b49:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800b4c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b50:	75 f7                	jne    800b49 <strlen+0xd>
+  return n;
+}
+  800b52:	5d                   	pop    %ebp
+  800b53:	c3                   	ret
+
+00800b54 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b54:	55                   	push   %ebp
+  800b55:	89 e5                	mov    %esp,%ebp
+  800b57:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b62:	eb 03                	jmp    800b67 <strnlen+0x13>
+    n++;
+  800b64:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b67:	39 d0                	cmp    %edx,%eax
+  800b69:	74 08                	je     800b73 <strnlen+0x1f>
+  800b6b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b6f:	75 f3                	jne    800b64 <strnlen+0x10>
+  800b71:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800b73:	89 d0                	mov    %edx,%eax
+  800b75:	5d                   	pop    %ebp
+  800b76:	c3                   	ret
+
+00800b77 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	53                   	push   %ebx
+  800b7b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b7e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800b81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b86:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b8a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b8d:	83 c0 01             	add    $0x1,%eax
+  800b90:	84 d2                	test   %dl,%dl
+  800b92:	75 f2                	jne    800b86 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800b94:	89 c8                	mov    %ecx,%eax
+  800b96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b99:	c9                   	leave
+  800b9a:	c3                   	ret
+
+00800b9b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b9b:	55                   	push   %ebp
+  800b9c:	89 e5                	mov    %esp,%ebp
+  800b9e:	53                   	push   %ebx
+  800b9f:	83 ec 10             	sub    $0x10,%esp
+  800ba2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800ba5:	53                   	push   %ebx
+  800ba6:	e8 91 ff ff ff       	call   800b3c <strlen>
+  800bab:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800bae:	ff 75 0c             	push   0xc(%ebp)
+  800bb1:	01 d8                	add    %ebx,%eax
+  800bb3:	50                   	push   %eax
+  800bb4:	e8 be ff ff ff       	call   800b77 <strcpy>
+  return dst;
+}
+  800bb9:	89 d8                	mov    %ebx,%eax
+  800bbb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bbe:	c9                   	leave
+  800bbf:	c3                   	ret
+
+00800bc0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800bc0:	55                   	push   %ebp
+  800bc1:	89 e5                	mov    %esp,%ebp
+  800bc3:	56                   	push   %esi
+  800bc4:	53                   	push   %ebx
+  800bc5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bc8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800bcb:	89 f3                	mov    %esi,%ebx
+  800bcd:	03 5d 10             	add    0x10(%ebp),%ebx
+  800bd0:	89 f0                	mov    %esi,%eax
+  800bd2:	eb 0f                	jmp    800be3 <strncpy+0x23>
+    *dst++ = *src;
+  800bd4:	83 c0 01             	add    $0x1,%eax
+  800bd7:	0f b6 0a             	movzbl (%edx),%ecx
+  800bda:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800bdd:	80 f9 01             	cmp    $0x1,%cl
+  800be0:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800be3:	39 d8                	cmp    %ebx,%eax
+  800be5:	75 ed                	jne    800bd4 <strncpy+0x14>
+  }
+  return ret;
+}
+  800be7:	89 f0                	mov    %esi,%eax
+  800be9:	5b                   	pop    %ebx
+  800bea:	5e                   	pop    %esi
+  800beb:	5d                   	pop    %ebp
+  800bec:	c3                   	ret
+
+00800bed <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bed:	55                   	push   %ebp
+  800bee:	89 e5                	mov    %esp,%ebp
+  800bf0:	56                   	push   %esi
+  800bf1:	53                   	push   %ebx
+  800bf2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bf5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf8:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800bfb:	89 f0                	mov    %esi,%eax
+  800bfd:	85 d2                	test   %edx,%edx
+  800bff:	74 21                	je     800c22 <strlcpy+0x35>
+  800c01:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c05:	89 f2                	mov    %esi,%edx
+  800c07:	eb 09                	jmp    800c12 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800c09:	83 c1 01             	add    $0x1,%ecx
+  800c0c:	83 c2 01             	add    $0x1,%edx
+  800c0f:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800c12:	39 c2                	cmp    %eax,%edx
+  800c14:	74 09                	je     800c1f <strlcpy+0x32>
+  800c16:	0f b6 19             	movzbl (%ecx),%ebx
+  800c19:	84 db                	test   %bl,%bl
+  800c1b:	75 ec                	jne    800c09 <strlcpy+0x1c>
+  800c1d:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800c1f:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800c22:	29 f0                	sub    %esi,%eax
+}
+  800c24:	5b                   	pop    %ebx
+  800c25:	5e                   	pop    %esi
+  800c26:	5d                   	pop    %ebp
+  800c27:	c3                   	ret
+
+00800c28 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c28:	55                   	push   %ebp
+  800c29:	89 e5                	mov    %esp,%ebp
+  800c2b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c2e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800c31:	eb 06                	jmp    800c39 <strcmp+0x11>
+    p++, q++;
+  800c33:	83 c1 01             	add    $0x1,%ecx
+  800c36:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800c39:	0f b6 01             	movzbl (%ecx),%eax
+  800c3c:	84 c0                	test   %al,%al
+  800c3e:	74 04                	je     800c44 <strcmp+0x1c>
+  800c40:	3a 02                	cmp    (%edx),%al
+  800c42:	74 ef                	je     800c33 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800c44:	0f b6 c0             	movzbl %al,%eax
+  800c47:	0f b6 12             	movzbl (%edx),%edx
+  800c4a:	29 d0                	sub    %edx,%eax
+}
+  800c4c:	5d                   	pop    %ebp
+  800c4d:	c3                   	ret
+
+00800c4e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c4e:	55                   	push   %ebp
+  800c4f:	89 e5                	mov    %esp,%ebp
+  800c51:	53                   	push   %ebx
+  800c52:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c58:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800c5b:	eb 09                	jmp    800c66 <strncmp+0x18>
+    n--, p++, q++;
+  800c5d:	83 ea 01             	sub    $0x1,%edx
+  800c60:	83 c0 01             	add    $0x1,%eax
+  800c63:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800c66:	85 d2                	test   %edx,%edx
+  800c68:	74 18                	je     800c82 <strncmp+0x34>
+  800c6a:	0f b6 18             	movzbl (%eax),%ebx
+  800c6d:	84 db                	test   %bl,%bl
+  800c6f:	74 04                	je     800c75 <strncmp+0x27>
+  800c71:	3a 19                	cmp    (%ecx),%bl
+  800c73:	74 e8                	je     800c5d <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c75:	0f b6 00             	movzbl (%eax),%eax
+  800c78:	0f b6 11             	movzbl (%ecx),%edx
+  800c7b:	29 d0                	sub    %edx,%eax
+}
+  800c7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c80:	c9                   	leave
+  800c81:	c3                   	ret
+    return 0;
+  800c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c87:	eb f4                	jmp    800c7d <strncmp+0x2f>
+
+00800c89 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800c93:	eb 03                	jmp    800c98 <strchr+0xf>
+  800c95:	83 c0 01             	add    $0x1,%eax
+  800c98:	0f b6 10             	movzbl (%eax),%edx
+  800c9b:	84 d2                	test   %dl,%dl
+  800c9d:	74 06                	je     800ca5 <strchr+0x1c>
+    if (*s == c)
+  800c9f:	38 ca                	cmp    %cl,%dl
+  800ca1:	75 f2                	jne    800c95 <strchr+0xc>
+  800ca3:	eb 05                	jmp    800caa <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+
+00800cac <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cac:	55                   	push   %ebp
+  800cad:	89 e5                	mov    %esp,%ebp
+  800caf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800cb6:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800cb9:	38 ca                	cmp    %cl,%dl
+  800cbb:	74 09                	je     800cc6 <strfind+0x1a>
+  800cbd:	84 d2                	test   %dl,%dl
+  800cbf:	74 05                	je     800cc6 <strfind+0x1a>
+  for (; *s; s++)
+  800cc1:	83 c0 01             	add    $0x1,%eax
+  800cc4:	eb f0                	jmp    800cb6 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800cc6:	5d                   	pop    %ebp
+  800cc7:	c3                   	ret
+
+00800cc8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cc8:	55                   	push   %ebp
+  800cc9:	89 e5                	mov    %esp,%ebp
+  800ccb:	57                   	push   %edi
+  800ccc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ccf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800cd2:	85 c9                	test   %ecx,%ecx
+  800cd4:	74 20                	je     800cf6 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800cd6:	89 f8                	mov    %edi,%eax
+  800cd8:	09 c8                	or     %ecx,%eax
+  800cda:	a8 03                	test   $0x3,%al
+  800cdc:	75 12                	jne    800cf0 <memset+0x28>
+    c &= 0xFF;
+  800cde:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ce2:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800ce8:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800ceb:	fc                   	cld
+  800cec:	f3 ab                	rep stos %eax,%es:(%edi)
+  800cee:	eb 06                	jmp    800cf6 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800cf0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cf3:	fc                   	cld
+  800cf4:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800cf6:	89 f8                	mov    %edi,%eax
+  800cf8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800cfb:	c9                   	leave
+  800cfc:	c3                   	ret
+
+00800cfd <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800cfd:	55                   	push   %ebp
+  800cfe:	89 e5                	mov    %esp,%ebp
+  800d00:	57                   	push   %edi
+  800d01:	56                   	push   %esi
+  800d02:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d05:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d08:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800d0b:	39 c6                	cmp    %eax,%esi
+  800d0d:	73 32                	jae    800d41 <memmove+0x44>
+  800d0f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d12:	39 d0                	cmp    %edx,%eax
+  800d14:	73 2b                	jae    800d41 <memmove+0x44>
+    s += n;
+    d += n;
+  800d16:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d19:	89 d6                	mov    %edx,%esi
+  800d1b:	09 fe                	or     %edi,%esi
+  800d1d:	09 ce                	or     %ecx,%esi
+  800d1f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d25:	75 0e                	jne    800d35 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d27:	83 ef 04             	sub    $0x4,%edi
+  800d2a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d2d:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800d30:	fd                   	std
+  800d31:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d33:	eb 09                	jmp    800d3e <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d35:	83 ef 01             	sub    $0x1,%edi
+  800d38:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800d3b:	fd                   	std
+  800d3c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800d3e:	fc                   	cld
+  800d3f:	eb 1a                	jmp    800d5b <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d41:	89 f2                	mov    %esi,%edx
+  800d43:	09 c2                	or     %eax,%edx
+  800d45:	09 ca                	or     %ecx,%edx
+  800d47:	f6 c2 03             	test   $0x3,%dl
+  800d4a:	75 0a                	jne    800d56 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d4c:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800d4f:	89 c7                	mov    %eax,%edi
+  800d51:	fc                   	cld
+  800d52:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d54:	eb 05                	jmp    800d5b <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800d56:	89 c7                	mov    %eax,%edi
+  800d58:	fc                   	cld
+  800d59:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800d5b:	5e                   	pop    %esi
+  800d5c:	5f                   	pop    %edi
+  800d5d:	5d                   	pop    %ebp
+  800d5e:	c3                   	ret
+
+00800d5f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d5f:	55                   	push   %ebp
+  800d60:	89 e5                	mov    %esp,%ebp
+  800d62:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800d65:	ff 75 10             	push   0x10(%ebp)
+  800d68:	ff 75 0c             	push   0xc(%ebp)
+  800d6b:	ff 75 08             	push   0x8(%ebp)
+  800d6e:	e8 8a ff ff ff       	call   800cfd <memmove>
+}
+  800d73:	c9                   	leave
+  800d74:	c3                   	ret
+
+00800d75 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	56                   	push   %esi
+  800d79:	53                   	push   %ebx
+  800d7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800d80:	89 c6                	mov    %eax,%esi
+  800d82:	03 75 10             	add    0x10(%ebp),%esi
+  800d85:	eb 06                	jmp    800d8d <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800d87:	83 c0 01             	add    $0x1,%eax
+  800d8a:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800d8d:	39 f0                	cmp    %esi,%eax
+  800d8f:	74 14                	je     800da5 <memcmp+0x30>
+    if (*s1 != *s2)
+  800d91:	0f b6 08             	movzbl (%eax),%ecx
+  800d94:	0f b6 1a             	movzbl (%edx),%ebx
+  800d97:	38 d9                	cmp    %bl,%cl
+  800d99:	74 ec                	je     800d87 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800d9b:	0f b6 c1             	movzbl %cl,%eax
+  800d9e:	0f b6 db             	movzbl %bl,%ebx
+  800da1:	29 d8                	sub    %ebx,%eax
+  800da3:	eb 05                	jmp    800daa <memcmp+0x35>
+  }
+
+  return 0;
+  800da5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800daa:	5b                   	pop    %ebx
+  800dab:	5e                   	pop    %esi
+  800dac:	5d                   	pop    %ebp
+  800dad:	c3                   	ret
+
+00800dae <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800dae:	55                   	push   %ebp
+  800daf:	89 e5                	mov    %esp,%ebp
+  800db1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800db7:	89 c2                	mov    %eax,%edx
+  800db9:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800dbc:	eb 03                	jmp    800dc1 <memfind+0x13>
+  800dbe:	83 c0 01             	add    $0x1,%eax
+  800dc1:	39 d0                	cmp    %edx,%eax
+  800dc3:	73 04                	jae    800dc9 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800dc5:	38 08                	cmp    %cl,(%eax)
+  800dc7:	75 f5                	jne    800dbe <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800dc9:	5d                   	pop    %ebp
+  800dca:	c3                   	ret
+
+00800dcb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800dcb:	55                   	push   %ebp
+  800dcc:	89 e5                	mov    %esp,%ebp
+  800dce:	57                   	push   %edi
+  800dcf:	56                   	push   %esi
+  800dd0:	53                   	push   %ebx
+  800dd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800dd7:	eb 03                	jmp    800ddc <strtol+0x11>
+    s++;
+  800dd9:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800ddc:	0f b6 02             	movzbl (%edx),%eax
+  800ddf:	3c 20                	cmp    $0x20,%al
+  800de1:	74 f6                	je     800dd9 <strtol+0xe>
+  800de3:	3c 09                	cmp    $0x9,%al
+  800de5:	74 f2                	je     800dd9 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800de7:	3c 2b                	cmp    $0x2b,%al
+  800de9:	74 2a                	je     800e15 <strtol+0x4a>
+  int neg = 0;
+  800deb:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800df0:	3c 2d                	cmp    $0x2d,%al
+  800df2:	74 2b                	je     800e1f <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800df4:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800dfa:	75 0f                	jne    800e0b <strtol+0x40>
+  800dfc:	80 3a 30             	cmpb   $0x30,(%edx)
+  800dff:	74 28                	je     800e29 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800e01:	85 db                	test   %ebx,%ebx
+  800e03:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e08:	0f 44 d8             	cmove  %eax,%ebx
+  800e0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e10:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e13:	eb 46                	jmp    800e5b <strtol+0x90>
+    s++;
+  800e15:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800e18:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e1d:	eb d5                	jmp    800df4 <strtol+0x29>
+    s++, neg = 1;
+  800e1f:	83 c2 01             	add    $0x1,%edx
+  800e22:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e27:	eb cb                	jmp    800df4 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e29:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e2d:	74 0e                	je     800e3d <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800e2f:	85 db                	test   %ebx,%ebx
+  800e31:	75 d8                	jne    800e0b <strtol+0x40>
+    s++, base = 8;
+  800e33:	83 c2 01             	add    $0x1,%edx
+  800e36:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e3b:	eb ce                	jmp    800e0b <strtol+0x40>
+    s += 2, base = 16;
+  800e3d:	83 c2 02             	add    $0x2,%edx
+  800e40:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e45:	eb c4                	jmp    800e0b <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800e47:	0f be c0             	movsbl %al,%eax
+  800e4a:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800e4d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e50:	7d 3a                	jge    800e8c <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800e52:	83 c2 01             	add    $0x1,%edx
+  800e55:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e59:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800e5b:	0f b6 02             	movzbl (%edx),%eax
+  800e5e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e61:	89 f3                	mov    %esi,%ebx
+  800e63:	80 fb 09             	cmp    $0x9,%bl
+  800e66:	76 df                	jbe    800e47 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800e68:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e6b:	89 f3                	mov    %esi,%ebx
+  800e6d:	80 fb 19             	cmp    $0x19,%bl
+  800e70:	77 08                	ja     800e7a <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800e72:	0f be c0             	movsbl %al,%eax
+  800e75:	83 e8 57             	sub    $0x57,%eax
+  800e78:	eb d3                	jmp    800e4d <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800e7a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e7d:	89 f3                	mov    %esi,%ebx
+  800e7f:	80 fb 19             	cmp    $0x19,%bl
+  800e82:	77 08                	ja     800e8c <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800e84:	0f be c0             	movsbl %al,%eax
+  800e87:	83 e8 37             	sub    $0x37,%eax
+  800e8a:	eb c1                	jmp    800e4d <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800e8c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e90:	74 05                	je     800e97 <strtol+0xcc>
+    *endptr = (char*)s;
+  800e92:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e95:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800e97:	89 c8                	mov    %ecx,%eax
+  800e99:	f7 d8                	neg    %eax
+  800e9b:	85 ff                	test   %edi,%edi
+  800e9d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ea0:	89 c8                	mov    %ecx,%eax
+  800ea2:	5b                   	pop    %ebx
+  800ea3:	5e                   	pop    %esi
+  800ea4:	5f                   	pop    %edi
+  800ea5:	5d                   	pop    %ebp
+  800ea6:	c3                   	ret
+
+00800ea7 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ea7:	55                   	push   %ebp
+  800ea8:	89 e5                	mov    %esp,%ebp
+  800eaa:	57                   	push   %edi
+  800eab:	56                   	push   %esi
+  800eac:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ead:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb8:	89 c3                	mov    %eax,%ebx
+  800eba:	89 c7                	mov    %eax,%edi
+  800ebc:	89 c6                	mov    %eax,%esi
+  800ebe:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ec0:	5b                   	pop    %ebx
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5f                   	pop    %edi
+  800ec3:	5d                   	pop    %ebp
+  800ec4:	c3                   	ret
+
+00800ec5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	57                   	push   %edi
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ecb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ed5:	89 d1                	mov    %edx,%ecx
+  800ed7:	89 d3                	mov    %edx,%ebx
+  800ed9:	89 d7                	mov    %edx,%edi
+  800edb:	89 d6                	mov    %edx,%esi
+  800edd:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800edf:	5b                   	pop    %ebx
+  800ee0:	5e                   	pop    %esi
+  800ee1:	5f                   	pop    %edi
+  800ee2:	5d                   	pop    %ebp
+  800ee3:	c3                   	ret
+
+00800ee4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	57                   	push   %edi
+  800ee8:	56                   	push   %esi
+  800ee9:	53                   	push   %ebx
+  800eea:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800eed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ef2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800efa:	89 cb                	mov    %ecx,%ebx
+  800efc:	89 cf                	mov    %ecx,%edi
+  800efe:	89 ce                	mov    %ecx,%esi
+  800f00:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f02:	85 c0                	test   %eax,%eax
+  800f04:	7f 08                	jg     800f0e <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f09:	5b                   	pop    %ebx
+  800f0a:	5e                   	pop    %esi
+  800f0b:	5f                   	pop    %edi
+  800f0c:	5d                   	pop    %ebp
+  800f0d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f0e:	83 ec 0c             	sub    $0xc,%esp
+  800f11:	50                   	push   %eax
+  800f12:	6a 03                	push   $0x3
+  800f14:	68 c3 36 80 00       	push   $0x8036c3
+  800f19:	6a 23                	push   $0x23
+  800f1b:	68 e0 36 80 00       	push   $0x8036e0
+  800f20:	e8 89 f5 ff ff       	call   8004ae <_panic>
+
+00800f25 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f25:	55                   	push   %ebp
+  800f26:	89 e5                	mov    %esp,%ebp
+  800f28:	57                   	push   %edi
+  800f29:	56                   	push   %esi
+  800f2a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f30:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f35:	89 d1                	mov    %edx,%ecx
+  800f37:	89 d3                	mov    %edx,%ebx
+  800f39:	89 d7                	mov    %edx,%edi
+  800f3b:	89 d6                	mov    %edx,%esi
+  800f3d:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f3f:	5b                   	pop    %ebx
+  800f40:	5e                   	pop    %esi
+  800f41:	5f                   	pop    %edi
+  800f42:	5d                   	pop    %ebp
+  800f43:	c3                   	ret
+
+00800f44 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	57                   	push   %edi
+  800f48:	56                   	push   %esi
+  800f49:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f54:	89 d1                	mov    %edx,%ecx
+  800f56:	89 d3                	mov    %edx,%ebx
+  800f58:	89 d7                	mov    %edx,%edi
+  800f5a:	89 d6                	mov    %edx,%esi
+  800f5c:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f5e:	5b                   	pop    %ebx
+  800f5f:	5e                   	pop    %esi
+  800f60:	5f                   	pop    %edi
+  800f61:	5d                   	pop    %ebp
+  800f62:	c3                   	ret
+
+00800f63 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800f63:	55                   	push   %ebp
+  800f64:	89 e5                	mov    %esp,%ebp
+  800f66:	57                   	push   %edi
+  800f67:	56                   	push   %esi
+  800f68:	53                   	push   %ebx
+  800f69:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800f6c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800f70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f75:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f78:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f7d:	89 df                	mov    %ebx,%edi
+  800f7f:	89 de                	mov    %ebx,%esi
+  800f81:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f83:	85 c0                	test   %eax,%eax
+  800f85:	7f 08                	jg     800f8f <sys_env_set_cow+0x2c>
+}
+  800f87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8a:	5b                   	pop    %ebx
+  800f8b:	5e                   	pop    %esi
+  800f8c:	5f                   	pop    %edi
+  800f8d:	5d                   	pop    %ebp
+  800f8e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f8f:	83 ec 0c             	sub    $0xc,%esp
+  800f92:	50                   	push   %eax
+  800f93:	6a 14                	push   $0x14
+  800f95:	68 c3 36 80 00       	push   $0x8036c3
+  800f9a:	6a 23                	push   $0x23
+  800f9c:	68 e0 36 80 00       	push   $0x8036e0
+  800fa1:	e8 08 f5 ff ff       	call   8004ae <_panic>
+
+00800fa6 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800fa6:	55                   	push   %ebp
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	57                   	push   %edi
+  800faa:	56                   	push   %esi
+  800fab:	53                   	push   %ebx
+  800fac:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800faf:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fba:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fbf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc2:	89 f7                	mov    %esi,%edi
+  800fc4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fc6:	85 c0                	test   %eax,%eax
+  800fc8:	7f 08                	jg     800fd2 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800fca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcd:	5b                   	pop    %ebx
+  800fce:	5e                   	pop    %esi
+  800fcf:	5f                   	pop    %edi
+  800fd0:	5d                   	pop    %ebp
+  800fd1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fd2:	83 ec 0c             	sub    $0xc,%esp
+  800fd5:	50                   	push   %eax
+  800fd6:	6a 04                	push   $0x4
+  800fd8:	68 c3 36 80 00       	push   $0x8036c3
+  800fdd:	6a 23                	push   $0x23
+  800fdf:	68 e0 36 80 00       	push   $0x8036e0
+  800fe4:	e8 c5 f4 ff ff       	call   8004ae <_panic>
+
+00800fe9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800fe9:	55                   	push   %ebp
+  800fea:	89 e5                	mov    %esp,%ebp
+  800fec:	57                   	push   %edi
+  800fed:	56                   	push   %esi
+  800fee:	53                   	push   %ebx
+  800fef:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ff2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff8:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ffd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801000:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801003:	8b 75 18             	mov    0x18(%ebp),%esi
+  801006:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801008:	85 c0                	test   %eax,%eax
+  80100a:	7f 08                	jg     801014 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  80100c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100f:	5b                   	pop    %ebx
+  801010:	5e                   	pop    %esi
+  801011:	5f                   	pop    %edi
+  801012:	5d                   	pop    %ebp
+  801013:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801014:	83 ec 0c             	sub    $0xc,%esp
+  801017:	50                   	push   %eax
+  801018:	6a 05                	push   $0x5
+  80101a:	68 c3 36 80 00       	push   $0x8036c3
+  80101f:	6a 23                	push   $0x23
+  801021:	68 e0 36 80 00       	push   $0x8036e0
+  801026:	e8 83 f4 ff ff       	call   8004ae <_panic>
+
+0080102b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80102b:	55                   	push   %ebp
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	57                   	push   %edi
+  80102f:	56                   	push   %esi
+  801030:	53                   	push   %ebx
+  801031:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801034:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801039:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801044:	89 df                	mov    %ebx,%edi
+  801046:	89 de                	mov    %ebx,%esi
+  801048:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80104a:	85 c0                	test   %eax,%eax
+  80104c:	7f 08                	jg     801056 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  80104e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801051:	5b                   	pop    %ebx
+  801052:	5e                   	pop    %esi
+  801053:	5f                   	pop    %edi
+  801054:	5d                   	pop    %ebp
+  801055:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801056:	83 ec 0c             	sub    $0xc,%esp
+  801059:	50                   	push   %eax
+  80105a:	6a 06                	push   $0x6
+  80105c:	68 c3 36 80 00       	push   $0x8036c3
+  801061:	6a 23                	push   $0x23
+  801063:	68 e0 36 80 00       	push   $0x8036e0
+  801068:	e8 41 f4 ff ff       	call   8004ae <_panic>
+
+0080106d <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  80106d:	55                   	push   %ebp
+  80106e:	89 e5                	mov    %esp,%ebp
+  801070:	57                   	push   %edi
+  801071:	56                   	push   %esi
+  801072:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801073:	8b 55 08             	mov    0x8(%ebp),%edx
+  801076:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801079:	b8 11 00 00 00       	mov    $0x11,%eax
+  80107e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801081:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801084:	8b 75 18             	mov    0x18(%ebp),%esi
+  801087:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  801089:	5b                   	pop    %ebx
+  80108a:	5e                   	pop    %esi
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+
+0080108e <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	57                   	push   %edi
+  801092:	56                   	push   %esi
+  801093:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801094:	8b 55 08             	mov    0x8(%ebp),%edx
+  801097:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80109f:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010aa:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8010ac:	5b                   	pop    %ebx
+  8010ad:	5e                   	pop    %esi
+  8010ae:	5f                   	pop    %edi
+  8010af:	5d                   	pop    %ebp
+  8010b0:	c3                   	ret
+
+008010b1 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	57                   	push   %edi
+  8010b5:	56                   	push   %esi
+  8010b6:	53                   	push   %ebx
+  8010b7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c5:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010ca:	89 df                	mov    %ebx,%edi
+  8010cc:	89 de                	mov    %ebx,%esi
+  8010ce:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010d0:	85 c0                	test   %eax,%eax
+  8010d2:	7f 08                	jg     8010dc <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8010d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d7:	5b                   	pop    %ebx
+  8010d8:	5e                   	pop    %esi
+  8010d9:	5f                   	pop    %edi
+  8010da:	5d                   	pop    %ebp
+  8010db:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010dc:	83 ec 0c             	sub    $0xc,%esp
+  8010df:	50                   	push   %eax
+  8010e0:	6a 16                	push   $0x16
+  8010e2:	68 c3 36 80 00       	push   $0x8036c3
+  8010e7:	6a 23                	push   $0x23
+  8010e9:	68 e0 36 80 00       	push   $0x8036e0
+  8010ee:	e8 bb f3 ff ff       	call   8004ae <_panic>
+
+008010f3 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  8010f3:	55                   	push   %ebp
+  8010f4:	89 e5                	mov    %esp,%ebp
+  8010f6:	57                   	push   %edi
+  8010f7:	56                   	push   %esi
+  8010f8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801101:	b8 17 00 00 00       	mov    $0x17,%eax
+  801106:	89 cb                	mov    %ecx,%ebx
+  801108:	89 cf                	mov    %ecx,%edi
+  80110a:	89 ce                	mov    %ecx,%esi
+  80110c:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  80110e:	5b                   	pop    %ebx
+  80110f:	5e                   	pop    %esi
+  801110:	5f                   	pop    %edi
+  801111:	5d                   	pop    %ebp
+  801112:	c3                   	ret
+
+00801113 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  801113:	55                   	push   %ebp
+  801114:	89 e5                	mov    %esp,%ebp
+  801116:	57                   	push   %edi
+  801117:	56                   	push   %esi
+  801118:	53                   	push   %ebx
+  801119:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80111c:	be 00 00 00 00       	mov    $0x0,%esi
+  801121:	8b 55 08             	mov    0x8(%ebp),%edx
+  801124:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801127:	b8 18 00 00 00       	mov    $0x18,%eax
+  80112c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80112f:	89 f7                	mov    %esi,%edi
+  801131:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801133:	85 c0                	test   %eax,%eax
+  801135:	7f 08                	jg     80113f <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  801137:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113a:	5b                   	pop    %ebx
+  80113b:	5e                   	pop    %esi
+  80113c:	5f                   	pop    %edi
+  80113d:	5d                   	pop    %ebp
+  80113e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80113f:	83 ec 0c             	sub    $0xc,%esp
+  801142:	50                   	push   %eax
+  801143:	6a 18                	push   $0x18
+  801145:	68 c3 36 80 00       	push   $0x8036c3
+  80114a:	6a 23                	push   $0x23
+  80114c:	68 e0 36 80 00       	push   $0x8036e0
+  801151:	e8 58 f3 ff ff       	call   8004ae <_panic>
+
+00801156 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  801156:	55                   	push   %ebp
+  801157:	89 e5                	mov    %esp,%ebp
+  801159:	57                   	push   %edi
+  80115a:	56                   	push   %esi
+  80115b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80115c:	be 00 00 00 00       	mov    $0x0,%esi
+  801161:	8b 55 08             	mov    0x8(%ebp),%edx
+  801164:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801167:	b8 19 00 00 00       	mov    $0x19,%eax
+  80116c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80116f:	89 f7                	mov    %esi,%edi
+  801171:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  801173:	5b                   	pop    %ebx
+  801174:	5e                   	pop    %esi
+  801175:	5f                   	pop    %edi
+  801176:	5d                   	pop    %ebp
+  801177:	c3                   	ret
+
+00801178 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  80117b:	57                   	push   %edi
+  80117c:	56                   	push   %esi
+  80117d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80117e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801183:	b8 15 00 00 00       	mov    $0x15,%eax
+  801188:	89 d1                	mov    %edx,%ecx
+  80118a:	89 d3                	mov    %edx,%ebx
+  80118c:	89 d7                	mov    %edx,%edi
+  80118e:	89 d6                	mov    %edx,%esi
+  801190:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801192:	5b                   	pop    %ebx
+  801193:	5e                   	pop    %esi
+  801194:	5f                   	pop    %edi
+  801195:	5d                   	pop    %ebp
+  801196:	c3                   	ret
+
+00801197 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801197:	55                   	push   %ebp
+  801198:	89 e5                	mov    %esp,%ebp
+  80119a:	57                   	push   %edi
+  80119b:	56                   	push   %esi
+  80119c:	53                   	push   %ebx
+  80119d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8011a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ab:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011b0:	89 df                	mov    %ebx,%edi
+  8011b2:	89 de                	mov    %ebx,%esi
+  8011b4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011b6:	85 c0                	test   %eax,%eax
+  8011b8:	7f 08                	jg     8011c2 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8011ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011bd:	5b                   	pop    %ebx
+  8011be:	5e                   	pop    %esi
+  8011bf:	5f                   	pop    %edi
+  8011c0:	5d                   	pop    %ebp
+  8011c1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011c2:	83 ec 0c             	sub    $0xc,%esp
+  8011c5:	50                   	push   %eax
+  8011c6:	6a 08                	push   $0x8
+  8011c8:	68 c3 36 80 00       	push   $0x8036c3
+  8011cd:	6a 23                	push   $0x23
+  8011cf:	68 e0 36 80 00       	push   $0x8036e0
+  8011d4:	e8 d5 f2 ff ff       	call   8004ae <_panic>
+
+008011d9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8011d9:	55                   	push   %ebp
+  8011da:	89 e5                	mov    %esp,%ebp
+  8011dc:	57                   	push   %edi
+  8011dd:	56                   	push   %esi
+  8011de:	53                   	push   %ebx
+  8011df:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8011e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ed:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011f2:	89 df                	mov    %ebx,%edi
+  8011f4:	89 de                	mov    %ebx,%esi
+  8011f6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011f8:	85 c0                	test   %eax,%eax
+  8011fa:	7f 08                	jg     801204 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  8011fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ff:	5b                   	pop    %ebx
+  801200:	5e                   	pop    %esi
+  801201:	5f                   	pop    %edi
+  801202:	5d                   	pop    %ebp
+  801203:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801204:	83 ec 0c             	sub    $0xc,%esp
+  801207:	50                   	push   %eax
+  801208:	6a 09                	push   $0x9
+  80120a:	68 c3 36 80 00       	push   $0x8036c3
+  80120f:	6a 23                	push   $0x23
+  801211:	68 e0 36 80 00       	push   $0x8036e0
+  801216:	e8 93 f2 ff ff       	call   8004ae <_panic>
+
+0080121b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80121b:	55                   	push   %ebp
+  80121c:	89 e5                	mov    %esp,%ebp
+  80121e:	57                   	push   %edi
+  80121f:	56                   	push   %esi
+  801220:	53                   	push   %ebx
+  801221:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801224:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801229:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801234:	89 df                	mov    %ebx,%edi
+  801236:	89 de                	mov    %ebx,%esi
+  801238:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80123a:	85 c0                	test   %eax,%eax
+  80123c:	7f 08                	jg     801246 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  80123e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801241:	5b                   	pop    %ebx
+  801242:	5e                   	pop    %esi
+  801243:	5f                   	pop    %edi
+  801244:	5d                   	pop    %ebp
+  801245:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801246:	83 ec 0c             	sub    $0xc,%esp
+  801249:	50                   	push   %eax
+  80124a:	6a 0a                	push   $0xa
+  80124c:	68 c3 36 80 00       	push   $0x8036c3
+  801251:	6a 23                	push   $0x23
+  801253:	68 e0 36 80 00       	push   $0x8036e0
+  801258:	e8 51 f2 ff ff       	call   8004ae <_panic>
+
+0080125d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  80125d:	55                   	push   %ebp
+  80125e:	89 e5                	mov    %esp,%ebp
+  801260:	57                   	push   %edi
+  801261:	56                   	push   %esi
+  801262:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801263:	8b 55 08             	mov    0x8(%ebp),%edx
+  801266:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801269:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80126e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801271:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801274:	8b 75 18             	mov    0x18(%ebp),%esi
+  801277:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801279:	5b                   	pop    %ebx
+  80127a:	5e                   	pop    %esi
+  80127b:	5f                   	pop    %edi
+  80127c:	5d                   	pop    %ebp
+  80127d:	c3                   	ret
+
+0080127e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80127e:	55                   	push   %ebp
+  80127f:	89 e5                	mov    %esp,%ebp
+  801281:	57                   	push   %edi
+  801282:	56                   	push   %esi
+  801283:	53                   	push   %ebx
+  801284:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801287:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801292:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801297:	89 df                	mov    %ebx,%edi
+  801299:	89 de                	mov    %ebx,%esi
+  80129b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80129d:	85 c0                	test   %eax,%eax
+  80129f:	7f 08                	jg     8012a9 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8012a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a4:	5b                   	pop    %ebx
+  8012a5:	5e                   	pop    %esi
+  8012a6:	5f                   	pop    %edi
+  8012a7:	5d                   	pop    %ebp
+  8012a8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8012a9:	83 ec 0c             	sub    $0xc,%esp
+  8012ac:	50                   	push   %eax
+  8012ad:	6a 0d                	push   $0xd
+  8012af:	68 c3 36 80 00       	push   $0x8036c3
+  8012b4:	6a 23                	push   $0x23
+  8012b6:	68 e0 36 80 00       	push   $0x8036e0
+  8012bb:	e8 ee f1 ff ff       	call   8004ae <_panic>
+
+008012c0 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8012c0:	55                   	push   %ebp
+  8012c1:	89 e5                	mov    %esp,%ebp
+  8012c3:	57                   	push   %edi
+  8012c4:	56                   	push   %esi
+  8012c5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8012c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012d0:	89 d1                	mov    %edx,%ecx
+  8012d2:	89 d3                	mov    %edx,%ebx
+  8012d4:	89 d7                	mov    %edx,%edi
+  8012d6:	89 d6                	mov    %edx,%esi
+  8012d8:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012da:	5b                   	pop    %ebx
+  8012db:	5e                   	pop    %esi
+  8012dc:	5f                   	pop    %edi
+  8012dd:	5d                   	pop    %ebp
+  8012de:	c3                   	ret
+
+008012df <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8012df:	55                   	push   %ebp
+  8012e0:	89 e5                	mov    %esp,%ebp
+  8012e2:	57                   	push   %edi
+  8012e3:	56                   	push   %esi
+  8012e4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8012e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012eb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012f8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012fb:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  8012fd:	5b                   	pop    %ebx
+  8012fe:	5e                   	pop    %esi
+  8012ff:	5f                   	pop    %edi
+  801300:	5d                   	pop    %ebp
+  801301:	c3                   	ret
+
+00801302 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801302:	55                   	push   %ebp
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	57                   	push   %edi
+  801306:	56                   	push   %esi
+  801307:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801308:	be 00 00 00 00       	mov    $0x0,%esi
+  80130d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801310:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801313:	b8 10 00 00 00       	mov    $0x10,%eax
+  801318:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80131b:	89 f7                	mov    %esi,%edi
+  80131d:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80131f:	5b                   	pop    %ebx
+  801320:	5e                   	pop    %esi
+  801321:	5f                   	pop    %edi
+  801322:	5d                   	pop    %ebp
+  801323:	c3                   	ret
+
+00801324 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801324:	55                   	push   %ebp
+  801325:	89 e5                	mov    %esp,%ebp
+  801327:	57                   	push   %edi
+  801328:	56                   	push   %esi
+  801329:	53                   	push   %ebx
+  80132a:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  80132d:	80 3d 48 67 80 00 00 	cmpb   $0x0,0x806748
+  801334:	74 41                	je     801377 <sys_batch+0x53>
+  801336:	8b 45 08             	mov    0x8(%ebp),%eax
+  801339:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80133c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801343:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801346:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801349:	7d 45                	jge    801390 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80134b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80134e:	8b 06                	mov    (%esi),%eax
+  801350:	8b 56 04             	mov    0x4(%esi),%edx
+  801353:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801356:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801359:	8b 7e 10             	mov    0x10(%esi),%edi
+  80135c:	8b 76 14             	mov    0x14(%esi),%esi
+  80135f:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  801361:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801364:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801367:	83 c6 1c             	add    $0x1c,%esi
+  80136a:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80136d:	85 c0                	test   %eax,%eax
+  80136f:	78 1f                	js     801390 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  801371:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801375:	eb cc                	jmp    801343 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801377:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801381:	8b 55 08             	mov    0x8(%ebp),%edx
+  801384:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801387:	89 df                	mov    %ebx,%edi
+  801389:	89 de                	mov    %ebx,%esi
+  80138b:	cd 30                	int    $0x30
+  80138d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801390:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801393:	83 c4 08             	add    $0x8,%esp
+  801396:	5b                   	pop    %ebx
+  801397:	5e                   	pop    %esi
+  801398:	5f                   	pop    %edi
+  801399:	5d                   	pop    %ebp
+  80139a:	c3                   	ret
+
+0080139b <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  80139b:	55                   	push   %ebp
+  80139c:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80139e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013a1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8013a7:	5d                   	pop    %ebp
+  8013a8:	c3                   	ret
+
+008013a9 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8013a9:	55                   	push   %ebp
+  8013aa:	89 e5                	mov    %esp,%ebp
+  8013ac:	56                   	push   %esi
+  8013ad:	53                   	push   %ebx
+  8013ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8013b1:	8b 1e                	mov    (%esi),%ebx
+  8013b3:	85 db                	test   %ebx,%ebx
+  8013b5:	75 09                	jne    8013c0 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8013b7:	89 d8                	mov    %ebx,%eax
+  8013b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013bc:	5b                   	pop    %ebx
+  8013bd:	5e                   	pop    %esi
+  8013be:	5d                   	pop    %ebp
+  8013bf:	c3                   	ret
+  b->sb_n = 0;
+  8013c0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8013c6:	53                   	push   %ebx
+  8013c7:	8d 46 04             	lea    0x4(%esi),%eax
+  8013ca:	50                   	push   %eax
+  8013cb:	e8 54 ff ff ff       	call   801324 <sys_batch>
+  8013d0:	83 c4 08             	add    $0x8,%esp
+  8013d3:	85 c0                	test   %eax,%eax
+  8013d5:	78 1e                	js     8013f5 <sysbatch_flush+0x4c>
+  if (r < n)
+  8013d7:	39 c3                	cmp    %eax,%ebx
+  8013d9:	7f 07                	jg     8013e2 <sysbatch_flush+0x39>
+  return 0;
+  8013db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e0:	eb d5                	jmp    8013b7 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8013e2:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8013e5:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8013e9:	85 db                	test   %ebx,%ebx
+  8013eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013f0:	0f 49 d8             	cmovns %eax,%ebx
+  8013f3:	eb c2                	jmp    8013b7 <sysbatch_flush+0xe>
+    return r;
+  8013f5:	89 c3                	mov    %eax,%ebx
+  8013f7:	eb be                	jmp    8013b7 <sysbatch_flush+0xe>
+
+008013f9 <sysbatch_add>:
+{
+  8013f9:	55                   	push   %ebp
+  8013fa:	89 e5                	mov    %esp,%ebp
+  8013fc:	53                   	push   %ebx
+  8013fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801400:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801403:	74 41                	je     801446 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801405:	8b 03                	mov    (%ebx),%eax
+  801407:	8d 50 01             	lea    0x1(%eax),%edx
+  80140a:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80140c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80140f:	01 d8                	add    %ebx,%eax
+  801411:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801414:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801417:	8b 55 10             	mov    0x10(%ebp),%edx
+  80141a:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  80141d:	8b 55 14             	mov    0x14(%ebp),%edx
+  801420:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801423:	8b 55 18             	mov    0x18(%ebp),%edx
+  801426:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801429:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80142c:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80142f:	8b 55 20             	mov    0x20(%ebp),%edx
+  801432:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801435:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80143c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801441:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801444:	c9                   	leave
+  801445:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801446:	53                   	push   %ebx
+  801447:	e8 5d ff ff ff       	call   8013a9 <sysbatch_flush>
+  80144c:	83 c4 04             	add    $0x4,%esp
+  80144f:	85 c0                	test   %eax,%eax
+  801451:	79 b2                	jns    801405 <sysbatch_add+0xc>
+  801453:	eb ec                	jmp    801441 <sysbatch_add+0x48>
+
+00801455 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801458:	8b 45 08             	mov    0x8(%ebp),%eax
+  80145b:	05 00 00 00 30       	add    $0x30000000,%eax
+  801460:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801463:	5d                   	pop    %ebp
+  801464:	c3                   	ret
+
+00801465 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801465:	55                   	push   %ebp
+  801466:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801468:	8b 45 08             	mov    0x8(%ebp),%eax
+  80146b:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80146e:	66 b8 00 00          	mov    $0x0,%ax
+  801472:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801477:	5d                   	pop    %ebp
+  801478:	c3                   	ret
+
+00801479 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801479:	55                   	push   %ebp
+  80147a:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80147c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801481:	eb 02                	jmp    801485 <fd_alloc+0xc>
+  801483:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801485:	89 c2                	mov    %eax,%edx
+  801487:	c1 ea 16             	shr    $0x16,%edx
+  80148a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801491:	f6 c2 01             	test   $0x1,%dl
+  801494:	74 2b                	je     8014c1 <fd_alloc+0x48>
+  801496:	89 c2                	mov    %eax,%edx
+  801498:	c1 ea 0c             	shr    $0xc,%edx
+  80149b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8014a2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8014a8:	f6 c1 01             	test   $0x1,%cl
+  8014ab:	74 14                	je     8014c1 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8014ad:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8014b3:	75 ce                	jne    801483 <fd_alloc+0xa>
+  8014b5:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8014ba:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8014bf:	eb 05                	jmp    8014c6 <fd_alloc+0x4d>
+      return 0;
+  8014c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8014c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c9:	89 02                	mov    %eax,(%edx)
+}
+  8014cb:	89 c8                	mov    %ecx,%eax
+  8014cd:	5d                   	pop    %ebp
+  8014ce:	c3                   	ret
+
+008014cf <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8014cf:	55                   	push   %ebp
+  8014d0:	89 e5                	mov    %esp,%ebp
+  8014d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8014d5:	83 f8 1f             	cmp    $0x1f,%eax
+  8014d8:	77 30                	ja     80150a <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8014da:	c1 e0 0c             	shl    $0xc,%eax
+  8014dd:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8014e2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8014e8:	f6 c2 01             	test   $0x1,%dl
+  8014eb:	74 24                	je     801511 <fd_lookup+0x42>
+  8014ed:	89 c2                	mov    %eax,%edx
+  8014ef:	c1 ea 0c             	shr    $0xc,%edx
+  8014f2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8014f9:	f6 c2 01             	test   $0x1,%dl
+  8014fc:	74 1a                	je     801518 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8014fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801501:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801503:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801508:	5d                   	pop    %ebp
+  801509:	c3                   	ret
+    return -E_INVAL;
+  80150a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80150f:	eb f7                	jmp    801508 <fd_lookup+0x39>
+    return -E_INVAL;
+  801511:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801516:	eb f0                	jmp    801508 <fd_lookup+0x39>
+  801518:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80151d:	eb e9                	jmp    801508 <fd_lookup+0x39>
+
+0080151f <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80151f:	55                   	push   %ebp
+  801520:	89 e5                	mov    %esp,%ebp
+  801522:	53                   	push   %ebx
+  801523:	83 ec 04             	sub    $0x4,%esp
+  801526:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801529:	b8 6c 37 80 00       	mov    $0x80376c,%eax
+  80152e:	8b 18                	mov    (%eax),%ebx
+  801530:	85 db                	test   %ebx,%ebx
+  801532:	74 0e                	je     801542 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801534:	83 c0 04             	add    $0x4,%eax
+  801537:	39 13                	cmp    %edx,(%ebx)
+  801539:	75 f3                	jne    80152e <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80153b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801540:	eb 1f                	jmp    801561 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801542:	a1 44 67 80 00       	mov    0x806744,%eax
+  801547:	8b 40 48             	mov    0x48(%eax),%eax
+  80154a:	83 ec 04             	sub    $0x4,%esp
+  80154d:	52                   	push   %edx
+  80154e:	50                   	push   %eax
+  80154f:	68 f0 36 80 00       	push   $0x8036f0
+  801554:	e8 30 f0 ff ff       	call   800589 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801559:	83 c4 10             	add    $0x10,%esp
+  80155c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801561:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801564:	89 1a                	mov    %ebx,(%edx)
+}
+  801566:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801569:	c9                   	leave
+  80156a:	c3                   	ret
+
+0080156b <fd_close>:
+{
+  80156b:	55                   	push   %ebp
+  80156c:	89 e5                	mov    %esp,%ebp
+  80156e:	57                   	push   %edi
+  80156f:	56                   	push   %esi
+  801570:	53                   	push   %ebx
+  801571:	83 ec 24             	sub    $0x24,%esp
+  801574:	8b 75 08             	mov    0x8(%ebp),%esi
+  801577:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80157a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80157d:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80157e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801584:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801587:	50                   	push   %eax
+  801588:	e8 42 ff ff ff       	call   8014cf <fd_lookup>
+  80158d:	89 c3                	mov    %eax,%ebx
+  80158f:	83 c4 10             	add    $0x10,%esp
+  801592:	85 c0                	test   %eax,%eax
+  801594:	78 05                	js     80159b <fd_close+0x30>
+      || fd != fd2)
+  801596:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801599:	74 16                	je     8015b1 <fd_close+0x46>
+    return must_exist ? r : 0;
+  80159b:	89 f8                	mov    %edi,%eax
+  80159d:	84 c0                	test   %al,%al
+  80159f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a4:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8015a7:	89 d8                	mov    %ebx,%eax
+  8015a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ac:	5b                   	pop    %ebx
+  8015ad:	5e                   	pop    %esi
+  8015ae:	5f                   	pop    %edi
+  8015af:	5d                   	pop    %ebp
+  8015b0:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8015b1:	83 ec 08             	sub    $0x8,%esp
+  8015b4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8015b7:	50                   	push   %eax
+  8015b8:	ff 36                	push   (%esi)
+  8015ba:	e8 60 ff ff ff       	call   80151f <dev_lookup>
+  8015bf:	89 c3                	mov    %eax,%ebx
+  8015c1:	83 c4 10             	add    $0x10,%esp
+  8015c4:	85 c0                	test   %eax,%eax
+  8015c6:	78 1a                	js     8015e2 <fd_close+0x77>
+    if (dev->dev_close)
+  8015c8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015cb:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8015ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8015d3:	85 c0                	test   %eax,%eax
+  8015d5:	74 0b                	je     8015e2 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8015d7:	83 ec 0c             	sub    $0xc,%esp
+  8015da:	56                   	push   %esi
+  8015db:	ff d0                	call   *%eax
+  8015dd:	89 c3                	mov    %eax,%ebx
+  8015df:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8015e2:	83 ec 08             	sub    $0x8,%esp
+  8015e5:	56                   	push   %esi
+  8015e6:	6a 00                	push   $0x0
+  8015e8:	e8 3e fa ff ff       	call   80102b <sys_page_unmap>
+  return r;
+  8015ed:	83 c4 10             	add    $0x10,%esp
+  8015f0:	eb b5                	jmp    8015a7 <fd_close+0x3c>
+
+008015f2 <close>:
+
+int
+close(int fdnum)
+{
+  8015f2:	55                   	push   %ebp
+  8015f3:	89 e5                	mov    %esp,%ebp
+  8015f5:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015fb:	50                   	push   %eax
+  8015fc:	ff 75 08             	push   0x8(%ebp)
+  8015ff:	e8 cb fe ff ff       	call   8014cf <fd_lookup>
+  801604:	83 c4 10             	add    $0x10,%esp
+  801607:	85 c0                	test   %eax,%eax
+  801609:	79 02                	jns    80160d <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80160b:	c9                   	leave
+  80160c:	c3                   	ret
+    return fd_close(fd, 1);
+  80160d:	83 ec 08             	sub    $0x8,%esp
+  801610:	6a 01                	push   $0x1
+  801612:	ff 75 f4             	push   -0xc(%ebp)
+  801615:	e8 51 ff ff ff       	call   80156b <fd_close>
+  80161a:	83 c4 10             	add    $0x10,%esp
+  80161d:	eb ec                	jmp    80160b <close+0x19>
+
+0080161f <close_all>:
+
+void
+close_all(void)
+{
+  80161f:	55                   	push   %ebp
+  801620:	89 e5                	mov    %esp,%ebp
+  801622:	53                   	push   %ebx
+  801623:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801626:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80162b:	83 ec 0c             	sub    $0xc,%esp
+  80162e:	53                   	push   %ebx
+  80162f:	e8 be ff ff ff       	call   8015f2 <close>
+  for (i = 0; i < MAXFD; i++)
+  801634:	83 c3 01             	add    $0x1,%ebx
+  801637:	83 c4 10             	add    $0x10,%esp
+  80163a:	83 fb 20             	cmp    $0x20,%ebx
+  80163d:	75 ec                	jne    80162b <close_all+0xc>
+}
+  80163f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801642:	c9                   	leave
+  801643:	c3                   	ret
+
+00801644 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801644:	55                   	push   %ebp
+  801645:	89 e5                	mov    %esp,%ebp
+  801647:	57                   	push   %edi
+  801648:	56                   	push   %esi
+  801649:	53                   	push   %ebx
+  80164a:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80164d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801650:	50                   	push   %eax
+  801651:	ff 75 08             	push   0x8(%ebp)
+  801654:	e8 76 fe ff ff       	call   8014cf <fd_lookup>
+  801659:	89 c6                	mov    %eax,%esi
+  80165b:	83 c4 10             	add    $0x10,%esp
+  80165e:	85 c0                	test   %eax,%eax
+  801660:	0f 88 0a 01 00 00    	js     801770 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801666:	83 ec 0c             	sub    $0xc,%esp
+  801669:	ff 75 0c             	push   0xc(%ebp)
+  80166c:	e8 81 ff ff ff       	call   8015f2 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801671:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801674:	c1 e0 0c             	shl    $0xc,%eax
+  801677:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80167d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801680:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801683:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801686:	89 04 24             	mov    %eax,(%esp)
+  801689:	e8 d7 fd ff ff       	call   801465 <fd2data>
+  80168e:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801690:	89 3c 24             	mov    %edi,(%esp)
+  801693:	e8 cd fd ff ff       	call   801465 <fd2data>
+  801698:	83 c4 10             	add    $0x10,%esp
+  80169b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80169e:	89 f3                	mov    %esi,%ebx
+  8016a0:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8016a6:	89 c6                	mov    %eax,%esi
+  8016a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8016ab:	89 cf                	mov    %ecx,%edi
+  8016ad:	eb 0c                	jmp    8016bb <dup+0x77>
+  8016af:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8016b5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8016bb:	39 fb                	cmp    %edi,%ebx
+  8016bd:	74 7b                	je     80173a <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8016bf:	89 d8                	mov    %ebx,%eax
+  8016c1:	c1 e8 16             	shr    $0x16,%eax
+  8016c4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8016cb:	a8 01                	test   $0x1,%al
+  8016cd:	74 e0                	je     8016af <dup+0x6b>
+  8016cf:	89 d8                	mov    %ebx,%eax
+  8016d1:	c1 e8 0c             	shr    $0xc,%eax
+  8016d4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016db:	f6 c2 01             	test   $0x1,%dl
+  8016de:	74 cf                	je     8016af <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8016e0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8016e7:	83 ec 0c             	sub    $0xc,%esp
+  8016ea:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016ef:	50                   	push   %eax
+  8016f0:	56                   	push   %esi
+  8016f1:	6a 00                	push   $0x0
+  8016f3:	53                   	push   %ebx
+  8016f4:	6a 00                	push   $0x0
+  8016f6:	e8 ee f8 ff ff       	call   800fe9 <sys_page_map>
+  8016fb:	83 c4 20             	add    $0x20,%esp
+  8016fe:	85 c0                	test   %eax,%eax
+  801700:	79 ad                	jns    8016af <dup+0x6b>
+  801702:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801705:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801707:	83 ec 08             	sub    $0x8,%esp
+  80170a:	ff 75 d4             	push   -0x2c(%ebp)
+  80170d:	6a 00                	push   $0x0
+  80170f:	e8 17 f9 ff ff       	call   80102b <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801714:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801717:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  80171d:	83 c4 10             	add    $0x10,%esp
+  801720:	39 df                	cmp    %ebx,%edi
+  801722:	74 4c                	je     801770 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801724:	83 ec 08             	sub    $0x8,%esp
+  801727:	57                   	push   %edi
+  801728:	6a 00                	push   $0x0
+  80172a:	e8 fc f8 ff ff       	call   80102b <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80172f:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801735:	83 c4 10             	add    $0x10,%esp
+  801738:	eb e6                	jmp    801720 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80173a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80173d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801740:	89 c8                	mov    %ecx,%eax
+  801742:	c1 e8 0c             	shr    $0xc,%eax
+  801745:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80174c:	83 ec 0c             	sub    $0xc,%esp
+  80174f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801754:	50                   	push   %eax
+  801755:	ff 75 d4             	push   -0x2c(%ebp)
+  801758:	6a 00                	push   $0x0
+  80175a:	51                   	push   %ecx
+  80175b:	6a 00                	push   $0x0
+  80175d:	e8 87 f8 ff ff       	call   800fe9 <sys_page_map>
+  801762:	89 c6                	mov    %eax,%esi
+  801764:	83 c4 20             	add    $0x20,%esp
+  801767:	85 c0                	test   %eax,%eax
+  801769:	78 9c                	js     801707 <dup+0xc3>
+  return newfdnum;
+  80176b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80176e:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801770:	89 f0                	mov    %esi,%eax
+  801772:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801775:	5b                   	pop    %ebx
+  801776:	5e                   	pop    %esi
+  801777:	5f                   	pop    %edi
+  801778:	5d                   	pop    %ebp
+  801779:	c3                   	ret
+
+0080177a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80177a:	55                   	push   %ebp
+  80177b:	89 e5                	mov    %esp,%ebp
+  80177d:	56                   	push   %esi
+  80177e:	53                   	push   %ebx
+  80177f:	83 ec 18             	sub    $0x18,%esp
+  801782:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801785:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801788:	50                   	push   %eax
+  801789:	56                   	push   %esi
+  80178a:	e8 40 fd ff ff       	call   8014cf <fd_lookup>
+  80178f:	83 c4 10             	add    $0x10,%esp
+  801792:	85 c0                	test   %eax,%eax
+  801794:	78 3c                	js     8017d2 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801796:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801799:	83 ec 08             	sub    $0x8,%esp
+  80179c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80179f:	50                   	push   %eax
+  8017a0:	ff 33                	push   (%ebx)
+  8017a2:	e8 78 fd ff ff       	call   80151f <dev_lookup>
+  8017a7:	83 c4 10             	add    $0x10,%esp
+  8017aa:	85 c0                	test   %eax,%eax
+  8017ac:	78 24                	js     8017d2 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8017ae:	8b 43 08             	mov    0x8(%ebx),%eax
+  8017b1:	83 e0 03             	and    $0x3,%eax
+  8017b4:	83 f8 01             	cmp    $0x1,%eax
+  8017b7:	74 20                	je     8017d9 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8017b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017bc:	8b 40 08             	mov    0x8(%eax),%eax
+  8017bf:	85 c0                	test   %eax,%eax
+  8017c1:	74 37                	je     8017fa <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8017c3:	83 ec 04             	sub    $0x4,%esp
+  8017c6:	ff 75 10             	push   0x10(%ebp)
+  8017c9:	ff 75 0c             	push   0xc(%ebp)
+  8017cc:	53                   	push   %ebx
+  8017cd:	ff d0                	call   *%eax
+  8017cf:	83 c4 10             	add    $0x10,%esp
+}
+  8017d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017d5:	5b                   	pop    %ebx
+  8017d6:	5e                   	pop    %esi
+  8017d7:	5d                   	pop    %ebp
+  8017d8:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017d9:	a1 44 67 80 00       	mov    0x806744,%eax
+  8017de:	8b 40 48             	mov    0x48(%eax),%eax
+  8017e1:	83 ec 04             	sub    $0x4,%esp
+  8017e4:	56                   	push   %esi
+  8017e5:	50                   	push   %eax
+  8017e6:	68 31 37 80 00       	push   $0x803731
+  8017eb:	e8 99 ed ff ff       	call   800589 <cprintf>
+    return -E_INVAL;
+  8017f0:	83 c4 10             	add    $0x10,%esp
+  8017f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f8:	eb d8                	jmp    8017d2 <read+0x58>
+    return -E_NOT_SUPP;
+  8017fa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017ff:	eb d1                	jmp    8017d2 <read+0x58>
+
+00801801 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801801:	55                   	push   %ebp
+  801802:	89 e5                	mov    %esp,%ebp
+  801804:	57                   	push   %edi
+  801805:	56                   	push   %esi
+  801806:	53                   	push   %ebx
+  801807:	83 ec 0c             	sub    $0xc,%esp
+  80180a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80180d:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801810:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801815:	eb 02                	jmp    801819 <readn+0x18>
+  801817:	01 c3                	add    %eax,%ebx
+  801819:	39 f3                	cmp    %esi,%ebx
+  80181b:	73 21                	jae    80183e <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80181d:	83 ec 04             	sub    $0x4,%esp
+  801820:	89 f0                	mov    %esi,%eax
+  801822:	29 d8                	sub    %ebx,%eax
+  801824:	50                   	push   %eax
+  801825:	89 d8                	mov    %ebx,%eax
+  801827:	03 45 0c             	add    0xc(%ebp),%eax
+  80182a:	50                   	push   %eax
+  80182b:	57                   	push   %edi
+  80182c:	e8 49 ff ff ff       	call   80177a <read>
+    if (m < 0)
+  801831:	83 c4 10             	add    $0x10,%esp
+  801834:	85 c0                	test   %eax,%eax
+  801836:	78 04                	js     80183c <readn+0x3b>
+      return m;
+    if (m == 0)
+  801838:	75 dd                	jne    801817 <readn+0x16>
+  80183a:	eb 02                	jmp    80183e <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80183c:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  80183e:	89 d8                	mov    %ebx,%eax
+  801840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801843:	5b                   	pop    %ebx
+  801844:	5e                   	pop    %esi
+  801845:	5f                   	pop    %edi
+  801846:	5d                   	pop    %ebp
+  801847:	c3                   	ret
+
+00801848 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801848:	55                   	push   %ebp
+  801849:	89 e5                	mov    %esp,%ebp
+  80184b:	56                   	push   %esi
+  80184c:	53                   	push   %ebx
+  80184d:	83 ec 18             	sub    $0x18,%esp
+  801850:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801853:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801856:	50                   	push   %eax
+  801857:	53                   	push   %ebx
+  801858:	e8 72 fc ff ff       	call   8014cf <fd_lookup>
+  80185d:	83 c4 10             	add    $0x10,%esp
+  801860:	85 c0                	test   %eax,%eax
+  801862:	78 37                	js     80189b <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801864:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801867:	83 ec 08             	sub    $0x8,%esp
+  80186a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80186d:	50                   	push   %eax
+  80186e:	ff 36                	push   (%esi)
+  801870:	e8 aa fc ff ff       	call   80151f <dev_lookup>
+  801875:	83 c4 10             	add    $0x10,%esp
+  801878:	85 c0                	test   %eax,%eax
+  80187a:	78 1f                	js     80189b <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80187c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801880:	74 20                	je     8018a2 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801882:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801885:	8b 40 0c             	mov    0xc(%eax),%eax
+  801888:	85 c0                	test   %eax,%eax
+  80188a:	74 37                	je     8018c3 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  80188c:	83 ec 04             	sub    $0x4,%esp
+  80188f:	ff 75 10             	push   0x10(%ebp)
+  801892:	ff 75 0c             	push   0xc(%ebp)
+  801895:	56                   	push   %esi
+  801896:	ff d0                	call   *%eax
+  801898:	83 c4 10             	add    $0x10,%esp
+}
+  80189b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80189e:	5b                   	pop    %ebx
+  80189f:	5e                   	pop    %esi
+  8018a0:	5d                   	pop    %ebp
+  8018a1:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018a2:	a1 44 67 80 00       	mov    0x806744,%eax
+  8018a7:	8b 40 48             	mov    0x48(%eax),%eax
+  8018aa:	83 ec 04             	sub    $0x4,%esp
+  8018ad:	53                   	push   %ebx
+  8018ae:	50                   	push   %eax
+  8018af:	68 4d 37 80 00       	push   $0x80374d
+  8018b4:	e8 d0 ec ff ff       	call   800589 <cprintf>
+    return -E_INVAL;
+  8018b9:	83 c4 10             	add    $0x10,%esp
+  8018bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018c1:	eb d8                	jmp    80189b <write+0x53>
+    return -E_NOT_SUPP;
+  8018c3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018c8:	eb d1                	jmp    80189b <write+0x53>
+
+008018ca <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8018ca:	55                   	push   %ebp
+  8018cb:	89 e5                	mov    %esp,%ebp
+  8018cd:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018d3:	50                   	push   %eax
+  8018d4:	ff 75 08             	push   0x8(%ebp)
+  8018d7:	e8 f3 fb ff ff       	call   8014cf <fd_lookup>
+  8018dc:	83 c4 10             	add    $0x10,%esp
+  8018df:	85 c0                	test   %eax,%eax
+  8018e1:	78 0e                	js     8018f1 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8018e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018e9:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8018ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018f1:	c9                   	leave
+  8018f2:	c3                   	ret
+
+008018f3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018f3:	55                   	push   %ebp
+  8018f4:	89 e5                	mov    %esp,%ebp
+  8018f6:	56                   	push   %esi
+  8018f7:	53                   	push   %ebx
+  8018f8:	83 ec 18             	sub    $0x18,%esp
+  8018fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018fe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801901:	50                   	push   %eax
+  801902:	53                   	push   %ebx
+  801903:	e8 c7 fb ff ff       	call   8014cf <fd_lookup>
+  801908:	83 c4 10             	add    $0x10,%esp
+  80190b:	85 c0                	test   %eax,%eax
+  80190d:	78 34                	js     801943 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80190f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801912:	83 ec 08             	sub    $0x8,%esp
+  801915:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801918:	50                   	push   %eax
+  801919:	ff 36                	push   (%esi)
+  80191b:	e8 ff fb ff ff       	call   80151f <dev_lookup>
+  801920:	83 c4 10             	add    $0x10,%esp
+  801923:	85 c0                	test   %eax,%eax
+  801925:	78 1c                	js     801943 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801927:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80192b:	74 1d                	je     80194a <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  80192d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801930:	8b 40 18             	mov    0x18(%eax),%eax
+  801933:	85 c0                	test   %eax,%eax
+  801935:	74 34                	je     80196b <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801937:	83 ec 08             	sub    $0x8,%esp
+  80193a:	ff 75 0c             	push   0xc(%ebp)
+  80193d:	56                   	push   %esi
+  80193e:	ff d0                	call   *%eax
+  801940:	83 c4 10             	add    $0x10,%esp
+}
+  801943:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801946:	5b                   	pop    %ebx
+  801947:	5e                   	pop    %esi
+  801948:	5d                   	pop    %ebp
+  801949:	c3                   	ret
+            thisenv->env_id, fdnum);
+  80194a:	a1 44 67 80 00       	mov    0x806744,%eax
+  80194f:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801952:	83 ec 04             	sub    $0x4,%esp
+  801955:	53                   	push   %ebx
+  801956:	50                   	push   %eax
+  801957:	68 10 37 80 00       	push   $0x803710
+  80195c:	e8 28 ec ff ff       	call   800589 <cprintf>
+    return -E_INVAL;
+  801961:	83 c4 10             	add    $0x10,%esp
+  801964:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801969:	eb d8                	jmp    801943 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  80196b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801970:	eb d1                	jmp    801943 <ftruncate+0x50>
+
+00801972 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801972:	55                   	push   %ebp
+  801973:	89 e5                	mov    %esp,%ebp
+  801975:	56                   	push   %esi
+  801976:	53                   	push   %ebx
+  801977:	83 ec 18             	sub    $0x18,%esp
+  80197a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80197d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801980:	50                   	push   %eax
+  801981:	ff 75 08             	push   0x8(%ebp)
+  801984:	e8 46 fb ff ff       	call   8014cf <fd_lookup>
+  801989:	83 c4 10             	add    $0x10,%esp
+  80198c:	85 c0                	test   %eax,%eax
+  80198e:	78 49                	js     8019d9 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801990:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801993:	83 ec 08             	sub    $0x8,%esp
+  801996:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801999:	50                   	push   %eax
+  80199a:	ff 36                	push   (%esi)
+  80199c:	e8 7e fb ff ff       	call   80151f <dev_lookup>
+  8019a1:	83 c4 10             	add    $0x10,%esp
+  8019a4:	85 c0                	test   %eax,%eax
+  8019a6:	78 31                	js     8019d9 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  8019a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019ab:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8019af:	74 2f                	je     8019e0 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8019b1:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8019b4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8019bb:	00 00 00 
+  stat->st_isdir = 0;
+  8019be:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8019c5:	00 00 00 
+  stat->st_dev = dev;
+  8019c8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8019ce:	83 ec 08             	sub    $0x8,%esp
+  8019d1:	53                   	push   %ebx
+  8019d2:	56                   	push   %esi
+  8019d3:	ff 50 14             	call   *0x14(%eax)
+  8019d6:	83 c4 10             	add    $0x10,%esp
+}
+  8019d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019dc:	5b                   	pop    %ebx
+  8019dd:	5e                   	pop    %esi
+  8019de:	5d                   	pop    %ebp
+  8019df:	c3                   	ret
+    return -E_NOT_SUPP;
+  8019e0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019e5:	eb f2                	jmp    8019d9 <fstat+0x67>
+
+008019e7 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8019e7:	55                   	push   %ebp
+  8019e8:	89 e5                	mov    %esp,%ebp
+  8019ea:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8019ed:	ff 75 0c             	push   0xc(%ebp)
+  8019f0:	ff 75 08             	push   0x8(%ebp)
+  8019f3:	e8 58 07 00 00       	call   802150 <file_stat>
+}
+  8019f8:	c9                   	leave
+  8019f9:	c3                   	ret
+
+008019fa <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8019fa:	55                   	push   %ebp
+  8019fb:	89 e5                	mov    %esp,%ebp
+  8019fd:	57                   	push   %edi
+  8019fe:	56                   	push   %esi
+  8019ff:	53                   	push   %ebx
+  801a00:	83 ec 1c             	sub    $0x1c,%esp
+  801a03:	89 c7                	mov    %eax,%edi
+  801a05:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a08:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801a0b:	e9 a2 00 00 00       	jmp    801ab2 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801a10:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801a17:	00 00 00 
+  801a1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801a24:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801a29:	be 01 00 00 00       	mov    $0x1,%esi
+  801a2e:	eb 0f                	jmp    801a3f <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801a30:	83 c0 01             	add    $0x1,%eax
+  801a33:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801a38:	74 49                	je     801a83 <fsipc_send+0x89>
+  801a3a:	83 f9 07             	cmp    $0x7,%ecx
+  801a3d:	7f 50                	jg     801a8f <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801a3f:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801a42:	c1 e2 04             	shl    $0x4,%edx
+  801a45:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801a4b:	8b 52 50             	mov    0x50(%edx),%edx
+  801a4e:	83 fa 01             	cmp    $0x1,%edx
+  801a51:	75 dd                	jne    801a30 <fsipc_send+0x36>
+  801a53:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801a56:	c1 e2 04             	shl    $0x4,%edx
+  801a59:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801a5f:	8b 52 54             	mov    0x54(%edx),%edx
+  801a62:	85 d2                	test   %edx,%edx
+  801a64:	74 ca                	je     801a30 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801a66:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801a69:	c1 e2 04             	shl    $0x4,%edx
+  801a6c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801a72:	8b 52 48             	mov    0x48(%edx),%edx
+  801a75:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801a7c:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801a7f:	89 f3                	mov    %esi,%ebx
+  801a81:	eb ad                	jmp    801a30 <fsipc_send+0x36>
+  801a83:	84 db                	test   %bl,%bl
+  801a85:	74 38                	je     801abf <fsipc_send+0xc5>
+  801a87:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801a8d:	eb 30                	jmp    801abf <fsipc_send+0xc5>
+  801a8f:	84 db                	test   %bl,%bl
+  801a91:	74 2c                	je     801abf <fsipc_send+0xc5>
+  801a93:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801a99:	eb 24                	jmp    801abf <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801a9b:	50                   	push   %eax
+  801a9c:	68 7c 37 80 00       	push   $0x80377c
+  801aa1:	6a 34                	push   $0x34
+  801aa3:	68 86 37 80 00       	push   $0x803786
+  801aa8:	e8 01 ea ff ff       	call   8004ae <_panic>
+    }
+    sys_yield();
+  801aad:	e8 92 f4 ff ff       	call   800f44 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801ab2:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801ab9:	0f 8e 51 ff ff ff    	jle    801a10 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801abf:	a1 44 67 80 00       	mov    0x806744,%eax
+  801ac4:	8b 70 48             	mov    0x48(%eax),%esi
+  801ac7:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801acd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad2:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801ad8:	39 d9                	cmp    %ebx,%ecx
+  801ada:	7e d1                	jle    801aad <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801adc:	83 ec 0c             	sub    $0xc,%esp
+  801adf:	ff 75 e0             	push   -0x20(%ebp)
+  801ae2:	6a 07                	push   $0x7
+  801ae4:	ff 75 e4             	push   -0x1c(%ebp)
+  801ae7:	57                   	push   %edi
+  801ae8:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801aeb:	99                   	cltd
+  801aec:	f7 f9                	idiv   %ecx
+  801aee:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801af5:	e8 63 f7 ff ff       	call   80125d <sys_ipc_try_send>
+      if (r == 0)
+  801afa:	83 c4 20             	add    $0x20,%esp
+  801afd:	85 c0                	test   %eax,%eax
+  801aff:	74 0a                	je     801b0b <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801b01:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801b04:	75 95                	jne    801a9b <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801b06:	83 c3 01             	add    $0x1,%ebx
+  801b09:	eb c7                	jmp    801ad2 <fsipc_send+0xd8>
+  }
+}
+  801b0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b0e:	5b                   	pop    %ebx
+  801b0f:	5e                   	pop    %esi
+  801b10:	5f                   	pop    %edi
+  801b11:	5d                   	pop    %ebp
+  801b12:	c3                   	ret
+
+00801b13 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801b13:	55                   	push   %ebp
+  801b14:	89 e5                	mov    %esp,%ebp
+  801b16:	53                   	push   %ebx
+  801b17:	83 ec 14             	sub    $0x14,%esp
+  801b1a:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801b1c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801b23:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b28:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801b2d:	e8 c8 fe ff ff       	call   8019fa <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801b32:	6a 00                	push   $0x0
+  801b34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b37:	50                   	push   %eax
+  801b38:	53                   	push   %ebx
+  801b39:	6a 00                	push   $0x0
+  801b3b:	e8 26 13 00 00       	call   802e66 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801b40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b43:	c9                   	leave
+  801b44:	c3                   	ret
+
+00801b45 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801b45:	55                   	push   %ebp
+  801b46:	89 e5                	mov    %esp,%ebp
+  801b48:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b51:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801b56:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b59:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801b5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b63:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b68:	e8 a6 ff ff ff       	call   801b13 <fsipc>
+}
+  801b6d:	c9                   	leave
+  801b6e:	c3                   	ret
+
+00801b6f <devfile_flush>:
+{
+  801b6f:	55                   	push   %ebp
+  801b70:	89 e5                	mov    %esp,%ebp
+  801b72:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b75:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b78:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b7b:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b80:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b85:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b8a:	e8 84 ff ff ff       	call   801b13 <fsipc>
+}
+  801b8f:	c9                   	leave
+  801b90:	c3                   	ret
+
+00801b91 <devfile_stat>:
+{
+  801b91:	55                   	push   %ebp
+  801b92:	89 e5                	mov    %esp,%ebp
+  801b94:	53                   	push   %ebx
+  801b95:	83 ec 04             	sub    $0x4,%esp
+  801b98:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b9e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ba1:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ba6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bab:	b8 05 00 00 00       	mov    $0x5,%eax
+  801bb0:	e8 5e ff ff ff       	call   801b13 <fsipc>
+  801bb5:	85 c0                	test   %eax,%eax
+  801bb7:	78 2c                	js     801be5 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801bb9:	83 ec 08             	sub    $0x8,%esp
+  801bbc:	68 00 70 80 00       	push   $0x807000
+  801bc1:	53                   	push   %ebx
+  801bc2:	e8 b0 ef ff ff       	call   800b77 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801bc7:	a1 80 70 80 00       	mov    0x807080,%eax
+  801bcc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801bd2:	a1 84 70 80 00       	mov    0x807084,%eax
+  801bd7:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801bdd:	83 c4 10             	add    $0x10,%esp
+  801be0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801be5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be8:	c9                   	leave
+  801be9:	c3                   	ret
+
+00801bea <fsv_alloc>:
+{
+  801bea:	55                   	push   %ebp
+  801beb:	89 e5                	mov    %esp,%ebp
+  801bed:	56                   	push   %esi
+  801bee:	53                   	push   %ebx
+  801bef:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801bf1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bf6:	eb 22                	jmp    801c1a <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801bf8:	83 ec 04             	sub    $0x4,%esp
+  801bfb:	6a 00                	push   $0x0
+  801bfd:	6a 00                	push   $0x0
+  801bff:	6a 07                	push   $0x7
+  801c01:	50                   	push   %eax
+  801c02:	6a 00                	push   $0x0
+  801c04:	6a 04                	push   $0x4
+  801c06:	68 40 60 80 00       	push   $0x806040
+  801c0b:	e8 e9 f7 ff ff       	call   8013f9 <sysbatch_add>
+  801c10:	83 c4 20             	add    $0x20,%esp
+  801c13:	85 c0                	test   %eax,%eax
+  801c15:	78 48                	js     801c5f <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801c17:	83 c3 01             	add    $0x1,%ebx
+  801c1a:	39 f3                	cmp    %esi,%ebx
+  801c1c:	74 31                	je     801c4f <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801c1e:	89 d8                	mov    %ebx,%eax
+  801c20:	c1 e0 0c             	shl    $0xc,%eax
+  801c23:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801c28:	89 c2                	mov    %eax,%edx
+  801c2a:	c1 ea 16             	shr    $0x16,%edx
+  801c2d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c34:	f6 c2 01             	test   $0x1,%dl
+  801c37:	74 bf                	je     801bf8 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801c39:	89 c2                	mov    %eax,%edx
+  801c3b:	c1 ea 0c             	shr    $0xc,%edx
+  801c3e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c45:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801c48:	83 fa 03             	cmp    $0x3,%edx
+  801c4b:	75 ab                	jne    801bf8 <fsv_alloc+0xe>
+  801c4d:	eb c8                	jmp    801c17 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801c4f:	83 ec 0c             	sub    $0xc,%esp
+  801c52:	68 40 60 80 00       	push   $0x806040
+  801c57:	e8 4d f7 ff ff       	call   8013a9 <sysbatch_flush>
+  801c5c:	83 c4 10             	add    $0x10,%esp
+}
+  801c5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c62:	5b                   	pop    %ebx
+  801c63:	5e                   	pop    %esi
+  801c64:	5d                   	pop    %ebp
+  801c65:	c3                   	ret
+
+00801c66 <devfile_read>:
+{
+  801c66:	55                   	push   %ebp
+  801c67:	89 e5                	mov    %esp,%ebp
+  801c69:	57                   	push   %edi
+  801c6a:	56                   	push   %esi
+  801c6b:	53                   	push   %ebx
+  801c6c:	83 ec 3c             	sub    $0x3c,%esp
+  801c6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801c72:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801c78:	77 57                	ja     801cd1 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c80:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801c85:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c90:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c95:	e8 79 fe ff ff       	call   801b13 <fsipc>
+  801c9a:	89 c6                	mov    %eax,%esi
+  801c9c:	85 c0                	test   %eax,%eax
+  801c9e:	78 27                	js     801cc7 <devfile_read+0x61>
+  assert(r <= n);
+  801ca0:	39 c3                	cmp    %eax,%ebx
+  801ca2:	0f 82 0e 02 00 00    	jb     801eb6 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801ca8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801cad:	0f 8f 1c 02 00 00    	jg     801ecf <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801cb3:	83 ec 04             	sub    $0x4,%esp
+  801cb6:	50                   	push   %eax
+  801cb7:	68 00 70 80 00       	push   $0x807000
+  801cbc:	ff 75 0c             	push   0xc(%ebp)
+  801cbf:	e8 39 f0 ff ff       	call   800cfd <memmove>
+  return r;
+  801cc4:	83 c4 10             	add    $0x10,%esp
+}
+  801cc7:	89 f0                	mov    %esi,%eax
+  801cc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ccc:	5b                   	pop    %ebx
+  801ccd:	5e                   	pop    %esi
+  801cce:	5f                   	pop    %edi
+  801ccf:	5d                   	pop    %ebp
+  801cd0:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801cd1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cd6:	e8 0f ff ff ff       	call   801bea <fsv_alloc>
+  801cdb:	89 c6                	mov    %eax,%esi
+  801cdd:	85 c0                	test   %eax,%eax
+  801cdf:	78 e6                	js     801cc7 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801ce1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ce4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ce7:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801cec:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cef:	8b 40 04             	mov    0x4(%eax),%eax
+  801cf2:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801cf7:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801cfd:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801d04:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d09:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801d0e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d13:	e8 e2 fc ff ff       	call   8019fa <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801d18:	6a 00                	push   $0x0
+  801d1a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d1d:	50                   	push   %eax
+  801d1e:	68 00 10 c0 9f       	push   $0x9fc01000
+  801d23:	6a 00                	push   $0x0
+  801d25:	e8 3c 11 00 00       	call   802e66 <ipc_recv_pages>
+  801d2a:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801d2c:	83 c4 10             	add    $0x10,%esp
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	7e 94                	jle    801cc7 <devfile_read+0x61>
+  assert(r <= n);
+  801d33:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d36:	39 c3                	cmp    %eax,%ebx
+  801d38:	72 2e                	jb     801d68 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801d3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d3d:	8b 40 04             	mov    0x4(%eax),%eax
+  801d40:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801d45:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801d48:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d4b:	c1 e2 0c             	shl    $0xc,%edx
+  801d4e:	39 ca                	cmp    %ecx,%edx
+  801d50:	72 2f                	jb     801d81 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801d52:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801d57:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801d5a:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801d5e:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801d63:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801d66:	eb 52                	jmp    801dba <devfile_read+0x154>
+  assert(r <= n);
+  801d68:	68 91 37 80 00       	push   $0x803791
+  801d6d:	68 98 37 80 00       	push   $0x803798
+  801d72:	68 49 01 00 00       	push   $0x149
+  801d77:	68 86 37 80 00       	push   $0x803786
+  801d7c:	e8 2d e7 ff ff       	call   8004ae <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801d81:	68 bc 37 80 00       	push   $0x8037bc
+  801d86:	68 98 37 80 00       	push   $0x803798
+  801d8b:	68 4a 01 00 00       	push   $0x14a
+  801d90:	68 86 37 80 00       	push   $0x803786
+  801d95:	e8 14 e7 ff ff       	call   8004ae <_panic>
+      memmove(dst + done, src + done, m);
+  801d9a:	83 ec 04             	sub    $0x4,%esp
+  801d9d:	53                   	push   %ebx
+  801d9e:	56                   	push   %esi
+  801d9f:	89 f8                	mov    %edi,%eax
+  801da1:	03 45 0c             	add    0xc(%ebp),%eax
+  801da4:	50                   	push   %eax
+  801da5:	e8 53 ef ff ff       	call   800cfd <memmove>
+  801daa:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801dad:	01 df                	add    %ebx,%edi
+  801daf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801db2:	39 c7                	cmp    %eax,%edi
+  801db4:	0f 83 c0 00 00 00    	jae    801e7a <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801dba:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801dbd:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801dc0:	89 f0                	mov    %esi,%eax
+  801dc2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801dc7:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801dcc:	29 c3                	sub    %eax,%ebx
+  801dce:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801dd1:	29 f8                	sub    %edi,%eax
+  801dd3:	39 c3                	cmp    %eax,%ebx
+  801dd5:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801dd8:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801dde:	75 ba                	jne    801d9a <devfile_read+0x134>
+  801de0:	89 f9                	mov    %edi,%ecx
+  801de2:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801de5:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801de8:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801dee:	75 aa                	jne    801d9a <devfile_read+0x134>
+  801df0:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801df6:	77 a2                	ja     801d9a <devfile_read+0x134>
+  801df8:	89 c8                	mov    %ecx,%eax
+  801dfa:	c1 e8 16             	shr    $0x16,%eax
+  801dfd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e04:	a8 01                	test   $0x1,%al
+  801e06:	74 92                	je     801d9a <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801e08:	89 c8                	mov    %ecx,%eax
+  801e0a:	c1 e8 0c             	shr    $0xc,%eax
+  801e0d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801e14:	a8 01                	test   $0x1,%al
+  801e16:	74 82                	je     801d9a <devfile_read+0x134>
+  801e18:	a9 02 08 00 00       	test   $0x802,%eax
+  801e1d:	0f 84 77 ff ff ff    	je     801d9a <devfile_read+0x134>
+  801e23:	f6 c4 04             	test   $0x4,%ah
+  801e26:	0f 85 6e ff ff ff    	jne    801d9a <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801e2c:	a1 44 67 80 00       	mov    0x806744,%eax
+  801e31:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801e35:	84 c0                	test   %al,%al
+  801e37:	75 17                	jne    801e50 <devfile_read+0x1ea>
+  801e39:	83 ec 08             	sub    $0x8,%esp
+  801e3c:	6a 01                	push   $0x1
+  801e3e:	6a 00                	push   $0x0
+  801e40:	e8 1e f1 ff ff       	call   800f63 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801e45:	83 c4 10             	add    $0x10,%esp
+  801e48:	85 c0                	test   %eax,%eax
+  801e4a:	0f 85 4a ff ff ff    	jne    801d9a <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801e50:	83 ec 04             	sub    $0x4,%esp
+  801e53:	68 05 08 00 00       	push   $0x805
+  801e58:	ff 75 cc             	push   -0x34(%ebp)
+  801e5b:	6a 00                	push   $0x0
+  801e5d:	56                   	push   %esi
+  801e5e:	6a 00                	push   $0x0
+  801e60:	6a 05                	push   $0x5
+  801e62:	68 40 60 80 00       	push   $0x806040
+  801e67:	e8 8d f5 ff ff       	call   8013f9 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801e6c:	c1 e8 1f             	shr    $0x1f,%eax
+  801e6f:	08 45 cb             	or     %al,-0x35(%ebp)
+  801e72:	83 c4 20             	add    $0x20,%esp
+  801e75:	e9 33 ff ff ff       	jmp    801dad <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801e7a:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801e7d:	83 ec 0c             	sub    $0xc,%esp
+  801e80:	68 40 60 80 00       	push   $0x806040
+  801e85:	e8 1f f5 ff ff       	call   8013a9 <sysbatch_flush>
+  801e8a:	83 c4 10             	add    $0x10,%esp
+  801e8d:	85 c0                	test   %eax,%eax
+  801e8f:	78 06                	js     801e97 <devfile_read+0x231>
+  801e91:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801e95:	74 14                	je     801eab <devfile_read+0x245>
+    memmove(dst, src, r);
+  801e97:	83 ec 04             	sub    $0x4,%esp
+  801e9a:	ff 75 d4             	push   -0x2c(%ebp)
+  801e9d:	ff 75 d0             	push   -0x30(%ebp)
+  801ea0:	ff 75 0c             	push   0xc(%ebp)
+  801ea3:	e8 55 ee ff ff       	call   800cfd <memmove>
+  801ea8:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801eab:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eae:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801eb1:	e9 11 fe ff ff       	jmp    801cc7 <devfile_read+0x61>
+  assert(r <= n);
+  801eb6:	68 91 37 80 00       	push   $0x803791
+  801ebb:	68 98 37 80 00       	push   $0x803798
+  801ec0:	68 1c 01 00 00       	push   $0x11c
+  801ec5:	68 86 37 80 00       	push   $0x803786
+  801eca:	e8 df e5 ff ff       	call   8004ae <_panic>
+  assert(r <= PGSIZE);
+  801ecf:	68 ad 37 80 00       	push   $0x8037ad
+  801ed4:	68 98 37 80 00       	push   $0x803798
+  801ed9:	68 1d 01 00 00       	push   $0x11d
+  801ede:	68 86 37 80 00       	push   $0x803786
+  801ee3:	e8 c6 e5 ff ff       	call   8004ae <_panic>
+
+00801ee8 <devfile_write>:
+{
+  801ee8:	55                   	push   %ebp
+  801ee9:	89 e5                	mov    %esp,%ebp
+  801eeb:	57                   	push   %edi
+  801eec:	56                   	push   %esi
+  801eed:	53                   	push   %ebx
+  801eee:	83 ec 1c             	sub    $0x1c,%esp
+  801ef1:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ef4:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801ef7:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801efc:	77 39                	ja     801f37 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801efe:	8b 56 0c             	mov    0xc(%esi),%edx
+  801f01:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  801f07:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801f0c:	83 ec 04             	sub    $0x4,%esp
+  801f0f:	50                   	push   %eax
+  801f10:	ff 75 0c             	push   0xc(%ebp)
+  801f13:	68 08 70 80 00       	push   $0x807008
+  801f18:	e8 e0 ed ff ff       	call   800cfd <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801f1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f22:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f27:	e8 e7 fb ff ff       	call   801b13 <fsipc>
+  801f2c:	83 c4 10             	add    $0x10,%esp
+}
+  801f2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f32:	5b                   	pop    %ebx
+  801f33:	5e                   	pop    %esi
+  801f34:	5f                   	pop    %edi
+  801f35:	5d                   	pop    %ebp
+  801f36:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801f37:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801f3c:	39 d0                	cmp    %edx,%eax
+  801f3e:	89 d3                	mov    %edx,%ebx
+  801f40:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801f43:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801f49:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801f4c:	83 c7 01             	add    $0x1,%edi
+  801f4f:	89 f8                	mov    %edi,%eax
+  801f51:	e8 94 fc ff ff       	call   801bea <fsv_alloc>
+  801f56:	85 c0                	test   %eax,%eax
+  801f58:	78 d5                	js     801f2f <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801f5a:	83 ec 04             	sub    $0x4,%esp
+  801f5d:	53                   	push   %ebx
+  801f5e:	ff 75 0c             	push   0xc(%ebp)
+  801f61:	68 00 10 c0 9f       	push   $0x9fc01000
+  801f66:	e8 92 ed ff ff       	call   800cfd <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801f6b:	8b 46 0c             	mov    0xc(%esi),%eax
+  801f6e:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801f73:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801f79:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801f80:	89 f9                	mov    %edi,%ecx
+  801f82:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801f87:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801f8c:	e8 69 fa ff ff       	call   8019fa <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801f91:	6a 00                	push   $0x0
+  801f93:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f96:	50                   	push   %eax
+  801f97:	6a 00                	push   $0x0
+  801f99:	6a 00                	push   $0x0
+  801f9b:	e8 c6 0e 00 00       	call   802e66 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801fa0:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801fa3:	eb 8a                	jmp    801f2f <devfile_write+0x47>
+
+00801fa5 <open>:
+{
+  801fa5:	55                   	push   %ebp
+  801fa6:	89 e5                	mov    %esp,%ebp
+  801fa8:	56                   	push   %esi
+  801fa9:	53                   	push   %ebx
+  801faa:	83 ec 1c             	sub    $0x1c,%esp
+  801fad:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801fb0:	56                   	push   %esi
+  801fb1:	e8 86 eb ff ff       	call   800b3c <strlen>
+  801fb6:	83 c4 10             	add    $0x10,%esp
+  801fb9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fbe:	7f 6c                	jg     80202c <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801fc0:	83 ec 0c             	sub    $0xc,%esp
+  801fc3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fc6:	50                   	push   %eax
+  801fc7:	e8 ad f4 ff ff       	call   801479 <fd_alloc>
+  801fcc:	89 c3                	mov    %eax,%ebx
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	78 3c                	js     802011 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801fd5:	83 ec 08             	sub    $0x8,%esp
+  801fd8:	56                   	push   %esi
+  801fd9:	68 00 70 80 00       	push   $0x807000
+  801fde:	e8 94 eb ff ff       	call   800b77 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801fe3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fe6:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801feb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fee:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ff3:	e8 1b fb ff ff       	call   801b13 <fsipc>
+  801ff8:	89 c3                	mov    %eax,%ebx
+  801ffa:	83 c4 10             	add    $0x10,%esp
+  801ffd:	85 c0                	test   %eax,%eax
+  801fff:	78 19                	js     80201a <open+0x75>
+  return fd2num(fd);
+  802001:	83 ec 0c             	sub    $0xc,%esp
+  802004:	ff 75 f4             	push   -0xc(%ebp)
+  802007:	e8 49 f4 ff ff       	call   801455 <fd2num>
+  80200c:	89 c3                	mov    %eax,%ebx
+  80200e:	83 c4 10             	add    $0x10,%esp
+}
+  802011:	89 d8                	mov    %ebx,%eax
+  802013:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802016:	5b                   	pop    %ebx
+  802017:	5e                   	pop    %esi
+  802018:	5d                   	pop    %ebp
+  802019:	c3                   	ret
+    fd_close(fd, 0);
+  80201a:	83 ec 08             	sub    $0x8,%esp
+  80201d:	6a 00                	push   $0x0
+  80201f:	ff 75 f4             	push   -0xc(%ebp)
+  802022:	e8 44 f5 ff ff       	call   80156b <fd_close>
+    return r;
+  802027:	83 c4 10             	add    $0x10,%esp
+  80202a:	eb e5                	jmp    802011 <open+0x6c>
+    return -E_BAD_PATH;
+  80202c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802031:	eb de                	jmp    802011 <open+0x6c>
+
+00802033 <open_read>:
+{
+  802033:	55                   	push   %ebp
+  802034:	89 e5                	mov    %esp,%ebp
+  802036:	57                   	push   %edi
+  802037:	56                   	push   %esi
+  802038:	53                   	push   %ebx
+  802039:	83 ec 28             	sub    $0x28,%esp
+  80203c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  80203f:	57                   	push   %edi
+  802040:	e8 f7 ea ff ff       	call   800b3c <strlen>
+  802045:	83 c4 10             	add    $0x10,%esp
+  802048:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80204d:	0f 87 f6 00 00 00    	ja     802149 <open_read+0x116>
+  802053:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  802055:	83 ec 0c             	sub    $0xc,%esp
+  802058:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80205b:	50                   	push   %eax
+  80205c:	e8 18 f4 ff ff       	call   801479 <fd_alloc>
+  802061:	89 c3                	mov    %eax,%ebx
+  802063:	83 c4 10             	add    $0x10,%esp
+  802066:	85 c0                	test   %eax,%eax
+  802068:	0f 88 b2 00 00 00    	js     802120 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  80206e:	83 ec 08             	sub    $0x8,%esp
+  802071:	57                   	push   %edi
+  802072:	68 e4 70 80 00       	push   $0x8070e4
+  802077:	e8 fb ea ff ff       	call   800b77 <strcpy>
+  req->req_nops = 2;
+  80207c:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802083:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  802086:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  80208d:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  802090:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802093:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  802098:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  80209f:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8020a2:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  8020a9:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8020ac:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  8020b3:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8020b6:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8020bb:	29 f0                	sub    %esi,%eax
+  8020bd:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8020c0:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8020c4:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  8020c9:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  8020d0:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8020d3:	83 c6 01             	add    $0x1,%esi
+  8020d6:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8020dc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020df:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8020e4:	e8 2a fa ff ff       	call   801b13 <fsipc>
+  8020e9:	89 c3                	mov    %eax,%ebx
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	83 f8 01             	cmp    $0x1,%eax
+  8020f1:	7e 37                	jle    80212a <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8020f3:	a1 38 70 80 00       	mov    0x807038,%eax
+  8020f8:	8b 55 18             	mov    0x18(%ebp),%edx
+  8020fb:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8020fd:	83 ec 04             	sub    $0x4,%esp
+  802100:	50                   	push   %eax
+  802101:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  802107:	56                   	push   %esi
+  802108:	ff 75 10             	push   0x10(%ebp)
+  80210b:	e8 ed eb ff ff       	call   800cfd <memmove>
+  return fd2num(fd);
+  802110:	83 c4 04             	add    $0x4,%esp
+  802113:	ff 75 e4             	push   -0x1c(%ebp)
+  802116:	e8 3a f3 ff ff       	call   801455 <fd2num>
+  80211b:	89 c3                	mov    %eax,%ebx
+  80211d:	83 c4 10             	add    $0x10,%esp
+}
+  802120:	89 d8                	mov    %ebx,%eax
+  802122:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802125:	5b                   	pop    %ebx
+  802126:	5e                   	pop    %esi
+  802127:	5f                   	pop    %edi
+  802128:	5d                   	pop    %ebp
+  802129:	c3                   	ret
+    fd_close(fd, 0);
+  80212a:	83 ec 08             	sub    $0x8,%esp
+  80212d:	6a 00                	push   $0x0
+  80212f:	ff 75 e4             	push   -0x1c(%ebp)
+  802132:	e8 34 f4 ff ff       	call   80156b <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802137:	83 c4 10             	add    $0x10,%esp
+  80213a:	85 db                	test   %ebx,%ebx
+  80213c:	78 e2                	js     802120 <open_read+0xed>
+  80213e:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802141:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  802147:	eb d7                	jmp    802120 <open_read+0xed>
+    return -E_BAD_PATH;
+  802149:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80214e:	eb d0                	jmp    802120 <open_read+0xed>
+
+00802150 <file_stat>:
+{
+  802150:	55                   	push   %ebp
+  802151:	89 e5                	mov    %esp,%ebp
+  802153:	57                   	push   %edi
+  802154:	56                   	push   %esi
+  802155:	53                   	push   %ebx
+  802156:	83 ec 18             	sub    $0x18,%esp
+  802159:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80215c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80215f:	57                   	push   %edi
+  802160:	e8 d7 e9 ff ff       	call   800b3c <strlen>
+  802165:	83 c4 10             	add    $0x10,%esp
+  802168:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80216d:	0f 8f c7 00 00 00    	jg     80223a <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802173:	83 ec 0c             	sub    $0xc,%esp
+  802176:	57                   	push   %edi
+  802177:	e8 c0 e9 ff ff       	call   800b3c <strlen>
+  80217c:	8d 58 04             	lea    0x4(%eax),%ebx
+  80217f:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802182:	83 c4 08             	add    $0x8,%esp
+  802185:	57                   	push   %edi
+  802186:	68 e4 70 80 00       	push   $0x8070e4
+  80218b:	e8 e7 e9 ff ff       	call   800b77 <strcpy>
+  req->req_nops = 2;
+  802190:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802197:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  80219a:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  8021a1:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8021a4:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  8021ab:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8021ae:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  8021b5:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8021b8:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  8021bf:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8021c2:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  8021c9:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8021cc:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8021d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8021dc:	e8 32 f9 ff ff       	call   801b13 <fsipc>
+  8021e1:	83 c4 10             	add    $0x10,%esp
+  8021e4:	83 f8 01             	cmp    $0x1,%eax
+  8021e7:	7e 42                	jle    80222b <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8021e9:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8021ef:	83 ec 08             	sub    $0x8,%esp
+  8021f2:	53                   	push   %ebx
+  8021f3:	56                   	push   %esi
+  8021f4:	e8 7e e9 ff ff       	call   800b77 <strcpy>
+  st->st_size = ret->ret_size;
+  8021f9:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8021ff:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802205:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80220b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802211:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  802218:	40 80 00 
+  return 0;
+  80221b:	83 c4 10             	add    $0x10,%esp
+  80221e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802223:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802226:	5b                   	pop    %ebx
+  802227:	5e                   	pop    %esi
+  802228:	5f                   	pop    %edi
+  802229:	5d                   	pop    %ebp
+  80222a:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80222b:	85 c0                	test   %eax,%eax
+  80222d:	78 f4                	js     802223 <file_stat+0xd3>
+  80222f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802232:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  802238:	eb e9                	jmp    802223 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80223a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80223f:	eb e2                	jmp    802223 <file_stat+0xd3>
+
+00802241 <read_map>:
+{
+  802241:	55                   	push   %ebp
+  802242:	89 e5                	mov    %esp,%ebp
+  802244:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802247:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80224a:	50                   	push   %eax
+  80224b:	ff 75 08             	push   0x8(%ebp)
+  80224e:	e8 7c f2 ff ff       	call   8014cf <fd_lookup>
+  802253:	83 c4 10             	add    $0x10,%esp
+  802256:	85 c0                	test   %eax,%eax
+  802258:	78 2a                	js     802284 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80225a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80225d:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802263:	39 08                	cmp    %ecx,(%eax)
+  802265:	75 1f                	jne    802286 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802267:	8b 40 0c             	mov    0xc(%eax),%eax
+  80226a:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  80226f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802272:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802277:	8b 55 10             	mov    0x10(%ebp),%edx
+  80227a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80227f:	e8 8f f8 ff ff       	call   801b13 <fsipc>
+}
+  802284:	c9                   	leave
+  802285:	c3                   	ret
+    return -E_INVAL;
+  802286:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80228b:	eb f7                	jmp    802284 <read_map+0x43>
+
+0080228d <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80228d:	55                   	push   %ebp
+  80228e:	89 e5                	mov    %esp,%ebp
+  802290:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802293:	ba 00 00 00 00       	mov    $0x0,%edx
+  802298:	b8 08 00 00 00       	mov    $0x8,%eax
+  80229d:	e8 71 f8 ff ff       	call   801b13 <fsipc>
+}
+  8022a2:	c9                   	leave
+  8022a3:	c3                   	ret
+
+008022a4 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8022a4:	55                   	push   %ebp
+  8022a5:	89 e5                	mov    %esp,%ebp
+  8022a7:	57                   	push   %edi
+  8022a8:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8022a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ac:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8022b1:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8022b8:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8022bb:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8022c2:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8022c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ca:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022cf:	e8 3f f8 ff ff       	call   801b13 <fsipc>
+  8022d4:	85 c0                	test   %eax,%eax
+  8022d6:	78 14                	js     8022ec <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8022d8:	be 00 70 80 00       	mov    $0x807000,%esi
+  8022dd:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8022e2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8022e5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8022e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022ec:	5e                   	pop    %esi
+  8022ed:	5f                   	pop    %edi
+  8022ee:	5d                   	pop    %ebp
+  8022ef:	c3                   	ret
+
+008022f0 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8022f0:	55                   	push   %ebp
+  8022f1:	89 e5                	mov    %esp,%ebp
+  8022f3:	53                   	push   %ebx
+  8022f4:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8022f7:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8022fa:	50                   	push   %eax
+  8022fb:	6a 00                	push   $0x0
+  8022fd:	e8 a2 ff ff ff       	call   8022a4 <fs_stats>
+  802302:	83 c4 10             	add    $0x10,%esp
+  802305:	85 c0                	test   %eax,%eax
+  802307:	78 28                	js     802331 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802309:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80230c:	83 ec 08             	sub    $0x8,%esp
+  80230f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802312:	50                   	push   %eax
+  802313:	6a 20                	push   $0x20
+  802315:	e8 8a ff ff ff       	call   8022a4 <fs_stats>
+  80231a:	83 c4 10             	add    $0x10,%esp
+  80231d:	85 c0                	test   %eax,%eax
+  80231f:	78 10                	js     802331 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802321:	83 ec 08             	sub    $0x8,%esp
+  802324:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802327:	50                   	push   %eax
+  802328:	53                   	push   %ebx
+  802329:	e8 76 ff ff ff       	call   8022a4 <fs_stats>
+  80232e:	83 c4 10             	add    $0x10,%esp
+}
+  802331:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802334:	c9                   	leave
+  802335:	c3                   	ret
+
+00802336 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802336:	55                   	push   %ebp
+  802337:	89 e5                	mov    %esp,%ebp
+  802339:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80233c:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802343:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802346:	8b 45 08             	mov    0x8(%ebp),%eax
+  802349:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  80234e:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802355:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802358:	ba 00 00 00 00       	mov    $0x0,%edx
+  80235d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802362:	e8 ac f7 ff ff       	call   801b13 <fsipc>
+}
+  802367:	c9                   	leave
+  802368:	c3                   	ret
+
+00802369 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802369:	55                   	push   %ebp
+  80236a:	89 e5                	mov    %esp,%ebp
+  80236c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80236f:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802376:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802379:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802380:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802383:	8b 45 08             	mov    0x8(%ebp),%eax
+  802386:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  80238b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802390:	b8 09 00 00 00       	mov    $0x9,%eax
+  802395:	e8 79 f7 ff ff       	call   801b13 <fsipc>
+}
+  80239a:	c9                   	leave
+  80239b:	c3                   	ret
+
+0080239c <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80239c:	55                   	push   %ebp
+  80239d:	89 e5                	mov    %esp,%ebp
+  80239f:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023a5:	50                   	push   %eax
+  8023a6:	ff 75 08             	push   0x8(%ebp)
+  8023a9:	e8 21 f1 ff ff       	call   8014cf <fd_lookup>
+  8023ae:	83 c4 10             	add    $0x10,%esp
+  8023b1:	85 c0                	test   %eax,%eax
+  8023b3:	78 34                	js     8023e9 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8023b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023b8:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8023be:	39 08                	cmp    %ecx,(%eax)
+  8023c0:	75 29                	jne    8023eb <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8023c2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023c5:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  8023ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023cd:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  8023d2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023d5:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8023da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023df:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8023e4:	e8 2a f7 ff ff       	call   801b13 <fsipc>
+}
+  8023e9:	c9                   	leave
+  8023ea:	c3                   	ret
+    return -E_INVAL;
+  8023eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023f0:	eb f7                	jmp    8023e9 <fallocate+0x4d>
+
+008023f2 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8023f2:	55                   	push   %ebp
+  8023f3:	89 e5                	mov    %esp,%ebp
+  8023f5:	57                   	push   %edi
+  8023f6:	56                   	push   %esi
+  8023f7:	53                   	push   %ebx
+  8023f8:	83 ec 24             	sub    $0x24,%esp
+  8023fb:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023fe:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802401:	50                   	push   %eax
+  802402:	ff 75 08             	push   0x8(%ebp)
+  802405:	e8 c5 f0 ff ff       	call   8014cf <fd_lookup>
+  80240a:	83 c4 10             	add    $0x10,%esp
+  80240d:	85 c0                	test   %eax,%eax
+  80240f:	78 66                	js     802477 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802411:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802414:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80241a:	39 08                	cmp    %ecx,(%eax)
+  80241c:	75 61                	jne    80247f <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80241e:	85 f6                	test   %esi,%esi
+  802420:	7e 50                	jle    802472 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802422:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802427:	39 de                	cmp    %ebx,%esi
+  802429:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80242c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80242f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802432:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  802437:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80243d:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802444:	83 ec 04             	sub    $0x4,%esp
+  802447:	57                   	push   %edi
+  802448:	ff 75 0c             	push   0xc(%ebp)
+  80244b:	68 08 70 80 00       	push   $0x807008
+  802450:	e8 a8 e8 ff ff       	call   800cfd <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802455:	ba 00 00 00 00       	mov    $0x0,%edx
+  80245a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80245f:	e8 af f6 ff ff       	call   801b13 <fsipc>
+  802464:	83 c4 10             	add    $0x10,%esp
+  802467:	85 c0                	test   %eax,%eax
+  802469:	78 0c                	js     802477 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80246b:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80246e:	29 de                	sub    %ebx,%esi
+  802470:	eb ac                	jmp    80241e <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802472:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802477:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80247a:	5b                   	pop    %ebx
+  80247b:	5e                   	pop    %esi
+  80247c:	5f                   	pop    %edi
+  80247d:	5d                   	pop    %ebp
+  80247e:	c3                   	ret
+    return -E_INVAL;
+  80247f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802484:	eb f1                	jmp    802477 <prefetch+0x85>
+
+00802486 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802486:	55                   	push   %ebp
+  802487:	89 e5                	mov    %esp,%ebp
+  802489:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80248c:	50                   	push   %eax
+  80248d:	e8 d3 ef ff ff       	call   801465 <fd2data>
+  802492:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802497:	c9                   	leave
+  802498:	c3                   	ret
+
+00802499 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802499:	55                   	push   %ebp
+  80249a:	89 e5                	mov    %esp,%ebp
+  80249c:	56                   	push   %esi
+  80249d:	53                   	push   %ebx
+  80249e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8024a1:	83 ec 0c             	sub    $0xc,%esp
+  8024a4:	ff 75 08             	push   0x8(%ebp)
+  8024a7:	e8 b9 ef ff ff       	call   801465 <fd2data>
+  8024ac:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8024ae:	83 c4 08             	add    $0x8,%esp
+  8024b1:	68 e8 37 80 00       	push   $0x8037e8
+  8024b6:	53                   	push   %ebx
+  8024b7:	e8 bb e6 ff ff       	call   800b77 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8024bc:	8b 46 04             	mov    0x4(%esi),%eax
+  8024bf:	2b 06                	sub    (%esi),%eax
+  8024c1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8024c7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024ce:	00 00 00 
+  stat->st_dev = &devpipe;
+  8024d1:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8024d8:	40 80 00 
+  return 0;
+}
+  8024db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024e3:	5b                   	pop    %ebx
+  8024e4:	5e                   	pop    %esi
+  8024e5:	5d                   	pop    %ebp
+  8024e6:	c3                   	ret
+
+008024e7 <pipe_wakeup>:
+{
+  8024e7:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8024e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ee:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8024f1:	85 c0                	test   %eax,%eax
+  8024f3:	75 01                	jne    8024f6 <pipe_wakeup+0xf>
+  8024f5:	c3                   	ret
+{
+  8024f6:	55                   	push   %ebp
+  8024f7:	89 e5                	mov    %esp,%ebp
+  8024f9:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8024fc:	6a 00                	push   $0x0
+  8024fe:	68 00 00 c0 ee       	push   $0xeec00000
+  802503:	52                   	push   %edx
+  802504:	e8 f9 ed ff ff       	call   801302 <sys_chan_wakeup>
+  802509:	83 c4 10             	add    $0x10,%esp
+}
+  80250c:	c9                   	leave
+  80250d:	c3                   	ret
+
+0080250e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80250e:	55                   	push   %ebp
+  80250f:	89 e5                	mov    %esp,%ebp
+  802511:	57                   	push   %edi
+  802512:	56                   	push   %esi
+  802513:	53                   	push   %ebx
+  802514:	83 ec 18             	sub    $0x18,%esp
+  802517:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80251a:	57                   	push   %edi
+  80251b:	e8 45 ef ff ff       	call   801465 <fd2data>
+  802520:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802522:	83 c4 10             	add    $0x10,%esp
+  802525:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802529:	74 2a                	je     802555 <devpipe_close+0x47>
+  80252b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802530:	89 f8                	mov    %edi,%eax
+  802532:	e8 4f ff ff ff       	call   802486 <pipe_ring>
+  802537:	83 ec 08             	sub    $0x8,%esp
+  80253a:	01 d8                	add    %ebx,%eax
+  80253c:	50                   	push   %eax
+  80253d:	6a 00                	push   $0x0
+  80253f:	e8 e7 ea ff ff       	call   80102b <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802544:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80254a:	83 c4 10             	add    $0x10,%esp
+  80254d:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802553:	75 db                	jne    802530 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802555:	83 ec 08             	sub    $0x8,%esp
+  802558:	57                   	push   %edi
+  802559:	6a 00                	push   $0x0
+  80255b:	e8 cb ea ff ff       	call   80102b <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802560:	83 c4 10             	add    $0x10,%esp
+  802563:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802567:	75 13                	jne    80257c <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802569:	83 ec 08             	sub    $0x8,%esp
+  80256c:	56                   	push   %esi
+  80256d:	6a 00                	push   $0x0
+  80256f:	e8 b7 ea ff ff       	call   80102b <sys_page_unmap>
+}
+  802574:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802577:	5b                   	pop    %ebx
+  802578:	5e                   	pop    %esi
+  802579:	5f                   	pop    %edi
+  80257a:	5d                   	pop    %ebp
+  80257b:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80257c:	8d 56 04             	lea    0x4(%esi),%edx
+  80257f:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802582:	e8 60 ff ff ff       	call   8024e7 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802587:	8d 46 30             	lea    0x30(%esi),%eax
+  80258a:	89 f2                	mov    %esi,%edx
+  80258c:	e8 56 ff ff ff       	call   8024e7 <pipe_wakeup>
+  802591:	eb d6                	jmp    802569 <devpipe_close+0x5b>
+
+00802593 <_pipeisclosed>:
+{
+  802593:	55                   	push   %ebp
+  802594:	89 e5                	mov    %esp,%ebp
+  802596:	57                   	push   %edi
+  802597:	56                   	push   %esi
+  802598:	53                   	push   %ebx
+  802599:	83 ec 1c             	sub    $0x1c,%esp
+  80259c:	89 c7                	mov    %eax,%edi
+  80259e:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8025a0:	a1 44 67 80 00       	mov    0x806744,%eax
+  8025a5:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8025a8:	83 ec 0c             	sub    $0xc,%esp
+  8025ab:	57                   	push   %edi
+  8025ac:	e8 18 0a 00 00       	call   802fc9 <pageref>
+  8025b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025b4:	89 34 24             	mov    %esi,(%esp)
+  8025b7:	e8 0d 0a 00 00       	call   802fc9 <pageref>
+    nn = thisenv->env_runs;
+  8025bc:	8b 15 44 67 80 00    	mov    0x806744,%edx
+  8025c2:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8025c5:	83 c4 10             	add    $0x10,%esp
+  8025c8:	39 cb                	cmp    %ecx,%ebx
+  8025ca:	74 1b                	je     8025e7 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8025cc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8025cf:	75 cf                	jne    8025a0 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8025d1:	8b 42 58             	mov    0x58(%edx),%eax
+  8025d4:	6a 01                	push   $0x1
+  8025d6:	50                   	push   %eax
+  8025d7:	53                   	push   %ebx
+  8025d8:	68 ef 37 80 00       	push   $0x8037ef
+  8025dd:	e8 a7 df ff ff       	call   800589 <cprintf>
+  8025e2:	83 c4 10             	add    $0x10,%esp
+  8025e5:	eb b9                	jmp    8025a0 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8025e7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8025ea:	0f 94 c0             	sete   %al
+  8025ed:	0f b6 c0             	movzbl %al,%eax
+}
+  8025f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025f3:	5b                   	pop    %ebx
+  8025f4:	5e                   	pop    %esi
+  8025f5:	5f                   	pop    %edi
+  8025f6:	5d                   	pop    %ebp
+  8025f7:	c3                   	ret
+
+008025f8 <devpipe_write_bulk>:
+{
+  8025f8:	55                   	push   %ebp
+  8025f9:	89 e5                	mov    %esp,%ebp
+  8025fb:	57                   	push   %edi
+  8025fc:	56                   	push   %esi
+  8025fd:	53                   	push   %ebx
+  8025fe:	83 ec 1c             	sub    $0x1c,%esp
+  802601:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802604:	89 d6                	mov    %edx,%esi
+  802606:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802609:	e8 78 fe ff ff       	call   802486 <pipe_ring>
+  80260e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802611:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802616:	8d 46 04             	lea    0x4(%esi),%eax
+  802619:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80261c:	eb 75                	jmp    802693 <devpipe_write_bulk+0x9b>
+  80261e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802623:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802627:	6a 64                	push   $0x64
+  802629:	68 00 00 c0 ee       	push   $0xeec00000
+  80262e:	53                   	push   %ebx
+  80262f:	56                   	push   %esi
+  802630:	e8 aa ec ff ff       	call   8012df <sys_chan_sleep>
+      continue;
+  802635:	83 c4 10             	add    $0x10,%esp
+  802638:	eb 59                	jmp    802693 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80263a:	89 d1                	mov    %edx,%ecx
+  80263c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80263f:	c1 e9 11             	shr    $0x11,%ecx
+  802642:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802645:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80264a:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80264c:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802652:	29 d3                	sub    %edx,%ebx
+  802654:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802659:	29 c2                	sub    %eax,%edx
+  80265b:	39 d3                	cmp    %edx,%ebx
+  80265d:	0f 47 da             	cmova  %edx,%ebx
+  802660:	8b 55 08             	mov    0x8(%ebp),%edx
+  802663:	29 fa                	sub    %edi,%edx
+  802665:	39 d3                	cmp    %edx,%ebx
+  802667:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80266a:	83 ec 04             	sub    $0x4,%esp
+  80266d:	53                   	push   %ebx
+  80266e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802671:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802674:	52                   	push   %edx
+  802675:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802678:	01 c8                	add    %ecx,%eax
+  80267a:	50                   	push   %eax
+  80267b:	e8 df e6 ff ff       	call   800d5f <memcpy>
+    i += m;
+  802680:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802682:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802685:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802688:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80268b:	e8 57 fe ff ff       	call   8024e7 <pipe_wakeup>
+  802690:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802693:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802696:	73 2b                	jae    8026c3 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802698:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  80269a:	8b 56 04             	mov    0x4(%esi),%edx
+  80269d:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8026a3:	39 d0                	cmp    %edx,%eax
+  8026a5:	7d 93                	jge    80263a <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8026a7:	89 f2                	mov    %esi,%edx
+  8026a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8026ac:	e8 e2 fe ff ff       	call   802593 <_pipeisclosed>
+  8026b1:	85 c0                	test   %eax,%eax
+  8026b3:	0f 84 65 ff ff ff    	je     80261e <devpipe_write_bulk+0x26>
+        return i;
+  8026b9:	89 f8                	mov    %edi,%eax
+}
+  8026bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026be:	5b                   	pop    %ebx
+  8026bf:	5e                   	pop    %esi
+  8026c0:	5f                   	pop    %edi
+  8026c1:	5d                   	pop    %ebp
+  8026c2:	c3                   	ret
+  return i;
+  8026c3:	89 f8                	mov    %edi,%eax
+  8026c5:	eb f4                	jmp    8026bb <devpipe_write_bulk+0xc3>
+
+008026c7 <devpipe_write>:
+{
+  8026c7:	55                   	push   %ebp
+  8026c8:	89 e5                	mov    %esp,%ebp
+  8026ca:	57                   	push   %edi
+  8026cb:	56                   	push   %esi
+  8026cc:	53                   	push   %ebx
+  8026cd:	83 ec 28             	sub    $0x28,%esp
+  8026d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8026d3:	56                   	push   %esi
+  8026d4:	e8 8c ed ff ff       	call   801465 <fd2data>
+  8026d9:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8026db:	8b 78 28             	mov    0x28(%eax),%edi
+  8026de:	83 c4 10             	add    $0x10,%esp
+  8026e1:	85 ff                	test   %edi,%edi
+  8026e3:	75 25                	jne    80270a <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8026e5:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8026e8:	74 66                	je     802750 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8026ea:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026ed:	8b 0b                	mov    (%ebx),%ecx
+  8026ef:	8d 51 20             	lea    0x20(%ecx),%edx
+  8026f2:	39 d0                	cmp    %edx,%eax
+  8026f4:	72 2b                	jb     802721 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8026f6:	89 da                	mov    %ebx,%edx
+  8026f8:	89 f0                	mov    %esi,%eax
+  8026fa:	e8 94 fe ff ff       	call   802593 <_pipeisclosed>
+  8026ff:	85 c0                	test   %eax,%eax
+  802701:	75 51                	jne    802754 <devpipe_write+0x8d>
+      sys_yield();
+  802703:	e8 3c e8 ff ff       	call   800f44 <sys_yield>
+  802708:	eb e0                	jmp    8026ea <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  80270a:	83 ec 0c             	sub    $0xc,%esp
+  80270d:	ff 75 10             	push   0x10(%ebp)
+  802710:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802713:	89 c2                	mov    %eax,%edx
+  802715:	89 f0                	mov    %esi,%eax
+  802717:	e8 dc fe ff ff       	call   8025f8 <devpipe_write_bulk>
+  80271c:	83 c4 10             	add    $0x10,%esp
+  80271f:	eb 38                	jmp    802759 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802721:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802724:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802728:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80272b:	89 c2                	mov    %eax,%edx
+  80272d:	c1 fa 1f             	sar    $0x1f,%edx
+  802730:	89 d1                	mov    %edx,%ecx
+  802732:	c1 e9 1b             	shr    $0x1b,%ecx
+  802735:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802738:	83 e2 1f             	and    $0x1f,%edx
+  80273b:	29 ca                	sub    %ecx,%edx
+  80273d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802741:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802745:	83 c0 01             	add    $0x1,%eax
+  802748:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80274b:	83 c7 01             	add    $0x1,%edi
+  80274e:	eb 95                	jmp    8026e5 <devpipe_write+0x1e>
+  return i;
+  802750:	89 f8                	mov    %edi,%eax
+  802752:	eb 05                	jmp    802759 <devpipe_write+0x92>
+        return 0;
+  802754:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802759:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80275c:	5b                   	pop    %ebx
+  80275d:	5e                   	pop    %esi
+  80275e:	5f                   	pop    %edi
+  80275f:	5d                   	pop    %ebp
+  802760:	c3                   	ret
+
+00802761 <devpipe_read_bulk>:
+{
+  802761:	55                   	push   %ebp
+  802762:	89 e5                	mov    %esp,%ebp
+  802764:	57                   	push   %edi
+  802765:	56                   	push   %esi
+  802766:	53                   	push   %ebx
+  802767:	83 ec 2c             	sub    $0x2c,%esp
+  80276a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80276d:	89 d6                	mov    %edx,%esi
+  80276f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802772:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802775:	e8 0c fd ff ff       	call   802486 <pipe_ring>
+  80277a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80277d:	85 db                	test   %ebx,%ebx
+  80277f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802784:	0f 45 c3             	cmovne %ebx,%eax
+  802787:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80278a:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80278f:	8d 46 30             	lea    0x30(%esi),%eax
+  802792:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802795:	eb 50                	jmp    8027e7 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802797:	89 d1                	mov    %edx,%ecx
+  802799:	c1 f9 1f             	sar    $0x1f,%ecx
+  80279c:	c1 e9 11             	shr    $0x11,%ecx
+  80279f:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8027a2:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8027a7:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8027a9:	29 d3                	sub    %edx,%ebx
+  8027ab:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8027b0:	29 c2                	sub    %eax,%edx
+  8027b2:	39 d3                	cmp    %edx,%ebx
+  8027b4:	0f 47 da             	cmova  %edx,%ebx
+  8027b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027ba:	29 fa                	sub    %edi,%edx
+  8027bc:	39 d3                	cmp    %edx,%ebx
+  8027be:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8027c1:	83 ec 04             	sub    $0x4,%esp
+  8027c4:	53                   	push   %ebx
+  8027c5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8027c8:	01 c8                	add    %ecx,%eax
+  8027ca:	50                   	push   %eax
+  8027cb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8027ce:	01 f8                	add    %edi,%eax
+  8027d0:	50                   	push   %eax
+  8027d1:	e8 89 e5 ff ff       	call   800d5f <memcpy>
+    i += m;
+  8027d6:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8027d8:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8027da:	89 f2                	mov    %esi,%edx
+  8027dc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8027df:	e8 03 fd ff ff       	call   8024e7 <pipe_wakeup>
+  8027e4:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8027e7:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8027ea:	73 51                	jae    80283d <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8027ec:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8027ef:	8b 16                	mov    (%esi),%edx
+  8027f1:	39 da                	cmp    %ebx,%edx
+  8027f3:	75 a2                	jne    802797 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8027f5:	85 ff                	test   %edi,%edi
+  8027f7:	75 44                	jne    80283d <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8027f9:	89 f2                	mov    %esi,%edx
+  8027fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027fe:	e8 90 fd ff ff       	call   802593 <_pipeisclosed>
+  802803:	85 c0                	test   %eax,%eax
+  802805:	75 3a                	jne    802841 <devpipe_read_bulk+0xe0>
+  802807:	b8 01 00 00 00       	mov    $0x1,%eax
+  80280c:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802810:	6a 64                	push   $0x64
+  802812:	ff 75 d4             	push   -0x2c(%ebp)
+  802815:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802816:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802819:	50                   	push   %eax
+  80281a:	e8 c0 ea ff ff       	call   8012df <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80281f:	85 c0                	test   %eax,%eax
+  802821:	ba 00 00 00 00       	mov    $0x0,%edx
+  802826:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802829:	83 c4 10             	add    $0x10,%esp
+  80282c:	a8 01                	test   $0x1,%al
+  80282e:	74 b7                	je     8027e7 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802830:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802835:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802838:	5b                   	pop    %ebx
+  802839:	5e                   	pop    %esi
+  80283a:	5f                   	pop    %edi
+  80283b:	5d                   	pop    %ebp
+  80283c:	c3                   	ret
+  return i;
+  80283d:	89 f8                	mov    %edi,%eax
+  80283f:	eb f4                	jmp    802835 <devpipe_read_bulk+0xd4>
+        return 0;
+  802841:	b8 00 00 00 00       	mov    $0x0,%eax
+  802846:	eb ed                	jmp    802835 <devpipe_read_bulk+0xd4>
+
+00802848 <devpipe_read>:
+{
+  802848:	55                   	push   %ebp
+  802849:	89 e5                	mov    %esp,%ebp
+  80284b:	57                   	push   %edi
+  80284c:	56                   	push   %esi
+  80284d:	53                   	push   %ebx
+  80284e:	83 ec 18             	sub    $0x18,%esp
+  802851:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802854:	57                   	push   %edi
+  802855:	e8 0b ec ff ff       	call   801465 <fd2data>
+  80285a:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80285c:	8b 70 28             	mov    0x28(%eax),%esi
+  80285f:	83 c4 10             	add    $0x10,%esp
+  802862:	85 f6                	test   %esi,%esi
+  802864:	75 24                	jne    80288a <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802866:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802869:	74 60                	je     8028cb <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  80286b:	8b 03                	mov    (%ebx),%eax
+  80286d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802870:	75 3b                	jne    8028ad <devpipe_read+0x65>
+      if (i > 0)
+  802872:	85 f6                	test   %esi,%esi
+  802874:	75 2d                	jne    8028a3 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802876:	89 da                	mov    %ebx,%edx
+  802878:	89 f8                	mov    %edi,%eax
+  80287a:	e8 14 fd ff ff       	call   802593 <_pipeisclosed>
+  80287f:	85 c0                	test   %eax,%eax
+  802881:	75 4c                	jne    8028cf <devpipe_read+0x87>
+      sys_yield();
+  802883:	e8 bc e6 ff ff       	call   800f44 <sys_yield>
+  802888:	eb e1                	jmp    80286b <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  80288a:	83 ec 08             	sub    $0x8,%esp
+  80288d:	6a 00                	push   $0x0
+  80288f:	ff 75 10             	push   0x10(%ebp)
+  802892:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802895:	89 c2                	mov    %eax,%edx
+  802897:	89 f8                	mov    %edi,%eax
+  802899:	e8 c3 fe ff ff       	call   802761 <devpipe_read_bulk>
+  80289e:	83 c4 10             	add    $0x10,%esp
+  8028a1:	eb 02                	jmp    8028a5 <devpipe_read+0x5d>
+        return i;
+  8028a3:	89 f0                	mov    %esi,%eax
+}
+  8028a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028a8:	5b                   	pop    %ebx
+  8028a9:	5e                   	pop    %esi
+  8028aa:	5f                   	pop    %edi
+  8028ab:	5d                   	pop    %ebp
+  8028ac:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8028ad:	99                   	cltd
+  8028ae:	c1 ea 1b             	shr    $0x1b,%edx
+  8028b1:	01 d0                	add    %edx,%eax
+  8028b3:	83 e0 1f             	and    $0x1f,%eax
+  8028b6:	29 d0                	sub    %edx,%eax
+  8028b8:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8028bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028c0:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8028c3:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8028c6:	83 c6 01             	add    $0x1,%esi
+  8028c9:	eb 9b                	jmp    802866 <devpipe_read+0x1e>
+  return i;
+  8028cb:	89 f0                	mov    %esi,%eax
+  8028cd:	eb d6                	jmp    8028a5 <devpipe_read+0x5d>
+        return 0;
+  8028cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d4:	eb cf                	jmp    8028a5 <devpipe_read+0x5d>
+
+008028d6 <pipe2>:
+{
+  8028d6:	55                   	push   %ebp
+  8028d7:	89 e5                	mov    %esp,%ebp
+  8028d9:	57                   	push   %edi
+  8028da:	56                   	push   %esi
+  8028db:	53                   	push   %ebx
+  8028dc:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8028df:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8028e2:	50                   	push   %eax
+  8028e3:	e8 91 eb ff ff       	call   801479 <fd_alloc>
+  8028e8:	89 c3                	mov    %eax,%ebx
+  8028ea:	83 c4 10             	add    $0x10,%esp
+  8028ed:	85 c0                	test   %eax,%eax
+  8028ef:	0f 88 fb 01 00 00    	js     802af0 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028f5:	83 ec 04             	sub    $0x4,%esp
+  8028f8:	68 07 04 00 00       	push   $0x407
+  8028fd:	ff 75 e4             	push   -0x1c(%ebp)
+  802900:	6a 00                	push   $0x0
+  802902:	e8 9f e6 ff ff       	call   800fa6 <sys_page_alloc>
+  802907:	89 c3                	mov    %eax,%ebx
+  802909:	83 c4 10             	add    $0x10,%esp
+  80290c:	85 c0                	test   %eax,%eax
+  80290e:	0f 88 dc 01 00 00    	js     802af0 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802914:	83 ec 0c             	sub    $0xc,%esp
+  802917:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80291a:	50                   	push   %eax
+  80291b:	e8 59 eb ff ff       	call   801479 <fd_alloc>
+  802920:	89 c3                	mov    %eax,%ebx
+  802922:	83 c4 10             	add    $0x10,%esp
+  802925:	85 c0                	test   %eax,%eax
+  802927:	0f 88 b3 01 00 00    	js     802ae0 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80292d:	83 ec 04             	sub    $0x4,%esp
+  802930:	68 07 04 00 00       	push   $0x407
+  802935:	ff 75 e0             	push   -0x20(%ebp)
+  802938:	6a 00                	push   $0x0
+  80293a:	e8 67 e6 ff ff       	call   800fa6 <sys_page_alloc>
+  80293f:	89 c3                	mov    %eax,%ebx
+  802941:	83 c4 10             	add    $0x10,%esp
+  802944:	85 c0                	test   %eax,%eax
+  802946:	0f 88 94 01 00 00    	js     802ae0 <pipe2+0x20a>
+  va = fd2data(fd0);
+  80294c:	83 ec 0c             	sub    $0xc,%esp
+  80294f:	ff 75 e4             	push   -0x1c(%ebp)
+  802952:	e8 0e eb ff ff       	call   801465 <fd2data>
+  802957:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802959:	83 c4 0c             	add    $0xc,%esp
+  80295c:	68 07 04 00 00       	push   $0x407
+  802961:	50                   	push   %eax
+  802962:	6a 00                	push   $0x0
+  802964:	e8 3d e6 ff ff       	call   800fa6 <sys_page_alloc>
+  802969:	89 c3                	mov    %eax,%ebx
+  80296b:	83 c4 10             	add    $0x10,%esp
+  80296e:	85 c0                	test   %eax,%eax
+  802970:	0f 88 5a 01 00 00    	js     802ad0 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802976:	83 ec 0c             	sub    $0xc,%esp
+  802979:	ff 75 e0             	push   -0x20(%ebp)
+  80297c:	e8 e4 ea ff ff       	call   801465 <fd2data>
+  802981:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802988:	50                   	push   %eax
+  802989:	6a 00                	push   $0x0
+  80298b:	57                   	push   %edi
+  80298c:	6a 00                	push   $0x0
+  80298e:	e8 56 e6 ff ff       	call   800fe9 <sys_page_map>
+  802993:	89 c3                	mov    %eax,%ebx
+  802995:	83 c4 20             	add    $0x20,%esp
+  802998:	85 c0                	test   %eax,%eax
+  80299a:	0f 88 22 01 00 00    	js     802ac2 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  8029a0:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  8029a4:	74 72                	je     802a18 <pipe2+0x142>
+  8029a6:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8029ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029ae:	e8 d3 fa ff ff       	call   802486 <pipe_ring>
+  8029b3:	83 ec 04             	sub    $0x4,%esp
+  8029b6:	68 07 04 00 00       	push   $0x407
+  8029bb:	01 f0                	add    %esi,%eax
+  8029bd:	50                   	push   %eax
+  8029be:	6a 00                	push   $0x0
+  8029c0:	e8 e1 e5 ff ff       	call   800fa6 <sys_page_alloc>
+  8029c5:	89 c3                	mov    %eax,%ebx
+  8029c7:	83 c4 10             	add    $0x10,%esp
+  8029ca:	85 c0                	test   %eax,%eax
+  8029cc:	0f 88 97 00 00 00    	js     802a69 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8029d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8029d5:	e8 ac fa ff ff       	call   802486 <pipe_ring>
+  8029da:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8029dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029e0:	e8 a1 fa ff ff       	call   802486 <pipe_ring>
+  8029e5:	83 ec 0c             	sub    $0xc,%esp
+  8029e8:	68 07 04 00 00       	push   $0x407
+  8029ed:	53                   	push   %ebx
+  8029ee:	6a 00                	push   $0x0
+  8029f0:	01 f0                	add    %esi,%eax
+  8029f2:	50                   	push   %eax
+  8029f3:	6a 00                	push   $0x0
+  8029f5:	e8 ef e5 ff ff       	call   800fe9 <sys_page_map>
+  8029fa:	89 c3                	mov    %eax,%ebx
+  8029fc:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802a02:	83 c4 20             	add    $0x20,%esp
+  802a05:	85 c0                	test   %eax,%eax
+  802a07:	78 60                	js     802a69 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802a09:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802a0f:	75 9a                	jne    8029ab <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802a11:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802a18:	a1 20 40 80 00       	mov    0x804020,%eax
+  802a1d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a20:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802a22:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a25:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802a2c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802a2f:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802a31:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802a34:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802a3b:	83 ec 0c             	sub    $0xc,%esp
+  802a3e:	ff 75 e4             	push   -0x1c(%ebp)
+  802a41:	e8 0f ea ff ff       	call   801455 <fd2num>
+  802a46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a49:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802a4b:	83 c4 04             	add    $0x4,%esp
+  802a4e:	ff 75 e0             	push   -0x20(%ebp)
+  802a51:	e8 ff e9 ff ff       	call   801455 <fd2num>
+  802a56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a59:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802a5c:	83 c4 10             	add    $0x10,%esp
+  802a5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a64:	e9 87 00 00 00       	jmp    802af0 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802a69:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802a6e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a71:	e8 10 fa ff ff       	call   802486 <pipe_ring>
+  802a76:	83 ec 08             	sub    $0x8,%esp
+  802a79:	01 f0                	add    %esi,%eax
+  802a7b:	50                   	push   %eax
+  802a7c:	6a 00                	push   $0x0
+  802a7e:	e8 a8 e5 ff ff       	call   80102b <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802a83:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802a86:	e8 fb f9 ff ff       	call   802486 <pipe_ring>
+  802a8b:	83 c4 08             	add    $0x8,%esp
+  802a8e:	01 f0                	add    %esi,%eax
+  802a90:	50                   	push   %eax
+  802a91:	6a 00                	push   $0x0
+  802a93:	e8 93 e5 ff ff       	call   80102b <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802a98:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802a9e:	83 c4 10             	add    $0x10,%esp
+  802aa1:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802aa7:	75 c5                	jne    802a6e <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802aa9:	83 ec 0c             	sub    $0xc,%esp
+  802aac:	ff 75 e0             	push   -0x20(%ebp)
+  802aaf:	e8 b1 e9 ff ff       	call   801465 <fd2data>
+  802ab4:	83 c4 08             	add    $0x8,%esp
+  802ab7:	50                   	push   %eax
+  802ab8:	6a 00                	push   $0x0
+  802aba:	e8 6c e5 ff ff       	call   80102b <sys_page_unmap>
+  802abf:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802ac2:	83 ec 08             	sub    $0x8,%esp
+  802ac5:	57                   	push   %edi
+  802ac6:	6a 00                	push   $0x0
+  802ac8:	e8 5e e5 ff ff       	call   80102b <sys_page_unmap>
+  802acd:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802ad0:	83 ec 08             	sub    $0x8,%esp
+  802ad3:	ff 75 e0             	push   -0x20(%ebp)
+  802ad6:	6a 00                	push   $0x0
+  802ad8:	e8 4e e5 ff ff       	call   80102b <sys_page_unmap>
+  802add:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802ae0:	83 ec 08             	sub    $0x8,%esp
+  802ae3:	ff 75 e4             	push   -0x1c(%ebp)
+  802ae6:	6a 00                	push   $0x0
+  802ae8:	e8 3e e5 ff ff       	call   80102b <sys_page_unmap>
+  802aed:	83 c4 10             	add    $0x10,%esp
+}
+  802af0:	89 d8                	mov    %ebx,%eax
+  802af2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802af5:	5b                   	pop    %ebx
+  802af6:	5e                   	pop    %esi
+  802af7:	5f                   	pop    %edi
+  802af8:	5d                   	pop    %ebp
+  802af9:	c3                   	ret
+
+00802afa <pipe>:
+{
+  802afa:	55                   	push   %ebp
+  802afb:	89 e5                	mov    %esp,%ebp
+  802afd:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802b00:	6a 00                	push   $0x0
+  802b02:	ff 75 08             	push   0x8(%ebp)
+  802b05:	e8 cc fd ff ff       	call   8028d6 <pipe2>
+}
+  802b0a:	c9                   	leave
+  802b0b:	c3                   	ret
+
+00802b0c <pipeisclosed>:
+{
+  802b0c:	55                   	push   %ebp
+  802b0d:	89 e5                	mov    %esp,%ebp
+  802b0f:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b12:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b15:	50                   	push   %eax
+  802b16:	ff 75 08             	push   0x8(%ebp)
+  802b19:	e8 b1 e9 ff ff       	call   8014cf <fd_lookup>
+  802b1e:	83 c4 10             	add    $0x10,%esp
+  802b21:	85 c0                	test   %eax,%eax
+  802b23:	78 18                	js     802b3d <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802b25:	83 ec 0c             	sub    $0xc,%esp
+  802b28:	ff 75 f4             	push   -0xc(%ebp)
+  802b2b:	e8 35 e9 ff ff       	call   801465 <fd2data>
+  802b30:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802b32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b35:	e8 59 fa ff ff       	call   802593 <_pipeisclosed>
+  802b3a:	83 c4 10             	add    $0x10,%esp
+}
+  802b3d:	c9                   	leave
+  802b3e:	c3                   	ret
+
+00802b3f <pipe_splice>:
+{
+  802b3f:	55                   	push   %ebp
+  802b40:	89 e5                	mov    %esp,%ebp
+  802b42:	57                   	push   %edi
+  802b43:	56                   	push   %esi
+  802b44:	53                   	push   %ebx
+  802b45:	83 ec 34             	sub    $0x34,%esp
+  802b48:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b4b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802b4e:	50                   	push   %eax
+  802b4f:	ff 75 08             	push   0x8(%ebp)
+  802b52:	e8 78 e9 ff ff       	call   8014cf <fd_lookup>
+  802b57:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802b5a:	83 c4 10             	add    $0x10,%esp
+  802b5d:	85 c0                	test   %eax,%eax
+  802b5f:	0f 88 d7 00 00 00    	js     802c3c <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802b65:	83 ec 0c             	sub    $0xc,%esp
+  802b68:	ff 75 e4             	push   -0x1c(%ebp)
+  802b6b:	e8 f5 e8 ff ff       	call   801465 <fd2data>
+  802b70:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802b72:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b75:	83 c4 10             	add    $0x10,%esp
+  802b78:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802b7e:	39 10                	cmp    %edx,(%eax)
+  802b80:	0f 85 c1 00 00 00    	jne    802c47 <pipe_splice+0x108>
+  802b86:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802b8a:	0f 84 c0 00 00 00    	je     802c50 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802b90:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802b94:	0f 84 bf 00 00 00    	je     802c59 <pipe_splice+0x11a>
+  802b9a:	89 f7                	mov    %esi,%edi
+  802b9c:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802ba2:	0f 85 ba 00 00 00    	jne    802c62 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802ba8:	8d 43 04             	lea    0x4(%ebx),%eax
+  802bab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802bae:	eb 38                	jmp    802be8 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802bb0:	83 ec 0c             	sub    $0xc,%esp
+  802bb3:	68 00 10 00 00       	push   $0x1000
+  802bb8:	89 f1                	mov    %esi,%ecx
+  802bba:	89 da                	mov    %ebx,%edx
+  802bbc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bbf:	e8 34 fa ff ff       	call   8025f8 <devpipe_write_bulk>
+  802bc4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802bc7:	83 c4 10             	add    $0x10,%esp
+  802bca:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802bcf:	75 53                	jne    802c24 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802bd1:	83 ec 08             	sub    $0x8,%esp
+  802bd4:	56                   	push   %esi
+  802bd5:	6a 00                	push   $0x0
+  802bd7:	e8 4f e4 ff ff       	call   80102b <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802bdc:	83 c7 01             	add    $0x1,%edi
+  802bdf:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802be5:	83 c4 10             	add    $0x10,%esp
+  802be8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802beb:	74 3a                	je     802c27 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802bed:	8b 03                	mov    (%ebx),%eax
+  802bef:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802bf2:	75 bc                	jne    802bb0 <pipe_splice+0x71>
+  802bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf9:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802bfd:	85 c0                	test   %eax,%eax
+  802bff:	74 af                	je     802bb0 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802c01:	83 ec 04             	sub    $0x4,%esp
+  802c04:	6a 07                	push   $0x7
+  802c06:	56                   	push   %esi
+  802c07:	ff 75 d0             	push   -0x30(%ebp)
+  802c0a:	e8 f3 e6 ff ff       	call   801302 <sys_chan_wakeup>
+  802c0f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c12:	83 c4 10             	add    $0x10,%esp
+  802c15:	85 c0                	test   %eax,%eax
+  802c17:	79 b8                	jns    802bd1 <pipe_splice+0x92>
+  802c19:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c1e:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802c22:	eb 8c                	jmp    802bb0 <pipe_splice+0x71>
+  802c24:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802c27:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c2b:	75 06                	jne    802c33 <pipe_splice+0xf4>
+  802c2d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802c31:	78 09                	js     802c3c <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802c33:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c36:	c1 e0 0c             	shl    $0xc,%eax
+  802c39:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802c3c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802c3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c42:	5b                   	pop    %ebx
+  802c43:	5e                   	pop    %esi
+  802c44:	5f                   	pop    %edi
+  802c45:	5d                   	pop    %ebp
+  802c46:	c3                   	ret
+    return -E_INVAL;
+  802c47:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802c4e:	eb ec                	jmp    802c3c <pipe_splice+0xfd>
+  802c50:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802c57:	eb e3                	jmp    802c3c <pipe_splice+0xfd>
+  802c59:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802c60:	eb da                	jmp    802c3c <pipe_splice+0xfd>
+  802c62:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802c69:	eb d1                	jmp    802c3c <pipe_splice+0xfd>
+
+00802c6b <pipe_splice_read>:
+{
+  802c6b:	55                   	push   %ebp
+  802c6c:	89 e5                	mov    %esp,%ebp
+  802c6e:	53                   	push   %ebx
+  802c6f:	83 ec 1c             	sub    $0x1c,%esp
+  802c72:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c75:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c78:	50                   	push   %eax
+  802c79:	ff 75 08             	push   0x8(%ebp)
+  802c7c:	e8 4e e8 ff ff       	call   8014cf <fd_lookup>
+  802c81:	83 c4 10             	add    $0x10,%esp
+  802c84:	85 c0                	test   %eax,%eax
+  802c86:	78 49                	js     802cd1 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802c88:	83 ec 0c             	sub    $0xc,%esp
+  802c8b:	ff 75 f4             	push   -0xc(%ebp)
+  802c8e:	e8 d2 e7 ff ff       	call   801465 <fd2data>
+  802c93:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802c95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c98:	83 c4 10             	add    $0x10,%esp
+  802c9b:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802ca1:	39 08                	cmp    %ecx,(%eax)
+  802ca3:	75 31                	jne    802cd6 <pipe_splice_read+0x6b>
+  802ca5:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802ca9:	74 32                	je     802cdd <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802cab:	8b 48 08             	mov    0x8(%eax),%ecx
+  802cae:	83 e1 03             	and    $0x3,%ecx
+  802cb1:	83 f9 01             	cmp    $0x1,%ecx
+  802cb4:	74 2e                	je     802ce4 <pipe_splice_read+0x79>
+  802cb6:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802cbc:	75 2d                	jne    802ceb <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802cbe:	83 ec 08             	sub    $0x8,%esp
+  802cc1:	53                   	push   %ebx
+  802cc2:	68 00 10 00 00       	push   $0x1000
+  802cc7:	89 d9                	mov    %ebx,%ecx
+  802cc9:	e8 93 fa ff ff       	call   802761 <devpipe_read_bulk>
+  802cce:	83 c4 10             	add    $0x10,%esp
+}
+  802cd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cd4:	c9                   	leave
+  802cd5:	c3                   	ret
+    return -E_INVAL;
+  802cd6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cdb:	eb f4                	jmp    802cd1 <pipe_splice_read+0x66>
+  802cdd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ce2:	eb ed                	jmp    802cd1 <pipe_splice_read+0x66>
+  802ce4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ce9:	eb e6                	jmp    802cd1 <pipe_splice_read+0x66>
+  802ceb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cf0:	eb df                	jmp    802cd1 <pipe_splice_read+0x66>
+
+00802cf2 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802cf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf7:	c3                   	ret
+
+00802cf8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802cf8:	55                   	push   %ebp
+  802cf9:	89 e5                	mov    %esp,%ebp
+  802cfb:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802cfe:	68 07 38 80 00       	push   $0x803807
+  802d03:	ff 75 0c             	push   0xc(%ebp)
+  802d06:	e8 6c de ff ff       	call   800b77 <strcpy>
+  return 0;
+}
+  802d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d10:	c9                   	leave
+  802d11:	c3                   	ret
+
+00802d12 <devcons_write>:
+{
+  802d12:	55                   	push   %ebp
+  802d13:	89 e5                	mov    %esp,%ebp
+  802d15:	57                   	push   %edi
+  802d16:	56                   	push   %esi
+  802d17:	53                   	push   %ebx
+  802d18:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802d1e:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802d23:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802d29:	eb 2e                	jmp    802d59 <devcons_write+0x47>
+    m = n - tot;
+  802d2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d2e:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802d30:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d35:	39 c3                	cmp    %eax,%ebx
+  802d37:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802d3a:	83 ec 04             	sub    $0x4,%esp
+  802d3d:	53                   	push   %ebx
+  802d3e:	89 f0                	mov    %esi,%eax
+  802d40:	03 45 0c             	add    0xc(%ebp),%eax
+  802d43:	50                   	push   %eax
+  802d44:	57                   	push   %edi
+  802d45:	e8 b3 df ff ff       	call   800cfd <memmove>
+    sys_cputs(buf, m);
+  802d4a:	83 c4 08             	add    $0x8,%esp
+  802d4d:	53                   	push   %ebx
+  802d4e:	57                   	push   %edi
+  802d4f:	e8 53 e1 ff ff       	call   800ea7 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802d54:	01 de                	add    %ebx,%esi
+  802d56:	83 c4 10             	add    $0x10,%esp
+  802d59:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802d5c:	72 cd                	jb     802d2b <devcons_write+0x19>
+}
+  802d5e:	89 f0                	mov    %esi,%eax
+  802d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d63:	5b                   	pop    %ebx
+  802d64:	5e                   	pop    %esi
+  802d65:	5f                   	pop    %edi
+  802d66:	5d                   	pop    %ebp
+  802d67:	c3                   	ret
+
+00802d68 <devcons_read>:
+{
+  802d68:	55                   	push   %ebp
+  802d69:	89 e5                	mov    %esp,%ebp
+  802d6b:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d73:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d77:	75 07                	jne    802d80 <devcons_read+0x18>
+  802d79:	eb 1f                	jmp    802d9a <devcons_read+0x32>
+    sys_yield();
+  802d7b:	e8 c4 e1 ff ff       	call   800f44 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802d80:	e8 40 e1 ff ff       	call   800ec5 <sys_cgetc>
+  802d85:	85 c0                	test   %eax,%eax
+  802d87:	74 f2                	je     802d7b <devcons_read+0x13>
+  if (c < 0)
+  802d89:	78 0f                	js     802d9a <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802d8b:	83 f8 04             	cmp    $0x4,%eax
+  802d8e:	74 0c                	je     802d9c <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802d90:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d93:	88 02                	mov    %al,(%edx)
+  return 1;
+  802d95:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802d9a:	c9                   	leave
+  802d9b:	c3                   	ret
+    return 0;
+  802d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da1:	eb f7                	jmp    802d9a <devcons_read+0x32>
+
+00802da3 <cputchar>:
+{
+  802da3:	55                   	push   %ebp
+  802da4:	89 e5                	mov    %esp,%ebp
+  802da6:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802da9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dac:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802daf:	6a 01                	push   $0x1
+  802db1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802db4:	50                   	push   %eax
+  802db5:	e8 ed e0 ff ff       	call   800ea7 <sys_cputs>
+}
+  802dba:	83 c4 10             	add    $0x10,%esp
+  802dbd:	c9                   	leave
+  802dbe:	c3                   	ret
+
+00802dbf <getchar>:
+{
+  802dbf:	55                   	push   %ebp
+  802dc0:	89 e5                	mov    %esp,%ebp
+  802dc2:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802dc5:	6a 01                	push   $0x1
+  802dc7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802dca:	50                   	push   %eax
+  802dcb:	6a 00                	push   $0x0
+  802dcd:	e8 a8 e9 ff ff       	call   80177a <read>
+  if (r < 0)
+  802dd2:	83 c4 10             	add    $0x10,%esp
+  802dd5:	85 c0                	test   %eax,%eax
+  802dd7:	78 06                	js     802ddf <getchar+0x20>
+  if (r < 1)
+  802dd9:	74 06                	je     802de1 <getchar+0x22>
+  return c;
+  802ddb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802ddf:	c9                   	leave
+  802de0:	c3                   	ret
+    return -E_EOF;
+  802de1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802de6:	eb f7                	jmp    802ddf <getchar+0x20>
+
+00802de8 <iscons>:
+{
+  802de8:	55                   	push   %ebp
+  802de9:	89 e5                	mov    %esp,%ebp
+  802deb:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802dee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802df1:	50                   	push   %eax
+  802df2:	ff 75 08             	push   0x8(%ebp)
+  802df5:	e8 d5 e6 ff ff       	call   8014cf <fd_lookup>
+  802dfa:	83 c4 10             	add    $0x10,%esp
+  802dfd:	85 c0                	test   %eax,%eax
+  802dff:	78 11                	js     802e12 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802e01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e04:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802e0a:	39 10                	cmp    %edx,(%eax)
+  802e0c:	0f 94 c0             	sete   %al
+  802e0f:	0f b6 c0             	movzbl %al,%eax
+}
+  802e12:	c9                   	leave
+  802e13:	c3                   	ret
+
+00802e14 <opencons>:
+{
+  802e14:	55                   	push   %ebp
+  802e15:	89 e5                	mov    %esp,%ebp
+  802e17:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802e1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e1d:	50                   	push   %eax
+  802e1e:	e8 56 e6 ff ff       	call   801479 <fd_alloc>
+  802e23:	83 c4 10             	add    $0x10,%esp
+  802e26:	85 c0                	test   %eax,%eax
+  802e28:	78 3a                	js     802e64 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802e2a:	83 ec 04             	sub    $0x4,%esp
+  802e2d:	68 07 04 00 00       	push   $0x407
+  802e32:	ff 75 f4             	push   -0xc(%ebp)
+  802e35:	6a 00                	push   $0x0
+  802e37:	e8 6a e1 ff ff       	call   800fa6 <sys_page_alloc>
+  802e3c:	83 c4 10             	add    $0x10,%esp
+  802e3f:	85 c0                	test   %eax,%eax
+  802e41:	78 21                	js     802e64 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802e43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e46:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802e4c:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802e4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e51:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802e58:	83 ec 0c             	sub    $0xc,%esp
+  802e5b:	50                   	push   %eax
+  802e5c:	e8 f4 e5 ff ff       	call   801455 <fd2num>
+  802e61:	83 c4 10             	add    $0x10,%esp
+}
+  802e64:	c9                   	leave
+  802e65:	c3                   	ret
+
+00802e66 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802e66:	55                   	push   %ebp
+  802e67:	89 e5                	mov    %esp,%ebp
+  802e69:	57                   	push   %edi
+  802e6a:	56                   	push   %esi
+  802e6b:	53                   	push   %ebx
+  802e6c:	83 ec 14             	sub    $0x14,%esp
+  802e6f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e78:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802e7b:	85 c0                	test   %eax,%eax
+  802e7d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802e82:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802e85:	ff 33                	push   (%ebx)
+  802e87:	50                   	push   %eax
+  802e88:	e8 f1 e3 ff ff       	call   80127e <sys_ipc_recv>
+  802e8d:	83 c4 10             	add    $0x10,%esp
+  802e90:	85 c0                	test   %eax,%eax
+  802e92:	78 39                	js     802ecd <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802e94:	85 ff                	test   %edi,%edi
+  802e96:	74 0a                	je     802ea2 <ipc_recv_pages+0x3c>
+  802e98:	a1 44 67 80 00       	mov    0x806744,%eax
+  802e9d:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802ea0:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802ea2:	85 f6                	test   %esi,%esi
+  802ea4:	74 0d                	je     802eb3 <ipc_recv_pages+0x4d>
+  802ea6:	a1 44 67 80 00       	mov    0x806744,%eax
+  802eab:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802eb1:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802eb3:	a1 44 67 80 00       	mov    0x806744,%eax
+  802eb8:	8b 40 74             	mov    0x74(%eax),%eax
+  802ebb:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802ebd:	a1 44 67 80 00       	mov    0x806744,%eax
+  802ec2:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802ec5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ec8:	5b                   	pop    %ebx
+  802ec9:	5e                   	pop    %esi
+  802eca:	5f                   	pop    %edi
+  802ecb:	5d                   	pop    %ebp
+  802ecc:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802ecd:	85 ff                	test   %edi,%edi
+  802ecf:	74 06                	je     802ed7 <ipc_recv_pages+0x71>
+  802ed1:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802ed7:	85 f6                	test   %esi,%esi
+  802ed9:	74 06                	je     802ee1 <ipc_recv_pages+0x7b>
+  802edb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802ee1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802ee7:	eb dc                	jmp    802ec5 <ipc_recv_pages+0x5f>
+
+00802ee9 <ipc_recv>:
+{
+  802ee9:	55                   	push   %ebp
+  802eea:	89 e5                	mov    %esp,%ebp
+  802eec:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802eef:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802ef6:	ff 75 10             	push   0x10(%ebp)
+  802ef9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802efc:	50                   	push   %eax
+  802efd:	ff 75 0c             	push   0xc(%ebp)
+  802f00:	ff 75 08             	push   0x8(%ebp)
+  802f03:	e8 5e ff ff ff       	call   802e66 <ipc_recv_pages>
+}
+  802f08:	c9                   	leave
+  802f09:	c3                   	ret
+
+00802f0a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802f0a:	55                   	push   %ebp
+  802f0b:	89 e5                	mov    %esp,%ebp
+  802f0d:	57                   	push   %edi
+  802f0e:	56                   	push   %esi
+  802f0f:	53                   	push   %ebx
+  802f10:	83 ec 0c             	sub    $0xc,%esp
+  802f13:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802f16:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802f19:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802f1c:	89 c3                	mov    %eax,%ebx
+  802f1e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802f24:	85 c0                	test   %eax,%eax
+  802f26:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802f2b:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802f2e:	83 ec 0c             	sub    $0xc,%esp
+  802f31:	ff 75 14             	push   0x14(%ebp)
+  802f34:	ff 75 18             	push   0x18(%ebp)
+  802f37:	53                   	push   %ebx
+  802f38:	56                   	push   %esi
+  802f39:	57                   	push   %edi
+  802f3a:	e8 1e e3 ff ff       	call   80125d <sys_ipc_try_send>
+  802f3f:	83 c4 20             	add    $0x20,%esp
+  802f42:	85 c0                	test   %eax,%eax
+  802f44:	79 1e                	jns    802f64 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802f46:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f49:	75 07                	jne    802f52 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802f4b:	e8 f4 df ff ff       	call   800f44 <sys_yield>
+  802f50:	eb dc                	jmp    802f2e <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802f52:	50                   	push   %eax
+  802f53:	68 13 38 80 00       	push   $0x803813
+  802f58:	6a 5c                	push   $0x5c
+  802f5a:	68 20 38 80 00       	push   $0x803820
+  802f5f:	e8 4a d5 ff ff       	call   8004ae <_panic>
+  }
+}
+  802f64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f67:	5b                   	pop    %ebx
+  802f68:	5e                   	pop    %esi
+  802f69:	5f                   	pop    %edi
+  802f6a:	5d                   	pop    %ebp
+  802f6b:	c3                   	ret
+
+00802f6c <ipc_send>:
+{
+  802f6c:	55                   	push   %ebp
+  802f6d:	89 e5                	mov    %esp,%ebp
+  802f6f:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802f72:	ff 75 14             	push   0x14(%ebp)
+  802f75:	6a 01                	push   $0x1
+  802f77:	ff 75 10             	push   0x10(%ebp)
+  802f7a:	ff 75 0c             	push   0xc(%ebp)
+  802f7d:	ff 75 08             	push   0x8(%ebp)
+  802f80:	e8 85 ff ff ff       	call   802f0a <ipc_send_pages>
+}
+  802f85:	83 c4 20             	add    $0x20,%esp
+  802f88:	c9                   	leave
+  802f89:	c3                   	ret
+
+00802f8a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802f8a:	55                   	push   %ebp
+  802f8b:	89 e5                	mov    %esp,%ebp
+  802f8d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802f90:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802f95:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802f98:	c1 e0 04             	shl    $0x4,%eax
+  802f9b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802fa0:	8b 40 50             	mov    0x50(%eax),%eax
+  802fa3:	39 c8                	cmp    %ecx,%eax
+  802fa5:	74 12                	je     802fb9 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802fa7:	83 c2 01             	add    $0x1,%edx
+  802faa:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802fb0:	75 e3                	jne    802f95 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802fb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb7:	eb 0e                	jmp    802fc7 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802fb9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802fbc:	c1 e0 04             	shl    $0x4,%eax
+  802fbf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802fc4:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802fc7:	5d                   	pop    %ebp
+  802fc8:	c3                   	ret
+
+00802fc9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802fc9:	55                   	push   %ebp
+  802fca:	89 e5                	mov    %esp,%ebp
+  802fcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802fcf:	89 c2                	mov    %eax,%edx
+  802fd1:	c1 ea 16             	shr    $0x16,%edx
+  802fd4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802fdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802fe0:	f6 c1 01             	test   $0x1,%cl
+  802fe3:	74 1c                	je     803001 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802fe5:	c1 e8 0c             	shr    $0xc,%eax
+  802fe8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802fef:	a8 01                	test   $0x1,%al
+  802ff1:	74 0e                	je     803001 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802ff3:	c1 e8 0c             	shr    $0xc,%eax
+  802ff6:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802ffd:	ef 
+  802ffe:	0f b7 d2             	movzwl %dx,%edx
+}
+  803001:	89 d0                	mov    %edx,%eax
+  803003:	5d                   	pop    %ebp
+  803004:	c3                   	ret
+
+00803005 <udivmod>:
+  803005:	55                   	push   %ebp
+  803006:	57                   	push   %edi
+  803007:	56                   	push   %esi
+  803008:	53                   	push   %ebx
+  803009:	83 ec 14             	sub    $0x14,%esp
+  80300c:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803010:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  803014:	89 fb                	mov    %edi,%ebx
+  803016:	09 f3                	or     %esi,%ebx
+  803018:	0f 84 88 00 00 00    	je     8030a6 <udivmod+0xa1>
+  80301e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803023:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  80302a:	00 
+  80302b:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803032:	00 
+  803033:	89 cd                	mov    %ecx,%ebp
+  803035:	89 34 24             	mov    %esi,(%esp)
+  803038:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  80303c:	eb 08                	jmp    803046 <udivmod+0x41>
+  80303e:	83 ed 01             	sub    $0x1,%ebp
+  803041:	83 fd ff             	cmp    $0xffffffff,%ebp
+  803044:	74 6c                	je     8030b2 <udivmod+0xad>
+  803046:	89 c3                	mov    %eax,%ebx
+  803048:	89 d6                	mov    %edx,%esi
+  80304a:	89 e9                	mov    %ebp,%ecx
+  80304c:	0f ad f3             	shrd   %cl,%esi,%ebx
+  80304f:	d3 ee                	shr    %cl,%esi
+  803051:	f6 c1 20             	test   $0x20,%cl
+  803054:	74 04                	je     80305a <udivmod+0x55>
+  803056:	89 f3                	mov    %esi,%ebx
+  803058:	31 f6                	xor    %esi,%esi
+  80305a:	8b 3c 24             	mov    (%esp),%edi
+  80305d:	39 fb                	cmp    %edi,%ebx
+  80305f:	89 f7                	mov    %esi,%edi
+  803061:	8b 1c 24             	mov    (%esp),%ebx
+  803064:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803068:	19 f7                	sbb    %esi,%edi
+  80306a:	72 d2                	jb     80303e <udivmod+0x39>
+  80306c:	89 f7                	mov    %esi,%edi
+  80306e:	89 de                	mov    %ebx,%esi
+  803070:	89 e9                	mov    %ebp,%ecx
+  803072:	0f a5 f7             	shld   %cl,%esi,%edi
+  803075:	d3 e6                	shl    %cl,%esi
+  803077:	f6 c1 20             	test   $0x20,%cl
+  80307a:	74 04                	je     803080 <udivmod+0x7b>
+  80307c:	89 f7                	mov    %esi,%edi
+  80307e:	31 f6                	xor    %esi,%esi
+  803080:	29 f0                	sub    %esi,%eax
+  803082:	19 fa                	sbb    %edi,%edx
+  803084:	be 01 00 00 00       	mov    $0x1,%esi
+  803089:	bf 00 00 00 00       	mov    $0x0,%edi
+  80308e:	0f a5 f7             	shld   %cl,%esi,%edi
+  803091:	d3 e6                	shl    %cl,%esi
+  803093:	f6 c1 20             	test   $0x20,%cl
+  803096:	74 04                	je     80309c <udivmod+0x97>
+  803098:	89 f7                	mov    %esi,%edi
+  80309a:	31 f6                	xor    %esi,%esi
+  80309c:	09 74 24 08          	or     %esi,0x8(%esp)
+  8030a0:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8030a4:	eb 98                	jmp    80303e <udivmod+0x39>
+  8030a6:	89 f0                	mov    %esi,%eax
+  8030a8:	89 fa                	mov    %edi,%edx
+  8030aa:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8030ae:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8030b2:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8030b6:	89 01                	mov    %eax,(%ecx)
+  8030b8:	89 51 04             	mov    %edx,0x4(%ecx)
+  8030bb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8030bf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8030c3:	83 c4 14             	add    $0x14,%esp
+  8030c6:	5b                   	pop    %ebx
+  8030c7:	5e                   	pop    %esi
+  8030c8:	5f                   	pop    %edi
+  8030c9:	5d                   	pop    %ebp
+  8030ca:	c3                   	ret
+
+008030cb <__udivdi3>:
+  8030cb:	83 ec 18             	sub    $0x18,%esp
+  8030ce:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8030d2:	50                   	push   %eax
+  8030d3:	ff 74 24 2c          	push   0x2c(%esp)
+  8030d7:	ff 74 24 2c          	push   0x2c(%esp)
+  8030db:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8030df:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030e3:	e8 1d ff ff ff       	call   803005 <udivmod>
+  8030e8:	83 c4 24             	add    $0x24,%esp
+  8030eb:	c3                   	ret
+
+008030ec <__umoddi3>:
+  8030ec:	83 ec 18             	sub    $0x18,%esp
+  8030ef:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8030f3:	50                   	push   %eax
+  8030f4:	ff 74 24 2c          	push   0x2c(%esp)
+  8030f8:	ff 74 24 2c          	push   0x2c(%esp)
+  8030fc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803100:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803104:	e8 fc fe ff ff       	call   803005 <udivmod>
+  803109:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80310d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803111:	83 c4 24             	add    $0x24,%esp
+  803114:	c3                   	ret
+
+00803115 <__divdi3>:
+  803115:	56                   	push   %esi
+  803116:	53                   	push   %ebx
+  803117:	83 ec 14             	sub    $0x14,%esp
+  80311a:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80311e:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803122:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803126:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80312a:	85 d2                	test   %edx,%edx
+  80312c:	78 18                	js     803146 <__divdi3+0x31>
+  80312e:	85 db                	test   %ebx,%ebx
+  803130:	78 3e                	js     803170 <__divdi3+0x5b>
+  803132:	83 ec 04             	sub    $0x4,%esp
+  803135:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803139:	56                   	push   %esi
+  80313a:	53                   	push   %ebx
+  80313b:	51                   	push   %ecx
+  80313c:	e8 c4 fe ff ff       	call   803005 <udivmod>
+  803141:	83 c4 10             	add    $0x10,%esp
+  803144:	eb 24                	jmp    80316a <__divdi3+0x55>
+  803146:	f7 d8                	neg    %eax
+  803148:	83 d2 00             	adc    $0x0,%edx
+  80314b:	f7 da                	neg    %edx
+  80314d:	85 db                	test   %ebx,%ebx
+  80314f:	78 3a                	js     80318b <__divdi3+0x76>
+  803151:	83 ec 04             	sub    $0x4,%esp
+  803154:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803158:	56                   	push   %esi
+  803159:	53                   	push   %ebx
+  80315a:	51                   	push   %ecx
+  80315b:	e8 a5 fe ff ff       	call   803005 <udivmod>
+  803160:	83 c4 10             	add    $0x10,%esp
+  803163:	f7 d8                	neg    %eax
+  803165:	83 d2 00             	adc    $0x0,%edx
+  803168:	f7 da                	neg    %edx
+  80316a:	83 c4 14             	add    $0x14,%esp
+  80316d:	5b                   	pop    %ebx
+  80316e:	5e                   	pop    %esi
+  80316f:	c3                   	ret
+  803170:	83 ec 04             	sub    $0x4,%esp
+  803173:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803177:	56                   	push   %esi
+  803178:	f7 d9                	neg    %ecx
+  80317a:	83 d3 00             	adc    $0x0,%ebx
+  80317d:	f7 db                	neg    %ebx
+  80317f:	53                   	push   %ebx
+  803180:	51                   	push   %ecx
+  803181:	e8 7f fe ff ff       	call   803005 <udivmod>
+  803186:	83 c4 10             	add    $0x10,%esp
+  803189:	eb d8                	jmp    803163 <__divdi3+0x4e>
+  80318b:	83 ec 04             	sub    $0x4,%esp
+  80318e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803192:	56                   	push   %esi
+  803193:	f7 d9                	neg    %ecx
+  803195:	83 d3 00             	adc    $0x0,%ebx
+  803198:	f7 db                	neg    %ebx
+  80319a:	53                   	push   %ebx
+  80319b:	51                   	push   %ecx
+  80319c:	e8 64 fe ff ff       	call   803005 <udivmod>
+  8031a1:	83 c4 10             	add    $0x10,%esp
+  8031a4:	eb c4                	jmp    80316a <__divdi3+0x55>
+
+008031a6 <__moddi3>:
+  8031a6:	55                   	push   %ebp
+  8031a7:	57                   	push   %edi
+  8031a8:	56                   	push   %esi
+  8031a9:	53                   	push   %ebx
+  8031aa:	83 ec 24             	sub    $0x24,%esp
+  8031ad:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8031b1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8031b5:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8031b9:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8031bd:	85 d2                	test   %edx,%edx
+  8031bf:	78 3b                	js     8031fc <__moddi3+0x56>
+  8031c1:	83 ec 04             	sub    $0x4,%esp
+  8031c4:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8031c8:	56                   	push   %esi
+  8031c9:	89 ce                	mov    %ecx,%esi
+  8031cb:	f7 de                	neg    %esi
+  8031cd:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8031d1:	89 de                	mov    %ebx,%esi
+  8031d3:	83 d6 00             	adc    $0x0,%esi
+  8031d6:	f7 de                	neg    %esi
+  8031d8:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8031dc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8031e0:	0f 48 f1             	cmovs  %ecx,%esi
+  8031e3:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8031e8:	53                   	push   %ebx
+  8031e9:	56                   	push   %esi
+  8031ea:	e8 16 fe ff ff       	call   803005 <udivmod>
+  8031ef:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8031f3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8031f7:	83 c4 10             	add    $0x10,%esp
+  8031fa:	eb 47                	jmp    803243 <__moddi3+0x9d>
+  8031fc:	f7 d8                	neg    %eax
+  8031fe:	83 d2 00             	adc    $0x0,%edx
+  803201:	f7 da                	neg    %edx
+  803203:	83 ec 04             	sub    $0x4,%esp
+  803206:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80320a:	56                   	push   %esi
+  80320b:	89 cf                	mov    %ecx,%edi
+  80320d:	f7 df                	neg    %edi
+  80320f:	89 de                	mov    %ebx,%esi
+  803211:	83 d6 00             	adc    $0x0,%esi
+  803214:	f7 de                	neg    %esi
+  803216:	0f 49 cf             	cmovns %edi,%ecx
+  803219:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80321d:	0f 49 de             	cmovns %esi,%ebx
+  803220:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803224:	ff 74 24 0c          	push   0xc(%esp)
+  803228:	ff 74 24 0c          	push   0xc(%esp)
+  80322c:	e8 d4 fd ff ff       	call   803005 <udivmod>
+  803231:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803235:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803239:	f7 d8                	neg    %eax
+  80323b:	83 d2 00             	adc    $0x0,%edx
+  80323e:	f7 da                	neg    %edx
+  803240:	83 c4 10             	add    $0x10,%esp
+  803243:	83 c4 24             	add    $0x24,%esp
+  803246:	5b                   	pop    %ebx
+  803247:	5e                   	pop    %esi
+  803248:	5f                   	pop    %edi
+  803249:	5d                   	pop    %ebp
+  80324a:	c3                   	ret
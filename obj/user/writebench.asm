@@ -0,0 +1,6646 @@
+
+obj/user/writebench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 aa 02 00 00       	call   8002db <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <mkfile>:
+
+static char buf[BLKSIZE];
+
+static void
+mkfile(const char *path, int size)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 14             	sub    $0x14,%esp
+  80003c:	89 c7                	mov    %eax,%edi
+  80003e:	89 d6                	mov    %edx,%esi
+  int fd, r;
+
+  if ((fd = open(path, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  800040:	68 02 03 00 00       	push   $0x302
+  800045:	50                   	push   %eax
+  800046:	e8 f4 1d 00 00       	call   801e3f <open>
+  80004b:	89 c3                	mov    %eax,%ebx
+  80004d:	83 c4 10             	add    $0x10,%esp
+  800050:	85 c0                	test   %eax,%eax
+  800052:	78 2e                	js     800082 <mkfile+0x4f>
+    panic("open %s: %e", path, fd);
+  if (size > 0 && (r = write(fd, buf, size)) != size)
+  800054:	85 f6                	test   %esi,%esi
+  800056:	7e 16                	jle    80006e <mkfile+0x3b>
+  800058:	83 ec 04             	sub    $0x4,%esp
+  80005b:	56                   	push   %esi
+  80005c:	68 00 50 80 00       	push   $0x805000
+  800061:	50                   	push   %eax
+  800062:	e8 7b 16 00 00       	call   8016e2 <write>
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	39 c6                	cmp    %eax,%esi
+  80006c:	75 2a                	jne    800098 <mkfile+0x65>
+    panic("write %s: %e", path, r);
+  close(fd);
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	53                   	push   %ebx
+  800072:	e8 15 14 00 00       	call   80148c <close>
+}
+  800077:	83 c4 10             	add    $0x10,%esp
+  80007a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80007d:	5b                   	pop    %ebx
+  80007e:	5e                   	pop    %esi
+  80007f:	5f                   	pop    %edi
+  800080:	5d                   	pop    %ebp
+  800081:	c3                   	ret
+    panic("open %s: %e", path, fd);
+  800082:	83 ec 0c             	sub    $0xc,%esp
+  800085:	50                   	push   %eax
+  800086:	57                   	push   %edi
+  800087:	68 00 31 80 00       	push   $0x803100
+  80008c:	6a 10                	push   $0x10
+  80008e:	68 0c 31 80 00       	push   $0x80310c
+  800093:	e8 b0 02 00 00       	call   800348 <_panic>
+    panic("write %s: %e", path, r);
+  800098:	83 ec 0c             	sub    $0xc,%esp
+  80009b:	50                   	push   %eax
+  80009c:	57                   	push   %edi
+  80009d:	68 1e 31 80 00       	push   $0x80311e
+  8000a2:	6a 12                	push   $0x12
+  8000a4:	68 0c 31 80 00       	push   $0x80310c
+  8000a9:	e8 9a 02 00 00       	call   800348 <_panic>
+
+008000ae <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000ae:	55                   	push   %ebp
+  8000af:	89 e5                	mov    %esp,%ebp
+  8000b1:	57                   	push   %edi
+  8000b2:	56                   	push   %esi
+  8000b3:	53                   	push   %ebx
+  8000b4:	81 ec 4c 01 00 00    	sub    $0x14c,%esp
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Fsret_stats before, after;
+  char path[MAXNAMELEN];
+  unsigned start, write_ms, sync_ms;
+  int i, n, size, r;
+
+  binaryname = "writebench";
+  8000bd:	c7 05 00 40 80 00 2b 	movl   $0x80312b,0x804000
+  8000c4:	31 80 00 
+  n = 128;
+  8000c7:	be 80 00 00 00       	mov    $0x80,%esi
+  size = 1024;
+  8000cc:	c7 85 b4 fe ff ff 00 	movl   $0x400,-0x14c(%ebp)
+  8000d3:	04 00 00 
+  if (argc > 1)
+  8000d6:	83 fb 01             	cmp    $0x1,%ebx
+  8000d9:	7f 54                	jg     80012f <umain+0x81>
+    n = strtol(argv[1], 0, 0);
+  if (argc > 2)
+    size = MIN(strtol(argv[2], 0, 0), BLKSIZE);
+  memset(buf, 'w', sizeof(buf));
+  8000db:	83 ec 04             	sub    $0x4,%esp
+  8000de:	68 00 10 00 00       	push   $0x1000
+  8000e3:	6a 77                	push   $0x77
+  8000e5:	68 00 50 80 00       	push   $0x805000
+  8000ea:	e8 73 0a 00 00       	call   800b62 <memset>
+
+  // Start from a clean cache.
+  if ((r = sync()) < 0)
+  8000ef:	e8 33 20 00 00       	call   802127 <sync>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	85 c0                	test   %eax,%eax
+  8000f9:	0f 88 82 00 00 00    	js     800181 <umain+0xd3>
+    panic("sync: %e", r);
+  if ((r = fs_stats(0, &before)) < 0)
+  8000ff:	83 ec 08             	sub    $0x8,%esp
+  800102:	8d 45 90             	lea    -0x70(%ebp),%eax
+  800105:	50                   	push   %eax
+  800106:	6a 00                	push   $0x0
+  800108:	e8 31 20 00 00       	call   80213e <fs_stats>
+  80010d:	83 c4 10             	add    $0x10,%esp
+  800110:	85 c0                	test   %eax,%eax
+  800112:	78 7f                	js     800193 <umain+0xe5>
+    panic("fs_stats: %e", r);
+
+  start = sys_time_msec();
+  800114:	e8 41 10 00 00       	call   80115a <sys_time_msec>
+  800119:	89 85 b0 fe ff ff    	mov    %eax,-0x150(%ebp)
+  for (i = 0; i < n; i++) {
+  80011f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    snprintf(path, sizeof(path), "/writebench.%d", i);
+  800124:	8d bd b8 fe ff ff    	lea    -0x148(%ebp),%edi
+  for (i = 0; i < n; i++) {
+  80012a:	e9 9a 00 00 00       	jmp    8001c9 <umain+0x11b>
+    n = strtol(argv[1], 0, 0);
+  80012f:	83 ec 04             	sub    $0x4,%esp
+  800132:	6a 00                	push   $0x0
+  800134:	6a 00                	push   $0x0
+  800136:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800139:	ff 70 04             	push   0x4(%eax)
+  80013c:	e8 24 0b 00 00       	call   800c65 <strtol>
+  800141:	89 c6                	mov    %eax,%esi
+  if (argc > 2)
+  800143:	83 c4 10             	add    $0x10,%esp
+  size = 1024;
+  800146:	c7 85 b4 fe ff ff 00 	movl   $0x400,-0x14c(%ebp)
+  80014d:	04 00 00 
+  if (argc > 2)
+  800150:	83 fb 02             	cmp    $0x2,%ebx
+  800153:	7e 86                	jle    8000db <umain+0x2d>
+    size = MIN(strtol(argv[2], 0, 0), BLKSIZE);
+  800155:	83 ec 04             	sub    $0x4,%esp
+  800158:	6a 00                	push   $0x0
+  80015a:	6a 00                	push   $0x0
+  80015c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80015f:	ff 70 08             	push   0x8(%eax)
+  800162:	e8 fe 0a 00 00       	call   800c65 <strtol>
+  800167:	89 c2                	mov    %eax,%edx
+  800169:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80016e:	39 c2                	cmp    %eax,%edx
+  800170:	0f 4e c2             	cmovle %edx,%eax
+  800173:	89 85 b4 fe ff ff    	mov    %eax,-0x14c(%ebp)
+  800179:	83 c4 10             	add    $0x10,%esp
+  80017c:	e9 5a ff ff ff       	jmp    8000db <umain+0x2d>
+    panic("sync: %e", r);
+  800181:	50                   	push   %eax
+  800182:	68 36 31 80 00       	push   $0x803136
+  800187:	6a 29                	push   $0x29
+  800189:	68 0c 31 80 00       	push   $0x80310c
+  80018e:	e8 b5 01 00 00       	call   800348 <_panic>
+    panic("fs_stats: %e", r);
+  800193:	50                   	push   %eax
+  800194:	68 3f 31 80 00       	push   $0x80313f
+  800199:	6a 2b                	push   $0x2b
+  80019b:	68 0c 31 80 00       	push   $0x80310c
+  8001a0:	e8 a3 01 00 00       	call   800348 <_panic>
+    snprintf(path, sizeof(path), "/writebench.%d", i);
+  8001a5:	53                   	push   %ebx
+  8001a6:	68 4c 31 80 00       	push   $0x80314c
+  8001ab:	68 80 00 00 00       	push   $0x80
+  8001b0:	57                   	push   %edi
+  8001b1:	e8 06 08 00 00       	call   8009bc <snprintf>
+    mkfile(path, size);
+  8001b6:	8b 95 b4 fe ff ff    	mov    -0x14c(%ebp),%edx
+  8001bc:	89 f8                	mov    %edi,%eax
+  8001be:	e8 70 fe ff ff       	call   800033 <mkfile>
+  for (i = 0; i < n; i++) {
+  8001c3:	83 c3 01             	add    $0x1,%ebx
+  8001c6:	83 c4 10             	add    $0x10,%esp
+  8001c9:	39 f3                	cmp    %esi,%ebx
+  8001cb:	7c d8                	jl     8001a5 <umain+0xf7>
+  }
+  write_ms = sys_time_msec() - start;
+  8001cd:	e8 88 0f 00 00       	call   80115a <sys_time_msec>
+  8001d2:	8b 8d b0 fe ff ff    	mov    -0x150(%ebp),%ecx
+  8001d8:	29 c8                	sub    %ecx,%eax
+  8001da:	89 c3                	mov    %eax,%ebx
+
+  start = sys_time_msec();
+  8001dc:	e8 79 0f 00 00       	call   80115a <sys_time_msec>
+  8001e1:	89 c7                	mov    %eax,%edi
+  if ((r = sync()) < 0)
+  8001e3:	e8 3f 1f 00 00       	call   802127 <sync>
+  8001e8:	85 c0                	test   %eax,%eax
+  8001ea:	0f 88 98 00 00 00    	js     800288 <umain+0x1da>
+    panic("sync: %e", r);
+  sync_ms = sys_time_msec() - start;
+  8001f0:	e8 65 0f 00 00       	call   80115a <sys_time_msec>
+  8001f5:	29 f8                	sub    %edi,%eax
+  8001f7:	89 c7                	mov    %eax,%edi
+
+  if ((r = fs_stats(0, &after)) < 0)
+  8001f9:	83 ec 08             	sub    $0x8,%esp
+  8001fc:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+  800202:	50                   	push   %eax
+  800203:	6a 00                	push   $0x0
+  800205:	e8 34 1f 00 00       	call   80213e <fs_stats>
+  80020a:	83 c4 10             	add    $0x10,%esp
+  80020d:	85 c0                	test   %eax,%eax
+  80020f:	0f 88 85 00 00 00    	js     80029a <umain+0x1ec>
+    panic("fs_stats: %e", r);
+
+  cprintf("writebench: %d files x %d bytes  write %d ms = %d KB/s  "
+  800215:	83 ec 08             	sub    $0x8,%esp
+  800218:	57                   	push   %edi
+          "sync %d ms\n", n, size, write_ms,
+          n * size / 1024 * 1000 / MAX(write_ms, 1), sync_ms);
+  800219:	8b bd b4 fe ff ff    	mov    -0x14c(%ebp),%edi
+  80021f:	89 fa                	mov    %edi,%edx
+  800221:	0f af d6             	imul   %esi,%edx
+  800224:	8d 82 ff 03 00 00    	lea    0x3ff(%edx),%eax
+  80022a:	85 d2                	test   %edx,%edx
+  80022c:	0f 49 c2             	cmovns %edx,%eax
+  80022f:	c1 f8 0a             	sar    $0xa,%eax
+  800232:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  800238:	85 db                	test   %ebx,%ebx
+  80023a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80023f:	0f 45 cb             	cmovne %ebx,%ecx
+  cprintf("writebench: %d files x %d bytes  write %d ms = %d KB/s  "
+  800242:	ba 00 00 00 00       	mov    $0x0,%edx
+  800247:	f7 f1                	div    %ecx
+  800249:	50                   	push   %eax
+  80024a:	53                   	push   %ebx
+  80024b:	57                   	push   %edi
+  80024c:	56                   	push   %esi
+  80024d:	68 5c 31 80 00       	push   $0x80315c
+  800252:	e8 cc 01 00 00       	call   800423 <cprintf>
+  cprintf("writebench: %d blocks in %d disk writes\n",
+  800257:	83 c4 1c             	add    $0x1c,%esp
+  80025a:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  800260:	2b 45 a8             	sub    -0x58(%ebp),%eax
+  800263:	50                   	push   %eax
+  800264:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  80026a:	2b 45 ac             	sub    -0x54(%ebp),%eax
+  80026d:	50                   	push   %eax
+  80026e:	68 a0 31 80 00       	push   $0x8031a0
+  800273:	e8 ab 01 00 00       	call   800423 <cprintf>
+          after.ret_bc_written - before.ret_bc_written,
+          after.ret_bc_writes - before.ret_bc_writes);
+
+  // Give the space back (there is no remove).
+  for (i = 0; i < n; i++) {
+  800278:	83 c4 10             	add    $0x10,%esp
+  80027b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    snprintf(path, sizeof(path), "/writebench.%d", i);
+  800280:	8d bd b8 fe ff ff    	lea    -0x148(%ebp),%edi
+  for (i = 0; i < n; i++) {
+  800286:	eb 47                	jmp    8002cf <umain+0x221>
+    panic("sync: %e", r);
+  800288:	50                   	push   %eax
+  800289:	68 36 31 80 00       	push   $0x803136
+  80028e:	6a 36                	push   $0x36
+  800290:	68 0c 31 80 00       	push   $0x80310c
+  800295:	e8 ae 00 00 00       	call   800348 <_panic>
+    panic("fs_stats: %e", r);
+  80029a:	50                   	push   %eax
+  80029b:	68 3f 31 80 00       	push   $0x80313f
+  8002a0:	6a 3a                	push   $0x3a
+  8002a2:	68 0c 31 80 00       	push   $0x80310c
+  8002a7:	e8 9c 00 00 00       	call   800348 <_panic>
+    snprintf(path, sizeof(path), "/writebench.%d", i);
+  8002ac:	53                   	push   %ebx
+  8002ad:	68 4c 31 80 00       	push   $0x80314c
+  8002b2:	68 80 00 00 00       	push   $0x80
+  8002b7:	57                   	push   %edi
+  8002b8:	e8 ff 06 00 00       	call   8009bc <snprintf>
+    mkfile(path, 0);
+  8002bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002c2:	89 f8                	mov    %edi,%eax
+  8002c4:	e8 6a fd ff ff       	call   800033 <mkfile>
+  for (i = 0; i < n; i++) {
+  8002c9:	83 c3 01             	add    $0x1,%ebx
+  8002cc:	83 c4 10             	add    $0x10,%esp
+  8002cf:	39 f3                	cmp    %esi,%ebx
+  8002d1:	7c d9                	jl     8002ac <umain+0x1fe>
+  }
+}
+  8002d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d6:	5b                   	pop    %ebx
+  8002d7:	5e                   	pop    %esi
+  8002d8:	5f                   	pop    %edi
+  8002d9:	5d                   	pop    %ebp
+  8002da:	c3                   	ret
+
+008002db <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002db:	55                   	push   %ebp
+  8002dc:	89 e5                	mov    %esp,%ebp
+  8002de:	56                   	push   %esi
+  8002df:	53                   	push   %ebx
+  8002e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8002e6:	c7 05 44 67 80 00 00 	movl   $0x0,0x806744
+  8002ed:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8002f0:	e8 ca 0a 00 00       	call   800dbf <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8002f5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002fa:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8002fd:	c1 e0 04             	shl    $0x4,%eax
+  800300:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800305:	a3 44 67 80 00       	mov    %eax,0x806744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80030a:	85 db                	test   %ebx,%ebx
+  80030c:	7e 07                	jle    800315 <libmain+0x3a>
+    binaryname = argv[0];
+  80030e:	8b 06                	mov    (%esi),%eax
+  800310:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800315:	83 ec 08             	sub    $0x8,%esp
+  800318:	56                   	push   %esi
+  800319:	53                   	push   %ebx
+  80031a:	e8 8f fd ff ff       	call   8000ae <umain>
+
+  // exit gracefully
+  exit();
+  80031f:	e8 0a 00 00 00       	call   80032e <exit>
+}
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80032a:	5b                   	pop    %ebx
+  80032b:	5e                   	pop    %esi
+  80032c:	5d                   	pop    %ebp
+  80032d:	c3                   	ret
+
+0080032e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80032e:	55                   	push   %ebp
+  80032f:	89 e5                	mov    %esp,%ebp
+  800331:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800334:	e8 80 11 00 00       	call   8014b9 <close_all>
+  sys_env_destroy(0);
+  800339:	83 ec 0c             	sub    $0xc,%esp
+  80033c:	6a 00                	push   $0x0
+  80033e:	e8 3b 0a 00 00       	call   800d7e <sys_env_destroy>
+}
+  800343:	83 c4 10             	add    $0x10,%esp
+  800346:	c9                   	leave
+  800347:	c3                   	ret
+
+00800348 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800348:	55                   	push   %ebp
+  800349:	89 e5                	mov    %esp,%ebp
+  80034b:	56                   	push   %esi
+  80034c:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80034d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800350:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800356:	e8 64 0a 00 00       	call   800dbf <sys_getenvid>
+  80035b:	83 ec 0c             	sub    $0xc,%esp
+  80035e:	ff 75 0c             	push   0xc(%ebp)
+  800361:	ff 75 08             	push   0x8(%ebp)
+  800364:	56                   	push   %esi
+  800365:	50                   	push   %eax
+  800366:	68 d4 31 80 00       	push   $0x8031d4
+  80036b:	e8 b3 00 00 00       	call   800423 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800370:	83 c4 18             	add    $0x18,%esp
+  800373:	53                   	push   %ebx
+  800374:	ff 75 10             	push   0x10(%ebp)
+  800377:	e8 56 00 00 00       	call   8003d2 <vcprintf>
+  cprintf("\n");
+  80037c:	c7 04 24 40 36 80 00 	movl   $0x803640,(%esp)
+  800383:	e8 9b 00 00 00       	call   800423 <cprintf>
+  800388:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80038b:	cc                   	int3
+  while (1)
+  80038c:	eb fd                	jmp    80038b <_panic+0x43>
+
+0080038e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80038e:	55                   	push   %ebp
+  80038f:	89 e5                	mov    %esp,%ebp
+  800391:	53                   	push   %ebx
+  800392:	83 ec 04             	sub    $0x4,%esp
+  800395:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800398:	8b 13                	mov    (%ebx),%edx
+  80039a:	8d 42 01             	lea    0x1(%edx),%eax
+  80039d:	89 03                	mov    %eax,(%ebx)
+  80039f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003a2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8003a6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003ab:	74 09                	je     8003b6 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8003ad:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003b4:	c9                   	leave
+  8003b5:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8003b6:	83 ec 08             	sub    $0x8,%esp
+  8003b9:	68 ff 00 00 00       	push   $0xff
+  8003be:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003c1:	50                   	push   %eax
+  8003c2:	e8 7a 09 00 00       	call   800d41 <sys_cputs>
+    b->idx = 0;
+  8003c7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003cd:	83 c4 10             	add    $0x10,%esp
+  8003d0:	eb db                	jmp    8003ad <putch+0x1f>
+
+008003d2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003d2:	55                   	push   %ebp
+  8003d3:	89 e5                	mov    %esp,%ebp
+  8003d5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8003db:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003e2:	00 00 00 
+  b.cnt = 0;
+  8003e5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003ec:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8003ef:	ff 75 0c             	push   0xc(%ebp)
+  8003f2:	ff 75 08             	push   0x8(%ebp)
+  8003f5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003fb:	50                   	push   %eax
+  8003fc:	68 8e 03 80 00       	push   $0x80038e
+  800401:	e8 14 01 00 00       	call   80051a <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800406:	83 c4 08             	add    $0x8,%esp
+  800409:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80040f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800415:	50                   	push   %eax
+  800416:	e8 26 09 00 00       	call   800d41 <sys_cputs>
+
+  return b.cnt;
+}
+  80041b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800421:	c9                   	leave
+  800422:	c3                   	ret
+
+00800423 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800423:	55                   	push   %ebp
+  800424:	89 e5                	mov    %esp,%ebp
+  800426:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800429:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80042c:	50                   	push   %eax
+  80042d:	ff 75 08             	push   0x8(%ebp)
+  800430:	e8 9d ff ff ff       	call   8003d2 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800435:	c9                   	leave
+  800436:	c3                   	ret
+
+00800437 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800437:	55                   	push   %ebp
+  800438:	89 e5                	mov    %esp,%ebp
+  80043a:	57                   	push   %edi
+  80043b:	56                   	push   %esi
+  80043c:	53                   	push   %ebx
+  80043d:	83 ec 1c             	sub    $0x1c,%esp
+  800440:	89 c7                	mov    %eax,%edi
+  800442:	89 d6                	mov    %edx,%esi
+  800444:	8b 45 08             	mov    0x8(%ebp),%eax
+  800447:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80044a:	89 d1                	mov    %edx,%ecx
+  80044c:	89 c2                	mov    %eax,%edx
+  80044e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800451:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800454:	8b 45 10             	mov    0x10(%ebp),%eax
+  800457:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80045a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80045d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800464:	39 c2                	cmp    %eax,%edx
+  800466:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800469:	72 3e                	jb     8004a9 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80046b:	83 ec 0c             	sub    $0xc,%esp
+  80046e:	ff 75 18             	push   0x18(%ebp)
+  800471:	83 eb 01             	sub    $0x1,%ebx
+  800474:	53                   	push   %ebx
+  800475:	50                   	push   %eax
+  800476:	83 ec 08             	sub    $0x8,%esp
+  800479:	ff 75 e4             	push   -0x1c(%ebp)
+  80047c:	ff 75 e0             	push   -0x20(%ebp)
+  80047f:	ff 75 dc             	push   -0x24(%ebp)
+  800482:	ff 75 d8             	push   -0x28(%ebp)
+  800485:	e8 db 2a 00 00       	call   802f65 <__udivdi3>
+  80048a:	83 c4 18             	add    $0x18,%esp
+  80048d:	52                   	push   %edx
+  80048e:	50                   	push   %eax
+  80048f:	89 f2                	mov    %esi,%edx
+  800491:	89 f8                	mov    %edi,%eax
+  800493:	e8 9f ff ff ff       	call   800437 <printnum>
+  800498:	83 c4 20             	add    $0x20,%esp
+  80049b:	eb 13                	jmp    8004b0 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80049d:	83 ec 08             	sub    $0x8,%esp
+  8004a0:	56                   	push   %esi
+  8004a1:	ff 75 18             	push   0x18(%ebp)
+  8004a4:	ff d7                	call   *%edi
+  8004a6:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8004a9:	83 eb 01             	sub    $0x1,%ebx
+  8004ac:	85 db                	test   %ebx,%ebx
+  8004ae:	7f ed                	jg     80049d <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8004b0:	83 ec 08             	sub    $0x8,%esp
+  8004b3:	56                   	push   %esi
+  8004b4:	83 ec 04             	sub    $0x4,%esp
+  8004b7:	ff 75 e4             	push   -0x1c(%ebp)
+  8004ba:	ff 75 e0             	push   -0x20(%ebp)
+  8004bd:	ff 75 dc             	push   -0x24(%ebp)
+  8004c0:	ff 75 d8             	push   -0x28(%ebp)
+  8004c3:	e8 be 2a 00 00       	call   802f86 <__umoddi3>
+  8004c8:	83 c4 14             	add    $0x14,%esp
+  8004cb:	0f be 80 f7 31 80 00 	movsbl 0x8031f7(%eax),%eax
+  8004d2:	50                   	push   %eax
+  8004d3:	ff d7                	call   *%edi
+}
+  8004d5:	83 c4 10             	add    $0x10,%esp
+  8004d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004db:	5b                   	pop    %ebx
+  8004dc:	5e                   	pop    %esi
+  8004dd:	5f                   	pop    %edi
+  8004de:	5d                   	pop    %ebp
+  8004df:	c3                   	ret
+
+008004e0 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004e0:	55                   	push   %ebp
+  8004e1:	89 e5                	mov    %esp,%ebp
+  8004e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8004e6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8004ea:	8b 10                	mov    (%eax),%edx
+  8004ec:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004ef:	73 0a                	jae    8004fb <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8004f1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004f4:	89 08                	mov    %ecx,(%eax)
+  8004f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004f9:	88 02                	mov    %al,(%edx)
+}
+  8004fb:	5d                   	pop    %ebp
+  8004fc:	c3                   	ret
+
+008004fd <printfmt>:
+{
+  8004fd:	55                   	push   %ebp
+  8004fe:	89 e5                	mov    %esp,%ebp
+  800500:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800503:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800506:	50                   	push   %eax
+  800507:	ff 75 10             	push   0x10(%ebp)
+  80050a:	ff 75 0c             	push   0xc(%ebp)
+  80050d:	ff 75 08             	push   0x8(%ebp)
+  800510:	e8 05 00 00 00       	call   80051a <vprintfmt>
+}
+  800515:	83 c4 10             	add    $0x10,%esp
+  800518:	c9                   	leave
+  800519:	c3                   	ret
+
+0080051a <vprintfmt>:
+{
+  80051a:	55                   	push   %ebp
+  80051b:	89 e5                	mov    %esp,%ebp
+  80051d:	57                   	push   %edi
+  80051e:	56                   	push   %esi
+  80051f:	53                   	push   %ebx
+  800520:	83 ec 2c             	sub    $0x2c,%esp
+  800523:	8b 75 08             	mov    0x8(%ebp),%esi
+  800526:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800529:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80052c:	eb 0a                	jmp    800538 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80052e:	83 ec 08             	sub    $0x8,%esp
+  800531:	53                   	push   %ebx
+  800532:	50                   	push   %eax
+  800533:	ff d6                	call   *%esi
+  800535:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800538:	83 c7 01             	add    $0x1,%edi
+  80053b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80053f:	83 f8 25             	cmp    $0x25,%eax
+  800542:	74 0c                	je     800550 <vprintfmt+0x36>
+      if (ch == '\0')
+  800544:	85 c0                	test   %eax,%eax
+  800546:	75 e6                	jne    80052e <vprintfmt+0x14>
+}
+  800548:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80054b:	5b                   	pop    %ebx
+  80054c:	5e                   	pop    %esi
+  80054d:	5f                   	pop    %edi
+  80054e:	5d                   	pop    %ebp
+  80054f:	c3                   	ret
+    padc = ' ';
+  800550:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800554:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80055b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800562:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800569:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80056e:	8d 47 01             	lea    0x1(%edi),%eax
+  800571:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800574:	0f b6 17             	movzbl (%edi),%edx
+  800577:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80057a:	3c 55                	cmp    $0x55,%al
+  80057c:	0f 87 cf 03 00 00    	ja     800951 <vprintfmt+0x437>
+  800582:	0f b6 c0             	movzbl %al,%eax
+  800585:	ff 24 85 40 33 80 00 	jmp    *0x803340(,%eax,4)
+  80058c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80058f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800593:	eb d9                	jmp    80056e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800595:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800598:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80059c:	eb d0                	jmp    80056e <vprintfmt+0x54>
+  80059e:	0f b6 d2             	movzbl %dl,%edx
+  8005a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8005a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8005ac:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005af:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8005b3:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8005b6:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005b9:	83 f9 09             	cmp    $0x9,%ecx
+  8005bc:	77 55                	ja     800613 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8005be:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8005c1:	eb e9                	jmp    8005ac <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8005c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c6:	8b 00                	mov    (%eax),%eax
+  8005c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d1:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8005d7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005db:	79 91                	jns    80056e <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8005dd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005e0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005e3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005ea:	eb 82                	jmp    80056e <vprintfmt+0x54>
+      if (width < 0)
+  8005ec:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005ef:	85 d2                	test   %edx,%edx
+  8005f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f6:	0f 49 c2             	cmovns %edx,%eax
+  8005f9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8005ff:	e9 6a ff ff ff       	jmp    80056e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800604:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800607:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80060e:	e9 5b ff ff ff       	jmp    80056e <vprintfmt+0x54>
+  800613:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800616:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800619:	eb bc                	jmp    8005d7 <vprintfmt+0xbd>
+      lflag++;
+  80061b:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80061e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800621:	e9 48 ff ff ff       	jmp    80056e <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800626:	8b 45 14             	mov    0x14(%ebp),%eax
+  800629:	8d 78 04             	lea    0x4(%eax),%edi
+  80062c:	83 ec 08             	sub    $0x8,%esp
+  80062f:	53                   	push   %ebx
+  800630:	ff 30                	push   (%eax)
+  800632:	ff d6                	call   *%esi
+      break;
+  800634:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800637:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80063a:	e9 b1 02 00 00       	jmp    8008f0 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80063f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800642:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800645:	8b 10                	mov    (%eax),%edx
+  800647:	89 d0                	mov    %edx,%eax
+  800649:	f7 d8                	neg    %eax
+  80064b:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80064e:	83 f8 10             	cmp    $0x10,%eax
+  800651:	7f 23                	jg     800676 <vprintfmt+0x15c>
+  800653:	8b 14 85 a0 34 80 00 	mov    0x8034a0(,%eax,4),%edx
+  80065a:	85 d2                	test   %edx,%edx
+  80065c:	74 18                	je     800676 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80065e:	52                   	push   %edx
+  80065f:	68 ea 35 80 00       	push   $0x8035ea
+  800664:	53                   	push   %ebx
+  800665:	56                   	push   %esi
+  800666:	e8 92 fe ff ff       	call   8004fd <printfmt>
+  80066b:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80066e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800671:	e9 7a 02 00 00       	jmp    8008f0 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800676:	50                   	push   %eax
+  800677:	68 0f 32 80 00       	push   $0x80320f
+  80067c:	53                   	push   %ebx
+  80067d:	56                   	push   %esi
+  80067e:	e8 7a fe ff ff       	call   8004fd <printfmt>
+  800683:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800686:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800689:	e9 62 02 00 00       	jmp    8008f0 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	83 c0 04             	add    $0x4,%eax
+  800694:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80069c:	85 c9                	test   %ecx,%ecx
+  80069e:	b8 08 32 80 00       	mov    $0x803208,%eax
+  8006a3:	0f 45 c1             	cmovne %ecx,%eax
+  8006a6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8006a9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006ad:	7e 06                	jle    8006b5 <vprintfmt+0x19b>
+  8006af:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006b3:	75 0b                	jne    8006c0 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006b5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006b8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006bb:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006be:	eb 5c                	jmp    80071c <vprintfmt+0x202>
+  8006c0:	83 ec 08             	sub    $0x8,%esp
+  8006c3:	ff 75 d0             	push   -0x30(%ebp)
+  8006c6:	ff 75 cc             	push   -0x34(%ebp)
+  8006c9:	e8 20 03 00 00       	call   8009ee <strnlen>
+  8006ce:	89 c2                	mov    %eax,%edx
+  8006d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006d3:	29 d0                	sub    %edx,%eax
+  8006d5:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8006d8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006df:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006e2:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006e4:	eb 0e                	jmp    8006f4 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8006e6:	83 ec 08             	sub    $0x8,%esp
+  8006e9:	53                   	push   %ebx
+  8006ea:	57                   	push   %edi
+  8006eb:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006ee:	83 ee 01             	sub    $0x1,%esi
+  8006f1:	83 c4 10             	add    $0x10,%esp
+  8006f4:	85 f6                	test   %esi,%esi
+  8006f6:	7f ee                	jg     8006e6 <vprintfmt+0x1cc>
+  8006f8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006fe:	85 c0                	test   %eax,%eax
+  800700:	ba 00 00 00 00       	mov    $0x0,%edx
+  800705:	0f 49 d0             	cmovns %eax,%edx
+  800708:	29 d0                	sub    %edx,%eax
+  80070a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80070d:	eb a6                	jmp    8006b5 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80070f:	83 ec 08             	sub    $0x8,%esp
+  800712:	53                   	push   %ebx
+  800713:	52                   	push   %edx
+  800714:	ff 55 08             	call   *0x8(%ebp)
+  800717:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80071a:	89 f1                	mov    %esi,%ecx
+  80071c:	8d 71 01             	lea    0x1(%ecx),%esi
+  80071f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800723:	0f be d0             	movsbl %al,%edx
+  800726:	85 d2                	test   %edx,%edx
+  800728:	74 28                	je     800752 <vprintfmt+0x238>
+  80072a:	85 ff                	test   %edi,%edi
+  80072c:	78 05                	js     800733 <vprintfmt+0x219>
+  80072e:	83 ef 01             	sub    $0x1,%edi
+  800731:	78 30                	js     800763 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800733:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800737:	74 d6                	je     80070f <vprintfmt+0x1f5>
+  800739:	0f be c0             	movsbl %al,%eax
+  80073c:	83 e8 20             	sub    $0x20,%eax
+  80073f:	83 f8 5e             	cmp    $0x5e,%eax
+  800742:	76 cb                	jbe    80070f <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800744:	83 ec 08             	sub    $0x8,%esp
+  800747:	53                   	push   %ebx
+  800748:	6a 3f                	push   $0x3f
+  80074a:	ff 55 08             	call   *0x8(%ebp)
+  80074d:	83 c4 10             	add    $0x10,%esp
+  800750:	eb c8                	jmp    80071a <vprintfmt+0x200>
+  800752:	8b 75 08             	mov    0x8(%ebp),%esi
+  800755:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800758:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80075b:	01 d0                	add    %edx,%eax
+  80075d:	29 c8                	sub    %ecx,%eax
+  80075f:	89 c7                	mov    %eax,%edi
+  800761:	eb 13                	jmp    800776 <vprintfmt+0x25c>
+  800763:	8b 75 08             	mov    0x8(%ebp),%esi
+  800766:	eb ed                	jmp    800755 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800768:	83 ec 08             	sub    $0x8,%esp
+  80076b:	53                   	push   %ebx
+  80076c:	6a 20                	push   $0x20
+  80076e:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800770:	83 ef 01             	sub    $0x1,%edi
+  800773:	83 c4 10             	add    $0x10,%esp
+  800776:	85 ff                	test   %edi,%edi
+  800778:	7f ee                	jg     800768 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80077a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80077d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800780:	e9 6b 01 00 00       	jmp    8008f0 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800785:	83 f9 01             	cmp    $0x1,%ecx
+  800788:	7f 1f                	jg     8007a9 <vprintfmt+0x28f>
+  else if (lflag)
+  80078a:	85 c9                	test   %ecx,%ecx
+  80078c:	74 67                	je     8007f5 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80078e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800791:	8b 00                	mov    (%eax),%eax
+  800793:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800796:	89 c1                	mov    %eax,%ecx
+  800798:	c1 f9 1f             	sar    $0x1f,%ecx
+  80079b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80079e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a7:	eb 17                	jmp    8007c0 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8007a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ac:	8b 50 04             	mov    0x4(%eax),%edx
+  8007af:	8b 00                	mov    (%eax),%eax
+  8007b1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007b4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ba:	8d 40 08             	lea    0x8(%eax),%eax
+  8007bd:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8007c0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007c3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8007c6:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8007cb:	85 c9                	test   %ecx,%ecx
+  8007cd:	0f 89 03 01 00 00    	jns    8008d6 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8007d3:	83 ec 08             	sub    $0x8,%esp
+  8007d6:	53                   	push   %ebx
+  8007d7:	6a 2d                	push   $0x2d
+  8007d9:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8007db:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007de:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007e1:	f7 da                	neg    %edx
+  8007e3:	83 d1 00             	adc    $0x0,%ecx
+  8007e6:	f7 d9                	neg    %ecx
+  8007e8:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8007eb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007f0:	e9 e1 00 00 00       	jmp    8008d6 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8007f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f8:	8b 00                	mov    (%eax),%eax
+  8007fa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007fd:	89 c1                	mov    %eax,%ecx
+  8007ff:	c1 f9 1f             	sar    $0x1f,%ecx
+  800802:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800805:	8b 45 14             	mov    0x14(%ebp),%eax
+  800808:	8d 40 04             	lea    0x4(%eax),%eax
+  80080b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80080e:	eb b0                	jmp    8007c0 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800810:	83 f9 01             	cmp    $0x1,%ecx
+  800813:	7f 1e                	jg     800833 <vprintfmt+0x319>
+  else if (lflag)
+  800815:	85 c9                	test   %ecx,%ecx
+  800817:	74 32                	je     80084b <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800819:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081c:	8b 10                	mov    (%eax),%edx
+  80081e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800823:	8d 40 04             	lea    0x4(%eax),%eax
+  800826:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800829:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80082e:	e9 a3 00 00 00       	jmp    8008d6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800833:	8b 45 14             	mov    0x14(%ebp),%eax
+  800836:	8b 10                	mov    (%eax),%edx
+  800838:	8b 48 04             	mov    0x4(%eax),%ecx
+  80083b:	8d 40 08             	lea    0x8(%eax),%eax
+  80083e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800841:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800846:	e9 8b 00 00 00       	jmp    8008d6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80084b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084e:	8b 10                	mov    (%eax),%edx
+  800850:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800855:	8d 40 04             	lea    0x4(%eax),%eax
+  800858:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80085b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800860:	eb 74                	jmp    8008d6 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800862:	83 f9 01             	cmp    $0x1,%ecx
+  800865:	7f 1b                	jg     800882 <vprintfmt+0x368>
+  else if (lflag)
+  800867:	85 c9                	test   %ecx,%ecx
+  800869:	74 2c                	je     800897 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80086b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086e:	8b 10                	mov    (%eax),%edx
+  800870:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800875:	8d 40 04             	lea    0x4(%eax),%eax
+  800878:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80087b:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800880:	eb 54                	jmp    8008d6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800882:	8b 45 14             	mov    0x14(%ebp),%eax
+  800885:	8b 10                	mov    (%eax),%edx
+  800887:	8b 48 04             	mov    0x4(%eax),%ecx
+  80088a:	8d 40 08             	lea    0x8(%eax),%eax
+  80088d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800890:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800895:	eb 3f                	jmp    8008d6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800897:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089a:	8b 10                	mov    (%eax),%edx
+  80089c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a4:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8008a7:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8008ac:	eb 28                	jmp    8008d6 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8008ae:	83 ec 08             	sub    $0x8,%esp
+  8008b1:	53                   	push   %ebx
+  8008b2:	6a 30                	push   $0x30
+  8008b4:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8008b6:	83 c4 08             	add    $0x8,%esp
+  8008b9:	53                   	push   %ebx
+  8008ba:	6a 78                	push   $0x78
+  8008bc:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8008be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c1:	8b 10                	mov    (%eax),%edx
+  8008c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8008c8:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8008cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ce:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008d1:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8008d6:	83 ec 0c             	sub    $0xc,%esp
+  8008d9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008dd:	50                   	push   %eax
+  8008de:	ff 75 e0             	push   -0x20(%ebp)
+  8008e1:	57                   	push   %edi
+  8008e2:	51                   	push   %ecx
+  8008e3:	52                   	push   %edx
+  8008e4:	89 da                	mov    %ebx,%edx
+  8008e6:	89 f0                	mov    %esi,%eax
+  8008e8:	e8 4a fb ff ff       	call   800437 <printnum>
+      break;
+  8008ed:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8008f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8008f3:	e9 40 fc ff ff       	jmp    800538 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8008f8:	83 f9 01             	cmp    $0x1,%ecx
+  8008fb:	7f 1b                	jg     800918 <vprintfmt+0x3fe>
+  else if (lflag)
+  8008fd:	85 c9                	test   %ecx,%ecx
+  8008ff:	74 2c                	je     80092d <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800901:	8b 45 14             	mov    0x14(%ebp),%eax
+  800904:	8b 10                	mov    (%eax),%edx
+  800906:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80090b:	8d 40 04             	lea    0x4(%eax),%eax
+  80090e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800911:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800916:	eb be                	jmp    8008d6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800918:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091b:	8b 10                	mov    (%eax),%edx
+  80091d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800920:	8d 40 08             	lea    0x8(%eax),%eax
+  800923:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800926:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80092b:	eb a9                	jmp    8008d6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80092d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800930:	8b 10                	mov    (%eax),%edx
+  800932:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800937:	8d 40 04             	lea    0x4(%eax),%eax
+  80093a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80093d:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800942:	eb 92                	jmp    8008d6 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800944:	83 ec 08             	sub    $0x8,%esp
+  800947:	53                   	push   %ebx
+  800948:	6a 25                	push   $0x25
+  80094a:	ff d6                	call   *%esi
+      break;
+  80094c:	83 c4 10             	add    $0x10,%esp
+  80094f:	eb 9f                	jmp    8008f0 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800951:	83 ec 08             	sub    $0x8,%esp
+  800954:	53                   	push   %ebx
+  800955:	6a 25                	push   $0x25
+  800957:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800959:	83 c4 10             	add    $0x10,%esp
+  80095c:	89 f8                	mov    %edi,%eax
+  80095e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800962:	74 05                	je     800969 <vprintfmt+0x44f>
+  800964:	83 e8 01             	sub    $0x1,%eax
+  800967:	eb f5                	jmp    80095e <vprintfmt+0x444>
+  800969:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80096c:	eb 82                	jmp    8008f0 <vprintfmt+0x3d6>
+
+0080096e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	83 ec 18             	sub    $0x18,%esp
+  800974:	8b 45 08             	mov    0x8(%ebp),%eax
+  800977:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80097a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80097d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800981:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800984:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80098b:	85 c0                	test   %eax,%eax
+  80098d:	74 26                	je     8009b5 <vsnprintf+0x47>
+  80098f:	85 d2                	test   %edx,%edx
+  800991:	7e 22                	jle    8009b5 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800993:	ff 75 14             	push   0x14(%ebp)
+  800996:	ff 75 10             	push   0x10(%ebp)
+  800999:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80099c:	50                   	push   %eax
+  80099d:	68 e0 04 80 00       	push   $0x8004e0
+  8009a2:	e8 73 fb ff ff       	call   80051a <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8009a7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009aa:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8009ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009b0:	83 c4 10             	add    $0x10,%esp
+}
+  8009b3:	c9                   	leave
+  8009b4:	c3                   	ret
+    return -E_INVAL;
+  8009b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009ba:	eb f7                	jmp    8009b3 <vsnprintf+0x45>
+
+008009bc <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009bc:	55                   	push   %ebp
+  8009bd:	89 e5                	mov    %esp,%ebp
+  8009bf:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8009c2:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8009c5:	50                   	push   %eax
+  8009c6:	ff 75 10             	push   0x10(%ebp)
+  8009c9:	ff 75 0c             	push   0xc(%ebp)
+  8009cc:	ff 75 08             	push   0x8(%ebp)
+  8009cf:	e8 9a ff ff ff       	call   80096e <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8009d4:	c9                   	leave
+  8009d5:	c3                   	ret
+
+008009d6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009d6:	55                   	push   %ebp
+  8009d7:	89 e5                	mov    %esp,%ebp
+  8009d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8009dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e1:	eb 03                	jmp    8009e6 <strlen+0x10>
+    n++;
+  8009e3:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8009e6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009ea:	75 f7                	jne    8009e3 <strlen+0xd>
+  return n;
+}
+  8009ec:	5d                   	pop    %ebp
+  8009ed:	c3                   	ret
+
+008009ee <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009ee:	55                   	push   %ebp
+  8009ef:	89 e5                	mov    %esp,%ebp
+  8009f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fc:	eb 03                	jmp    800a01 <strnlen+0x13>
+    n++;
+  8009fe:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a01:	39 d0                	cmp    %edx,%eax
+  800a03:	74 08                	je     800a0d <strnlen+0x1f>
+  800a05:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a09:	75 f3                	jne    8009fe <strnlen+0x10>
+  800a0b:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800a0d:	89 d0                	mov    %edx,%eax
+  800a0f:	5d                   	pop    %ebp
+  800a10:	c3                   	ret
+
+00800a11 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+  800a14:	53                   	push   %ebx
+  800a15:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a18:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a20:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a24:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a27:	83 c0 01             	add    $0x1,%eax
+  800a2a:	84 d2                	test   %dl,%dl
+  800a2c:	75 f2                	jne    800a20 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800a2e:	89 c8                	mov    %ecx,%eax
+  800a30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a33:	c9                   	leave
+  800a34:	c3                   	ret
+
+00800a35 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a35:	55                   	push   %ebp
+  800a36:	89 e5                	mov    %esp,%ebp
+  800a38:	53                   	push   %ebx
+  800a39:	83 ec 10             	sub    $0x10,%esp
+  800a3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800a3f:	53                   	push   %ebx
+  800a40:	e8 91 ff ff ff       	call   8009d6 <strlen>
+  800a45:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800a48:	ff 75 0c             	push   0xc(%ebp)
+  800a4b:	01 d8                	add    %ebx,%eax
+  800a4d:	50                   	push   %eax
+  800a4e:	e8 be ff ff ff       	call   800a11 <strcpy>
+  return dst;
+}
+  800a53:	89 d8                	mov    %ebx,%eax
+  800a55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a58:	c9                   	leave
+  800a59:	c3                   	ret
+
+00800a5a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800a5a:	55                   	push   %ebp
+  800a5b:	89 e5                	mov    %esp,%ebp
+  800a5d:	56                   	push   %esi
+  800a5e:	53                   	push   %ebx
+  800a5f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a62:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800a65:	89 f3                	mov    %esi,%ebx
+  800a67:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a6a:	89 f0                	mov    %esi,%eax
+  800a6c:	eb 0f                	jmp    800a7d <strncpy+0x23>
+    *dst++ = *src;
+  800a6e:	83 c0 01             	add    $0x1,%eax
+  800a71:	0f b6 0a             	movzbl (%edx),%ecx
+  800a74:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800a77:	80 f9 01             	cmp    $0x1,%cl
+  800a7a:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800a7d:	39 d8                	cmp    %ebx,%eax
+  800a7f:	75 ed                	jne    800a6e <strncpy+0x14>
+  }
+  return ret;
+}
+  800a81:	89 f0                	mov    %esi,%eax
+  800a83:	5b                   	pop    %ebx
+  800a84:	5e                   	pop    %esi
+  800a85:	5d                   	pop    %ebp
+  800a86:	c3                   	ret
+
+00800a87 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a87:	55                   	push   %ebp
+  800a88:	89 e5                	mov    %esp,%ebp
+  800a8a:	56                   	push   %esi
+  800a8b:	53                   	push   %ebx
+  800a8c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a92:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800a95:	89 f0                	mov    %esi,%eax
+  800a97:	85 d2                	test   %edx,%edx
+  800a99:	74 21                	je     800abc <strlcpy+0x35>
+  800a9b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a9f:	89 f2                	mov    %esi,%edx
+  800aa1:	eb 09                	jmp    800aac <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800aa3:	83 c1 01             	add    $0x1,%ecx
+  800aa6:	83 c2 01             	add    $0x1,%edx
+  800aa9:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800aac:	39 c2                	cmp    %eax,%edx
+  800aae:	74 09                	je     800ab9 <strlcpy+0x32>
+  800ab0:	0f b6 19             	movzbl (%ecx),%ebx
+  800ab3:	84 db                	test   %bl,%bl
+  800ab5:	75 ec                	jne    800aa3 <strlcpy+0x1c>
+  800ab7:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800ab9:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800abc:	29 f0                	sub    %esi,%eax
+}
+  800abe:	5b                   	pop    %ebx
+  800abf:	5e                   	pop    %esi
+  800ac0:	5d                   	pop    %ebp
+  800ac1:	c3                   	ret
+
+00800ac2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ac2:	55                   	push   %ebp
+  800ac3:	89 e5                	mov    %esp,%ebp
+  800ac5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ac8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800acb:	eb 06                	jmp    800ad3 <strcmp+0x11>
+    p++, q++;
+  800acd:	83 c1 01             	add    $0x1,%ecx
+  800ad0:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800ad3:	0f b6 01             	movzbl (%ecx),%eax
+  800ad6:	84 c0                	test   %al,%al
+  800ad8:	74 04                	je     800ade <strcmp+0x1c>
+  800ada:	3a 02                	cmp    (%edx),%al
+  800adc:	74 ef                	je     800acd <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800ade:	0f b6 c0             	movzbl %al,%eax
+  800ae1:	0f b6 12             	movzbl (%edx),%edx
+  800ae4:	29 d0                	sub    %edx,%eax
+}
+  800ae6:	5d                   	pop    %ebp
+  800ae7:	c3                   	ret
+
+00800ae8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	53                   	push   %ebx
+  800aec:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af2:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800af5:	eb 09                	jmp    800b00 <strncmp+0x18>
+    n--, p++, q++;
+  800af7:	83 ea 01             	sub    $0x1,%edx
+  800afa:	83 c0 01             	add    $0x1,%eax
+  800afd:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800b00:	85 d2                	test   %edx,%edx
+  800b02:	74 18                	je     800b1c <strncmp+0x34>
+  800b04:	0f b6 18             	movzbl (%eax),%ebx
+  800b07:	84 db                	test   %bl,%bl
+  800b09:	74 04                	je     800b0f <strncmp+0x27>
+  800b0b:	3a 19                	cmp    (%ecx),%bl
+  800b0d:	74 e8                	je     800af7 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800b0f:	0f b6 00             	movzbl (%eax),%eax
+  800b12:	0f b6 11             	movzbl (%ecx),%edx
+  800b15:	29 d0                	sub    %edx,%eax
+}
+  800b17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b1a:	c9                   	leave
+  800b1b:	c3                   	ret
+    return 0;
+  800b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b21:	eb f4                	jmp    800b17 <strncmp+0x2f>
+
+00800b23 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b23:	55                   	push   %ebp
+  800b24:	89 e5                	mov    %esp,%ebp
+  800b26:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b29:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b2d:	eb 03                	jmp    800b32 <strchr+0xf>
+  800b2f:	83 c0 01             	add    $0x1,%eax
+  800b32:	0f b6 10             	movzbl (%eax),%edx
+  800b35:	84 d2                	test   %dl,%dl
+  800b37:	74 06                	je     800b3f <strchr+0x1c>
+    if (*s == c)
+  800b39:	38 ca                	cmp    %cl,%dl
+  800b3b:	75 f2                	jne    800b2f <strchr+0xc>
+  800b3d:	eb 05                	jmp    800b44 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b44:	5d                   	pop    %ebp
+  800b45:	c3                   	ret
+
+00800b46 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b46:	55                   	push   %ebp
+  800b47:	89 e5                	mov    %esp,%ebp
+  800b49:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b4c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b50:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800b53:	38 ca                	cmp    %cl,%dl
+  800b55:	74 09                	je     800b60 <strfind+0x1a>
+  800b57:	84 d2                	test   %dl,%dl
+  800b59:	74 05                	je     800b60 <strfind+0x1a>
+  for (; *s; s++)
+  800b5b:	83 c0 01             	add    $0x1,%eax
+  800b5e:	eb f0                	jmp    800b50 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800b60:	5d                   	pop    %ebp
+  800b61:	c3                   	ret
+
+00800b62 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b62:	55                   	push   %ebp
+  800b63:	89 e5                	mov    %esp,%ebp
+  800b65:	57                   	push   %edi
+  800b66:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b69:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800b6c:	85 c9                	test   %ecx,%ecx
+  800b6e:	74 20                	je     800b90 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800b70:	89 f8                	mov    %edi,%eax
+  800b72:	09 c8                	or     %ecx,%eax
+  800b74:	a8 03                	test   $0x3,%al
+  800b76:	75 12                	jne    800b8a <memset+0x28>
+    c &= 0xFF;
+  800b78:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b7c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800b82:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800b85:	fc                   	cld
+  800b86:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b88:	eb 06                	jmp    800b90 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800b8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b8d:	fc                   	cld
+  800b8e:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800b90:	89 f8                	mov    %edi,%eax
+  800b92:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b95:	c9                   	leave
+  800b96:	c3                   	ret
+
+00800b97 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b97:	55                   	push   %ebp
+  800b98:	89 e5                	mov    %esp,%ebp
+  800b9a:	57                   	push   %edi
+  800b9b:	56                   	push   %esi
+  800b9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ba2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800ba5:	39 c6                	cmp    %eax,%esi
+  800ba7:	73 32                	jae    800bdb <memmove+0x44>
+  800ba9:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bac:	39 d0                	cmp    %edx,%eax
+  800bae:	73 2b                	jae    800bdb <memmove+0x44>
+    s += n;
+    d += n;
+  800bb0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bb3:	89 d6                	mov    %edx,%esi
+  800bb5:	09 fe                	or     %edi,%esi
+  800bb7:	09 ce                	or     %ecx,%esi
+  800bb9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bbf:	75 0e                	jne    800bcf <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bc1:	83 ef 04             	sub    $0x4,%edi
+  800bc4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bc7:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800bca:	fd                   	std
+  800bcb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bcd:	eb 09                	jmp    800bd8 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bcf:	83 ef 01             	sub    $0x1,%edi
+  800bd2:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800bd5:	fd                   	std
+  800bd6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800bd8:	fc                   	cld
+  800bd9:	eb 1a                	jmp    800bf5 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bdb:	89 f2                	mov    %esi,%edx
+  800bdd:	09 c2                	or     %eax,%edx
+  800bdf:	09 ca                	or     %ecx,%edx
+  800be1:	f6 c2 03             	test   $0x3,%dl
+  800be4:	75 0a                	jne    800bf0 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800be6:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800be9:	89 c7                	mov    %eax,%edi
+  800beb:	fc                   	cld
+  800bec:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bee:	eb 05                	jmp    800bf5 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800bf0:	89 c7                	mov    %eax,%edi
+  800bf2:	fc                   	cld
+  800bf3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800bf5:	5e                   	pop    %esi
+  800bf6:	5f                   	pop    %edi
+  800bf7:	5d                   	pop    %ebp
+  800bf8:	c3                   	ret
+
+00800bf9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bf9:	55                   	push   %ebp
+  800bfa:	89 e5                	mov    %esp,%ebp
+  800bfc:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800bff:	ff 75 10             	push   0x10(%ebp)
+  800c02:	ff 75 0c             	push   0xc(%ebp)
+  800c05:	ff 75 08             	push   0x8(%ebp)
+  800c08:	e8 8a ff ff ff       	call   800b97 <memmove>
+}
+  800c0d:	c9                   	leave
+  800c0e:	c3                   	ret
+
+00800c0f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c0f:	55                   	push   %ebp
+  800c10:	89 e5                	mov    %esp,%ebp
+  800c12:	56                   	push   %esi
+  800c13:	53                   	push   %ebx
+  800c14:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c17:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800c1a:	89 c6                	mov    %eax,%esi
+  800c1c:	03 75 10             	add    0x10(%ebp),%esi
+  800c1f:	eb 06                	jmp    800c27 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800c21:	83 c0 01             	add    $0x1,%eax
+  800c24:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800c27:	39 f0                	cmp    %esi,%eax
+  800c29:	74 14                	je     800c3f <memcmp+0x30>
+    if (*s1 != *s2)
+  800c2b:	0f b6 08             	movzbl (%eax),%ecx
+  800c2e:	0f b6 1a             	movzbl (%edx),%ebx
+  800c31:	38 d9                	cmp    %bl,%cl
+  800c33:	74 ec                	je     800c21 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800c35:	0f b6 c1             	movzbl %cl,%eax
+  800c38:	0f b6 db             	movzbl %bl,%ebx
+  800c3b:	29 d8                	sub    %ebx,%eax
+  800c3d:	eb 05                	jmp    800c44 <memcmp+0x35>
+  }
+
+  return 0;
+  800c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c44:	5b                   	pop    %ebx
+  800c45:	5e                   	pop    %esi
+  800c46:	5d                   	pop    %ebp
+  800c47:	c3                   	ret
+
+00800c48 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c48:	55                   	push   %ebp
+  800c49:	89 e5                	mov    %esp,%ebp
+  800c4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800c51:	89 c2                	mov    %eax,%edx
+  800c53:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800c56:	eb 03                	jmp    800c5b <memfind+0x13>
+  800c58:	83 c0 01             	add    $0x1,%eax
+  800c5b:	39 d0                	cmp    %edx,%eax
+  800c5d:	73 04                	jae    800c63 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800c5f:	38 08                	cmp    %cl,(%eax)
+  800c61:	75 f5                	jne    800c58 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800c63:	5d                   	pop    %ebp
+  800c64:	c3                   	ret
+
+00800c65 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c65:	55                   	push   %ebp
+  800c66:	89 e5                	mov    %esp,%ebp
+  800c68:	57                   	push   %edi
+  800c69:	56                   	push   %esi
+  800c6a:	53                   	push   %ebx
+  800c6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800c71:	eb 03                	jmp    800c76 <strtol+0x11>
+    s++;
+  800c73:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800c76:	0f b6 02             	movzbl (%edx),%eax
+  800c79:	3c 20                	cmp    $0x20,%al
+  800c7b:	74 f6                	je     800c73 <strtol+0xe>
+  800c7d:	3c 09                	cmp    $0x9,%al
+  800c7f:	74 f2                	je     800c73 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800c81:	3c 2b                	cmp    $0x2b,%al
+  800c83:	74 2a                	je     800caf <strtol+0x4a>
+  int neg = 0;
+  800c85:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800c8a:	3c 2d                	cmp    $0x2d,%al
+  800c8c:	74 2b                	je     800cb9 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c8e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c94:	75 0f                	jne    800ca5 <strtol+0x40>
+  800c96:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c99:	74 28                	je     800cc3 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800c9b:	85 db                	test   %ebx,%ebx
+  800c9d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ca2:	0f 44 d8             	cmove  %eax,%ebx
+  800ca5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800caa:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cad:	eb 46                	jmp    800cf5 <strtol+0x90>
+    s++;
+  800caf:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800cb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cb7:	eb d5                	jmp    800c8e <strtol+0x29>
+    s++, neg = 1;
+  800cb9:	83 c2 01             	add    $0x1,%edx
+  800cbc:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cc1:	eb cb                	jmp    800c8e <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cc3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cc7:	74 0e                	je     800cd7 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800cc9:	85 db                	test   %ebx,%ebx
+  800ccb:	75 d8                	jne    800ca5 <strtol+0x40>
+    s++, base = 8;
+  800ccd:	83 c2 01             	add    $0x1,%edx
+  800cd0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cd5:	eb ce                	jmp    800ca5 <strtol+0x40>
+    s += 2, base = 16;
+  800cd7:	83 c2 02             	add    $0x2,%edx
+  800cda:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cdf:	eb c4                	jmp    800ca5 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800ce1:	0f be c0             	movsbl %al,%eax
+  800ce4:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800ce7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cea:	7d 3a                	jge    800d26 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800cec:	83 c2 01             	add    $0x1,%edx
+  800cef:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cf3:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800cf5:	0f b6 02             	movzbl (%edx),%eax
+  800cf8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cfb:	89 f3                	mov    %esi,%ebx
+  800cfd:	80 fb 09             	cmp    $0x9,%bl
+  800d00:	76 df                	jbe    800ce1 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800d02:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d05:	89 f3                	mov    %esi,%ebx
+  800d07:	80 fb 19             	cmp    $0x19,%bl
+  800d0a:	77 08                	ja     800d14 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800d0c:	0f be c0             	movsbl %al,%eax
+  800d0f:	83 e8 57             	sub    $0x57,%eax
+  800d12:	eb d3                	jmp    800ce7 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800d14:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d17:	89 f3                	mov    %esi,%ebx
+  800d19:	80 fb 19             	cmp    $0x19,%bl
+  800d1c:	77 08                	ja     800d26 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800d1e:	0f be c0             	movsbl %al,%eax
+  800d21:	83 e8 37             	sub    $0x37,%eax
+  800d24:	eb c1                	jmp    800ce7 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800d26:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d2a:	74 05                	je     800d31 <strtol+0xcc>
+    *endptr = (char*)s;
+  800d2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d2f:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800d31:	89 c8                	mov    %ecx,%eax
+  800d33:	f7 d8                	neg    %eax
+  800d35:	85 ff                	test   %edi,%edi
+  800d37:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d3a:	89 c8                	mov    %ecx,%eax
+  800d3c:	5b                   	pop    %ebx
+  800d3d:	5e                   	pop    %esi
+  800d3e:	5f                   	pop    %edi
+  800d3f:	5d                   	pop    %ebp
+  800d40:	c3                   	ret
+
+00800d41 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d41:	55                   	push   %ebp
+  800d42:	89 e5                	mov    %esp,%ebp
+  800d44:	57                   	push   %edi
+  800d45:	56                   	push   %esi
+  800d46:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d52:	89 c3                	mov    %eax,%ebx
+  800d54:	89 c7                	mov    %eax,%edi
+  800d56:	89 c6                	mov    %eax,%esi
+  800d58:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d5a:	5b                   	pop    %ebx
+  800d5b:	5e                   	pop    %esi
+  800d5c:	5f                   	pop    %edi
+  800d5d:	5d                   	pop    %ebp
+  800d5e:	c3                   	ret
+
+00800d5f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d5f:	55                   	push   %ebp
+  800d60:	89 e5                	mov    %esp,%ebp
+  800d62:	57                   	push   %edi
+  800d63:	56                   	push   %esi
+  800d64:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d65:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d6a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d6f:	89 d1                	mov    %edx,%ecx
+  800d71:	89 d3                	mov    %edx,%ebx
+  800d73:	89 d7                	mov    %edx,%edi
+  800d75:	89 d6                	mov    %edx,%esi
+  800d77:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d79:	5b                   	pop    %ebx
+  800d7a:	5e                   	pop    %esi
+  800d7b:	5f                   	pop    %edi
+  800d7c:	5d                   	pop    %ebp
+  800d7d:	c3                   	ret
+
+00800d7e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d7e:	55                   	push   %ebp
+  800d7f:	89 e5                	mov    %esp,%ebp
+  800d81:	57                   	push   %edi
+  800d82:	56                   	push   %esi
+  800d83:	53                   	push   %ebx
+  800d84:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d94:	89 cb                	mov    %ecx,%ebx
+  800d96:	89 cf                	mov    %ecx,%edi
+  800d98:	89 ce                	mov    %ecx,%esi
+  800d9a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d9c:	85 c0                	test   %eax,%eax
+  800d9e:	7f 08                	jg     800da8 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800da0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800da3:	5b                   	pop    %ebx
+  800da4:	5e                   	pop    %esi
+  800da5:	5f                   	pop    %edi
+  800da6:	5d                   	pop    %ebp
+  800da7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800da8:	83 ec 0c             	sub    $0xc,%esp
+  800dab:	50                   	push   %eax
+  800dac:	6a 03                	push   $0x3
+  800dae:	68 03 35 80 00       	push   $0x803503
+  800db3:	6a 23                	push   $0x23
+  800db5:	68 20 35 80 00       	push   $0x803520
+  800dba:	e8 89 f5 ff ff       	call   800348 <_panic>
+
+00800dbf <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	57                   	push   %edi
+  800dc3:	56                   	push   %esi
+  800dc4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dca:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dcf:	89 d1                	mov    %edx,%ecx
+  800dd1:	89 d3                	mov    %edx,%ebx
+  800dd3:	89 d7                	mov    %edx,%edi
+  800dd5:	89 d6                	mov    %edx,%esi
+  800dd7:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dd9:	5b                   	pop    %ebx
+  800dda:	5e                   	pop    %esi
+  800ddb:	5f                   	pop    %edi
+  800ddc:	5d                   	pop    %ebp
+  800ddd:	c3                   	ret
+
+00800dde <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dde:	55                   	push   %ebp
+  800ddf:	89 e5                	mov    %esp,%ebp
+  800de1:	57                   	push   %edi
+  800de2:	56                   	push   %esi
+  800de3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800de4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dee:	89 d1                	mov    %edx,%ecx
+  800df0:	89 d3                	mov    %edx,%ebx
+  800df2:	89 d7                	mov    %edx,%edi
+  800df4:	89 d6                	mov    %edx,%esi
+  800df6:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800df8:	5b                   	pop    %ebx
+  800df9:	5e                   	pop    %esi
+  800dfa:	5f                   	pop    %edi
+  800dfb:	5d                   	pop    %ebp
+  800dfc:	c3                   	ret
+
+00800dfd <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800dfd:	55                   	push   %ebp
+  800dfe:	89 e5                	mov    %esp,%ebp
+  800e00:	57                   	push   %edi
+  800e01:	56                   	push   %esi
+  800e02:	53                   	push   %ebx
+  800e03:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800e06:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800e0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e12:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e17:	89 df                	mov    %ebx,%edi
+  800e19:	89 de                	mov    %ebx,%esi
+  800e1b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e1d:	85 c0                	test   %eax,%eax
+  800e1f:	7f 08                	jg     800e29 <sys_env_set_cow+0x2c>
+}
+  800e21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e24:	5b                   	pop    %ebx
+  800e25:	5e                   	pop    %esi
+  800e26:	5f                   	pop    %edi
+  800e27:	5d                   	pop    %ebp
+  800e28:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e29:	83 ec 0c             	sub    $0xc,%esp
+  800e2c:	50                   	push   %eax
+  800e2d:	6a 14                	push   $0x14
+  800e2f:	68 03 35 80 00       	push   $0x803503
+  800e34:	6a 23                	push   $0x23
+  800e36:	68 20 35 80 00       	push   $0x803520
+  800e3b:	e8 08 f5 ff ff       	call   800348 <_panic>
+
+00800e40 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e40:	55                   	push   %ebp
+  800e41:	89 e5                	mov    %esp,%ebp
+  800e43:	57                   	push   %edi
+  800e44:	56                   	push   %esi
+  800e45:	53                   	push   %ebx
+  800e46:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e49:	be 00 00 00 00       	mov    $0x0,%esi
+  800e4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e54:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5c:	89 f7                	mov    %esi,%edi
+  800e5e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e60:	85 c0                	test   %eax,%eax
+  800e62:	7f 08                	jg     800e6c <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800e64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e67:	5b                   	pop    %ebx
+  800e68:	5e                   	pop    %esi
+  800e69:	5f                   	pop    %edi
+  800e6a:	5d                   	pop    %ebp
+  800e6b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e6c:	83 ec 0c             	sub    $0xc,%esp
+  800e6f:	50                   	push   %eax
+  800e70:	6a 04                	push   $0x4
+  800e72:	68 03 35 80 00       	push   $0x803503
+  800e77:	6a 23                	push   $0x23
+  800e79:	68 20 35 80 00       	push   $0x803520
+  800e7e:	e8 c5 f4 ff ff       	call   800348 <_panic>
+
+00800e83 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e83:	55                   	push   %ebp
+  800e84:	89 e5                	mov    %esp,%ebp
+  800e86:	57                   	push   %edi
+  800e87:	56                   	push   %esi
+  800e88:	53                   	push   %ebx
+  800e89:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e92:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e9d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ea0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ea2:	85 c0                	test   %eax,%eax
+  800ea4:	7f 08                	jg     800eae <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800ea6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea9:	5b                   	pop    %ebx
+  800eaa:	5e                   	pop    %esi
+  800eab:	5f                   	pop    %edi
+  800eac:	5d                   	pop    %ebp
+  800ead:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800eae:	83 ec 0c             	sub    $0xc,%esp
+  800eb1:	50                   	push   %eax
+  800eb2:	6a 05                	push   $0x5
+  800eb4:	68 03 35 80 00       	push   $0x803503
+  800eb9:	6a 23                	push   $0x23
+  800ebb:	68 20 35 80 00       	push   $0x803520
+  800ec0:	e8 83 f4 ff ff       	call   800348 <_panic>
+
+00800ec5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	57                   	push   %edi
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+  800ecb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ece:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ede:	89 df                	mov    %ebx,%edi
+  800ee0:	89 de                	mov    %ebx,%esi
+  800ee2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ee4:	85 c0                	test   %eax,%eax
+  800ee6:	7f 08                	jg     800ef0 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800ee8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eeb:	5b                   	pop    %ebx
+  800eec:	5e                   	pop    %esi
+  800eed:	5f                   	pop    %edi
+  800eee:	5d                   	pop    %ebp
+  800eef:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ef0:	83 ec 0c             	sub    $0xc,%esp
+  800ef3:	50                   	push   %eax
+  800ef4:	6a 06                	push   $0x6
+  800ef6:	68 03 35 80 00       	push   $0x803503
+  800efb:	6a 23                	push   $0x23
+  800efd:	68 20 35 80 00       	push   $0x803520
+  800f02:	e8 41 f4 ff ff       	call   800348 <_panic>
+
+00800f07 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800f07:	55                   	push   %ebp
+  800f08:	89 e5                	mov    %esp,%ebp
+  800f0a:	57                   	push   %edi
+  800f0b:	56                   	push   %esi
+  800f0c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f13:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f1b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f1e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f21:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800f23:	5b                   	pop    %ebx
+  800f24:	5e                   	pop    %esi
+  800f25:	5f                   	pop    %edi
+  800f26:	5d                   	pop    %ebp
+  800f27:	c3                   	ret
+
+00800f28 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800f28:	55                   	push   %ebp
+  800f29:	89 e5                	mov    %esp,%ebp
+  800f2b:	57                   	push   %edi
+  800f2c:	56                   	push   %esi
+  800f2d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f34:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f39:	be 00 00 00 00       	mov    $0x0,%esi
+  800f3e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f41:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f44:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800f46:	5b                   	pop    %ebx
+  800f47:	5e                   	pop    %esi
+  800f48:	5f                   	pop    %edi
+  800f49:	5d                   	pop    %ebp
+  800f4a:	c3                   	ret
+
+00800f4b <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800f4b:	55                   	push   %ebp
+  800f4c:	89 e5                	mov    %esp,%ebp
+  800f4e:	57                   	push   %edi
+  800f4f:	56                   	push   %esi
+  800f50:	53                   	push   %ebx
+  800f51:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5f:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f64:	89 df                	mov    %ebx,%edi
+  800f66:	89 de                	mov    %ebx,%esi
+  800f68:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f6a:	85 c0                	test   %eax,%eax
+  800f6c:	7f 08                	jg     800f76 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800f6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f71:	5b                   	pop    %ebx
+  800f72:	5e                   	pop    %esi
+  800f73:	5f                   	pop    %edi
+  800f74:	5d                   	pop    %ebp
+  800f75:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f76:	83 ec 0c             	sub    $0xc,%esp
+  800f79:	50                   	push   %eax
+  800f7a:	6a 16                	push   $0x16
+  800f7c:	68 03 35 80 00       	push   $0x803503
+  800f81:	6a 23                	push   $0x23
+  800f83:	68 20 35 80 00       	push   $0x803520
+  800f88:	e8 bb f3 ff ff       	call   800348 <_panic>
+
+00800f8d <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800f8d:	55                   	push   %ebp
+  800f8e:	89 e5                	mov    %esp,%ebp
+  800f90:	57                   	push   %edi
+  800f91:	56                   	push   %esi
+  800f92:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9b:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fa0:	89 cb                	mov    %ecx,%ebx
+  800fa2:	89 cf                	mov    %ecx,%edi
+  800fa4:	89 ce                	mov    %ecx,%esi
+  800fa6:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800fa8:	5b                   	pop    %ebx
+  800fa9:	5e                   	pop    %esi
+  800faa:	5f                   	pop    %edi
+  800fab:	5d                   	pop    %ebp
+  800fac:	c3                   	ret
+
+00800fad <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800fad:	55                   	push   %ebp
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	57                   	push   %edi
+  800fb1:	56                   	push   %esi
+  800fb2:	53                   	push   %ebx
+  800fb3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fb6:	be 00 00 00 00       	mov    $0x0,%esi
+  800fbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc1:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fc6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc9:	89 f7                	mov    %esi,%edi
+  800fcb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fcd:	85 c0                	test   %eax,%eax
+  800fcf:	7f 08                	jg     800fd9 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800fd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd4:	5b                   	pop    %ebx
+  800fd5:	5e                   	pop    %esi
+  800fd6:	5f                   	pop    %edi
+  800fd7:	5d                   	pop    %ebp
+  800fd8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fd9:	83 ec 0c             	sub    $0xc,%esp
+  800fdc:	50                   	push   %eax
+  800fdd:	6a 18                	push   $0x18
+  800fdf:	68 03 35 80 00       	push   $0x803503
+  800fe4:	6a 23                	push   $0x23
+  800fe6:	68 20 35 80 00       	push   $0x803520
+  800feb:	e8 58 f3 ff ff       	call   800348 <_panic>
+
+00800ff0 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800ff0:	55                   	push   %ebp
+  800ff1:	89 e5                	mov    %esp,%ebp
+  800ff3:	57                   	push   %edi
+  800ff4:	56                   	push   %esi
+  800ff5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ff6:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801001:	b8 19 00 00 00       	mov    $0x19,%eax
+  801006:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801009:	89 f7                	mov    %esi,%edi
+  80100b:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  80100d:	5b                   	pop    %ebx
+  80100e:	5e                   	pop    %esi
+  80100f:	5f                   	pop    %edi
+  801010:	5d                   	pop    %ebp
+  801011:	c3                   	ret
+
+00801012 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801012:	55                   	push   %ebp
+  801013:	89 e5                	mov    %esp,%ebp
+  801015:	57                   	push   %edi
+  801016:	56                   	push   %esi
+  801017:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801018:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801022:	89 d1                	mov    %edx,%ecx
+  801024:	89 d3                	mov    %edx,%ebx
+  801026:	89 d7                	mov    %edx,%edi
+  801028:	89 d6                	mov    %edx,%esi
+  80102a:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80102c:	5b                   	pop    %ebx
+  80102d:	5e                   	pop    %esi
+  80102e:	5f                   	pop    %edi
+  80102f:	5d                   	pop    %ebp
+  801030:	c3                   	ret
+
+00801031 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	57                   	push   %edi
+  801035:	56                   	push   %esi
+  801036:	53                   	push   %ebx
+  801037:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80103a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801042:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801045:	b8 08 00 00 00       	mov    $0x8,%eax
+  80104a:	89 df                	mov    %ebx,%edi
+  80104c:	89 de                	mov    %ebx,%esi
+  80104e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801050:	85 c0                	test   %eax,%eax
+  801052:	7f 08                	jg     80105c <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801054:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801057:	5b                   	pop    %ebx
+  801058:	5e                   	pop    %esi
+  801059:	5f                   	pop    %edi
+  80105a:	5d                   	pop    %ebp
+  80105b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80105c:	83 ec 0c             	sub    $0xc,%esp
+  80105f:	50                   	push   %eax
+  801060:	6a 08                	push   $0x8
+  801062:	68 03 35 80 00       	push   $0x803503
+  801067:	6a 23                	push   $0x23
+  801069:	68 20 35 80 00       	push   $0x803520
+  80106e:	e8 d5 f2 ff ff       	call   800348 <_panic>
+
+00801073 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801073:	55                   	push   %ebp
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	57                   	push   %edi
+  801077:	56                   	push   %esi
+  801078:	53                   	push   %ebx
+  801079:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80107c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801081:	8b 55 08             	mov    0x8(%ebp),%edx
+  801084:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801087:	b8 09 00 00 00       	mov    $0x9,%eax
+  80108c:	89 df                	mov    %ebx,%edi
+  80108e:	89 de                	mov    %ebx,%esi
+  801090:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801092:	85 c0                	test   %eax,%eax
+  801094:	7f 08                	jg     80109e <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801096:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801099:	5b                   	pop    %ebx
+  80109a:	5e                   	pop    %esi
+  80109b:	5f                   	pop    %edi
+  80109c:	5d                   	pop    %ebp
+  80109d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80109e:	83 ec 0c             	sub    $0xc,%esp
+  8010a1:	50                   	push   %eax
+  8010a2:	6a 09                	push   $0x9
+  8010a4:	68 03 35 80 00       	push   $0x803503
+  8010a9:	6a 23                	push   $0x23
+  8010ab:	68 20 35 80 00       	push   $0x803520
+  8010b0:	e8 93 f2 ff ff       	call   800348 <_panic>
+
+008010b5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	57                   	push   %edi
+  8010b9:	56                   	push   %esi
+  8010ba:	53                   	push   %ebx
+  8010bb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ce:	89 df                	mov    %ebx,%edi
+  8010d0:	89 de                	mov    %ebx,%esi
+  8010d2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010d4:	85 c0                	test   %eax,%eax
+  8010d6:	7f 08                	jg     8010e0 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  8010d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010db:	5b                   	pop    %ebx
+  8010dc:	5e                   	pop    %esi
+  8010dd:	5f                   	pop    %edi
+  8010de:	5d                   	pop    %ebp
+  8010df:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010e0:	83 ec 0c             	sub    $0xc,%esp
+  8010e3:	50                   	push   %eax
+  8010e4:	6a 0a                	push   $0xa
+  8010e6:	68 03 35 80 00       	push   $0x803503
+  8010eb:	6a 23                	push   $0x23
+  8010ed:	68 20 35 80 00       	push   $0x803520
+  8010f2:	e8 51 f2 ff ff       	call   800348 <_panic>
+
+008010f7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8010f7:	55                   	push   %ebp
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	57                   	push   %edi
+  8010fb:	56                   	push   %esi
+  8010fc:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801100:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801103:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801108:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80110b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80110e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801111:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801113:	5b                   	pop    %ebx
+  801114:	5e                   	pop    %esi
+  801115:	5f                   	pop    %edi
+  801116:	5d                   	pop    %ebp
+  801117:	c3                   	ret
+
+00801118 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  801118:	55                   	push   %ebp
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	57                   	push   %edi
+  80111c:	56                   	push   %esi
+  80111d:	53                   	push   %ebx
+  80111e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801121:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801126:	8b 55 08             	mov    0x8(%ebp),%edx
+  801129:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801131:	89 df                	mov    %ebx,%edi
+  801133:	89 de                	mov    %ebx,%esi
+  801135:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801137:	85 c0                	test   %eax,%eax
+  801139:	7f 08                	jg     801143 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80113b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113e:	5b                   	pop    %ebx
+  80113f:	5e                   	pop    %esi
+  801140:	5f                   	pop    %edi
+  801141:	5d                   	pop    %ebp
+  801142:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801143:	83 ec 0c             	sub    $0xc,%esp
+  801146:	50                   	push   %eax
+  801147:	6a 0d                	push   $0xd
+  801149:	68 03 35 80 00       	push   $0x803503
+  80114e:	6a 23                	push   $0x23
+  801150:	68 20 35 80 00       	push   $0x803520
+  801155:	e8 ee f1 ff ff       	call   800348 <_panic>
+
+0080115a <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  80115a:	55                   	push   %ebp
+  80115b:	89 e5                	mov    %esp,%ebp
+  80115d:	57                   	push   %edi
+  80115e:	56                   	push   %esi
+  80115f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801160:	ba 00 00 00 00       	mov    $0x0,%edx
+  801165:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80116a:	89 d1                	mov    %edx,%ecx
+  80116c:	89 d3                	mov    %edx,%ebx
+  80116e:	89 d7                	mov    %edx,%edi
+  801170:	89 d6                	mov    %edx,%esi
+  801172:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801174:	5b                   	pop    %ebx
+  801175:	5e                   	pop    %esi
+  801176:	5f                   	pop    %edi
+  801177:	5d                   	pop    %ebp
+  801178:	c3                   	ret
+
+00801179 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801179:	55                   	push   %ebp
+  80117a:	89 e5                	mov    %esp,%ebp
+  80117c:	57                   	push   %edi
+  80117d:	56                   	push   %esi
+  80117e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80117f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801182:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801185:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80118a:	be 00 00 00 00       	mov    $0x0,%esi
+  80118f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801192:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801195:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801197:	5b                   	pop    %ebx
+  801198:	5e                   	pop    %esi
+  801199:	5f                   	pop    %edi
+  80119a:	5d                   	pop    %ebp
+  80119b:	c3                   	ret
+
+0080119c <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80119c:	55                   	push   %ebp
+  80119d:	89 e5                	mov    %esp,%ebp
+  80119f:	57                   	push   %edi
+  8011a0:	56                   	push   %esi
+  8011a1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ad:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b5:	89 f7                	mov    %esi,%edi
+  8011b7:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8011b9:	5b                   	pop    %ebx
+  8011ba:	5e                   	pop    %esi
+  8011bb:	5f                   	pop    %edi
+  8011bc:	5d                   	pop    %ebp
+  8011bd:	c3                   	ret
+
+008011be <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8011be:	55                   	push   %ebp
+  8011bf:	89 e5                	mov    %esp,%ebp
+  8011c1:	57                   	push   %edi
+  8011c2:	56                   	push   %esi
+  8011c3:	53                   	push   %ebx
+  8011c4:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8011c7:	80 3d 48 67 80 00 00 	cmpb   $0x0,0x806748
+  8011ce:	74 41                	je     801211 <sys_batch+0x53>
+  8011d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8011d6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8011dd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8011e0:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8011e3:	7d 45                	jge    80122a <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8011e5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011e8:	8b 06                	mov    (%esi),%eax
+  8011ea:	8b 56 04             	mov    0x4(%esi),%edx
+  8011ed:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8011f0:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8011f3:	8b 7e 10             	mov    0x10(%esi),%edi
+  8011f6:	8b 76 14             	mov    0x14(%esi),%esi
+  8011f9:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8011fb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011fe:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801201:	83 c6 1c             	add    $0x1c,%esi
+  801204:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801207:	85 c0                	test   %eax,%eax
+  801209:	78 1f                	js     80122a <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80120b:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  80120f:	eb cc                	jmp    8011dd <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801211:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801216:	b8 13 00 00 00       	mov    $0x13,%eax
+  80121b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801221:	89 df                	mov    %ebx,%edi
+  801223:	89 de                	mov    %ebx,%esi
+  801225:	cd 30                	int    $0x30
+  801227:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80122a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80122d:	83 c4 08             	add    $0x8,%esp
+  801230:	5b                   	pop    %ebx
+  801231:	5e                   	pop    %esi
+  801232:	5f                   	pop    %edi
+  801233:	5d                   	pop    %ebp
+  801234:	c3                   	ret
+
+00801235 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801235:	55                   	push   %ebp
+  801236:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801238:	8b 45 08             	mov    0x8(%ebp),%eax
+  80123b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801241:	5d                   	pop    %ebp
+  801242:	c3                   	ret
+
+00801243 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801243:	55                   	push   %ebp
+  801244:	89 e5                	mov    %esp,%ebp
+  801246:	56                   	push   %esi
+  801247:	53                   	push   %ebx
+  801248:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80124b:	8b 1e                	mov    (%esi),%ebx
+  80124d:	85 db                	test   %ebx,%ebx
+  80124f:	75 09                	jne    80125a <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801251:	89 d8                	mov    %ebx,%eax
+  801253:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801256:	5b                   	pop    %ebx
+  801257:	5e                   	pop    %esi
+  801258:	5d                   	pop    %ebp
+  801259:	c3                   	ret
+  b->sb_n = 0;
+  80125a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801260:	53                   	push   %ebx
+  801261:	8d 46 04             	lea    0x4(%esi),%eax
+  801264:	50                   	push   %eax
+  801265:	e8 54 ff ff ff       	call   8011be <sys_batch>
+  80126a:	83 c4 08             	add    $0x8,%esp
+  80126d:	85 c0                	test   %eax,%eax
+  80126f:	78 1e                	js     80128f <sysbatch_flush+0x4c>
+  if (r < n)
+  801271:	39 c3                	cmp    %eax,%ebx
+  801273:	7f 07                	jg     80127c <sysbatch_flush+0x39>
+  return 0;
+  801275:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127a:	eb d5                	jmp    801251 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80127c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80127f:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801283:	85 db                	test   %ebx,%ebx
+  801285:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80128a:	0f 49 d8             	cmovns %eax,%ebx
+  80128d:	eb c2                	jmp    801251 <sysbatch_flush+0xe>
+    return r;
+  80128f:	89 c3                	mov    %eax,%ebx
+  801291:	eb be                	jmp    801251 <sysbatch_flush+0xe>
+
+00801293 <sysbatch_add>:
+{
+  801293:	55                   	push   %ebp
+  801294:	89 e5                	mov    %esp,%ebp
+  801296:	53                   	push   %ebx
+  801297:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80129a:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80129d:	74 41                	je     8012e0 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80129f:	8b 03                	mov    (%ebx),%eax
+  8012a1:	8d 50 01             	lea    0x1(%eax),%edx
+  8012a4:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  8012a6:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8012a9:	01 d8                	add    %ebx,%eax
+  8012ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012ae:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8012b1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8012b4:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8012b7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8012ba:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8012bd:	8b 55 18             	mov    0x18(%ebp),%edx
+  8012c0:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8012c3:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8012c6:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8012c9:	8b 55 20             	mov    0x20(%ebp),%edx
+  8012cc:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8012cf:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8012d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012de:	c9                   	leave
+  8012df:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8012e0:	53                   	push   %ebx
+  8012e1:	e8 5d ff ff ff       	call   801243 <sysbatch_flush>
+  8012e6:	83 c4 04             	add    $0x4,%esp
+  8012e9:	85 c0                	test   %eax,%eax
+  8012eb:	79 b2                	jns    80129f <sysbatch_add+0xc>
+  8012ed:	eb ec                	jmp    8012db <sysbatch_add+0x48>
+
+008012ef <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8012f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012f5:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012fa:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012fd:	5d                   	pop    %ebp
+  8012fe:	c3                   	ret
+
+008012ff <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012ff:	55                   	push   %ebp
+  801300:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801302:	8b 45 08             	mov    0x8(%ebp),%eax
+  801305:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801308:	66 b8 00 00          	mov    $0x0,%ax
+  80130c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801311:	5d                   	pop    %ebp
+  801312:	c3                   	ret
+
+00801313 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801313:	55                   	push   %ebp
+  801314:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801316:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80131b:	eb 02                	jmp    80131f <fd_alloc+0xc>
+  80131d:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80131f:	89 c2                	mov    %eax,%edx
+  801321:	c1 ea 16             	shr    $0x16,%edx
+  801324:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80132b:	f6 c2 01             	test   $0x1,%dl
+  80132e:	74 2b                	je     80135b <fd_alloc+0x48>
+  801330:	89 c2                	mov    %eax,%edx
+  801332:	c1 ea 0c             	shr    $0xc,%edx
+  801335:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80133c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801342:	f6 c1 01             	test   $0x1,%cl
+  801345:	74 14                	je     80135b <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801347:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80134d:	75 ce                	jne    80131d <fd_alloc+0xa>
+  80134f:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801354:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801359:	eb 05                	jmp    801360 <fd_alloc+0x4d>
+      return 0;
+  80135b:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801360:	8b 55 08             	mov    0x8(%ebp),%edx
+  801363:	89 02                	mov    %eax,(%edx)
+}
+  801365:	89 c8                	mov    %ecx,%eax
+  801367:	5d                   	pop    %ebp
+  801368:	c3                   	ret
+
+00801369 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801369:	55                   	push   %ebp
+  80136a:	89 e5                	mov    %esp,%ebp
+  80136c:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80136f:	83 f8 1f             	cmp    $0x1f,%eax
+  801372:	77 30                	ja     8013a4 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801374:	c1 e0 0c             	shl    $0xc,%eax
+  801377:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80137c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801382:	f6 c2 01             	test   $0x1,%dl
+  801385:	74 24                	je     8013ab <fd_lookup+0x42>
+  801387:	89 c2                	mov    %eax,%edx
+  801389:	c1 ea 0c             	shr    $0xc,%edx
+  80138c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801393:	f6 c2 01             	test   $0x1,%dl
+  801396:	74 1a                	je     8013b2 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801398:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80139b:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80139d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013a2:	5d                   	pop    %ebp
+  8013a3:	c3                   	ret
+    return -E_INVAL;
+  8013a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013a9:	eb f7                	jmp    8013a2 <fd_lookup+0x39>
+    return -E_INVAL;
+  8013ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013b0:	eb f0                	jmp    8013a2 <fd_lookup+0x39>
+  8013b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013b7:	eb e9                	jmp    8013a2 <fd_lookup+0x39>
+
+008013b9 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013b9:	55                   	push   %ebp
+  8013ba:	89 e5                	mov    %esp,%ebp
+  8013bc:	53                   	push   %ebx
+  8013bd:	83 ec 04             	sub    $0x4,%esp
+  8013c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8013c3:	b8 ac 35 80 00       	mov    $0x8035ac,%eax
+  8013c8:	8b 18                	mov    (%eax),%ebx
+  8013ca:	85 db                	test   %ebx,%ebx
+  8013cc:	74 0e                	je     8013dc <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8013ce:	83 c0 04             	add    $0x4,%eax
+  8013d1:	39 13                	cmp    %edx,(%ebx)
+  8013d3:	75 f3                	jne    8013c8 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8013d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013da:	eb 1f                	jmp    8013fb <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013dc:	a1 44 67 80 00       	mov    0x806744,%eax
+  8013e1:	8b 40 48             	mov    0x48(%eax),%eax
+  8013e4:	83 ec 04             	sub    $0x4,%esp
+  8013e7:	52                   	push   %edx
+  8013e8:	50                   	push   %eax
+  8013e9:	68 30 35 80 00       	push   $0x803530
+  8013ee:	e8 30 f0 ff ff       	call   800423 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8013f3:	83 c4 10             	add    $0x10,%esp
+  8013f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8013fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013fe:	89 1a                	mov    %ebx,(%edx)
+}
+  801400:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801403:	c9                   	leave
+  801404:	c3                   	ret
+
+00801405 <fd_close>:
+{
+  801405:	55                   	push   %ebp
+  801406:	89 e5                	mov    %esp,%ebp
+  801408:	57                   	push   %edi
+  801409:	56                   	push   %esi
+  80140a:	53                   	push   %ebx
+  80140b:	83 ec 24             	sub    $0x24,%esp
+  80140e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801411:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801414:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801417:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801418:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80141e:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801421:	50                   	push   %eax
+  801422:	e8 42 ff ff ff       	call   801369 <fd_lookup>
+  801427:	89 c3                	mov    %eax,%ebx
+  801429:	83 c4 10             	add    $0x10,%esp
+  80142c:	85 c0                	test   %eax,%eax
+  80142e:	78 05                	js     801435 <fd_close+0x30>
+      || fd != fd2)
+  801430:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801433:	74 16                	je     80144b <fd_close+0x46>
+    return must_exist ? r : 0;
+  801435:	89 f8                	mov    %edi,%eax
+  801437:	84 c0                	test   %al,%al
+  801439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801441:	89 d8                	mov    %ebx,%eax
+  801443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801446:	5b                   	pop    %ebx
+  801447:	5e                   	pop    %esi
+  801448:	5f                   	pop    %edi
+  801449:	5d                   	pop    %ebp
+  80144a:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80144b:	83 ec 08             	sub    $0x8,%esp
+  80144e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801451:	50                   	push   %eax
+  801452:	ff 36                	push   (%esi)
+  801454:	e8 60 ff ff ff       	call   8013b9 <dev_lookup>
+  801459:	89 c3                	mov    %eax,%ebx
+  80145b:	83 c4 10             	add    $0x10,%esp
+  80145e:	85 c0                	test   %eax,%eax
+  801460:	78 1a                	js     80147c <fd_close+0x77>
+    if (dev->dev_close)
+  801462:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801465:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801468:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  80146d:	85 c0                	test   %eax,%eax
+  80146f:	74 0b                	je     80147c <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801471:	83 ec 0c             	sub    $0xc,%esp
+  801474:	56                   	push   %esi
+  801475:	ff d0                	call   *%eax
+  801477:	89 c3                	mov    %eax,%ebx
+  801479:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80147c:	83 ec 08             	sub    $0x8,%esp
+  80147f:	56                   	push   %esi
+  801480:	6a 00                	push   $0x0
+  801482:	e8 3e fa ff ff       	call   800ec5 <sys_page_unmap>
+  return r;
+  801487:	83 c4 10             	add    $0x10,%esp
+  80148a:	eb b5                	jmp    801441 <fd_close+0x3c>
+
+0080148c <close>:
+
+int
+close(int fdnum)
+{
+  80148c:	55                   	push   %ebp
+  80148d:	89 e5                	mov    %esp,%ebp
+  80148f:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801492:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801495:	50                   	push   %eax
+  801496:	ff 75 08             	push   0x8(%ebp)
+  801499:	e8 cb fe ff ff       	call   801369 <fd_lookup>
+  80149e:	83 c4 10             	add    $0x10,%esp
+  8014a1:	85 c0                	test   %eax,%eax
+  8014a3:	79 02                	jns    8014a7 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8014a5:	c9                   	leave
+  8014a6:	c3                   	ret
+    return fd_close(fd, 1);
+  8014a7:	83 ec 08             	sub    $0x8,%esp
+  8014aa:	6a 01                	push   $0x1
+  8014ac:	ff 75 f4             	push   -0xc(%ebp)
+  8014af:	e8 51 ff ff ff       	call   801405 <fd_close>
+  8014b4:	83 c4 10             	add    $0x10,%esp
+  8014b7:	eb ec                	jmp    8014a5 <close+0x19>
+
+008014b9 <close_all>:
+
+void
+close_all(void)
+{
+  8014b9:	55                   	push   %ebp
+  8014ba:	89 e5                	mov    %esp,%ebp
+  8014bc:	53                   	push   %ebx
+  8014bd:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8014c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8014c5:	83 ec 0c             	sub    $0xc,%esp
+  8014c8:	53                   	push   %ebx
+  8014c9:	e8 be ff ff ff       	call   80148c <close>
+  for (i = 0; i < MAXFD; i++)
+  8014ce:	83 c3 01             	add    $0x1,%ebx
+  8014d1:	83 c4 10             	add    $0x10,%esp
+  8014d4:	83 fb 20             	cmp    $0x20,%ebx
+  8014d7:	75 ec                	jne    8014c5 <close_all+0xc>
+}
+  8014d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014dc:	c9                   	leave
+  8014dd:	c3                   	ret
+
+008014de <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014de:	55                   	push   %ebp
+  8014df:	89 e5                	mov    %esp,%ebp
+  8014e1:	57                   	push   %edi
+  8014e2:	56                   	push   %esi
+  8014e3:	53                   	push   %ebx
+  8014e4:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014e7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014ea:	50                   	push   %eax
+  8014eb:	ff 75 08             	push   0x8(%ebp)
+  8014ee:	e8 76 fe ff ff       	call   801369 <fd_lookup>
+  8014f3:	89 c6                	mov    %eax,%esi
+  8014f5:	83 c4 10             	add    $0x10,%esp
+  8014f8:	85 c0                	test   %eax,%eax
+  8014fa:	0f 88 0a 01 00 00    	js     80160a <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801500:	83 ec 0c             	sub    $0xc,%esp
+  801503:	ff 75 0c             	push   0xc(%ebp)
+  801506:	e8 81 ff ff ff       	call   80148c <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80150b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80150e:	c1 e0 0c             	shl    $0xc,%eax
+  801511:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801517:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80151a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80151d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801520:	89 04 24             	mov    %eax,(%esp)
+  801523:	e8 d7 fd ff ff       	call   8012ff <fd2data>
+  801528:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80152a:	89 3c 24             	mov    %edi,(%esp)
+  80152d:	e8 cd fd ff ff       	call   8012ff <fd2data>
+  801532:	83 c4 10             	add    $0x10,%esp
+  801535:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801538:	89 f3                	mov    %esi,%ebx
+  80153a:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801540:	89 c6                	mov    %eax,%esi
+  801542:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801545:	89 cf                	mov    %ecx,%edi
+  801547:	eb 0c                	jmp    801555 <dup+0x77>
+  801549:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80154f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801555:	39 fb                	cmp    %edi,%ebx
+  801557:	74 7b                	je     8015d4 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801559:	89 d8                	mov    %ebx,%eax
+  80155b:	c1 e8 16             	shr    $0x16,%eax
+  80155e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801565:	a8 01                	test   $0x1,%al
+  801567:	74 e0                	je     801549 <dup+0x6b>
+  801569:	89 d8                	mov    %ebx,%eax
+  80156b:	c1 e8 0c             	shr    $0xc,%eax
+  80156e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801575:	f6 c2 01             	test   $0x1,%dl
+  801578:	74 cf                	je     801549 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80157a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801581:	83 ec 0c             	sub    $0xc,%esp
+  801584:	25 07 0e 00 00       	and    $0xe07,%eax
+  801589:	50                   	push   %eax
+  80158a:	56                   	push   %esi
+  80158b:	6a 00                	push   $0x0
+  80158d:	53                   	push   %ebx
+  80158e:	6a 00                	push   $0x0
+  801590:	e8 ee f8 ff ff       	call   800e83 <sys_page_map>
+  801595:	83 c4 20             	add    $0x20,%esp
+  801598:	85 c0                	test   %eax,%eax
+  80159a:	79 ad                	jns    801549 <dup+0x6b>
+  80159c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80159f:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8015a1:	83 ec 08             	sub    $0x8,%esp
+  8015a4:	ff 75 d4             	push   -0x2c(%ebp)
+  8015a7:	6a 00                	push   $0x0
+  8015a9:	e8 17 f9 ff ff       	call   800ec5 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8015ae:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8015b1:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8015b7:	83 c4 10             	add    $0x10,%esp
+  8015ba:	39 df                	cmp    %ebx,%edi
+  8015bc:	74 4c                	je     80160a <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8015be:	83 ec 08             	sub    $0x8,%esp
+  8015c1:	57                   	push   %edi
+  8015c2:	6a 00                	push   $0x0
+  8015c4:	e8 fc f8 ff ff       	call   800ec5 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8015c9:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8015cf:	83 c4 10             	add    $0x10,%esp
+  8015d2:	eb e6                	jmp    8015ba <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015d4:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8015d7:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8015da:	89 c8                	mov    %ecx,%eax
+  8015dc:	c1 e8 0c             	shr    $0xc,%eax
+  8015df:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015e6:	83 ec 0c             	sub    $0xc,%esp
+  8015e9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015ee:	50                   	push   %eax
+  8015ef:	ff 75 d4             	push   -0x2c(%ebp)
+  8015f2:	6a 00                	push   $0x0
+  8015f4:	51                   	push   %ecx
+  8015f5:	6a 00                	push   $0x0
+  8015f7:	e8 87 f8 ff ff       	call   800e83 <sys_page_map>
+  8015fc:	89 c6                	mov    %eax,%esi
+  8015fe:	83 c4 20             	add    $0x20,%esp
+  801601:	85 c0                	test   %eax,%eax
+  801603:	78 9c                	js     8015a1 <dup+0xc3>
+  return newfdnum;
+  801605:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801608:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80160a:	89 f0                	mov    %esi,%eax
+  80160c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160f:	5b                   	pop    %ebx
+  801610:	5e                   	pop    %esi
+  801611:	5f                   	pop    %edi
+  801612:	5d                   	pop    %ebp
+  801613:	c3                   	ret
+
+00801614 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801614:	55                   	push   %ebp
+  801615:	89 e5                	mov    %esp,%ebp
+  801617:	56                   	push   %esi
+  801618:	53                   	push   %ebx
+  801619:	83 ec 18             	sub    $0x18,%esp
+  80161c:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80161f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801622:	50                   	push   %eax
+  801623:	56                   	push   %esi
+  801624:	e8 40 fd ff ff       	call   801369 <fd_lookup>
+  801629:	83 c4 10             	add    $0x10,%esp
+  80162c:	85 c0                	test   %eax,%eax
+  80162e:	78 3c                	js     80166c <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801630:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801633:	83 ec 08             	sub    $0x8,%esp
+  801636:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801639:	50                   	push   %eax
+  80163a:	ff 33                	push   (%ebx)
+  80163c:	e8 78 fd ff ff       	call   8013b9 <dev_lookup>
+  801641:	83 c4 10             	add    $0x10,%esp
+  801644:	85 c0                	test   %eax,%eax
+  801646:	78 24                	js     80166c <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801648:	8b 43 08             	mov    0x8(%ebx),%eax
+  80164b:	83 e0 03             	and    $0x3,%eax
+  80164e:	83 f8 01             	cmp    $0x1,%eax
+  801651:	74 20                	je     801673 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801653:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801656:	8b 40 08             	mov    0x8(%eax),%eax
+  801659:	85 c0                	test   %eax,%eax
+  80165b:	74 37                	je     801694 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  80165d:	83 ec 04             	sub    $0x4,%esp
+  801660:	ff 75 10             	push   0x10(%ebp)
+  801663:	ff 75 0c             	push   0xc(%ebp)
+  801666:	53                   	push   %ebx
+  801667:	ff d0                	call   *%eax
+  801669:	83 c4 10             	add    $0x10,%esp
+}
+  80166c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80166f:	5b                   	pop    %ebx
+  801670:	5e                   	pop    %esi
+  801671:	5d                   	pop    %ebp
+  801672:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801673:	a1 44 67 80 00       	mov    0x806744,%eax
+  801678:	8b 40 48             	mov    0x48(%eax),%eax
+  80167b:	83 ec 04             	sub    $0x4,%esp
+  80167e:	56                   	push   %esi
+  80167f:	50                   	push   %eax
+  801680:	68 71 35 80 00       	push   $0x803571
+  801685:	e8 99 ed ff ff       	call   800423 <cprintf>
+    return -E_INVAL;
+  80168a:	83 c4 10             	add    $0x10,%esp
+  80168d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801692:	eb d8                	jmp    80166c <read+0x58>
+    return -E_NOT_SUPP;
+  801694:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801699:	eb d1                	jmp    80166c <read+0x58>
+
+0080169b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80169b:	55                   	push   %ebp
+  80169c:	89 e5                	mov    %esp,%ebp
+  80169e:	57                   	push   %edi
+  80169f:	56                   	push   %esi
+  8016a0:	53                   	push   %ebx
+  8016a1:	83 ec 0c             	sub    $0xc,%esp
+  8016a4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016a7:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8016aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016af:	eb 02                	jmp    8016b3 <readn+0x18>
+  8016b1:	01 c3                	add    %eax,%ebx
+  8016b3:	39 f3                	cmp    %esi,%ebx
+  8016b5:	73 21                	jae    8016d8 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8016b7:	83 ec 04             	sub    $0x4,%esp
+  8016ba:	89 f0                	mov    %esi,%eax
+  8016bc:	29 d8                	sub    %ebx,%eax
+  8016be:	50                   	push   %eax
+  8016bf:	89 d8                	mov    %ebx,%eax
+  8016c1:	03 45 0c             	add    0xc(%ebp),%eax
+  8016c4:	50                   	push   %eax
+  8016c5:	57                   	push   %edi
+  8016c6:	e8 49 ff ff ff       	call   801614 <read>
+    if (m < 0)
+  8016cb:	83 c4 10             	add    $0x10,%esp
+  8016ce:	85 c0                	test   %eax,%eax
+  8016d0:	78 04                	js     8016d6 <readn+0x3b>
+      return m;
+    if (m == 0)
+  8016d2:	75 dd                	jne    8016b1 <readn+0x16>
+  8016d4:	eb 02                	jmp    8016d8 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8016d6:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8016d8:	89 d8                	mov    %ebx,%eax
+  8016da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016dd:	5b                   	pop    %ebx
+  8016de:	5e                   	pop    %esi
+  8016df:	5f                   	pop    %edi
+  8016e0:	5d                   	pop    %ebp
+  8016e1:	c3                   	ret
+
+008016e2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016e2:	55                   	push   %ebp
+  8016e3:	89 e5                	mov    %esp,%ebp
+  8016e5:	56                   	push   %esi
+  8016e6:	53                   	push   %ebx
+  8016e7:	83 ec 18             	sub    $0x18,%esp
+  8016ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016ed:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016f0:	50                   	push   %eax
+  8016f1:	53                   	push   %ebx
+  8016f2:	e8 72 fc ff ff       	call   801369 <fd_lookup>
+  8016f7:	83 c4 10             	add    $0x10,%esp
+  8016fa:	85 c0                	test   %eax,%eax
+  8016fc:	78 37                	js     801735 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016fe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801701:	83 ec 08             	sub    $0x8,%esp
+  801704:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801707:	50                   	push   %eax
+  801708:	ff 36                	push   (%esi)
+  80170a:	e8 aa fc ff ff       	call   8013b9 <dev_lookup>
+  80170f:	83 c4 10             	add    $0x10,%esp
+  801712:	85 c0                	test   %eax,%eax
+  801714:	78 1f                	js     801735 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801716:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80171a:	74 20                	je     80173c <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  80171c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80171f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801722:	85 c0                	test   %eax,%eax
+  801724:	74 37                	je     80175d <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801726:	83 ec 04             	sub    $0x4,%esp
+  801729:	ff 75 10             	push   0x10(%ebp)
+  80172c:	ff 75 0c             	push   0xc(%ebp)
+  80172f:	56                   	push   %esi
+  801730:	ff d0                	call   *%eax
+  801732:	83 c4 10             	add    $0x10,%esp
+}
+  801735:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801738:	5b                   	pop    %ebx
+  801739:	5e                   	pop    %esi
+  80173a:	5d                   	pop    %ebp
+  80173b:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80173c:	a1 44 67 80 00       	mov    0x806744,%eax
+  801741:	8b 40 48             	mov    0x48(%eax),%eax
+  801744:	83 ec 04             	sub    $0x4,%esp
+  801747:	53                   	push   %ebx
+  801748:	50                   	push   %eax
+  801749:	68 8d 35 80 00       	push   $0x80358d
+  80174e:	e8 d0 ec ff ff       	call   800423 <cprintf>
+    return -E_INVAL;
+  801753:	83 c4 10             	add    $0x10,%esp
+  801756:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80175b:	eb d8                	jmp    801735 <write+0x53>
+    return -E_NOT_SUPP;
+  80175d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801762:	eb d1                	jmp    801735 <write+0x53>
+
+00801764 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801764:	55                   	push   %ebp
+  801765:	89 e5                	mov    %esp,%ebp
+  801767:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80176a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80176d:	50                   	push   %eax
+  80176e:	ff 75 08             	push   0x8(%ebp)
+  801771:	e8 f3 fb ff ff       	call   801369 <fd_lookup>
+  801776:	83 c4 10             	add    $0x10,%esp
+  801779:	85 c0                	test   %eax,%eax
+  80177b:	78 0e                	js     80178b <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  80177d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801780:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801783:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801786:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80178b:	c9                   	leave
+  80178c:	c3                   	ret
+
+0080178d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80178d:	55                   	push   %ebp
+  80178e:	89 e5                	mov    %esp,%ebp
+  801790:	56                   	push   %esi
+  801791:	53                   	push   %ebx
+  801792:	83 ec 18             	sub    $0x18,%esp
+  801795:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801798:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80179b:	50                   	push   %eax
+  80179c:	53                   	push   %ebx
+  80179d:	e8 c7 fb ff ff       	call   801369 <fd_lookup>
+  8017a2:	83 c4 10             	add    $0x10,%esp
+  8017a5:	85 c0                	test   %eax,%eax
+  8017a7:	78 34                	js     8017dd <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017a9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017ac:	83 ec 08             	sub    $0x8,%esp
+  8017af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b2:	50                   	push   %eax
+  8017b3:	ff 36                	push   (%esi)
+  8017b5:	e8 ff fb ff ff       	call   8013b9 <dev_lookup>
+  8017ba:	83 c4 10             	add    $0x10,%esp
+  8017bd:	85 c0                	test   %eax,%eax
+  8017bf:	78 1c                	js     8017dd <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017c1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017c5:	74 1d                	je     8017e4 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  8017c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017ca:	8b 40 18             	mov    0x18(%eax),%eax
+  8017cd:	85 c0                	test   %eax,%eax
+  8017cf:	74 34                	je     801805 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  8017d1:	83 ec 08             	sub    $0x8,%esp
+  8017d4:	ff 75 0c             	push   0xc(%ebp)
+  8017d7:	56                   	push   %esi
+  8017d8:	ff d0                	call   *%eax
+  8017da:	83 c4 10             	add    $0x10,%esp
+}
+  8017dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e0:	5b                   	pop    %ebx
+  8017e1:	5e                   	pop    %esi
+  8017e2:	5d                   	pop    %ebp
+  8017e3:	c3                   	ret
+            thisenv->env_id, fdnum);
+  8017e4:	a1 44 67 80 00       	mov    0x806744,%eax
+  8017e9:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017ec:	83 ec 04             	sub    $0x4,%esp
+  8017ef:	53                   	push   %ebx
+  8017f0:	50                   	push   %eax
+  8017f1:	68 50 35 80 00       	push   $0x803550
+  8017f6:	e8 28 ec ff ff       	call   800423 <cprintf>
+    return -E_INVAL;
+  8017fb:	83 c4 10             	add    $0x10,%esp
+  8017fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801803:	eb d8                	jmp    8017dd <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801805:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80180a:	eb d1                	jmp    8017dd <ftruncate+0x50>
+
+0080180c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80180c:	55                   	push   %ebp
+  80180d:	89 e5                	mov    %esp,%ebp
+  80180f:	56                   	push   %esi
+  801810:	53                   	push   %ebx
+  801811:	83 ec 18             	sub    $0x18,%esp
+  801814:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801817:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80181a:	50                   	push   %eax
+  80181b:	ff 75 08             	push   0x8(%ebp)
+  80181e:	e8 46 fb ff ff       	call   801369 <fd_lookup>
+  801823:	83 c4 10             	add    $0x10,%esp
+  801826:	85 c0                	test   %eax,%eax
+  801828:	78 49                	js     801873 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80182a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80182d:	83 ec 08             	sub    $0x8,%esp
+  801830:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801833:	50                   	push   %eax
+  801834:	ff 36                	push   (%esi)
+  801836:	e8 7e fb ff ff       	call   8013b9 <dev_lookup>
+  80183b:	83 c4 10             	add    $0x10,%esp
+  80183e:	85 c0                	test   %eax,%eax
+  801840:	78 31                	js     801873 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801842:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801845:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801849:	74 2f                	je     80187a <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  80184b:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  80184e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801855:	00 00 00 
+  stat->st_isdir = 0;
+  801858:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80185f:	00 00 00 
+  stat->st_dev = dev;
+  801862:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801868:	83 ec 08             	sub    $0x8,%esp
+  80186b:	53                   	push   %ebx
+  80186c:	56                   	push   %esi
+  80186d:	ff 50 14             	call   *0x14(%eax)
+  801870:	83 c4 10             	add    $0x10,%esp
+}
+  801873:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801876:	5b                   	pop    %ebx
+  801877:	5e                   	pop    %esi
+  801878:	5d                   	pop    %ebp
+  801879:	c3                   	ret
+    return -E_NOT_SUPP;
+  80187a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80187f:	eb f2                	jmp    801873 <fstat+0x67>
+
+00801881 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801881:	55                   	push   %ebp
+  801882:	89 e5                	mov    %esp,%ebp
+  801884:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801887:	ff 75 0c             	push   0xc(%ebp)
+  80188a:	ff 75 08             	push   0x8(%ebp)
+  80188d:	e8 58 07 00 00       	call   801fea <file_stat>
+}
+  801892:	c9                   	leave
+  801893:	c3                   	ret
+
+00801894 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801894:	55                   	push   %ebp
+  801895:	89 e5                	mov    %esp,%ebp
+  801897:	57                   	push   %edi
+  801898:	56                   	push   %esi
+  801899:	53                   	push   %ebx
+  80189a:	83 ec 1c             	sub    $0x1c,%esp
+  80189d:	89 c7                	mov    %eax,%edi
+  80189f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8018a2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8018a5:	e9 a2 00 00 00       	jmp    80194c <fsipc_send+0xb8>
+  nfsenvs = 0;
+  8018aa:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8018b1:	00 00 00 
+  8018b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8018be:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8018c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8018c8:	eb 0f                	jmp    8018d9 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8018ca:	83 c0 01             	add    $0x1,%eax
+  8018cd:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8018d2:	74 49                	je     80191d <fsipc_send+0x89>
+  8018d4:	83 f9 07             	cmp    $0x7,%ecx
+  8018d7:	7f 50                	jg     801929 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  8018d9:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8018dc:	c1 e2 04             	shl    $0x4,%edx
+  8018df:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8018e5:	8b 52 50             	mov    0x50(%edx),%edx
+  8018e8:	83 fa 01             	cmp    $0x1,%edx
+  8018eb:	75 dd                	jne    8018ca <fsipc_send+0x36>
+  8018ed:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8018f0:	c1 e2 04             	shl    $0x4,%edx
+  8018f3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8018f9:	8b 52 54             	mov    0x54(%edx),%edx
+  8018fc:	85 d2                	test   %edx,%edx
+  8018fe:	74 ca                	je     8018ca <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801900:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801903:	c1 e2 04             	shl    $0x4,%edx
+  801906:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80190c:	8b 52 48             	mov    0x48(%edx),%edx
+  80190f:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801916:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801919:	89 f3                	mov    %esi,%ebx
+  80191b:	eb ad                	jmp    8018ca <fsipc_send+0x36>
+  80191d:	84 db                	test   %bl,%bl
+  80191f:	74 38                	je     801959 <fsipc_send+0xc5>
+  801921:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801927:	eb 30                	jmp    801959 <fsipc_send+0xc5>
+  801929:	84 db                	test   %bl,%bl
+  80192b:	74 2c                	je     801959 <fsipc_send+0xc5>
+  80192d:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801933:	eb 24                	jmp    801959 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801935:	50                   	push   %eax
+  801936:	68 bc 35 80 00       	push   $0x8035bc
+  80193b:	6a 34                	push   $0x34
+  80193d:	68 c6 35 80 00       	push   $0x8035c6
+  801942:	e8 01 ea ff ff       	call   800348 <_panic>
+    }
+    sys_yield();
+  801947:	e8 92 f4 ff ff       	call   800dde <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  80194c:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801953:	0f 8e 51 ff ff ff    	jle    8018aa <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801959:	a1 44 67 80 00       	mov    0x806744,%eax
+  80195e:	8b 70 48             	mov    0x48(%eax),%esi
+  801961:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801967:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196c:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801972:	39 d9                	cmp    %ebx,%ecx
+  801974:	7e d1                	jle    801947 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801976:	83 ec 0c             	sub    $0xc,%esp
+  801979:	ff 75 e0             	push   -0x20(%ebp)
+  80197c:	6a 07                	push   $0x7
+  80197e:	ff 75 e4             	push   -0x1c(%ebp)
+  801981:	57                   	push   %edi
+  801982:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801985:	99                   	cltd
+  801986:	f7 f9                	idiv   %ecx
+  801988:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  80198f:	e8 63 f7 ff ff       	call   8010f7 <sys_ipc_try_send>
+      if (r == 0)
+  801994:	83 c4 20             	add    $0x20,%esp
+  801997:	85 c0                	test   %eax,%eax
+  801999:	74 0a                	je     8019a5 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  80199b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80199e:	75 95                	jne    801935 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8019a0:	83 c3 01             	add    $0x1,%ebx
+  8019a3:	eb c7                	jmp    80196c <fsipc_send+0xd8>
+  }
+}
+  8019a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019a8:	5b                   	pop    %ebx
+  8019a9:	5e                   	pop    %esi
+  8019aa:	5f                   	pop    %edi
+  8019ab:	5d                   	pop    %ebp
+  8019ac:	c3                   	ret
+
+008019ad <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8019ad:	55                   	push   %ebp
+  8019ae:	89 e5                	mov    %esp,%ebp
+  8019b0:	53                   	push   %ebx
+  8019b1:	83 ec 14             	sub    $0x14,%esp
+  8019b4:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  8019b6:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  8019bd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019c2:	ba 00 70 80 00       	mov    $0x807000,%edx
+  8019c7:	e8 c8 fe ff ff       	call   801894 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8019cc:	6a 00                	push   $0x0
+  8019ce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019d1:	50                   	push   %eax
+  8019d2:	53                   	push   %ebx
+  8019d3:	6a 00                	push   $0x0
+  8019d5:	e8 26 13 00 00       	call   802d00 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  8019da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019dd:	c9                   	leave
+  8019de:	c3                   	ret
+
+008019df <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8019df:	55                   	push   %ebp
+  8019e0:	89 e5                	mov    %esp,%ebp
+  8019e2:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019eb:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  8019f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019f3:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8019f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019fd:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a02:	e8 a6 ff ff ff       	call   8019ad <fsipc>
+}
+  801a07:	c9                   	leave
+  801a08:	c3                   	ret
+
+00801a09 <devfile_flush>:
+{
+  801a09:	55                   	push   %ebp
+  801a0a:	89 e5                	mov    %esp,%ebp
+  801a0c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a12:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a15:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801a1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a1f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a24:	e8 84 ff ff ff       	call   8019ad <fsipc>
+}
+  801a29:	c9                   	leave
+  801a2a:	c3                   	ret
+
+00801a2b <devfile_stat>:
+{
+  801a2b:	55                   	push   %ebp
+  801a2c:	89 e5                	mov    %esp,%ebp
+  801a2e:	53                   	push   %ebx
+  801a2f:	83 ec 04             	sub    $0x4,%esp
+  801a32:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a35:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a38:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a3b:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a40:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a45:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a4a:	e8 5e ff ff ff       	call   8019ad <fsipc>
+  801a4f:	85 c0                	test   %eax,%eax
+  801a51:	78 2c                	js     801a7f <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a53:	83 ec 08             	sub    $0x8,%esp
+  801a56:	68 00 70 80 00       	push   $0x807000
+  801a5b:	53                   	push   %ebx
+  801a5c:	e8 b0 ef ff ff       	call   800a11 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801a61:	a1 80 70 80 00       	mov    0x807080,%eax
+  801a66:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a6c:	a1 84 70 80 00       	mov    0x807084,%eax
+  801a71:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801a77:	83 c4 10             	add    $0x10,%esp
+  801a7a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a82:	c9                   	leave
+  801a83:	c3                   	ret
+
+00801a84 <fsv_alloc>:
+{
+  801a84:	55                   	push   %ebp
+  801a85:	89 e5                	mov    %esp,%ebp
+  801a87:	56                   	push   %esi
+  801a88:	53                   	push   %ebx
+  801a89:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801a8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a90:	eb 22                	jmp    801ab4 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801a92:	83 ec 04             	sub    $0x4,%esp
+  801a95:	6a 00                	push   $0x0
+  801a97:	6a 00                	push   $0x0
+  801a99:	6a 07                	push   $0x7
+  801a9b:	50                   	push   %eax
+  801a9c:	6a 00                	push   $0x0
+  801a9e:	6a 04                	push   $0x4
+  801aa0:	68 40 60 80 00       	push   $0x806040
+  801aa5:	e8 e9 f7 ff ff       	call   801293 <sysbatch_add>
+  801aaa:	83 c4 20             	add    $0x20,%esp
+  801aad:	85 c0                	test   %eax,%eax
+  801aaf:	78 48                	js     801af9 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801ab1:	83 c3 01             	add    $0x1,%ebx
+  801ab4:	39 f3                	cmp    %esi,%ebx
+  801ab6:	74 31                	je     801ae9 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801ab8:	89 d8                	mov    %ebx,%eax
+  801aba:	c1 e0 0c             	shl    $0xc,%eax
+  801abd:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801ac2:	89 c2                	mov    %eax,%edx
+  801ac4:	c1 ea 16             	shr    $0x16,%edx
+  801ac7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801ace:	f6 c2 01             	test   $0x1,%dl
+  801ad1:	74 bf                	je     801a92 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801ad3:	89 c2                	mov    %eax,%edx
+  801ad5:	c1 ea 0c             	shr    $0xc,%edx
+  801ad8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801adf:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801ae2:	83 fa 03             	cmp    $0x3,%edx
+  801ae5:	75 ab                	jne    801a92 <fsv_alloc+0xe>
+  801ae7:	eb c8                	jmp    801ab1 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801ae9:	83 ec 0c             	sub    $0xc,%esp
+  801aec:	68 40 60 80 00       	push   $0x806040
+  801af1:	e8 4d f7 ff ff       	call   801243 <sysbatch_flush>
+  801af6:	83 c4 10             	add    $0x10,%esp
+}
+  801af9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801afc:	5b                   	pop    %ebx
+  801afd:	5e                   	pop    %esi
+  801afe:	5d                   	pop    %ebp
+  801aff:	c3                   	ret
+
+00801b00 <devfile_read>:
+{
+  801b00:	55                   	push   %ebp
+  801b01:	89 e5                	mov    %esp,%ebp
+  801b03:	57                   	push   %edi
+  801b04:	56                   	push   %esi
+  801b05:	53                   	push   %ebx
+  801b06:	83 ec 3c             	sub    $0x3c,%esp
+  801b09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801b0c:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801b12:	77 57                	ja     801b6b <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b14:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b17:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b1a:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801b1f:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b25:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2a:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b2f:	e8 79 fe ff ff       	call   8019ad <fsipc>
+  801b34:	89 c6                	mov    %eax,%esi
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	78 27                	js     801b61 <devfile_read+0x61>
+  assert(r <= n);
+  801b3a:	39 c3                	cmp    %eax,%ebx
+  801b3c:	0f 82 0e 02 00 00    	jb     801d50 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801b42:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b47:	0f 8f 1c 02 00 00    	jg     801d69 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b4d:	83 ec 04             	sub    $0x4,%esp
+  801b50:	50                   	push   %eax
+  801b51:	68 00 70 80 00       	push   $0x807000
+  801b56:	ff 75 0c             	push   0xc(%ebp)
+  801b59:	e8 39 f0 ff ff       	call   800b97 <memmove>
+  return r;
+  801b5e:	83 c4 10             	add    $0x10,%esp
+}
+  801b61:	89 f0                	mov    %esi,%eax
+  801b63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b66:	5b                   	pop    %ebx
+  801b67:	5e                   	pop    %esi
+  801b68:	5f                   	pop    %edi
+  801b69:	5d                   	pop    %ebp
+  801b6a:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801b6b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b70:	e8 0f ff ff ff       	call   801a84 <fsv_alloc>
+  801b75:	89 c6                	mov    %eax,%esi
+  801b77:	85 c0                	test   %eax,%eax
+  801b79:	78 e6                	js     801b61 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801b7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b7e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b81:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801b86:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b89:	8b 40 04             	mov    0x4(%eax),%eax
+  801b8c:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801b91:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801b97:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801b9e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ba3:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801ba8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801bad:	e8 e2 fc ff ff       	call   801894 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801bb2:	6a 00                	push   $0x0
+  801bb4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bb7:	50                   	push   %eax
+  801bb8:	68 00 10 c0 9f       	push   $0x9fc01000
+  801bbd:	6a 00                	push   $0x0
+  801bbf:	e8 3c 11 00 00       	call   802d00 <ipc_recv_pages>
+  801bc4:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801bc6:	83 c4 10             	add    $0x10,%esp
+  801bc9:	85 c0                	test   %eax,%eax
+  801bcb:	7e 94                	jle    801b61 <devfile_read+0x61>
+  assert(r <= n);
+  801bcd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801bd0:	39 c3                	cmp    %eax,%ebx
+  801bd2:	72 2e                	jb     801c02 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801bd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd7:	8b 40 04             	mov    0x4(%eax),%eax
+  801bda:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801bdf:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801be2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801be5:	c1 e2 0c             	shl    $0xc,%edx
+  801be8:	39 ca                	cmp    %ecx,%edx
+  801bea:	72 2f                	jb     801c1b <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801bec:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801bf1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801bf4:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801bf8:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801bfd:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801c00:	eb 52                	jmp    801c54 <devfile_read+0x154>
+  assert(r <= n);
+  801c02:	68 d1 35 80 00       	push   $0x8035d1
+  801c07:	68 d8 35 80 00       	push   $0x8035d8
+  801c0c:	68 49 01 00 00       	push   $0x149
+  801c11:	68 c6 35 80 00       	push   $0x8035c6
+  801c16:	e8 2d e7 ff ff       	call   800348 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c1b:	68 fc 35 80 00       	push   $0x8035fc
+  801c20:	68 d8 35 80 00       	push   $0x8035d8
+  801c25:	68 4a 01 00 00       	push   $0x14a
+  801c2a:	68 c6 35 80 00       	push   $0x8035c6
+  801c2f:	e8 14 e7 ff ff       	call   800348 <_panic>
+      memmove(dst + done, src + done, m);
+  801c34:	83 ec 04             	sub    $0x4,%esp
+  801c37:	53                   	push   %ebx
+  801c38:	56                   	push   %esi
+  801c39:	89 f8                	mov    %edi,%eax
+  801c3b:	03 45 0c             	add    0xc(%ebp),%eax
+  801c3e:	50                   	push   %eax
+  801c3f:	e8 53 ef ff ff       	call   800b97 <memmove>
+  801c44:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801c47:	01 df                	add    %ebx,%edi
+  801c49:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801c4c:	39 c7                	cmp    %eax,%edi
+  801c4e:	0f 83 c0 00 00 00    	jae    801d14 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801c54:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801c57:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801c5a:	89 f0                	mov    %esi,%eax
+  801c5c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c61:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801c66:	29 c3                	sub    %eax,%ebx
+  801c68:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801c6b:	29 f8                	sub    %edi,%eax
+  801c6d:	39 c3                	cmp    %eax,%ebx
+  801c6f:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801c72:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801c78:	75 ba                	jne    801c34 <devfile_read+0x134>
+  801c7a:	89 f9                	mov    %edi,%ecx
+  801c7c:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801c7f:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801c82:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801c88:	75 aa                	jne    801c34 <devfile_read+0x134>
+  801c8a:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801c90:	77 a2                	ja     801c34 <devfile_read+0x134>
+  801c92:	89 c8                	mov    %ecx,%eax
+  801c94:	c1 e8 16             	shr    $0x16,%eax
+  801c97:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c9e:	a8 01                	test   $0x1,%al
+  801ca0:	74 92                	je     801c34 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801ca2:	89 c8                	mov    %ecx,%eax
+  801ca4:	c1 e8 0c             	shr    $0xc,%eax
+  801ca7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801cae:	a8 01                	test   $0x1,%al
+  801cb0:	74 82                	je     801c34 <devfile_read+0x134>
+  801cb2:	a9 02 08 00 00       	test   $0x802,%eax
+  801cb7:	0f 84 77 ff ff ff    	je     801c34 <devfile_read+0x134>
+  801cbd:	f6 c4 04             	test   $0x4,%ah
+  801cc0:	0f 85 6e ff ff ff    	jne    801c34 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801cc6:	a1 44 67 80 00       	mov    0x806744,%eax
+  801ccb:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801ccf:	84 c0                	test   %al,%al
+  801cd1:	75 17                	jne    801cea <devfile_read+0x1ea>
+  801cd3:	83 ec 08             	sub    $0x8,%esp
+  801cd6:	6a 01                	push   $0x1
+  801cd8:	6a 00                	push   $0x0
+  801cda:	e8 1e f1 ff ff       	call   800dfd <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801cdf:	83 c4 10             	add    $0x10,%esp
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	0f 85 4a ff ff ff    	jne    801c34 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801cea:	83 ec 04             	sub    $0x4,%esp
+  801ced:	68 05 08 00 00       	push   $0x805
+  801cf2:	ff 75 cc             	push   -0x34(%ebp)
+  801cf5:	6a 00                	push   $0x0
+  801cf7:	56                   	push   %esi
+  801cf8:	6a 00                	push   $0x0
+  801cfa:	6a 05                	push   $0x5
+  801cfc:	68 40 60 80 00       	push   $0x806040
+  801d01:	e8 8d f5 ff ff       	call   801293 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801d06:	c1 e8 1f             	shr    $0x1f,%eax
+  801d09:	08 45 cb             	or     %al,-0x35(%ebp)
+  801d0c:	83 c4 20             	add    $0x20,%esp
+  801d0f:	e9 33 ff ff ff       	jmp    801c47 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801d14:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801d17:	83 ec 0c             	sub    $0xc,%esp
+  801d1a:	68 40 60 80 00       	push   $0x806040
+  801d1f:	e8 1f f5 ff ff       	call   801243 <sysbatch_flush>
+  801d24:	83 c4 10             	add    $0x10,%esp
+  801d27:	85 c0                	test   %eax,%eax
+  801d29:	78 06                	js     801d31 <devfile_read+0x231>
+  801d2b:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801d2f:	74 14                	je     801d45 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801d31:	83 ec 04             	sub    $0x4,%esp
+  801d34:	ff 75 d4             	push   -0x2c(%ebp)
+  801d37:	ff 75 d0             	push   -0x30(%ebp)
+  801d3a:	ff 75 0c             	push   0xc(%ebp)
+  801d3d:	e8 55 ee ff ff       	call   800b97 <memmove>
+  801d42:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801d45:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d48:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801d4b:	e9 11 fe ff ff       	jmp    801b61 <devfile_read+0x61>
+  assert(r <= n);
+  801d50:	68 d1 35 80 00       	push   $0x8035d1
+  801d55:	68 d8 35 80 00       	push   $0x8035d8
+  801d5a:	68 1c 01 00 00       	push   $0x11c
+  801d5f:	68 c6 35 80 00       	push   $0x8035c6
+  801d64:	e8 df e5 ff ff       	call   800348 <_panic>
+  assert(r <= PGSIZE);
+  801d69:	68 ed 35 80 00       	push   $0x8035ed
+  801d6e:	68 d8 35 80 00       	push   $0x8035d8
+  801d73:	68 1d 01 00 00       	push   $0x11d
+  801d78:	68 c6 35 80 00       	push   $0x8035c6
+  801d7d:	e8 c6 e5 ff ff       	call   800348 <_panic>
+
+00801d82 <devfile_write>:
+{
+  801d82:	55                   	push   %ebp
+  801d83:	89 e5                	mov    %esp,%ebp
+  801d85:	57                   	push   %edi
+  801d86:	56                   	push   %esi
+  801d87:	53                   	push   %ebx
+  801d88:	83 ec 1c             	sub    $0x1c,%esp
+  801d8b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d8e:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801d91:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801d96:	77 39                	ja     801dd1 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d98:	8b 56 0c             	mov    0xc(%esi),%edx
+  801d9b:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  801da1:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801da6:	83 ec 04             	sub    $0x4,%esp
+  801da9:	50                   	push   %eax
+  801daa:	ff 75 0c             	push   0xc(%ebp)
+  801dad:	68 08 70 80 00       	push   $0x807008
+  801db2:	e8 e0 ed ff ff       	call   800b97 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801db7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dbc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801dc1:	e8 e7 fb ff ff       	call   8019ad <fsipc>
+  801dc6:	83 c4 10             	add    $0x10,%esp
+}
+  801dc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dcc:	5b                   	pop    %ebx
+  801dcd:	5e                   	pop    %esi
+  801dce:	5f                   	pop    %edi
+  801dcf:	5d                   	pop    %ebp
+  801dd0:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801dd1:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801dd6:	39 d0                	cmp    %edx,%eax
+  801dd8:	89 d3                	mov    %edx,%ebx
+  801dda:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801ddd:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801de3:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801de6:	83 c7 01             	add    $0x1,%edi
+  801de9:	89 f8                	mov    %edi,%eax
+  801deb:	e8 94 fc ff ff       	call   801a84 <fsv_alloc>
+  801df0:	85 c0                	test   %eax,%eax
+  801df2:	78 d5                	js     801dc9 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801df4:	83 ec 04             	sub    $0x4,%esp
+  801df7:	53                   	push   %ebx
+  801df8:	ff 75 0c             	push   0xc(%ebp)
+  801dfb:	68 00 10 c0 9f       	push   $0x9fc01000
+  801e00:	e8 92 ed ff ff       	call   800b97 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801e05:	8b 46 0c             	mov    0xc(%esi),%eax
+  801e08:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801e0d:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801e13:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801e1a:	89 f9                	mov    %edi,%ecx
+  801e1c:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801e21:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801e26:	e8 69 fa ff ff       	call   801894 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801e2b:	6a 00                	push   $0x0
+  801e2d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e30:	50                   	push   %eax
+  801e31:	6a 00                	push   $0x0
+  801e33:	6a 00                	push   $0x0
+  801e35:	e8 c6 0e 00 00       	call   802d00 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801e3a:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801e3d:	eb 8a                	jmp    801dc9 <devfile_write+0x47>
+
+00801e3f <open>:
+{
+  801e3f:	55                   	push   %ebp
+  801e40:	89 e5                	mov    %esp,%ebp
+  801e42:	56                   	push   %esi
+  801e43:	53                   	push   %ebx
+  801e44:	83 ec 1c             	sub    $0x1c,%esp
+  801e47:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801e4a:	56                   	push   %esi
+  801e4b:	e8 86 eb ff ff       	call   8009d6 <strlen>
+  801e50:	83 c4 10             	add    $0x10,%esp
+  801e53:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e58:	7f 6c                	jg     801ec6 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801e5a:	83 ec 0c             	sub    $0xc,%esp
+  801e5d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e60:	50                   	push   %eax
+  801e61:	e8 ad f4 ff ff       	call   801313 <fd_alloc>
+  801e66:	89 c3                	mov    %eax,%ebx
+  801e68:	83 c4 10             	add    $0x10,%esp
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 3c                	js     801eab <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801e6f:	83 ec 08             	sub    $0x8,%esp
+  801e72:	56                   	push   %esi
+  801e73:	68 00 70 80 00       	push   $0x807000
+  801e78:	e8 94 eb ff ff       	call   800a11 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801e7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e80:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801e85:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e88:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e8d:	e8 1b fb ff ff       	call   8019ad <fsipc>
+  801e92:	89 c3                	mov    %eax,%ebx
+  801e94:	83 c4 10             	add    $0x10,%esp
+  801e97:	85 c0                	test   %eax,%eax
+  801e99:	78 19                	js     801eb4 <open+0x75>
+  return fd2num(fd);
+  801e9b:	83 ec 0c             	sub    $0xc,%esp
+  801e9e:	ff 75 f4             	push   -0xc(%ebp)
+  801ea1:	e8 49 f4 ff ff       	call   8012ef <fd2num>
+  801ea6:	89 c3                	mov    %eax,%ebx
+  801ea8:	83 c4 10             	add    $0x10,%esp
+}
+  801eab:	89 d8                	mov    %ebx,%eax
+  801ead:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb0:	5b                   	pop    %ebx
+  801eb1:	5e                   	pop    %esi
+  801eb2:	5d                   	pop    %ebp
+  801eb3:	c3                   	ret
+    fd_close(fd, 0);
+  801eb4:	83 ec 08             	sub    $0x8,%esp
+  801eb7:	6a 00                	push   $0x0
+  801eb9:	ff 75 f4             	push   -0xc(%ebp)
+  801ebc:	e8 44 f5 ff ff       	call   801405 <fd_close>
+    return r;
+  801ec1:	83 c4 10             	add    $0x10,%esp
+  801ec4:	eb e5                	jmp    801eab <open+0x6c>
+    return -E_BAD_PATH;
+  801ec6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ecb:	eb de                	jmp    801eab <open+0x6c>
+
+00801ecd <open_read>:
+{
+  801ecd:	55                   	push   %ebp
+  801ece:	89 e5                	mov    %esp,%ebp
+  801ed0:	57                   	push   %edi
+  801ed1:	56                   	push   %esi
+  801ed2:	53                   	push   %ebx
+  801ed3:	83 ec 28             	sub    $0x28,%esp
+  801ed6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801ed9:	57                   	push   %edi
+  801eda:	e8 f7 ea ff ff       	call   8009d6 <strlen>
+  801edf:	83 c4 10             	add    $0x10,%esp
+  801ee2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ee7:	0f 87 f6 00 00 00    	ja     801fe3 <open_read+0x116>
+  801eed:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801eef:	83 ec 0c             	sub    $0xc,%esp
+  801ef2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ef5:	50                   	push   %eax
+  801ef6:	e8 18 f4 ff ff       	call   801313 <fd_alloc>
+  801efb:	89 c3                	mov    %eax,%ebx
+  801efd:	83 c4 10             	add    $0x10,%esp
+  801f00:	85 c0                	test   %eax,%eax
+  801f02:	0f 88 b2 00 00 00    	js     801fba <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801f08:	83 ec 08             	sub    $0x8,%esp
+  801f0b:	57                   	push   %edi
+  801f0c:	68 e4 70 80 00       	push   $0x8070e4
+  801f11:	e8 fb ea ff ff       	call   800a11 <strcpy>
+  req->req_nops = 2;
+  801f16:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  801f1d:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801f20:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  801f27:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801f2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f2d:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  801f32:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  801f39:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801f3c:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  801f43:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801f46:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  801f4d:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801f50:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801f55:	29 f0                	sub    %esi,%eax
+  801f57:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801f5a:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801f5e:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  801f63:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  801f6a:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801f6d:	83 c6 01             	add    $0x1,%esi
+  801f70:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801f76:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f79:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f7e:	e8 2a fa ff ff       	call   8019ad <fsipc>
+  801f83:	89 c3                	mov    %eax,%ebx
+  801f85:	83 c4 10             	add    $0x10,%esp
+  801f88:	83 f8 01             	cmp    $0x1,%eax
+  801f8b:	7e 37                	jle    801fc4 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801f8d:	a1 38 70 80 00       	mov    0x807038,%eax
+  801f92:	8b 55 18             	mov    0x18(%ebp),%edx
+  801f95:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801f97:	83 ec 04             	sub    $0x4,%esp
+  801f9a:	50                   	push   %eax
+  801f9b:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  801fa1:	56                   	push   %esi
+  801fa2:	ff 75 10             	push   0x10(%ebp)
+  801fa5:	e8 ed eb ff ff       	call   800b97 <memmove>
+  return fd2num(fd);
+  801faa:	83 c4 04             	add    $0x4,%esp
+  801fad:	ff 75 e4             	push   -0x1c(%ebp)
+  801fb0:	e8 3a f3 ff ff       	call   8012ef <fd2num>
+  801fb5:	89 c3                	mov    %eax,%ebx
+  801fb7:	83 c4 10             	add    $0x10,%esp
+}
+  801fba:	89 d8                	mov    %ebx,%eax
+  801fbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fbf:	5b                   	pop    %ebx
+  801fc0:	5e                   	pop    %esi
+  801fc1:	5f                   	pop    %edi
+  801fc2:	5d                   	pop    %ebp
+  801fc3:	c3                   	ret
+    fd_close(fd, 0);
+  801fc4:	83 ec 08             	sub    $0x8,%esp
+  801fc7:	6a 00                	push   $0x0
+  801fc9:	ff 75 e4             	push   -0x1c(%ebp)
+  801fcc:	e8 34 f4 ff ff       	call   801405 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801fd1:	83 c4 10             	add    $0x10,%esp
+  801fd4:	85 db                	test   %ebx,%ebx
+  801fd6:	78 e2                	js     801fba <open_read+0xed>
+  801fd8:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801fdb:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  801fe1:	eb d7                	jmp    801fba <open_read+0xed>
+    return -E_BAD_PATH;
+  801fe3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801fe8:	eb d0                	jmp    801fba <open_read+0xed>
+
+00801fea <file_stat>:
+{
+  801fea:	55                   	push   %ebp
+  801feb:	89 e5                	mov    %esp,%ebp
+  801fed:	57                   	push   %edi
+  801fee:	56                   	push   %esi
+  801fef:	53                   	push   %ebx
+  801ff0:	83 ec 18             	sub    $0x18,%esp
+  801ff3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ff6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801ff9:	57                   	push   %edi
+  801ffa:	e8 d7 e9 ff ff       	call   8009d6 <strlen>
+  801fff:	83 c4 10             	add    $0x10,%esp
+  802002:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802007:	0f 8f c7 00 00 00    	jg     8020d4 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  80200d:	83 ec 0c             	sub    $0xc,%esp
+  802010:	57                   	push   %edi
+  802011:	e8 c0 e9 ff ff       	call   8009d6 <strlen>
+  802016:	8d 58 04             	lea    0x4(%eax),%ebx
+  802019:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  80201c:	83 c4 08             	add    $0x8,%esp
+  80201f:	57                   	push   %edi
+  802020:	68 e4 70 80 00       	push   $0x8070e4
+  802025:	e8 e7 e9 ff ff       	call   800a11 <strcpy>
+  req->req_nops = 2;
+  80202a:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802031:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802034:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  80203b:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  80203e:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  802045:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802048:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  80204f:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802052:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  802059:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80205c:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  802063:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802066:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  80206c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802071:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802076:	e8 32 f9 ff ff       	call   8019ad <fsipc>
+  80207b:	83 c4 10             	add    $0x10,%esp
+  80207e:	83 f8 01             	cmp    $0x1,%eax
+  802081:	7e 42                	jle    8020c5 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802083:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802089:	83 ec 08             	sub    $0x8,%esp
+  80208c:	53                   	push   %ebx
+  80208d:	56                   	push   %esi
+  80208e:	e8 7e e9 ff ff       	call   800a11 <strcpy>
+  st->st_size = ret->ret_size;
+  802093:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802099:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  80209f:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8020a5:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8020ab:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  8020b2:	40 80 00 
+  return 0;
+  8020b5:	83 c4 10             	add    $0x10,%esp
+  8020b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020c0:	5b                   	pop    %ebx
+  8020c1:	5e                   	pop    %esi
+  8020c2:	5f                   	pop    %edi
+  8020c3:	5d                   	pop    %ebp
+  8020c4:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8020c5:	85 c0                	test   %eax,%eax
+  8020c7:	78 f4                	js     8020bd <file_stat+0xd3>
+  8020c9:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8020cc:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  8020d2:	eb e9                	jmp    8020bd <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8020d4:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8020d9:	eb e2                	jmp    8020bd <file_stat+0xd3>
+
+008020db <read_map>:
+{
+  8020db:	55                   	push   %ebp
+  8020dc:	89 e5                	mov    %esp,%ebp
+  8020de:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e4:	50                   	push   %eax
+  8020e5:	ff 75 08             	push   0x8(%ebp)
+  8020e8:	e8 7c f2 ff ff       	call   801369 <fd_lookup>
+  8020ed:	83 c4 10             	add    $0x10,%esp
+  8020f0:	85 c0                	test   %eax,%eax
+  8020f2:	78 2a                	js     80211e <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8020f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f7:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8020fd:	39 08                	cmp    %ecx,(%eax)
+  8020ff:	75 1f                	jne    802120 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802101:	8b 40 0c             	mov    0xc(%eax),%eax
+  802104:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  802109:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80210c:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802111:	8b 55 10             	mov    0x10(%ebp),%edx
+  802114:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802119:	e8 8f f8 ff ff       	call   8019ad <fsipc>
+}
+  80211e:	c9                   	leave
+  80211f:	c3                   	ret
+    return -E_INVAL;
+  802120:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802125:	eb f7                	jmp    80211e <read_map+0x43>
+
+00802127 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802127:	55                   	push   %ebp
+  802128:	89 e5                	mov    %esp,%ebp
+  80212a:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80212d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802132:	b8 08 00 00 00       	mov    $0x8,%eax
+  802137:	e8 71 f8 ff ff       	call   8019ad <fsipc>
+}
+  80213c:	c9                   	leave
+  80213d:	c3                   	ret
+
+0080213e <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  80213e:	55                   	push   %ebp
+  80213f:	89 e5                	mov    %esp,%ebp
+  802141:	57                   	push   %edi
+  802142:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802143:	8b 45 08             	mov    0x8(%ebp),%eax
+  802146:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80214b:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802152:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802155:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  80215c:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80215f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802164:	b8 09 00 00 00       	mov    $0x9,%eax
+  802169:	e8 3f f8 ff ff       	call   8019ad <fsipc>
+  80216e:	85 c0                	test   %eax,%eax
+  802170:	78 14                	js     802186 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802172:	be 00 70 80 00       	mov    $0x807000,%esi
+  802177:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80217c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80217f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802181:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802186:	5e                   	pop    %esi
+  802187:	5f                   	pop    %edi
+  802188:	5d                   	pop    %ebp
+  802189:	c3                   	ret
+
+0080218a <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  80218a:	55                   	push   %ebp
+  80218b:	89 e5                	mov    %esp,%ebp
+  80218d:	53                   	push   %ebx
+  80218e:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802191:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802194:	50                   	push   %eax
+  802195:	6a 00                	push   $0x0
+  802197:	e8 a2 ff ff ff       	call   80213e <fs_stats>
+  80219c:	83 c4 10             	add    $0x10,%esp
+  80219f:	85 c0                	test   %eax,%eax
+  8021a1:	78 28                	js     8021cb <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8021a3:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8021a6:	83 ec 08             	sub    $0x8,%esp
+  8021a9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8021ac:	50                   	push   %eax
+  8021ad:	6a 20                	push   $0x20
+  8021af:	e8 8a ff ff ff       	call   80213e <fs_stats>
+  8021b4:	83 c4 10             	add    $0x10,%esp
+  8021b7:	85 c0                	test   %eax,%eax
+  8021b9:	78 10                	js     8021cb <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8021bb:	83 ec 08             	sub    $0x8,%esp
+  8021be:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8021c1:	50                   	push   %eax
+  8021c2:	53                   	push   %ebx
+  8021c3:	e8 76 ff ff ff       	call   80213e <fs_stats>
+  8021c8:	83 c4 10             	add    $0x10,%esp
+}
+  8021cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ce:	c9                   	leave
+  8021cf:	c3                   	ret
+
+008021d0 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8021d0:	55                   	push   %ebp
+  8021d1:	89 e5                	mov    %esp,%ebp
+  8021d3:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8021d6:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8021dd:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8021e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e3:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  8021e8:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8021ef:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8021f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021fc:	e8 ac f7 ff ff       	call   8019ad <fsipc>
+}
+  802201:	c9                   	leave
+  802202:	c3                   	ret
+
+00802203 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802203:	55                   	push   %ebp
+  802204:	89 e5                	mov    %esp,%ebp
+  802206:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802209:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802210:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802213:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  80221a:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80221d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802220:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  802225:	ba 00 00 00 00       	mov    $0x0,%edx
+  80222a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80222f:	e8 79 f7 ff ff       	call   8019ad <fsipc>
+}
+  802234:	c9                   	leave
+  802235:	c3                   	ret
+
+00802236 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802236:	55                   	push   %ebp
+  802237:	89 e5                	mov    %esp,%ebp
+  802239:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80223c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80223f:	50                   	push   %eax
+  802240:	ff 75 08             	push   0x8(%ebp)
+  802243:	e8 21 f1 ff ff       	call   801369 <fd_lookup>
+  802248:	83 c4 10             	add    $0x10,%esp
+  80224b:	85 c0                	test   %eax,%eax
+  80224d:	78 34                	js     802283 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80224f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802252:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802258:	39 08                	cmp    %ecx,(%eax)
+  80225a:	75 29                	jne    802285 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80225c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80225f:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  802264:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802267:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  80226c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80226f:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802274:	ba 00 00 00 00       	mov    $0x0,%edx
+  802279:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80227e:	e8 2a f7 ff ff       	call   8019ad <fsipc>
+}
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+    return -E_INVAL;
+  802285:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80228a:	eb f7                	jmp    802283 <fallocate+0x4d>
+
+0080228c <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80228c:	55                   	push   %ebp
+  80228d:	89 e5                	mov    %esp,%ebp
+  80228f:	57                   	push   %edi
+  802290:	56                   	push   %esi
+  802291:	53                   	push   %ebx
+  802292:	83 ec 24             	sub    $0x24,%esp
+  802295:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802298:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80229b:	50                   	push   %eax
+  80229c:	ff 75 08             	push   0x8(%ebp)
+  80229f:	e8 c5 f0 ff ff       	call   801369 <fd_lookup>
+  8022a4:	83 c4 10             	add    $0x10,%esp
+  8022a7:	85 c0                	test   %eax,%eax
+  8022a9:	78 66                	js     802311 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8022ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022ae:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8022b4:	39 08                	cmp    %ecx,(%eax)
+  8022b6:	75 61                	jne    802319 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8022b8:	85 f6                	test   %esi,%esi
+  8022ba:	7e 50                	jle    80230c <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8022bc:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8022c1:	39 de                	cmp    %ebx,%esi
+  8022c3:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8022c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022cc:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  8022d1:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8022d7:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8022de:	83 ec 04             	sub    $0x4,%esp
+  8022e1:	57                   	push   %edi
+  8022e2:	ff 75 0c             	push   0xc(%ebp)
+  8022e5:	68 08 70 80 00       	push   $0x807008
+  8022ea:	e8 a8 e8 ff ff       	call   800b97 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8022ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8022f9:	e8 af f6 ff ff       	call   8019ad <fsipc>
+  8022fe:	83 c4 10             	add    $0x10,%esp
+  802301:	85 c0                	test   %eax,%eax
+  802303:	78 0c                	js     802311 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802305:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802308:	29 de                	sub    %ebx,%esi
+  80230a:	eb ac                	jmp    8022b8 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80230c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802311:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802314:	5b                   	pop    %ebx
+  802315:	5e                   	pop    %esi
+  802316:	5f                   	pop    %edi
+  802317:	5d                   	pop    %ebp
+  802318:	c3                   	ret
+    return -E_INVAL;
+  802319:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80231e:	eb f1                	jmp    802311 <prefetch+0x85>
+
+00802320 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802320:	55                   	push   %ebp
+  802321:	89 e5                	mov    %esp,%ebp
+  802323:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802326:	50                   	push   %eax
+  802327:	e8 d3 ef ff ff       	call   8012ff <fd2data>
+  80232c:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802331:	c9                   	leave
+  802332:	c3                   	ret
+
+00802333 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802333:	55                   	push   %ebp
+  802334:	89 e5                	mov    %esp,%ebp
+  802336:	56                   	push   %esi
+  802337:	53                   	push   %ebx
+  802338:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80233b:	83 ec 0c             	sub    $0xc,%esp
+  80233e:	ff 75 08             	push   0x8(%ebp)
+  802341:	e8 b9 ef ff ff       	call   8012ff <fd2data>
+  802346:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802348:	83 c4 08             	add    $0x8,%esp
+  80234b:	68 28 36 80 00       	push   $0x803628
+  802350:	53                   	push   %ebx
+  802351:	e8 bb e6 ff ff       	call   800a11 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802356:	8b 46 04             	mov    0x4(%esi),%eax
+  802359:	2b 06                	sub    (%esi),%eax
+  80235b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802361:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802368:	00 00 00 
+  stat->st_dev = &devpipe;
+  80236b:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802372:	40 80 00 
+  return 0;
+}
+  802375:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80237d:	5b                   	pop    %ebx
+  80237e:	5e                   	pop    %esi
+  80237f:	5d                   	pop    %ebp
+  802380:	c3                   	ret
+
+00802381 <pipe_wakeup>:
+{
+  802381:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802383:	b8 00 00 00 00       	mov    $0x0,%eax
+  802388:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80238b:	85 c0                	test   %eax,%eax
+  80238d:	75 01                	jne    802390 <pipe_wakeup+0xf>
+  80238f:	c3                   	ret
+{
+  802390:	55                   	push   %ebp
+  802391:	89 e5                	mov    %esp,%ebp
+  802393:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802396:	6a 00                	push   $0x0
+  802398:	68 00 00 c0 ee       	push   $0xeec00000
+  80239d:	52                   	push   %edx
+  80239e:	e8 f9 ed ff ff       	call   80119c <sys_chan_wakeup>
+  8023a3:	83 c4 10             	add    $0x10,%esp
+}
+  8023a6:	c9                   	leave
+  8023a7:	c3                   	ret
+
+008023a8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8023a8:	55                   	push   %ebp
+  8023a9:	89 e5                	mov    %esp,%ebp
+  8023ab:	57                   	push   %edi
+  8023ac:	56                   	push   %esi
+  8023ad:	53                   	push   %ebx
+  8023ae:	83 ec 18             	sub    $0x18,%esp
+  8023b1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8023b4:	57                   	push   %edi
+  8023b5:	e8 45 ef ff ff       	call   8012ff <fd2data>
+  8023ba:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8023bc:	83 c4 10             	add    $0x10,%esp
+  8023bf:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8023c3:	74 2a                	je     8023ef <devpipe_close+0x47>
+  8023c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8023ca:	89 f8                	mov    %edi,%eax
+  8023cc:	e8 4f ff ff ff       	call   802320 <pipe_ring>
+  8023d1:	83 ec 08             	sub    $0x8,%esp
+  8023d4:	01 d8                	add    %ebx,%eax
+  8023d6:	50                   	push   %eax
+  8023d7:	6a 00                	push   $0x0
+  8023d9:	e8 e7 ea ff ff       	call   800ec5 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8023de:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8023e4:	83 c4 10             	add    $0x10,%esp
+  8023e7:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8023ed:	75 db                	jne    8023ca <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8023ef:	83 ec 08             	sub    $0x8,%esp
+  8023f2:	57                   	push   %edi
+  8023f3:	6a 00                	push   $0x0
+  8023f5:	e8 cb ea ff ff       	call   800ec5 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8023fa:	83 c4 10             	add    $0x10,%esp
+  8023fd:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802401:	75 13                	jne    802416 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802403:	83 ec 08             	sub    $0x8,%esp
+  802406:	56                   	push   %esi
+  802407:	6a 00                	push   $0x0
+  802409:	e8 b7 ea ff ff       	call   800ec5 <sys_page_unmap>
+}
+  80240e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802411:	5b                   	pop    %ebx
+  802412:	5e                   	pop    %esi
+  802413:	5f                   	pop    %edi
+  802414:	5d                   	pop    %ebp
+  802415:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802416:	8d 56 04             	lea    0x4(%esi),%edx
+  802419:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80241c:	e8 60 ff ff ff       	call   802381 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802421:	8d 46 30             	lea    0x30(%esi),%eax
+  802424:	89 f2                	mov    %esi,%edx
+  802426:	e8 56 ff ff ff       	call   802381 <pipe_wakeup>
+  80242b:	eb d6                	jmp    802403 <devpipe_close+0x5b>
+
+0080242d <_pipeisclosed>:
+{
+  80242d:	55                   	push   %ebp
+  80242e:	89 e5                	mov    %esp,%ebp
+  802430:	57                   	push   %edi
+  802431:	56                   	push   %esi
+  802432:	53                   	push   %ebx
+  802433:	83 ec 1c             	sub    $0x1c,%esp
+  802436:	89 c7                	mov    %eax,%edi
+  802438:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80243a:	a1 44 67 80 00       	mov    0x806744,%eax
+  80243f:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802442:	83 ec 0c             	sub    $0xc,%esp
+  802445:	57                   	push   %edi
+  802446:	e8 18 0a 00 00       	call   802e63 <pageref>
+  80244b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80244e:	89 34 24             	mov    %esi,(%esp)
+  802451:	e8 0d 0a 00 00       	call   802e63 <pageref>
+    nn = thisenv->env_runs;
+  802456:	8b 15 44 67 80 00    	mov    0x806744,%edx
+  80245c:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  80245f:	83 c4 10             	add    $0x10,%esp
+  802462:	39 cb                	cmp    %ecx,%ebx
+  802464:	74 1b                	je     802481 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802466:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802469:	75 cf                	jne    80243a <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80246b:	8b 42 58             	mov    0x58(%edx),%eax
+  80246e:	6a 01                	push   $0x1
+  802470:	50                   	push   %eax
+  802471:	53                   	push   %ebx
+  802472:	68 2f 36 80 00       	push   $0x80362f
+  802477:	e8 a7 df ff ff       	call   800423 <cprintf>
+  80247c:	83 c4 10             	add    $0x10,%esp
+  80247f:	eb b9                	jmp    80243a <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802481:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802484:	0f 94 c0             	sete   %al
+  802487:	0f b6 c0             	movzbl %al,%eax
+}
+  80248a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80248d:	5b                   	pop    %ebx
+  80248e:	5e                   	pop    %esi
+  80248f:	5f                   	pop    %edi
+  802490:	5d                   	pop    %ebp
+  802491:	c3                   	ret
+
+00802492 <devpipe_write_bulk>:
+{
+  802492:	55                   	push   %ebp
+  802493:	89 e5                	mov    %esp,%ebp
+  802495:	57                   	push   %edi
+  802496:	56                   	push   %esi
+  802497:	53                   	push   %ebx
+  802498:	83 ec 1c             	sub    $0x1c,%esp
+  80249b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80249e:	89 d6                	mov    %edx,%esi
+  8024a0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8024a3:	e8 78 fe ff ff       	call   802320 <pipe_ring>
+  8024a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8024ab:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8024b0:	8d 46 04             	lea    0x4(%esi),%eax
+  8024b3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8024b6:	eb 75                	jmp    80252d <devpipe_write_bulk+0x9b>
+  8024b8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024bd:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8024c1:	6a 64                	push   $0x64
+  8024c3:	68 00 00 c0 ee       	push   $0xeec00000
+  8024c8:	53                   	push   %ebx
+  8024c9:	56                   	push   %esi
+  8024ca:	e8 aa ec ff ff       	call   801179 <sys_chan_sleep>
+      continue;
+  8024cf:	83 c4 10             	add    $0x10,%esp
+  8024d2:	eb 59                	jmp    80252d <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8024d4:	89 d1                	mov    %edx,%ecx
+  8024d6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8024d9:	c1 e9 11             	shr    $0x11,%ecx
+  8024dc:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8024df:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8024e4:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  8024e6:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8024ec:	29 d3                	sub    %edx,%ebx
+  8024ee:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8024f3:	29 c2                	sub    %eax,%edx
+  8024f5:	39 d3                	cmp    %edx,%ebx
+  8024f7:	0f 47 da             	cmova  %edx,%ebx
+  8024fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024fd:	29 fa                	sub    %edi,%edx
+  8024ff:	39 d3                	cmp    %edx,%ebx
+  802501:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802504:	83 ec 04             	sub    $0x4,%esp
+  802507:	53                   	push   %ebx
+  802508:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80250b:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  80250e:	52                   	push   %edx
+  80250f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802512:	01 c8                	add    %ecx,%eax
+  802514:	50                   	push   %eax
+  802515:	e8 df e6 ff ff       	call   800bf9 <memcpy>
+    i += m;
+  80251a:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  80251c:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80251f:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802522:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802525:	e8 57 fe ff ff       	call   802381 <pipe_wakeup>
+  80252a:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  80252d:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802530:	73 2b                	jae    80255d <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802532:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802534:	8b 56 04             	mov    0x4(%esi),%edx
+  802537:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  80253d:	39 d0                	cmp    %edx,%eax
+  80253f:	7d 93                	jge    8024d4 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802541:	89 f2                	mov    %esi,%edx
+  802543:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802546:	e8 e2 fe ff ff       	call   80242d <_pipeisclosed>
+  80254b:	85 c0                	test   %eax,%eax
+  80254d:	0f 84 65 ff ff ff    	je     8024b8 <devpipe_write_bulk+0x26>
+        return i;
+  802553:	89 f8                	mov    %edi,%eax
+}
+  802555:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802558:	5b                   	pop    %ebx
+  802559:	5e                   	pop    %esi
+  80255a:	5f                   	pop    %edi
+  80255b:	5d                   	pop    %ebp
+  80255c:	c3                   	ret
+  return i;
+  80255d:	89 f8                	mov    %edi,%eax
+  80255f:	eb f4                	jmp    802555 <devpipe_write_bulk+0xc3>
+
+00802561 <devpipe_write>:
+{
+  802561:	55                   	push   %ebp
+  802562:	89 e5                	mov    %esp,%ebp
+  802564:	57                   	push   %edi
+  802565:	56                   	push   %esi
+  802566:	53                   	push   %ebx
+  802567:	83 ec 28             	sub    $0x28,%esp
+  80256a:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  80256d:	56                   	push   %esi
+  80256e:	e8 8c ed ff ff       	call   8012ff <fd2data>
+  802573:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802575:	8b 78 28             	mov    0x28(%eax),%edi
+  802578:	83 c4 10             	add    $0x10,%esp
+  80257b:	85 ff                	test   %edi,%edi
+  80257d:	75 25                	jne    8025a4 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  80257f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802582:	74 66                	je     8025ea <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802584:	8b 43 04             	mov    0x4(%ebx),%eax
+  802587:	8b 0b                	mov    (%ebx),%ecx
+  802589:	8d 51 20             	lea    0x20(%ecx),%edx
+  80258c:	39 d0                	cmp    %edx,%eax
+  80258e:	72 2b                	jb     8025bb <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802590:	89 da                	mov    %ebx,%edx
+  802592:	89 f0                	mov    %esi,%eax
+  802594:	e8 94 fe ff ff       	call   80242d <_pipeisclosed>
+  802599:	85 c0                	test   %eax,%eax
+  80259b:	75 51                	jne    8025ee <devpipe_write+0x8d>
+      sys_yield();
+  80259d:	e8 3c e8 ff ff       	call   800dde <sys_yield>
+  8025a2:	eb e0                	jmp    802584 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8025a4:	83 ec 0c             	sub    $0xc,%esp
+  8025a7:	ff 75 10             	push   0x10(%ebp)
+  8025aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025ad:	89 c2                	mov    %eax,%edx
+  8025af:	89 f0                	mov    %esi,%eax
+  8025b1:	e8 dc fe ff ff       	call   802492 <devpipe_write_bulk>
+  8025b6:	83 c4 10             	add    $0x10,%esp
+  8025b9:	eb 38                	jmp    8025f3 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025be:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8025c2:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8025c5:	89 c2                	mov    %eax,%edx
+  8025c7:	c1 fa 1f             	sar    $0x1f,%edx
+  8025ca:	89 d1                	mov    %edx,%ecx
+  8025cc:	c1 e9 1b             	shr    $0x1b,%ecx
+  8025cf:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025d2:	83 e2 1f             	and    $0x1f,%edx
+  8025d5:	29 ca                	sub    %ecx,%edx
+  8025d7:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8025db:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  8025df:	83 c0 01             	add    $0x1,%eax
+  8025e2:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  8025e5:	83 c7 01             	add    $0x1,%edi
+  8025e8:	eb 95                	jmp    80257f <devpipe_write+0x1e>
+  return i;
+  8025ea:	89 f8                	mov    %edi,%eax
+  8025ec:	eb 05                	jmp    8025f3 <devpipe_write+0x92>
+        return 0;
+  8025ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025f6:	5b                   	pop    %ebx
+  8025f7:	5e                   	pop    %esi
+  8025f8:	5f                   	pop    %edi
+  8025f9:	5d                   	pop    %ebp
+  8025fa:	c3                   	ret
+
+008025fb <devpipe_read_bulk>:
+{
+  8025fb:	55                   	push   %ebp
+  8025fc:	89 e5                	mov    %esp,%ebp
+  8025fe:	57                   	push   %edi
+  8025ff:	56                   	push   %esi
+  802600:	53                   	push   %ebx
+  802601:	83 ec 2c             	sub    $0x2c,%esp
+  802604:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802607:	89 d6                	mov    %edx,%esi
+  802609:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80260c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  80260f:	e8 0c fd ff ff       	call   802320 <pipe_ring>
+  802614:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802617:	85 db                	test   %ebx,%ebx
+  802619:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80261e:	0f 45 c3             	cmovne %ebx,%eax
+  802621:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802624:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802629:	8d 46 30             	lea    0x30(%esi),%eax
+  80262c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80262f:	eb 50                	jmp    802681 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802631:	89 d1                	mov    %edx,%ecx
+  802633:	c1 f9 1f             	sar    $0x1f,%ecx
+  802636:	c1 e9 11             	shr    $0x11,%ecx
+  802639:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80263c:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802641:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802643:	29 d3                	sub    %edx,%ebx
+  802645:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80264a:	29 c2                	sub    %eax,%edx
+  80264c:	39 d3                	cmp    %edx,%ebx
+  80264e:	0f 47 da             	cmova  %edx,%ebx
+  802651:	8b 55 08             	mov    0x8(%ebp),%edx
+  802654:	29 fa                	sub    %edi,%edx
+  802656:	39 d3                	cmp    %edx,%ebx
+  802658:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  80265b:	83 ec 04             	sub    $0x4,%esp
+  80265e:	53                   	push   %ebx
+  80265f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802662:	01 c8                	add    %ecx,%eax
+  802664:	50                   	push   %eax
+  802665:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802668:	01 f8                	add    %edi,%eax
+  80266a:	50                   	push   %eax
+  80266b:	e8 89 e5 ff ff       	call   800bf9 <memcpy>
+    i += m;
+  802670:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802672:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802674:	89 f2                	mov    %esi,%edx
+  802676:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802679:	e8 03 fd ff ff       	call   802381 <pipe_wakeup>
+  80267e:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802681:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802684:	73 51                	jae    8026d7 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802686:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802689:	8b 16                	mov    (%esi),%edx
+  80268b:	39 da                	cmp    %ebx,%edx
+  80268d:	75 a2                	jne    802631 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  80268f:	85 ff                	test   %edi,%edi
+  802691:	75 44                	jne    8026d7 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802693:	89 f2                	mov    %esi,%edx
+  802695:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802698:	e8 90 fd ff ff       	call   80242d <_pipeisclosed>
+  80269d:	85 c0                	test   %eax,%eax
+  80269f:	75 3a                	jne    8026db <devpipe_read_bulk+0xe0>
+  8026a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026a6:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8026aa:	6a 64                	push   $0x64
+  8026ac:	ff 75 d4             	push   -0x2c(%ebp)
+  8026af:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8026b0:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8026b3:	50                   	push   %eax
+  8026b4:	e8 c0 ea ff ff       	call   801179 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8026b9:	85 c0                	test   %eax,%eax
+  8026bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026c0:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  8026c3:	83 c4 10             	add    $0x10,%esp
+  8026c6:	a8 01                	test   $0x1,%al
+  8026c8:	74 b7                	je     802681 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  8026ca:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  8026cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026d2:	5b                   	pop    %ebx
+  8026d3:	5e                   	pop    %esi
+  8026d4:	5f                   	pop    %edi
+  8026d5:	5d                   	pop    %ebp
+  8026d6:	c3                   	ret
+  return i;
+  8026d7:	89 f8                	mov    %edi,%eax
+  8026d9:	eb f4                	jmp    8026cf <devpipe_read_bulk+0xd4>
+        return 0;
+  8026db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026e0:	eb ed                	jmp    8026cf <devpipe_read_bulk+0xd4>
+
+008026e2 <devpipe_read>:
+{
+  8026e2:	55                   	push   %ebp
+  8026e3:	89 e5                	mov    %esp,%ebp
+  8026e5:	57                   	push   %edi
+  8026e6:	56                   	push   %esi
+  8026e7:	53                   	push   %ebx
+  8026e8:	83 ec 18             	sub    $0x18,%esp
+  8026eb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  8026ee:	57                   	push   %edi
+  8026ef:	e8 0b ec ff ff       	call   8012ff <fd2data>
+  8026f4:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8026f6:	8b 70 28             	mov    0x28(%eax),%esi
+  8026f9:	83 c4 10             	add    $0x10,%esp
+  8026fc:	85 f6                	test   %esi,%esi
+  8026fe:	75 24                	jne    802724 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802700:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802703:	74 60                	je     802765 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802705:	8b 03                	mov    (%ebx),%eax
+  802707:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80270a:	75 3b                	jne    802747 <devpipe_read+0x65>
+      if (i > 0)
+  80270c:	85 f6                	test   %esi,%esi
+  80270e:	75 2d                	jne    80273d <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802710:	89 da                	mov    %ebx,%edx
+  802712:	89 f8                	mov    %edi,%eax
+  802714:	e8 14 fd ff ff       	call   80242d <_pipeisclosed>
+  802719:	85 c0                	test   %eax,%eax
+  80271b:	75 4c                	jne    802769 <devpipe_read+0x87>
+      sys_yield();
+  80271d:	e8 bc e6 ff ff       	call   800dde <sys_yield>
+  802722:	eb e1                	jmp    802705 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802724:	83 ec 08             	sub    $0x8,%esp
+  802727:	6a 00                	push   $0x0
+  802729:	ff 75 10             	push   0x10(%ebp)
+  80272c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80272f:	89 c2                	mov    %eax,%edx
+  802731:	89 f8                	mov    %edi,%eax
+  802733:	e8 c3 fe ff ff       	call   8025fb <devpipe_read_bulk>
+  802738:	83 c4 10             	add    $0x10,%esp
+  80273b:	eb 02                	jmp    80273f <devpipe_read+0x5d>
+        return i;
+  80273d:	89 f0                	mov    %esi,%eax
+}
+  80273f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802742:	5b                   	pop    %ebx
+  802743:	5e                   	pop    %esi
+  802744:	5f                   	pop    %edi
+  802745:	5d                   	pop    %ebp
+  802746:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802747:	99                   	cltd
+  802748:	c1 ea 1b             	shr    $0x1b,%edx
+  80274b:	01 d0                	add    %edx,%eax
+  80274d:	83 e0 1f             	and    $0x1f,%eax
+  802750:	29 d0                	sub    %edx,%eax
+  802752:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802757:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80275a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  80275d:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802760:	83 c6 01             	add    $0x1,%esi
+  802763:	eb 9b                	jmp    802700 <devpipe_read+0x1e>
+  return i;
+  802765:	89 f0                	mov    %esi,%eax
+  802767:	eb d6                	jmp    80273f <devpipe_read+0x5d>
+        return 0;
+  802769:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276e:	eb cf                	jmp    80273f <devpipe_read+0x5d>
+
+00802770 <pipe2>:
+{
+  802770:	55                   	push   %ebp
+  802771:	89 e5                	mov    %esp,%ebp
+  802773:	57                   	push   %edi
+  802774:	56                   	push   %esi
+  802775:	53                   	push   %ebx
+  802776:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802779:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80277c:	50                   	push   %eax
+  80277d:	e8 91 eb ff ff       	call   801313 <fd_alloc>
+  802782:	89 c3                	mov    %eax,%ebx
+  802784:	83 c4 10             	add    $0x10,%esp
+  802787:	85 c0                	test   %eax,%eax
+  802789:	0f 88 fb 01 00 00    	js     80298a <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80278f:	83 ec 04             	sub    $0x4,%esp
+  802792:	68 07 04 00 00       	push   $0x407
+  802797:	ff 75 e4             	push   -0x1c(%ebp)
+  80279a:	6a 00                	push   $0x0
+  80279c:	e8 9f e6 ff ff       	call   800e40 <sys_page_alloc>
+  8027a1:	89 c3                	mov    %eax,%ebx
+  8027a3:	83 c4 10             	add    $0x10,%esp
+  8027a6:	85 c0                	test   %eax,%eax
+  8027a8:	0f 88 dc 01 00 00    	js     80298a <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  8027ae:	83 ec 0c             	sub    $0xc,%esp
+  8027b1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8027b4:	50                   	push   %eax
+  8027b5:	e8 59 eb ff ff       	call   801313 <fd_alloc>
+  8027ba:	89 c3                	mov    %eax,%ebx
+  8027bc:	83 c4 10             	add    $0x10,%esp
+  8027bf:	85 c0                	test   %eax,%eax
+  8027c1:	0f 88 b3 01 00 00    	js     80297a <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027c7:	83 ec 04             	sub    $0x4,%esp
+  8027ca:	68 07 04 00 00       	push   $0x407
+  8027cf:	ff 75 e0             	push   -0x20(%ebp)
+  8027d2:	6a 00                	push   $0x0
+  8027d4:	e8 67 e6 ff ff       	call   800e40 <sys_page_alloc>
+  8027d9:	89 c3                	mov    %eax,%ebx
+  8027db:	83 c4 10             	add    $0x10,%esp
+  8027de:	85 c0                	test   %eax,%eax
+  8027e0:	0f 88 94 01 00 00    	js     80297a <pipe2+0x20a>
+  va = fd2data(fd0);
+  8027e6:	83 ec 0c             	sub    $0xc,%esp
+  8027e9:	ff 75 e4             	push   -0x1c(%ebp)
+  8027ec:	e8 0e eb ff ff       	call   8012ff <fd2data>
+  8027f1:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027f3:	83 c4 0c             	add    $0xc,%esp
+  8027f6:	68 07 04 00 00       	push   $0x407
+  8027fb:	50                   	push   %eax
+  8027fc:	6a 00                	push   $0x0
+  8027fe:	e8 3d e6 ff ff       	call   800e40 <sys_page_alloc>
+  802803:	89 c3                	mov    %eax,%ebx
+  802805:	83 c4 10             	add    $0x10,%esp
+  802808:	85 c0                	test   %eax,%eax
+  80280a:	0f 88 5a 01 00 00    	js     80296a <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802810:	83 ec 0c             	sub    $0xc,%esp
+  802813:	ff 75 e0             	push   -0x20(%ebp)
+  802816:	e8 e4 ea ff ff       	call   8012ff <fd2data>
+  80281b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802822:	50                   	push   %eax
+  802823:	6a 00                	push   $0x0
+  802825:	57                   	push   %edi
+  802826:	6a 00                	push   $0x0
+  802828:	e8 56 e6 ff ff       	call   800e83 <sys_page_map>
+  80282d:	89 c3                	mov    %eax,%ebx
+  80282f:	83 c4 20             	add    $0x20,%esp
+  802832:	85 c0                	test   %eax,%eax
+  802834:	0f 88 22 01 00 00    	js     80295c <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  80283a:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  80283e:	74 72                	je     8028b2 <pipe2+0x142>
+  802840:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802845:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802848:	e8 d3 fa ff ff       	call   802320 <pipe_ring>
+  80284d:	83 ec 04             	sub    $0x4,%esp
+  802850:	68 07 04 00 00       	push   $0x407
+  802855:	01 f0                	add    %esi,%eax
+  802857:	50                   	push   %eax
+  802858:	6a 00                	push   $0x0
+  80285a:	e8 e1 e5 ff ff       	call   800e40 <sys_page_alloc>
+  80285f:	89 c3                	mov    %eax,%ebx
+  802861:	83 c4 10             	add    $0x10,%esp
+  802864:	85 c0                	test   %eax,%eax
+  802866:	0f 88 97 00 00 00    	js     802903 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  80286c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80286f:	e8 ac fa ff ff       	call   802320 <pipe_ring>
+  802874:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802877:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80287a:	e8 a1 fa ff ff       	call   802320 <pipe_ring>
+  80287f:	83 ec 0c             	sub    $0xc,%esp
+  802882:	68 07 04 00 00       	push   $0x407
+  802887:	53                   	push   %ebx
+  802888:	6a 00                	push   $0x0
+  80288a:	01 f0                	add    %esi,%eax
+  80288c:	50                   	push   %eax
+  80288d:	6a 00                	push   $0x0
+  80288f:	e8 ef e5 ff ff       	call   800e83 <sys_page_map>
+  802894:	89 c3                	mov    %eax,%ebx
+  802896:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80289c:	83 c4 20             	add    $0x20,%esp
+  80289f:	85 c0                	test   %eax,%eax
+  8028a1:	78 60                	js     802903 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8028a3:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8028a9:	75 9a                	jne    802845 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  8028ab:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  8028b2:	a1 20 40 80 00       	mov    0x804020,%eax
+  8028b7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028ba:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  8028bc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028bf:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  8028c6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8028c9:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  8028cb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028ce:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  8028d5:	83 ec 0c             	sub    $0xc,%esp
+  8028d8:	ff 75 e4             	push   -0x1c(%ebp)
+  8028db:	e8 0f ea ff ff       	call   8012ef <fd2num>
+  8028e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028e3:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  8028e5:	83 c4 04             	add    $0x4,%esp
+  8028e8:	ff 75 e0             	push   -0x20(%ebp)
+  8028eb:	e8 ff e9 ff ff       	call   8012ef <fd2num>
+  8028f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028f3:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  8028f6:	83 c4 10             	add    $0x10,%esp
+  8028f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028fe:	e9 87 00 00 00       	jmp    80298a <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802903:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802908:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80290b:	e8 10 fa ff ff       	call   802320 <pipe_ring>
+  802910:	83 ec 08             	sub    $0x8,%esp
+  802913:	01 f0                	add    %esi,%eax
+  802915:	50                   	push   %eax
+  802916:	6a 00                	push   $0x0
+  802918:	e8 a8 e5 ff ff       	call   800ec5 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  80291d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802920:	e8 fb f9 ff ff       	call   802320 <pipe_ring>
+  802925:	83 c4 08             	add    $0x8,%esp
+  802928:	01 f0                	add    %esi,%eax
+  80292a:	50                   	push   %eax
+  80292b:	6a 00                	push   $0x0
+  80292d:	e8 93 e5 ff ff       	call   800ec5 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802932:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802938:	83 c4 10             	add    $0x10,%esp
+  80293b:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802941:	75 c5                	jne    802908 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802943:	83 ec 0c             	sub    $0xc,%esp
+  802946:	ff 75 e0             	push   -0x20(%ebp)
+  802949:	e8 b1 e9 ff ff       	call   8012ff <fd2data>
+  80294e:	83 c4 08             	add    $0x8,%esp
+  802951:	50                   	push   %eax
+  802952:	6a 00                	push   $0x0
+  802954:	e8 6c e5 ff ff       	call   800ec5 <sys_page_unmap>
+  802959:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  80295c:	83 ec 08             	sub    $0x8,%esp
+  80295f:	57                   	push   %edi
+  802960:	6a 00                	push   $0x0
+  802962:	e8 5e e5 ff ff       	call   800ec5 <sys_page_unmap>
+  802967:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  80296a:	83 ec 08             	sub    $0x8,%esp
+  80296d:	ff 75 e0             	push   -0x20(%ebp)
+  802970:	6a 00                	push   $0x0
+  802972:	e8 4e e5 ff ff       	call   800ec5 <sys_page_unmap>
+  802977:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  80297a:	83 ec 08             	sub    $0x8,%esp
+  80297d:	ff 75 e4             	push   -0x1c(%ebp)
+  802980:	6a 00                	push   $0x0
+  802982:	e8 3e e5 ff ff       	call   800ec5 <sys_page_unmap>
+  802987:	83 c4 10             	add    $0x10,%esp
+}
+  80298a:	89 d8                	mov    %ebx,%eax
+  80298c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80298f:	5b                   	pop    %ebx
+  802990:	5e                   	pop    %esi
+  802991:	5f                   	pop    %edi
+  802992:	5d                   	pop    %ebp
+  802993:	c3                   	ret
+
+00802994 <pipe>:
+{
+  802994:	55                   	push   %ebp
+  802995:	89 e5                	mov    %esp,%ebp
+  802997:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  80299a:	6a 00                	push   $0x0
+  80299c:	ff 75 08             	push   0x8(%ebp)
+  80299f:	e8 cc fd ff ff       	call   802770 <pipe2>
+}
+  8029a4:	c9                   	leave
+  8029a5:	c3                   	ret
+
+008029a6 <pipeisclosed>:
+{
+  8029a6:	55                   	push   %ebp
+  8029a7:	89 e5                	mov    %esp,%ebp
+  8029a9:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029af:	50                   	push   %eax
+  8029b0:	ff 75 08             	push   0x8(%ebp)
+  8029b3:	e8 b1 e9 ff ff       	call   801369 <fd_lookup>
+  8029b8:	83 c4 10             	add    $0x10,%esp
+  8029bb:	85 c0                	test   %eax,%eax
+  8029bd:	78 18                	js     8029d7 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  8029bf:	83 ec 0c             	sub    $0xc,%esp
+  8029c2:	ff 75 f4             	push   -0xc(%ebp)
+  8029c5:	e8 35 e9 ff ff       	call   8012ff <fd2data>
+  8029ca:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  8029cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029cf:	e8 59 fa ff ff       	call   80242d <_pipeisclosed>
+  8029d4:	83 c4 10             	add    $0x10,%esp
+}
+  8029d7:	c9                   	leave
+  8029d8:	c3                   	ret
+
+008029d9 <pipe_splice>:
+{
+  8029d9:	55                   	push   %ebp
+  8029da:	89 e5                	mov    %esp,%ebp
+  8029dc:	57                   	push   %edi
+  8029dd:	56                   	push   %esi
+  8029de:	53                   	push   %ebx
+  8029df:	83 ec 34             	sub    $0x34,%esp
+  8029e2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029e5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8029e8:	50                   	push   %eax
+  8029e9:	ff 75 08             	push   0x8(%ebp)
+  8029ec:	e8 78 e9 ff ff       	call   801369 <fd_lookup>
+  8029f1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8029f4:	83 c4 10             	add    $0x10,%esp
+  8029f7:	85 c0                	test   %eax,%eax
+  8029f9:	0f 88 d7 00 00 00    	js     802ad6 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  8029ff:	83 ec 0c             	sub    $0xc,%esp
+  802a02:	ff 75 e4             	push   -0x1c(%ebp)
+  802a05:	e8 f5 e8 ff ff       	call   8012ff <fd2data>
+  802a0a:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802a0c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a0f:	83 c4 10             	add    $0x10,%esp
+  802a12:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802a18:	39 10                	cmp    %edx,(%eax)
+  802a1a:	0f 85 c1 00 00 00    	jne    802ae1 <pipe_splice+0x108>
+  802a20:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802a24:	0f 84 c0 00 00 00    	je     802aea <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802a2a:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802a2e:	0f 84 bf 00 00 00    	je     802af3 <pipe_splice+0x11a>
+  802a34:	89 f7                	mov    %esi,%edi
+  802a36:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802a3c:	0f 85 ba 00 00 00    	jne    802afc <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802a42:	8d 43 04             	lea    0x4(%ebx),%eax
+  802a45:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802a48:	eb 38                	jmp    802a82 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802a4a:	83 ec 0c             	sub    $0xc,%esp
+  802a4d:	68 00 10 00 00       	push   $0x1000
+  802a52:	89 f1                	mov    %esi,%ecx
+  802a54:	89 da                	mov    %ebx,%edx
+  802a56:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a59:	e8 34 fa ff ff       	call   802492 <devpipe_write_bulk>
+  802a5e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a61:	83 c4 10             	add    $0x10,%esp
+  802a64:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802a69:	75 53                	jne    802abe <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802a6b:	83 ec 08             	sub    $0x8,%esp
+  802a6e:	56                   	push   %esi
+  802a6f:	6a 00                	push   $0x0
+  802a71:	e8 4f e4 ff ff       	call   800ec5 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802a76:	83 c7 01             	add    $0x1,%edi
+  802a79:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802a7f:	83 c4 10             	add    $0x10,%esp
+  802a82:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802a85:	74 3a                	je     802ac1 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802a87:	8b 03                	mov    (%ebx),%eax
+  802a89:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802a8c:	75 bc                	jne    802a4a <pipe_splice+0x71>
+  802a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a93:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802a97:	85 c0                	test   %eax,%eax
+  802a99:	74 af                	je     802a4a <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802a9b:	83 ec 04             	sub    $0x4,%esp
+  802a9e:	6a 07                	push   $0x7
+  802aa0:	56                   	push   %esi
+  802aa1:	ff 75 d0             	push   -0x30(%ebp)
+  802aa4:	e8 f3 e6 ff ff       	call   80119c <sys_chan_wakeup>
+  802aa9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802aac:	83 c4 10             	add    $0x10,%esp
+  802aaf:	85 c0                	test   %eax,%eax
+  802ab1:	79 b8                	jns    802a6b <pipe_splice+0x92>
+  802ab3:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ab8:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802abc:	eb 8c                	jmp    802a4a <pipe_splice+0x71>
+  802abe:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802ac1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ac5:	75 06                	jne    802acd <pipe_splice+0xf4>
+  802ac7:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802acb:	78 09                	js     802ad6 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802acd:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ad0:	c1 e0 0c             	shl    $0xc,%eax
+  802ad3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802ad6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802ad9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802adc:	5b                   	pop    %ebx
+  802add:	5e                   	pop    %esi
+  802ade:	5f                   	pop    %edi
+  802adf:	5d                   	pop    %ebp
+  802ae0:	c3                   	ret
+    return -E_INVAL;
+  802ae1:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ae8:	eb ec                	jmp    802ad6 <pipe_splice+0xfd>
+  802aea:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802af1:	eb e3                	jmp    802ad6 <pipe_splice+0xfd>
+  802af3:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802afa:	eb da                	jmp    802ad6 <pipe_splice+0xfd>
+  802afc:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b03:	eb d1                	jmp    802ad6 <pipe_splice+0xfd>
+
+00802b05 <pipe_splice_read>:
+{
+  802b05:	55                   	push   %ebp
+  802b06:	89 e5                	mov    %esp,%ebp
+  802b08:	53                   	push   %ebx
+  802b09:	83 ec 1c             	sub    $0x1c,%esp
+  802b0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b12:	50                   	push   %eax
+  802b13:	ff 75 08             	push   0x8(%ebp)
+  802b16:	e8 4e e8 ff ff       	call   801369 <fd_lookup>
+  802b1b:	83 c4 10             	add    $0x10,%esp
+  802b1e:	85 c0                	test   %eax,%eax
+  802b20:	78 49                	js     802b6b <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802b22:	83 ec 0c             	sub    $0xc,%esp
+  802b25:	ff 75 f4             	push   -0xc(%ebp)
+  802b28:	e8 d2 e7 ff ff       	call   8012ff <fd2data>
+  802b2d:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802b2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b32:	83 c4 10             	add    $0x10,%esp
+  802b35:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802b3b:	39 08                	cmp    %ecx,(%eax)
+  802b3d:	75 31                	jne    802b70 <pipe_splice_read+0x6b>
+  802b3f:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802b43:	74 32                	je     802b77 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802b45:	8b 48 08             	mov    0x8(%eax),%ecx
+  802b48:	83 e1 03             	and    $0x3,%ecx
+  802b4b:	83 f9 01             	cmp    $0x1,%ecx
+  802b4e:	74 2e                	je     802b7e <pipe_splice_read+0x79>
+  802b50:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802b56:	75 2d                	jne    802b85 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802b58:	83 ec 08             	sub    $0x8,%esp
+  802b5b:	53                   	push   %ebx
+  802b5c:	68 00 10 00 00       	push   $0x1000
+  802b61:	89 d9                	mov    %ebx,%ecx
+  802b63:	e8 93 fa ff ff       	call   8025fb <devpipe_read_bulk>
+  802b68:	83 c4 10             	add    $0x10,%esp
+}
+  802b6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b6e:	c9                   	leave
+  802b6f:	c3                   	ret
+    return -E_INVAL;
+  802b70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b75:	eb f4                	jmp    802b6b <pipe_splice_read+0x66>
+  802b77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b7c:	eb ed                	jmp    802b6b <pipe_splice_read+0x66>
+  802b7e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b83:	eb e6                	jmp    802b6b <pipe_splice_read+0x66>
+  802b85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b8a:	eb df                	jmp    802b6b <pipe_splice_read+0x66>
+
+00802b8c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b91:	c3                   	ret
+
+00802b92 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b92:	55                   	push   %ebp
+  802b93:	89 e5                	mov    %esp,%ebp
+  802b95:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802b98:	68 47 36 80 00       	push   $0x803647
+  802b9d:	ff 75 0c             	push   0xc(%ebp)
+  802ba0:	e8 6c de ff ff       	call   800a11 <strcpy>
+  return 0;
+}
+  802ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802baa:	c9                   	leave
+  802bab:	c3                   	ret
+
+00802bac <devcons_write>:
+{
+  802bac:	55                   	push   %ebp
+  802bad:	89 e5                	mov    %esp,%ebp
+  802baf:	57                   	push   %edi
+  802bb0:	56                   	push   %esi
+  802bb1:	53                   	push   %ebx
+  802bb2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802bb8:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802bbd:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802bc3:	eb 2e                	jmp    802bf3 <devcons_write+0x47>
+    m = n - tot;
+  802bc5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bc8:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802bca:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802bcf:	39 c3                	cmp    %eax,%ebx
+  802bd1:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802bd4:	83 ec 04             	sub    $0x4,%esp
+  802bd7:	53                   	push   %ebx
+  802bd8:	89 f0                	mov    %esi,%eax
+  802bda:	03 45 0c             	add    0xc(%ebp),%eax
+  802bdd:	50                   	push   %eax
+  802bde:	57                   	push   %edi
+  802bdf:	e8 b3 df ff ff       	call   800b97 <memmove>
+    sys_cputs(buf, m);
+  802be4:	83 c4 08             	add    $0x8,%esp
+  802be7:	53                   	push   %ebx
+  802be8:	57                   	push   %edi
+  802be9:	e8 53 e1 ff ff       	call   800d41 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802bee:	01 de                	add    %ebx,%esi
+  802bf0:	83 c4 10             	add    $0x10,%esp
+  802bf3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802bf6:	72 cd                	jb     802bc5 <devcons_write+0x19>
+}
+  802bf8:	89 f0                	mov    %esi,%eax
+  802bfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bfd:	5b                   	pop    %ebx
+  802bfe:	5e                   	pop    %esi
+  802bff:	5f                   	pop    %edi
+  802c00:	5d                   	pop    %ebp
+  802c01:	c3                   	ret
+
+00802c02 <devcons_read>:
+{
+  802c02:	55                   	push   %ebp
+  802c03:	89 e5                	mov    %esp,%ebp
+  802c05:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802c08:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c11:	75 07                	jne    802c1a <devcons_read+0x18>
+  802c13:	eb 1f                	jmp    802c34 <devcons_read+0x32>
+    sys_yield();
+  802c15:	e8 c4 e1 ff ff       	call   800dde <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802c1a:	e8 40 e1 ff ff       	call   800d5f <sys_cgetc>
+  802c1f:	85 c0                	test   %eax,%eax
+  802c21:	74 f2                	je     802c15 <devcons_read+0x13>
+  if (c < 0)
+  802c23:	78 0f                	js     802c34 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802c25:	83 f8 04             	cmp    $0x4,%eax
+  802c28:	74 0c                	je     802c36 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802c2a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c2d:	88 02                	mov    %al,(%edx)
+  return 1;
+  802c2f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802c34:	c9                   	leave
+  802c35:	c3                   	ret
+    return 0;
+  802c36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3b:	eb f7                	jmp    802c34 <devcons_read+0x32>
+
+00802c3d <cputchar>:
+{
+  802c3d:	55                   	push   %ebp
+  802c3e:	89 e5                	mov    %esp,%ebp
+  802c40:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802c43:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c46:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802c49:	6a 01                	push   $0x1
+  802c4b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c4e:	50                   	push   %eax
+  802c4f:	e8 ed e0 ff ff       	call   800d41 <sys_cputs>
+}
+  802c54:	83 c4 10             	add    $0x10,%esp
+  802c57:	c9                   	leave
+  802c58:	c3                   	ret
+
+00802c59 <getchar>:
+{
+  802c59:	55                   	push   %ebp
+  802c5a:	89 e5                	mov    %esp,%ebp
+  802c5c:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802c5f:	6a 01                	push   $0x1
+  802c61:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c64:	50                   	push   %eax
+  802c65:	6a 00                	push   $0x0
+  802c67:	e8 a8 e9 ff ff       	call   801614 <read>
+  if (r < 0)
+  802c6c:	83 c4 10             	add    $0x10,%esp
+  802c6f:	85 c0                	test   %eax,%eax
+  802c71:	78 06                	js     802c79 <getchar+0x20>
+  if (r < 1)
+  802c73:	74 06                	je     802c7b <getchar+0x22>
+  return c;
+  802c75:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802c79:	c9                   	leave
+  802c7a:	c3                   	ret
+    return -E_EOF;
+  802c7b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c80:	eb f7                	jmp    802c79 <getchar+0x20>
+
+00802c82 <iscons>:
+{
+  802c82:	55                   	push   %ebp
+  802c83:	89 e5                	mov    %esp,%ebp
+  802c85:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c88:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c8b:	50                   	push   %eax
+  802c8c:	ff 75 08             	push   0x8(%ebp)
+  802c8f:	e8 d5 e6 ff ff       	call   801369 <fd_lookup>
+  802c94:	83 c4 10             	add    $0x10,%esp
+  802c97:	85 c0                	test   %eax,%eax
+  802c99:	78 11                	js     802cac <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c9e:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802ca4:	39 10                	cmp    %edx,(%eax)
+  802ca6:	0f 94 c0             	sete   %al
+  802ca9:	0f b6 c0             	movzbl %al,%eax
+}
+  802cac:	c9                   	leave
+  802cad:	c3                   	ret
+
+00802cae <opencons>:
+{
+  802cae:	55                   	push   %ebp
+  802caf:	89 e5                	mov    %esp,%ebp
+  802cb1:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802cb4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cb7:	50                   	push   %eax
+  802cb8:	e8 56 e6 ff ff       	call   801313 <fd_alloc>
+  802cbd:	83 c4 10             	add    $0x10,%esp
+  802cc0:	85 c0                	test   %eax,%eax
+  802cc2:	78 3a                	js     802cfe <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802cc4:	83 ec 04             	sub    $0x4,%esp
+  802cc7:	68 07 04 00 00       	push   $0x407
+  802ccc:	ff 75 f4             	push   -0xc(%ebp)
+  802ccf:	6a 00                	push   $0x0
+  802cd1:	e8 6a e1 ff ff       	call   800e40 <sys_page_alloc>
+  802cd6:	83 c4 10             	add    $0x10,%esp
+  802cd9:	85 c0                	test   %eax,%eax
+  802cdb:	78 21                	js     802cfe <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802cdd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ce0:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802ce6:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802ce8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ceb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802cf2:	83 ec 0c             	sub    $0xc,%esp
+  802cf5:	50                   	push   %eax
+  802cf6:	e8 f4 e5 ff ff       	call   8012ef <fd2num>
+  802cfb:	83 c4 10             	add    $0x10,%esp
+}
+  802cfe:	c9                   	leave
+  802cff:	c3                   	ret
+
+00802d00 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802d00:	55                   	push   %ebp
+  802d01:	89 e5                	mov    %esp,%ebp
+  802d03:	57                   	push   %edi
+  802d04:	56                   	push   %esi
+  802d05:	53                   	push   %ebx
+  802d06:	83 ec 14             	sub    $0x14,%esp
+  802d09:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d0f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d12:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802d15:	85 c0                	test   %eax,%eax
+  802d17:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802d1c:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802d1f:	ff 33                	push   (%ebx)
+  802d21:	50                   	push   %eax
+  802d22:	e8 f1 e3 ff ff       	call   801118 <sys_ipc_recv>
+  802d27:	83 c4 10             	add    $0x10,%esp
+  802d2a:	85 c0                	test   %eax,%eax
+  802d2c:	78 39                	js     802d67 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802d2e:	85 ff                	test   %edi,%edi
+  802d30:	74 0a                	je     802d3c <ipc_recv_pages+0x3c>
+  802d32:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d37:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802d3a:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802d3c:	85 f6                	test   %esi,%esi
+  802d3e:	74 0d                	je     802d4d <ipc_recv_pages+0x4d>
+  802d40:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d45:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802d4b:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802d4d:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d52:	8b 40 74             	mov    0x74(%eax),%eax
+  802d55:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802d57:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d5c:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802d5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d62:	5b                   	pop    %ebx
+  802d63:	5e                   	pop    %esi
+  802d64:	5f                   	pop    %edi
+  802d65:	5d                   	pop    %ebp
+  802d66:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802d67:	85 ff                	test   %edi,%edi
+  802d69:	74 06                	je     802d71 <ipc_recv_pages+0x71>
+  802d6b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802d71:	85 f6                	test   %esi,%esi
+  802d73:	74 06                	je     802d7b <ipc_recv_pages+0x7b>
+  802d75:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802d7b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802d81:	eb dc                	jmp    802d5f <ipc_recv_pages+0x5f>
+
+00802d83 <ipc_recv>:
+{
+  802d83:	55                   	push   %ebp
+  802d84:	89 e5                	mov    %esp,%ebp
+  802d86:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802d89:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802d90:	ff 75 10             	push   0x10(%ebp)
+  802d93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d96:	50                   	push   %eax
+  802d97:	ff 75 0c             	push   0xc(%ebp)
+  802d9a:	ff 75 08             	push   0x8(%ebp)
+  802d9d:	e8 5e ff ff ff       	call   802d00 <ipc_recv_pages>
+}
+  802da2:	c9                   	leave
+  802da3:	c3                   	ret
+
+00802da4 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802da4:	55                   	push   %ebp
+  802da5:	89 e5                	mov    %esp,%ebp
+  802da7:	57                   	push   %edi
+  802da8:	56                   	push   %esi
+  802da9:	53                   	push   %ebx
+  802daa:	83 ec 0c             	sub    $0xc,%esp
+  802dad:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802db0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802db3:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802db6:	89 c3                	mov    %eax,%ebx
+  802db8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802dbe:	85 c0                	test   %eax,%eax
+  802dc0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802dc5:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802dc8:	83 ec 0c             	sub    $0xc,%esp
+  802dcb:	ff 75 14             	push   0x14(%ebp)
+  802dce:	ff 75 18             	push   0x18(%ebp)
+  802dd1:	53                   	push   %ebx
+  802dd2:	56                   	push   %esi
+  802dd3:	57                   	push   %edi
+  802dd4:	e8 1e e3 ff ff       	call   8010f7 <sys_ipc_try_send>
+  802dd9:	83 c4 20             	add    $0x20,%esp
+  802ddc:	85 c0                	test   %eax,%eax
+  802dde:	79 1e                	jns    802dfe <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802de0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802de3:	75 07                	jne    802dec <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802de5:	e8 f4 df ff ff       	call   800dde <sys_yield>
+  802dea:	eb dc                	jmp    802dc8 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802dec:	50                   	push   %eax
+  802ded:	68 53 36 80 00       	push   $0x803653
+  802df2:	6a 5c                	push   $0x5c
+  802df4:	68 60 36 80 00       	push   $0x803660
+  802df9:	e8 4a d5 ff ff       	call   800348 <_panic>
+  }
+}
+  802dfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e01:	5b                   	pop    %ebx
+  802e02:	5e                   	pop    %esi
+  802e03:	5f                   	pop    %edi
+  802e04:	5d                   	pop    %ebp
+  802e05:	c3                   	ret
+
+00802e06 <ipc_send>:
+{
+  802e06:	55                   	push   %ebp
+  802e07:	89 e5                	mov    %esp,%ebp
+  802e09:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802e0c:	ff 75 14             	push   0x14(%ebp)
+  802e0f:	6a 01                	push   $0x1
+  802e11:	ff 75 10             	push   0x10(%ebp)
+  802e14:	ff 75 0c             	push   0xc(%ebp)
+  802e17:	ff 75 08             	push   0x8(%ebp)
+  802e1a:	e8 85 ff ff ff       	call   802da4 <ipc_send_pages>
+}
+  802e1f:	83 c4 20             	add    $0x20,%esp
+  802e22:	c9                   	leave
+  802e23:	c3                   	ret
+
+00802e24 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802e24:	55                   	push   %ebp
+  802e25:	89 e5                	mov    %esp,%ebp
+  802e27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802e2a:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802e2f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e32:	c1 e0 04             	shl    $0x4,%eax
+  802e35:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e3a:	8b 40 50             	mov    0x50(%eax),%eax
+  802e3d:	39 c8                	cmp    %ecx,%eax
+  802e3f:	74 12                	je     802e53 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802e41:	83 c2 01             	add    $0x1,%edx
+  802e44:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802e4a:	75 e3                	jne    802e2f <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e51:	eb 0e                	jmp    802e61 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802e53:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e56:	c1 e0 04             	shl    $0x4,%eax
+  802e59:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e5e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802e61:	5d                   	pop    %ebp
+  802e62:	c3                   	ret
+
+00802e63 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802e63:	55                   	push   %ebp
+  802e64:	89 e5                	mov    %esp,%ebp
+  802e66:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802e69:	89 c2                	mov    %eax,%edx
+  802e6b:	c1 ea 16             	shr    $0x16,%edx
+  802e6e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802e75:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802e7a:	f6 c1 01             	test   $0x1,%cl
+  802e7d:	74 1c                	je     802e9b <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802e7f:	c1 e8 0c             	shr    $0xc,%eax
+  802e82:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802e89:	a8 01                	test   $0x1,%al
+  802e8b:	74 0e                	je     802e9b <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802e8d:	c1 e8 0c             	shr    $0xc,%eax
+  802e90:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802e97:	ef 
+  802e98:	0f b7 d2             	movzwl %dx,%edx
+}
+  802e9b:	89 d0                	mov    %edx,%eax
+  802e9d:	5d                   	pop    %ebp
+  802e9e:	c3                   	ret
+
+00802e9f <udivmod>:
+  802e9f:	55                   	push   %ebp
+  802ea0:	57                   	push   %edi
+  802ea1:	56                   	push   %esi
+  802ea2:	53                   	push   %ebx
+  802ea3:	83 ec 14             	sub    $0x14,%esp
+  802ea6:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802eaa:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802eae:	89 fb                	mov    %edi,%ebx
+  802eb0:	09 f3                	or     %esi,%ebx
+  802eb2:	0f 84 88 00 00 00    	je     802f40 <udivmod+0xa1>
+  802eb8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802ebd:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802ec4:	00 
+  802ec5:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802ecc:	00 
+  802ecd:	89 cd                	mov    %ecx,%ebp
+  802ecf:	89 34 24             	mov    %esi,(%esp)
+  802ed2:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802ed6:	eb 08                	jmp    802ee0 <udivmod+0x41>
+  802ed8:	83 ed 01             	sub    $0x1,%ebp
+  802edb:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802ede:	74 6c                	je     802f4c <udivmod+0xad>
+  802ee0:	89 c3                	mov    %eax,%ebx
+  802ee2:	89 d6                	mov    %edx,%esi
+  802ee4:	89 e9                	mov    %ebp,%ecx
+  802ee6:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802ee9:	d3 ee                	shr    %cl,%esi
+  802eeb:	f6 c1 20             	test   $0x20,%cl
+  802eee:	74 04                	je     802ef4 <udivmod+0x55>
+  802ef0:	89 f3                	mov    %esi,%ebx
+  802ef2:	31 f6                	xor    %esi,%esi
+  802ef4:	8b 3c 24             	mov    (%esp),%edi
+  802ef7:	39 fb                	cmp    %edi,%ebx
+  802ef9:	89 f7                	mov    %esi,%edi
+  802efb:	8b 1c 24             	mov    (%esp),%ebx
+  802efe:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802f02:	19 f7                	sbb    %esi,%edi
+  802f04:	72 d2                	jb     802ed8 <udivmod+0x39>
+  802f06:	89 f7                	mov    %esi,%edi
+  802f08:	89 de                	mov    %ebx,%esi
+  802f0a:	89 e9                	mov    %ebp,%ecx
+  802f0c:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f0f:	d3 e6                	shl    %cl,%esi
+  802f11:	f6 c1 20             	test   $0x20,%cl
+  802f14:	74 04                	je     802f1a <udivmod+0x7b>
+  802f16:	89 f7                	mov    %esi,%edi
+  802f18:	31 f6                	xor    %esi,%esi
+  802f1a:	29 f0                	sub    %esi,%eax
+  802f1c:	19 fa                	sbb    %edi,%edx
+  802f1e:	be 01 00 00 00       	mov    $0x1,%esi
+  802f23:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f28:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f2b:	d3 e6                	shl    %cl,%esi
+  802f2d:	f6 c1 20             	test   $0x20,%cl
+  802f30:	74 04                	je     802f36 <udivmod+0x97>
+  802f32:	89 f7                	mov    %esi,%edi
+  802f34:	31 f6                	xor    %esi,%esi
+  802f36:	09 74 24 08          	or     %esi,0x8(%esp)
+  802f3a:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802f3e:	eb 98                	jmp    802ed8 <udivmod+0x39>
+  802f40:	89 f0                	mov    %esi,%eax
+  802f42:	89 fa                	mov    %edi,%edx
+  802f44:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802f48:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802f4c:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802f50:	89 01                	mov    %eax,(%ecx)
+  802f52:	89 51 04             	mov    %edx,0x4(%ecx)
+  802f55:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f59:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f5d:	83 c4 14             	add    $0x14,%esp
+  802f60:	5b                   	pop    %ebx
+  802f61:	5e                   	pop    %esi
+  802f62:	5f                   	pop    %edi
+  802f63:	5d                   	pop    %ebp
+  802f64:	c3                   	ret
+
+00802f65 <__udivdi3>:
+  802f65:	83 ec 18             	sub    $0x18,%esp
+  802f68:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f6c:	50                   	push   %eax
+  802f6d:	ff 74 24 2c          	push   0x2c(%esp)
+  802f71:	ff 74 24 2c          	push   0x2c(%esp)
+  802f75:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f79:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f7d:	e8 1d ff ff ff       	call   802e9f <udivmod>
+  802f82:	83 c4 24             	add    $0x24,%esp
+  802f85:	c3                   	ret
+
+00802f86 <__umoddi3>:
+  802f86:	83 ec 18             	sub    $0x18,%esp
+  802f89:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f8d:	50                   	push   %eax
+  802f8e:	ff 74 24 2c          	push   0x2c(%esp)
+  802f92:	ff 74 24 2c          	push   0x2c(%esp)
+  802f96:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f9a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f9e:	e8 fc fe ff ff       	call   802e9f <udivmod>
+  802fa3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802fa7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802fab:	83 c4 24             	add    $0x24,%esp
+  802fae:	c3                   	ret
+
+00802faf <__divdi3>:
+  802faf:	56                   	push   %esi
+  802fb0:	53                   	push   %ebx
+  802fb1:	83 ec 14             	sub    $0x14,%esp
+  802fb4:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802fb8:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802fbc:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802fc0:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802fc4:	85 d2                	test   %edx,%edx
+  802fc6:	78 18                	js     802fe0 <__divdi3+0x31>
+  802fc8:	85 db                	test   %ebx,%ebx
+  802fca:	78 3e                	js     80300a <__divdi3+0x5b>
+  802fcc:	83 ec 04             	sub    $0x4,%esp
+  802fcf:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802fd3:	56                   	push   %esi
+  802fd4:	53                   	push   %ebx
+  802fd5:	51                   	push   %ecx
+  802fd6:	e8 c4 fe ff ff       	call   802e9f <udivmod>
+  802fdb:	83 c4 10             	add    $0x10,%esp
+  802fde:	eb 24                	jmp    803004 <__divdi3+0x55>
+  802fe0:	f7 d8                	neg    %eax
+  802fe2:	83 d2 00             	adc    $0x0,%edx
+  802fe5:	f7 da                	neg    %edx
+  802fe7:	85 db                	test   %ebx,%ebx
+  802fe9:	78 3a                	js     803025 <__divdi3+0x76>
+  802feb:	83 ec 04             	sub    $0x4,%esp
+  802fee:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802ff2:	56                   	push   %esi
+  802ff3:	53                   	push   %ebx
+  802ff4:	51                   	push   %ecx
+  802ff5:	e8 a5 fe ff ff       	call   802e9f <udivmod>
+  802ffa:	83 c4 10             	add    $0x10,%esp
+  802ffd:	f7 d8                	neg    %eax
+  802fff:	83 d2 00             	adc    $0x0,%edx
+  803002:	f7 da                	neg    %edx
+  803004:	83 c4 14             	add    $0x14,%esp
+  803007:	5b                   	pop    %ebx
+  803008:	5e                   	pop    %esi
+  803009:	c3                   	ret
+  80300a:	83 ec 04             	sub    $0x4,%esp
+  80300d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803011:	56                   	push   %esi
+  803012:	f7 d9                	neg    %ecx
+  803014:	83 d3 00             	adc    $0x0,%ebx
+  803017:	f7 db                	neg    %ebx
+  803019:	53                   	push   %ebx
+  80301a:	51                   	push   %ecx
+  80301b:	e8 7f fe ff ff       	call   802e9f <udivmod>
+  803020:	83 c4 10             	add    $0x10,%esp
+  803023:	eb d8                	jmp    802ffd <__divdi3+0x4e>
+  803025:	83 ec 04             	sub    $0x4,%esp
+  803028:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80302c:	56                   	push   %esi
+  80302d:	f7 d9                	neg    %ecx
+  80302f:	83 d3 00             	adc    $0x0,%ebx
+  803032:	f7 db                	neg    %ebx
+  803034:	53                   	push   %ebx
+  803035:	51                   	push   %ecx
+  803036:	e8 64 fe ff ff       	call   802e9f <udivmod>
+  80303b:	83 c4 10             	add    $0x10,%esp
+  80303e:	eb c4                	jmp    803004 <__divdi3+0x55>
+
+00803040 <__moddi3>:
+  803040:	55                   	push   %ebp
+  803041:	57                   	push   %edi
+  803042:	56                   	push   %esi
+  803043:	53                   	push   %ebx
+  803044:	83 ec 24             	sub    $0x24,%esp
+  803047:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80304b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80304f:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803053:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803057:	85 d2                	test   %edx,%edx
+  803059:	78 3b                	js     803096 <__moddi3+0x56>
+  80305b:	83 ec 04             	sub    $0x4,%esp
+  80305e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803062:	56                   	push   %esi
+  803063:	89 ce                	mov    %ecx,%esi
+  803065:	f7 de                	neg    %esi
+  803067:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80306b:	89 de                	mov    %ebx,%esi
+  80306d:	83 d6 00             	adc    $0x0,%esi
+  803070:	f7 de                	neg    %esi
+  803072:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803076:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80307a:	0f 48 f1             	cmovs  %ecx,%esi
+  80307d:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803082:	53                   	push   %ebx
+  803083:	56                   	push   %esi
+  803084:	e8 16 fe ff ff       	call   802e9f <udivmod>
+  803089:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80308d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803091:	83 c4 10             	add    $0x10,%esp
+  803094:	eb 47                	jmp    8030dd <__moddi3+0x9d>
+  803096:	f7 d8                	neg    %eax
+  803098:	83 d2 00             	adc    $0x0,%edx
+  80309b:	f7 da                	neg    %edx
+  80309d:	83 ec 04             	sub    $0x4,%esp
+  8030a0:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8030a4:	56                   	push   %esi
+  8030a5:	89 cf                	mov    %ecx,%edi
+  8030a7:	f7 df                	neg    %edi
+  8030a9:	89 de                	mov    %ebx,%esi
+  8030ab:	83 d6 00             	adc    $0x0,%esi
+  8030ae:	f7 de                	neg    %esi
+  8030b0:	0f 49 cf             	cmovns %edi,%ecx
+  8030b3:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8030b7:	0f 49 de             	cmovns %esi,%ebx
+  8030ba:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8030be:	ff 74 24 0c          	push   0xc(%esp)
+  8030c2:	ff 74 24 0c          	push   0xc(%esp)
+  8030c6:	e8 d4 fd ff ff       	call   802e9f <udivmod>
+  8030cb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8030cf:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030d3:	f7 d8                	neg    %eax
+  8030d5:	83 d2 00             	adc    $0x0,%edx
+  8030d8:	f7 da                	neg    %edx
+  8030da:	83 c4 10             	add    $0x10,%esp
+  8030dd:	83 c4 24             	add    $0x24,%esp
+  8030e0:	5b                   	pop    %ebx
+  8030e1:	5e                   	pop    %esi
+  8030e2:	5f                   	pop    %edi
+  8030e3:	5d                   	pop    %ebp
+  8030e4:	c3                   	ret
@@ -0,0 +1,6397 @@
+
+obj/user/yield.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 69 00 00 00       	call   80009a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  int i;
+
+  cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  80003a:	a1 44 57 80 00       	mov    0x805744,%eax
+  80003f:	8b 40 48             	mov    0x48(%eax),%eax
+  800042:	50                   	push   %eax
+  800043:	68 c0 2e 80 00       	push   $0x802ec0
+  800048:	e8 4f 01 00 00       	call   80019c <cprintf>
+  80004d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < 5; i++) {
+  800050:	bb 00 00 00 00       	mov    $0x0,%ebx
+    sys_yield();
+  800055:	e8 fd 0a 00 00       	call   800b57 <sys_yield>
+    cprintf("Back in environment %08x, iteration %d.\n",
+            thisenv->env_id, i);
+  80005a:	a1 44 57 80 00       	mov    0x805744,%eax
+  80005f:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("Back in environment %08x, iteration %d.\n",
+  800062:	83 ec 04             	sub    $0x4,%esp
+  800065:	53                   	push   %ebx
+  800066:	50                   	push   %eax
+  800067:	68 e0 2e 80 00       	push   $0x802ee0
+  80006c:	e8 2b 01 00 00       	call   80019c <cprintf>
+  for (i = 0; i < 5; i++) {
+  800071:	83 c3 01             	add    $0x1,%ebx
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	83 fb 05             	cmp    $0x5,%ebx
+  80007a:	75 d9                	jne    800055 <umain+0x22>
+  }
+  cprintf("All done in environment %08x.\n", thisenv->env_id);
+  80007c:	a1 44 57 80 00       	mov    0x805744,%eax
+  800081:	8b 40 48             	mov    0x48(%eax),%eax
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	50                   	push   %eax
+  800088:	68 0c 2f 80 00       	push   $0x802f0c
+  80008d:	e8 0a 01 00 00       	call   80019c <cprintf>
+}
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800098:	c9                   	leave
+  800099:	c3                   	ret
+
+0080009a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80009a:	55                   	push   %ebp
+  80009b:	89 e5                	mov    %esp,%ebp
+  80009d:	56                   	push   %esi
+  80009e:	53                   	push   %ebx
+  80009f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8000a5:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  8000ac:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8000af:	e8 84 0a 00 00       	call   800b38 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8000b4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000b9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000bc:	c1 e0 04             	shl    $0x4,%eax
+  8000bf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000c4:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000c9:	85 db                	test   %ebx,%ebx
+  8000cb:	7e 07                	jle    8000d4 <libmain+0x3a>
+    binaryname = argv[0];
+  8000cd:	8b 06                	mov    (%esi),%eax
+  8000cf:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8000d4:	83 ec 08             	sub    $0x8,%esp
+  8000d7:	56                   	push   %esi
+  8000d8:	53                   	push   %ebx
+  8000d9:	e8 55 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8000de:	e8 0a 00 00 00       	call   8000ed <exit>
+}
+  8000e3:	83 c4 10             	add    $0x10,%esp
+  8000e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000e9:	5b                   	pop    %ebx
+  8000ea:	5e                   	pop    %esi
+  8000eb:	5d                   	pop    %ebp
+  8000ec:	c3                   	ret
+
+008000ed <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8000f3:	e8 3a 11 00 00       	call   801232 <close_all>
+  sys_env_destroy(0);
+  8000f8:	83 ec 0c             	sub    $0xc,%esp
+  8000fb:	6a 00                	push   $0x0
+  8000fd:	e8 f5 09 00 00       	call   800af7 <sys_env_destroy>
+}
+  800102:	83 c4 10             	add    $0x10,%esp
+  800105:	c9                   	leave
+  800106:	c3                   	ret
+
+00800107 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800107:	55                   	push   %ebp
+  800108:	89 e5                	mov    %esp,%ebp
+  80010a:	53                   	push   %ebx
+  80010b:	83 ec 04             	sub    $0x4,%esp
+  80010e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800111:	8b 13                	mov    (%ebx),%edx
+  800113:	8d 42 01             	lea    0x1(%edx),%eax
+  800116:	89 03                	mov    %eax,(%ebx)
+  800118:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80011b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  80011f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800124:	74 09                	je     80012f <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800126:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80012a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80012d:	c9                   	leave
+  80012e:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  80012f:	83 ec 08             	sub    $0x8,%esp
+  800132:	68 ff 00 00 00       	push   $0xff
+  800137:	8d 43 08             	lea    0x8(%ebx),%eax
+  80013a:	50                   	push   %eax
+  80013b:	e8 7a 09 00 00       	call   800aba <sys_cputs>
+    b->idx = 0;
+  800140:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	eb db                	jmp    800126 <putch+0x1f>
+
+0080014b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80014b:	55                   	push   %ebp
+  80014c:	89 e5                	mov    %esp,%ebp
+  80014e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800154:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80015b:	00 00 00 
+  b.cnt = 0;
+  80015e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800165:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800168:	ff 75 0c             	push   0xc(%ebp)
+  80016b:	ff 75 08             	push   0x8(%ebp)
+  80016e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800174:	50                   	push   %eax
+  800175:	68 07 01 80 00       	push   $0x800107
+  80017a:	e8 14 01 00 00       	call   800293 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  80017f:	83 c4 08             	add    $0x8,%esp
+  800182:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800188:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80018e:	50                   	push   %eax
+  80018f:	e8 26 09 00 00       	call   800aba <sys_cputs>
+
+  return b.cnt;
+}
+  800194:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80019a:	c9                   	leave
+  80019b:	c3                   	ret
+
+0080019c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80019c:	55                   	push   %ebp
+  80019d:	89 e5                	mov    %esp,%ebp
+  80019f:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8001a2:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8001a5:	50                   	push   %eax
+  8001a6:	ff 75 08             	push   0x8(%ebp)
+  8001a9:	e8 9d ff ff ff       	call   80014b <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8001ae:	c9                   	leave
+  8001af:	c3                   	ret
+
+008001b0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8001b0:	55                   	push   %ebp
+  8001b1:	89 e5                	mov    %esp,%ebp
+  8001b3:	57                   	push   %edi
+  8001b4:	56                   	push   %esi
+  8001b5:	53                   	push   %ebx
+  8001b6:	83 ec 1c             	sub    $0x1c,%esp
+  8001b9:	89 c7                	mov    %eax,%edi
+  8001bb:	89 d6                	mov    %edx,%esi
+  8001bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001c3:	89 d1                	mov    %edx,%ecx
+  8001c5:	89 c2                	mov    %eax,%edx
+  8001c7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001ca:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001d0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8001d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001d6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001dd:	39 c2                	cmp    %eax,%edx
+  8001df:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001e2:	72 3e                	jb     800222 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001e4:	83 ec 0c             	sub    $0xc,%esp
+  8001e7:	ff 75 18             	push   0x18(%ebp)
+  8001ea:	83 eb 01             	sub    $0x1,%ebx
+  8001ed:	53                   	push   %ebx
+  8001ee:	50                   	push   %eax
+  8001ef:	83 ec 08             	sub    $0x8,%esp
+  8001f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8001f5:	ff 75 e0             	push   -0x20(%ebp)
+  8001f8:	ff 75 dc             	push   -0x24(%ebp)
+  8001fb:	ff 75 d8             	push   -0x28(%ebp)
+  8001fe:	e8 21 2b 00 00       	call   802d24 <__udivdi3>
+  800203:	83 c4 18             	add    $0x18,%esp
+  800206:	52                   	push   %edx
+  800207:	50                   	push   %eax
+  800208:	89 f2                	mov    %esi,%edx
+  80020a:	89 f8                	mov    %edi,%eax
+  80020c:	e8 9f ff ff ff       	call   8001b0 <printnum>
+  800211:	83 c4 20             	add    $0x20,%esp
+  800214:	eb 13                	jmp    800229 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800216:	83 ec 08             	sub    $0x8,%esp
+  800219:	56                   	push   %esi
+  80021a:	ff 75 18             	push   0x18(%ebp)
+  80021d:	ff d7                	call   *%edi
+  80021f:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800222:	83 eb 01             	sub    $0x1,%ebx
+  800225:	85 db                	test   %ebx,%ebx
+  800227:	7f ed                	jg     800216 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800229:	83 ec 08             	sub    $0x8,%esp
+  80022c:	56                   	push   %esi
+  80022d:	83 ec 04             	sub    $0x4,%esp
+  800230:	ff 75 e4             	push   -0x1c(%ebp)
+  800233:	ff 75 e0             	push   -0x20(%ebp)
+  800236:	ff 75 dc             	push   -0x24(%ebp)
+  800239:	ff 75 d8             	push   -0x28(%ebp)
+  80023c:	e8 04 2b 00 00       	call   802d45 <__umoddi3>
+  800241:	83 c4 14             	add    $0x14,%esp
+  800244:	0f be 80 35 2f 80 00 	movsbl 0x802f35(%eax),%eax
+  80024b:	50                   	push   %eax
+  80024c:	ff d7                	call   *%edi
+}
+  80024e:	83 c4 10             	add    $0x10,%esp
+  800251:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800254:	5b                   	pop    %ebx
+  800255:	5e                   	pop    %esi
+  800256:	5f                   	pop    %edi
+  800257:	5d                   	pop    %ebp
+  800258:	c3                   	ret
+
+00800259 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800259:	55                   	push   %ebp
+  80025a:	89 e5                	mov    %esp,%ebp
+  80025c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80025f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800263:	8b 10                	mov    (%eax),%edx
+  800265:	3b 50 04             	cmp    0x4(%eax),%edx
+  800268:	73 0a                	jae    800274 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80026a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80026d:	89 08                	mov    %ecx,(%eax)
+  80026f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800272:	88 02                	mov    %al,(%edx)
+}
+  800274:	5d                   	pop    %ebp
+  800275:	c3                   	ret
+
+00800276 <printfmt>:
+{
+  800276:	55                   	push   %ebp
+  800277:	89 e5                	mov    %esp,%ebp
+  800279:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  80027c:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  80027f:	50                   	push   %eax
+  800280:	ff 75 10             	push   0x10(%ebp)
+  800283:	ff 75 0c             	push   0xc(%ebp)
+  800286:	ff 75 08             	push   0x8(%ebp)
+  800289:	e8 05 00 00 00       	call   800293 <vprintfmt>
+}
+  80028e:	83 c4 10             	add    $0x10,%esp
+  800291:	c9                   	leave
+  800292:	c3                   	ret
+
+00800293 <vprintfmt>:
+{
+  800293:	55                   	push   %ebp
+  800294:	89 e5                	mov    %esp,%ebp
+  800296:	57                   	push   %edi
+  800297:	56                   	push   %esi
+  800298:	53                   	push   %ebx
+  800299:	83 ec 2c             	sub    $0x2c,%esp
+  80029c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80029f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002a2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002a5:	eb 0a                	jmp    8002b1 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8002a7:	83 ec 08             	sub    $0x8,%esp
+  8002aa:	53                   	push   %ebx
+  8002ab:	50                   	push   %eax
+  8002ac:	ff d6                	call   *%esi
+  8002ae:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8002b1:	83 c7 01             	add    $0x1,%edi
+  8002b4:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002b8:	83 f8 25             	cmp    $0x25,%eax
+  8002bb:	74 0c                	je     8002c9 <vprintfmt+0x36>
+      if (ch == '\0')
+  8002bd:	85 c0                	test   %eax,%eax
+  8002bf:	75 e6                	jne    8002a7 <vprintfmt+0x14>
+}
+  8002c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c4:	5b                   	pop    %ebx
+  8002c5:	5e                   	pop    %esi
+  8002c6:	5f                   	pop    %edi
+  8002c7:	5d                   	pop    %ebp
+  8002c8:	c3                   	ret
+    padc = ' ';
+  8002c9:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8002cd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8002d4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8002db:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8002e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8002e7:	8d 47 01             	lea    0x1(%edi),%eax
+  8002ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002ed:	0f b6 17             	movzbl (%edi),%edx
+  8002f0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002f3:	3c 55                	cmp    $0x55,%al
+  8002f5:	0f 87 cf 03 00 00    	ja     8006ca <vprintfmt+0x437>
+  8002fb:	0f b6 c0             	movzbl %al,%eax
+  8002fe:	ff 24 85 80 30 80 00 	jmp    *0x803080(,%eax,4)
+  800305:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800308:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80030c:	eb d9                	jmp    8002e7 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80030e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800311:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800315:	eb d0                	jmp    8002e7 <vprintfmt+0x54>
+  800317:	0f b6 d2             	movzbl %dl,%edx
+  80031a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  80031d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800322:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800325:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800328:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  80032c:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  80032f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800332:	83 f9 09             	cmp    $0x9,%ecx
+  800335:	77 55                	ja     80038c <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800337:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  80033a:	eb e9                	jmp    800325 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  80033c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80033f:	8b 00                	mov    (%eax),%eax
+  800341:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800344:	8b 45 14             	mov    0x14(%ebp),%eax
+  800347:	8d 40 04             	lea    0x4(%eax),%eax
+  80034a:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80034d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800350:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800354:	79 91                	jns    8002e7 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800356:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800359:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80035c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800363:	eb 82                	jmp    8002e7 <vprintfmt+0x54>
+      if (width < 0)
+  800365:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800368:	85 d2                	test   %edx,%edx
+  80036a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036f:	0f 49 c2             	cmovns %edx,%eax
+  800372:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800375:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800378:	e9 6a ff ff ff       	jmp    8002e7 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80037d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800380:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800387:	e9 5b ff ff ff       	jmp    8002e7 <vprintfmt+0x54>
+  80038c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80038f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800392:	eb bc                	jmp    800350 <vprintfmt+0xbd>
+      lflag++;
+  800394:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800397:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80039a:	e9 48 ff ff ff       	jmp    8002e7 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  80039f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a2:	8d 78 04             	lea    0x4(%eax),%edi
+  8003a5:	83 ec 08             	sub    $0x8,%esp
+  8003a8:	53                   	push   %ebx
+  8003a9:	ff 30                	push   (%eax)
+  8003ab:	ff d6                	call   *%esi
+      break;
+  8003ad:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8003b0:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8003b3:	e9 b1 02 00 00       	jmp    800669 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8003b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bb:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8003be:	8b 10                	mov    (%eax),%edx
+  8003c0:	89 d0                	mov    %edx,%eax
+  8003c2:	f7 d8                	neg    %eax
+  8003c4:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003c7:	83 f8 10             	cmp    $0x10,%eax
+  8003ca:	7f 23                	jg     8003ef <vprintfmt+0x15c>
+  8003cc:	8b 14 85 e0 31 80 00 	mov    0x8031e0(,%eax,4),%edx
+  8003d3:	85 d2                	test   %edx,%edx
+  8003d5:	74 18                	je     8003ef <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8003d7:	52                   	push   %edx
+  8003d8:	68 2a 33 80 00       	push   $0x80332a
+  8003dd:	53                   	push   %ebx
+  8003de:	56                   	push   %esi
+  8003df:	e8 92 fe ff ff       	call   800276 <printfmt>
+  8003e4:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8003e7:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003ea:	e9 7a 02 00 00       	jmp    800669 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8003ef:	50                   	push   %eax
+  8003f0:	68 4d 2f 80 00       	push   $0x802f4d
+  8003f5:	53                   	push   %ebx
+  8003f6:	56                   	push   %esi
+  8003f7:	e8 7a fe ff ff       	call   800276 <printfmt>
+  8003fc:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8003ff:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800402:	e9 62 02 00 00       	jmp    800669 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800407:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040a:	83 c0 04             	add    $0x4,%eax
+  80040d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800410:	8b 45 14             	mov    0x14(%ebp),%eax
+  800413:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800415:	85 c9                	test   %ecx,%ecx
+  800417:	b8 46 2f 80 00       	mov    $0x802f46,%eax
+  80041c:	0f 45 c1             	cmovne %ecx,%eax
+  80041f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800422:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800426:	7e 06                	jle    80042e <vprintfmt+0x19b>
+  800428:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80042c:	75 0b                	jne    800439 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80042e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800431:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800434:	89 75 08             	mov    %esi,0x8(%ebp)
+  800437:	eb 5c                	jmp    800495 <vprintfmt+0x202>
+  800439:	83 ec 08             	sub    $0x8,%esp
+  80043c:	ff 75 d0             	push   -0x30(%ebp)
+  80043f:	ff 75 cc             	push   -0x34(%ebp)
+  800442:	e8 20 03 00 00       	call   800767 <strnlen>
+  800447:	89 c2                	mov    %eax,%edx
+  800449:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80044c:	29 d0                	sub    %edx,%eax
+  80044e:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800451:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800455:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800458:	89 75 08             	mov    %esi,0x8(%ebp)
+  80045b:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80045d:	eb 0e                	jmp    80046d <vprintfmt+0x1da>
+          putch(padc, putdat);
+  80045f:	83 ec 08             	sub    $0x8,%esp
+  800462:	53                   	push   %ebx
+  800463:	57                   	push   %edi
+  800464:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800467:	83 ee 01             	sub    $0x1,%esi
+  80046a:	83 c4 10             	add    $0x10,%esp
+  80046d:	85 f6                	test   %esi,%esi
+  80046f:	7f ee                	jg     80045f <vprintfmt+0x1cc>
+  800471:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800474:	8b 75 08             	mov    0x8(%ebp),%esi
+  800477:	85 c0                	test   %eax,%eax
+  800479:	ba 00 00 00 00       	mov    $0x0,%edx
+  80047e:	0f 49 d0             	cmovns %eax,%edx
+  800481:	29 d0                	sub    %edx,%eax
+  800483:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800486:	eb a6                	jmp    80042e <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800488:	83 ec 08             	sub    $0x8,%esp
+  80048b:	53                   	push   %ebx
+  80048c:	52                   	push   %edx
+  80048d:	ff 55 08             	call   *0x8(%ebp)
+  800490:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800493:	89 f1                	mov    %esi,%ecx
+  800495:	8d 71 01             	lea    0x1(%ecx),%esi
+  800498:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80049c:	0f be d0             	movsbl %al,%edx
+  80049f:	85 d2                	test   %edx,%edx
+  8004a1:	74 28                	je     8004cb <vprintfmt+0x238>
+  8004a3:	85 ff                	test   %edi,%edi
+  8004a5:	78 05                	js     8004ac <vprintfmt+0x219>
+  8004a7:	83 ef 01             	sub    $0x1,%edi
+  8004aa:	78 30                	js     8004dc <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8004ac:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004b0:	74 d6                	je     800488 <vprintfmt+0x1f5>
+  8004b2:	0f be c0             	movsbl %al,%eax
+  8004b5:	83 e8 20             	sub    $0x20,%eax
+  8004b8:	83 f8 5e             	cmp    $0x5e,%eax
+  8004bb:	76 cb                	jbe    800488 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8004bd:	83 ec 08             	sub    $0x8,%esp
+  8004c0:	53                   	push   %ebx
+  8004c1:	6a 3f                	push   $0x3f
+  8004c3:	ff 55 08             	call   *0x8(%ebp)
+  8004c6:	83 c4 10             	add    $0x10,%esp
+  8004c9:	eb c8                	jmp    800493 <vprintfmt+0x200>
+  8004cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ce:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004d4:	01 d0                	add    %edx,%eax
+  8004d6:	29 c8                	sub    %ecx,%eax
+  8004d8:	89 c7                	mov    %eax,%edi
+  8004da:	eb 13                	jmp    8004ef <vprintfmt+0x25c>
+  8004dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004df:	eb ed                	jmp    8004ce <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8004e1:	83 ec 08             	sub    $0x8,%esp
+  8004e4:	53                   	push   %ebx
+  8004e5:	6a 20                	push   $0x20
+  8004e7:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8004e9:	83 ef 01             	sub    $0x1,%edi
+  8004ec:	83 c4 10             	add    $0x10,%esp
+  8004ef:	85 ff                	test   %edi,%edi
+  8004f1:	7f ee                	jg     8004e1 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8004f3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004f9:	e9 6b 01 00 00       	jmp    800669 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8004fe:	83 f9 01             	cmp    $0x1,%ecx
+  800501:	7f 1f                	jg     800522 <vprintfmt+0x28f>
+  else if (lflag)
+  800503:	85 c9                	test   %ecx,%ecx
+  800505:	74 67                	je     80056e <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800507:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050a:	8b 00                	mov    (%eax),%eax
+  80050c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80050f:	89 c1                	mov    %eax,%ecx
+  800511:	c1 f9 1f             	sar    $0x1f,%ecx
+  800514:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800517:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051a:	8d 40 04             	lea    0x4(%eax),%eax
+  80051d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800520:	eb 17                	jmp    800539 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800522:	8b 45 14             	mov    0x14(%ebp),%eax
+  800525:	8b 50 04             	mov    0x4(%eax),%edx
+  800528:	8b 00                	mov    (%eax),%eax
+  80052a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800530:	8b 45 14             	mov    0x14(%ebp),%eax
+  800533:	8d 40 08             	lea    0x8(%eax),%eax
+  800536:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800539:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80053c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  80053f:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800544:	85 c9                	test   %ecx,%ecx
+  800546:	0f 89 03 01 00 00    	jns    80064f <vprintfmt+0x3bc>
+        putch('-', putdat);
+  80054c:	83 ec 08             	sub    $0x8,%esp
+  80054f:	53                   	push   %ebx
+  800550:	6a 2d                	push   $0x2d
+  800552:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800554:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800557:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80055a:	f7 da                	neg    %edx
+  80055c:	83 d1 00             	adc    $0x0,%ecx
+  80055f:	f7 d9                	neg    %ecx
+  800561:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800564:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800569:	e9 e1 00 00 00       	jmp    80064f <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  80056e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800571:	8b 00                	mov    (%eax),%eax
+  800573:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800576:	89 c1                	mov    %eax,%ecx
+  800578:	c1 f9 1f             	sar    $0x1f,%ecx
+  80057b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80057e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800581:	8d 40 04             	lea    0x4(%eax),%eax
+  800584:	89 45 14             	mov    %eax,0x14(%ebp)
+  800587:	eb b0                	jmp    800539 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800589:	83 f9 01             	cmp    $0x1,%ecx
+  80058c:	7f 1e                	jg     8005ac <vprintfmt+0x319>
+  else if (lflag)
+  80058e:	85 c9                	test   %ecx,%ecx
+  800590:	74 32                	je     8005c4 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800592:	8b 45 14             	mov    0x14(%ebp),%eax
+  800595:	8b 10                	mov    (%eax),%edx
+  800597:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80059c:	8d 40 04             	lea    0x4(%eax),%eax
+  80059f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005a2:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8005a7:	e9 a3 00 00 00       	jmp    80064f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8005ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005af:	8b 10                	mov    (%eax),%edx
+  8005b1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005b4:	8d 40 08             	lea    0x8(%eax),%eax
+  8005b7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005ba:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8005bf:	e9 8b 00 00 00       	jmp    80064f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8005c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c7:	8b 10                	mov    (%eax),%edx
+  8005c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8005d9:	eb 74                	jmp    80064f <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8005db:	83 f9 01             	cmp    $0x1,%ecx
+  8005de:	7f 1b                	jg     8005fb <vprintfmt+0x368>
+  else if (lflag)
+  8005e0:	85 c9                	test   %ecx,%ecx
+  8005e2:	74 2c                	je     800610 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8005e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e7:	8b 10                	mov    (%eax),%edx
+  8005e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8005f4:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8005f9:	eb 54                	jmp    80064f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8005fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fe:	8b 10                	mov    (%eax),%edx
+  800600:	8b 48 04             	mov    0x4(%eax),%ecx
+  800603:	8d 40 08             	lea    0x8(%eax),%eax
+  800606:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800609:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  80060e:	eb 3f                	jmp    80064f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800610:	8b 45 14             	mov    0x14(%ebp),%eax
+  800613:	8b 10                	mov    (%eax),%edx
+  800615:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80061a:	8d 40 04             	lea    0x4(%eax),%eax
+  80061d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800620:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800625:	eb 28                	jmp    80064f <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800627:	83 ec 08             	sub    $0x8,%esp
+  80062a:	53                   	push   %ebx
+  80062b:	6a 30                	push   $0x30
+  80062d:	ff d6                	call   *%esi
+      putch('x', putdat);
+  80062f:	83 c4 08             	add    $0x8,%esp
+  800632:	53                   	push   %ebx
+  800633:	6a 78                	push   $0x78
+  800635:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800637:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063a:	8b 10                	mov    (%eax),%edx
+  80063c:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800641:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800644:	8d 40 04             	lea    0x4(%eax),%eax
+  800647:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80064a:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  80064f:	83 ec 0c             	sub    $0xc,%esp
+  800652:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800656:	50                   	push   %eax
+  800657:	ff 75 e0             	push   -0x20(%ebp)
+  80065a:	57                   	push   %edi
+  80065b:	51                   	push   %ecx
+  80065c:	52                   	push   %edx
+  80065d:	89 da                	mov    %ebx,%edx
+  80065f:	89 f0                	mov    %esi,%eax
+  800661:	e8 4a fb ff ff       	call   8001b0 <printnum>
+      break;
+  800666:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800669:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80066c:	e9 40 fc ff ff       	jmp    8002b1 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800671:	83 f9 01             	cmp    $0x1,%ecx
+  800674:	7f 1b                	jg     800691 <vprintfmt+0x3fe>
+  else if (lflag)
+  800676:	85 c9                	test   %ecx,%ecx
+  800678:	74 2c                	je     8006a6 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80067a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067d:	8b 10                	mov    (%eax),%edx
+  80067f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800684:	8d 40 04             	lea    0x4(%eax),%eax
+  800687:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80068a:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  80068f:	eb be                	jmp    80064f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800691:	8b 45 14             	mov    0x14(%ebp),%eax
+  800694:	8b 10                	mov    (%eax),%edx
+  800696:	8b 48 04             	mov    0x4(%eax),%ecx
+  800699:	8d 40 08             	lea    0x8(%eax),%eax
+  80069c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80069f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8006a4:	eb a9                	jmp    80064f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a9:	8b 10                	mov    (%eax),%edx
+  8006ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006b6:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8006bb:	eb 92                	jmp    80064f <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8006bd:	83 ec 08             	sub    $0x8,%esp
+  8006c0:	53                   	push   %ebx
+  8006c1:	6a 25                	push   $0x25
+  8006c3:	ff d6                	call   *%esi
+      break;
+  8006c5:	83 c4 10             	add    $0x10,%esp
+  8006c8:	eb 9f                	jmp    800669 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8006ca:	83 ec 08             	sub    $0x8,%esp
+  8006cd:	53                   	push   %ebx
+  8006ce:	6a 25                	push   $0x25
+  8006d0:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8006d2:	83 c4 10             	add    $0x10,%esp
+  8006d5:	89 f8                	mov    %edi,%eax
+  8006d7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006db:	74 05                	je     8006e2 <vprintfmt+0x44f>
+  8006dd:	83 e8 01             	sub    $0x1,%eax
+  8006e0:	eb f5                	jmp    8006d7 <vprintfmt+0x444>
+  8006e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006e5:	eb 82                	jmp    800669 <vprintfmt+0x3d6>
+
+008006e7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006e7:	55                   	push   %ebp
+  8006e8:	89 e5                	mov    %esp,%ebp
+  8006ea:	83 ec 18             	sub    $0x18,%esp
+  8006ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8006f3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006f6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006fa:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006fd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800704:	85 c0                	test   %eax,%eax
+  800706:	74 26                	je     80072e <vsnprintf+0x47>
+  800708:	85 d2                	test   %edx,%edx
+  80070a:	7e 22                	jle    80072e <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80070c:	ff 75 14             	push   0x14(%ebp)
+  80070f:	ff 75 10             	push   0x10(%ebp)
+  800712:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800715:	50                   	push   %eax
+  800716:	68 59 02 80 00       	push   $0x800259
+  80071b:	e8 73 fb ff ff       	call   800293 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800720:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800723:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800726:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800729:	83 c4 10             	add    $0x10,%esp
+}
+  80072c:	c9                   	leave
+  80072d:	c3                   	ret
+    return -E_INVAL;
+  80072e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800733:	eb f7                	jmp    80072c <vsnprintf+0x45>
+
+00800735 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800735:	55                   	push   %ebp
+  800736:	89 e5                	mov    %esp,%ebp
+  800738:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80073b:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  80073e:	50                   	push   %eax
+  80073f:	ff 75 10             	push   0x10(%ebp)
+  800742:	ff 75 0c             	push   0xc(%ebp)
+  800745:	ff 75 08             	push   0x8(%ebp)
+  800748:	e8 9a ff ff ff       	call   8006e7 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  80074d:	c9                   	leave
+  80074e:	c3                   	ret
+
+0080074f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80074f:	55                   	push   %ebp
+  800750:	89 e5                	mov    %esp,%ebp
+  800752:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800755:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075a:	eb 03                	jmp    80075f <strlen+0x10>
+    n++;
+  80075c:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  80075f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800763:	75 f7                	jne    80075c <strlen+0xd>
+  return n;
+}
+  800765:	5d                   	pop    %ebp
+  800766:	c3                   	ret
+
+00800767 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800767:	55                   	push   %ebp
+  800768:	89 e5                	mov    %esp,%ebp
+  80076a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80076d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800770:	b8 00 00 00 00       	mov    $0x0,%eax
+  800775:	eb 03                	jmp    80077a <strnlen+0x13>
+    n++;
+  800777:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80077a:	39 d0                	cmp    %edx,%eax
+  80077c:	74 08                	je     800786 <strnlen+0x1f>
+  80077e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800782:	75 f3                	jne    800777 <strnlen+0x10>
+  800784:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800786:	89 d0                	mov    %edx,%eax
+  800788:	5d                   	pop    %ebp
+  800789:	c3                   	ret
+
+0080078a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80078a:	55                   	push   %ebp
+  80078b:	89 e5                	mov    %esp,%ebp
+  80078d:	53                   	push   %ebx
+  80078e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800791:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800794:	b8 00 00 00 00       	mov    $0x0,%eax
+  800799:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80079d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007a0:	83 c0 01             	add    $0x1,%eax
+  8007a3:	84 d2                	test   %dl,%dl
+  8007a5:	75 f2                	jne    800799 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  8007a7:	89 c8                	mov    %ecx,%eax
+  8007a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ac:	c9                   	leave
+  8007ad:	c3                   	ret
+
+008007ae <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007ae:	55                   	push   %ebp
+  8007af:	89 e5                	mov    %esp,%ebp
+  8007b1:	53                   	push   %ebx
+  8007b2:	83 ec 10             	sub    $0x10,%esp
+  8007b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  8007b8:	53                   	push   %ebx
+  8007b9:	e8 91 ff ff ff       	call   80074f <strlen>
+  8007be:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8007c1:	ff 75 0c             	push   0xc(%ebp)
+  8007c4:	01 d8                	add    %ebx,%eax
+  8007c6:	50                   	push   %eax
+  8007c7:	e8 be ff ff ff       	call   80078a <strcpy>
+  return dst;
+}
+  8007cc:	89 d8                	mov    %ebx,%eax
+  8007ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007d1:	c9                   	leave
+  8007d2:	c3                   	ret
+
+008007d3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8007d3:	55                   	push   %ebp
+  8007d4:	89 e5                	mov    %esp,%ebp
+  8007d6:	56                   	push   %esi
+  8007d7:	53                   	push   %ebx
+  8007d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8007de:	89 f3                	mov    %esi,%ebx
+  8007e0:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007e3:	89 f0                	mov    %esi,%eax
+  8007e5:	eb 0f                	jmp    8007f6 <strncpy+0x23>
+    *dst++ = *src;
+  8007e7:	83 c0 01             	add    $0x1,%eax
+  8007ea:	0f b6 0a             	movzbl (%edx),%ecx
+  8007ed:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8007f0:	80 f9 01             	cmp    $0x1,%cl
+  8007f3:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8007f6:	39 d8                	cmp    %ebx,%eax
+  8007f8:	75 ed                	jne    8007e7 <strncpy+0x14>
+  }
+  return ret;
+}
+  8007fa:	89 f0                	mov    %esi,%eax
+  8007fc:	5b                   	pop    %ebx
+  8007fd:	5e                   	pop    %esi
+  8007fe:	5d                   	pop    %ebp
+  8007ff:	c3                   	ret
+
+00800800 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800800:	55                   	push   %ebp
+  800801:	89 e5                	mov    %esp,%ebp
+  800803:	56                   	push   %esi
+  800804:	53                   	push   %ebx
+  800805:	8b 75 08             	mov    0x8(%ebp),%esi
+  800808:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80080b:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  80080e:	89 f0                	mov    %esi,%eax
+  800810:	85 d2                	test   %edx,%edx
+  800812:	74 21                	je     800835 <strlcpy+0x35>
+  800814:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800818:	89 f2                	mov    %esi,%edx
+  80081a:	eb 09                	jmp    800825 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  80081c:	83 c1 01             	add    $0x1,%ecx
+  80081f:	83 c2 01             	add    $0x1,%edx
+  800822:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800825:	39 c2                	cmp    %eax,%edx
+  800827:	74 09                	je     800832 <strlcpy+0x32>
+  800829:	0f b6 19             	movzbl (%ecx),%ebx
+  80082c:	84 db                	test   %bl,%bl
+  80082e:	75 ec                	jne    80081c <strlcpy+0x1c>
+  800830:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800832:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800835:	29 f0                	sub    %esi,%eax
+}
+  800837:	5b                   	pop    %ebx
+  800838:	5e                   	pop    %esi
+  800839:	5d                   	pop    %ebp
+  80083a:	c3                   	ret
+
+0080083b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80083b:	55                   	push   %ebp
+  80083c:	89 e5                	mov    %esp,%ebp
+  80083e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800841:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800844:	eb 06                	jmp    80084c <strcmp+0x11>
+    p++, q++;
+  800846:	83 c1 01             	add    $0x1,%ecx
+  800849:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  80084c:	0f b6 01             	movzbl (%ecx),%eax
+  80084f:	84 c0                	test   %al,%al
+  800851:	74 04                	je     800857 <strcmp+0x1c>
+  800853:	3a 02                	cmp    (%edx),%al
+  800855:	74 ef                	je     800846 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800857:	0f b6 c0             	movzbl %al,%eax
+  80085a:	0f b6 12             	movzbl (%edx),%edx
+  80085d:	29 d0                	sub    %edx,%eax
+}
+  80085f:	5d                   	pop    %ebp
+  800860:	c3                   	ret
+
+00800861 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800861:	55                   	push   %ebp
+  800862:	89 e5                	mov    %esp,%ebp
+  800864:	53                   	push   %ebx
+  800865:	8b 45 08             	mov    0x8(%ebp),%eax
+  800868:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80086b:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  80086e:	eb 09                	jmp    800879 <strncmp+0x18>
+    n--, p++, q++;
+  800870:	83 ea 01             	sub    $0x1,%edx
+  800873:	83 c0 01             	add    $0x1,%eax
+  800876:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800879:	85 d2                	test   %edx,%edx
+  80087b:	74 18                	je     800895 <strncmp+0x34>
+  80087d:	0f b6 18             	movzbl (%eax),%ebx
+  800880:	84 db                	test   %bl,%bl
+  800882:	74 04                	je     800888 <strncmp+0x27>
+  800884:	3a 19                	cmp    (%ecx),%bl
+  800886:	74 e8                	je     800870 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800888:	0f b6 00             	movzbl (%eax),%eax
+  80088b:	0f b6 11             	movzbl (%ecx),%edx
+  80088e:	29 d0                	sub    %edx,%eax
+}
+  800890:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800893:	c9                   	leave
+  800894:	c3                   	ret
+    return 0;
+  800895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089a:	eb f4                	jmp    800890 <strncmp+0x2f>
+
+0080089c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80089c:	55                   	push   %ebp
+  80089d:	89 e5                	mov    %esp,%ebp
+  80089f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008a2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8008a6:	eb 03                	jmp    8008ab <strchr+0xf>
+  8008a8:	83 c0 01             	add    $0x1,%eax
+  8008ab:	0f b6 10             	movzbl (%eax),%edx
+  8008ae:	84 d2                	test   %dl,%dl
+  8008b0:	74 06                	je     8008b8 <strchr+0x1c>
+    if (*s == c)
+  8008b2:	38 ca                	cmp    %cl,%dl
+  8008b4:	75 f2                	jne    8008a8 <strchr+0xc>
+  8008b6:	eb 05                	jmp    8008bd <strchr+0x21>
+      return (char*)s;
+  return 0;
+  8008b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008bd:	5d                   	pop    %ebp
+  8008be:	c3                   	ret
+
+008008bf <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008bf:	55                   	push   %ebp
+  8008c0:	89 e5                	mov    %esp,%ebp
+  8008c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8008c9:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8008cc:	38 ca                	cmp    %cl,%dl
+  8008ce:	74 09                	je     8008d9 <strfind+0x1a>
+  8008d0:	84 d2                	test   %dl,%dl
+  8008d2:	74 05                	je     8008d9 <strfind+0x1a>
+  for (; *s; s++)
+  8008d4:	83 c0 01             	add    $0x1,%eax
+  8008d7:	eb f0                	jmp    8008c9 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8008d9:	5d                   	pop    %ebp
+  8008da:	c3                   	ret
+
+008008db <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008db:	55                   	push   %ebp
+  8008dc:	89 e5                	mov    %esp,%ebp
+  8008de:	57                   	push   %edi
+  8008df:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008e2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  8008e5:	85 c9                	test   %ecx,%ecx
+  8008e7:	74 20                	je     800909 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8008e9:	89 f8                	mov    %edi,%eax
+  8008eb:	09 c8                	or     %ecx,%eax
+  8008ed:	a8 03                	test   $0x3,%al
+  8008ef:	75 12                	jne    800903 <memset+0x28>
+    c &= 0xFF;
+  8008f1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008f5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8008fb:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8008fe:	fc                   	cld
+  8008ff:	f3 ab                	rep stos %eax,%es:(%edi)
+  800901:	eb 06                	jmp    800909 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800903:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800906:	fc                   	cld
+  800907:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800909:	89 f8                	mov    %edi,%eax
+  80090b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80090e:	c9                   	leave
+  80090f:	c3                   	ret
+
+00800910 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800910:	55                   	push   %ebp
+  800911:	89 e5                	mov    %esp,%ebp
+  800913:	57                   	push   %edi
+  800914:	56                   	push   %esi
+  800915:	8b 45 08             	mov    0x8(%ebp),%eax
+  800918:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80091b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  80091e:	39 c6                	cmp    %eax,%esi
+  800920:	73 32                	jae    800954 <memmove+0x44>
+  800922:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800925:	39 d0                	cmp    %edx,%eax
+  800927:	73 2b                	jae    800954 <memmove+0x44>
+    s += n;
+    d += n;
+  800929:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80092c:	89 d6                	mov    %edx,%esi
+  80092e:	09 fe                	or     %edi,%esi
+  800930:	09 ce                	or     %ecx,%esi
+  800932:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800938:	75 0e                	jne    800948 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80093a:	83 ef 04             	sub    $0x4,%edi
+  80093d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800940:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800943:	fd                   	std
+  800944:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800946:	eb 09                	jmp    800951 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800948:	83 ef 01             	sub    $0x1,%edi
+  80094b:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  80094e:	fd                   	std
+  80094f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800951:	fc                   	cld
+  800952:	eb 1a                	jmp    80096e <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800954:	89 f2                	mov    %esi,%edx
+  800956:	09 c2                	or     %eax,%edx
+  800958:	09 ca                	or     %ecx,%edx
+  80095a:	f6 c2 03             	test   $0x3,%dl
+  80095d:	75 0a                	jne    800969 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80095f:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800962:	89 c7                	mov    %eax,%edi
+  800964:	fc                   	cld
+  800965:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800967:	eb 05                	jmp    80096e <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800969:	89 c7                	mov    %eax,%edi
+  80096b:	fc                   	cld
+  80096c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  80096e:	5e                   	pop    %esi
+  80096f:	5f                   	pop    %edi
+  800970:	5d                   	pop    %ebp
+  800971:	c3                   	ret
+
+00800972 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800972:	55                   	push   %ebp
+  800973:	89 e5                	mov    %esp,%ebp
+  800975:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800978:	ff 75 10             	push   0x10(%ebp)
+  80097b:	ff 75 0c             	push   0xc(%ebp)
+  80097e:	ff 75 08             	push   0x8(%ebp)
+  800981:	e8 8a ff ff ff       	call   800910 <memmove>
+}
+  800986:	c9                   	leave
+  800987:	c3                   	ret
+
+00800988 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800988:	55                   	push   %ebp
+  800989:	89 e5                	mov    %esp,%ebp
+  80098b:	56                   	push   %esi
+  80098c:	53                   	push   %ebx
+  80098d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800990:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800993:	89 c6                	mov    %eax,%esi
+  800995:	03 75 10             	add    0x10(%ebp),%esi
+  800998:	eb 06                	jmp    8009a0 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  80099a:	83 c0 01             	add    $0x1,%eax
+  80099d:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  8009a0:	39 f0                	cmp    %esi,%eax
+  8009a2:	74 14                	je     8009b8 <memcmp+0x30>
+    if (*s1 != *s2)
+  8009a4:	0f b6 08             	movzbl (%eax),%ecx
+  8009a7:	0f b6 1a             	movzbl (%edx),%ebx
+  8009aa:	38 d9                	cmp    %bl,%cl
+  8009ac:	74 ec                	je     80099a <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  8009ae:	0f b6 c1             	movzbl %cl,%eax
+  8009b1:	0f b6 db             	movzbl %bl,%ebx
+  8009b4:	29 d8                	sub    %ebx,%eax
+  8009b6:	eb 05                	jmp    8009bd <memcmp+0x35>
+  }
+
+  return 0;
+  8009b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009bd:	5b                   	pop    %ebx
+  8009be:	5e                   	pop    %esi
+  8009bf:	5d                   	pop    %ebp
+  8009c0:	c3                   	ret
+
+008009c1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009c1:	55                   	push   %ebp
+  8009c2:	89 e5                	mov    %esp,%ebp
+  8009c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  8009ca:	89 c2                	mov    %eax,%edx
+  8009cc:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  8009cf:	eb 03                	jmp    8009d4 <memfind+0x13>
+  8009d1:	83 c0 01             	add    $0x1,%eax
+  8009d4:	39 d0                	cmp    %edx,%eax
+  8009d6:	73 04                	jae    8009dc <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  8009d8:	38 08                	cmp    %cl,(%eax)
+  8009da:	75 f5                	jne    8009d1 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  8009dc:	5d                   	pop    %ebp
+  8009dd:	c3                   	ret
+
+008009de <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009de:	55                   	push   %ebp
+  8009df:	89 e5                	mov    %esp,%ebp
+  8009e1:	57                   	push   %edi
+  8009e2:	56                   	push   %esi
+  8009e3:	53                   	push   %ebx
+  8009e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8009ea:	eb 03                	jmp    8009ef <strtol+0x11>
+    s++;
+  8009ec:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  8009ef:	0f b6 02             	movzbl (%edx),%eax
+  8009f2:	3c 20                	cmp    $0x20,%al
+  8009f4:	74 f6                	je     8009ec <strtol+0xe>
+  8009f6:	3c 09                	cmp    $0x9,%al
+  8009f8:	74 f2                	je     8009ec <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  8009fa:	3c 2b                	cmp    $0x2b,%al
+  8009fc:	74 2a                	je     800a28 <strtol+0x4a>
+  int neg = 0;
+  8009fe:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800a03:	3c 2d                	cmp    $0x2d,%al
+  800a05:	74 2b                	je     800a32 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a07:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a0d:	75 0f                	jne    800a1e <strtol+0x40>
+  800a0f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a12:	74 28                	je     800a3c <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800a14:	85 db                	test   %ebx,%ebx
+  800a16:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a1b:	0f 44 d8             	cmove  %eax,%ebx
+  800a1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a23:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a26:	eb 46                	jmp    800a6e <strtol+0x90>
+    s++;
+  800a28:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800a2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a30:	eb d5                	jmp    800a07 <strtol+0x29>
+    s++, neg = 1;
+  800a32:	83 c2 01             	add    $0x1,%edx
+  800a35:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a3a:	eb cb                	jmp    800a07 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a3c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a40:	74 0e                	je     800a50 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800a42:	85 db                	test   %ebx,%ebx
+  800a44:	75 d8                	jne    800a1e <strtol+0x40>
+    s++, base = 8;
+  800a46:	83 c2 01             	add    $0x1,%edx
+  800a49:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a4e:	eb ce                	jmp    800a1e <strtol+0x40>
+    s += 2, base = 16;
+  800a50:	83 c2 02             	add    $0x2,%edx
+  800a53:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a58:	eb c4                	jmp    800a1e <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800a5a:	0f be c0             	movsbl %al,%eax
+  800a5d:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800a60:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a63:	7d 3a                	jge    800a9f <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800a65:	83 c2 01             	add    $0x1,%edx
+  800a68:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a6c:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800a6e:	0f b6 02             	movzbl (%edx),%eax
+  800a71:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a74:	89 f3                	mov    %esi,%ebx
+  800a76:	80 fb 09             	cmp    $0x9,%bl
+  800a79:	76 df                	jbe    800a5a <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800a7b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a7e:	89 f3                	mov    %esi,%ebx
+  800a80:	80 fb 19             	cmp    $0x19,%bl
+  800a83:	77 08                	ja     800a8d <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800a85:	0f be c0             	movsbl %al,%eax
+  800a88:	83 e8 57             	sub    $0x57,%eax
+  800a8b:	eb d3                	jmp    800a60 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800a8d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a90:	89 f3                	mov    %esi,%ebx
+  800a92:	80 fb 19             	cmp    $0x19,%bl
+  800a95:	77 08                	ja     800a9f <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800a97:	0f be c0             	movsbl %al,%eax
+  800a9a:	83 e8 37             	sub    $0x37,%eax
+  800a9d:	eb c1                	jmp    800a60 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800a9f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800aa3:	74 05                	je     800aaa <strtol+0xcc>
+    *endptr = (char*)s;
+  800aa5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aa8:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800aaa:	89 c8                	mov    %ecx,%eax
+  800aac:	f7 d8                	neg    %eax
+  800aae:	85 ff                	test   %edi,%edi
+  800ab0:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ab3:	89 c8                	mov    %ecx,%eax
+  800ab5:	5b                   	pop    %ebx
+  800ab6:	5e                   	pop    %esi
+  800ab7:	5f                   	pop    %edi
+  800ab8:	5d                   	pop    %ebp
+  800ab9:	c3                   	ret
+
+00800aba <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800aba:	55                   	push   %ebp
+  800abb:	89 e5                	mov    %esp,%ebp
+  800abd:	57                   	push   %edi
+  800abe:	56                   	push   %esi
+  800abf:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800acb:	89 c3                	mov    %eax,%ebx
+  800acd:	89 c7                	mov    %eax,%edi
+  800acf:	89 c6                	mov    %eax,%esi
+  800ad1:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ad3:	5b                   	pop    %ebx
+  800ad4:	5e                   	pop    %esi
+  800ad5:	5f                   	pop    %edi
+  800ad6:	5d                   	pop    %ebp
+  800ad7:	c3                   	ret
+
+00800ad8 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ad8:	55                   	push   %ebp
+  800ad9:	89 e5                	mov    %esp,%ebp
+  800adb:	57                   	push   %edi
+  800adc:	56                   	push   %esi
+  800add:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ade:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ae3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ae8:	89 d1                	mov    %edx,%ecx
+  800aea:	89 d3                	mov    %edx,%ebx
+  800aec:	89 d7                	mov    %edx,%edi
+  800aee:	89 d6                	mov    %edx,%esi
+  800af0:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800af2:	5b                   	pop    %ebx
+  800af3:	5e                   	pop    %esi
+  800af4:	5f                   	pop    %edi
+  800af5:	5d                   	pop    %ebp
+  800af6:	c3                   	ret
+
+00800af7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800af7:	55                   	push   %ebp
+  800af8:	89 e5                	mov    %esp,%ebp
+  800afa:	57                   	push   %edi
+  800afb:	56                   	push   %esi
+  800afc:	53                   	push   %ebx
+  800afd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b08:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b0d:	89 cb                	mov    %ecx,%ebx
+  800b0f:	89 cf                	mov    %ecx,%edi
+  800b11:	89 ce                	mov    %ecx,%esi
+  800b13:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b15:	85 c0                	test   %eax,%eax
+  800b17:	7f 08                	jg     800b21 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b1c:	5b                   	pop    %ebx
+  800b1d:	5e                   	pop    %esi
+  800b1e:	5f                   	pop    %edi
+  800b1f:	5d                   	pop    %ebp
+  800b20:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b21:	83 ec 0c             	sub    $0xc,%esp
+  800b24:	50                   	push   %eax
+  800b25:	6a 03                	push   $0x3
+  800b27:	68 43 32 80 00       	push   $0x803243
+  800b2c:	6a 23                	push   $0x23
+  800b2e:	68 60 32 80 00       	push   $0x803260
+  800b33:	e8 41 1f 00 00       	call   802a79 <_panic>
+
+00800b38 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b38:	55                   	push   %ebp
+  800b39:	89 e5                	mov    %esp,%ebp
+  800b3b:	57                   	push   %edi
+  800b3c:	56                   	push   %esi
+  800b3d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b43:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b48:	89 d1                	mov    %edx,%ecx
+  800b4a:	89 d3                	mov    %edx,%ebx
+  800b4c:	89 d7                	mov    %edx,%edi
+  800b4e:	89 d6                	mov    %edx,%esi
+  800b50:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b52:	5b                   	pop    %ebx
+  800b53:	5e                   	pop    %esi
+  800b54:	5f                   	pop    %edi
+  800b55:	5d                   	pop    %ebp
+  800b56:	c3                   	ret
+
+00800b57 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b57:	55                   	push   %ebp
+  800b58:	89 e5                	mov    %esp,%ebp
+  800b5a:	57                   	push   %edi
+  800b5b:	56                   	push   %esi
+  800b5c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b62:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b67:	89 d1                	mov    %edx,%ecx
+  800b69:	89 d3                	mov    %edx,%ebx
+  800b6b:	89 d7                	mov    %edx,%edi
+  800b6d:	89 d6                	mov    %edx,%esi
+  800b6f:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b71:	5b                   	pop    %ebx
+  800b72:	5e                   	pop    %esi
+  800b73:	5f                   	pop    %edi
+  800b74:	5d                   	pop    %ebp
+  800b75:	c3                   	ret
+
+00800b76 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800b76:	55                   	push   %ebp
+  800b77:	89 e5                	mov    %esp,%ebp
+  800b79:	57                   	push   %edi
+  800b7a:	56                   	push   %esi
+  800b7b:	53                   	push   %ebx
+  800b7c:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800b7f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800b83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b8b:	b8 14 00 00 00       	mov    $0x14,%eax
+  800b90:	89 df                	mov    %ebx,%edi
+  800b92:	89 de                	mov    %ebx,%esi
+  800b94:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b96:	85 c0                	test   %eax,%eax
+  800b98:	7f 08                	jg     800ba2 <sys_env_set_cow+0x2c>
+}
+  800b9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b9d:	5b                   	pop    %ebx
+  800b9e:	5e                   	pop    %esi
+  800b9f:	5f                   	pop    %edi
+  800ba0:	5d                   	pop    %ebp
+  800ba1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ba2:	83 ec 0c             	sub    $0xc,%esp
+  800ba5:	50                   	push   %eax
+  800ba6:	6a 14                	push   $0x14
+  800ba8:	68 43 32 80 00       	push   $0x803243
+  800bad:	6a 23                	push   $0x23
+  800baf:	68 60 32 80 00       	push   $0x803260
+  800bb4:	e8 c0 1e 00 00       	call   802a79 <_panic>
+
+00800bb9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bb9:	55                   	push   %ebp
+  800bba:	89 e5                	mov    %esp,%ebp
+  800bbc:	57                   	push   %edi
+  800bbd:	56                   	push   %esi
+  800bbe:	53                   	push   %ebx
+  800bbf:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800bc2:	be 00 00 00 00       	mov    $0x0,%esi
+  800bc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bcd:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bd2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bd5:	89 f7                	mov    %esi,%edi
+  800bd7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bd9:	85 c0                	test   %eax,%eax
+  800bdb:	7f 08                	jg     800be5 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800bdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be0:	5b                   	pop    %ebx
+  800be1:	5e                   	pop    %esi
+  800be2:	5f                   	pop    %edi
+  800be3:	5d                   	pop    %ebp
+  800be4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800be5:	83 ec 0c             	sub    $0xc,%esp
+  800be8:	50                   	push   %eax
+  800be9:	6a 04                	push   $0x4
+  800beb:	68 43 32 80 00       	push   $0x803243
+  800bf0:	6a 23                	push   $0x23
+  800bf2:	68 60 32 80 00       	push   $0x803260
+  800bf7:	e8 7d 1e 00 00       	call   802a79 <_panic>
+
+00800bfc <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800bfc:	55                   	push   %ebp
+  800bfd:	89 e5                	mov    %esp,%ebp
+  800bff:	57                   	push   %edi
+  800c00:	56                   	push   %esi
+  800c01:	53                   	push   %ebx
+  800c02:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c0b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c13:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c16:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c19:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c1b:	85 c0                	test   %eax,%eax
+  800c1d:	7f 08                	jg     800c27 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800c1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c22:	5b                   	pop    %ebx
+  800c23:	5e                   	pop    %esi
+  800c24:	5f                   	pop    %edi
+  800c25:	5d                   	pop    %ebp
+  800c26:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c27:	83 ec 0c             	sub    $0xc,%esp
+  800c2a:	50                   	push   %eax
+  800c2b:	6a 05                	push   $0x5
+  800c2d:	68 43 32 80 00       	push   $0x803243
+  800c32:	6a 23                	push   $0x23
+  800c34:	68 60 32 80 00       	push   $0x803260
+  800c39:	e8 3b 1e 00 00       	call   802a79 <_panic>
+
+00800c3e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c3e:	55                   	push   %ebp
+  800c3f:	89 e5                	mov    %esp,%ebp
+  800c41:	57                   	push   %edi
+  800c42:	56                   	push   %esi
+  800c43:	53                   	push   %ebx
+  800c44:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c52:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c57:	89 df                	mov    %ebx,%edi
+  800c59:	89 de                	mov    %ebx,%esi
+  800c5b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c5d:	85 c0                	test   %eax,%eax
+  800c5f:	7f 08                	jg     800c69 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800c61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c64:	5b                   	pop    %ebx
+  800c65:	5e                   	pop    %esi
+  800c66:	5f                   	pop    %edi
+  800c67:	5d                   	pop    %ebp
+  800c68:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c69:	83 ec 0c             	sub    $0xc,%esp
+  800c6c:	50                   	push   %eax
+  800c6d:	6a 06                	push   $0x6
+  800c6f:	68 43 32 80 00       	push   $0x803243
+  800c74:	6a 23                	push   $0x23
+  800c76:	68 60 32 80 00       	push   $0x803260
+  800c7b:	e8 f9 1d 00 00       	call   802a79 <_panic>
+
+00800c80 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800c80:	55                   	push   %ebp
+  800c81:	89 e5                	mov    %esp,%ebp
+  800c83:	57                   	push   %edi
+  800c84:	56                   	push   %esi
+  800c85:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800c91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c94:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c97:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c9a:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800c9c:	5b                   	pop    %ebx
+  800c9d:	5e                   	pop    %esi
+  800c9e:	5f                   	pop    %edi
+  800c9f:	5d                   	pop    %ebp
+  800ca0:	c3                   	ret
+
+00800ca1 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800ca1:	55                   	push   %ebp
+  800ca2:	89 e5                	mov    %esp,%ebp
+  800ca4:	57                   	push   %edi
+  800ca5:	56                   	push   %esi
+  800ca6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ca7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800caa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cad:	b8 12 00 00 00       	mov    $0x12,%eax
+  800cb2:	be 00 00 00 00       	mov    $0x0,%esi
+  800cb7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cba:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cbd:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800cbf:	5b                   	pop    %ebx
+  800cc0:	5e                   	pop    %esi
+  800cc1:	5f                   	pop    %edi
+  800cc2:	5d                   	pop    %ebp
+  800cc3:	c3                   	ret
+
+00800cc4 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800cc4:	55                   	push   %ebp
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	57                   	push   %edi
+  800cc8:	56                   	push   %esi
+  800cc9:	53                   	push   %ebx
+  800cca:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ccd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd8:	b8 16 00 00 00       	mov    $0x16,%eax
+  800cdd:	89 df                	mov    %ebx,%edi
+  800cdf:	89 de                	mov    %ebx,%esi
+  800ce1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ce3:	85 c0                	test   %eax,%eax
+  800ce5:	7f 08                	jg     800cef <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800ce7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cea:	5b                   	pop    %ebx
+  800ceb:	5e                   	pop    %esi
+  800cec:	5f                   	pop    %edi
+  800ced:	5d                   	pop    %ebp
+  800cee:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cef:	83 ec 0c             	sub    $0xc,%esp
+  800cf2:	50                   	push   %eax
+  800cf3:	6a 16                	push   $0x16
+  800cf5:	68 43 32 80 00       	push   $0x803243
+  800cfa:	6a 23                	push   $0x23
+  800cfc:	68 60 32 80 00       	push   $0x803260
+  800d01:	e8 73 1d 00 00       	call   802a79 <_panic>
+
+00800d06 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800d06:	55                   	push   %ebp
+  800d07:	89 e5                	mov    %esp,%ebp
+  800d09:	57                   	push   %edi
+  800d0a:	56                   	push   %esi
+  800d0b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d14:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d19:	89 cb                	mov    %ecx,%ebx
+  800d1b:	89 cf                	mov    %ecx,%edi
+  800d1d:	89 ce                	mov    %ecx,%esi
+  800d1f:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800d21:	5b                   	pop    %ebx
+  800d22:	5e                   	pop    %esi
+  800d23:	5f                   	pop    %edi
+  800d24:	5d                   	pop    %ebp
+  800d25:	c3                   	ret
+
+00800d26 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800d26:	55                   	push   %ebp
+  800d27:	89 e5                	mov    %esp,%ebp
+  800d29:	57                   	push   %edi
+  800d2a:	56                   	push   %esi
+  800d2b:	53                   	push   %ebx
+  800d2c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d2f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3a:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d42:	89 f7                	mov    %esi,%edi
+  800d44:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d46:	85 c0                	test   %eax,%eax
+  800d48:	7f 08                	jg     800d52 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800d4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4d:	5b                   	pop    %ebx
+  800d4e:	5e                   	pop    %esi
+  800d4f:	5f                   	pop    %edi
+  800d50:	5d                   	pop    %ebp
+  800d51:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d52:	83 ec 0c             	sub    $0xc,%esp
+  800d55:	50                   	push   %eax
+  800d56:	6a 18                	push   $0x18
+  800d58:	68 43 32 80 00       	push   $0x803243
+  800d5d:	6a 23                	push   $0x23
+  800d5f:	68 60 32 80 00       	push   $0x803260
+  800d64:	e8 10 1d 00 00       	call   802a79 <_panic>
+
+00800d69 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800d69:	55                   	push   %ebp
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	57                   	push   %edi
+  800d6d:	56                   	push   %esi
+  800d6e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d6f:	be 00 00 00 00       	mov    $0x0,%esi
+  800d74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d7a:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d82:	89 f7                	mov    %esi,%edi
+  800d84:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800d86:	5b                   	pop    %ebx
+  800d87:	5e                   	pop    %esi
+  800d88:	5f                   	pop    %edi
+  800d89:	5d                   	pop    %ebp
+  800d8a:	c3                   	ret
+
+00800d8b <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800d8b:	55                   	push   %ebp
+  800d8c:	89 e5                	mov    %esp,%ebp
+  800d8e:	57                   	push   %edi
+  800d8f:	56                   	push   %esi
+  800d90:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d91:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d96:	b8 15 00 00 00       	mov    $0x15,%eax
+  800d9b:	89 d1                	mov    %edx,%ecx
+  800d9d:	89 d3                	mov    %edx,%ebx
+  800d9f:	89 d7                	mov    %edx,%edi
+  800da1:	89 d6                	mov    %edx,%esi
+  800da3:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800da5:	5b                   	pop    %ebx
+  800da6:	5e                   	pop    %esi
+  800da7:	5f                   	pop    %edi
+  800da8:	5d                   	pop    %ebp
+  800da9:	c3                   	ret
+
+00800daa <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	57                   	push   %edi
+  800dae:	56                   	push   %esi
+  800daf:	53                   	push   %ebx
+  800db0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800db3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbe:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dc3:	89 df                	mov    %ebx,%edi
+  800dc5:	89 de                	mov    %ebx,%esi
+  800dc7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dc9:	85 c0                	test   %eax,%eax
+  800dcb:	7f 08                	jg     800dd5 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800dcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd0:	5b                   	pop    %ebx
+  800dd1:	5e                   	pop    %esi
+  800dd2:	5f                   	pop    %edi
+  800dd3:	5d                   	pop    %ebp
+  800dd4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dd5:	83 ec 0c             	sub    $0xc,%esp
+  800dd8:	50                   	push   %eax
+  800dd9:	6a 08                	push   $0x8
+  800ddb:	68 43 32 80 00       	push   $0x803243
+  800de0:	6a 23                	push   $0x23
+  800de2:	68 60 32 80 00       	push   $0x803260
+  800de7:	e8 8d 1c 00 00       	call   802a79 <_panic>
+
+00800dec <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	57                   	push   %edi
+  800df0:	56                   	push   %esi
+  800df1:	53                   	push   %ebx
+  800df2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800df5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e00:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e05:	89 df                	mov    %ebx,%edi
+  800e07:	89 de                	mov    %ebx,%esi
+  800e09:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e0b:	85 c0                	test   %eax,%eax
+  800e0d:	7f 08                	jg     800e17 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e12:	5b                   	pop    %ebx
+  800e13:	5e                   	pop    %esi
+  800e14:	5f                   	pop    %edi
+  800e15:	5d                   	pop    %ebp
+  800e16:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e17:	83 ec 0c             	sub    $0xc,%esp
+  800e1a:	50                   	push   %eax
+  800e1b:	6a 09                	push   $0x9
+  800e1d:	68 43 32 80 00       	push   $0x803243
+  800e22:	6a 23                	push   $0x23
+  800e24:	68 60 32 80 00       	push   $0x803260
+  800e29:	e8 4b 1c 00 00       	call   802a79 <_panic>
+
+00800e2e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e2e:	55                   	push   %ebp
+  800e2f:	89 e5                	mov    %esp,%ebp
+  800e31:	57                   	push   %edi
+  800e32:	56                   	push   %esi
+  800e33:	53                   	push   %ebx
+  800e34:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e42:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e47:	89 df                	mov    %ebx,%edi
+  800e49:	89 de                	mov    %ebx,%esi
+  800e4b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e4d:	85 c0                	test   %eax,%eax
+  800e4f:	7f 08                	jg     800e59 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800e51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e54:	5b                   	pop    %ebx
+  800e55:	5e                   	pop    %esi
+  800e56:	5f                   	pop    %edi
+  800e57:	5d                   	pop    %ebp
+  800e58:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e59:	83 ec 0c             	sub    $0xc,%esp
+  800e5c:	50                   	push   %eax
+  800e5d:	6a 0a                	push   $0xa
+  800e5f:	68 43 32 80 00       	push   $0x803243
+  800e64:	6a 23                	push   $0x23
+  800e66:	68 60 32 80 00       	push   $0x803260
+  800e6b:	e8 09 1c 00 00       	call   802a79 <_panic>
+
+00800e70 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	57                   	push   %edi
+  800e74:	56                   	push   %esi
+  800e75:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e84:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e87:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e8a:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800e8c:	5b                   	pop    %ebx
+  800e8d:	5e                   	pop    %esi
+  800e8e:	5f                   	pop    %edi
+  800e8f:	5d                   	pop    %ebp
+  800e90:	c3                   	ret
+
+00800e91 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800e91:	55                   	push   %ebp
+  800e92:	89 e5                	mov    %esp,%ebp
+  800e94:	57                   	push   %edi
+  800e95:	56                   	push   %esi
+  800e96:	53                   	push   %ebx
+  800e97:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eaa:	89 df                	mov    %ebx,%edi
+  800eac:	89 de                	mov    %ebx,%esi
+  800eae:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800eb0:	85 c0                	test   %eax,%eax
+  800eb2:	7f 08                	jg     800ebc <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800eb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb7:	5b                   	pop    %ebx
+  800eb8:	5e                   	pop    %esi
+  800eb9:	5f                   	pop    %edi
+  800eba:	5d                   	pop    %ebp
+  800ebb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ebc:	83 ec 0c             	sub    $0xc,%esp
+  800ebf:	50                   	push   %eax
+  800ec0:	6a 0d                	push   $0xd
+  800ec2:	68 43 32 80 00       	push   $0x803243
+  800ec7:	6a 23                	push   $0x23
+  800ec9:	68 60 32 80 00       	push   $0x803260
+  800ece:	e8 a6 1b 00 00       	call   802a79 <_panic>
+
+00800ed3 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800ed3:	55                   	push   %ebp
+  800ed4:	89 e5                	mov    %esp,%ebp
+  800ed6:	57                   	push   %edi
+  800ed7:	56                   	push   %esi
+  800ed8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ed9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ede:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ee3:	89 d1                	mov    %edx,%ecx
+  800ee5:	89 d3                	mov    %edx,%ebx
+  800ee7:	89 d7                	mov    %edx,%edi
+  800ee9:	89 d6                	mov    %edx,%esi
+  800eeb:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800eed:	5b                   	pop    %ebx
+  800eee:	5e                   	pop    %esi
+  800eef:	5f                   	pop    %edi
+  800ef0:	5d                   	pop    %ebp
+  800ef1:	c3                   	ret
+
+00800ef2 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800ef2:	55                   	push   %ebp
+  800ef3:	89 e5                	mov    %esp,%ebp
+  800ef5:	57                   	push   %edi
+  800ef6:	56                   	push   %esi
+  800ef7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ef8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efe:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f03:	be 00 00 00 00       	mov    $0x0,%esi
+  800f08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f0b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f0e:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800f10:	5b                   	pop    %ebx
+  800f11:	5e                   	pop    %esi
+  800f12:	5f                   	pop    %edi
+  800f13:	5d                   	pop    %ebp
+  800f14:	c3                   	ret
+
+00800f15 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800f15:	55                   	push   %ebp
+  800f16:	89 e5                	mov    %esp,%ebp
+  800f18:	57                   	push   %edi
+  800f19:	56                   	push   %esi
+  800f1a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f1b:	be 00 00 00 00       	mov    $0x0,%esi
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f26:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2e:	89 f7                	mov    %esi,%edi
+  800f30:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800f32:	5b                   	pop    %ebx
+  800f33:	5e                   	pop    %esi
+  800f34:	5f                   	pop    %edi
+  800f35:	5d                   	pop    %ebp
+  800f36:	c3                   	ret
+
+00800f37 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800f37:	55                   	push   %ebp
+  800f38:	89 e5                	mov    %esp,%ebp
+  800f3a:	57                   	push   %edi
+  800f3b:	56                   	push   %esi
+  800f3c:	53                   	push   %ebx
+  800f3d:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800f40:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800f47:	74 41                	je     800f8a <sys_batch+0x53>
+  800f49:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800f4f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800f56:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f59:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800f5c:	7d 45                	jge    800fa3 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800f5e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f61:	8b 06                	mov    (%esi),%eax
+  800f63:	8b 56 04             	mov    0x4(%esi),%edx
+  800f66:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800f69:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800f6c:	8b 7e 10             	mov    0x10(%esi),%edi
+  800f6f:	8b 76 14             	mov    0x14(%esi),%esi
+  800f72:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800f74:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f77:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800f7a:	83 c6 1c             	add    $0x1c,%esi
+  800f7d:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800f80:	85 c0                	test   %eax,%eax
+  800f82:	78 1f                	js     800fa3 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800f84:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800f88:	eb cc                	jmp    800f56 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800f8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8f:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f94:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9a:	89 df                	mov    %ebx,%edi
+  800f9c:	89 de                	mov    %ebx,%esi
+  800f9e:	cd 30                	int    $0x30
+  800fa0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  800fa3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800fa6:	83 c4 08             	add    $0x8,%esp
+  800fa9:	5b                   	pop    %ebx
+  800faa:	5e                   	pop    %esi
+  800fab:	5f                   	pop    %edi
+  800fac:	5d                   	pop    %ebp
+  800fad:	c3                   	ret
+
+00800fae <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  800fb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fb4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  800fba:	5d                   	pop    %ebp
+  800fbb:	c3                   	ret
+
+00800fbc <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  800fbc:	55                   	push   %ebp
+  800fbd:	89 e5                	mov    %esp,%ebp
+  800fbf:	56                   	push   %esi
+  800fc0:	53                   	push   %ebx
+  800fc1:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  800fc4:	8b 1e                	mov    (%esi),%ebx
+  800fc6:	85 db                	test   %ebx,%ebx
+  800fc8:	75 09                	jne    800fd3 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  800fca:	89 d8                	mov    %ebx,%eax
+  800fcc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fcf:	5b                   	pop    %ebx
+  800fd0:	5e                   	pop    %esi
+  800fd1:	5d                   	pop    %ebp
+  800fd2:	c3                   	ret
+  b->sb_n = 0;
+  800fd3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  800fd9:	53                   	push   %ebx
+  800fda:	8d 46 04             	lea    0x4(%esi),%eax
+  800fdd:	50                   	push   %eax
+  800fde:	e8 54 ff ff ff       	call   800f37 <sys_batch>
+  800fe3:	83 c4 08             	add    $0x8,%esp
+  800fe6:	85 c0                	test   %eax,%eax
+  800fe8:	78 1e                	js     801008 <sysbatch_flush+0x4c>
+  if (r < n)
+  800fea:	39 c3                	cmp    %eax,%ebx
+  800fec:	7f 07                	jg     800ff5 <sysbatch_flush+0x39>
+  return 0;
+  800fee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff3:	eb d5                	jmp    800fca <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  800ff5:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800ff8:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  800ffc:	85 db                	test   %ebx,%ebx
+  800ffe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801003:	0f 49 d8             	cmovns %eax,%ebx
+  801006:	eb c2                	jmp    800fca <sysbatch_flush+0xe>
+    return r;
+  801008:	89 c3                	mov    %eax,%ebx
+  80100a:	eb be                	jmp    800fca <sysbatch_flush+0xe>
+
+0080100c <sysbatch_add>:
+{
+  80100c:	55                   	push   %ebp
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	53                   	push   %ebx
+  801010:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801013:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801016:	74 41                	je     801059 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801018:	8b 03                	mov    (%ebx),%eax
+  80101a:	8d 50 01             	lea    0x1(%eax),%edx
+  80101d:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80101f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801022:	01 d8                	add    %ebx,%eax
+  801024:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801027:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80102a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80102d:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801030:	8b 55 14             	mov    0x14(%ebp),%edx
+  801033:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801036:	8b 55 18             	mov    0x18(%ebp),%edx
+  801039:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  80103c:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80103f:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801042:	8b 55 20             	mov    0x20(%ebp),%edx
+  801045:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801048:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80104f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801054:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801057:	c9                   	leave
+  801058:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801059:	53                   	push   %ebx
+  80105a:	e8 5d ff ff ff       	call   800fbc <sysbatch_flush>
+  80105f:	83 c4 04             	add    $0x4,%esp
+  801062:	85 c0                	test   %eax,%eax
+  801064:	79 b2                	jns    801018 <sysbatch_add+0xc>
+  801066:	eb ec                	jmp    801054 <sysbatch_add+0x48>
+
+00801068 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801068:	55                   	push   %ebp
+  801069:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80106b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80106e:	05 00 00 00 30       	add    $0x30000000,%eax
+  801073:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801076:	5d                   	pop    %ebp
+  801077:	c3                   	ret
+
+00801078 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801078:	55                   	push   %ebp
+  801079:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80107b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80107e:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801081:	66 b8 00 00          	mov    $0x0,%ax
+  801085:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80108a:	5d                   	pop    %ebp
+  80108b:	c3                   	ret
+
+0080108c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80108c:	55                   	push   %ebp
+  80108d:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80108f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801094:	eb 02                	jmp    801098 <fd_alloc+0xc>
+  801096:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801098:	89 c2                	mov    %eax,%edx
+  80109a:	c1 ea 16             	shr    $0x16,%edx
+  80109d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8010a4:	f6 c2 01             	test   $0x1,%dl
+  8010a7:	74 2b                	je     8010d4 <fd_alloc+0x48>
+  8010a9:	89 c2                	mov    %eax,%edx
+  8010ab:	c1 ea 0c             	shr    $0xc,%edx
+  8010ae:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8010b5:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8010bb:	f6 c1 01             	test   $0x1,%cl
+  8010be:	74 14                	je     8010d4 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8010c0:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8010c6:	75 ce                	jne    801096 <fd_alloc+0xa>
+  8010c8:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8010cd:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8010d2:	eb 05                	jmp    8010d9 <fd_alloc+0x4d>
+      return 0;
+  8010d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8010d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010dc:	89 02                	mov    %eax,(%edx)
+}
+  8010de:	89 c8                	mov    %ecx,%eax
+  8010e0:	5d                   	pop    %ebp
+  8010e1:	c3                   	ret
+
+008010e2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8010e8:	83 f8 1f             	cmp    $0x1f,%eax
+  8010eb:	77 30                	ja     80111d <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8010ed:	c1 e0 0c             	shl    $0xc,%eax
+  8010f0:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8010f5:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8010fb:	f6 c2 01             	test   $0x1,%dl
+  8010fe:	74 24                	je     801124 <fd_lookup+0x42>
+  801100:	89 c2                	mov    %eax,%edx
+  801102:	c1 ea 0c             	shr    $0xc,%edx
+  801105:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80110c:	f6 c2 01             	test   $0x1,%dl
+  80110f:	74 1a                	je     80112b <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801111:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801114:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801116:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80111b:	5d                   	pop    %ebp
+  80111c:	c3                   	ret
+    return -E_INVAL;
+  80111d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801122:	eb f7                	jmp    80111b <fd_lookup+0x39>
+    return -E_INVAL;
+  801124:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801129:	eb f0                	jmp    80111b <fd_lookup+0x39>
+  80112b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801130:	eb e9                	jmp    80111b <fd_lookup+0x39>
+
+00801132 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801132:	55                   	push   %ebp
+  801133:	89 e5                	mov    %esp,%ebp
+  801135:	53                   	push   %ebx
+  801136:	83 ec 04             	sub    $0x4,%esp
+  801139:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80113c:	b8 ec 32 80 00       	mov    $0x8032ec,%eax
+  801141:	8b 18                	mov    (%eax),%ebx
+  801143:	85 db                	test   %ebx,%ebx
+  801145:	74 0e                	je     801155 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801147:	83 c0 04             	add    $0x4,%eax
+  80114a:	39 13                	cmp    %edx,(%ebx)
+  80114c:	75 f3                	jne    801141 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80114e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801153:	eb 1f                	jmp    801174 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801155:	a1 44 57 80 00       	mov    0x805744,%eax
+  80115a:	8b 40 48             	mov    0x48(%eax),%eax
+  80115d:	83 ec 04             	sub    $0x4,%esp
+  801160:	52                   	push   %edx
+  801161:	50                   	push   %eax
+  801162:	68 70 32 80 00       	push   $0x803270
+  801167:	e8 30 f0 ff ff       	call   80019c <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80116c:	83 c4 10             	add    $0x10,%esp
+  80116f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801174:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801177:	89 1a                	mov    %ebx,(%edx)
+}
+  801179:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80117c:	c9                   	leave
+  80117d:	c3                   	ret
+
+0080117e <fd_close>:
+{
+  80117e:	55                   	push   %ebp
+  80117f:	89 e5                	mov    %esp,%ebp
+  801181:	57                   	push   %edi
+  801182:	56                   	push   %esi
+  801183:	53                   	push   %ebx
+  801184:	83 ec 24             	sub    $0x24,%esp
+  801187:	8b 75 08             	mov    0x8(%ebp),%esi
+  80118a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80118d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801190:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801191:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801197:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80119a:	50                   	push   %eax
+  80119b:	e8 42 ff ff ff       	call   8010e2 <fd_lookup>
+  8011a0:	89 c3                	mov    %eax,%ebx
+  8011a2:	83 c4 10             	add    $0x10,%esp
+  8011a5:	85 c0                	test   %eax,%eax
+  8011a7:	78 05                	js     8011ae <fd_close+0x30>
+      || fd != fd2)
+  8011a9:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011ac:	74 16                	je     8011c4 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8011ae:	89 f8                	mov    %edi,%eax
+  8011b0:	84 c0                	test   %al,%al
+  8011b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b7:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8011ba:	89 d8                	mov    %ebx,%eax
+  8011bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011bf:	5b                   	pop    %ebx
+  8011c0:	5e                   	pop    %esi
+  8011c1:	5f                   	pop    %edi
+  8011c2:	5d                   	pop    %ebp
+  8011c3:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8011c4:	83 ec 08             	sub    $0x8,%esp
+  8011c7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8011ca:	50                   	push   %eax
+  8011cb:	ff 36                	push   (%esi)
+  8011cd:	e8 60 ff ff ff       	call   801132 <dev_lookup>
+  8011d2:	89 c3                	mov    %eax,%ebx
+  8011d4:	83 c4 10             	add    $0x10,%esp
+  8011d7:	85 c0                	test   %eax,%eax
+  8011d9:	78 1a                	js     8011f5 <fd_close+0x77>
+    if (dev->dev_close)
+  8011db:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8011de:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8011e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8011e6:	85 c0                	test   %eax,%eax
+  8011e8:	74 0b                	je     8011f5 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8011ea:	83 ec 0c             	sub    $0xc,%esp
+  8011ed:	56                   	push   %esi
+  8011ee:	ff d0                	call   *%eax
+  8011f0:	89 c3                	mov    %eax,%ebx
+  8011f2:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8011f5:	83 ec 08             	sub    $0x8,%esp
+  8011f8:	56                   	push   %esi
+  8011f9:	6a 00                	push   $0x0
+  8011fb:	e8 3e fa ff ff       	call   800c3e <sys_page_unmap>
+  return r;
+  801200:	83 c4 10             	add    $0x10,%esp
+  801203:	eb b5                	jmp    8011ba <fd_close+0x3c>
+
+00801205 <close>:
+
+int
+close(int fdnum)
+{
+  801205:	55                   	push   %ebp
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80120b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80120e:	50                   	push   %eax
+  80120f:	ff 75 08             	push   0x8(%ebp)
+  801212:	e8 cb fe ff ff       	call   8010e2 <fd_lookup>
+  801217:	83 c4 10             	add    $0x10,%esp
+  80121a:	85 c0                	test   %eax,%eax
+  80121c:	79 02                	jns    801220 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80121e:	c9                   	leave
+  80121f:	c3                   	ret
+    return fd_close(fd, 1);
+  801220:	83 ec 08             	sub    $0x8,%esp
+  801223:	6a 01                	push   $0x1
+  801225:	ff 75 f4             	push   -0xc(%ebp)
+  801228:	e8 51 ff ff ff       	call   80117e <fd_close>
+  80122d:	83 c4 10             	add    $0x10,%esp
+  801230:	eb ec                	jmp    80121e <close+0x19>
+
+00801232 <close_all>:
+
+void
+close_all(void)
+{
+  801232:	55                   	push   %ebp
+  801233:	89 e5                	mov    %esp,%ebp
+  801235:	53                   	push   %ebx
+  801236:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801239:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80123e:	83 ec 0c             	sub    $0xc,%esp
+  801241:	53                   	push   %ebx
+  801242:	e8 be ff ff ff       	call   801205 <close>
+  for (i = 0; i < MAXFD; i++)
+  801247:	83 c3 01             	add    $0x1,%ebx
+  80124a:	83 c4 10             	add    $0x10,%esp
+  80124d:	83 fb 20             	cmp    $0x20,%ebx
+  801250:	75 ec                	jne    80123e <close_all+0xc>
+}
+  801252:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801255:	c9                   	leave
+  801256:	c3                   	ret
+
+00801257 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801257:	55                   	push   %ebp
+  801258:	89 e5                	mov    %esp,%ebp
+  80125a:	57                   	push   %edi
+  80125b:	56                   	push   %esi
+  80125c:	53                   	push   %ebx
+  80125d:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801260:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801263:	50                   	push   %eax
+  801264:	ff 75 08             	push   0x8(%ebp)
+  801267:	e8 76 fe ff ff       	call   8010e2 <fd_lookup>
+  80126c:	89 c6                	mov    %eax,%esi
+  80126e:	83 c4 10             	add    $0x10,%esp
+  801271:	85 c0                	test   %eax,%eax
+  801273:	0f 88 0a 01 00 00    	js     801383 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801279:	83 ec 0c             	sub    $0xc,%esp
+  80127c:	ff 75 0c             	push   0xc(%ebp)
+  80127f:	e8 81 ff ff ff       	call   801205 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801284:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801287:	c1 e0 0c             	shl    $0xc,%eax
+  80128a:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801290:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801293:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801296:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801299:	89 04 24             	mov    %eax,(%esp)
+  80129c:	e8 d7 fd ff ff       	call   801078 <fd2data>
+  8012a1:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8012a3:	89 3c 24             	mov    %edi,(%esp)
+  8012a6:	e8 cd fd ff ff       	call   801078 <fd2data>
+  8012ab:	83 c4 10             	add    $0x10,%esp
+  8012ae:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8012b1:	89 f3                	mov    %esi,%ebx
+  8012b3:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8012b9:	89 c6                	mov    %eax,%esi
+  8012bb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8012be:	89 cf                	mov    %ecx,%edi
+  8012c0:	eb 0c                	jmp    8012ce <dup+0x77>
+  8012c2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8012c8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8012ce:	39 fb                	cmp    %edi,%ebx
+  8012d0:	74 7b                	je     80134d <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8012d2:	89 d8                	mov    %ebx,%eax
+  8012d4:	c1 e8 16             	shr    $0x16,%eax
+  8012d7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012de:	a8 01                	test   $0x1,%al
+  8012e0:	74 e0                	je     8012c2 <dup+0x6b>
+  8012e2:	89 d8                	mov    %ebx,%eax
+  8012e4:	c1 e8 0c             	shr    $0xc,%eax
+  8012e7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012ee:	f6 c2 01             	test   $0x1,%dl
+  8012f1:	74 cf                	je     8012c2 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8012f3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8012fa:	83 ec 0c             	sub    $0xc,%esp
+  8012fd:	25 07 0e 00 00       	and    $0xe07,%eax
+  801302:	50                   	push   %eax
+  801303:	56                   	push   %esi
+  801304:	6a 00                	push   $0x0
+  801306:	53                   	push   %ebx
+  801307:	6a 00                	push   $0x0
+  801309:	e8 ee f8 ff ff       	call   800bfc <sys_page_map>
+  80130e:	83 c4 20             	add    $0x20,%esp
+  801311:	85 c0                	test   %eax,%eax
+  801313:	79 ad                	jns    8012c2 <dup+0x6b>
+  801315:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801318:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  80131a:	83 ec 08             	sub    $0x8,%esp
+  80131d:	ff 75 d4             	push   -0x2c(%ebp)
+  801320:	6a 00                	push   $0x0
+  801322:	e8 17 f9 ff ff       	call   800c3e <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801327:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80132a:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801330:	83 c4 10             	add    $0x10,%esp
+  801333:	39 df                	cmp    %ebx,%edi
+  801335:	74 4c                	je     801383 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801337:	83 ec 08             	sub    $0x8,%esp
+  80133a:	57                   	push   %edi
+  80133b:	6a 00                	push   $0x0
+  80133d:	e8 fc f8 ff ff       	call   800c3e <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801342:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801348:	83 c4 10             	add    $0x10,%esp
+  80134b:	eb e6                	jmp    801333 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80134d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801350:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801353:	89 c8                	mov    %ecx,%eax
+  801355:	c1 e8 0c             	shr    $0xc,%eax
+  801358:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80135f:	83 ec 0c             	sub    $0xc,%esp
+  801362:	25 07 0e 00 00       	and    $0xe07,%eax
+  801367:	50                   	push   %eax
+  801368:	ff 75 d4             	push   -0x2c(%ebp)
+  80136b:	6a 00                	push   $0x0
+  80136d:	51                   	push   %ecx
+  80136e:	6a 00                	push   $0x0
+  801370:	e8 87 f8 ff ff       	call   800bfc <sys_page_map>
+  801375:	89 c6                	mov    %eax,%esi
+  801377:	83 c4 20             	add    $0x20,%esp
+  80137a:	85 c0                	test   %eax,%eax
+  80137c:	78 9c                	js     80131a <dup+0xc3>
+  return newfdnum;
+  80137e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801381:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801383:	89 f0                	mov    %esi,%eax
+  801385:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801388:	5b                   	pop    %ebx
+  801389:	5e                   	pop    %esi
+  80138a:	5f                   	pop    %edi
+  80138b:	5d                   	pop    %ebp
+  80138c:	c3                   	ret
+
+0080138d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80138d:	55                   	push   %ebp
+  80138e:	89 e5                	mov    %esp,%ebp
+  801390:	56                   	push   %esi
+  801391:	53                   	push   %ebx
+  801392:	83 ec 18             	sub    $0x18,%esp
+  801395:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801398:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80139b:	50                   	push   %eax
+  80139c:	56                   	push   %esi
+  80139d:	e8 40 fd ff ff       	call   8010e2 <fd_lookup>
+  8013a2:	83 c4 10             	add    $0x10,%esp
+  8013a5:	85 c0                	test   %eax,%eax
+  8013a7:	78 3c                	js     8013e5 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013a9:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013ac:	83 ec 08             	sub    $0x8,%esp
+  8013af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013b2:	50                   	push   %eax
+  8013b3:	ff 33                	push   (%ebx)
+  8013b5:	e8 78 fd ff ff       	call   801132 <dev_lookup>
+  8013ba:	83 c4 10             	add    $0x10,%esp
+  8013bd:	85 c0                	test   %eax,%eax
+  8013bf:	78 24                	js     8013e5 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8013c1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8013c4:	83 e0 03             	and    $0x3,%eax
+  8013c7:	83 f8 01             	cmp    $0x1,%eax
+  8013ca:	74 20                	je     8013ec <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8013cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013cf:	8b 40 08             	mov    0x8(%eax),%eax
+  8013d2:	85 c0                	test   %eax,%eax
+  8013d4:	74 37                	je     80140d <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8013d6:	83 ec 04             	sub    $0x4,%esp
+  8013d9:	ff 75 10             	push   0x10(%ebp)
+  8013dc:	ff 75 0c             	push   0xc(%ebp)
+  8013df:	53                   	push   %ebx
+  8013e0:	ff d0                	call   *%eax
+  8013e2:	83 c4 10             	add    $0x10,%esp
+}
+  8013e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013e8:	5b                   	pop    %ebx
+  8013e9:	5e                   	pop    %esi
+  8013ea:	5d                   	pop    %ebp
+  8013eb:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013ec:	a1 44 57 80 00       	mov    0x805744,%eax
+  8013f1:	8b 40 48             	mov    0x48(%eax),%eax
+  8013f4:	83 ec 04             	sub    $0x4,%esp
+  8013f7:	56                   	push   %esi
+  8013f8:	50                   	push   %eax
+  8013f9:	68 b1 32 80 00       	push   $0x8032b1
+  8013fe:	e8 99 ed ff ff       	call   80019c <cprintf>
+    return -E_INVAL;
+  801403:	83 c4 10             	add    $0x10,%esp
+  801406:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80140b:	eb d8                	jmp    8013e5 <read+0x58>
+    return -E_NOT_SUPP;
+  80140d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801412:	eb d1                	jmp    8013e5 <read+0x58>
+
+00801414 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801414:	55                   	push   %ebp
+  801415:	89 e5                	mov    %esp,%ebp
+  801417:	57                   	push   %edi
+  801418:	56                   	push   %esi
+  801419:	53                   	push   %ebx
+  80141a:	83 ec 0c             	sub    $0xc,%esp
+  80141d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801420:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801423:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801428:	eb 02                	jmp    80142c <readn+0x18>
+  80142a:	01 c3                	add    %eax,%ebx
+  80142c:	39 f3                	cmp    %esi,%ebx
+  80142e:	73 21                	jae    801451 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801430:	83 ec 04             	sub    $0x4,%esp
+  801433:	89 f0                	mov    %esi,%eax
+  801435:	29 d8                	sub    %ebx,%eax
+  801437:	50                   	push   %eax
+  801438:	89 d8                	mov    %ebx,%eax
+  80143a:	03 45 0c             	add    0xc(%ebp),%eax
+  80143d:	50                   	push   %eax
+  80143e:	57                   	push   %edi
+  80143f:	e8 49 ff ff ff       	call   80138d <read>
+    if (m < 0)
+  801444:	83 c4 10             	add    $0x10,%esp
+  801447:	85 c0                	test   %eax,%eax
+  801449:	78 04                	js     80144f <readn+0x3b>
+      return m;
+    if (m == 0)
+  80144b:	75 dd                	jne    80142a <readn+0x16>
+  80144d:	eb 02                	jmp    801451 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80144f:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801451:	89 d8                	mov    %ebx,%eax
+  801453:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801456:	5b                   	pop    %ebx
+  801457:	5e                   	pop    %esi
+  801458:	5f                   	pop    %edi
+  801459:	5d                   	pop    %ebp
+  80145a:	c3                   	ret
+
+0080145b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80145b:	55                   	push   %ebp
+  80145c:	89 e5                	mov    %esp,%ebp
+  80145e:	56                   	push   %esi
+  80145f:	53                   	push   %ebx
+  801460:	83 ec 18             	sub    $0x18,%esp
+  801463:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801466:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801469:	50                   	push   %eax
+  80146a:	53                   	push   %ebx
+  80146b:	e8 72 fc ff ff       	call   8010e2 <fd_lookup>
+  801470:	83 c4 10             	add    $0x10,%esp
+  801473:	85 c0                	test   %eax,%eax
+  801475:	78 37                	js     8014ae <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801477:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80147a:	83 ec 08             	sub    $0x8,%esp
+  80147d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801480:	50                   	push   %eax
+  801481:	ff 36                	push   (%esi)
+  801483:	e8 aa fc ff ff       	call   801132 <dev_lookup>
+  801488:	83 c4 10             	add    $0x10,%esp
+  80148b:	85 c0                	test   %eax,%eax
+  80148d:	78 1f                	js     8014ae <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80148f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801493:	74 20                	je     8014b5 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801495:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801498:	8b 40 0c             	mov    0xc(%eax),%eax
+  80149b:	85 c0                	test   %eax,%eax
+  80149d:	74 37                	je     8014d6 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  80149f:	83 ec 04             	sub    $0x4,%esp
+  8014a2:	ff 75 10             	push   0x10(%ebp)
+  8014a5:	ff 75 0c             	push   0xc(%ebp)
+  8014a8:	56                   	push   %esi
+  8014a9:	ff d0                	call   *%eax
+  8014ab:	83 c4 10             	add    $0x10,%esp
+}
+  8014ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014b1:	5b                   	pop    %ebx
+  8014b2:	5e                   	pop    %esi
+  8014b3:	5d                   	pop    %ebp
+  8014b4:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014b5:	a1 44 57 80 00       	mov    0x805744,%eax
+  8014ba:	8b 40 48             	mov    0x48(%eax),%eax
+  8014bd:	83 ec 04             	sub    $0x4,%esp
+  8014c0:	53                   	push   %ebx
+  8014c1:	50                   	push   %eax
+  8014c2:	68 cd 32 80 00       	push   $0x8032cd
+  8014c7:	e8 d0 ec ff ff       	call   80019c <cprintf>
+    return -E_INVAL;
+  8014cc:	83 c4 10             	add    $0x10,%esp
+  8014cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014d4:	eb d8                	jmp    8014ae <write+0x53>
+    return -E_NOT_SUPP;
+  8014d6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014db:	eb d1                	jmp    8014ae <write+0x53>
+
+008014dd <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8014dd:	55                   	push   %ebp
+  8014de:	89 e5                	mov    %esp,%ebp
+  8014e0:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014e6:	50                   	push   %eax
+  8014e7:	ff 75 08             	push   0x8(%ebp)
+  8014ea:	e8 f3 fb ff ff       	call   8010e2 <fd_lookup>
+  8014ef:	83 c4 10             	add    $0x10,%esp
+  8014f2:	85 c0                	test   %eax,%eax
+  8014f4:	78 0e                	js     801504 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8014f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014fc:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8014ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801504:	c9                   	leave
+  801505:	c3                   	ret
+
+00801506 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801506:	55                   	push   %ebp
+  801507:	89 e5                	mov    %esp,%ebp
+  801509:	56                   	push   %esi
+  80150a:	53                   	push   %ebx
+  80150b:	83 ec 18             	sub    $0x18,%esp
+  80150e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801511:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801514:	50                   	push   %eax
+  801515:	53                   	push   %ebx
+  801516:	e8 c7 fb ff ff       	call   8010e2 <fd_lookup>
+  80151b:	83 c4 10             	add    $0x10,%esp
+  80151e:	85 c0                	test   %eax,%eax
+  801520:	78 34                	js     801556 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801522:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801525:	83 ec 08             	sub    $0x8,%esp
+  801528:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80152b:	50                   	push   %eax
+  80152c:	ff 36                	push   (%esi)
+  80152e:	e8 ff fb ff ff       	call   801132 <dev_lookup>
+  801533:	83 c4 10             	add    $0x10,%esp
+  801536:	85 c0                	test   %eax,%eax
+  801538:	78 1c                	js     801556 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80153a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80153e:	74 1d                	je     80155d <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801540:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801543:	8b 40 18             	mov    0x18(%eax),%eax
+  801546:	85 c0                	test   %eax,%eax
+  801548:	74 34                	je     80157e <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  80154a:	83 ec 08             	sub    $0x8,%esp
+  80154d:	ff 75 0c             	push   0xc(%ebp)
+  801550:	56                   	push   %esi
+  801551:	ff d0                	call   *%eax
+  801553:	83 c4 10             	add    $0x10,%esp
+}
+  801556:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801559:	5b                   	pop    %ebx
+  80155a:	5e                   	pop    %esi
+  80155b:	5d                   	pop    %ebp
+  80155c:	c3                   	ret
+            thisenv->env_id, fdnum);
+  80155d:	a1 44 57 80 00       	mov    0x805744,%eax
+  801562:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801565:	83 ec 04             	sub    $0x4,%esp
+  801568:	53                   	push   %ebx
+  801569:	50                   	push   %eax
+  80156a:	68 90 32 80 00       	push   $0x803290
+  80156f:	e8 28 ec ff ff       	call   80019c <cprintf>
+    return -E_INVAL;
+  801574:	83 c4 10             	add    $0x10,%esp
+  801577:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80157c:	eb d8                	jmp    801556 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  80157e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801583:	eb d1                	jmp    801556 <ftruncate+0x50>
+
+00801585 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801585:	55                   	push   %ebp
+  801586:	89 e5                	mov    %esp,%ebp
+  801588:	56                   	push   %esi
+  801589:	53                   	push   %ebx
+  80158a:	83 ec 18             	sub    $0x18,%esp
+  80158d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801590:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801593:	50                   	push   %eax
+  801594:	ff 75 08             	push   0x8(%ebp)
+  801597:	e8 46 fb ff ff       	call   8010e2 <fd_lookup>
+  80159c:	83 c4 10             	add    $0x10,%esp
+  80159f:	85 c0                	test   %eax,%eax
+  8015a1:	78 49                	js     8015ec <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015a3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015a6:	83 ec 08             	sub    $0x8,%esp
+  8015a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015ac:	50                   	push   %eax
+  8015ad:	ff 36                	push   (%esi)
+  8015af:	e8 7e fb ff ff       	call   801132 <dev_lookup>
+  8015b4:	83 c4 10             	add    $0x10,%esp
+  8015b7:	85 c0                	test   %eax,%eax
+  8015b9:	78 31                	js     8015ec <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  8015bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015be:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8015c2:	74 2f                	je     8015f3 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8015c4:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8015c7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8015ce:	00 00 00 
+  stat->st_isdir = 0;
+  8015d1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8015d8:	00 00 00 
+  stat->st_dev = dev;
+  8015db:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8015e1:	83 ec 08             	sub    $0x8,%esp
+  8015e4:	53                   	push   %ebx
+  8015e5:	56                   	push   %esi
+  8015e6:	ff 50 14             	call   *0x14(%eax)
+  8015e9:	83 c4 10             	add    $0x10,%esp
+}
+  8015ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015ef:	5b                   	pop    %ebx
+  8015f0:	5e                   	pop    %esi
+  8015f1:	5d                   	pop    %ebp
+  8015f2:	c3                   	ret
+    return -E_NOT_SUPP;
+  8015f3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015f8:	eb f2                	jmp    8015ec <fstat+0x67>
+
+008015fa <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8015fa:	55                   	push   %ebp
+  8015fb:	89 e5                	mov    %esp,%ebp
+  8015fd:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801600:	ff 75 0c             	push   0xc(%ebp)
+  801603:	ff 75 08             	push   0x8(%ebp)
+  801606:	e8 58 07 00 00       	call   801d63 <file_stat>
+}
+  80160b:	c9                   	leave
+  80160c:	c3                   	ret
+
+0080160d <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	57                   	push   %edi
+  801611:	56                   	push   %esi
+  801612:	53                   	push   %ebx
+  801613:	83 ec 1c             	sub    $0x1c,%esp
+  801616:	89 c7                	mov    %eax,%edi
+  801618:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80161b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80161e:	e9 a2 00 00 00       	jmp    8016c5 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801623:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80162a:	00 00 00 
+  80162d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801632:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801637:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80163c:	be 01 00 00 00       	mov    $0x1,%esi
+  801641:	eb 0f                	jmp    801652 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801643:	83 c0 01             	add    $0x1,%eax
+  801646:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80164b:	74 49                	je     801696 <fsipc_send+0x89>
+  80164d:	83 f9 07             	cmp    $0x7,%ecx
+  801650:	7f 50                	jg     8016a2 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801652:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801655:	c1 e2 04             	shl    $0x4,%edx
+  801658:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80165e:	8b 52 50             	mov    0x50(%edx),%edx
+  801661:	83 fa 01             	cmp    $0x1,%edx
+  801664:	75 dd                	jne    801643 <fsipc_send+0x36>
+  801666:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801669:	c1 e2 04             	shl    $0x4,%edx
+  80166c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801672:	8b 52 54             	mov    0x54(%edx),%edx
+  801675:	85 d2                	test   %edx,%edx
+  801677:	74 ca                	je     801643 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801679:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80167c:	c1 e2 04             	shl    $0x4,%edx
+  80167f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801685:	8b 52 48             	mov    0x48(%edx),%edx
+  801688:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  80168f:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801692:	89 f3                	mov    %esi,%ebx
+  801694:	eb ad                	jmp    801643 <fsipc_send+0x36>
+  801696:	84 db                	test   %bl,%bl
+  801698:	74 38                	je     8016d2 <fsipc_send+0xc5>
+  80169a:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  8016a0:	eb 30                	jmp    8016d2 <fsipc_send+0xc5>
+  8016a2:	84 db                	test   %bl,%bl
+  8016a4:	74 2c                	je     8016d2 <fsipc_send+0xc5>
+  8016a6:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  8016ac:	eb 24                	jmp    8016d2 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  8016ae:	50                   	push   %eax
+  8016af:	68 fc 32 80 00       	push   $0x8032fc
+  8016b4:	6a 34                	push   $0x34
+  8016b6:	68 06 33 80 00       	push   $0x803306
+  8016bb:	e8 b9 13 00 00       	call   802a79 <_panic>
+    }
+    sys_yield();
+  8016c0:	e8 92 f4 ff ff       	call   800b57 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8016c5:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  8016cc:	0f 8e 51 ff ff ff    	jle    801623 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8016d2:	a1 44 57 80 00       	mov    0x805744,%eax
+  8016d7:	8b 70 48             	mov    0x48(%eax),%esi
+  8016da:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8016e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e5:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  8016eb:	39 d9                	cmp    %ebx,%ecx
+  8016ed:	7e d1                	jle    8016c0 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8016ef:	83 ec 0c             	sub    $0xc,%esp
+  8016f2:	ff 75 e0             	push   -0x20(%ebp)
+  8016f5:	6a 07                	push   $0x7
+  8016f7:	ff 75 e4             	push   -0x1c(%ebp)
+  8016fa:	57                   	push   %edi
+  8016fb:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8016fe:	99                   	cltd
+  8016ff:	f7 f9                	idiv   %ecx
+  801701:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  801708:	e8 63 f7 ff ff       	call   800e70 <sys_ipc_try_send>
+      if (r == 0)
+  80170d:	83 c4 20             	add    $0x20,%esp
+  801710:	85 c0                	test   %eax,%eax
+  801712:	74 0a                	je     80171e <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801714:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801717:	75 95                	jne    8016ae <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801719:	83 c3 01             	add    $0x1,%ebx
+  80171c:	eb c7                	jmp    8016e5 <fsipc_send+0xd8>
+  }
+}
+  80171e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801721:	5b                   	pop    %ebx
+  801722:	5e                   	pop    %esi
+  801723:	5f                   	pop    %edi
+  801724:	5d                   	pop    %ebp
+  801725:	c3                   	ret
+
+00801726 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801726:	55                   	push   %ebp
+  801727:	89 e5                	mov    %esp,%ebp
+  801729:	53                   	push   %ebx
+  80172a:	83 ec 14             	sub    $0x14,%esp
+  80172d:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  80172f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801736:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80173b:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801740:	e8 c8 fe ff ff       	call   80160d <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801745:	6a 00                	push   $0x0
+  801747:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80174a:	50                   	push   %eax
+  80174b:	53                   	push   %ebx
+  80174c:	6a 00                	push   $0x0
+  80174e:	e8 6c 13 00 00       	call   802abf <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801753:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801756:	c9                   	leave
+  801757:	c3                   	ret
+
+00801758 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801758:	55                   	push   %ebp
+  801759:	89 e5                	mov    %esp,%ebp
+  80175b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80175e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801761:	8b 40 0c             	mov    0xc(%eax),%eax
+  801764:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801769:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80176c:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801771:	ba 00 00 00 00       	mov    $0x0,%edx
+  801776:	b8 02 00 00 00       	mov    $0x2,%eax
+  80177b:	e8 a6 ff ff ff       	call   801726 <fsipc>
+}
+  801780:	c9                   	leave
+  801781:	c3                   	ret
+
+00801782 <devfile_flush>:
+{
+  801782:	55                   	push   %ebp
+  801783:	89 e5                	mov    %esp,%ebp
+  801785:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801788:	8b 45 08             	mov    0x8(%ebp),%eax
+  80178b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80178e:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801793:	ba 00 00 00 00       	mov    $0x0,%edx
+  801798:	b8 06 00 00 00       	mov    $0x6,%eax
+  80179d:	e8 84 ff ff ff       	call   801726 <fsipc>
+}
+  8017a2:	c9                   	leave
+  8017a3:	c3                   	ret
+
+008017a4 <devfile_stat>:
+{
+  8017a4:	55                   	push   %ebp
+  8017a5:	89 e5                	mov    %esp,%ebp
+  8017a7:	53                   	push   %ebx
+  8017a8:	83 ec 04             	sub    $0x4,%esp
+  8017ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8017ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017b4:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8017b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017be:	b8 05 00 00 00       	mov    $0x5,%eax
+  8017c3:	e8 5e ff ff ff       	call   801726 <fsipc>
+  8017c8:	85 c0                	test   %eax,%eax
+  8017ca:	78 2c                	js     8017f8 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8017cc:	83 ec 08             	sub    $0x8,%esp
+  8017cf:	68 00 60 80 00       	push   $0x806000
+  8017d4:	53                   	push   %ebx
+  8017d5:	e8 b0 ef ff ff       	call   80078a <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8017da:	a1 80 60 80 00       	mov    0x806080,%eax
+  8017df:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8017e5:	a1 84 60 80 00       	mov    0x806084,%eax
+  8017ea:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8017f0:	83 c4 10             	add    $0x10,%esp
+  8017f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017fb:	c9                   	leave
+  8017fc:	c3                   	ret
+
+008017fd <fsv_alloc>:
+{
+  8017fd:	55                   	push   %ebp
+  8017fe:	89 e5                	mov    %esp,%ebp
+  801800:	56                   	push   %esi
+  801801:	53                   	push   %ebx
+  801802:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801804:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801809:	eb 22                	jmp    80182d <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  80180b:	83 ec 04             	sub    $0x4,%esp
+  80180e:	6a 00                	push   $0x0
+  801810:	6a 00                	push   $0x0
+  801812:	6a 07                	push   $0x7
+  801814:	50                   	push   %eax
+  801815:	6a 00                	push   $0x0
+  801817:	6a 04                	push   $0x4
+  801819:	68 40 50 80 00       	push   $0x805040
+  80181e:	e8 e9 f7 ff ff       	call   80100c <sysbatch_add>
+  801823:	83 c4 20             	add    $0x20,%esp
+  801826:	85 c0                	test   %eax,%eax
+  801828:	78 48                	js     801872 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  80182a:	83 c3 01             	add    $0x1,%ebx
+  80182d:	39 f3                	cmp    %esi,%ebx
+  80182f:	74 31                	je     801862 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801831:	89 d8                	mov    %ebx,%eax
+  801833:	c1 e0 0c             	shl    $0xc,%eax
+  801836:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80183b:	89 c2                	mov    %eax,%edx
+  80183d:	c1 ea 16             	shr    $0x16,%edx
+  801840:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801847:	f6 c2 01             	test   $0x1,%dl
+  80184a:	74 bf                	je     80180b <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  80184c:	89 c2                	mov    %eax,%edx
+  80184e:	c1 ea 0c             	shr    $0xc,%edx
+  801851:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801858:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80185b:	83 fa 03             	cmp    $0x3,%edx
+  80185e:	75 ab                	jne    80180b <fsv_alloc+0xe>
+  801860:	eb c8                	jmp    80182a <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801862:	83 ec 0c             	sub    $0xc,%esp
+  801865:	68 40 50 80 00       	push   $0x805040
+  80186a:	e8 4d f7 ff ff       	call   800fbc <sysbatch_flush>
+  80186f:	83 c4 10             	add    $0x10,%esp
+}
+  801872:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801875:	5b                   	pop    %ebx
+  801876:	5e                   	pop    %esi
+  801877:	5d                   	pop    %ebp
+  801878:	c3                   	ret
+
+00801879 <devfile_read>:
+{
+  801879:	55                   	push   %ebp
+  80187a:	89 e5                	mov    %esp,%ebp
+  80187c:	57                   	push   %edi
+  80187d:	56                   	push   %esi
+  80187e:	53                   	push   %ebx
+  80187f:	83 ec 3c             	sub    $0x3c,%esp
+  801882:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801885:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  80188b:	77 57                	ja     8018e4 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80188d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801890:	8b 40 0c             	mov    0xc(%eax),%eax
+  801893:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801898:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80189e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018a8:	e8 79 fe ff ff       	call   801726 <fsipc>
+  8018ad:	89 c6                	mov    %eax,%esi
+  8018af:	85 c0                	test   %eax,%eax
+  8018b1:	78 27                	js     8018da <devfile_read+0x61>
+  assert(r <= n);
+  8018b3:	39 c3                	cmp    %eax,%ebx
+  8018b5:	0f 82 0e 02 00 00    	jb     801ac9 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  8018bb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8018c0:	0f 8f 1c 02 00 00    	jg     801ae2 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8018c6:	83 ec 04             	sub    $0x4,%esp
+  8018c9:	50                   	push   %eax
+  8018ca:	68 00 60 80 00       	push   $0x806000
+  8018cf:	ff 75 0c             	push   0xc(%ebp)
+  8018d2:	e8 39 f0 ff ff       	call   800910 <memmove>
+  return r;
+  8018d7:	83 c4 10             	add    $0x10,%esp
+}
+  8018da:	89 f0                	mov    %esi,%eax
+  8018dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018df:	5b                   	pop    %ebx
+  8018e0:	5e                   	pop    %esi
+  8018e1:	5f                   	pop    %edi
+  8018e2:	5d                   	pop    %ebp
+  8018e3:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  8018e4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018e9:	e8 0f ff ff ff       	call   8017fd <fsv_alloc>
+  8018ee:	89 c6                	mov    %eax,%esi
+  8018f0:	85 c0                	test   %eax,%eax
+  8018f2:	78 e6                	js     8018da <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8018f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018f7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018fa:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  8018ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801902:	8b 40 04             	mov    0x4(%eax),%eax
+  801905:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  80190a:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801910:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801917:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80191c:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801921:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801926:	e8 e2 fc ff ff       	call   80160d <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80192b:	6a 00                	push   $0x0
+  80192d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801930:	50                   	push   %eax
+  801931:	68 00 10 c0 9f       	push   $0x9fc01000
+  801936:	6a 00                	push   $0x0
+  801938:	e8 82 11 00 00       	call   802abf <ipc_recv_pages>
+  80193d:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  80193f:	83 c4 10             	add    $0x10,%esp
+  801942:	85 c0                	test   %eax,%eax
+  801944:	7e 94                	jle    8018da <devfile_read+0x61>
+  assert(r <= n);
+  801946:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801949:	39 c3                	cmp    %eax,%ebx
+  80194b:	72 2e                	jb     80197b <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  80194d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801950:	8b 40 04             	mov    0x4(%eax),%eax
+  801953:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801958:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  80195b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80195e:	c1 e2 0c             	shl    $0xc,%edx
+  801961:	39 ca                	cmp    %ecx,%edx
+  801963:	72 2f                	jb     801994 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801965:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  80196a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  80196d:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801971:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801976:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801979:	eb 52                	jmp    8019cd <devfile_read+0x154>
+  assert(r <= n);
+  80197b:	68 11 33 80 00       	push   $0x803311
+  801980:	68 18 33 80 00       	push   $0x803318
+  801985:	68 49 01 00 00       	push   $0x149
+  80198a:	68 06 33 80 00       	push   $0x803306
+  80198f:	e8 e5 10 00 00       	call   802a79 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801994:	68 3c 33 80 00       	push   $0x80333c
+  801999:	68 18 33 80 00       	push   $0x803318
+  80199e:	68 4a 01 00 00       	push   $0x14a
+  8019a3:	68 06 33 80 00       	push   $0x803306
+  8019a8:	e8 cc 10 00 00       	call   802a79 <_panic>
+      memmove(dst + done, src + done, m);
+  8019ad:	83 ec 04             	sub    $0x4,%esp
+  8019b0:	53                   	push   %ebx
+  8019b1:	56                   	push   %esi
+  8019b2:	89 f8                	mov    %edi,%eax
+  8019b4:	03 45 0c             	add    0xc(%ebp),%eax
+  8019b7:	50                   	push   %eax
+  8019b8:	e8 53 ef ff ff       	call   800910 <memmove>
+  8019bd:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  8019c0:	01 df                	add    %ebx,%edi
+  8019c2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8019c5:	39 c7                	cmp    %eax,%edi
+  8019c7:	0f 83 c0 00 00 00    	jae    801a8d <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  8019cd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019d0:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  8019d3:	89 f0                	mov    %esi,%eax
+  8019d5:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019da:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8019df:	29 c3                	sub    %eax,%ebx
+  8019e1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8019e4:	29 f8                	sub    %edi,%eax
+  8019e6:	39 c3                	cmp    %eax,%ebx
+  8019e8:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  8019eb:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8019f1:	75 ba                	jne    8019ad <devfile_read+0x134>
+  8019f3:	89 f9                	mov    %edi,%ecx
+  8019f5:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8019f8:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  8019fb:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801a01:	75 aa                	jne    8019ad <devfile_read+0x134>
+  801a03:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801a09:	77 a2                	ja     8019ad <devfile_read+0x134>
+  801a0b:	89 c8                	mov    %ecx,%eax
+  801a0d:	c1 e8 16             	shr    $0x16,%eax
+  801a10:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a17:	a8 01                	test   $0x1,%al
+  801a19:	74 92                	je     8019ad <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801a1b:	89 c8                	mov    %ecx,%eax
+  801a1d:	c1 e8 0c             	shr    $0xc,%eax
+  801a20:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801a27:	a8 01                	test   $0x1,%al
+  801a29:	74 82                	je     8019ad <devfile_read+0x134>
+  801a2b:	a9 02 08 00 00       	test   $0x802,%eax
+  801a30:	0f 84 77 ff ff ff    	je     8019ad <devfile_read+0x134>
+  801a36:	f6 c4 04             	test   $0x4,%ah
+  801a39:	0f 85 6e ff ff ff    	jne    8019ad <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801a3f:	a1 44 57 80 00       	mov    0x805744,%eax
+  801a44:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801a48:	84 c0                	test   %al,%al
+  801a4a:	75 17                	jne    801a63 <devfile_read+0x1ea>
+  801a4c:	83 ec 08             	sub    $0x8,%esp
+  801a4f:	6a 01                	push   $0x1
+  801a51:	6a 00                	push   $0x0
+  801a53:	e8 1e f1 ff ff       	call   800b76 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801a58:	83 c4 10             	add    $0x10,%esp
+  801a5b:	85 c0                	test   %eax,%eax
+  801a5d:	0f 85 4a ff ff ff    	jne    8019ad <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801a63:	83 ec 04             	sub    $0x4,%esp
+  801a66:	68 05 08 00 00       	push   $0x805
+  801a6b:	ff 75 cc             	push   -0x34(%ebp)
+  801a6e:	6a 00                	push   $0x0
+  801a70:	56                   	push   %esi
+  801a71:	6a 00                	push   $0x0
+  801a73:	6a 05                	push   $0x5
+  801a75:	68 40 50 80 00       	push   $0x805040
+  801a7a:	e8 8d f5 ff ff       	call   80100c <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801a7f:	c1 e8 1f             	shr    $0x1f,%eax
+  801a82:	08 45 cb             	or     %al,-0x35(%ebp)
+  801a85:	83 c4 20             	add    $0x20,%esp
+  801a88:	e9 33 ff ff ff       	jmp    8019c0 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801a8d:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801a90:	83 ec 0c             	sub    $0xc,%esp
+  801a93:	68 40 50 80 00       	push   $0x805040
+  801a98:	e8 1f f5 ff ff       	call   800fbc <sysbatch_flush>
+  801a9d:	83 c4 10             	add    $0x10,%esp
+  801aa0:	85 c0                	test   %eax,%eax
+  801aa2:	78 06                	js     801aaa <devfile_read+0x231>
+  801aa4:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801aa8:	74 14                	je     801abe <devfile_read+0x245>
+    memmove(dst, src, r);
+  801aaa:	83 ec 04             	sub    $0x4,%esp
+  801aad:	ff 75 d4             	push   -0x2c(%ebp)
+  801ab0:	ff 75 d0             	push   -0x30(%ebp)
+  801ab3:	ff 75 0c             	push   0xc(%ebp)
+  801ab6:	e8 55 ee ff ff       	call   800910 <memmove>
+  801abb:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801abe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac1:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801ac4:	e9 11 fe ff ff       	jmp    8018da <devfile_read+0x61>
+  assert(r <= n);
+  801ac9:	68 11 33 80 00       	push   $0x803311
+  801ace:	68 18 33 80 00       	push   $0x803318
+  801ad3:	68 1c 01 00 00       	push   $0x11c
+  801ad8:	68 06 33 80 00       	push   $0x803306
+  801add:	e8 97 0f 00 00       	call   802a79 <_panic>
+  assert(r <= PGSIZE);
+  801ae2:	68 2d 33 80 00       	push   $0x80332d
+  801ae7:	68 18 33 80 00       	push   $0x803318
+  801aec:	68 1d 01 00 00       	push   $0x11d
+  801af1:	68 06 33 80 00       	push   $0x803306
+  801af6:	e8 7e 0f 00 00       	call   802a79 <_panic>
+
+00801afb <devfile_write>:
+{
+  801afb:	55                   	push   %ebp
+  801afc:	89 e5                	mov    %esp,%ebp
+  801afe:	57                   	push   %edi
+  801aff:	56                   	push   %esi
+  801b00:	53                   	push   %ebx
+  801b01:	83 ec 1c             	sub    $0x1c,%esp
+  801b04:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b07:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801b0a:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801b0f:	77 39                	ja     801b4a <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b11:	8b 56 0c             	mov    0xc(%esi),%edx
+  801b14:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801b1a:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801b1f:	83 ec 04             	sub    $0x4,%esp
+  801b22:	50                   	push   %eax
+  801b23:	ff 75 0c             	push   0xc(%ebp)
+  801b26:	68 08 60 80 00       	push   $0x806008
+  801b2b:	e8 e0 ed ff ff       	call   800910 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801b30:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b35:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b3a:	e8 e7 fb ff ff       	call   801726 <fsipc>
+  801b3f:	83 c4 10             	add    $0x10,%esp
+}
+  801b42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b45:	5b                   	pop    %ebx
+  801b46:	5e                   	pop    %esi
+  801b47:	5f                   	pop    %edi
+  801b48:	5d                   	pop    %ebp
+  801b49:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801b4a:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801b4f:	39 d0                	cmp    %edx,%eax
+  801b51:	89 d3                	mov    %edx,%ebx
+  801b53:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801b56:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801b5c:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801b5f:	83 c7 01             	add    $0x1,%edi
+  801b62:	89 f8                	mov    %edi,%eax
+  801b64:	e8 94 fc ff ff       	call   8017fd <fsv_alloc>
+  801b69:	85 c0                	test   %eax,%eax
+  801b6b:	78 d5                	js     801b42 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801b6d:	83 ec 04             	sub    $0x4,%esp
+  801b70:	53                   	push   %ebx
+  801b71:	ff 75 0c             	push   0xc(%ebp)
+  801b74:	68 00 10 c0 9f       	push   $0x9fc01000
+  801b79:	e8 92 ed ff ff       	call   800910 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801b7e:	8b 46 0c             	mov    0xc(%esi),%eax
+  801b81:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801b86:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801b8c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801b93:	89 f9                	mov    %edi,%ecx
+  801b95:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801b9a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b9f:	e8 69 fa ff ff       	call   80160d <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801ba4:	6a 00                	push   $0x0
+  801ba6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ba9:	50                   	push   %eax
+  801baa:	6a 00                	push   $0x0
+  801bac:	6a 00                	push   $0x0
+  801bae:	e8 0c 0f 00 00       	call   802abf <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801bb3:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801bb6:	eb 8a                	jmp    801b42 <devfile_write+0x47>
+
+00801bb8 <open>:
+{
+  801bb8:	55                   	push   %ebp
+  801bb9:	89 e5                	mov    %esp,%ebp
+  801bbb:	56                   	push   %esi
+  801bbc:	53                   	push   %ebx
+  801bbd:	83 ec 1c             	sub    $0x1c,%esp
+  801bc0:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801bc3:	56                   	push   %esi
+  801bc4:	e8 86 eb ff ff       	call   80074f <strlen>
+  801bc9:	83 c4 10             	add    $0x10,%esp
+  801bcc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bd1:	7f 6c                	jg     801c3f <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801bd3:	83 ec 0c             	sub    $0xc,%esp
+  801bd6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bd9:	50                   	push   %eax
+  801bda:	e8 ad f4 ff ff       	call   80108c <fd_alloc>
+  801bdf:	89 c3                	mov    %eax,%ebx
+  801be1:	83 c4 10             	add    $0x10,%esp
+  801be4:	85 c0                	test   %eax,%eax
+  801be6:	78 3c                	js     801c24 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801be8:	83 ec 08             	sub    $0x8,%esp
+  801beb:	56                   	push   %esi
+  801bec:	68 00 60 80 00       	push   $0x806000
+  801bf1:	e8 94 eb ff ff       	call   80078a <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801bf6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bf9:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bfe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c01:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c06:	e8 1b fb ff ff       	call   801726 <fsipc>
+  801c0b:	89 c3                	mov    %eax,%ebx
+  801c0d:	83 c4 10             	add    $0x10,%esp
+  801c10:	85 c0                	test   %eax,%eax
+  801c12:	78 19                	js     801c2d <open+0x75>
+  return fd2num(fd);
+  801c14:	83 ec 0c             	sub    $0xc,%esp
+  801c17:	ff 75 f4             	push   -0xc(%ebp)
+  801c1a:	e8 49 f4 ff ff       	call   801068 <fd2num>
+  801c1f:	89 c3                	mov    %eax,%ebx
+  801c21:	83 c4 10             	add    $0x10,%esp
+}
+  801c24:	89 d8                	mov    %ebx,%eax
+  801c26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c29:	5b                   	pop    %ebx
+  801c2a:	5e                   	pop    %esi
+  801c2b:	5d                   	pop    %ebp
+  801c2c:	c3                   	ret
+    fd_close(fd, 0);
+  801c2d:	83 ec 08             	sub    $0x8,%esp
+  801c30:	6a 00                	push   $0x0
+  801c32:	ff 75 f4             	push   -0xc(%ebp)
+  801c35:	e8 44 f5 ff ff       	call   80117e <fd_close>
+    return r;
+  801c3a:	83 c4 10             	add    $0x10,%esp
+  801c3d:	eb e5                	jmp    801c24 <open+0x6c>
+    return -E_BAD_PATH;
+  801c3f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c44:	eb de                	jmp    801c24 <open+0x6c>
+
+00801c46 <open_read>:
+{
+  801c46:	55                   	push   %ebp
+  801c47:	89 e5                	mov    %esp,%ebp
+  801c49:	57                   	push   %edi
+  801c4a:	56                   	push   %esi
+  801c4b:	53                   	push   %ebx
+  801c4c:	83 ec 28             	sub    $0x28,%esp
+  801c4f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801c52:	57                   	push   %edi
+  801c53:	e8 f7 ea ff ff       	call   80074f <strlen>
+  801c58:	83 c4 10             	add    $0x10,%esp
+  801c5b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c60:	0f 87 f6 00 00 00    	ja     801d5c <open_read+0x116>
+  801c66:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801c68:	83 ec 0c             	sub    $0xc,%esp
+  801c6b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c6e:	50                   	push   %eax
+  801c6f:	e8 18 f4 ff ff       	call   80108c <fd_alloc>
+  801c74:	89 c3                	mov    %eax,%ebx
+  801c76:	83 c4 10             	add    $0x10,%esp
+  801c79:	85 c0                	test   %eax,%eax
+  801c7b:	0f 88 b2 00 00 00    	js     801d33 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801c81:	83 ec 08             	sub    $0x8,%esp
+  801c84:	57                   	push   %edi
+  801c85:	68 e4 60 80 00       	push   $0x8060e4
+  801c8a:	e8 fb ea ff ff       	call   80078a <strcpy>
+  req->req_nops = 2;
+  801c8f:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801c96:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801c99:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801ca0:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801ca3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ca6:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801cab:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801cb2:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801cb5:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801cbc:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801cbf:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801cc6:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801cc9:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801cce:	29 f0                	sub    %esi,%eax
+  801cd0:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801cd3:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801cd7:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801cdc:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801ce3:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801ce6:	83 c6 01             	add    $0x1,%esi
+  801ce9:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801cef:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801cf2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801cf7:	e8 2a fa ff ff       	call   801726 <fsipc>
+  801cfc:	89 c3                	mov    %eax,%ebx
+  801cfe:	83 c4 10             	add    $0x10,%esp
+  801d01:	83 f8 01             	cmp    $0x1,%eax
+  801d04:	7e 37                	jle    801d3d <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801d06:	a1 38 60 80 00       	mov    0x806038,%eax
+  801d0b:	8b 55 18             	mov    0x18(%ebp),%edx
+  801d0e:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801d10:	83 ec 04             	sub    $0x4,%esp
+  801d13:	50                   	push   %eax
+  801d14:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801d1a:	56                   	push   %esi
+  801d1b:	ff 75 10             	push   0x10(%ebp)
+  801d1e:	e8 ed eb ff ff       	call   800910 <memmove>
+  return fd2num(fd);
+  801d23:	83 c4 04             	add    $0x4,%esp
+  801d26:	ff 75 e4             	push   -0x1c(%ebp)
+  801d29:	e8 3a f3 ff ff       	call   801068 <fd2num>
+  801d2e:	89 c3                	mov    %eax,%ebx
+  801d30:	83 c4 10             	add    $0x10,%esp
+}
+  801d33:	89 d8                	mov    %ebx,%eax
+  801d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d38:	5b                   	pop    %ebx
+  801d39:	5e                   	pop    %esi
+  801d3a:	5f                   	pop    %edi
+  801d3b:	5d                   	pop    %ebp
+  801d3c:	c3                   	ret
+    fd_close(fd, 0);
+  801d3d:	83 ec 08             	sub    $0x8,%esp
+  801d40:	6a 00                	push   $0x0
+  801d42:	ff 75 e4             	push   -0x1c(%ebp)
+  801d45:	e8 34 f4 ff ff       	call   80117e <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801d4a:	83 c4 10             	add    $0x10,%esp
+  801d4d:	85 db                	test   %ebx,%ebx
+  801d4f:	78 e2                	js     801d33 <open_read+0xed>
+  801d51:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801d54:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801d5a:	eb d7                	jmp    801d33 <open_read+0xed>
+    return -E_BAD_PATH;
+  801d5c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d61:	eb d0                	jmp    801d33 <open_read+0xed>
+
+00801d63 <file_stat>:
+{
+  801d63:	55                   	push   %ebp
+  801d64:	89 e5                	mov    %esp,%ebp
+  801d66:	57                   	push   %edi
+  801d67:	56                   	push   %esi
+  801d68:	53                   	push   %ebx
+  801d69:	83 ec 18             	sub    $0x18,%esp
+  801d6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d6f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801d72:	57                   	push   %edi
+  801d73:	e8 d7 e9 ff ff       	call   80074f <strlen>
+  801d78:	83 c4 10             	add    $0x10,%esp
+  801d7b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d80:	0f 8f c7 00 00 00    	jg     801e4d <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801d86:	83 ec 0c             	sub    $0xc,%esp
+  801d89:	57                   	push   %edi
+  801d8a:	e8 c0 e9 ff ff       	call   80074f <strlen>
+  801d8f:	8d 58 04             	lea    0x4(%eax),%ebx
+  801d92:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801d95:	83 c4 08             	add    $0x8,%esp
+  801d98:	57                   	push   %edi
+  801d99:	68 e4 60 80 00       	push   $0x8060e4
+  801d9e:	e8 e7 e9 ff ff       	call   80078a <strcpy>
+  req->req_nops = 2;
+  801da3:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801daa:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801dad:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801db4:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801db7:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801dbe:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801dc1:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801dc8:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801dcb:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801dd2:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801dd5:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801ddc:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801ddf:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801de5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dea:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801def:	e8 32 f9 ff ff       	call   801726 <fsipc>
+  801df4:	83 c4 10             	add    $0x10,%esp
+  801df7:	83 f8 01             	cmp    $0x1,%eax
+  801dfa:	7e 42                	jle    801e3e <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801dfc:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801e02:	83 ec 08             	sub    $0x8,%esp
+  801e05:	53                   	push   %ebx
+  801e06:	56                   	push   %esi
+  801e07:	e8 7e e9 ff ff       	call   80078a <strcpy>
+  st->st_size = ret->ret_size;
+  801e0c:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801e12:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801e18:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801e1e:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801e24:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801e2b:	40 80 00 
+  return 0;
+  801e2e:	83 c4 10             	add    $0x10,%esp
+  801e31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e39:	5b                   	pop    %ebx
+  801e3a:	5e                   	pop    %esi
+  801e3b:	5f                   	pop    %edi
+  801e3c:	5d                   	pop    %ebp
+  801e3d:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801e3e:	85 c0                	test   %eax,%eax
+  801e40:	78 f4                	js     801e36 <file_stat+0xd3>
+  801e42:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801e45:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801e4b:	eb e9                	jmp    801e36 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801e4d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801e52:	eb e2                	jmp    801e36 <file_stat+0xd3>
+
+00801e54 <read_map>:
+{
+  801e54:	55                   	push   %ebp
+  801e55:	89 e5                	mov    %esp,%ebp
+  801e57:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e5a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e5d:	50                   	push   %eax
+  801e5e:	ff 75 08             	push   0x8(%ebp)
+  801e61:	e8 7c f2 ff ff       	call   8010e2 <fd_lookup>
+  801e66:	83 c4 10             	add    $0x10,%esp
+  801e69:	85 c0                	test   %eax,%eax
+  801e6b:	78 2a                	js     801e97 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801e6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e70:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801e76:	39 08                	cmp    %ecx,(%eax)
+  801e78:	75 1f                	jne    801e99 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801e7a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e7d:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801e82:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e85:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801e8a:	8b 55 10             	mov    0x10(%ebp),%edx
+  801e8d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801e92:	e8 8f f8 ff ff       	call   801726 <fsipc>
+}
+  801e97:	c9                   	leave
+  801e98:	c3                   	ret
+    return -E_INVAL;
+  801e99:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e9e:	eb f7                	jmp    801e97 <read_map+0x43>
+
+00801ea0 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ea0:	55                   	push   %ebp
+  801ea1:	89 e5                	mov    %esp,%ebp
+  801ea3:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ea6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eab:	b8 08 00 00 00       	mov    $0x8,%eax
+  801eb0:	e8 71 f8 ff ff       	call   801726 <fsipc>
+}
+  801eb5:	c9                   	leave
+  801eb6:	c3                   	ret
+
+00801eb7 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801eb7:	55                   	push   %ebp
+  801eb8:	89 e5                	mov    %esp,%ebp
+  801eba:	57                   	push   %edi
+  801ebb:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801ebc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ebf:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801ec4:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801ecb:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801ece:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801ed5:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801ed8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801edd:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ee2:	e8 3f f8 ff ff       	call   801726 <fsipc>
+  801ee7:	85 c0                	test   %eax,%eax
+  801ee9:	78 14                	js     801eff <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801eeb:	be 00 60 80 00       	mov    $0x806000,%esi
+  801ef0:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801ef5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801ef8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801efa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eff:	5e                   	pop    %esi
+  801f00:	5f                   	pop    %edi
+  801f01:	5d                   	pop    %ebp
+  801f02:	c3                   	ret
+
+00801f03 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801f03:	55                   	push   %ebp
+  801f04:	89 e5                	mov    %esp,%ebp
+  801f06:	53                   	push   %ebx
+  801f07:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801f0a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f0d:	50                   	push   %eax
+  801f0e:	6a 00                	push   $0x0
+  801f10:	e8 a2 ff ff ff       	call   801eb7 <fs_stats>
+  801f15:	83 c4 10             	add    $0x10,%esp
+  801f18:	85 c0                	test   %eax,%eax
+  801f1a:	78 28                	js     801f44 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801f1c:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801f1f:	83 ec 08             	sub    $0x8,%esp
+  801f22:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f25:	50                   	push   %eax
+  801f26:	6a 20                	push   $0x20
+  801f28:	e8 8a ff ff ff       	call   801eb7 <fs_stats>
+  801f2d:	83 c4 10             	add    $0x10,%esp
+  801f30:	85 c0                	test   %eax,%eax
+  801f32:	78 10                	js     801f44 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  801f34:	83 ec 08             	sub    $0x8,%esp
+  801f37:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f3a:	50                   	push   %eax
+  801f3b:	53                   	push   %ebx
+  801f3c:	e8 76 ff ff ff       	call   801eb7 <fs_stats>
+  801f41:	83 c4 10             	add    $0x10,%esp
+}
+  801f44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f47:	c9                   	leave
+  801f48:	c3                   	ret
+
+00801f49 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801f49:	55                   	push   %ebp
+  801f4a:	89 e5                	mov    %esp,%ebp
+  801f4c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801f4f:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801f56:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801f59:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5c:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  801f61:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801f68:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801f6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f70:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f75:	e8 ac f7 ff ff       	call   801726 <fsipc>
+}
+  801f7a:	c9                   	leave
+  801f7b:	c3                   	ret
+
+00801f7c <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  801f7c:	55                   	push   %ebp
+  801f7d:	89 e5                	mov    %esp,%ebp
+  801f7f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801f82:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801f89:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  801f8c:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801f93:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  801f96:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f99:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  801f9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa3:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fa8:	e8 79 f7 ff ff       	call   801726 <fsipc>
+}
+  801fad:	c9                   	leave
+  801fae:	c3                   	ret
+
+00801faf <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801faf:	55                   	push   %ebp
+  801fb0:	89 e5                	mov    %esp,%ebp
+  801fb2:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fb8:	50                   	push   %eax
+  801fb9:	ff 75 08             	push   0x8(%ebp)
+  801fbc:	e8 21 f1 ff ff       	call   8010e2 <fd_lookup>
+  801fc1:	83 c4 10             	add    $0x10,%esp
+  801fc4:	85 c0                	test   %eax,%eax
+  801fc6:	78 34                	js     801ffc <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801fc8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fcb:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801fd1:	39 08                	cmp    %ecx,(%eax)
+  801fd3:	75 29                	jne    801ffe <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  801fd5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fd8:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  801fdd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fe0:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  801fe5:	8b 45 10             	mov    0x10(%ebp),%eax
+  801fe8:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  801fed:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801ff7:	e8 2a f7 ff ff       	call   801726 <fsipc>
+}
+  801ffc:	c9                   	leave
+  801ffd:	c3                   	ret
+    return -E_INVAL;
+  801ffe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802003:	eb f7                	jmp    801ffc <fallocate+0x4d>
+
+00802005 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802005:	55                   	push   %ebp
+  802006:	89 e5                	mov    %esp,%ebp
+  802008:	57                   	push   %edi
+  802009:	56                   	push   %esi
+  80200a:	53                   	push   %ebx
+  80200b:	83 ec 24             	sub    $0x24,%esp
+  80200e:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802011:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802014:	50                   	push   %eax
+  802015:	ff 75 08             	push   0x8(%ebp)
+  802018:	e8 c5 f0 ff ff       	call   8010e2 <fd_lookup>
+  80201d:	83 c4 10             	add    $0x10,%esp
+  802020:	85 c0                	test   %eax,%eax
+  802022:	78 66                	js     80208a <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802024:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802027:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80202d:	39 08                	cmp    %ecx,(%eax)
+  80202f:	75 61                	jne    802092 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802031:	85 f6                	test   %esi,%esi
+  802033:	7e 50                	jle    802085 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802035:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80203a:	39 de                	cmp    %ebx,%esi
+  80203c:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80203f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802042:	8b 40 0c             	mov    0xc(%eax),%eax
+  802045:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  80204a:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802050:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802057:	83 ec 04             	sub    $0x4,%esp
+  80205a:	57                   	push   %edi
+  80205b:	ff 75 0c             	push   0xc(%ebp)
+  80205e:	68 08 60 80 00       	push   $0x806008
+  802063:	e8 a8 e8 ff ff       	call   800910 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802068:	ba 00 00 00 00       	mov    $0x0,%edx
+  80206d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802072:	e8 af f6 ff ff       	call   801726 <fsipc>
+  802077:	83 c4 10             	add    $0x10,%esp
+  80207a:	85 c0                	test   %eax,%eax
+  80207c:	78 0c                	js     80208a <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80207e:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802081:	29 de                	sub    %ebx,%esi
+  802083:	eb ac                	jmp    802031 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802085:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80208a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80208d:	5b                   	pop    %ebx
+  80208e:	5e                   	pop    %esi
+  80208f:	5f                   	pop    %edi
+  802090:	5d                   	pop    %ebp
+  802091:	c3                   	ret
+    return -E_INVAL;
+  802092:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802097:	eb f1                	jmp    80208a <prefetch+0x85>
+
+00802099 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802099:	55                   	push   %ebp
+  80209a:	89 e5                	mov    %esp,%ebp
+  80209c:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80209f:	50                   	push   %eax
+  8020a0:	e8 d3 ef ff ff       	call   801078 <fd2data>
+  8020a5:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8020aa:	c9                   	leave
+  8020ab:	c3                   	ret
+
+008020ac <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020ac:	55                   	push   %ebp
+  8020ad:	89 e5                	mov    %esp,%ebp
+  8020af:	56                   	push   %esi
+  8020b0:	53                   	push   %ebx
+  8020b1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8020b4:	83 ec 0c             	sub    $0xc,%esp
+  8020b7:	ff 75 08             	push   0x8(%ebp)
+  8020ba:	e8 b9 ef ff ff       	call   801078 <fd2data>
+  8020bf:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8020c1:	83 c4 08             	add    $0x8,%esp
+  8020c4:	68 68 33 80 00       	push   $0x803368
+  8020c9:	53                   	push   %ebx
+  8020ca:	e8 bb e6 ff ff       	call   80078a <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8020cf:	8b 46 04             	mov    0x4(%esi),%eax
+  8020d2:	2b 06                	sub    (%esi),%eax
+  8020d4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8020da:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020e1:	00 00 00 
+  stat->st_dev = &devpipe;
+  8020e4:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8020eb:	40 80 00 
+  return 0;
+}
+  8020ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020f6:	5b                   	pop    %ebx
+  8020f7:	5e                   	pop    %esi
+  8020f8:	5d                   	pop    %ebp
+  8020f9:	c3                   	ret
+
+008020fa <pipe_wakeup>:
+{
+  8020fa:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8020fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802101:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802104:	85 c0                	test   %eax,%eax
+  802106:	75 01                	jne    802109 <pipe_wakeup+0xf>
+  802108:	c3                   	ret
+{
+  802109:	55                   	push   %ebp
+  80210a:	89 e5                	mov    %esp,%ebp
+  80210c:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  80210f:	6a 00                	push   $0x0
+  802111:	68 00 00 c0 ee       	push   $0xeec00000
+  802116:	52                   	push   %edx
+  802117:	e8 f9 ed ff ff       	call   800f15 <sys_chan_wakeup>
+  80211c:	83 c4 10             	add    $0x10,%esp
+}
+  80211f:	c9                   	leave
+  802120:	c3                   	ret
+
+00802121 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802121:	55                   	push   %ebp
+  802122:	89 e5                	mov    %esp,%ebp
+  802124:	57                   	push   %edi
+  802125:	56                   	push   %esi
+  802126:	53                   	push   %ebx
+  802127:	83 ec 18             	sub    $0x18,%esp
+  80212a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80212d:	57                   	push   %edi
+  80212e:	e8 45 ef ff ff       	call   801078 <fd2data>
+  802133:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802135:	83 c4 10             	add    $0x10,%esp
+  802138:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  80213c:	74 2a                	je     802168 <devpipe_close+0x47>
+  80213e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802143:	89 f8                	mov    %edi,%eax
+  802145:	e8 4f ff ff ff       	call   802099 <pipe_ring>
+  80214a:	83 ec 08             	sub    $0x8,%esp
+  80214d:	01 d8                	add    %ebx,%eax
+  80214f:	50                   	push   %eax
+  802150:	6a 00                	push   $0x0
+  802152:	e8 e7 ea ff ff       	call   800c3e <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802157:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80215d:	83 c4 10             	add    $0x10,%esp
+  802160:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802166:	75 db                	jne    802143 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802168:	83 ec 08             	sub    $0x8,%esp
+  80216b:	57                   	push   %edi
+  80216c:	6a 00                	push   $0x0
+  80216e:	e8 cb ea ff ff       	call   800c3e <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802173:	83 c4 10             	add    $0x10,%esp
+  802176:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  80217a:	75 13                	jne    80218f <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  80217c:	83 ec 08             	sub    $0x8,%esp
+  80217f:	56                   	push   %esi
+  802180:	6a 00                	push   $0x0
+  802182:	e8 b7 ea ff ff       	call   800c3e <sys_page_unmap>
+}
+  802187:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80218a:	5b                   	pop    %ebx
+  80218b:	5e                   	pop    %esi
+  80218c:	5f                   	pop    %edi
+  80218d:	5d                   	pop    %ebp
+  80218e:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80218f:	8d 56 04             	lea    0x4(%esi),%edx
+  802192:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802195:	e8 60 ff ff ff       	call   8020fa <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80219a:	8d 46 30             	lea    0x30(%esi),%eax
+  80219d:	89 f2                	mov    %esi,%edx
+  80219f:	e8 56 ff ff ff       	call   8020fa <pipe_wakeup>
+  8021a4:	eb d6                	jmp    80217c <devpipe_close+0x5b>
+
+008021a6 <_pipeisclosed>:
+{
+  8021a6:	55                   	push   %ebp
+  8021a7:	89 e5                	mov    %esp,%ebp
+  8021a9:	57                   	push   %edi
+  8021aa:	56                   	push   %esi
+  8021ab:	53                   	push   %ebx
+  8021ac:	83 ec 1c             	sub    $0x1c,%esp
+  8021af:	89 c7                	mov    %eax,%edi
+  8021b1:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8021b3:	a1 44 57 80 00       	mov    0x805744,%eax
+  8021b8:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8021bb:	83 ec 0c             	sub    $0xc,%esp
+  8021be:	57                   	push   %edi
+  8021bf:	e8 5e 0a 00 00       	call   802c22 <pageref>
+  8021c4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8021c7:	89 34 24             	mov    %esi,(%esp)
+  8021ca:	e8 53 0a 00 00       	call   802c22 <pageref>
+    nn = thisenv->env_runs;
+  8021cf:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  8021d5:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8021d8:	83 c4 10             	add    $0x10,%esp
+  8021db:	39 cb                	cmp    %ecx,%ebx
+  8021dd:	74 1b                	je     8021fa <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8021df:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021e2:	75 cf                	jne    8021b3 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8021e4:	8b 42 58             	mov    0x58(%edx),%eax
+  8021e7:	6a 01                	push   $0x1
+  8021e9:	50                   	push   %eax
+  8021ea:	53                   	push   %ebx
+  8021eb:	68 6f 33 80 00       	push   $0x80336f
+  8021f0:	e8 a7 df ff ff       	call   80019c <cprintf>
+  8021f5:	83 c4 10             	add    $0x10,%esp
+  8021f8:	eb b9                	jmp    8021b3 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8021fa:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021fd:	0f 94 c0             	sete   %al
+  802200:	0f b6 c0             	movzbl %al,%eax
+}
+  802203:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802206:	5b                   	pop    %ebx
+  802207:	5e                   	pop    %esi
+  802208:	5f                   	pop    %edi
+  802209:	5d                   	pop    %ebp
+  80220a:	c3                   	ret
+
+0080220b <devpipe_write_bulk>:
+{
+  80220b:	55                   	push   %ebp
+  80220c:	89 e5                	mov    %esp,%ebp
+  80220e:	57                   	push   %edi
+  80220f:	56                   	push   %esi
+  802210:	53                   	push   %ebx
+  802211:	83 ec 1c             	sub    $0x1c,%esp
+  802214:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802217:	89 d6                	mov    %edx,%esi
+  802219:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  80221c:	e8 78 fe ff ff       	call   802099 <pipe_ring>
+  802221:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802224:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802229:	8d 46 04             	lea    0x4(%esi),%eax
+  80222c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80222f:	eb 75                	jmp    8022a6 <devpipe_write_bulk+0x9b>
+  802231:	b8 01 00 00 00       	mov    $0x1,%eax
+  802236:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80223a:	6a 64                	push   $0x64
+  80223c:	68 00 00 c0 ee       	push   $0xeec00000
+  802241:	53                   	push   %ebx
+  802242:	56                   	push   %esi
+  802243:	e8 aa ec ff ff       	call   800ef2 <sys_chan_sleep>
+      continue;
+  802248:	83 c4 10             	add    $0x10,%esp
+  80224b:	eb 59                	jmp    8022a6 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80224d:	89 d1                	mov    %edx,%ecx
+  80224f:	c1 f9 1f             	sar    $0x1f,%ecx
+  802252:	c1 e9 11             	shr    $0x11,%ecx
+  802255:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802258:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80225d:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80225f:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802265:	29 d3                	sub    %edx,%ebx
+  802267:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80226c:	29 c2                	sub    %eax,%edx
+  80226e:	39 d3                	cmp    %edx,%ebx
+  802270:	0f 47 da             	cmova  %edx,%ebx
+  802273:	8b 55 08             	mov    0x8(%ebp),%edx
+  802276:	29 fa                	sub    %edi,%edx
+  802278:	39 d3                	cmp    %edx,%ebx
+  80227a:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80227d:	83 ec 04             	sub    $0x4,%esp
+  802280:	53                   	push   %ebx
+  802281:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802284:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802287:	52                   	push   %edx
+  802288:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80228b:	01 c8                	add    %ecx,%eax
+  80228d:	50                   	push   %eax
+  80228e:	e8 df e6 ff ff       	call   800972 <memcpy>
+    i += m;
+  802293:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802295:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802298:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80229b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80229e:	e8 57 fe ff ff       	call   8020fa <pipe_wakeup>
+  8022a3:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8022a6:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8022a9:	73 2b                	jae    8022d6 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8022ab:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8022ad:	8b 56 04             	mov    0x4(%esi),%edx
+  8022b0:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8022b6:	39 d0                	cmp    %edx,%eax
+  8022b8:	7d 93                	jge    80224d <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8022ba:	89 f2                	mov    %esi,%edx
+  8022bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8022bf:	e8 e2 fe ff ff       	call   8021a6 <_pipeisclosed>
+  8022c4:	85 c0                	test   %eax,%eax
+  8022c6:	0f 84 65 ff ff ff    	je     802231 <devpipe_write_bulk+0x26>
+        return i;
+  8022cc:	89 f8                	mov    %edi,%eax
+}
+  8022ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d1:	5b                   	pop    %ebx
+  8022d2:	5e                   	pop    %esi
+  8022d3:	5f                   	pop    %edi
+  8022d4:	5d                   	pop    %ebp
+  8022d5:	c3                   	ret
+  return i;
+  8022d6:	89 f8                	mov    %edi,%eax
+  8022d8:	eb f4                	jmp    8022ce <devpipe_write_bulk+0xc3>
+
+008022da <devpipe_write>:
+{
+  8022da:	55                   	push   %ebp
+  8022db:	89 e5                	mov    %esp,%ebp
+  8022dd:	57                   	push   %edi
+  8022de:	56                   	push   %esi
+  8022df:	53                   	push   %ebx
+  8022e0:	83 ec 28             	sub    $0x28,%esp
+  8022e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8022e6:	56                   	push   %esi
+  8022e7:	e8 8c ed ff ff       	call   801078 <fd2data>
+  8022ec:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8022ee:	8b 78 28             	mov    0x28(%eax),%edi
+  8022f1:	83 c4 10             	add    $0x10,%esp
+  8022f4:	85 ff                	test   %edi,%edi
+  8022f6:	75 25                	jne    80231d <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8022f8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8022fb:	74 66                	je     802363 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8022fd:	8b 43 04             	mov    0x4(%ebx),%eax
+  802300:	8b 0b                	mov    (%ebx),%ecx
+  802302:	8d 51 20             	lea    0x20(%ecx),%edx
+  802305:	39 d0                	cmp    %edx,%eax
+  802307:	72 2b                	jb     802334 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802309:	89 da                	mov    %ebx,%edx
+  80230b:	89 f0                	mov    %esi,%eax
+  80230d:	e8 94 fe ff ff       	call   8021a6 <_pipeisclosed>
+  802312:	85 c0                	test   %eax,%eax
+  802314:	75 51                	jne    802367 <devpipe_write+0x8d>
+      sys_yield();
+  802316:	e8 3c e8 ff ff       	call   800b57 <sys_yield>
+  80231b:	eb e0                	jmp    8022fd <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  80231d:	83 ec 0c             	sub    $0xc,%esp
+  802320:	ff 75 10             	push   0x10(%ebp)
+  802323:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802326:	89 c2                	mov    %eax,%edx
+  802328:	89 f0                	mov    %esi,%eax
+  80232a:	e8 dc fe ff ff       	call   80220b <devpipe_write_bulk>
+  80232f:	83 c4 10             	add    $0x10,%esp
+  802332:	eb 38                	jmp    80236c <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802334:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802337:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80233b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80233e:	89 c2                	mov    %eax,%edx
+  802340:	c1 fa 1f             	sar    $0x1f,%edx
+  802343:	89 d1                	mov    %edx,%ecx
+  802345:	c1 e9 1b             	shr    $0x1b,%ecx
+  802348:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80234b:	83 e2 1f             	and    $0x1f,%edx
+  80234e:	29 ca                	sub    %ecx,%edx
+  802350:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802354:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802358:	83 c0 01             	add    $0x1,%eax
+  80235b:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80235e:	83 c7 01             	add    $0x1,%edi
+  802361:	eb 95                	jmp    8022f8 <devpipe_write+0x1e>
+  return i;
+  802363:	89 f8                	mov    %edi,%eax
+  802365:	eb 05                	jmp    80236c <devpipe_write+0x92>
+        return 0;
+  802367:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80236c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80236f:	5b                   	pop    %ebx
+  802370:	5e                   	pop    %esi
+  802371:	5f                   	pop    %edi
+  802372:	5d                   	pop    %ebp
+  802373:	c3                   	ret
+
+00802374 <devpipe_read_bulk>:
+{
+  802374:	55                   	push   %ebp
+  802375:	89 e5                	mov    %esp,%ebp
+  802377:	57                   	push   %edi
+  802378:	56                   	push   %esi
+  802379:	53                   	push   %ebx
+  80237a:	83 ec 2c             	sub    $0x2c,%esp
+  80237d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802380:	89 d6                	mov    %edx,%esi
+  802382:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802385:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802388:	e8 0c fd ff ff       	call   802099 <pipe_ring>
+  80238d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802390:	85 db                	test   %ebx,%ebx
+  802392:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802397:	0f 45 c3             	cmovne %ebx,%eax
+  80239a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80239d:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8023a2:	8d 46 30             	lea    0x30(%esi),%eax
+  8023a5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8023a8:	eb 50                	jmp    8023fa <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8023aa:	89 d1                	mov    %edx,%ecx
+  8023ac:	c1 f9 1f             	sar    $0x1f,%ecx
+  8023af:	c1 e9 11             	shr    $0x11,%ecx
+  8023b2:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8023b5:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8023ba:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8023bc:	29 d3                	sub    %edx,%ebx
+  8023be:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8023c3:	29 c2                	sub    %eax,%edx
+  8023c5:	39 d3                	cmp    %edx,%ebx
+  8023c7:	0f 47 da             	cmova  %edx,%ebx
+  8023ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023cd:	29 fa                	sub    %edi,%edx
+  8023cf:	39 d3                	cmp    %edx,%ebx
+  8023d1:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8023d4:	83 ec 04             	sub    $0x4,%esp
+  8023d7:	53                   	push   %ebx
+  8023d8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8023db:	01 c8                	add    %ecx,%eax
+  8023dd:	50                   	push   %eax
+  8023de:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8023e1:	01 f8                	add    %edi,%eax
+  8023e3:	50                   	push   %eax
+  8023e4:	e8 89 e5 ff ff       	call   800972 <memcpy>
+    i += m;
+  8023e9:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8023eb:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8023ed:	89 f2                	mov    %esi,%edx
+  8023ef:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8023f2:	e8 03 fd ff ff       	call   8020fa <pipe_wakeup>
+  8023f7:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8023fa:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8023fd:	73 51                	jae    802450 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8023ff:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802402:	8b 16                	mov    (%esi),%edx
+  802404:	39 da                	cmp    %ebx,%edx
+  802406:	75 a2                	jne    8023aa <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802408:	85 ff                	test   %edi,%edi
+  80240a:	75 44                	jne    802450 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  80240c:	89 f2                	mov    %esi,%edx
+  80240e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802411:	e8 90 fd ff ff       	call   8021a6 <_pipeisclosed>
+  802416:	85 c0                	test   %eax,%eax
+  802418:	75 3a                	jne    802454 <devpipe_read_bulk+0xe0>
+  80241a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80241f:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802423:	6a 64                	push   $0x64
+  802425:	ff 75 d4             	push   -0x2c(%ebp)
+  802428:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802429:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80242c:	50                   	push   %eax
+  80242d:	e8 c0 ea ff ff       	call   800ef2 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802432:	85 c0                	test   %eax,%eax
+  802434:	ba 00 00 00 00       	mov    $0x0,%edx
+  802439:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  80243c:	83 c4 10             	add    $0x10,%esp
+  80243f:	a8 01                	test   $0x1,%al
+  802441:	74 b7                	je     8023fa <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802443:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802448:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80244b:	5b                   	pop    %ebx
+  80244c:	5e                   	pop    %esi
+  80244d:	5f                   	pop    %edi
+  80244e:	5d                   	pop    %ebp
+  80244f:	c3                   	ret
+  return i;
+  802450:	89 f8                	mov    %edi,%eax
+  802452:	eb f4                	jmp    802448 <devpipe_read_bulk+0xd4>
+        return 0;
+  802454:	b8 00 00 00 00       	mov    $0x0,%eax
+  802459:	eb ed                	jmp    802448 <devpipe_read_bulk+0xd4>
+
+0080245b <devpipe_read>:
+{
+  80245b:	55                   	push   %ebp
+  80245c:	89 e5                	mov    %esp,%ebp
+  80245e:	57                   	push   %edi
+  80245f:	56                   	push   %esi
+  802460:	53                   	push   %ebx
+  802461:	83 ec 18             	sub    $0x18,%esp
+  802464:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802467:	57                   	push   %edi
+  802468:	e8 0b ec ff ff       	call   801078 <fd2data>
+  80246d:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80246f:	8b 70 28             	mov    0x28(%eax),%esi
+  802472:	83 c4 10             	add    $0x10,%esp
+  802475:	85 f6                	test   %esi,%esi
+  802477:	75 24                	jne    80249d <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802479:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80247c:	74 60                	je     8024de <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  80247e:	8b 03                	mov    (%ebx),%eax
+  802480:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802483:	75 3b                	jne    8024c0 <devpipe_read+0x65>
+      if (i > 0)
+  802485:	85 f6                	test   %esi,%esi
+  802487:	75 2d                	jne    8024b6 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802489:	89 da                	mov    %ebx,%edx
+  80248b:	89 f8                	mov    %edi,%eax
+  80248d:	e8 14 fd ff ff       	call   8021a6 <_pipeisclosed>
+  802492:	85 c0                	test   %eax,%eax
+  802494:	75 4c                	jne    8024e2 <devpipe_read+0x87>
+      sys_yield();
+  802496:	e8 bc e6 ff ff       	call   800b57 <sys_yield>
+  80249b:	eb e1                	jmp    80247e <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  80249d:	83 ec 08             	sub    $0x8,%esp
+  8024a0:	6a 00                	push   $0x0
+  8024a2:	ff 75 10             	push   0x10(%ebp)
+  8024a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024a8:	89 c2                	mov    %eax,%edx
+  8024aa:	89 f8                	mov    %edi,%eax
+  8024ac:	e8 c3 fe ff ff       	call   802374 <devpipe_read_bulk>
+  8024b1:	83 c4 10             	add    $0x10,%esp
+  8024b4:	eb 02                	jmp    8024b8 <devpipe_read+0x5d>
+        return i;
+  8024b6:	89 f0                	mov    %esi,%eax
+}
+  8024b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024bb:	5b                   	pop    %ebx
+  8024bc:	5e                   	pop    %esi
+  8024bd:	5f                   	pop    %edi
+  8024be:	5d                   	pop    %ebp
+  8024bf:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8024c0:	99                   	cltd
+  8024c1:	c1 ea 1b             	shr    $0x1b,%edx
+  8024c4:	01 d0                	add    %edx,%eax
+  8024c6:	83 e0 1f             	and    $0x1f,%eax
+  8024c9:	29 d0                	sub    %edx,%eax
+  8024cb:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8024d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024d3:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8024d6:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8024d9:	83 c6 01             	add    $0x1,%esi
+  8024dc:	eb 9b                	jmp    802479 <devpipe_read+0x1e>
+  return i;
+  8024de:	89 f0                	mov    %esi,%eax
+  8024e0:	eb d6                	jmp    8024b8 <devpipe_read+0x5d>
+        return 0;
+  8024e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e7:	eb cf                	jmp    8024b8 <devpipe_read+0x5d>
+
+008024e9 <pipe2>:
+{
+  8024e9:	55                   	push   %ebp
+  8024ea:	89 e5                	mov    %esp,%ebp
+  8024ec:	57                   	push   %edi
+  8024ed:	56                   	push   %esi
+  8024ee:	53                   	push   %ebx
+  8024ef:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8024f2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024f5:	50                   	push   %eax
+  8024f6:	e8 91 eb ff ff       	call   80108c <fd_alloc>
+  8024fb:	89 c3                	mov    %eax,%ebx
+  8024fd:	83 c4 10             	add    $0x10,%esp
+  802500:	85 c0                	test   %eax,%eax
+  802502:	0f 88 fb 01 00 00    	js     802703 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802508:	83 ec 04             	sub    $0x4,%esp
+  80250b:	68 07 04 00 00       	push   $0x407
+  802510:	ff 75 e4             	push   -0x1c(%ebp)
+  802513:	6a 00                	push   $0x0
+  802515:	e8 9f e6 ff ff       	call   800bb9 <sys_page_alloc>
+  80251a:	89 c3                	mov    %eax,%ebx
+  80251c:	83 c4 10             	add    $0x10,%esp
+  80251f:	85 c0                	test   %eax,%eax
+  802521:	0f 88 dc 01 00 00    	js     802703 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802527:	83 ec 0c             	sub    $0xc,%esp
+  80252a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80252d:	50                   	push   %eax
+  80252e:	e8 59 eb ff ff       	call   80108c <fd_alloc>
+  802533:	89 c3                	mov    %eax,%ebx
+  802535:	83 c4 10             	add    $0x10,%esp
+  802538:	85 c0                	test   %eax,%eax
+  80253a:	0f 88 b3 01 00 00    	js     8026f3 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802540:	83 ec 04             	sub    $0x4,%esp
+  802543:	68 07 04 00 00       	push   $0x407
+  802548:	ff 75 e0             	push   -0x20(%ebp)
+  80254b:	6a 00                	push   $0x0
+  80254d:	e8 67 e6 ff ff       	call   800bb9 <sys_page_alloc>
+  802552:	89 c3                	mov    %eax,%ebx
+  802554:	83 c4 10             	add    $0x10,%esp
+  802557:	85 c0                	test   %eax,%eax
+  802559:	0f 88 94 01 00 00    	js     8026f3 <pipe2+0x20a>
+  va = fd2data(fd0);
+  80255f:	83 ec 0c             	sub    $0xc,%esp
+  802562:	ff 75 e4             	push   -0x1c(%ebp)
+  802565:	e8 0e eb ff ff       	call   801078 <fd2data>
+  80256a:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80256c:	83 c4 0c             	add    $0xc,%esp
+  80256f:	68 07 04 00 00       	push   $0x407
+  802574:	50                   	push   %eax
+  802575:	6a 00                	push   $0x0
+  802577:	e8 3d e6 ff ff       	call   800bb9 <sys_page_alloc>
+  80257c:	89 c3                	mov    %eax,%ebx
+  80257e:	83 c4 10             	add    $0x10,%esp
+  802581:	85 c0                	test   %eax,%eax
+  802583:	0f 88 5a 01 00 00    	js     8026e3 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802589:	83 ec 0c             	sub    $0xc,%esp
+  80258c:	ff 75 e0             	push   -0x20(%ebp)
+  80258f:	e8 e4 ea ff ff       	call   801078 <fd2data>
+  802594:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80259b:	50                   	push   %eax
+  80259c:	6a 00                	push   $0x0
+  80259e:	57                   	push   %edi
+  80259f:	6a 00                	push   $0x0
+  8025a1:	e8 56 e6 ff ff       	call   800bfc <sys_page_map>
+  8025a6:	89 c3                	mov    %eax,%ebx
+  8025a8:	83 c4 20             	add    $0x20,%esp
+  8025ab:	85 c0                	test   %eax,%eax
+  8025ad:	0f 88 22 01 00 00    	js     8026d5 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  8025b3:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  8025b7:	74 72                	je     80262b <pipe2+0x142>
+  8025b9:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8025be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025c1:	e8 d3 fa ff ff       	call   802099 <pipe_ring>
+  8025c6:	83 ec 04             	sub    $0x4,%esp
+  8025c9:	68 07 04 00 00       	push   $0x407
+  8025ce:	01 f0                	add    %esi,%eax
+  8025d0:	50                   	push   %eax
+  8025d1:	6a 00                	push   $0x0
+  8025d3:	e8 e1 e5 ff ff       	call   800bb9 <sys_page_alloc>
+  8025d8:	89 c3                	mov    %eax,%ebx
+  8025da:	83 c4 10             	add    $0x10,%esp
+  8025dd:	85 c0                	test   %eax,%eax
+  8025df:	0f 88 97 00 00 00    	js     80267c <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8025e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025e8:	e8 ac fa ff ff       	call   802099 <pipe_ring>
+  8025ed:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8025f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025f3:	e8 a1 fa ff ff       	call   802099 <pipe_ring>
+  8025f8:	83 ec 0c             	sub    $0xc,%esp
+  8025fb:	68 07 04 00 00       	push   $0x407
+  802600:	53                   	push   %ebx
+  802601:	6a 00                	push   $0x0
+  802603:	01 f0                	add    %esi,%eax
+  802605:	50                   	push   %eax
+  802606:	6a 00                	push   $0x0
+  802608:	e8 ef e5 ff ff       	call   800bfc <sys_page_map>
+  80260d:	89 c3                	mov    %eax,%ebx
+  80260f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802615:	83 c4 20             	add    $0x20,%esp
+  802618:	85 c0                	test   %eax,%eax
+  80261a:	78 60                	js     80267c <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  80261c:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802622:	75 9a                	jne    8025be <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802624:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  80262b:	a1 20 40 80 00       	mov    0x804020,%eax
+  802630:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802633:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802635:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802638:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  80263f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802642:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802644:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802647:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  80264e:	83 ec 0c             	sub    $0xc,%esp
+  802651:	ff 75 e4             	push   -0x1c(%ebp)
+  802654:	e8 0f ea ff ff       	call   801068 <fd2num>
+  802659:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80265c:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  80265e:	83 c4 04             	add    $0x4,%esp
+  802661:	ff 75 e0             	push   -0x20(%ebp)
+  802664:	e8 ff e9 ff ff       	call   801068 <fd2num>
+  802669:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80266c:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  80266f:	83 c4 10             	add    $0x10,%esp
+  802672:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802677:	e9 87 00 00 00       	jmp    802703 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  80267c:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802681:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802684:	e8 10 fa ff ff       	call   802099 <pipe_ring>
+  802689:	83 ec 08             	sub    $0x8,%esp
+  80268c:	01 f0                	add    %esi,%eax
+  80268e:	50                   	push   %eax
+  80268f:	6a 00                	push   $0x0
+  802691:	e8 a8 e5 ff ff       	call   800c3e <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802696:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802699:	e8 fb f9 ff ff       	call   802099 <pipe_ring>
+  80269e:	83 c4 08             	add    $0x8,%esp
+  8026a1:	01 f0                	add    %esi,%eax
+  8026a3:	50                   	push   %eax
+  8026a4:	6a 00                	push   $0x0
+  8026a6:	e8 93 e5 ff ff       	call   800c3e <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8026ab:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8026b1:	83 c4 10             	add    $0x10,%esp
+  8026b4:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8026ba:	75 c5                	jne    802681 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  8026bc:	83 ec 0c             	sub    $0xc,%esp
+  8026bf:	ff 75 e0             	push   -0x20(%ebp)
+  8026c2:	e8 b1 e9 ff ff       	call   801078 <fd2data>
+  8026c7:	83 c4 08             	add    $0x8,%esp
+  8026ca:	50                   	push   %eax
+  8026cb:	6a 00                	push   $0x0
+  8026cd:	e8 6c e5 ff ff       	call   800c3e <sys_page_unmap>
+  8026d2:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8026d5:	83 ec 08             	sub    $0x8,%esp
+  8026d8:	57                   	push   %edi
+  8026d9:	6a 00                	push   $0x0
+  8026db:	e8 5e e5 ff ff       	call   800c3e <sys_page_unmap>
+  8026e0:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8026e3:	83 ec 08             	sub    $0x8,%esp
+  8026e6:	ff 75 e0             	push   -0x20(%ebp)
+  8026e9:	6a 00                	push   $0x0
+  8026eb:	e8 4e e5 ff ff       	call   800c3e <sys_page_unmap>
+  8026f0:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8026f3:	83 ec 08             	sub    $0x8,%esp
+  8026f6:	ff 75 e4             	push   -0x1c(%ebp)
+  8026f9:	6a 00                	push   $0x0
+  8026fb:	e8 3e e5 ff ff       	call   800c3e <sys_page_unmap>
+  802700:	83 c4 10             	add    $0x10,%esp
+}
+  802703:	89 d8                	mov    %ebx,%eax
+  802705:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802708:	5b                   	pop    %ebx
+  802709:	5e                   	pop    %esi
+  80270a:	5f                   	pop    %edi
+  80270b:	5d                   	pop    %ebp
+  80270c:	c3                   	ret
+
+0080270d <pipe>:
+{
+  80270d:	55                   	push   %ebp
+  80270e:	89 e5                	mov    %esp,%ebp
+  802710:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802713:	6a 00                	push   $0x0
+  802715:	ff 75 08             	push   0x8(%ebp)
+  802718:	e8 cc fd ff ff       	call   8024e9 <pipe2>
+}
+  80271d:	c9                   	leave
+  80271e:	c3                   	ret
+
+0080271f <pipeisclosed>:
+{
+  80271f:	55                   	push   %ebp
+  802720:	89 e5                	mov    %esp,%ebp
+  802722:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802725:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802728:	50                   	push   %eax
+  802729:	ff 75 08             	push   0x8(%ebp)
+  80272c:	e8 b1 e9 ff ff       	call   8010e2 <fd_lookup>
+  802731:	83 c4 10             	add    $0x10,%esp
+  802734:	85 c0                	test   %eax,%eax
+  802736:	78 18                	js     802750 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802738:	83 ec 0c             	sub    $0xc,%esp
+  80273b:	ff 75 f4             	push   -0xc(%ebp)
+  80273e:	e8 35 e9 ff ff       	call   801078 <fd2data>
+  802743:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802745:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802748:	e8 59 fa ff ff       	call   8021a6 <_pipeisclosed>
+  80274d:	83 c4 10             	add    $0x10,%esp
+}
+  802750:	c9                   	leave
+  802751:	c3                   	ret
+
+00802752 <pipe_splice>:
+{
+  802752:	55                   	push   %ebp
+  802753:	89 e5                	mov    %esp,%ebp
+  802755:	57                   	push   %edi
+  802756:	56                   	push   %esi
+  802757:	53                   	push   %ebx
+  802758:	83 ec 34             	sub    $0x34,%esp
+  80275b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80275e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802761:	50                   	push   %eax
+  802762:	ff 75 08             	push   0x8(%ebp)
+  802765:	e8 78 e9 ff ff       	call   8010e2 <fd_lookup>
+  80276a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80276d:	83 c4 10             	add    $0x10,%esp
+  802770:	85 c0                	test   %eax,%eax
+  802772:	0f 88 d7 00 00 00    	js     80284f <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802778:	83 ec 0c             	sub    $0xc,%esp
+  80277b:	ff 75 e4             	push   -0x1c(%ebp)
+  80277e:	e8 f5 e8 ff ff       	call   801078 <fd2data>
+  802783:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802785:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802788:	83 c4 10             	add    $0x10,%esp
+  80278b:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802791:	39 10                	cmp    %edx,(%eax)
+  802793:	0f 85 c1 00 00 00    	jne    80285a <pipe_splice+0x108>
+  802799:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  80279d:	0f 84 c0 00 00 00    	je     802863 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  8027a3:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8027a7:	0f 84 bf 00 00 00    	je     80286c <pipe_splice+0x11a>
+  8027ad:	89 f7                	mov    %esi,%edi
+  8027af:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8027b5:	0f 85 ba 00 00 00    	jne    802875 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8027bb:	8d 43 04             	lea    0x4(%ebx),%eax
+  8027be:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8027c1:	eb 38                	jmp    8027fb <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8027c3:	83 ec 0c             	sub    $0xc,%esp
+  8027c6:	68 00 10 00 00       	push   $0x1000
+  8027cb:	89 f1                	mov    %esi,%ecx
+  8027cd:	89 da                	mov    %ebx,%edx
+  8027cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027d2:	e8 34 fa ff ff       	call   80220b <devpipe_write_bulk>
+  8027d7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8027da:	83 c4 10             	add    $0x10,%esp
+  8027dd:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8027e2:	75 53                	jne    802837 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8027e4:	83 ec 08             	sub    $0x8,%esp
+  8027e7:	56                   	push   %esi
+  8027e8:	6a 00                	push   $0x0
+  8027ea:	e8 4f e4 ff ff       	call   800c3e <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8027ef:	83 c7 01             	add    $0x1,%edi
+  8027f2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8027f8:	83 c4 10             	add    $0x10,%esp
+  8027fb:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8027fe:	74 3a                	je     80283a <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802800:	8b 03                	mov    (%ebx),%eax
+  802802:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802805:	75 bc                	jne    8027c3 <pipe_splice+0x71>
+  802807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280c:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802810:	85 c0                	test   %eax,%eax
+  802812:	74 af                	je     8027c3 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802814:	83 ec 04             	sub    $0x4,%esp
+  802817:	6a 07                	push   $0x7
+  802819:	56                   	push   %esi
+  80281a:	ff 75 d0             	push   -0x30(%ebp)
+  80281d:	e8 f3 e6 ff ff       	call   800f15 <sys_chan_wakeup>
+  802822:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802825:	83 c4 10             	add    $0x10,%esp
+  802828:	85 c0                	test   %eax,%eax
+  80282a:	79 b8                	jns    8027e4 <pipe_splice+0x92>
+  80282c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802831:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802835:	eb 8c                	jmp    8027c3 <pipe_splice+0x71>
+  802837:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  80283a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80283e:	75 06                	jne    802846 <pipe_splice+0xf4>
+  802840:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802844:	78 09                	js     80284f <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802846:	8b 45 10             	mov    0x10(%ebp),%eax
+  802849:	c1 e0 0c             	shl    $0xc,%eax
+  80284c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  80284f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802852:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802855:	5b                   	pop    %ebx
+  802856:	5e                   	pop    %esi
+  802857:	5f                   	pop    %edi
+  802858:	5d                   	pop    %ebp
+  802859:	c3                   	ret
+    return -E_INVAL;
+  80285a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802861:	eb ec                	jmp    80284f <pipe_splice+0xfd>
+  802863:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80286a:	eb e3                	jmp    80284f <pipe_splice+0xfd>
+  80286c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802873:	eb da                	jmp    80284f <pipe_splice+0xfd>
+  802875:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80287c:	eb d1                	jmp    80284f <pipe_splice+0xfd>
+
+0080287e <pipe_splice_read>:
+{
+  80287e:	55                   	push   %ebp
+  80287f:	89 e5                	mov    %esp,%ebp
+  802881:	53                   	push   %ebx
+  802882:	83 ec 1c             	sub    $0x1c,%esp
+  802885:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802888:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80288b:	50                   	push   %eax
+  80288c:	ff 75 08             	push   0x8(%ebp)
+  80288f:	e8 4e e8 ff ff       	call   8010e2 <fd_lookup>
+  802894:	83 c4 10             	add    $0x10,%esp
+  802897:	85 c0                	test   %eax,%eax
+  802899:	78 49                	js     8028e4 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  80289b:	83 ec 0c             	sub    $0xc,%esp
+  80289e:	ff 75 f4             	push   -0xc(%ebp)
+  8028a1:	e8 d2 e7 ff ff       	call   801078 <fd2data>
+  8028a6:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8028a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028ab:	83 c4 10             	add    $0x10,%esp
+  8028ae:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8028b4:	39 08                	cmp    %ecx,(%eax)
+  8028b6:	75 31                	jne    8028e9 <pipe_splice_read+0x6b>
+  8028b8:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  8028bc:	74 32                	je     8028f0 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  8028be:	8b 48 08             	mov    0x8(%eax),%ecx
+  8028c1:	83 e1 03             	and    $0x3,%ecx
+  8028c4:	83 f9 01             	cmp    $0x1,%ecx
+  8028c7:	74 2e                	je     8028f7 <pipe_splice_read+0x79>
+  8028c9:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8028cf:	75 2d                	jne    8028fe <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  8028d1:	83 ec 08             	sub    $0x8,%esp
+  8028d4:	53                   	push   %ebx
+  8028d5:	68 00 10 00 00       	push   $0x1000
+  8028da:	89 d9                	mov    %ebx,%ecx
+  8028dc:	e8 93 fa ff ff       	call   802374 <devpipe_read_bulk>
+  8028e1:	83 c4 10             	add    $0x10,%esp
+}
+  8028e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028e7:	c9                   	leave
+  8028e8:	c3                   	ret
+    return -E_INVAL;
+  8028e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028ee:	eb f4                	jmp    8028e4 <pipe_splice_read+0x66>
+  8028f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028f5:	eb ed                	jmp    8028e4 <pipe_splice_read+0x66>
+  8028f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028fc:	eb e6                	jmp    8028e4 <pipe_splice_read+0x66>
+  8028fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802903:	eb df                	jmp    8028e4 <pipe_splice_read+0x66>
+
+00802905 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290a:	c3                   	ret
+
+0080290b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80290b:	55                   	push   %ebp
+  80290c:	89 e5                	mov    %esp,%ebp
+  80290e:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802911:	68 87 33 80 00       	push   $0x803387
+  802916:	ff 75 0c             	push   0xc(%ebp)
+  802919:	e8 6c de ff ff       	call   80078a <strcpy>
+  return 0;
+}
+  80291e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802923:	c9                   	leave
+  802924:	c3                   	ret
+
+00802925 <devcons_write>:
+{
+  802925:	55                   	push   %ebp
+  802926:	89 e5                	mov    %esp,%ebp
+  802928:	57                   	push   %edi
+  802929:	56                   	push   %esi
+  80292a:	53                   	push   %ebx
+  80292b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802931:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802936:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  80293c:	eb 2e                	jmp    80296c <devcons_write+0x47>
+    m = n - tot;
+  80293e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802941:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802943:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802948:	39 c3                	cmp    %eax,%ebx
+  80294a:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  80294d:	83 ec 04             	sub    $0x4,%esp
+  802950:	53                   	push   %ebx
+  802951:	89 f0                	mov    %esi,%eax
+  802953:	03 45 0c             	add    0xc(%ebp),%eax
+  802956:	50                   	push   %eax
+  802957:	57                   	push   %edi
+  802958:	e8 b3 df ff ff       	call   800910 <memmove>
+    sys_cputs(buf, m);
+  80295d:	83 c4 08             	add    $0x8,%esp
+  802960:	53                   	push   %ebx
+  802961:	57                   	push   %edi
+  802962:	e8 53 e1 ff ff       	call   800aba <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802967:	01 de                	add    %ebx,%esi
+  802969:	83 c4 10             	add    $0x10,%esp
+  80296c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80296f:	72 cd                	jb     80293e <devcons_write+0x19>
+}
+  802971:	89 f0                	mov    %esi,%eax
+  802973:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802976:	5b                   	pop    %ebx
+  802977:	5e                   	pop    %esi
+  802978:	5f                   	pop    %edi
+  802979:	5d                   	pop    %ebp
+  80297a:	c3                   	ret
+
+0080297b <devcons_read>:
+{
+  80297b:	55                   	push   %ebp
+  80297c:	89 e5                	mov    %esp,%ebp
+  80297e:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802981:	b8 00 00 00 00       	mov    $0x0,%eax
+  802986:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80298a:	75 07                	jne    802993 <devcons_read+0x18>
+  80298c:	eb 1f                	jmp    8029ad <devcons_read+0x32>
+    sys_yield();
+  80298e:	e8 c4 e1 ff ff       	call   800b57 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802993:	e8 40 e1 ff ff       	call   800ad8 <sys_cgetc>
+  802998:	85 c0                	test   %eax,%eax
+  80299a:	74 f2                	je     80298e <devcons_read+0x13>
+  if (c < 0)
+  80299c:	78 0f                	js     8029ad <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  80299e:	83 f8 04             	cmp    $0x4,%eax
+  8029a1:	74 0c                	je     8029af <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8029a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029a6:	88 02                	mov    %al,(%edx)
+  return 1;
+  8029a8:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8029ad:	c9                   	leave
+  8029ae:	c3                   	ret
+    return 0;
+  8029af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b4:	eb f7                	jmp    8029ad <devcons_read+0x32>
+
+008029b6 <cputchar>:
+{
+  8029b6:	55                   	push   %ebp
+  8029b7:	89 e5                	mov    %esp,%ebp
+  8029b9:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  8029bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029bf:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8029c2:	6a 01                	push   $0x1
+  8029c4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029c7:	50                   	push   %eax
+  8029c8:	e8 ed e0 ff ff       	call   800aba <sys_cputs>
+}
+  8029cd:	83 c4 10             	add    $0x10,%esp
+  8029d0:	c9                   	leave
+  8029d1:	c3                   	ret
+
+008029d2 <getchar>:
+{
+  8029d2:	55                   	push   %ebp
+  8029d3:	89 e5                	mov    %esp,%ebp
+  8029d5:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8029d8:	6a 01                	push   $0x1
+  8029da:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029dd:	50                   	push   %eax
+  8029de:	6a 00                	push   $0x0
+  8029e0:	e8 a8 e9 ff ff       	call   80138d <read>
+  if (r < 0)
+  8029e5:	83 c4 10             	add    $0x10,%esp
+  8029e8:	85 c0                	test   %eax,%eax
+  8029ea:	78 06                	js     8029f2 <getchar+0x20>
+  if (r < 1)
+  8029ec:	74 06                	je     8029f4 <getchar+0x22>
+  return c;
+  8029ee:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8029f2:	c9                   	leave
+  8029f3:	c3                   	ret
+    return -E_EOF;
+  8029f4:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8029f9:	eb f7                	jmp    8029f2 <getchar+0x20>
+
+008029fb <iscons>:
+{
+  8029fb:	55                   	push   %ebp
+  8029fc:	89 e5                	mov    %esp,%ebp
+  8029fe:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a01:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a04:	50                   	push   %eax
+  802a05:	ff 75 08             	push   0x8(%ebp)
+  802a08:	e8 d5 e6 ff ff       	call   8010e2 <fd_lookup>
+  802a0d:	83 c4 10             	add    $0x10,%esp
+  802a10:	85 c0                	test   %eax,%eax
+  802a12:	78 11                	js     802a25 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802a14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a17:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802a1d:	39 10                	cmp    %edx,(%eax)
+  802a1f:	0f 94 c0             	sete   %al
+  802a22:	0f b6 c0             	movzbl %al,%eax
+}
+  802a25:	c9                   	leave
+  802a26:	c3                   	ret
+
+00802a27 <opencons>:
+{
+  802a27:	55                   	push   %ebp
+  802a28:	89 e5                	mov    %esp,%ebp
+  802a2a:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802a2d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a30:	50                   	push   %eax
+  802a31:	e8 56 e6 ff ff       	call   80108c <fd_alloc>
+  802a36:	83 c4 10             	add    $0x10,%esp
+  802a39:	85 c0                	test   %eax,%eax
+  802a3b:	78 3a                	js     802a77 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802a3d:	83 ec 04             	sub    $0x4,%esp
+  802a40:	68 07 04 00 00       	push   $0x407
+  802a45:	ff 75 f4             	push   -0xc(%ebp)
+  802a48:	6a 00                	push   $0x0
+  802a4a:	e8 6a e1 ff ff       	call   800bb9 <sys_page_alloc>
+  802a4f:	83 c4 10             	add    $0x10,%esp
+  802a52:	85 c0                	test   %eax,%eax
+  802a54:	78 21                	js     802a77 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802a56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a59:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802a5f:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802a61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a64:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802a6b:	83 ec 0c             	sub    $0xc,%esp
+  802a6e:	50                   	push   %eax
+  802a6f:	e8 f4 e5 ff ff       	call   801068 <fd2num>
+  802a74:	83 c4 10             	add    $0x10,%esp
+}
+  802a77:	c9                   	leave
+  802a78:	c3                   	ret
+
+00802a79 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802a79:	55                   	push   %ebp
+  802a7a:	89 e5                	mov    %esp,%ebp
+  802a7c:	56                   	push   %esi
+  802a7d:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  802a7e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802a81:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802a87:	e8 ac e0 ff ff       	call   800b38 <sys_getenvid>
+  802a8c:	83 ec 0c             	sub    $0xc,%esp
+  802a8f:	ff 75 0c             	push   0xc(%ebp)
+  802a92:	ff 75 08             	push   0x8(%ebp)
+  802a95:	56                   	push   %esi
+  802a96:	50                   	push   %eax
+  802a97:	68 94 33 80 00       	push   $0x803394
+  802a9c:	e8 fb d6 ff ff       	call   80019c <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  802aa1:	83 c4 18             	add    $0x18,%esp
+  802aa4:	53                   	push   %ebx
+  802aa5:	ff 75 10             	push   0x10(%ebp)
+  802aa8:	e8 9e d6 ff ff       	call   80014b <vcprintf>
+  cprintf("\n");
+  802aad:	c7 04 24 80 33 80 00 	movl   $0x803380,(%esp)
+  802ab4:	e8 e3 d6 ff ff       	call   80019c <cprintf>
+  802ab9:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  802abc:	cc                   	int3
+  while (1)
+  802abd:	eb fd                	jmp    802abc <_panic+0x43>
+
+00802abf <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802abf:	55                   	push   %ebp
+  802ac0:	89 e5                	mov    %esp,%ebp
+  802ac2:	57                   	push   %edi
+  802ac3:	56                   	push   %esi
+  802ac4:	53                   	push   %ebx
+  802ac5:	83 ec 14             	sub    $0x14,%esp
+  802ac8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802acb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ace:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ad1:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802ad4:	85 c0                	test   %eax,%eax
+  802ad6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802adb:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802ade:	ff 33                	push   (%ebx)
+  802ae0:	50                   	push   %eax
+  802ae1:	e8 ab e3 ff ff       	call   800e91 <sys_ipc_recv>
+  802ae6:	83 c4 10             	add    $0x10,%esp
+  802ae9:	85 c0                	test   %eax,%eax
+  802aeb:	78 39                	js     802b26 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802aed:	85 ff                	test   %edi,%edi
+  802aef:	74 0a                	je     802afb <ipc_recv_pages+0x3c>
+  802af1:	a1 44 57 80 00       	mov    0x805744,%eax
+  802af6:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802af9:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802afb:	85 f6                	test   %esi,%esi
+  802afd:	74 0d                	je     802b0c <ipc_recv_pages+0x4d>
+  802aff:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b04:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802b0a:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802b0c:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b11:	8b 40 74             	mov    0x74(%eax),%eax
+  802b14:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802b16:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b1b:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802b1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b21:	5b                   	pop    %ebx
+  802b22:	5e                   	pop    %esi
+  802b23:	5f                   	pop    %edi
+  802b24:	5d                   	pop    %ebp
+  802b25:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802b26:	85 ff                	test   %edi,%edi
+  802b28:	74 06                	je     802b30 <ipc_recv_pages+0x71>
+  802b2a:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802b30:	85 f6                	test   %esi,%esi
+  802b32:	74 06                	je     802b3a <ipc_recv_pages+0x7b>
+  802b34:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802b3a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802b40:	eb dc                	jmp    802b1e <ipc_recv_pages+0x5f>
+
+00802b42 <ipc_recv>:
+{
+  802b42:	55                   	push   %ebp
+  802b43:	89 e5                	mov    %esp,%ebp
+  802b45:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802b48:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802b4f:	ff 75 10             	push   0x10(%ebp)
+  802b52:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b55:	50                   	push   %eax
+  802b56:	ff 75 0c             	push   0xc(%ebp)
+  802b59:	ff 75 08             	push   0x8(%ebp)
+  802b5c:	e8 5e ff ff ff       	call   802abf <ipc_recv_pages>
+}
+  802b61:	c9                   	leave
+  802b62:	c3                   	ret
+
+00802b63 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802b63:	55                   	push   %ebp
+  802b64:	89 e5                	mov    %esp,%ebp
+  802b66:	57                   	push   %edi
+  802b67:	56                   	push   %esi
+  802b68:	53                   	push   %ebx
+  802b69:	83 ec 0c             	sub    $0xc,%esp
+  802b6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b6f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b72:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802b75:	89 c3                	mov    %eax,%ebx
+  802b77:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802b7d:	85 c0                	test   %eax,%eax
+  802b7f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b84:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802b87:	83 ec 0c             	sub    $0xc,%esp
+  802b8a:	ff 75 14             	push   0x14(%ebp)
+  802b8d:	ff 75 18             	push   0x18(%ebp)
+  802b90:	53                   	push   %ebx
+  802b91:	56                   	push   %esi
+  802b92:	57                   	push   %edi
+  802b93:	e8 d8 e2 ff ff       	call   800e70 <sys_ipc_try_send>
+  802b98:	83 c4 20             	add    $0x20,%esp
+  802b9b:	85 c0                	test   %eax,%eax
+  802b9d:	79 1e                	jns    802bbd <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802b9f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802ba2:	75 07                	jne    802bab <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802ba4:	e8 ae df ff ff       	call   800b57 <sys_yield>
+  802ba9:	eb dc                	jmp    802b87 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802bab:	50                   	push   %eax
+  802bac:	68 b7 33 80 00       	push   $0x8033b7
+  802bb1:	6a 5c                	push   $0x5c
+  802bb3:	68 c4 33 80 00       	push   $0x8033c4
+  802bb8:	e8 bc fe ff ff       	call   802a79 <_panic>
+  }
+}
+  802bbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bc0:	5b                   	pop    %ebx
+  802bc1:	5e                   	pop    %esi
+  802bc2:	5f                   	pop    %edi
+  802bc3:	5d                   	pop    %ebp
+  802bc4:	c3                   	ret
+
+00802bc5 <ipc_send>:
+{
+  802bc5:	55                   	push   %ebp
+  802bc6:	89 e5                	mov    %esp,%ebp
+  802bc8:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802bcb:	ff 75 14             	push   0x14(%ebp)
+  802bce:	6a 01                	push   $0x1
+  802bd0:	ff 75 10             	push   0x10(%ebp)
+  802bd3:	ff 75 0c             	push   0xc(%ebp)
+  802bd6:	ff 75 08             	push   0x8(%ebp)
+  802bd9:	e8 85 ff ff ff       	call   802b63 <ipc_send_pages>
+}
+  802bde:	83 c4 20             	add    $0x20,%esp
+  802be1:	c9                   	leave
+  802be2:	c3                   	ret
+
+00802be3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802be3:	55                   	push   %ebp
+  802be4:	89 e5                	mov    %esp,%ebp
+  802be6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802be9:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802bee:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bf1:	c1 e0 04             	shl    $0x4,%eax
+  802bf4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bf9:	8b 40 50             	mov    0x50(%eax),%eax
+  802bfc:	39 c8                	cmp    %ecx,%eax
+  802bfe:	74 12                	je     802c12 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802c00:	83 c2 01             	add    $0x1,%edx
+  802c03:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802c09:	75 e3                	jne    802bee <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802c0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c10:	eb 0e                	jmp    802c20 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802c12:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802c15:	c1 e0 04             	shl    $0x4,%eax
+  802c18:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c1d:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802c20:	5d                   	pop    %ebp
+  802c21:	c3                   	ret
+
+00802c22 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802c22:	55                   	push   %ebp
+  802c23:	89 e5                	mov    %esp,%ebp
+  802c25:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802c28:	89 c2                	mov    %eax,%edx
+  802c2a:	c1 ea 16             	shr    $0x16,%edx
+  802c2d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802c34:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802c39:	f6 c1 01             	test   $0x1,%cl
+  802c3c:	74 1c                	je     802c5a <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802c3e:	c1 e8 0c             	shr    $0xc,%eax
+  802c41:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802c48:	a8 01                	test   $0x1,%al
+  802c4a:	74 0e                	je     802c5a <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802c4c:	c1 e8 0c             	shr    $0xc,%eax
+  802c4f:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802c56:	ef 
+  802c57:	0f b7 d2             	movzwl %dx,%edx
+}
+  802c5a:	89 d0                	mov    %edx,%eax
+  802c5c:	5d                   	pop    %ebp
+  802c5d:	c3                   	ret
+
+00802c5e <udivmod>:
+  802c5e:	55                   	push   %ebp
+  802c5f:	57                   	push   %edi
+  802c60:	56                   	push   %esi
+  802c61:	53                   	push   %ebx
+  802c62:	83 ec 14             	sub    $0x14,%esp
+  802c65:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c69:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c6d:	89 fb                	mov    %edi,%ebx
+  802c6f:	09 f3                	or     %esi,%ebx
+  802c71:	0f 84 88 00 00 00    	je     802cff <udivmod+0xa1>
+  802c77:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c7c:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c83:	00 
+  802c84:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c8b:	00 
+  802c8c:	89 cd                	mov    %ecx,%ebp
+  802c8e:	89 34 24             	mov    %esi,(%esp)
+  802c91:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c95:	eb 08                	jmp    802c9f <udivmod+0x41>
+  802c97:	83 ed 01             	sub    $0x1,%ebp
+  802c9a:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802c9d:	74 6c                	je     802d0b <udivmod+0xad>
+  802c9f:	89 c3                	mov    %eax,%ebx
+  802ca1:	89 d6                	mov    %edx,%esi
+  802ca3:	89 e9                	mov    %ebp,%ecx
+  802ca5:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802ca8:	d3 ee                	shr    %cl,%esi
+  802caa:	f6 c1 20             	test   $0x20,%cl
+  802cad:	74 04                	je     802cb3 <udivmod+0x55>
+  802caf:	89 f3                	mov    %esi,%ebx
+  802cb1:	31 f6                	xor    %esi,%esi
+  802cb3:	8b 3c 24             	mov    (%esp),%edi
+  802cb6:	39 fb                	cmp    %edi,%ebx
+  802cb8:	89 f7                	mov    %esi,%edi
+  802cba:	8b 1c 24             	mov    (%esp),%ebx
+  802cbd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802cc1:	19 f7                	sbb    %esi,%edi
+  802cc3:	72 d2                	jb     802c97 <udivmod+0x39>
+  802cc5:	89 f7                	mov    %esi,%edi
+  802cc7:	89 de                	mov    %ebx,%esi
+  802cc9:	89 e9                	mov    %ebp,%ecx
+  802ccb:	0f a5 f7             	shld   %cl,%esi,%edi
+  802cce:	d3 e6                	shl    %cl,%esi
+  802cd0:	f6 c1 20             	test   $0x20,%cl
+  802cd3:	74 04                	je     802cd9 <udivmod+0x7b>
+  802cd5:	89 f7                	mov    %esi,%edi
+  802cd7:	31 f6                	xor    %esi,%esi
+  802cd9:	29 f0                	sub    %esi,%eax
+  802cdb:	19 fa                	sbb    %edi,%edx
+  802cdd:	be 01 00 00 00       	mov    $0x1,%esi
+  802ce2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ce7:	0f a5 f7             	shld   %cl,%esi,%edi
+  802cea:	d3 e6                	shl    %cl,%esi
+  802cec:	f6 c1 20             	test   $0x20,%cl
+  802cef:	74 04                	je     802cf5 <udivmod+0x97>
+  802cf1:	89 f7                	mov    %esi,%edi
+  802cf3:	31 f6                	xor    %esi,%esi
+  802cf5:	09 74 24 08          	or     %esi,0x8(%esp)
+  802cf9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802cfd:	eb 98                	jmp    802c97 <udivmod+0x39>
+  802cff:	89 f0                	mov    %esi,%eax
+  802d01:	89 fa                	mov    %edi,%edx
+  802d03:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802d07:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802d0b:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802d0f:	89 01                	mov    %eax,(%ecx)
+  802d11:	89 51 04             	mov    %edx,0x4(%ecx)
+  802d14:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d18:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d1c:	83 c4 14             	add    $0x14,%esp
+  802d1f:	5b                   	pop    %ebx
+  802d20:	5e                   	pop    %esi
+  802d21:	5f                   	pop    %edi
+  802d22:	5d                   	pop    %ebp
+  802d23:	c3                   	ret
+
+00802d24 <__udivdi3>:
+  802d24:	83 ec 18             	sub    $0x18,%esp
+  802d27:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d2b:	50                   	push   %eax
+  802d2c:	ff 74 24 2c          	push   0x2c(%esp)
+  802d30:	ff 74 24 2c          	push   0x2c(%esp)
+  802d34:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d38:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d3c:	e8 1d ff ff ff       	call   802c5e <udivmod>
+  802d41:	83 c4 24             	add    $0x24,%esp
+  802d44:	c3                   	ret
+
+00802d45 <__umoddi3>:
+  802d45:	83 ec 18             	sub    $0x18,%esp
+  802d48:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d4c:	50                   	push   %eax
+  802d4d:	ff 74 24 2c          	push   0x2c(%esp)
+  802d51:	ff 74 24 2c          	push   0x2c(%esp)
+  802d55:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d59:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d5d:	e8 fc fe ff ff       	call   802c5e <udivmod>
+  802d62:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d66:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d6a:	83 c4 24             	add    $0x24,%esp
+  802d6d:	c3                   	ret
+
+00802d6e <__divdi3>:
+  802d6e:	56                   	push   %esi
+  802d6f:	53                   	push   %ebx
+  802d70:	83 ec 14             	sub    $0x14,%esp
+  802d73:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d77:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802d7b:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802d7f:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802d83:	85 d2                	test   %edx,%edx
+  802d85:	78 18                	js     802d9f <__divdi3+0x31>
+  802d87:	85 db                	test   %ebx,%ebx
+  802d89:	78 3e                	js     802dc9 <__divdi3+0x5b>
+  802d8b:	83 ec 04             	sub    $0x4,%esp
+  802d8e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d92:	56                   	push   %esi
+  802d93:	53                   	push   %ebx
+  802d94:	51                   	push   %ecx
+  802d95:	e8 c4 fe ff ff       	call   802c5e <udivmod>
+  802d9a:	83 c4 10             	add    $0x10,%esp
+  802d9d:	eb 24                	jmp    802dc3 <__divdi3+0x55>
+  802d9f:	f7 d8                	neg    %eax
+  802da1:	83 d2 00             	adc    $0x0,%edx
+  802da4:	f7 da                	neg    %edx
+  802da6:	85 db                	test   %ebx,%ebx
+  802da8:	78 3a                	js     802de4 <__divdi3+0x76>
+  802daa:	83 ec 04             	sub    $0x4,%esp
+  802dad:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802db1:	56                   	push   %esi
+  802db2:	53                   	push   %ebx
+  802db3:	51                   	push   %ecx
+  802db4:	e8 a5 fe ff ff       	call   802c5e <udivmod>
+  802db9:	83 c4 10             	add    $0x10,%esp
+  802dbc:	f7 d8                	neg    %eax
+  802dbe:	83 d2 00             	adc    $0x0,%edx
+  802dc1:	f7 da                	neg    %edx
+  802dc3:	83 c4 14             	add    $0x14,%esp
+  802dc6:	5b                   	pop    %ebx
+  802dc7:	5e                   	pop    %esi
+  802dc8:	c3                   	ret
+  802dc9:	83 ec 04             	sub    $0x4,%esp
+  802dcc:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802dd0:	56                   	push   %esi
+  802dd1:	f7 d9                	neg    %ecx
+  802dd3:	83 d3 00             	adc    $0x0,%ebx
+  802dd6:	f7 db                	neg    %ebx
+  802dd8:	53                   	push   %ebx
+  802dd9:	51                   	push   %ecx
+  802dda:	e8 7f fe ff ff       	call   802c5e <udivmod>
+  802ddf:	83 c4 10             	add    $0x10,%esp
+  802de2:	eb d8                	jmp    802dbc <__divdi3+0x4e>
+  802de4:	83 ec 04             	sub    $0x4,%esp
+  802de7:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802deb:	56                   	push   %esi
+  802dec:	f7 d9                	neg    %ecx
+  802dee:	83 d3 00             	adc    $0x0,%ebx
+  802df1:	f7 db                	neg    %ebx
+  802df3:	53                   	push   %ebx
+  802df4:	51                   	push   %ecx
+  802df5:	e8 64 fe ff ff       	call   802c5e <udivmod>
+  802dfa:	83 c4 10             	add    $0x10,%esp
+  802dfd:	eb c4                	jmp    802dc3 <__divdi3+0x55>
+
+00802dff <__moddi3>:
+  802dff:	55                   	push   %ebp
+  802e00:	57                   	push   %edi
+  802e01:	56                   	push   %esi
+  802e02:	53                   	push   %ebx
+  802e03:	83 ec 24             	sub    $0x24,%esp
+  802e06:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802e0a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802e0e:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802e12:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802e16:	85 d2                	test   %edx,%edx
+  802e18:	78 3b                	js     802e55 <__moddi3+0x56>
+  802e1a:	83 ec 04             	sub    $0x4,%esp
+  802e1d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e21:	56                   	push   %esi
+  802e22:	89 ce                	mov    %ecx,%esi
+  802e24:	f7 de                	neg    %esi
+  802e26:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802e2a:	89 de                	mov    %ebx,%esi
+  802e2c:	83 d6 00             	adc    $0x0,%esi
+  802e2f:	f7 de                	neg    %esi
+  802e31:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802e35:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802e39:	0f 48 f1             	cmovs  %ecx,%esi
+  802e3c:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802e41:	53                   	push   %ebx
+  802e42:	56                   	push   %esi
+  802e43:	e8 16 fe ff ff       	call   802c5e <udivmod>
+  802e48:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e4c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e50:	83 c4 10             	add    $0x10,%esp
+  802e53:	eb 47                	jmp    802e9c <__moddi3+0x9d>
+  802e55:	f7 d8                	neg    %eax
+  802e57:	83 d2 00             	adc    $0x0,%edx
+  802e5a:	f7 da                	neg    %edx
+  802e5c:	83 ec 04             	sub    $0x4,%esp
+  802e5f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e63:	56                   	push   %esi
+  802e64:	89 cf                	mov    %ecx,%edi
+  802e66:	f7 df                	neg    %edi
+  802e68:	89 de                	mov    %ebx,%esi
+  802e6a:	83 d6 00             	adc    $0x0,%esi
+  802e6d:	f7 de                	neg    %esi
+  802e6f:	0f 49 cf             	cmovns %edi,%ecx
+  802e72:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e76:	0f 49 de             	cmovns %esi,%ebx
+  802e79:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802e7d:	ff 74 24 0c          	push   0xc(%esp)
+  802e81:	ff 74 24 0c          	push   0xc(%esp)
+  802e85:	e8 d4 fd ff ff       	call   802c5e <udivmod>
+  802e8a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e8e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e92:	f7 d8                	neg    %eax
+  802e94:	83 d2 00             	adc    $0x0,%edx
+  802e97:	f7 da                	neg    %edx
+  802e99:	83 c4 10             	add    $0x10,%esp
+  802e9c:	83 c4 24             	add    $0x24,%esp
+  802e9f:	5b                   	pop    %ebx
+  802ea0:	5e                   	pop    %esi
+  802ea1:	5f                   	pop    %edi
+  802ea2:	5d                   	pop    %ebp
+  802ea3:	c3                   	ret
@@ -0,0 +1,81 @@
+// Measure block allocation on a nearly full disk: fill the disk to
+// 90% with one file, then time creating and appending to small files
+// in the remaining space.
+//
+// usage: allocbench [NFILES]
+
+#include <inc/lib.h>
+
+#define FILLNAME        "/allocbench.fill"
+#define FILEBLOCKS      2
+
+static char buf[BLKSIZE];
+
+// Write blocks to the filler file until the disk fills up, then cut the file
+// back to 'pct' percent of the space it got.  Returns the file's size.
+static off_t
+fill(int pct)
+{
+  off_t size;
+  int fd, r;
+
+  if ((fd = open(FILLNAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+    panic("open %s: %e", FILLNAME, fd);
+  for (size = 0; (r = write(fd, buf, BLKSIZE)) == BLKSIZE; size += BLKSIZE)
+    ;
+  if (r < 0 && r != -E_NO_DISK && r != -E_FILE_EXISTS && r != -E_INVAL)
+    panic("write %s: %e", FILLNAME, r);
+  size = ROUNDDOWN(size / 100 * pct, BLKSIZE);
+  if ((r = ftruncate(fd, size)) < 0)
+    panic("ftruncate %s: %e", FILLNAME, r);
+  close(fd);
+  return size;
+}
+
+// Create or reset 'path', optionally appending FILEBLOCKS blocks to it.
+static void
+mkfile(const char *path, bool append)
+{
+  int fd, i, r;
+
+  if ((fd = open(path, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+    panic("open %s: %e", path, fd);
+  for (i = 0; append && i < FILEBLOCKS; i++)
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+      panic("write %s: %e", path, r);
+  close(fd);
+}
+
+void
+umain(int argc, char **argv)
+{
+  char path[MAXNAMELEN];
+  unsigned start, ms;
+  off_t filled;
+  int i, n;
+
+  binaryname = "allocbench";
+  n = 16;
+  if (argc > 1)
+    n = strtol(argv[1], 0, 0);
+
+  filled = fill(90);
+
+  start = sys_time_msec();
+  for (i = 0; i < n; i++) {
+    snprintf(path, sizeof(path), "/allocbench.%d", i);
+    mkfile(path, 1);
+  }
+  ms = sys_time_msec() - start;
+
+  cprintf("allocbench: %d KB filler, %d files x %d blocks in %d ms "
+          "= %d us/block\n", filled / 1024, n, FILEBLOCKS, ms,
+          ms * 1000 / (n * FILEBLOCKS));
+
+  // There is no remove, so give the space back by truncating.
+  for (i = 0; i < n; i++) {
+    snprintf(path, sizeof(path), "/allocbench.%d", i);
+    mkfile(path, 0);
+  }
+  mkfile(FILLNAME, 0);
+}
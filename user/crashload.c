@@ -0,0 +1,85 @@
+// Keep the file server changing metadata until the machine dies:
+// create files, grow them past the direct blocks, shrink them and
+// rewrite them, with a sync now and then.  crash-test kills QEMU while
+// this runs and checks the disk with fs/fsck.c.
+//
+// usage: crashload [SEED]
+
+#include <inc/lib.h>
+
+#define NFILES          8
+#define MAXBLOCKS       24
+
+static char buf[BLKSIZE];
+static uint32_t seed;
+
+static uint32_t
+rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+// Append 'n' blocks to the open file 'fd'.
+static void
+append(int fd, int n)
+{
+  struct Stat st;
+  int r;
+
+  if ((r = fstat(fd, &st)) < 0)
+    panic("fstat: %e", r);
+  if ((r = seek(fd, st.st_size)) < 0)
+    panic("seek: %e", r);
+  for (; n > 0; n--)
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+      panic("write: %e", r);
+}
+
+void
+umain(int argc, char **argv)
+{
+  char name[MAXNAMELEN];
+  struct Stat st;
+  int fd, round, r;
+
+  binaryname = "crashload";
+  seed = argc > 1 ? strtol(argv[1], 0, 0) : sys_time_msec();
+  cprintf("crashload: running, seed %d\n", seed);
+
+  for (round = 0; ; round++) {
+    snprintf(name, sizeof(name), "/crash%d", rand() % NFILES);
+    memset(buf, round, sizeof(buf));
+
+    switch (rand() % 4) {
+    case 0:   // rewrite
+      if ((fd = open(name, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+        panic("open %s: %e", name, fd);
+      append(fd, rand() % MAXBLOCKS);
+      break;
+    case 1:   // grow
+      if ((fd = open(name, O_RDWR | O_CREAT)) < 0)
+        panic("open %s: %e", name, fd);
+      if ((r = fstat(fd, &st)) < 0)
+        panic("fstat %s: %e", name, r);
+      append(fd, rand() % (MAXBLOCKS - st.st_size / BLKSIZE + 1));
+      break;
+    case 2:   // shrink
+      if ((fd = open(name, O_RDWR | O_CREAT)) < 0)
+        panic("open %s: %e", name, fd);
+      if ((r = fstat(fd, &st)) < 0)
+        panic("fstat %s: %e", name, r);
+      if ((r = ftruncate(fd, rand() % (st.st_size + 1))) < 0)
+        panic("ftruncate %s: %e", name, r);
+      break;
+    default:
+      if ((r = sync()) < 0)
+        panic("sync: %e", r);
+      continue;
+    }
+    close(fd);
+
+    if (round % 100 == 0)
+      cprintf("crashload: round %d\n", round);
+  }
+}
@@ -0,0 +1,83 @@
+// Measure open latency as a directory grows: fill the root directory
+// with empty files, and at each checkpoint time opens of random files
+// that exist and of names that don't.  With the hashed directory
+// index the cost stays flat; a plain directory is scanned in full on
+// every miss.
+//
+// usage: dirbench [NFILES]
+
+#include <inc/lib.h>
+
+#define NOPEN           200
+
+static uint32_t seed;
+
+static uint32_t
+rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+static void
+name(char *buf, const char *prefix, int i)
+{
+  snprintf(buf, MAXNAMELEN, "/%s%05d", prefix, i);
+}
+
+// Time NOPEN opens among the first n files, then NOPEN misses.
+static void
+measure(int n)
+{
+  char path[MAXNAMELEN];
+  unsigned hit, miss;
+  int i, fd;
+
+  hit = sys_time_msec();
+  for (i = 0; i < NOPEN; i++) {
+    name(path, "dirbench", rand() % n);
+    if ((fd = open(path, O_RDONLY)) < 0)
+      panic("open %s: %e", path, fd);
+    close(fd);
+  }
+  hit = sys_time_msec() - hit;
+
+  miss = sys_time_msec();
+  for (i = 0; i < NOPEN; i++) {
+    name(path, "missing", rand() % n);
+    if ((fd = open(path, O_RDONLY)) != -E_NOT_FOUND)
+      panic("open %s: %e", path, fd);
+  }
+  miss = sys_time_msec() - miss;
+
+  cprintf("dirbench: %5d entries  open %5d us  miss %5d us\n", n,
+          hit * 1000 / NOPEN, miss * 1000 / NOPEN);
+}
+
+void
+umain(int argc, char **argv)
+{
+  char path[MAXNAMELEN];
+  unsigned ms;
+  int n, i, next, fd;
+
+  binaryname = "dirbench";
+  n = 5000;
+  if (argc > 1)
+    n = strtol(argv[1], 0, 0);
+  seed = 1;
+
+  ms = sys_time_msec();
+  next = 100;
+  for (i = 0; i < n; i++) {
+    name(path, "dirbench", i);
+    if ((fd = open(path, O_RDWR | O_CREAT)) < 0)
+      panic("create %s: %e", path, fd);
+    close(fd);
+    if (i + 1 == next || i + 1 == n) {
+      measure(i + 1);
+      next *= 4;
+    }
+  }
+  cprintf("dirbench: %d files, %d ms in all\n", n, sys_time_msec() - ms);
+}
@@ -0,0 +1,67 @@
+// Measure raw disk throughput through the file server: write a file and
+// sync it, then read it back from a cold block cache.  Run it once with
+// the IDE disk (make run-diskbench) and once with virtio-blk
+// (make VIRTIO=1 run-diskbench); the file server says which it uses.
+//
+// usage: diskbench [SIZE_KB]
+
+#include <inc/lib.h>
+
+#define NAME            "/diskbench.data"
+
+static char buf[BLKSIZE];
+
+static void
+report(const char *what, off_t size, unsigned ms)
+{
+  cprintf("diskbench: %-5s %6d KB in %5d ms = %6d KB/s\n",
+          what, size / 1024, ms, size / 1024 * 1000 / MAX(ms, 1));
+}
+
+void
+umain(int argc, char **argv)
+{
+  unsigned start;
+  off_t size, off;
+  int fd, r;
+
+  binaryname = "diskbench";
+  size = 1024 * 1024;
+  if (argc > 1)
+    size = ROUNDUP(strtol(argv[1], 0, 0) * 1024, BLKSIZE);
+  memset(buf, 'd', sizeof(buf));
+
+  // Allocate the blocks first, so the timed write only moves data.
+  if ((fd = open(NAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+    panic("open %s: %e", NAME, fd);
+  for (off = 0; off < size; off += BLKSIZE)
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+      panic("write %s: %e", NAME, r);
+  if ((r = sync()) < 0)
+    panic("sync: %e", r);
+
+  start = sys_time_msec();
+  if ((r = seek(fd, 0)) < 0)
+    panic("seek %s: %e", NAME, r);
+  for (off = 0; off < size; off += BLKSIZE)
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+      panic("write %s: %e", NAME, r);
+  if ((r = sync()) < 0)
+    panic("sync: %e", r);
+  report("write", size, sys_time_msec() - start);
+
+  if ((r = fs_dropcache()) < 0)
+    panic("fs_dropcache: %e", r);
+  start = sys_time_msec();
+  if ((r = seek(fd, 0)) < 0)
+    panic("seek %s: %e", NAME, r);
+  for (off = 0; off < size; off += BLKSIZE)
+    if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+      panic("read %s: %e", NAME, r);
+  report("read", size, sys_time_msec() - start);
+  close(fd);
+
+  // Give the space back (there is no remove).
+  if ((fd = open(NAME, O_RDWR | O_TRUNC)) >= 0)
+    close(fd);
+}
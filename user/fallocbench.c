@@ -0,0 +1,62 @@
+// Measure streaming appends with and without fallocate.  Write a file
+// a block at a time to SIZE_KB, then sync; once growing it as it goes,
+// once after reserving all of it up front.  Reports KB/s for each;
+// run fs/fsfrag -v on the image to see how the file lies on the disk.
+//
+// usage: fallocbench [SIZE_KB]
+
+#include <inc/lib.h>
+
+#define NAME            "/fallocbench"
+
+static char buf[BLKSIZE];
+
+// Write NAME of 'size' bytes, reserving its blocks first if 'reserve';
+// returns KB/s.
+static unsigned
+stream(off_t size, bool reserve)
+{
+  unsigned start, ms;
+  off_t off;
+  int fd, r;
+
+  if ((fd = open(NAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+    panic("open %s: %e", NAME, fd);
+  if ((r = sync()) < 0)
+    panic("sync: %e", r);
+
+  start = sys_time_msec();
+  if (reserve && (r = fallocate(fd, 0, size)) < 0)
+    panic("fallocate %s: %e", NAME, r);
+  for (off = 0; off < size; off += BLKSIZE)
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+      panic("write %s: %e", NAME, r);
+  close(fd);
+  if ((r = sync()) < 0)
+    panic("sync: %e", r);
+  ms = sys_time_msec() - start;
+  return size / 1024 * 1000 / MAX(ms, 1);
+}
+
+void
+umain(int argc, char **argv)
+{
+  off_t size;
+  int fd;
+
+  binaryname = "fallocbench";
+  size = 2 * 1024 * 1024;
+  if (argc > 1)
+    size = strtol(argv[1], 0, 0) * 1024;
+  size = ROUNDUP(size, BLKSIZE);
+  memset(buf, 'a', sizeof(buf));
+
+  cprintf("fallocbench: %d KB appended:                 %5d KB/s\n",
+          size / 1024, stream(size, 0));
+  cprintf("fallocbench: %d KB appended after fallocate: %5d KB/s\n",
+          size / 1024, stream(size, 1));
+
+  // Give the space back (there is no remove).
+  if ((fd = open(NAME, O_RDWR | O_TRUNC)) >= 0)
+    close(fd);
+}
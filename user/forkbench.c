@@ -0,0 +1,185 @@
+// Measure fork latency against address-space size, comparing kfork()
+// (sys_fork, page tables shared lazily), fork() (one sys_page_map_range
+// call) and a fork that maps one page per system call the way
+// lib/fork.c used to.  Then time a binary tree of forks like
+// user/forktree with each of them.  First check that a child of
+// kfork can dup a file descriptor before writing near it.
+//
+// usage: forkbench [NFORKS]
+
+#include <inc/lib.h>
+
+#define HEAPVA          0x20000000
+
+#define TREEDEPTH       3
+#define DUPFD           20
+
+static const int heap_pages[] = { 0, 64, 256, 1024, 2048, 4096 };
+
+// The old duppage loop: up to two sys_page_map calls per page.
+static envid_t
+pagefork(void)
+{
+  envid_t envid;
+  uint32_t pn;
+  void *addr;
+  pte_t pte;
+  int r;
+
+  if ((envid = sys_exofork()) < 0)
+    panic("sys_exofork: %e", envid);
+  if (envid == 0) {
+    thisenv = &envs[ENVX(sys_getenvid())];
+    return 0;
+  }
+
+  for (pn = 0; pn < PGNUM(UXSTACKTOP - PGSIZE); pn++) {
+    if (!(uvpd[pn >> (PDXSHIFT - PTXSHIFT)] & PTE_P)) {
+      pn += NPTENTRIES - 1;
+      continue;
+    }
+    pte = uvpt[pn];
+    if ((pte & (PTE_P | PTE_U)) != (PTE_P | PTE_U))
+      continue;
+
+    addr = (void *) (pn << PGSHIFT);
+    if (!(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE)) {
+      if ((r = sys_page_map(0, addr, envid, addr, pte & PTE_SYSCALL)) < 0)
+        panic("sys_page_map: %e", r);
+      continue;
+    }
+    if ((r = sys_page_map(0, addr, envid, addr, PTE_COW | PTE_U | PTE_P)) < 0)
+      panic("sys_page_map: %e", r);
+    if ((r = sys_page_map(0, addr, 0, addr, PTE_COW | PTE_U | PTE_P)) < 0)
+      panic("sys_page_map: %e", r);
+  }
+
+  if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+                          PTE_P | PTE_U | PTE_W)) < 0)
+    panic("sys_page_alloc: %e", r);
+  if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+    panic("sys_env_set_pgfault_upcall: %e", r);
+  if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+    panic("sys_env_set_status: %e", r);
+  return envid;
+}
+
+// sys_fork leaves the page table holding the Fd pages shared and
+// read-only; dup in the child must still map the pipe's PTE_SHARE pages
+// writable.
+static void
+checkdup(void)
+{
+  envid_t child;
+  int p[2], r;
+  char c;
+
+  if ((r = pipe(p)) < 0)
+    panic("pipe: %e", r);
+  if ((child = kfork()) < 0)
+    panic("kfork: %e", child);
+  if (child == 0) {
+    if ((r = dup(p[1], DUPFD)) < 0)
+      panic("dup after kfork: %e", r);
+    if ((r = write(DUPFD, "d", 1)) != 1)
+      panic("write: %e", r);
+    exit();
+  }
+  close(p[1]);
+  if ((r = readn(p[0], &c, 1)) != 1 || c != 'd')
+    panic("read from dup: %e", r);
+  close(p[0]);
+  wait(child);
+  cprintf("forkbench: dup after kfork is good\n");
+}
+
+// Fork and reap 'n' children that exit at once; return the elapsed ms.
+static unsigned
+run(envid_t (*forkfn)(void), int n)
+{
+  unsigned start;
+  envid_t child;
+  int i;
+
+  start = sys_time_msec();
+  for (i = 0; i < n; i++) {
+    if ((child = forkfn()) < 0)
+      panic("fork: %e", child);
+    if (child == 0)
+      exit();
+    wait(child);
+  }
+  return sys_time_msec() - start;
+}
+
+// Each node forks two children and waits for them, as in forktree.
+static void
+tree(envid_t (*forkfn)(void), int depth)
+{
+  envid_t child[2];
+  int i;
+
+  if (depth == TREEDEPTH)
+    return;
+  for (i = 0; i < 2; i++) {
+    if ((child[i] = forkfn()) < 0)
+      panic("fork: %e", child[i]);
+    if (child[i] == 0) {
+      tree(forkfn, depth + 1);
+      exit();
+    }
+  }
+  for (i = 0; i < 2; i++)
+    wait(child[i]);
+}
+
+static unsigned
+runtree(envid_t (*forkfn)(void), int n)
+{
+  unsigned start;
+  int i;
+
+  start = sys_time_msec();
+  for (i = 0; i < n; i++)
+    tree(forkfn, 0);
+  return sys_time_msec() - start;
+}
+
+void
+umain(int argc, char **argv)
+{
+  int i, n, mapped, r;
+  unsigned kernel_ms, range_ms, page_ms;
+
+  binaryname = "forkbench";
+  n = 20;
+  if (argc > 1)
+    n = strtol(argv[1], 0, 0);
+
+  // Installs the COW fault handler pagefork's children rely on.
+  run(fork, 1);
+  checkdup();
+
+  mapped = 0;
+  for (i = 0; i < sizeof(heap_pages) / sizeof(heap_pages[0]); i++) {
+    for (; mapped < heap_pages[i]; mapped++) {
+      if ((r = sys_page_alloc(0, (void *) (HEAPVA + mapped * PGSIZE),
+                              PTE_P | PTE_U | PTE_W)) < 0)
+        panic("sys_page_alloc: %e", r);
+    }
+
+    kernel_ms = run(kfork, n);
+    range_ms = run(fork, n);
+    page_ms = run(pagefork, n);
+    cprintf("forkbench: %5d KB heap  sys_fork %6d  range %6d  "
+            "per-page %6d us/fork\n", mapped * PGSIZE / 1024,
+            kernel_ms * 1000 / n, range_ms * 1000 / n, page_ms * 1000 / n);
+  }
+
+  kernel_ms = runtree(kfork, n);
+  range_ms = runtree(fork, n);
+  page_ms = runtree(pagefork, n);
+  cprintf("forkbench: forktree x%d, %5d KB heap  sys_fork %6d  range %6d  "
+          "per-page %6d ms\n", n, mapped * PGSIZE / 1024,
+          kernel_ms, range_ms, page_ms);
+}
@@ -0,0 +1,83 @@
+// Measure sequential reads of files that were written side by side.
+// Write NFILES files a block each in turn, as clients appending at the
+// same time would, then read each back in order from a cold block
+// cache; then do the same with files written one after another.  With
+// windows for appends (fs/fs.c), the two layouts read about as fast.
+// The files are left for fs/fsfrag to look at.
+//
+// usage: fragbench [SIZE_KB]
+
+#include <inc/lib.h>
+
+#define NFILES          4
+
+static char buf[BLKSIZE];
+
+// Write NFILES files named 'prefix'N of 'size' bytes, a block of each
+// in turn if 'interleave', else one file after another.
+static void
+writefiles(const char *prefix, off_t size, bool interleave)
+{
+  char path[MAXNAMELEN];
+  int fds[NFILES], n, i, r;
+
+  for (i = 0; i < NFILES; i++) {
+    snprintf(path, sizeof(path), "%s%d", prefix, i);
+    if ((fds[i] = open(path, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+      panic("open %s: %e", path, fds[i]);
+  }
+  for (n = 0; n < NFILES * size / BLKSIZE; n++) {
+    i = interleave ? n % NFILES : n / (size / BLKSIZE);
+    if ((r = write(fds[i], buf, BLKSIZE)) != BLKSIZE)
+      panic("write %s%d: %e", prefix, i, r);
+  }
+  for (i = 0; i < NFILES; i++)
+    close(fds[i]);
+  if ((r = sync()) < 0)
+    panic("sync: %e", r);
+}
+
+// Read the files back one after another; returns KB/s.
+static unsigned
+readfiles(const char *prefix, off_t size)
+{
+  char path[MAXNAMELEN];
+  unsigned start, ms;
+  int fd, i, r;
+  off_t off;
+
+  if ((r = fs_dropcache()) < 0)
+    panic("fs_dropcache: %e", r);
+  start = sys_time_msec();
+  for (i = 0; i < NFILES; i++) {
+    snprintf(path, sizeof(path), "%s%d", prefix, i);
+    if ((fd = open(path, O_RDONLY)) < 0)
+      panic("open %s: %e", path, fd);
+    for (off = 0; off < size; off += BLKSIZE)
+      if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+        panic("read %s: %e", path, r);
+    close(fd);
+  }
+  ms = sys_time_msec() - start;
+  return size / 1024 * NFILES * 1000 / MAX(ms, 1);
+}
+
+void
+umain(int argc, char **argv)
+{
+  off_t size;
+
+  binaryname = "fragbench";
+  size = 256 * 1024;
+  if (argc > 1)
+    size = strtol(argv[1], 0, 0) * 1024;
+  size = ROUNDUP(size, BLKSIZE);
+  memset(buf, 'f', sizeof(buf));
+
+  writefiles("/fragbench.i", size, 1);
+  writefiles("/fragbench.s", size, 0);
+  cprintf("fragbench: %d files of %d KB, written side by side:  %5d KB/s\n",
+          NFILES, size / 1024, readfiles("/fragbench.i", size));
+  cprintf("fragbench: %d files of %d KB, written one by one:    %5d KB/s\n",
+          NFILES, size / 1024, readfiles("/fragbench.s", size));
+}
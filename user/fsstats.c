@@ -0,0 +1,41 @@
+// Print the file server's block cache, disk queue and path cache
+// statistics.
+//
+// usage: fsstats [CAPACITY]
+// With an argument, first set the cache's capacity to CAPACITY blocks.
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  struct Fsret_stats st;
+  uint32_t capacity, lookups;
+  int r;
+
+  binaryname = "fsstats";
+  capacity = 0;
+  if (argc > 1)
+    capacity = strtol(argv[1], 0, 0);
+
+  if ((r = fs_stats(capacity, &st)) < 0)
+    panic("fs_stats: %e", r);
+
+  lookups = st.ret_bc_hits + st.ret_bc_misses;
+  printf("block cache: %d/%d blocks, %d hits, %d misses (%d%% hits), "
+         "%d evictions, %d read ahead\n", st.ret_bc_resident,
+         st.ret_bc_capacity, st.ret_bc_hits, st.ret_bc_misses,
+         lookups ? st.ret_bc_hits * 100 / lookups : 0, st.ret_bc_evictions,
+         st.ret_bc_readahead);
+  printf("writes: %d blocks in %d disk writes\n", st.ret_bc_written,
+         st.ret_bc_writes);
+  printf("disk queue: %s, %d requests, %d merged, %d reads, "
+         "%d blocks of seeking\n",
+         st.ret_bio_sched == BIO_SCHED_FIFO ? "fifo" : "c-look",
+         st.ret_bio_reqs, st.ret_bio_merged, st.ret_bio_reads,
+         st.ret_bio_seek);
+  lookups = st.ret_dc_hits + st.ret_dc_misses;
+  printf("path cache: %d hits (%d negative), %d misses (%d%% hits)\n",
+         st.ret_dc_hits, st.ret_dc_negative, st.ret_dc_misses,
+         lookups ? st.ret_dc_hits * 100 / lookups : 0);
+}
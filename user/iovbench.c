@@ -0,0 +1,79 @@
+// Measure write and read throughput for 4 KB, 64 KB and 1 MB transfers.
+// Anything over a request page goes in one FSREQ_WRITEV or FSREQ_READV,
+// so a 1 MB transfer takes 4 requests (FSV_MAXPAGES pages each) where
+// it once took 256.  Reads are from a warm block cache.
+//
+// usage: iovbench [SIZE_KB]
+
+#include <inc/lib.h>
+
+#define BIGNAME         "/iovbench.big"
+#define NPASS           4
+
+static char buf[1024 * 1024] __attribute__((aligned(PGSIZE)));
+
+static const size_t xfers[] = { 4 * 1024, 64 * 1024, 1024 * 1024 };
+
+// Write or read 'size' bytes of BIGNAME NPASS times, 'xfer' bytes per
+// call.  Returns the elapsed ms.
+static unsigned
+pass(bool wr, off_t size, size_t xfer)
+{
+  unsigned ms;
+  off_t off;
+  int fd, n, p, i;
+
+  ms = sys_time_msec();
+  for (p = 0; p < NPASS; p++) {
+    if ((fd = open(BIGNAME, wr ? O_RDWR | O_CREAT : O_RDONLY)) < 0)
+      panic("open %s: %e", BIGNAME, fd);
+    for (off = 0; off < size; off += n) {
+      if (wr) {
+        for (i = 0; i < xfer; i += PGSIZE)
+          *(int*) (buf + i) = (off + i) / PGSIZE;
+        n = write(fd, buf, MIN(xfer, size - off));
+      } else {
+        n = readn(fd, buf, MIN(xfer, size - off));
+        for (i = 0; i < n; i += PGSIZE)
+          if (*(int*) (buf + i) != (off + i) / PGSIZE)
+            panic("%s: page %d holds %d", BIGNAME, (off + i) / PGSIZE,
+                  *(int*) (buf + i));
+      }
+      if (n <= 0)
+        panic("%s %s: %e", wr ? "write" : "read", BIGNAME, n);
+    }
+    close(fd);
+  }
+  return sys_time_msec() - ms;
+}
+
+void
+umain(int argc, char **argv)
+{
+  unsigned wms, rms;
+  off_t size;
+  int fd, i;
+
+  binaryname = "iovbench";
+  size = 1024 * 1024;
+  if (argc > 1)
+    size = strtol(argv[1], 0, 0) * 1024;
+  size = ROUNDUP(size, sizeof(buf));
+
+  // Allocate the file's blocks and warm the cache.
+  pass(1, size, sizeof(buf));
+  pass(0, size, sizeof(buf));
+
+  cprintf("iovbench: %d KB file, %d passes\n", size / 1024, NPASS);
+  for (i = 0; i < sizeof(xfers) / sizeof(xfers[0]); i++) {
+    wms = pass(1, size, xfers[i]);
+    rms = pass(0, size, xfers[i]);
+    cprintf("iovbench: %4d KB transfers  write %5d KB/s  read %5d KB/s\n",
+            xfers[i] / 1024, size / 1024 * NPASS * 1000 / MAX(wms, 1),
+            size / 1024 * NPASS * 1000 / MAX(rms, 1));
+  }
+
+  // Give the space back (there is no remove).
+  if ((fd = open(BIGNAME, O_RDWR | O_TRUNC)) >= 0)
+    close(fd);
+}
@@ -0,0 +1,74 @@
+// Measure what the file server's path lookup cache saves: time opens
+// of /ls, of a name that doesn't exist, and spawns of /ls, first
+// with the cache off and then with it on, and report the cache's hit
+// rate for each run.
+//
+// usage: lookupbench [NSPAWN]
+
+#include <inc/lib.h>
+
+#define NOPEN           500
+
+static void
+run(const char *label, int nspawn)
+{
+  struct Fsret_stats before, after;
+  unsigned hit, miss, sp;
+  uint32_t hits, misses;
+  int i, fd, r;
+
+  if ((r = fs_stats(0, &before)) < 0)
+    panic("fs_stats: %e", r);
+
+  hit = sys_time_msec();
+  for (i = 0; i < NOPEN; i++) {
+    if ((fd = open("/ls", O_RDONLY)) < 0)
+      panic("open /ls: %e", fd);
+    close(fd);
+  }
+  hit = sys_time_msec() - hit;
+
+  miss = sys_time_msec();
+  for (i = 0; i < NOPEN; i++)
+    if ((fd = open("/lookupbench.missing", O_RDONLY)) != -E_NOT_FOUND)
+      panic("open /lookupbench.missing: %e", fd);
+  miss = sys_time_msec() - miss;
+
+  sp = sys_time_msec();
+  for (i = 0; i < nspawn; i++) {
+    if ((r = spawnl("/ls", "ls", "-d", "/", (char*) 0)) < 0)
+      panic("spawn /ls: %e", r);
+    wait(r);
+  }
+  sp = sys_time_msec() - sp;
+
+  if ((r = fs_stats(0, &after)) < 0)
+    panic("fs_stats: %e", r);
+  hits = after.ret_dc_hits - before.ret_dc_hits;
+  misses = after.ret_dc_misses - before.ret_dc_misses;
+
+  cprintf("lookupbench: cache %s  open %4d us  miss %4d us  "
+          "spawn /ls %6d us  %d%% hits (%d negative)\n", label,
+          hit * 1000 / NOPEN, miss * 1000 / NOPEN,
+          nspawn ? sp * 1000 / nspawn : 0,
+          hits + misses ? hits * 100 / (hits + misses) : 0,
+          after.ret_dc_negative - before.ret_dc_negative);
+}
+
+void
+umain(int argc, char **argv)
+{
+  int nspawn, r;
+
+  binaryname = "lookupbench";
+  nspawn = 20;
+  if (argc > 1)
+    nspawn = strtol(argv[1], 0, 0);
+
+  if ((r = fs_set_dcache(DCACHE_OFF)) < 0)
+    panic("fs_set_dcache: %e", r);
+  run("off", nspawn);
+  if ((r = fs_set_dcache(DCACHE_ON)) < 0)
+    panic("fs_set_dcache: %e", r);
+  run("on ", nspawn);
+}
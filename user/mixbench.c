@@ -0,0 +1,142 @@
+// Measure how long cache hits wait behind cache misses.  Hot clients
+// read a small file the block cache holds, page by page; cold clients
+// read a file twice the size of the (shrunk) cache, so every read goes
+// to the disk.  Report the hot clients' mean read latency
+// alone and with the cold clients running.  With FS_NWORKERS 1 each hit
+// queues behind the misses in front of it; with more workers it is
+// served while they wait for the disk.  Best run with CPUS=4.
+//
+// usage: mixbench [NHOT [NCOLD]]
+
+#include <inc/lib.h>
+
+#define HOTNAME         "/mixbench.hot"
+#define COLDNAME        "/mixbench.cold"
+#define HOTSIZE         (16 * PGSIZE)
+#define COLDSIZE        (2 * 1024 * 1024)
+#define SMALLCACHE      256             // blocks, 1 MB: half of COLDSIZE
+#define NREAD           2000            // reads per hot client
+#define MAXCLIENT       16
+
+// Shared with the children: set when the hot clients are done.
+#define STOPVA          0x30000000
+static volatile uint32_t *stop = (volatile uint32_t *) STOPVA;
+
+static char buf[PGSIZE] __attribute__((aligned(PGSIZE)));
+
+static void
+mkfile(const char *path, off_t size)
+{
+  off_t off;
+  int fd, r;
+
+  if ((fd = open(path, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+    panic("open %s: %e", path, fd);
+  for (off = 0; off < size; off += PGSIZE) {
+    *(int*) buf = off / PGSIZE;
+    if ((r = write(fd, buf, PGSIZE)) != PGSIZE)
+      panic("write %s: %e", path, r);
+  }
+  close(fd);
+}
+
+// Read 'path' a page at a time, from the start again at its end, 'n'
+// times or until *stop if n is 0.  Returns the mean us per read.
+static unsigned
+reader(const char *path, int n)
+{
+  unsigned ms;
+  int fd, i, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+    panic("open %s: %e", path, fd);
+  ms = sys_time_msec();
+  for (i = 0; n ? i < n : !*stop; i++) {
+    if ((r = readn(fd, buf, PGSIZE)) == 0) {
+      seek(fd, 0);
+      r = readn(fd, buf, PGSIZE);
+    }
+    if (r != PGSIZE)
+      panic("read %s: %e", path, r);
+  }
+  ms = sys_time_msec() - ms;
+  close(fd);
+  return ms * 1000 / MAX(i, 1);
+}
+
+// Run 'nhot' hot and 'ncold' cold clients; returns the hot clients'
+// mean us per read.
+static unsigned
+run(int nhot, int ncold)
+{
+  envid_t kids[MAXCLIENT];
+  unsigned us;
+  int i;
+
+  *stop = 0;
+  for (i = 0; i < nhot + ncold; i++) {
+    if ((kids[i] = fork()) < 0)
+      panic("fork: %e", kids[i]);
+    if (kids[i] == 0) {
+      us = i < nhot ? reader(HOTNAME, NREAD) : reader(COLDNAME, 0);
+      if (i < nhot)
+        ipc_send(thisenv->env_parent_id, us, 0, 0);
+      exit();
+    }
+  }
+
+  us = 0;
+  for (i = 0; i < nhot; i++)
+    us += ipc_recv(NULL, 0, NULL);
+  *stop = 1;
+  for (i = 0; i < nhot + ncold; i++)
+    wait(kids[i]);
+  return us / MAX(nhot, 1);
+}
+
+void
+umain(int argc, char **argv)
+{
+  struct Fsret_stats st;
+  uint32_t capacity;
+  unsigned alone, mixed;
+  int nhot, ncold, fd, r;
+
+  binaryname = "mixbench";
+  nhot = ncold = 4;
+  if (argc > 1)
+    nhot = strtol(argv[1], 0, 0);
+  if (argc > 2)
+    ncold = strtol(argv[2], 0, 0);
+  if (nhot < 1 || ncold < 0 || nhot + ncold > MAXCLIENT)
+    panic("usage: mixbench [NHOT [NCOLD]], at most %d in all", MAXCLIENT);
+
+  if ((r = sys_page_alloc(0, (void *) stop, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+    panic("sys_page_alloc: %e", r);
+  mkfile(HOTNAME, HOTSIZE);
+  mkfile(COLDNAME, COLDSIZE);
+  sync();
+
+  // Shrink the cache so the cold file can't stay in it.
+  if ((r = fs_stats(0, &st)) < 0)
+    panic("fs_stats: %e", r);
+  capacity = st.ret_bc_capacity;
+  if ((r = fs_stats(SMALLCACHE, &st)) < 0)
+    panic("fs_stats: %e", r);
+
+  reader(HOTNAME, HOTSIZE / PGSIZE);
+  alone = run(nhot, 0);
+  mixed = run(nhot, ncold);
+  cprintf("mixbench: %d hot clients alone        %5d us/read\n", nhot, alone);
+  cprintf("mixbench: %d hot with %d cold clients  %5d us/read\n", nhot, ncold,
+          mixed);
+
+  if ((r = fs_stats(capacity, &st)) < 0)
+    panic("fs_stats: %e", r);
+
+  // Give the space back (there is no remove).
+  if ((fd = open(HOTNAME, O_RDWR | O_TRUNC)) >= 0)
+    close(fd);
+  if ((fd = open(COLDNAME, O_RDWR | O_TRUNC)) >= 0)
+    close(fd);
+}
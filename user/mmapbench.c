@@ -0,0 +1,141 @@
+// Compare random access to a file through mmap with seek and read:
+// fetch 64-byte records at random offsets, twice over the same
+// offsets.  The first pass through the mapping faults pages in; the
+// second finds them mapped and makes no IPC at all.  Then check that
+// MAP_SHARED writes reach the file on msync and MAP_PRIVATE ones don't.
+//
+// usage: mmapbench [SIZE_KB]
+
+#include <inc/lib.h>
+
+#define BIGNAME         "/mmapbench.big"
+#define NACCESS         2000
+#define RECSIZE         64
+
+static char buf[PGSIZE];
+static off_t offsets[NACCESS];
+
+// The word at 'off' in the file is off / 4.
+static void
+mkfile(off_t size)
+{
+  off_t off;
+  int fd, r, i;
+
+  if ((fd = open(BIGNAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+    panic("open %s: %e", BIGNAME, fd);
+  for (off = 0; off < size; off += PGSIZE) {
+    for (i = 0; i < PGSIZE / 4; i++)
+      ((uint32_t*) buf)[i] = off / 4 + i;
+    if ((r = write(fd, buf, PGSIZE)) != PGSIZE)
+      panic("write %s: %e", BIGNAME, r);
+  }
+  close(fd);
+}
+
+static unsigned
+byread(int fd)
+{
+  unsigned us;
+  int i, r;
+
+  us = sys_time_msec();
+  for (i = 0; i < NACCESS; i++) {
+    if ((r = seek(fd, offsets[i])) < 0 ||
+        (r = readn(fd, buf, RECSIZE)) != RECSIZE)
+      panic("read %s: %e", BIGNAME, r);
+    if (*(uint32_t*) buf != offsets[i] / 4)
+      panic("read %s: bad data at %d", BIGNAME, offsets[i]);
+  }
+  return (sys_time_msec() - us) * 1000 / NACCESS;
+}
+
+static unsigned
+bymap(char *map)
+{
+  unsigned us;
+  int i;
+
+  us = sys_time_msec();
+  for (i = 0; i < NACCESS; i++) {
+    memmove(buf, map + offsets[i], RECSIZE);
+    if (*(uint32_t*) buf != offsets[i] / 4)
+      panic("mmap %s: bad data at %d", BIGNAME, offsets[i]);
+  }
+  return (sys_time_msec() - us) * 1000 / NACCESS;
+}
+
+// A MAP_SHARED write reaches the file on msync; a MAP_PRIVATE one
+// doesn't.
+static void
+checkwrite(int fd)
+{
+  uint32_t *shared, *private, word;
+  int r;
+
+  if ((r = mmap(fd, 0, PGSIZE, MAP_SHARED, (void **) &shared)) < 0 ||
+      (r = mmap(fd, PGSIZE, PGSIZE, MAP_PRIVATE, (void **) &private)) < 0)
+    panic("mmap %s: %e", BIGNAME, r);
+  shared[1] = 0xdeadbeef;
+  private[1] = 0xfeedface;
+  if ((r = munmap(shared)) < 0 || (r = munmap(private)) < 0)
+    panic("munmap %s: %e", BIGNAME, r);
+
+  if ((r = seek(fd, 4)) < 0 || (r = readn(fd, &word, 4)) != 4)
+    panic("read %s: %e", BIGNAME, r);
+  if (word != 0xdeadbeef)
+    panic("MAP_SHARED write lost: %08x", word);
+  if ((r = seek(fd, PGSIZE + 4)) < 0 || (r = readn(fd, &word, 4)) != 4)
+    panic("read %s: %e", BIGNAME, r);
+  if (word != PGSIZE / 4 + 1)
+    panic("MAP_PRIVATE write reached the file: %08x", word);
+}
+
+void
+umain(int argc, char **argv)
+{
+  uint32_t seed;
+  unsigned cold, warm;
+  off_t size;
+  char *map;
+  int fd, i, r;
+
+  binaryname = "mmapbench";
+  size = 1024 * 1024;
+  if (argc > 1)
+    size = strtol(argv[1], 0, 0) * 1024;
+  size = ROUNDUP(size, PGSIZE);
+
+  mkfile(size);
+  seed = 1;
+  for (i = 0; i < NACCESS; i++) {
+    seed = seed * 1103515245 + 12345;
+    offsets[i] = ((seed >> 8) % (size / RECSIZE)) * RECSIZE;
+  }
+
+  if ((fd = open(BIGNAME, O_RDWR)) < 0)
+    panic("open %s: %e", BIGNAME, fd);
+  if ((r = mmap(fd, 0, size, MAP_RDONLY, (void **) &map)) < 0)
+    panic("mmap %s: %e", BIGNAME, r);
+
+  cprintf("mmapbench: %d KB, %d random %d-byte records\n", size / 1024,
+          NACCESS, RECSIZE);
+  cold = byread(fd);
+  warm = byread(fd);
+  cprintf("mmapbench: seek+read  %5d us/record, again %5d us/record\n",
+          cold, warm);
+  cold = bymap(map);
+  warm = bymap(map);
+  cprintf("mmapbench: mmap       %5d us/record, again %5d us/record\n",
+          cold, warm);
+
+  if ((r = munmap(map)) < 0)
+    panic("munmap %s: %e", BIGNAME, r);
+  checkwrite(fd);
+  cprintf("mmapbench: MAP_SHARED and MAP_PRIVATE writes OK\n");
+  close(fd);
+
+  // Give the space back (there is no remove).
+  if ((fd = open(BIGNAME, O_RDWR | O_TRUNC)) >= 0)
+    close(fd);
+}
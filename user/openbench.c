@@ -0,0 +1,92 @@
+// Measure open and close with many files held open.  Time NOPS opens
+// and closes of a file with no other files open, then again while
+// NCHILD children hold NHOLD files open each.  The file server looks
+// for closed entries only when its free list runs out, so the two
+// should take about as long; its open file table statistics show how
+// often it had to look.
+//
+// usage: openbench [NOPS]
+
+#include <inc/lib.h>
+
+#define NAME            "/openbench"
+#define NCHILD          30
+#define NHOLD           30      // files per child; lib/fd.c allows 32
+
+// Shared with the children: set when they may let go.
+#define STOPVA          0x30000000
+static volatile uint32_t *stop = (volatile uint32_t *) STOPVA;
+
+// Open and close NAME 'n' times; returns opens per second.
+static unsigned
+openclose(int n)
+{
+  unsigned start, ms;
+  int i, fd;
+
+  start = sys_time_msec();
+  for (i = 0; i < n; i++) {
+    if ((fd = open(NAME, O_RDONLY)) < 0)
+      panic("open %s: %e", NAME, fd);
+    close(fd);
+  }
+  ms = sys_time_msec() - start;
+  return n * 1000 / MAX(ms, 1);
+}
+
+static void
+report(const char *what, int n)
+{
+  struct Fsret_stats st;
+  unsigned rate;
+  int r;
+
+  rate = openclose(n);
+  if ((r = fs_stats(0, &st)) < 0)
+    panic("fs_stats: %e", r);
+  cprintf("openbench: %-22s %6d opens/s, %4d entries free, %4d scans\n",
+          what, rate, st.ret_of_free, st.ret_of_sweeps);
+}
+
+void
+umain(int argc, char **argv)
+{
+  envid_t kids[NCHILD];
+  char what[32];
+  int nops, i, j, fd, r;
+
+  binaryname = "openbench";
+  nops = 2000;
+  if (argc > 1)
+    nops = strtol(argv[1], 0, 0);
+
+  if ((r = sys_page_alloc(0, (void *) stop, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+    panic("sys_page_alloc: %e", r);
+  if ((fd = open(NAME, O_RDWR | O_CREAT)) < 0)
+    panic("open %s: %e", NAME, fd);
+  close(fd);
+
+  report("none held open:", nops);
+
+  *stop = 0;
+  for (i = 0; i < NCHILD; i++) {
+    if ((kids[i] = fork()) < 0)
+      panic("fork: %e", kids[i]);
+    if (kids[i] == 0) {
+      for (j = 0; j < NHOLD; j++)
+        if ((fd = open(NAME, O_RDONLY)) < 0)
+          panic("open %s: %e", NAME, fd);
+      ipc_send(thisenv->env_parent_id, 0, 0, 0);
+      while (!*stop)
+        sys_yield();
+      exit();
+    }
+    ipc_recv(NULL, 0, NULL);
+  }
+  snprintf(what, sizeof(what), "%d held open:", NCHILD * NHOLD);
+  report(what, nops);
+
+  *stop = 1;
+  for (i = 0; i < NCHILD; i++)
+    wait(kids[i]);
+}
@@ -0,0 +1,98 @@
+// Measure pipe bandwidth for classic pipes, bulk pipes and
+// splicing pages into a bulk pipe.
+//
+// usage: pipebench [KB]
+
+#include <inc/lib.h>
+
+#define NBUF    (2*PGSIZE)
+
+uint8_t wbuf[NBUF] __attribute__((aligned(PGSIZE)));
+uint8_t rbuf[NBUF] __attribute__((aligned(PGSIZE)));
+
+// Scratch page handed to pipe_splice; it is unmapped on each call.
+#define SPLICEVA        ((void*) 0x0a000000)
+
+static void
+reader(int fd, size_t total, bool splice)
+{
+  size_t got;
+  ssize_t n;
+
+  for (got = 0; got < total; got += n) {
+    if (splice)
+      n = pipe_splice_read(fd, rbuf);
+    else
+      n = read(fd, rbuf, NBUF);
+    if (n < 0)
+      panic("pipebench read: %e", n);
+    if (n == 0)
+      panic("pipebench: early eof after %d bytes", got);
+  }
+  exit();
+}
+
+static void
+writer(int fd, size_t total, bool splice)
+{
+  size_t sent;
+  ssize_t n;
+  int r;
+
+  for (sent = 0; sent < total; sent += n) {
+    if (splice) {
+      if ((r = sys_page_alloc(0, SPLICEVA, PTE_P|PTE_U|PTE_W)) < 0)
+        panic("sys_page_alloc: %e", r);
+      *(uint32_t*) SPLICEVA = sent;
+      n = pipe_splice(fd, SPLICEVA, 1);
+    } else
+      n = write(fd, wbuf, MIN(NBUF, total - sent));
+    if (n <= 0)
+      panic("pipebench write: %e", n);
+  }
+}
+
+static void
+run(const char *name, int mode, bool splice, size_t total)
+{
+  int p[2], r;
+  envid_t child;
+  unsigned start, ms;
+
+  if ((r = pipe2(p, mode)) < 0)
+    panic("pipe2: %e", r);
+
+  start = sys_time_msec();
+  if ((child = fork()) < 0)
+    panic("fork: %e", child);
+  if (child == 0) {
+    close(p[1]);
+    reader(p[0], total, splice);
+  }
+  close(p[0]);
+  writer(p[1], total, splice);
+  close(p[1]);
+  wait(child);
+  ms = sys_time_msec() - start;
+
+  if (ms == 0)
+    ms = 1;
+  cprintf("pipebench: %-8s %6d KB in %5d ms = %5d KB/s (%d MB/s)\n",
+          name, total / 1024, ms,
+          (total / 1024) * 1000 / ms, (total / 1024) * 1000 / ms / 1024);
+}
+
+void
+umain(int argc, char **argv)
+{
+  size_t kb = 4096;
+
+  binaryname = "pipebench";
+  if (argc > 1)
+    kb = strtol(argv[1], 0, 0);
+
+  memset(wbuf, 'x', sizeof(wbuf));
+  run("classic", 0, 0, ROUNDUP(kb, 4) * 1024 / 4);
+  run("bulk", PIPE_BULK, 0, kb * 1024);
+  run("splice", PIPE_BULK, 1, ROUNDUP(kb * 1024, PGSIZE));
+}
@@ -0,0 +1,99 @@
+// Measure random reads from a cold block cache.  Each round picks
+// NREAD random blocks of a file and reads them, either one at a time
+// or after handing them all to the file server with prefetch(), whose
+// disk queue either runs them as they came (fifo) or merges adjacent
+// blocks and sorts them (c-look).  Reports time, disk reads and how
+// far the disk moved between them.
+//
+// usage: randbench [NREAD [SIZE_KB]]
+
+#include <inc/lib.h>
+
+#define NAME            "/randbench.data"
+#define ROUNDS          8
+#define MAXREAD         256
+
+static char buf[BLKSIZE];
+static off_t offsets[MAXREAD];
+static uint32_t seed;
+
+static uint32_t
+rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+static void
+run(const char *name, int sched, bool hint, int fd, int nread, off_t size)
+{
+  struct Fsret_stats before, after;
+  unsigned ms;
+  int i, round, r;
+
+  if ((r = fs_set_sched(sched)) < 0)
+    panic("fs_set_sched: %e", r);
+
+  seed = 1;
+  ms = 0;
+  for (round = 0; round < ROUNDS; round++) {
+    for (i = 0; i < nread; i++)
+      offsets[i] = rand() % (size / BLKSIZE) * BLKSIZE;
+
+    if ((r = fs_dropcache()) < 0)
+      panic("fs_dropcache: %e", r);
+    if (round == 0 && (r = fs_stats(0, &before)) < 0)
+      panic("fs_stats: %e", r);
+
+    ms -= sys_time_msec();
+    if (hint && (r = prefetch(fd, offsets, nread)) < 0)
+      panic("prefetch: %e", r);
+    for (i = 0; i < nread; i++) {
+      if ((r = seek(fd, offsets[i])) < 0)
+        panic("seek: %e", r);
+      if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+        panic("read: %e", r);
+    }
+    ms += sys_time_msec();
+  }
+  if ((r = fs_stats(0, &after)) < 0)
+    panic("fs_stats: %e", r);
+
+  cprintf("randbench: %-8s %4d reads x%d  %5d ms  %5d disk reads  "
+          "%5d merged  seek %7d blocks\n", name, nread, ROUNDS, ms,
+          after.ret_bio_reads - before.ret_bio_reads,
+          after.ret_bio_merged - before.ret_bio_merged,
+          after.ret_bio_seek - before.ret_bio_seek);
+}
+
+void
+umain(int argc, char **argv)
+{
+  off_t size, off;
+  int fd, nread, r;
+
+  binaryname = "randbench";
+  nread = 64;
+  size = 1024 * 1024;
+  if (argc > 1)
+    nread = MIN(strtol(argv[1], 0, 0), MAXREAD);
+  if (argc > 2)
+    size = ROUNDUP(strtol(argv[2], 0, 0) * 1024, BLKSIZE);
+
+  if ((fd = open(NAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+    panic("open %s: %e", NAME, fd);
+  for (off = 0; off < size; off += BLKSIZE)
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+      panic("write %s: %e", NAME, r);
+  if ((r = sync()) < 0)
+    panic("sync: %e", r);
+
+  run("demand", BIO_SCHED_CLOOK, 0, fd, nread, size);
+  run("fifo", BIO_SCHED_FIFO, 1, fd, nread, size);
+  run("c-look", BIO_SCHED_CLOOK, 1, fd, nread, size);
+  close(fd);
+
+  // Give the space back (there is no remove).
+  if ((fd = open(NAME, O_RDWR | O_TRUNC)) >= 0)
+    close(fd);
+}
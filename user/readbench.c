@@ -0,0 +1,81 @@
+// Measure read throughput from a cold block cache, reading each file
+// front to back (so the file server reads ahead) and back to front
+// (so it can't), a block per read.
+//
+// usage: readbench [SIZE_KB]
+
+#include <inc/lib.h>
+
+#define BIGNAME         "/readbench.big"
+
+static char buf[BLKSIZE];
+
+// Read 'path' cold, a block at a time, forwards or backwards; return
+// the elapsed ms.
+static unsigned
+readfile(const char *path, off_t size, bool backward)
+{
+  unsigned start;
+  int fd, r;
+  off_t off, nblocks, i;
+
+  if ((r = fs_dropcache()) < 0)
+    panic("fs_dropcache: %e", r);
+  start = sys_time_msec();
+  if ((fd = open(path, O_RDONLY)) < 0)
+    panic("open %s: %e", path, fd);
+  nblocks = ROUNDUP(size, BLKSIZE) / BLKSIZE;
+  for (i = 0; i < nblocks; i++) {
+    off = (backward ? nblocks - 1 - i : i) * BLKSIZE;
+    if ((r = seek(fd, off)) < 0)
+      panic("seek %s: %e", path, r);
+    if ((r = readn(fd, buf, MIN(BLKSIZE, size - off))) < 0)
+      panic("read %s: %e", path, r);
+  }
+  close(fd);
+  return sys_time_msec() - start;
+}
+
+static void
+run(const char *path, off_t size)
+{
+  unsigned fwd, bwd;
+
+  fwd = readfile(path, size, 0);
+  bwd = readfile(path, size, 1);
+  cprintf("readbench: %-16s %6d KB  sequential %5d ms = %6d KB/s  "
+          "reverse %5d ms = %6d KB/s\n", path, size / 1024,
+          fwd, size / 1024 * 1000 / MAX(fwd, 1),
+          bwd, size / 1024 * 1000 / MAX(bwd, 1));
+}
+
+void
+umain(int argc, char **argv)
+{
+  struct Stat st;
+  off_t size, off;
+  int fd, r;
+
+  binaryname = "readbench";
+  size = 1024 * 1024;
+  if (argc > 1)
+    size = strtol(argv[1], 0, 0) * 1024;
+
+  if ((r = stat("/lorem", &st)) < 0)
+    panic("stat /lorem: %e", r);
+  run("/lorem", st.st_size);
+
+  if ((fd = open(BIGNAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+    panic("open %s: %e", BIGNAME, fd);
+  for (off = 0; off < size; off += BLKSIZE)
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+      panic("write %s: %e", BIGNAME, r);
+  close(fd);
+  sync();
+
+  run(BIGNAME, size);
+
+  // Give the space back (there is no remove).
+  if ((fd = open(BIGNAME, O_RDWR | O_TRUNC)) >= 0)
+    close(fd);
+}
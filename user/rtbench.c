@@ -0,0 +1,100 @@
+// Count the file server round trips FSREQ_COMPOUND saves: stat a file
+// as open, fstat and close, and with stat; load an ELF header as open,
+// readn and close, and with open_read and close; and spawn a program
+// (whose header load is open_read).  Reports requests and us per
+// operation, from the server's request count.
+//
+// usage: rtbench [N]
+
+#include <inc/lib.h>
+
+#define PROG            "/rtbench"
+
+static struct Fsret_stats before;
+static unsigned start;
+
+static void
+begin(void)
+{
+  int r;
+
+  if ((r = fs_stats(0, &before)) < 0)
+    panic("fs_stats: %e", r);
+  start = sys_time_msec();
+}
+
+static void
+end(const char *what, int n)
+{
+  struct Fsret_stats after;
+  unsigned ms;
+  int r;
+
+  ms = sys_time_msec() - start;
+  if ((r = fs_stats(0, &after)) < 0)
+    panic("fs_stats: %e", r);
+  // The second fs_stats counts itself.
+  cprintf("rtbench: %-18s %2d requests  %5d us\n", what,
+          (after.ret_fs_requests - before.ret_fs_requests - 1) / n,
+          ms * 1000 / n);
+}
+
+void
+umain(int argc, char **argv)
+{
+  const char *cargv[] = { "rtbench", "child", 0 };
+  unsigned char hdr[512];
+  struct Stat st;
+  ssize_t nread;
+  envid_t child;
+  int n, i, fd, r;
+
+  binaryname = "rtbench";
+  if (argc > 1 && strcmp(argv[1], "child") == 0)
+    return;
+
+  n = 100;
+  if (argc > 1)
+    n = strtol(argv[1], 0, 0);
+
+  begin();
+  for (i = 0; i < n; i++) {
+    if ((fd = open(PROG, O_RDONLY)) < 0 || (r = fstat(fd, &st)) < 0)
+      panic("stat %s: %e", PROG, fd < 0 ? fd : r);
+    close(fd);
+  }
+  end("open+fstat+close", n);
+
+  begin();
+  for (i = 0; i < n; i++)
+    if ((r = stat(PROG, &st)) < 0)
+      panic("stat %s: %e", PROG, r);
+  end("stat", n);
+
+  begin();
+  for (i = 0; i < n; i++) {
+    if ((fd = open(PROG, O_RDONLY)) < 0 ||
+        (r = readn(fd, hdr, sizeof(hdr))) != sizeof(hdr))
+      panic("read %s: %e", PROG, fd < 0 ? fd : r);
+    close(fd);
+  }
+  end("open+readn+close", n);
+
+  begin();
+  for (i = 0; i < n; i++) {
+    if ((fd = open_read(PROG, O_RDONLY, hdr, sizeof(hdr), &nread)) < 0 ||
+        nread != sizeof(hdr))
+      panic("open_read %s: %e", PROG, fd);
+    close(fd);
+  }
+  end("open_read+close", n);
+
+  n = MAX(n / 10, 1);
+  begin();
+  for (i = 0; i < n; i++) {
+    if ((child = spawn(PROG, cargv)) < 0)
+      panic("spawn: %e", child);
+    wait(child);
+  }
+  end("spawn", n);
+}
@@ -75,7 +75,7 @@ again:
       break;
 
     case '|':                   // Pipe
-      if ((r = pipe(p)) < 0) {
+      if ((r = pipe2(p, PIPE_BULK)) < 0) {
         cprintf("pipe: %e", r);
         exit();
       }
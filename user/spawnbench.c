@@ -0,0 +1,47 @@
+// Measure spawn latency with spawn's page mapping calls batched into
+// a few sys_batch traps, and with each call issued on its own.
+//
+// usage: spawnbench [NSPAWNS]
+
+#include <inc/lib.h>
+
+static unsigned
+run(int n)
+{
+  const char *argv[] = { "spawnbench", "child", 0 };
+  unsigned start;
+  envid_t child;
+  int i;
+
+  start = sys_time_msec();
+  for (i = 0; i < n; i++) {
+    if ((child = spawn("spawnbench", argv)) < 0)
+      panic("spawn: %e", child);
+    wait(child);
+  }
+  return sys_time_msec() - start;
+}
+
+void
+umain(int argc, char **argv)
+{
+  unsigned batched, serial;
+  int n;
+
+  binaryname = "spawnbench";
+  if (argc > 1 && strcmp(argv[1], "child") == 0)
+    return;
+
+  n = 20;
+  if (argc > 1)
+    n = strtol(argv[1], 0, 0);
+
+  sysbatch_serial = 0;
+  batched = run(n);
+  sysbatch_serial = 1;
+  serial = run(n);
+  sysbatch_serial = 0;
+
+  cprintf("spawnbench: %d spawns  batched %d us/spawn  unbatched %d us/spawn\n",
+          n, batched * 1000 / n, serial * 1000 / n);
+}
@@ -0,0 +1,105 @@
+// Measure what tiny files cost.  Write NFILES files of NINLINE bytes,
+// which the file server keeps inline in their File records, and NFILES
+// of NINLINE + 1, which each need a data block.  Then for each set
+// report the disk blocks it took, and the mean time to open, read and
+// close a file of it from a cold block cache, and the blocks the cache
+// read from the disk (and so holds) for the set: once with open_read,
+// and once with open and a read() of a block, which the file server
+// answers by sending pages.  The blocks the set takes after that show
+// whether reading changed how its files are kept.
+//
+// usage: tinybench [NFILES]
+
+#include <inc/lib.h>
+
+static char buf[BLKSIZE];
+
+static void
+getstats(struct Fsret_stats *st)
+{
+  int r;
+
+  if ((r = fs_stats(0, st)) < 0)
+    panic("fs_stats: %e", r);
+}
+
+// Open, read and close each file of the set from a cold cache, with
+// open_read or, if 'paged', open and read().
+static void
+readall(const char *prefix, int nfiles, size_t size, bool paged)
+{
+  struct Fsret_stats before, after;
+  char path[MAXNAMELEN];
+  unsigned start, ms;
+  ssize_t nread;
+  int i, fd, r;
+
+  if ((r = fs_dropcache()) < 0)
+    panic("fs_dropcache: %e", r);
+  getstats(&before);
+  start = sys_time_msec();
+  for (i = 0; i < nfiles; i++) {
+    snprintf(path, sizeof(path), "%s%d", prefix, i);
+    if (paged) {
+      if ((fd = open(path, O_RDONLY)) < 0)
+        panic("open %s: %e", path, fd);
+      if ((nread = read(fd, buf, sizeof(buf))) != size)
+        panic("read %s: %e", path, nread);
+    } else if ((fd = open_read(path, O_RDONLY, buf, size, &nread)) < 0 ||
+               nread != size)
+      panic("open_read %s: %e", path, fd);
+    close(fd);
+  }
+  ms = sys_time_msec() - start;
+  getstats(&after);
+  cprintf("tinybench: %s cold: %5d us/file, %4d blocks read\n",
+          paged ? "read()   " : "open_read", ms * 1000 / nfiles,
+          after.ret_bc_misses + after.ret_bc_readahead -
+          before.ret_bc_misses - before.ret_bc_readahead);
+}
+
+static void
+run(const char *prefix, int nfiles, size_t size)
+{
+  struct Fsret_stats before, after;
+  char path[MAXNAMELEN];
+  int i, fd, r;
+
+  getstats(&before);
+  for (i = 0; i < nfiles; i++) {
+    snprintf(path, sizeof(path), "%s%d", prefix, i);
+    if ((fd = open(path, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+      panic("open %s: %e", path, fd);
+    if ((r = write(fd, buf, size)) != size)
+      panic("write %s: %e", path, r);
+    close(fd);
+  }
+  if ((r = sync()) < 0)
+    panic("sync: %e", r);
+  getstats(&after);
+  cprintf("tinybench: %d files of %3d bytes: %4d disk blocks\n", nfiles,
+          size, before.ret_fs_nfree - after.ret_fs_nfree);
+
+  readall(prefix, nfiles, size, 0);
+  readall(prefix, nfiles, size, 1);
+  if ((r = sync()) < 0)
+    panic("sync: %e", r);
+  getstats(&after);
+  cprintf("tinybench: after reading them:       %4d disk blocks\n",
+          before.ret_fs_nfree - after.ret_fs_nfree);
+}
+
+void
+umain(int argc, char **argv)
+{
+  int nfiles;
+
+  binaryname = "tinybench";
+  nfiles = 1000;
+  if (argc > 1)
+    nfiles = strtol(argv[1], 0, 0);
+  memset(buf, 't', sizeof(buf));
+
+  run("/tiny.i", nfiles, NINLINE);
+  run("/tiny.b", nfiles, NINLINE + 1);
+}
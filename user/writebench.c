@@ -0,0 +1,72 @@
+// Measure write throughput for many small files and the time to sync
+// them, with the number of disk writes the file server needed.
+//
+// usage: writebench [NFILES [FILE_BYTES]]
+
+#include <inc/lib.h>
+
+static char buf[BLKSIZE];
+
+static void
+mkfile(const char *path, int size)
+{
+  int fd, r;
+
+  if ((fd = open(path, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+    panic("open %s: %e", path, fd);
+  if (size > 0 && (r = write(fd, buf, size)) != size)
+    panic("write %s: %e", path, r);
+  close(fd);
+}
+
+void
+umain(int argc, char **argv)
+{
+  struct Fsret_stats before, after;
+  char path[MAXNAMELEN];
+  unsigned start, write_ms, sync_ms;
+  int i, n, size, r;
+
+  binaryname = "writebench";
+  n = 128;
+  size = 1024;
+  if (argc > 1)
+    n = strtol(argv[1], 0, 0);
+  if (argc > 2)
+    size = MIN(strtol(argv[2], 0, 0), BLKSIZE);
+  memset(buf, 'w', sizeof(buf));
+
+  // Start from a clean cache.
+  if ((r = sync()) < 0)
+    panic("sync: %e", r);
+  if ((r = fs_stats(0, &before)) < 0)
+    panic("fs_stats: %e", r);
+
+  start = sys_time_msec();
+  for (i = 0; i < n; i++) {
+    snprintf(path, sizeof(path), "/writebench.%d", i);
+    mkfile(path, size);
+  }
+  write_ms = sys_time_msec() - start;
+
+  start = sys_time_msec();
+  if ((r = sync()) < 0)
+    panic("sync: %e", r);
+  sync_ms = sys_time_msec() - start;
+
+  if ((r = fs_stats(0, &after)) < 0)
+    panic("fs_stats: %e", r);
+
+  cprintf("writebench: %d files x %d bytes  write %d ms = %d KB/s  "
+          "sync %d ms\n", n, size, write_ms,
+          n * size / 1024 * 1000 / MAX(write_ms, 1), sync_ms);
+  cprintf("writebench: %d blocks in %d disk writes\n",
+          after.ret_bc_written - before.ret_bc_written,
+          after.ret_bc_writes - before.ret_bc_writes);
+
+  // Give the space back (there is no remove).
+  for (i = 0; i < n; i++) {
+    snprintf(path, sizeof(path), "/writebench.%d", i);
+    mkfile(path, 0);
+  }
+}